@@ -0,0 +1,318 @@
+//! Benchmarks of the paths through which most of the communication with the browser engine goes.
+//!
+//! Run them with `cargo bench --bench hot_paths`, or with `--features threadsafe` to include the cross-thread dispatches.
+//! Every result is printed as a line of JSON.
+//! If `BW_BENCH_OUTPUT` is set, all results are written to that file as well, as one JSON array, so that they can be compared between upgrades.
+
+use browser_window::application::*;
+use browser_window::browser::*;
+use browser_window::cookie::*;
+
+use serde_json::{json, Value};
+
+use std::{
+	cell::RefCell,
+	env,
+	fs,
+	rc::Rc,
+	sync::{Arc, Mutex, atomic::{AtomicUsize, Ordering}},
+	time::{Duration, Instant}
+};
+
+use futures_channel::oneshot;
+
+
+
+/// The number of times every benchmark is measured, after being run once to warm up.
+const SAMPLES: usize = 10;
+
+
+
+/// The durations measured for one benchmark, of which each sample covers `iterations` operations.
+struct Measurement {
+	name: String,
+	iterations: usize,
+	bytes: usize,	// The number of bytes that every operation moves, if any
+	samples: Vec<Duration>
+}
+
+impl Measurement {
+
+	fn new( name: &str, iterations: usize, bytes: usize ) -> Self {
+		Self {
+			name: name.into(),
+			iterations,
+			bytes,
+			samples: Vec::with_capacity( SAMPLES )
+		}
+	}
+
+	fn to_json( &self ) -> Value {
+		let mut sorted: Vec<f64> = self.samples.iter().map( |s| s.as_nanos() as f64 / self.iterations as f64 ).collect();
+		sorted.sort_by( |a, b| a.partial_cmp( b ).unwrap() );
+		let mean = sorted.iter().sum::<f64>() / sorted.len() as f64;
+		let percentile = |fraction: f64| sorted[ ( ( sorted.len() - 1 ) as f64 * fraction ).round() as usize ];
+
+		let mut result = json!({
+			"name": self.name,
+			"samples": sorted.len(),
+			"iterations": self.iterations,
+			"mean_ns": mean,
+			"median_ns": percentile( 0.5 ),
+			"p99_ns": percentile( 0.99 ),
+			"min_ns": sorted[0],
+			"max_ns": sorted[ sorted.len() - 1 ],
+			"ops_per_sec": 1e9 / mean
+		});
+		if self.bytes > 0 {
+			result["bytes_per_sec"] = json!( self.bytes as f64 * 1e9 / mean );
+		}
+		result
+	}
+}
+
+/// Collects the results of all benchmarks.
+struct Report {
+	results: Vec<Value>
+}
+
+impl Report {
+
+	fn add( &mut self, measurement: Measurement ) {
+		let result = measurement.to_json();
+		println!( "{}", result );
+		self.results.push( result );
+	}
+
+	fn write( &self ) {
+		if let Ok( path ) = env::var( "BW_BENCH_OUTPUT" ) {
+			fs::write( &path, Value::Array( self.results.clone() ).to_string() ).expect( "unable to write benchmark results" );
+		}
+	}
+}
+
+
+
+fn main() {
+	let exec_path = env::current_dir().unwrap().join( "target/release/browser-window-se" );
+	let settings = ApplicationSettings {
+		engine_seperate_executable_path: Some( exec_path ),
+		..Default::default()
+	};
+	let application = Application::initialize( &settings ).expect( "unable to initialize application" );
+	let runtime = application.start();
+
+	let exit_code = runtime.run_async( |app| async move {
+		let mut report = Report { results: Vec::new() };
+
+		// The handler counts the calls of `invoke_extern`, and reports when the expected number of them has arrived
+		let invocations = Arc::new( AtomicUsize::new( 0 ) );
+		let invocations_done: Arc<Mutex<Option<(usize, oneshot::Sender<()>)>>> = Arc::new( Mutex::new( None ) );
+		let mut bwb = BrowserWindowBuilder::new( Source::Html( "<body></body>".into() ) );
+		bwb.title( "Benchmarks" );
+		let (counter, done) = (invocations.clone(), invocations_done.clone());
+		bwb.async_handler( move |_, _, _| {
+			let count = counter.fetch_add( 1, Ordering::SeqCst ) + 1;
+			let mut done = done.lock().unwrap();
+			if done.as_ref().map( |(expected, _)| count >= *expected ).unwrap_or( false ) {
+				let _ = done.take().unwrap().1.send( () );
+			}
+			async {}
+		} );
+		let bw = bwb.build( app ).await;
+
+		bench_eval_js( &mut report, &bw ).await;
+		bench_invoke_extern( &mut report, &bw, &invocations, &invocations_done ).await;
+		#[cfg(feature = "threadsafe")]
+		bench_cross_thread_dispatch( &mut report, app ).await;
+		bench_delayed_dispatch( &mut report, app ).await;
+		bench_cookies( &mut report, app ).await;
+		bench_window_lifecycle( &mut report, app ).await;
+
+		report.write();
+		bw.close();
+	} );
+
+	assert!( exit_code == 0 );
+}
+
+/// The round trip of a script that returns a string of the same size as the script itself.
+async fn bench_eval_js( report: &mut Report, bw: &BrowserWindow ) {
+	for (size, iterations) in [(10, 1000), (1_000, 1000), (100_000, 100), (10_000_000, 2)] {
+		let script = format!( "'{}'", "x".repeat( size - 2 ) );
+
+		let mut latency = Measurement::new( &format!( "eval_js/latency/{}", size ), 1, size * 2 );
+		let mut throughput = Measurement::new( &format!( "eval_js/throughput/{}", size ), iterations, size * 2 );
+		bw.eval_js( &script ).await.unwrap();
+		for _ in 0..SAMPLES {
+			let start = Instant::now();
+			bw.eval_js( &script ).await.unwrap();
+			latency.samples.push( start.elapsed() );
+
+			// Evaluations that are sent at once, are answered in one go as well
+			let start = Instant::now();
+			let scripts: Vec<&str> = (0..iterations).map( |_| script.as_str() ).collect();
+			for result in bw.eval_js_batch( &scripts ).await {
+				result.unwrap();
+			}
+			throughput.samples.push( start.elapsed() );
+		}
+		report.add( latency );
+		report.add( throughput );
+	}
+}
+
+async fn bench_invoke_extern( report: &mut Report, bw: &BrowserWindow, invocations: &AtomicUsize, done: &Mutex<Option<(usize, oneshot::Sender<()>)>> ) {
+	const CALLS: usize = 10_000;
+
+	let mut measurement = Measurement::new( "invoke_extern/throughput", CALLS, 0 );
+	for sample in 0..=SAMPLES {
+		let (tx, rx) = oneshot::channel();
+		*done.lock().unwrap() = Some( ( invocations.load( Ordering::SeqCst ) + CALLS, tx ) );
+
+		let start = Instant::now();
+		bw.exec_js( &format!( "for ( let i = 0; i < {}; i++ ) invoke_extern( 'bench', String( i ) );", CALLS ) );
+		rx.await.unwrap();
+		if sample > 0 {
+			measurement.samples.push( start.elapsed() );
+		}
+	}
+	report.add( measurement );
+}
+
+/// Work that is dispatched to the GUI thread from several other threads at once.
+#[cfg(feature = "threadsafe")]
+async fn bench_cross_thread_dispatch( report: &mut Report, app: ApplicationHandle ) {
+	const THREADS: usize = 4;
+	const DISPATCHES: usize = 25_000;
+
+	let app = app.into_threaded();
+	let mut measurement = Measurement::new( "dispatch/cross_thread", THREADS * DISPATCHES, 0 );
+	for sample in 0..=SAMPLES {
+		let (tx, rx) = oneshot::channel::<()>();
+		let remaining = Arc::new( AtomicUsize::new( THREADS * DISPATCHES ) );
+		let tx = Arc::new( Mutex::new( Some( tx ) ) );
+
+		let start = Instant::now();
+		let threads: Vec<_> = (0..THREADS).map( |_| {
+			let (app, remaining, tx) = (app.clone(), remaining.clone(), tx.clone());
+			std::thread::spawn( move || {
+				for _ in 0..DISPATCHES {
+					let (remaining, tx) = (remaining.clone(), tx.clone());
+					app.dispatch( move |_| {
+						if remaining.fetch_sub( 1, Ordering::SeqCst ) == 1 {
+							let _ = tx.lock().unwrap().take().unwrap().send( () );
+						}
+					} );
+				}
+			} )
+		} ).collect();
+		rx.await.unwrap();
+		if sample > 0 {
+			measurement.samples.push( start.elapsed() );
+		}
+
+		for thread in threads {
+			thread.join().unwrap();
+		}
+	}
+	report.add( measurement );
+}
+
+/// Schedules many timers with delays that are spread over 10 ms, and measures until the last one has fired.
+async fn bench_delayed_dispatch( report: &mut Report, app: ApplicationHandle ) {
+	const TIMERS: usize = 10_000;
+
+	let mut scheduling = Measurement::new( "dispatch_delayed/schedule", TIMERS, 0 );
+	let mut firing = Measurement::new( "dispatch_delayed/all_fired", TIMERS, 0 );
+	for sample in 0..=SAMPLES {
+		let (tx, rx) = oneshot::channel::<()>();
+		let remaining = Rc::new( RefCell::new( ( TIMERS, Some( tx ) ) ) );
+
+		let start = Instant::now();
+		for i in 0..TIMERS {
+			let remaining = remaining.clone();
+			app.dispatch_delayed( move |_| {
+				let mut remaining = remaining.borrow_mut();
+				remaining.0 -= 1;
+				if remaining.0 == 0 {
+					let _ = remaining.1.take().unwrap().send( () );
+				}
+			}, Duration::from_micros( ( i * 7919 % 10_000 ) as u64 ) );
+		}
+		let scheduled = start.elapsed();
+		rx.await.unwrap();
+		if sample > 0 {
+			scheduling.samples.push( scheduled );
+			firing.samples.push( start.elapsed() );
+		}
+	}
+	report.add( scheduling );
+	report.add( firing );
+}
+
+async fn bench_cookies( report: &mut Report, app: ApplicationHandle ) {
+	const COOKIES: usize = 10_000;
+	const URL: &str = "https://bench.browser-window.invalid/";
+
+	let mut jar = app.cookie_jar();
+	let cookies: Vec<Cookie> = (0..COOKIES).map( |i| Cookie::new( &format!( "cookie{}", i ), "value" ) ).collect();
+
+	let mut storing = Measurement::new( "cookies/store", COOKIES, 0 );
+	let mut iterating = Measurement::new( "cookies/iterate", COOKIES, 0 );
+	for sample in 0..=SAMPLES {
+		let start = Instant::now();
+		jar.store_many( URL, &cookies ).await;
+		let stored = start.elapsed();
+
+		let start = Instant::now();
+		let mut count = 0;
+		{
+			let mut iter = jar.iter( URL, true );
+			while iter.next().await.is_some() {
+				count += 1;
+			}
+		}
+		let iterated = start.elapsed();
+		assert!( count > 0 );
+
+		jar.clear( URL ).await;
+		if sample > 0 {
+			storing.samples.push( stored );
+			iterating.samples.push( iterated );
+		}
+	}
+	report.add( storing );
+	report.add( iterating );
+}
+
+/// Creating windows is measured until the browser is ready to be used, and destroying them until the call returns.
+async fn bench_window_lifecycle( report: &mut Report, app: ApplicationHandle ) {
+	const WINDOWS: usize = 100;
+
+	let mut creation = Measurement::new( "window/create", WINDOWS, 0 );
+	let mut destruction = Measurement::new( "window/destroy", WINDOWS, 0 );
+	for sample in 0..=SAMPLES {
+		let start = Instant::now();
+		let mut windows = Vec::with_capacity( WINDOWS );
+		for _ in 0..WINDOWS {
+			let mut bwb = BrowserWindowBuilder::new( Source::Html( "<body></body>".into() ) );
+			bwb.title( "Lifecycle Benchmark" );
+			windows.push( bwb.build( app ).await );
+		}
+		let created = start.elapsed();
+
+		let start = Instant::now();
+		for bw in windows {
+			bw.close();
+		}
+		let destroyed = start.elapsed();
+
+		if sample > 0 {
+			creation.samples.push( created );
+			destruction.samples.push( destroyed );
+		}
+	}
+	report.add( creation );
+	report.add( destruction );
+}
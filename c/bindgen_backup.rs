@@ -2,6 +2,7 @@
 
 pub const cTRUE: u32 = 1;
 pub const cFALSE: u32 = 0;
+pub const c_STDINT_H: u32 = 1;
 pub const c_FEATURES_H: u32 = 1;
 pub const c_DEFAULT_SOURCE: u32 = 1;
 pub const c__GLIBC_USE_ISOC2X: u32 = 0;
@@ -18,23 +19,24 @@ pub const c__USE_POSIX199506: u32 = 1;
 pub const c__USE_XOPEN2K: u32 = 1;
 pub const c__USE_XOPEN2K8: u32 = 1;
 pub const c_ATFILE_SOURCE: u32 = 1;
+pub const c_STDC_PREDEF_H: u32 = 1;
+pub const c__STDC_IEC_559__: u32 = 1;
+pub const c__STDC_IEC_559_COMPLEX__: u32 = 1;
+pub const c__STDC_ISO_10646__: u32 = 201706;
+pub const c__WORDSIZE: u32 = 64;
+pub const c__WORDSIZE_TIME64_COMPAT32: u32 = 1;
+pub const c__SYSCALL_WORDSIZE: u32 = 64;
+pub const c__TIMESIZE: u32 = 64;
 pub const c__USE_MISC: u32 = 1;
 pub const c__USE_ATFILE: u32 = 1;
 pub const c__USE_FORTIFY_LEVEL: u32 = 0;
 pub const c__GLIBC_USE_DEPRECATED_GETS: u32 = 0;
 pub const c__GLIBC_USE_DEPRECATED_SCANF: u32 = 0;
-pub const c_STDC_PREDEF_H: u32 = 1;
-pub const c__STDC_IEC_559__: u32 = 1;
-pub const c__STDC_IEC_559_COMPLEX__: u32 = 1;
-pub const c__STDC_ISO_10646__: u32 = 201706;
 pub const c__GNU_LIBRARY__: u32 = 6;
 pub const c__GLIBC__: u32 = 2;
 pub const c__GLIBC_MINOR__: u32 = 31;
 pub const c_SYS_CDEFS_H: u32 = 1;
 pub const c__glibc_c99_flexarr_available: u32 = 1;
-pub const c__WORDSIZE: u32 = 64;
-pub const c__WORDSIZE_TIME64_COMPAT32: u32 = 1;
-pub const c__SYSCALL_WORDSIZE: u32 = 64;
 pub const c__LONG_DOUBLE_USES_FLOAT128: u32 = 0;
 pub const c__HAVE_GENERIC_SELECTION: u32 = 1;
 pub const c__GLIBC_USE_LIB_EXT2: u32 = 0;
@@ -43,6 +45,64 @@ pub const c__GLIBC_USE_IEC_60559_BFP_EXT_C2X: u32 = 0;
 pub const c__GLIBC_USE_IEC_60559_FUNCS_EXT: u32 = 0;
 pub const c__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X: u32 = 0;
 pub const c__GLIBC_USE_IEC_60559_TYPES_EXT: u32 = 0;
+pub const c_BITS_TYPES_H: u32 = 1;
+pub const c_BITS_TYPESIZES_H: u32 = 1;
+pub const c__OFF_T_MATCHES_OFF64_T: u32 = 1;
+pub const c__INO_T_MATCHES_INO64_T: u32 = 1;
+pub const c__RLIM_T_MATCHES_RLIM64_T: u32 = 1;
+pub const c__STATFS_MATCHES_STATFS64: u32 = 1;
+pub const c__FD_SETSIZE: u32 = 1024;
+pub const c_BITS_TIME64_H: u32 = 1;
+pub const c_BITS_WCHAR_H: u32 = 1;
+pub const c_BITS_STDINT_INTN_H: u32 = 1;
+pub const c_BITS_STDINT_UINTN_H: u32 = 1;
+pub const cINT8_MIN: i32 = -128;
+pub const cINT16_MIN: i32 = -32768;
+pub const cINT32_MIN: i32 = -2147483648;
+pub const cINT8_MAX: u32 = 127;
+pub const cINT16_MAX: u32 = 32767;
+pub const cINT32_MAX: u32 = 2147483647;
+pub const cUINT8_MAX: u32 = 255;
+pub const cUINT16_MAX: u32 = 65535;
+pub const cUINT32_MAX: u32 = 4294967295;
+pub const cINT_LEAST8_MIN: i32 = -128;
+pub const cINT_LEAST16_MIN: i32 = -32768;
+pub const cINT_LEAST32_MIN: i32 = -2147483648;
+pub const cINT_LEAST8_MAX: u32 = 127;
+pub const cINT_LEAST16_MAX: u32 = 32767;
+pub const cINT_LEAST32_MAX: u32 = 2147483647;
+pub const cUINT_LEAST8_MAX: u32 = 255;
+pub const cUINT_LEAST16_MAX: u32 = 65535;
+pub const cUINT_LEAST32_MAX: u32 = 4294967295;
+pub const cINT_FAST8_MIN: i32 = -128;
+pub const cINT_FAST16_MIN: i64 = -9223372036854775808;
+pub const cINT_FAST32_MIN: i64 = -9223372036854775808;
+pub const cINT_FAST8_MAX: u32 = 127;
+pub const cINT_FAST16_MAX: u64 = 9223372036854775807;
+pub const cINT_FAST32_MAX: u64 = 9223372036854775807;
+pub const cUINT_FAST8_MAX: u32 = 255;
+pub const cUINT_FAST16_MAX: i32 = -1;
+pub const cUINT_FAST32_MAX: i32 = -1;
+pub const cINTPTR_MIN: i64 = -9223372036854775808;
+pub const cINTPTR_MAX: u64 = 9223372036854775807;
+pub const cUINTPTR_MAX: i32 = -1;
+pub const cPTRDIFF_MIN: i64 = -9223372036854775808;
+pub const cPTRDIFF_MAX: u64 = 9223372036854775807;
+pub const cSIG_ATOMIC_MIN: i32 = -2147483648;
+pub const cSIG_ATOMIC_MAX: u32 = 2147483647;
+pub const cSIZE_MAX: i32 = -1;
+pub const cWINT_MIN: u32 = 0;
+pub const cWINT_MAX: u32 = 4294967295;
+pub const cBW_LATENCY_HISTOGRAM_SUB_BUCKETS: u32 = 8;
+pub const cBW_LATENCY_HISTOGRAM_BUCKETS: u32 = 272;
+pub const cBW_SLAB_CHUNK_SIZE: u32 = 32;
+pub const cBW_SLAB_MAX_CHUNKS: u32 = 2048;
+pub const cBW_APPLICATION_DISPATCH_PRIORITY_HIGH: u32 = 0;
+pub const cBW_APPLICATION_DISPATCH_PRIORITY_NORMAL: u32 = 1;
+pub const cBW_APPLICATION_DISPATCH_PRIORITY_IDLE: u32 = 2;
+pub const cBW_APPLICATION_DISPATCH_PRIORITY_COUNT: u32 = 3;
+pub const cBW_APPLICATION_MEMORY_PRESSURE_MODERATE: u32 = 0;
+pub const cBW_APPLICATION_MEMORY_PRESSURE_CRITICAL: u32 = 1;
 pub const c_STDLIB_H: u32 = 1;
 pub const cWNOHANG: u32 = 1;
 pub const cWUNTRACED: u32 = 2;
@@ -78,20 +138,10 @@ pub const cRAND_MAX: u32 = 2147483647;
 pub const cEXIT_FAILURE: u32 = 1;
 pub const cEXIT_SUCCESS: u32 = 0;
 pub const c_SYS_TYPES_H: u32 = 1;
-pub const c_BITS_TYPES_H: u32 = 1;
-pub const c__TIMESIZE: u32 = 64;
-pub const c_BITS_TYPESIZES_H: u32 = 1;
-pub const c__OFF_T_MATCHES_OFF64_T: u32 = 1;
-pub const c__INO_T_MATCHES_INO64_T: u32 = 1;
-pub const c__RLIM_T_MATCHES_RLIM64_T: u32 = 1;
-pub const c__STATFS_MATCHES_STATFS64: u32 = 1;
-pub const c__FD_SETSIZE: u32 = 1024;
-pub const c_BITS_TIME64_H: u32 = 1;
 pub const c__clock_t_defined: u32 = 1;
 pub const c__clockid_t_defined: u32 = 1;
 pub const c__time_t_defined: u32 = 1;
 pub const c__timer_t_defined: u32 = 1;
-pub const c_BITS_STDINT_INTN_H: u32 = 1;
 pub const c__BIT_TYPES_DEFINED__: u32 = 1;
 pub const c_ENDIAN_H: u32 = 1;
 pub const c_BITS_ENDIAN_H: u32 = 1;
@@ -134,46 +184,22 @@ pub const c_BITS_TYPES_LOCALE_T_H: u32 = 1;
 pub const c_BITS_TYPES___LOCALE_T_H: u32 = 1;
 pub const c_STRINGS_H: u32 = 1;
 pub const cBW_ERR_CODE_SUCCESS: u32 = 0;
-pub const c_STDINT_H: u32 = 1;
-pub const c_BITS_WCHAR_H: u32 = 1;
-pub const c_BITS_STDINT_UINTN_H: u32 = 1;
-pub const cINT8_MIN: i32 = -128;
-pub const cINT16_MIN: i32 = -32768;
-pub const cINT32_MIN: i32 = -2147483648;
-pub const cINT8_MAX: u32 = 127;
-pub const cINT16_MAX: u32 = 32767;
-pub const cINT32_MAX: u32 = 2147483647;
-pub const cUINT8_MAX: u32 = 255;
-pub const cUINT16_MAX: u32 = 65535;
-pub const cUINT32_MAX: u32 = 4294967295;
-pub const cINT_LEAST8_MIN: i32 = -128;
-pub const cINT_LEAST16_MIN: i32 = -32768;
-pub const cINT_LEAST32_MIN: i32 = -2147483648;
-pub const cINT_LEAST8_MAX: u32 = 127;
-pub const cINT_LEAST16_MAX: u32 = 32767;
-pub const cINT_LEAST32_MAX: u32 = 2147483647;
-pub const cUINT_LEAST8_MAX: u32 = 255;
-pub const cUINT_LEAST16_MAX: u32 = 65535;
-pub const cUINT_LEAST32_MAX: u32 = 4294967295;
-pub const cINT_FAST8_MIN: i32 = -128;
-pub const cINT_FAST16_MIN: i64 = -9223372036854775808;
-pub const cINT_FAST32_MIN: i64 = -9223372036854775808;
-pub const cINT_FAST8_MAX: u32 = 127;
-pub const cINT_FAST16_MAX: u64 = 9223372036854775807;
-pub const cINT_FAST32_MAX: u64 = 9223372036854775807;
-pub const cUINT_FAST8_MAX: u32 = 255;
-pub const cUINT_FAST16_MAX: i32 = -1;
-pub const cUINT_FAST32_MAX: i32 = -1;
-pub const cINTPTR_MIN: i64 = -9223372036854775808;
-pub const cINTPTR_MAX: u64 = 9223372036854775807;
-pub const cUINTPTR_MAX: i32 = -1;
-pub const cPTRDIFF_MIN: i64 = -9223372036854775808;
-pub const cPTRDIFF_MAX: u64 = 9223372036854775807;
-pub const cSIG_ATOMIC_MIN: i32 = -2147483648;
-pub const cSIG_ATOMIC_MAX: u32 = 2147483647;
-pub const cSIZE_MAX: i32 = -1;
-pub const cWINT_MIN: u32 = 0;
-pub const cWINT_MAX: u32 = 4294967295;
+pub const cBW_JS_VALUE_UNDEFINED: u32 = 0;
+pub const cBW_JS_VALUE_NULL: u32 = 1;
+pub const cBW_JS_VALUE_BOOLEAN: u32 = 2;
+pub const cBW_JS_VALUE_NUMBER: u32 = 3;
+pub const cBW_JS_VALUE_STRING: u32 = 4;
+pub const cBW_JS_VALUE_ARRAY: u32 = 5;
+pub const cBW_JS_VALUE_OBJECT: u32 = 6;
+pub const cBW_JS_VALUE_BINARY: u32 = 7;
+pub const cBW_COOKIE_FIELD_NAME: u32 = 1;
+pub const cBW_COOKIE_FIELD_VALUE: u32 = 2;
+pub const cBW_COOKIE_FIELD_DOMAIN: u32 = 4;
+pub const cBW_COOKIE_FIELD_PATH: u32 = 8;
+pub const cBW_COOKIE_FIELD_TIMES: u32 = 16;
+pub const cBW_COOKIE_FIELD_FLAGS: u32 = 32;
+pub const cBW_COOKIE_FIELD_ALL: u32 = 255;
+pub const cBW_RESOURCE_SCHEME: &'static [u8; 4usize] = b"app\0";
 pub const c_ASSERT_H: u32 = 1;
 pub const c_STDIO_H: u32 = 1;
 pub const c__GNUC_VA_LIST: u32 = 1;
@@ -204,6 +230,30 @@ pub const cFOPEN_MAX: u32 = 16;
 pub const ctrue: u32 = 1;
 pub const cfalse: u32 = 0;
 pub const c__bool_true_false_are_defined: u32 = 1;
+pub const cBW_WINDOW_THROTTLE_NEVER: u32 = 0;
+pub const cBW_WINDOW_THROTTLE_HIDDEN: u32 = 1;
+pub const cBW_WINDOW_THROTTLE_OCCLUDED: u32 = 2;
+pub const cBW_WINDOW_VISIBILITY_VISIBLE: u32 = 0;
+pub const cBW_WINDOW_VISIBILITY_OCCLUDED: u32 = 1;
+pub const cBW_WINDOW_VISIBILITY_HIDDEN: u32 = 2;
+pub const cBW_BROWSER_WINDOW_JS_ERROR_EXCEPTION: u32 = 1;
+pub const cBW_BROWSER_WINDOW_JS_ERROR_CANCELLED: u32 = 2;
+pub const cBW_BROWSER_WINDOW_JS_ERROR_TIMED_OUT: u32 = 3;
+pub const cBW_BROWSER_WINDOW_OUTPUT_ERROR_UNSUPPORTED: u32 = 1;
+pub const cBW_BROWSER_WINDOW_OUTPUT_ERROR_CANCELLED: u32 = 2;
+pub const cBW_BROWSER_WINDOW_OUTPUT_ERROR_FAILED: u32 = 3;
+pub const cBW_BROWSER_WINDOW_OUTPUT_ERROR_TIMED_OUT: u32 = 4;
+pub const cBW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK: u32 = 0;
+pub const cBW_BROWSER_WINDOW_INVOKE_OVERFLOW_DROP_OLDEST: u32 = 1;
+pub const cBW_BROWSER_WINDOW_INVOKE_OVERFLOW_COALESCE: u32 = 2;
+pub const cBW_BROWSER_WINDOW_EVENT_LOAD_START: u32 = 0;
+pub const cBW_BROWSER_WINDOW_EVENT_LOAD_END: u32 = 1;
+pub const cBW_BROWSER_WINDOW_EVENT_URL_CHANGE: u32 = 2;
+pub const cBW_BROWSER_WINDOW_EVENT_TITLE_CHANGE: u32 = 3;
+pub const cBW_BROWSER_WINDOW_EVENT_PROGRESS: u32 = 4;
+pub const cBW_BROWSER_WINDOW_OUTPUT_RGBA: u32 = 0;
+pub const cBW_BROWSER_WINDOW_OUTPUT_PNG: u32 = 1;
+pub const cBW_BROWSER_WINDOW_OUTPUT_PDF: u32 = 2;
 pub type cBOOL = ::std::os::raw::c_int;
 pub type csize_t = ::std::os::raw::c_ulong;
 pub type cwchar_t = ::std::os::raw::c_int;
@@ -252,6 +302,212 @@ fn bindgen_test_layout_cmax_align_t() {
         )
     );
 }
+#[doc = " A histogram of latencies in microseconds, with logarithmic buckets that are linearly subdivided, like an HDR histogram."]
+#[doc = " Values can be recorded from any thread without taking a lock."]
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct cbw_LatencyHistogram {
+    pub count: u64,
+    pub sum: u64,
+    pub max: u64,
+    pub buckets: [u64; 272usize],
+}
+#[test]
+fn bindgen_test_layout_cbw_LatencyHistogram() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_LatencyHistogram>(),
+        2200usize,
+        concat!("Size of: ", stringify!(cbw_LatencyHistogram))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_LatencyHistogram>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_LatencyHistogram))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_LatencyHistogram>())).count as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_LatencyHistogram),
+            "::",
+            stringify!(count)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_LatencyHistogram>())).sum as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_LatencyHistogram),
+            "::",
+            stringify!(sum)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_LatencyHistogram>())).max as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_LatencyHistogram),
+            "::",
+            stringify!(max)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_LatencyHistogram>())).buckets as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_LatencyHistogram),
+            "::",
+            stringify!(buckets)
+        )
+    );
+}
+extern "C" {
+    #[doc = " Returns the largest value that is counted in the bucket at `index`."]
+    #[doc = " Every bucket counts the values that are larger than the upper bound of the bucket before it."]
+    #[link_name = "\u{1}bw_LatencyHistogram_bucketUpperBound"]
+    pub fn cbw_LatencyHistogram_bucketUpperBound(index: csize_t) -> u64;
+}
+extern "C" {
+    #[doc = " Returns the value below which the given fraction of all recorded values lie, like 0.99 for the 99th percentile."]
+    #[doc = " The value is the upper bound of the bucket it has been counted in, but never more than the largest recorded value."]
+    #[link_name = "\u{1}bw_LatencyHistogram_percentile"]
+    pub fn cbw_LatencyHistogram_percentile(
+        histogram: *const cbw_LatencyHistogram,
+        fraction: f64,
+    ) -> u64;
+}
+extern "C" {
+    #[doc = " Counts the given value in the histogram."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_LatencyHistogram_record"]
+    pub fn cbw_LatencyHistogram_record(histogram: *mut cbw_LatencyHistogram, value: u64);
+}
+extern "C" {
+    #[doc = " Copies the histogram into `snapshot`, while values may be recorded into it at the same time."]
+    #[doc = " Each field is read atomically, but a value that is recorded in the meantime may only be included in some of them."]
+    #[link_name = "\u{1}bw_LatencyHistogram_snapshot"]
+    pub fn cbw_LatencyHistogram_snapshot(
+        histogram: *const cbw_LatencyHistogram,
+        snapshot: *mut cbw_LatencyHistogram,
+    );
+}
+extern "C" {
+    #[doc = " Adds `value` to one of the counters of a metrics struct."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}_bw_Metrics_count"]
+    pub fn c_bw_Metrics_count(counter: *mut u64, value: u64);
+}
+extern "C" {
+    #[doc = " Reads one of the counters of a metrics struct."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}_bw_Metrics_read"]
+    pub fn c_bw_Metrics_read(counter: *const u64) -> u64;
+}
+#[doc = " Identifies an object in a slab, with the index of its slot in the lower 32 bits, and the generation of the slot in the upper 32 bits."]
+#[doc = " The generation is increased whenever the object is freed, so a handle of an object that is gone never matches the slot again."]
+#[doc = " 0 is never a valid handle."]
+pub type cbw_SlabHandle = u64;
+#[doc = " An allocator for objects of the same size, that are kept in chunks which are never moved or freed until the slab is destroyed."]
+#[doc = " Freed slots are reused first, so that creating and destroying objects over and over doesn't fragment the heap."]
+#[doc = " Objects are allocated and freed on one thread, but looking one up by its handle is thread safe."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_Slab {
+    pub slot_size: csize_t,
+    pub chunks: *mut *mut ::std::os::raw::c_void,
+    pub slot_count: u32,
+    pub free_slot: u32,
+}
+#[test]
+fn bindgen_test_layout_cbw_Slab() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_Slab>(),
+        24usize,
+        concat!("Size of: ", stringify!(cbw_Slab))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_Slab>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_Slab))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Slab>())).slot_size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Slab),
+            "::",
+            stringify!(slot_size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Slab>())).chunks as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Slab),
+            "::",
+            stringify!(chunks)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Slab>())).slot_count as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Slab),
+            "::",
+            stringify!(slot_count)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Slab>())).free_slot as *const _ as usize },
+        20usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Slab),
+            "::",
+            stringify!(free_slot)
+        )
+    );
+}
+extern "C" {
+    #[doc = " Returns memory for a new object, or null if the slab is full."]
+    #[link_name = "\u{1}bw_Slab_alloc"]
+    pub fn cbw_Slab_alloc(slab: *mut cbw_Slab) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[doc = " Frees all chunks of the slab, including the objects that are still in it."]
+    #[link_name = "\u{1}bw_Slab_destroy"]
+    pub fn cbw_Slab_destroy(slab: *mut cbw_Slab);
+}
+extern "C" {
+    #[doc = " Gives the slot of the object back to the slab, after which its handle won't be found anymore."]
+    #[link_name = "\u{1}bw_Slab_free"]
+    pub fn cbw_Slab_free(slab: *mut cbw_Slab, object: *mut ::std::os::raw::c_void);
+}
+extern "C" {
+    #[doc = " Returns the object that the handle belongs to, or null if it has been freed in the meantime."]
+    #[doc = " This function is thread safe, but the object may of course still get freed by the thread that allocates them."]
+    #[link_name = "\u{1}bw_Slab_get"]
+    pub fn cbw_Slab_get(
+        slab: *const cbw_Slab,
+        handle: cbw_SlabHandle,
+    ) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[doc = " Returns the handle of an object that has been allocated with `bw_Slab_alloc`."]
+    #[link_name = "\u{1}bw_Slab_handle"]
+    pub fn cbw_Slab_handle(object: *const ::std::os::raw::c_void) -> cbw_SlabHandle;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Slab_init"]
+    pub fn cbw_Slab_init(slab: *mut cbw_Slab, object_size: csize_t);
+}
 #[doc = " A 'string slice'"]
 #[doc = " Points to a mutable, non-zero-terminated, UTF-8 encoded string."]
 #[doc = " Using rust's string's memory layout."]
@@ -341,6 +597,34 @@ extern "C" {
     #[link_name = "\u{1}bw_string_copyAsNewCstr"]
     pub fn cbw_string_copyAsNewCstr(str_: cbw_CStrSlice) -> *mut ::std::os::raw::c_char;
 }
+extern "C" {
+    #[doc = " Returns the number of UTF-16 code units that the UTF-8 string takes up once it is converted."]
+    #[link_name = "\u{1}bw_string_utf16Length"]
+    pub fn cbw_string_utf16Length(str_: cbw_CStrSlice) -> csize_t;
+}
+extern "C" {
+    #[doc = " Converts the UTF-8 string to UTF-16 straight into `buffer`, which needs to have room for `bw_string_utf16Length( str )` code units."]
+    #[doc = " Invalid sequences become U+FFFD."]
+    #[doc = " Returns the number of code units written."]
+    #[link_name = "\u{1}bw_string_toUtf16"]
+    pub fn cbw_string_toUtf16(str_: cbw_CStrSlice, buffer: *mut u16) -> csize_t;
+}
+extern "C" {
+    #[doc = " Returns the number of bytes that the UTF-16 string takes up once it is converted to UTF-8."]
+    #[link_name = "\u{1}bw_string_utf8Length"]
+    pub fn cbw_string_utf8Length(str_: *const u16, len: csize_t) -> csize_t;
+}
+extern "C" {
+    #[doc = " Converts the UTF-16 string to UTF-8 straight into `buffer`, which needs to have room for `bw_string_utf8Length( str, len )` bytes."]
+    #[doc = " Unpaired surrogates become U+FFFD."]
+    #[doc = " Returns the number of bytes written."]
+    #[link_name = "\u{1}bw_string_toUtf8"]
+    pub fn cbw_string_toUtf8(
+        str_: *const u16,
+        len: csize_t,
+        buffer: *mut ::std::os::raw::c_char,
+    ) -> csize_t;
+}
 extern "C" {
     #[doc = " Frees the string allocated with any of the functions of this module."]
     #[link_name = "\u{1}bw_string_freeCstr"]
@@ -354,6 +638,8 @@ pub type cbw_ApplicationDispatchFn = ::std::option::Option<
     unsafe extern "C" fn(app: *mut cbw_Application, data: *mut ::std::os::raw::c_void),
 >;
 pub type cbw_ApplicationReadyFn = cbw_ApplicationDispatchFn;
+pub type cbw_ApplicationDispatchPriority = ::std::os::raw::c_uchar;
+pub type cbw_ApplicationMemoryPressure = ::std::os::raw::c_uchar;
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
 pub struct cbw_ApplicationImpl {}
@@ -620,4847 +906,8464 @@ pub type c__int32_t = ::std::os::raw::c_int;
 pub type c__uint32_t = ::std::os::raw::c_uint;
 pub type c__int64_t = ::std::os::raw::c_long;
 pub type c__uint64_t = ::std::os::raw::c_ulong;
-pub type c__int_least8_t = c__int8_t;
-pub type c__uint_least8_t = c__uint8_t;
-pub type c__int_least16_t = c__int16_t;
-pub type c__uint_least16_t = c__uint16_t;
-pub type c__int_least32_t = c__int32_t;
-pub type c__uint_least32_t = c__uint32_t;
-pub type c__int_least64_t = c__int64_t;
-pub type c__uint_least64_t = c__uint64_t;
-pub type c__quad_t = ::std::os::raw::c_long;
-pub type c__u_quad_t = ::std::os::raw::c_ulong;
-pub type c__intmax_t = ::std::os::raw::c_long;
-pub type c__uintmax_t = ::std::os::raw::c_ulong;
-pub type c__dev_t = ::std::os::raw::c_ulong;
-pub type c__uid_t = ::std::os::raw::c_uint;
-pub type c__gid_t = ::std::os::raw::c_uint;
-pub type c__ino_t = ::std::os::raw::c_ulong;
-pub type c__ino64_t = ::std::os::raw::c_ulong;
-pub type c__mode_t = ::std::os::raw::c_uint;
-pub type c__nlink_t = ::std::os::raw::c_ulong;
-pub type c__off_t = ::std::os::raw::c_long;
-pub type c__off64_t = ::std::os::raw::c_long;
-pub type c__pid_t = ::std::os::raw::c_int;
+pub type cbw_ErrCode = ::std::os::raw::c_uint;
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct c__fsid_t {
-    pub __val: [::std::os::raw::c_int; 2usize],
-}
-#[test]
-fn bindgen_test_layout_c__fsid_t() {
+pub struct cbw_Err {
+    pub code: cbw_ErrCode,
+    pub data: *const ::std::os::raw::c_void,
+    pub alloc_message: ::std::option::Option<
+        unsafe extern "C" fn(
+            code: cbw_ErrCode,
+            data: *const ::std::os::raw::c_void,
+        ) -> *mut ::std::os::raw::c_char,
+    >,
+}
+#[test]
+fn bindgen_test_layout_cbw_Err() {
     assert_eq!(
-        ::std::mem::size_of::<c__fsid_t>(),
-        8usize,
-        concat!("Size of: ", stringify!(c__fsid_t))
+        ::std::mem::size_of::<cbw_Err>(),
+        24usize,
+        concat!("Size of: ", stringify!(cbw_Err))
     );
     assert_eq!(
-        ::std::mem::align_of::<c__fsid_t>(),
-        4usize,
-        concat!("Alignment of ", stringify!(c__fsid_t))
+        ::std::mem::align_of::<cbw_Err>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_Err))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__fsid_t>())).__val as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<cbw_Err>())).code as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__fsid_t),
+            stringify!(cbw_Err),
             "::",
-            stringify!(__val)
+            stringify!(code)
         )
     );
-}
-pub type c__clock_t = ::std::os::raw::c_long;
-pub type c__rlim_t = ::std::os::raw::c_ulong;
-pub type c__rlim64_t = ::std::os::raw::c_ulong;
-pub type c__id_t = ::std::os::raw::c_uint;
-pub type c__time_t = ::std::os::raw::c_long;
-pub type c__useconds_t = ::std::os::raw::c_uint;
-pub type c__suseconds_t = ::std::os::raw::c_long;
-pub type c__daddr_t = ::std::os::raw::c_int;
-pub type c__key_t = ::std::os::raw::c_int;
-pub type c__clockid_t = ::std::os::raw::c_int;
-pub type c__timer_t = *mut ::std::os::raw::c_void;
-pub type c__blksize_t = ::std::os::raw::c_long;
-pub type c__blkcnt_t = ::std::os::raw::c_long;
-pub type c__blkcnt64_t = ::std::os::raw::c_long;
-pub type c__fsblkcnt_t = ::std::os::raw::c_ulong;
-pub type c__fsblkcnt64_t = ::std::os::raw::c_ulong;
-pub type c__fsfilcnt_t = ::std::os::raw::c_ulong;
-pub type c__fsfilcnt64_t = ::std::os::raw::c_ulong;
-pub type c__fsword_t = ::std::os::raw::c_long;
-pub type c__ssize_t = ::std::os::raw::c_long;
-pub type c__syscall_slong_t = ::std::os::raw::c_long;
-pub type c__syscall_ulong_t = ::std::os::raw::c_ulong;
-pub type c__loff_t = c__off64_t;
-pub type c__caddr_t = *mut ::std::os::raw::c_char;
-pub type c__intptr_t = ::std::os::raw::c_long;
-pub type c__socklen_t = ::std::os::raw::c_uint;
-pub type c__sig_atomic_t = ::std::os::raw::c_int;
-pub type cu_char = c__u_char;
-pub type cu_short = c__u_short;
-pub type cu_int = c__u_int;
-pub type cu_long = c__u_long;
-pub type cquad_t = c__quad_t;
-pub type cu_quad_t = c__u_quad_t;
-pub type cfsid_t = c__fsid_t;
-pub type cloff_t = c__loff_t;
-pub type cino_t = c__ino_t;
-pub type cdev_t = c__dev_t;
-pub type cgid_t = c__gid_t;
-pub type cmode_t = c__mode_t;
-pub type cnlink_t = c__nlink_t;
-pub type cuid_t = c__uid_t;
-pub type coff_t = c__off_t;
-pub type cpid_t = c__pid_t;
-pub type cid_t = c__id_t;
-pub type cssize_t = c__ssize_t;
-pub type cdaddr_t = c__daddr_t;
-pub type ccaddr_t = c__caddr_t;
-pub type ckey_t = c__key_t;
-pub type cclock_t = c__clock_t;
-pub type cclockid_t = c__clockid_t;
-pub type ctime_t = c__time_t;
-pub type ctimer_t = c__timer_t;
-pub type culong = ::std::os::raw::c_ulong;
-pub type cushort = ::std::os::raw::c_ushort;
-pub type cuint = ::std::os::raw::c_uint;
-pub type cu_int8_t = c__uint8_t;
-pub type cu_int16_t = c__uint16_t;
-pub type cu_int32_t = c__uint32_t;
-pub type cu_int64_t = c__uint64_t;
-pub type cregister_t = ::std::os::raw::c_long;
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct c__sigset_t {
-    pub __val: [::std::os::raw::c_ulong; 16usize],
-}
-#[test]
-fn bindgen_test_layout_c__sigset_t() {
-    assert_eq!(
-        ::std::mem::size_of::<c__sigset_t>(),
-        128usize,
-        concat!("Size of: ", stringify!(c__sigset_t))
-    );
     assert_eq!(
-        ::std::mem::align_of::<c__sigset_t>(),
+        unsafe { &(*(::std::ptr::null::<cbw_Err>())).data as *const _ as usize },
         8usize,
-        concat!("Alignment of ", stringify!(c__sigset_t))
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Err),
+            "::",
+            stringify!(data)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__sigset_t>())).__val as *const _ as usize },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Err>())).alloc_message as *const _ as usize },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__sigset_t),
+            stringify!(cbw_Err),
             "::",
-            stringify!(__val)
+            stringify!(alloc_message)
         )
     );
 }
-pub type csigset_t = c__sigset_t;
+extern "C" {
+    #[link_name = "\u{1}bw_Err_msg_success"]
+    pub fn cbw_Err_msg_success(
+        arg1: cbw_ErrCode,
+        arg2: *const ::std::os::raw::c_void,
+    ) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Err_msg_string"]
+    pub fn cbw_Err_msg_string(
+        arg1: cbw_ErrCode,
+        arg2: *const ::std::os::raw::c_void,
+    ) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Err_free"]
+    pub fn cbw_Err_free(err: *mut cbw_Err);
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Err_new_with_msg"]
+    pub fn cbw_Err_new_with_msg(code: cbw_ErrCode, msg: *const ::std::os::raw::c_char) -> cbw_Err;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Err_message"]
+    pub fn cbw_Err_message(error: *const cbw_Err) -> *mut ::std::os::raw::c_char;
+}
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct ctimeval {
-    pub tv_sec: c__time_t,
-    pub tv_usec: c__suseconds_t,
+pub struct cbw_ApplicationDispatchData {
+    pub func: cbw_ApplicationDispatchFn,
+    pub data: *mut ::std::os::raw::c_void,
+    pub next: *mut cbw_ApplicationDispatchData,
+    pub queued_at: u64,
 }
 #[test]
-fn bindgen_test_layout_ctimeval() {
+fn bindgen_test_layout_cbw_ApplicationDispatchData() {
     assert_eq!(
-        ::std::mem::size_of::<ctimeval>(),
-        16usize,
-        concat!("Size of: ", stringify!(ctimeval))
+        ::std::mem::size_of::<cbw_ApplicationDispatchData>(),
+        32usize,
+        concat!("Size of: ", stringify!(cbw_ApplicationDispatchData))
     );
     assert_eq!(
-        ::std::mem::align_of::<ctimeval>(),
+        ::std::mem::align_of::<cbw_ApplicationDispatchData>(),
         8usize,
-        concat!("Alignment of ", stringify!(ctimeval))
+        concat!("Alignment of ", stringify!(cbw_ApplicationDispatchData))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<ctimeval>())).tv_sec as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchData>())).func as *const _ as usize
+        },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(ctimeval),
+            stringify!(cbw_ApplicationDispatchData),
             "::",
-            stringify!(tv_sec)
+            stringify!(func)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<ctimeval>())).tv_usec as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchData>())).data as *const _ as usize
+        },
         8usize,
         concat!(
             "Offset of field: ",
-            stringify!(ctimeval),
+            stringify!(cbw_ApplicationDispatchData),
             "::",
-            stringify!(tv_usec)
+            stringify!(data)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchData>())).next as *const _ as usize
+        },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_ApplicationDispatchData),
+            "::",
+            stringify!(next)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchData>())).queued_at as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_ApplicationDispatchData),
+            "::",
+            stringify!(queued_at)
         )
     );
 }
+#[doc = " An intrusive multi-producer single-consumer queue of dispatched functions, that is drained by the GUI thread."]
+#[doc = " Any thread can push without taking a lock, and the GUI thread only needs to be woken up when the queue wasn't already waiting to be drained."]
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct ctimespec {
-    pub tv_sec: c__time_t,
-    pub tv_nsec: c__syscall_slong_t,
+pub struct cbw_ApplicationDispatchQueue {
+    pub head: *mut cbw_ApplicationDispatchData,
+    pub tail: *mut cbw_ApplicationDispatchData,
+    pub stub: cbw_ApplicationDispatchData,
+    pub wakeup_pending: ::std::os::raw::c_int,
+    pub length: u64,
 }
 #[test]
-fn bindgen_test_layout_ctimespec() {
+fn bindgen_test_layout_cbw_ApplicationDispatchQueue() {
     assert_eq!(
-        ::std::mem::size_of::<ctimespec>(),
-        16usize,
-        concat!("Size of: ", stringify!(ctimespec))
+        ::std::mem::size_of::<cbw_ApplicationDispatchQueue>(),
+        64usize,
+        concat!("Size of: ", stringify!(cbw_ApplicationDispatchQueue))
     );
     assert_eq!(
-        ::std::mem::align_of::<ctimespec>(),
+        ::std::mem::align_of::<cbw_ApplicationDispatchQueue>(),
         8usize,
-        concat!("Alignment of ", stringify!(ctimespec))
+        concat!("Alignment of ", stringify!(cbw_ApplicationDispatchQueue))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<ctimespec>())).tv_sec as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchQueue>())).head as *const _ as usize
+        },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(ctimespec),
+            stringify!(cbw_ApplicationDispatchQueue),
             "::",
-            stringify!(tv_sec)
+            stringify!(head)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<ctimespec>())).tv_nsec as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchQueue>())).tail as *const _ as usize
+        },
         8usize,
         concat!(
             "Offset of field: ",
-            stringify!(ctimespec),
+            stringify!(cbw_ApplicationDispatchQueue),
             "::",
-            stringify!(tv_nsec)
+            stringify!(tail)
         )
     );
-}
-pub type csuseconds_t = c__suseconds_t;
-pub type c__fd_mask = ::std::os::raw::c_long;
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cfd_set {
-    pub __fds_bits: [c__fd_mask; 16usize],
-}
-#[test]
-fn bindgen_test_layout_cfd_set() {
-    assert_eq!(
-        ::std::mem::size_of::<cfd_set>(),
-        128usize,
-        concat!("Size of: ", stringify!(cfd_set))
-    );
     assert_eq!(
-        ::std::mem::align_of::<cfd_set>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cfd_set))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchQueue>())).stub as *const _ as usize
+        },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_ApplicationDispatchQueue),
+            "::",
+            stringify!(stub)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cfd_set>())).__fds_bits as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchQueue>())).wakeup_pending as *const _
+                as usize
+        },
+        48usize,
         concat!(
             "Offset of field: ",
-            stringify!(cfd_set),
+            stringify!(cbw_ApplicationDispatchQueue),
             "::",
-            stringify!(__fds_bits)
-        )
-    );
-}
-pub type cfd_mask = c__fd_mask;
-extern "C" {
-    #[link_name = "\u{1}select"]
-    pub fn cselect(
-        __nfds: ::std::os::raw::c_int,
-        __readfds: *mut cfd_set,
-        __writefds: *mut cfd_set,
-        __exceptfds: *mut cfd_set,
-        __timeout: *mut ctimeval,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}pselect"]
-    pub fn cpselect(
-        __nfds: ::std::os::raw::c_int,
-        __readfds: *mut cfd_set,
-        __writefds: *mut cfd_set,
-        __exceptfds: *mut cfd_set,
-        __timeout: *const ctimespec,
-        __sigmask: *const c__sigset_t,
-    ) -> ::std::os::raw::c_int;
-}
-pub type cblksize_t = c__blksize_t;
-pub type cblkcnt_t = c__blkcnt_t;
-pub type cfsblkcnt_t = c__fsblkcnt_t;
-pub type cfsfilcnt_t = c__fsfilcnt_t;
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct c__pthread_internal_list {
-    pub __prev: *mut c__pthread_internal_list,
-    pub __next: *mut c__pthread_internal_list,
-}
-#[test]
-fn bindgen_test_layout_c__pthread_internal_list() {
-    assert_eq!(
-        ::std::mem::size_of::<c__pthread_internal_list>(),
-        16usize,
-        concat!("Size of: ", stringify!(c__pthread_internal_list))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<c__pthread_internal_list>(),
-        8usize,
-        concat!("Alignment of ", stringify!(c__pthread_internal_list))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_internal_list>())).__prev as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__pthread_internal_list),
-            "::",
-            stringify!(__prev)
+            stringify!(wakeup_pending)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_internal_list>())).__next as *const _ as usize },
-        8usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationDispatchQueue>())).length as *const _ as usize
+        },
+        56usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_internal_list),
+            stringify!(cbw_ApplicationDispatchQueue),
             "::",
-            stringify!(__next)
+            stringify!(length)
         )
     );
 }
-pub type c__pthread_list_t = c__pthread_internal_list;
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct c__pthread_internal_slist {
-    pub __next: *mut c__pthread_internal_slist,
-}
-#[test]
-fn bindgen_test_layout_c__pthread_internal_slist() {
-    assert_eq!(
-        ::std::mem::size_of::<c__pthread_internal_slist>(),
-        8usize,
-        concat!("Size of: ", stringify!(c__pthread_internal_slist))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<c__pthread_internal_slist>(),
-        8usize,
-        concat!("Alignment of ", stringify!(c__pthread_internal_slist))
-    );
-    assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_internal_slist>())).__next as *const _ as usize
-        },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__pthread_internal_slist),
-            "::",
-            stringify!(__next)
-        )
-    );
+pub struct cbw_BrowserWindowPool {
+    _unused: [u8; 0],
 }
-pub type c__pthread_slist_t = c__pthread_internal_slist;
+#[doc = " The memory in use by the application in this process, in bytes."]
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct c__pthread_mutex_s {
-    pub __lock: ::std::os::raw::c_int,
-    pub __count: ::std::os::raw::c_uint,
-    pub __owner: ::std::os::raw::c_int,
-    pub __nusers: ::std::os::raw::c_uint,
-    pub __kind: ::std::os::raw::c_int,
-    pub __spins: ::std::os::raw::c_short,
-    pub __elision: ::std::os::raw::c_short,
-    pub __list: c__pthread_list_t,
+pub struct cbw_ApplicationMemoryStats {
+    pub browser_windows: csize_t,
+    pub pending_calls: csize_t,
+    pub queued_bytes: csize_t,
+    pub cached_response_bytes: csize_t,
+    pub queued_dispatches: csize_t,
+    pub process_private_bytes: u64,
 }
 #[test]
-fn bindgen_test_layout_c__pthread_mutex_s() {
+fn bindgen_test_layout_cbw_ApplicationMemoryStats() {
     assert_eq!(
-        ::std::mem::size_of::<c__pthread_mutex_s>(),
-        40usize,
-        concat!("Size of: ", stringify!(c__pthread_mutex_s))
+        ::std::mem::size_of::<cbw_ApplicationMemoryStats>(),
+        48usize,
+        concat!("Size of: ", stringify!(cbw_ApplicationMemoryStats))
     );
     assert_eq!(
-        ::std::mem::align_of::<c__pthread_mutex_s>(),
+        ::std::mem::align_of::<cbw_ApplicationMemoryStats>(),
         8usize,
-        concat!("Alignment of ", stringify!(c__pthread_mutex_s))
+        concat!("Alignment of ", stringify!(cbw_ApplicationMemoryStats))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__lock as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationMemoryStats>())).browser_windows as *const _
+                as usize
+        },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
-            "::",
-            stringify!(__lock)
-        )
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__count as *const _ as usize },
-        4usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
+            stringify!(cbw_ApplicationMemoryStats),
             "::",
-            stringify!(__count)
+            stringify!(browser_windows)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__owner as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationMemoryStats>())).pending_calls as *const _
+                as usize
+        },
         8usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
-            "::",
-            stringify!(__owner)
-        )
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__nusers as *const _ as usize },
-        12usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
+            stringify!(cbw_ApplicationMemoryStats),
             "::",
-            stringify!(__nusers)
+            stringify!(pending_calls)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__kind as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationMemoryStats>())).queued_bytes as *const _ as usize
+        },
         16usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
+            stringify!(cbw_ApplicationMemoryStats),
             "::",
-            stringify!(__kind)
+            stringify!(queued_bytes)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__spins as *const _ as usize },
-        20usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationMemoryStats>())).cached_response_bytes as *const _
+                as usize
+        },
+        24usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
+            stringify!(cbw_ApplicationMemoryStats),
             "::",
-            stringify!(__spins)
+            stringify!(cached_response_bytes)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__elision as *const _ as usize },
-        22usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationMemoryStats>())).queued_dispatches as *const _
+                as usize
+        },
+        32usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
+            stringify!(cbw_ApplicationMemoryStats),
             "::",
-            stringify!(__elision)
+            stringify!(queued_dispatches)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__list as *const _ as usize },
-        24usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationMemoryStats>())).process_private_bytes as *const _
+                as usize
+        },
+        40usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_mutex_s),
+            stringify!(cbw_ApplicationMemoryStats),
             "::",
-            stringify!(__list)
+            stringify!(process_private_bytes)
         )
     );
 }
+#[doc = " The moments at which the phases of the startup of the application have been reached."]
+#[doc = " They are timestamps of a monotonic clock, in microseconds, that can only be compared with each other."]
+#[doc = " A phase that hasn't been reached yet is 0."]
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct c__pthread_rwlock_arch_t {
-    pub __readers: ::std::os::raw::c_uint,
-    pub __writers: ::std::os::raw::c_uint,
-    pub __wrphase_futex: ::std::os::raw::c_uint,
-    pub __writers_futex: ::std::os::raw::c_uint,
-    pub __pad3: ::std::os::raw::c_uint,
-    pub __pad4: ::std::os::raw::c_uint,
-    pub __cur_writer: ::std::os::raw::c_int,
-    pub __shared: ::std::os::raw::c_int,
-    pub __rwelision: ::std::os::raw::c_schar,
-    pub __pad1: [::std::os::raw::c_uchar; 7usize],
-    pub __pad2: ::std::os::raw::c_ulong,
-    pub __flags: ::std::os::raw::c_uint,
+pub struct cbw_ApplicationStartupMetrics {
+    pub initialize: u64,
+    pub engine_processes: u64,
+    pub engine_initialized: u64,
+    pub initialized: u64,
+    pub ready: u64,
+    pub first_window: u64,
+    pub first_browser_requested: u64,
+    pub first_browser_created: u64,
+    pub first_load: u64,
+    pub first_paint: u64,
 }
 #[test]
-fn bindgen_test_layout_c__pthread_rwlock_arch_t() {
+fn bindgen_test_layout_cbw_ApplicationStartupMetrics() {
     assert_eq!(
-        ::std::mem::size_of::<c__pthread_rwlock_arch_t>(),
-        56usize,
-        concat!("Size of: ", stringify!(c__pthread_rwlock_arch_t))
+        ::std::mem::size_of::<cbw_ApplicationStartupMetrics>(),
+        80usize,
+        concat!("Size of: ", stringify!(cbw_ApplicationStartupMetrics))
     );
     assert_eq!(
-        ::std::mem::align_of::<c__pthread_rwlock_arch_t>(),
+        ::std::mem::align_of::<cbw_ApplicationStartupMetrics>(),
         8usize,
-        concat!("Alignment of ", stringify!(c__pthread_rwlock_arch_t))
+        concat!("Alignment of ", stringify!(cbw_ApplicationStartupMetrics))
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__readers as *const _ as usize
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).initialize as *const _
+                as usize
         },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__readers)
+            stringify!(initialize)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__writers as *const _ as usize
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).engine_processes as *const _
+                as usize
         },
-        4usize,
+        8usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__writers)
+            stringify!(engine_processes)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__wrphase_futex as *const _
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).engine_initialized as *const _
                 as usize
         },
-        8usize,
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__wrphase_futex)
+            stringify!(engine_initialized)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__writers_futex as *const _
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).initialized as *const _
                 as usize
         },
-        12usize,
+        24usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__writers_futex)
+            stringify!(initialized)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad3 as *const _ as usize },
-        16usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).ready as *const _ as usize
+        },
+        32usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__pad3)
+            stringify!(ready)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad4 as *const _ as usize },
-        20usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).first_window as *const _
+                as usize
+        },
+        40usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__pad4)
+            stringify!(first_window)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__cur_writer as *const _ as usize
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).first_browser_requested
+                as *const _ as usize
         },
-        24usize,
+        48usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__cur_writer)
+            stringify!(first_browser_requested)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__shared as *const _ as usize
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).first_browser_created
+                as *const _ as usize
         },
-        28usize,
+        56usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__shared)
+            stringify!(first_browser_created)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__rwelision as *const _ as usize
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).first_load as *const _
+                as usize
         },
-        32usize,
+        64usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__rwelision)
+            stringify!(first_load)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad1 as *const _ as usize },
-        33usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationStartupMetrics>())).first_paint as *const _
+                as usize
+        },
+        72usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
+            stringify!(cbw_ApplicationStartupMetrics),
             "::",
-            stringify!(__pad1)
+            stringify!(first_paint)
         )
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad2 as *const _ as usize },
-        40usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
-            "::",
-            stringify!(__pad2)
-        )
-    );
-    assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__flags as *const _ as usize
-        },
-        48usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__pthread_rwlock_arch_t),
-            "::",
-            stringify!(__flags)
-        )
-    );
-}
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub struct c__pthread_cond_s {
-    pub __bindgen_anon_1: c__pthread_cond_s__bindgen_ty_1,
-    pub __bindgen_anon_2: c__pthread_cond_s__bindgen_ty_2,
-    pub __g_refs: [::std::os::raw::c_uint; 2usize],
-    pub __g_size: [::std::os::raw::c_uint; 2usize],
-    pub __g1_orig_size: ::std::os::raw::c_uint,
-    pub __wrefs: ::std::os::raw::c_uint,
-    pub __g_signals: [::std::os::raw::c_uint; 2usize],
 }
 #[repr(C)]
 #[derive(Copy, Clone)]
-pub union c__pthread_cond_s__bindgen_ty_1 {
-    pub __wseq: ::std::os::raw::c_ulonglong,
-    pub __wseq32: c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1,
-    _bindgen_union_align: u64,
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1 {
-    pub __low: ::std::os::raw::c_uint,
-    pub __high: ::std::os::raw::c_uint,
+pub struct cbw_Application {
+    pub windows_alive: ::std::os::raw::c_uint,
+    pub is_running: cBOOL,
+    pub is_done: cBOOL,
+    pub has_stopped: ::std::os::raw::c_int,
+    pub dispatch_queues: [cbw_ApplicationDispatchQueue; 3usize],
+    pub dispatch_budget: u64,
+    pub browser_window_pool: *mut cbw_BrowserWindowPool,
+    pub startup_metrics: cbw_ApplicationStartupMetrics,
+    pub dispatch_latencies: [cbw_LatencyHistogram; 3usize],
+    pub engine_tracing: cBOOL,
+    pub window_slab: cbw_Slab,
+    pub browser_window_slab: cbw_Slab,
+    pub impl_: cbw_ApplicationImpl,
+    pub engine_impl: cbw_ApplicationEngineImpl,
 }
 #[test]
-fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1() {
+fn bindgen_test_layout_cbw_Application() {
     assert_eq!(
-        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>(),
+        ::std::mem::size_of::<cbw_Application>(),
+        6960usize,
+        concat!("Size of: ", stringify!(cbw_Application))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_Application>(),
         8usize,
+        concat!("Alignment of ", stringify!(cbw_Application))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).windows_alive as *const _ as usize },
+        0usize,
         concat!(
-            "Size of: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1)
+            "Offset of field: ",
+            stringify!(cbw_Application),
+            "::",
+            stringify!(windows_alive)
         )
     );
     assert_eq!(
-        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>(),
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).is_running as *const _ as usize },
         4usize,
         concat!(
-            "Alignment of ",
-            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1)
+            "Offset of field: ",
+            stringify!(cbw_Application),
+            "::",
+            stringify!(is_running)
         )
     );
     assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>())).__low
-                as *const _ as usize
-        },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).is_done as *const _ as usize },
+        8usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__low)
+            stringify!(is_done)
         )
     );
     assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>())).__high
-                as *const _ as usize
-        },
-        4usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).has_stopped as *const _ as usize },
+        12usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__high)
+            stringify!(has_stopped)
         )
     );
-}
-#[test]
-fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_1() {
     assert_eq!(
-        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_1>(),
-        8usize,
-        concat!("Size of: ", stringify!(c__pthread_cond_s__bindgen_ty_1))
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).dispatch_queues as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Application),
+            "::",
+            stringify!(dispatch_queues)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_1>(),
-        8usize,
-        concat!("Alignment of ", stringify!(c__pthread_cond_s__bindgen_ty_1))
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).dispatch_budget as *const _ as usize },
+        208usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Application),
+            "::",
+            stringify!(dispatch_budget)
+        )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1>())).__wseq as *const _ as usize
+            &(*(::std::ptr::null::<cbw_Application>())).browser_window_pool as *const _ as usize
         },
-        0usize,
+        216usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_1),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__wseq)
+            stringify!(browser_window_pool)
         )
     );
     assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1>())).__wseq32 as *const _
-                as usize
-        },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).startup_metrics as *const _ as usize },
+        224usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_1),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__wseq32)
+            stringify!(startup_metrics)
         )
     );
-}
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union c__pthread_cond_s__bindgen_ty_2 {
-    pub __g1_start: ::std::os::raw::c_ulonglong,
-    pub __g1_start32: c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1,
-    _bindgen_union_align: u64,
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1 {
-    pub __low: ::std::os::raw::c_uint,
-    pub __high: ::std::os::raw::c_uint,
-}
-#[test]
-fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1() {
     assert_eq!(
-        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>(),
-        8usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_Application>())).dispatch_latencies as *const _ as usize
+        },
+        304usize,
         concat!(
-            "Size of: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1)
+            "Offset of field: ",
+            stringify!(cbw_Application),
+            "::",
+            stringify!(dispatch_latencies)
         )
     );
     assert_eq!(
-        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>(),
-        4usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).engine_tracing as *const _ as usize },
+        6904usize,
         concat!(
-            "Alignment of ",
-            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1)
+            "Offset of field: ",
+            stringify!(cbw_Application),
+            "::",
+            stringify!(engine_tracing)
         )
     );
     assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>())).__low
-                as *const _ as usize
-        },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).window_slab as *const _ as usize },
+        6912usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__low)
+            stringify!(window_slab)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>())).__high
-                as *const _ as usize
+            &(*(::std::ptr::null::<cbw_Application>())).browser_window_slab as *const _ as usize
         },
-        4usize,
+        6936usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__high)
+            stringify!(browser_window_slab)
         )
     );
-}
-#[test]
-fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_2() {
-    assert_eq!(
-        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_2>(),
-        8usize,
-        concat!("Size of: ", stringify!(c__pthread_cond_s__bindgen_ty_2))
-    );
     assert_eq!(
-        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_2>(),
-        8usize,
-        concat!("Alignment of ", stringify!(c__pthread_cond_s__bindgen_ty_2))
-    );
-    assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2>())).__g1_start as *const _
-                as usize
-        },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).impl_ as *const _ as usize },
+        6960usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_2),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__g1_start)
+            stringify!(impl_)
         )
     );
     assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2>())).__g1_start32 as *const _
-                as usize
-        },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Application>())).engine_impl as *const _ as usize },
+        6960usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s__bindgen_ty_2),
+            stringify!(cbw_Application),
             "::",
-            stringify!(__g1_start32)
+            stringify!(engine_impl)
         )
     );
 }
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_ApplicationEngineData {
+    _unused: [u8; 0],
+}
+#[doc = " Invoked on the GUI thread when a trace has been written, with an error that has a code of 0 if it succeeded."]
+pub type cbw_ApplicationTraceWrittenFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        app: *mut cbw_Application,
+        data: *mut ::std::os::raw::c_void,
+        error: cbw_Err,
+    ),
+>;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_ApplicationSettings {
+    pub engine_seperate_executable_path: cbw_CStrSlice,
+    pub resource_dir: cbw_CStrSlice,
+    pub dispatch_budget: ::std::os::raw::c_uint,
+    pub resource_pack: cbw_CStrSlice,
+    pub windowless_rendering: cBOOL,
+    pub process_per_site: cBOOL,
+    pub renderer_process_limit: ::std::os::raw::c_uint,
+    pub isolate_popups: cBOOL,
+    pub cache_dir: cbw_CStrSlice,
+    pub cache_size_limit: u64,
+    pub persist_session_cookies: cBOOL,
+    pub lazy_engine: cBOOL,
+}
 #[test]
-fn bindgen_test_layout_c__pthread_cond_s() {
+fn bindgen_test_layout_cbw_ApplicationSettings() {
     assert_eq!(
-        ::std::mem::size_of::<c__pthread_cond_s>(),
-        48usize,
-        concat!("Size of: ", stringify!(c__pthread_cond_s))
+        ::std::mem::size_of::<cbw_ApplicationSettings>(),
+        104usize,
+        concat!("Size of: ", stringify!(cbw_ApplicationSettings))
     );
     assert_eq!(
-        ::std::mem::align_of::<c__pthread_cond_s>(),
+        ::std::mem::align_of::<cbw_ApplicationSettings>(),
         8usize,
-        concat!("Alignment of ", stringify!(c__pthread_cond_s))
+        concat!("Alignment of ", stringify!(cbw_ApplicationSettings))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__g_refs as *const _ as usize },
-        16usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).engine_seperate_executable_path
+                as *const _ as usize
+        },
+        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__g_refs)
+            stringify!(engine_seperate_executable_path)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__g_size as *const _ as usize },
-        24usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).resource_dir as *const _ as usize
+        },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__g_size)
+            stringify!(resource_dir)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__pthread_cond_s>())).__g1_orig_size as *const _ as usize
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).dispatch_budget as *const _ as usize
         },
         32usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__g1_orig_size)
+            stringify!(dispatch_budget)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__wrefs as *const _ as usize },
-        36usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__pthread_cond_s),
-            "::",
-            stringify!(__wrefs)
-        )
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__g_signals as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).resource_pack as *const _ as usize
+        },
         40usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__pthread_cond_s),
-            "::",
-            stringify!(__g_signals)
-        )
-    );
-}
-pub type cpthread_t = ::std::os::raw::c_ulong;
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_mutexattr_t {
-    pub __size: [::std::os::raw::c_char; 4usize],
-    pub __align: ::std::os::raw::c_int,
-    _bindgen_union_align: u32,
-}
-#[test]
-fn bindgen_test_layout_cpthread_mutexattr_t() {
-    assert_eq!(
-        ::std::mem::size_of::<cpthread_mutexattr_t>(),
-        4usize,
-        concat!("Size of: ", stringify!(cpthread_mutexattr_t))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cpthread_mutexattr_t>(),
-        4usize,
-        concat!("Alignment of ", stringify!(cpthread_mutexattr_t))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_mutexattr_t>())).__size as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cpthread_mutexattr_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__size)
+            stringify!(resource_pack)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_mutexattr_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).windowless_rendering as *const _
+                as usize
+        },
+        56usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_mutexattr_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__align)
+            stringify!(windowless_rendering)
         )
     );
-}
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_condattr_t {
-    pub __size: [::std::os::raw::c_char; 4usize],
-    pub __align: ::std::os::raw::c_int,
-    _bindgen_union_align: u32,
-}
-#[test]
-fn bindgen_test_layout_cpthread_condattr_t() {
-    assert_eq!(
-        ::std::mem::size_of::<cpthread_condattr_t>(),
-        4usize,
-        concat!("Size of: ", stringify!(cpthread_condattr_t))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cpthread_condattr_t>(),
-        4usize,
-        concat!("Alignment of ", stringify!(cpthread_condattr_t))
-    );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_condattr_t>())).__size as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).process_per_site as *const _
+                as usize
+        },
+        60usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_condattr_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__size)
+            stringify!(process_per_site)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_condattr_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).renderer_process_limit as *const _
+                as usize
+        },
+        64usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_condattr_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__align)
+            stringify!(renderer_process_limit)
         )
     );
-}
-pub type cpthread_key_t = ::std::os::raw::c_uint;
-pub type cpthread_once_t = ::std::os::raw::c_int;
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_attr_t {
-    pub __size: [::std::os::raw::c_char; 56usize],
-    pub __align: ::std::os::raw::c_long,
-    _bindgen_union_align: [u64; 7usize],
-}
-#[test]
-fn bindgen_test_layout_cpthread_attr_t() {
-    assert_eq!(
-        ::std::mem::size_of::<cpthread_attr_t>(),
-        56usize,
-        concat!("Size of: ", stringify!(cpthread_attr_t))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cpthread_attr_t>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cpthread_attr_t))
-    );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_attr_t>())).__size as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).isolate_popups as *const _ as usize
+        },
+        68usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_attr_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__size)
+            stringify!(isolate_popups)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_attr_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).cache_dir as *const _ as usize
+        },
+        72usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_attr_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__align)
+            stringify!(cache_dir)
         )
     );
-}
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_mutex_t {
-    pub __data: c__pthread_mutex_s,
-    pub __size: [::std::os::raw::c_char; 40usize],
-    pub __align: ::std::os::raw::c_long,
-    _bindgen_union_align: [u64; 5usize],
-}
-#[test]
-fn bindgen_test_layout_cpthread_mutex_t() {
-    assert_eq!(
-        ::std::mem::size_of::<cpthread_mutex_t>(),
-        40usize,
-        concat!("Size of: ", stringify!(cpthread_mutex_t))
-    );
     assert_eq!(
-        ::std::mem::align_of::<cpthread_mutex_t>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cpthread_mutex_t))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_mutex_t>())).__data as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).cache_size_limit as *const _
+                as usize
+        },
+        88usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_mutex_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__data)
+            stringify!(cache_size_limit)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_mutex_t>())).__size as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).persist_session_cookies as *const _
+                as usize
+        },
+        96usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_mutex_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__size)
+            stringify!(persist_session_cookies)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_mutex_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).lazy_engine as *const _ as usize
+        },
+        100usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_mutex_t),
+            stringify!(cbw_ApplicationSettings),
             "::",
-            stringify!(__align)
+            stringify!(lazy_engine)
         )
     );
 }
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_cond_t {
-    pub __data: c__pthread_cond_s,
-    pub __size: [::std::os::raw::c_char; 48usize],
-    pub __align: ::std::os::raw::c_longlong,
-    _bindgen_union_align: [u64; 6usize],
+extern "C" {
+    #[doc = " Safety check that makes sure the given application handle is used on the correct thread."]
+    #[doc = " Does nothing in release mode."]
+    #[link_name = "\u{1}bw_Application_assertCorrectThread"]
+    pub fn cbw_Application_assertCorrectThread(arg1: *const cbw_Application);
 }
-#[test]
-fn bindgen_test_layout_cpthread_cond_t() {
-    assert_eq!(
-        ::std::mem::size_of::<cpthread_cond_t>(),
-        48usize,
-        concat!("Size of: ", stringify!(cpthread_cond_t))
+extern "C" {
+    #[doc = " Exits the main loop, returning execution to the function that invoked the run call."]
+    #[doc = " The exit_code will be returned by bw_Application_run."]
+    #[link_name = "\u{1}bw_Application_exit"]
+    pub fn cbw_Application_exit(app: *mut cbw_Application, exit_code: ::std::os::raw::c_int);
+}
+extern "C" {
+    #[doc = " Same as bw_Application_exit, but guaranteed to be thread-safe"]
+    #[doc = " The exit_code will be returned by bw_Application_run."]
+    #[link_name = "\u{1}bw_Application_exitAsync"]
+    pub fn cbw_Application_exitAsync(app: *mut cbw_Application, exit_code: ::std::os::raw::c_int);
+}
+extern "C" {
+    #[doc = " Dispatches the given function to be executed on the thread this application instance has been created on,"]
+    #[doc = "     and passes the given data to it."]
+    #[doc = " This function is thread safe."]
+    #[doc = ""]
+    #[doc = " # Returns"]
+    #[doc = " An indication of whether or not the function was able to be dispatched."]
+    #[doc = " Dispatching a function fails when the application has already been terminated."]
+    #[doc = " Functions dispatched before the event loop runs are executed once it has started."]
+    #[link_name = "\u{1}bw_Application_dispatch"]
+    pub fn cbw_Application_dispatch(
+        app: *mut cbw_Application,
+        func: cbw_ApplicationDispatchFn,
+        data: *mut ::std::os::raw::c_void,
+    ) -> cBOOL;
+}
+extern "C" {
+    #[doc = " Same as bw_Application_dispatch, but queues the function with the given priority."]
+    #[doc = " Work with a higher priority is executed first, and idle work is only executed when the GUI thread has nothing else to do."]
+    #[link_name = "\u{1}bw_Application_dispatchWithPriority"]
+    pub fn cbw_Application_dispatchWithPriority(
+        app: *mut cbw_Application,
+        func: cbw_ApplicationDispatchFn,
+        data: *mut ::std::os::raw::c_void,
+        priority: cbw_ApplicationDispatchPriority,
+    ) -> cBOOL;
+}
+extern "C" {
+    #[doc = " Shuts down all application processes and performs necessary clean-up code."]
+    #[doc = " Jobs on the worker pool that are still running after five seconds are abandoned, in which case the shutdown of the browser engine is skipped."]
+    #[link_name = "\u{1}bw_Application_finish"]
+    pub fn cbw_Application_finish(app: *mut cbw_Application);
+}
+extern "C" {
+    #[doc = " Same as `bw_Application_finish`, but for when the process is about to exit anyway, like when a service restarts."]
+    #[doc = " All browsers that are still open are closed at once, without waiting for their pages and without the cleanup of their windows."]
+    #[doc = " Only the cookie stores are written to disk, and the rest is left to the operating system."]
+    #[doc = " The browser engine gets at most `timeout` milliseconds, after which its shutdown is skipped, and jobs that are still running on the worker pool are abandoned."]
+    #[doc = " Nothing of the application can be used afterwards, except for `bw_Application_free`."]
+    #[link_name = "\u{1}bw_Application_finishFast"]
+    pub fn cbw_Application_finishFast(app: *mut cbw_Application, timeout: ::std::os::raw::c_uint);
+}
+extern "C" {
+    #[doc = " Copies the histogram of how long work that has been dispatched with the given priority waited before it got executed, in microseconds."]
+    #[doc = " Delayed dispatches are not included."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Application_getDispatchLatencies"]
+    pub fn cbw_Application_getDispatchLatencies(
+        app: *const cbw_Application,
+        priority: cbw_ApplicationDispatchPriority,
+        histogram: *mut cbw_LatencyHistogram,
     );
-    assert_eq!(
-        ::std::mem::align_of::<cpthread_cond_t>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cpthread_cond_t))
+}
+extern "C" {
+    #[doc = " Fills in the memory that the application uses in this process."]
+    #[doc = " The memory used by renderer processes can be measured for each browser window with `bw_BrowserWindow_getMemoryStats`."]
+    #[doc = " Should be called on the GUI thread."]
+    #[link_name = "\u{1}bw_Application_getMemoryStats"]
+    pub fn cbw_Application_getMemoryStats(
+        app: *const cbw_Application,
+        stats: *mut cbw_ApplicationMemoryStats,
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_cond_t>())).__data as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cpthread_cond_t),
-            "::",
-            stringify!(__data)
-        )
+}
+extern "C" {
+    #[doc = " Copies the moments at which the phases of the startup have been reached into `metrics`."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Application_getStartupMetrics"]
+    pub fn cbw_Application_getStartupMetrics(
+        app: *const cbw_Application,
+        metrics: *mut cbw_ApplicationStartupMetrics,
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_cond_t>())).__size as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cpthread_cond_t),
-            "::",
-            stringify!(__size)
-        )
+}
+extern "C" {
+    #[doc = " Frees memory for the application handle."]
+    #[doc = " Call `bw_Application_finish` before you call this function."]
+    #[doc = " Freeing the application handle is generally not necessary, as all memory in use by the process gets released anyway after shutdown."]
+    #[link_name = "\u{1}bw_Application_free"]
+    pub fn cbw_Application_free(app: *mut cbw_Application);
+}
+extern "C" {
+    #[doc = " Initializes browser window."]
+    #[doc = " Starts up browser engine process(es)."]
+    #[doc = " Returns an application handle."]
+    #[link_name = "\u{1}bw_Application_initialize"]
+    pub fn cbw_Application_initialize(
+        application: *mut *mut cbw_Application,
+        argc: ::std::os::raw::c_int,
+        argv: *mut *mut ::std::os::raw::c_char,
+        settings: *const cbw_ApplicationSettings,
+    ) -> cbw_Err;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Application_isRunning"]
+    pub fn cbw_Application_isRunning(app: *const cbw_Application) -> cBOOL;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Application_markAsDone"]
+    pub fn cbw_Application_markAsDone(app: *mut cbw_Application);
+}
+extern "C" {
+    #[doc = " Runs the event loop."]
+    #[doc = " Calls the `on_ready` callback when `app` can be used."]
+    #[link_name = "\u{1}bw_Application_run"]
+    pub fn cbw_Application_run(
+        app: *mut cbw_Application,
+        on_ready: cbw_ApplicationReadyFn,
+        user_data: *mut ::std::os::raw::c_void,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[doc = " Executes the given closure after the specified delay."]
+    #[link_name = "\u{1}bw_Application_dispatchDelayed"]
+    pub fn cbw_Application_dispatchDelayed(
+        app: *mut cbw_Application,
+        func: cbw_ApplicationDispatchFn,
+        user_data: *mut ::std::os::raw::c_void,
+        milliseconds: u64,
+    ) -> cBOOL;
+}
+extern "C" {
+    #[doc = " Starts the browser engine, if the application has been initialized with `lazy_engine` and the engine hasn't been started yet."]
+    #[doc = " This happens by itself when the first browser window, request context or cookie jar is created, or when a message is broadcast."]
+    #[doc = " It can also be dispatched with the idle priority once the first window is shown, to warm the engine up in the meantime."]
+    #[doc = " Should be called on the GUI thread."]
+    #[link_name = "\u{1}bw_Application_startEngine"]
+    pub fn cbw_Application_startEngine(app: *mut cbw_Application);
+}
+extern "C" {
+    #[doc = " Starts recording trace events of the internals of browser window, like the execution of dispatched work and the messages between the browser and renderer processes."]
+    #[doc = " Every thread keeps its last `capacity` events."]
+    #[doc = " If `engine_categories` is not empty, the browser engine records a trace of the given comma separated categories as well, like \"toplevel,ipc,v8\"."]
+    #[doc = " Should be called on the GUI thread."]
+    #[link_name = "\u{1}bw_Application_startTracing"]
+    pub fn cbw_Application_startTracing(
+        app: *mut cbw_Application,
+        capacity: csize_t,
+        engine_categories: cbw_CStrSlice,
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_cond_t>())).__align as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cpthread_cond_t),
-            "::",
-            stringify!(__align)
-        )
+}
+extern "C" {
+    #[doc = " Stops recording trace events, and writes them to a file at `path` in Chrome's JSON trace event format, merged with the trace of the browser engine if it has recorded one."]
+    #[doc = " The file can be opened with `chrome://tracing` or Perfetto."]
+    #[doc = " `on_written` is invoked when the file has been written, which can happen after this function returns."]
+    #[doc = " Should be called on the GUI thread."]
+    #[link_name = "\u{1}bw_Application_stopTracing"]
+    pub fn cbw_Application_stopTracing(
+        app: *mut cbw_Application,
+        path: cbw_CStrSlice,
+        on_written: cbw_ApplicationTraceWrittenFn,
+        data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Releases memory that can be done without, in all browser windows and their renderer processes."]
+    #[doc = " See `bw_BrowserWindow_trimMemory`, and `BW_APPLICATION_MEMORY_PRESSURE_CRITICAL` for what happens in addition to that."]
+    #[doc = " This is done automatically when the operating system signals that memory is running low."]
+    #[doc = " Should be called on the GUI thread."]
+    #[link_name = "\u{1}bw_Application_trimMemory"]
+    pub fn cbw_Application_trimMemory(
+        app: *mut cbw_Application,
+        level: cbw_ApplicationMemoryPressure,
     );
 }
+extern "C" {
+    #[doc = " Writes the startup phases that have been reached to a file at `path`, in Chromium's trace event format."]
+    #[doc = " The file can be opened with `chrome://tracing` or Perfetto, and shows how long every phase took."]
+    #[link_name = "\u{1}bw_Application_writeStartupTrace"]
+    pub fn cbw_Application_writeStartupTrace(
+        app: *const cbw_Application,
+        path: cbw_CStrSlice,
+    ) -> cbw_Err;
+}
+extern "C" {
+    #[doc = " Records the current time for the given phase of `app->startup_metrics`, unless it has been recorded already."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}_bw_Application_markStartupPhase"]
+    pub fn c_bw_Application_markStartupPhase(app: *mut cbw_Application, phase: *mut u64);
+}
 #[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_rwlock_t {
-    pub __data: c__pthread_rwlock_arch_t,
-    pub __size: [::std::os::raw::c_char; 56usize],
-    pub __align: ::std::os::raw::c_long,
-    _bindgen_union_align: [u64; 7usize],
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowImpl {
+    pub cef_ptr: *mut ::std::os::raw::c_void,
+    pub resource_path: *mut ::std::os::raw::c_char,
+    pub scripts_ptr: *mut ::std::os::raw::c_void,
+    pub offscreen_ptr: *mut ::std::os::raw::c_void,
+    pub headless: cBOOL,
+    pub resize_ptr: *mut ::std::os::raw::c_void,
+    pub invoke_queue_ptr: *mut ::std::os::raw::c_void,
+    pub threaded_handler_ptr: *mut ::std::os::raw::c_void,
+    pub native_requests_ptr: *mut ::std::os::raw::c_void,
+    pub stream_reader_ptr: *mut ::std::os::raw::c_void,
 }
 #[test]
-fn bindgen_test_layout_cpthread_rwlock_t() {
+fn bindgen_test_layout_cbw_BrowserWindowImpl() {
     assert_eq!(
-        ::std::mem::size_of::<cpthread_rwlock_t>(),
-        56usize,
-        concat!("Size of: ", stringify!(cpthread_rwlock_t))
+        ::std::mem::size_of::<cbw_BrowserWindowImpl>(),
+        80usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowImpl))
     );
     assert_eq!(
-        ::std::mem::align_of::<cpthread_rwlock_t>(),
+        ::std::mem::align_of::<cbw_BrowserWindowImpl>(),
         8usize,
-        concat!("Alignment of ", stringify!(cpthread_rwlock_t))
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowImpl))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_rwlock_t>())).__data as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).cef_ptr as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_rwlock_t),
+            stringify!(cbw_BrowserWindowImpl),
             "::",
-            stringify!(__data)
+            stringify!(cef_ptr)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_rwlock_t>())).__size as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).resource_path as *const _ as usize
+        },
+        8usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_rwlock_t),
+            stringify!(cbw_BrowserWindowImpl),
             "::",
-            stringify!(__size)
+            stringify!(resource_path)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_rwlock_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).scripts_ptr as *const _ as usize
+        },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_rwlock_t),
+            stringify!(cbw_BrowserWindowImpl),
             "::",
-            stringify!(__align)
+            stringify!(scripts_ptr)
         )
     );
-}
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_rwlockattr_t {
-    pub __size: [::std::os::raw::c_char; 8usize],
-    pub __align: ::std::os::raw::c_long,
-    _bindgen_union_align: u64,
-}
-#[test]
-fn bindgen_test_layout_cpthread_rwlockattr_t() {
-    assert_eq!(
-        ::std::mem::size_of::<cpthread_rwlockattr_t>(),
-        8usize,
-        concat!("Size of: ", stringify!(cpthread_rwlockattr_t))
-    );
     assert_eq!(
-        ::std::mem::align_of::<cpthread_rwlockattr_t>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cpthread_rwlockattr_t))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).offscreen_ptr as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowImpl),
+            "::",
+            stringify!(offscreen_ptr)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_rwlockattr_t>())).__size as *const _ as usize },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).headless as *const _ as usize },
+        32usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_rwlockattr_t),
+            stringify!(cbw_BrowserWindowImpl),
             "::",
-            stringify!(__size)
+            stringify!(headless)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_rwlockattr_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).resize_ptr as *const _ as usize
+        },
+        40usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_rwlockattr_t),
+            stringify!(cbw_BrowserWindowImpl),
             "::",
-            stringify!(__align)
+            stringify!(resize_ptr)
         )
     );
-}
-pub type cpthread_spinlock_t = ::std::os::raw::c_int;
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_barrier_t {
-    pub __size: [::std::os::raw::c_char; 32usize],
-    pub __align: ::std::os::raw::c_long,
-    _bindgen_union_align: [u64; 4usize],
-}
-#[test]
-fn bindgen_test_layout_cpthread_barrier_t() {
     assert_eq!(
-        ::std::mem::size_of::<cpthread_barrier_t>(),
-        32usize,
-        concat!("Size of: ", stringify!(cpthread_barrier_t))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).invoke_queue_ptr as *const _ as usize
+        },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowImpl),
+            "::",
+            stringify!(invoke_queue_ptr)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<cpthread_barrier_t>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cpthread_barrier_t))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).threaded_handler_ptr as *const _
+                as usize
+        },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowImpl),
+            "::",
+            stringify!(threaded_handler_ptr)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_barrier_t>())).__size as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).native_requests_ptr as *const _
+                as usize
+        },
+        64usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_barrier_t),
+            stringify!(cbw_BrowserWindowImpl),
             "::",
-            stringify!(__size)
+            stringify!(native_requests_ptr)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_barrier_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).stream_reader_ptr as *const _ as usize
+        },
+        72usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_barrier_t),
+            stringify!(cbw_BrowserWindowImpl),
             "::",
-            stringify!(__align)
+            stringify!(stream_reader_ptr)
         )
     );
 }
+pub type cbw_JsValueType = ::std::os::raw::c_uchar;
 #[repr(C)]
-#[derive(Copy, Clone)]
-pub union cpthread_barrierattr_t {
-    pub __size: [::std::os::raw::c_char; 4usize],
-    pub __align: ::std::os::raw::c_int,
-    _bindgen_union_align: u32,
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_JsValue {
+    pub type_: cbw_JsValueType,
+    pub boolean: cBOOL,
+    pub number: f64,
+    pub string: cbw_CStrSlice,
+    pub items: *mut cbw_JsValue,
+    pub keys: *mut cbw_CStrSlice,
+    pub item_count: csize_t,
 }
 #[test]
-fn bindgen_test_layout_cpthread_barrierattr_t() {
+fn bindgen_test_layout_cbw_JsValue() {
     assert_eq!(
-        ::std::mem::size_of::<cpthread_barrierattr_t>(),
-        4usize,
-        concat!("Size of: ", stringify!(cpthread_barrierattr_t))
+        ::std::mem::size_of::<cbw_JsValue>(),
+        56usize,
+        concat!("Size of: ", stringify!(cbw_JsValue))
     );
     assert_eq!(
-        ::std::mem::align_of::<cpthread_barrierattr_t>(),
-        4usize,
-        concat!("Alignment of ", stringify!(cpthread_barrierattr_t))
+        ::std::mem::align_of::<cbw_JsValue>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_JsValue))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_barrierattr_t>())).__size as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<cbw_JsValue>())).type_ as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_barrierattr_t),
+            stringify!(cbw_JsValue),
             "::",
-            stringify!(__size)
+            stringify!(type_)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cpthread_barrierattr_t>())).__align as *const _ as usize },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<cbw_JsValue>())).boolean as *const _ as usize },
+        4usize,
         concat!(
             "Offset of field: ",
-            stringify!(cpthread_barrierattr_t),
+            stringify!(cbw_JsValue),
             "::",
-            stringify!(__align)
+            stringify!(boolean)
         )
     );
-}
-extern "C" {
-    #[link_name = "\u{1}random"]
-    pub fn crandom() -> ::std::os::raw::c_long;
-}
-extern "C" {
-    #[link_name = "\u{1}srandom"]
-    pub fn csrandom(__seed: ::std::os::raw::c_uint);
-}
-extern "C" {
-    #[link_name = "\u{1}initstate"]
-    pub fn cinitstate(
-        __seed: ::std::os::raw::c_uint,
-        __statebuf: *mut ::std::os::raw::c_char,
-        __statelen: csize_t,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}setstate"]
-    pub fn csetstate(__statebuf: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct crandom_data {
-    pub fptr: *mut i32,
-    pub rptr: *mut i32,
-    pub state: *mut i32,
-    pub rand_type: ::std::os::raw::c_int,
-    pub rand_deg: ::std::os::raw::c_int,
-    pub rand_sep: ::std::os::raw::c_int,
-    pub end_ptr: *mut i32,
-}
-#[test]
-fn bindgen_test_layout_crandom_data() {
-    assert_eq!(
-        ::std::mem::size_of::<crandom_data>(),
-        48usize,
-        concat!("Size of: ", stringify!(crandom_data))
-    );
     assert_eq!(
-        ::std::mem::align_of::<crandom_data>(),
+        unsafe { &(*(::std::ptr::null::<cbw_JsValue>())).number as *const _ as usize },
         8usize,
-        concat!("Alignment of ", stringify!(crandom_data))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<crandom_data>())).fptr as *const _ as usize },
-        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(crandom_data),
+            stringify!(cbw_JsValue),
             "::",
-            stringify!(fptr)
+            stringify!(number)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<crandom_data>())).rptr as *const _ as usize },
-        8usize,
+        unsafe { &(*(::std::ptr::null::<cbw_JsValue>())).string as *const _ as usize },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(crandom_data),
+            stringify!(cbw_JsValue),
             "::",
-            stringify!(rptr)
+            stringify!(string)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<crandom_data>())).state as *const _ as usize },
-        16usize,
+        unsafe { &(*(::std::ptr::null::<cbw_JsValue>())).items as *const _ as usize },
+        32usize,
         concat!(
             "Offset of field: ",
-            stringify!(crandom_data),
+            stringify!(cbw_JsValue),
             "::",
-            stringify!(state)
+            stringify!(items)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<crandom_data>())).rand_type as *const _ as usize },
-        24usize,
+        unsafe { &(*(::std::ptr::null::<cbw_JsValue>())).keys as *const _ as usize },
+        40usize,
         concat!(
             "Offset of field: ",
-            stringify!(crandom_data),
+            stringify!(cbw_JsValue),
             "::",
-            stringify!(rand_type)
+            stringify!(keys)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<crandom_data>())).rand_deg as *const _ as usize },
-        28usize,
+        unsafe { &(*(::std::ptr::null::<cbw_JsValue>())).item_count as *const _ as usize },
+        48usize,
         concat!(
             "Offset of field: ",
-            stringify!(crandom_data),
+            stringify!(cbw_JsValue),
             "::",
-            stringify!(rand_deg)
+            stringify!(item_count)
         )
     );
+}
+extern "C" {
+    #[doc = " Frees all memory owned by the value, including that of its children."]
+    #[doc = " The `bw_JsValue` struct itself is not freed."]
+    #[link_name = "\u{1}bw_JsValue_free"]
+    pub fn cbw_JsValue_free(value: *mut cbw_JsValue);
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_CookieImpl {
+    pub handle_ptr: *mut ::std::os::raw::c_void,
+}
+#[test]
+fn bindgen_test_layout_cbw_CookieImpl() {
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<crandom_data>())).rand_sep as *const _ as usize },
-        32usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(crandom_data),
-            "::",
-            stringify!(rand_sep)
-        )
+        ::std::mem::size_of::<cbw_CookieImpl>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_CookieImpl))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<crandom_data>())).end_ptr as *const _ as usize },
-        40usize,
+        ::std::mem::align_of::<cbw_CookieImpl>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_CookieImpl))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieImpl>())).handle_ptr as *const _ as usize },
+        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(crandom_data),
+            stringify!(cbw_CookieImpl),
             "::",
-            stringify!(end_ptr)
+            stringify!(handle_ptr)
         )
     );
 }
-extern "C" {
-    #[link_name = "\u{1}random_r"]
-    pub fn crandom_r(__buf: *mut crandom_data, __result: *mut i32) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}srandom_r"]
-    pub fn csrandom_r(
-        __seed: ::std::os::raw::c_uint,
-        __buf: *mut crandom_data,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}initstate_r"]
-    pub fn cinitstate_r(
-        __seed: ::std::os::raw::c_uint,
-        __statebuf: *mut ::std::os::raw::c_char,
-        __statelen: csize_t,
-        __buf: *mut crandom_data,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}setstate_r"]
-    pub fn csetstate_r(
-        __statebuf: *mut ::std::os::raw::c_char,
-        __buf: *mut crandom_data,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}rand"]
-    pub fn crand() -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}srand"]
-    pub fn csrand(__seed: ::std::os::raw::c_uint);
-}
-extern "C" {
-    #[link_name = "\u{1}rand_r"]
-    pub fn crand_r(__seed: *mut ::std::os::raw::c_uint) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}drand48"]
-    pub fn cdrand48() -> f64;
-}
-extern "C" {
-    #[link_name = "\u{1}erand48"]
-    pub fn cerand48(__xsubi: *mut ::std::os::raw::c_ushort) -> f64;
-}
-extern "C" {
-    #[link_name = "\u{1}lrand48"]
-    pub fn clrand48() -> ::std::os::raw::c_long;
-}
-extern "C" {
-    #[link_name = "\u{1}nrand48"]
-    pub fn cnrand48(__xsubi: *mut ::std::os::raw::c_ushort) -> ::std::os::raw::c_long;
-}
-extern "C" {
-    #[link_name = "\u{1}mrand48"]
-    pub fn cmrand48() -> ::std::os::raw::c_long;
-}
-extern "C" {
-    #[link_name = "\u{1}jrand48"]
-    pub fn cjrand48(__xsubi: *mut ::std::os::raw::c_ushort) -> ::std::os::raw::c_long;
-}
-extern "C" {
-    #[link_name = "\u{1}srand48"]
-    pub fn csrand48(__seedval: ::std::os::raw::c_long);
-}
-extern "C" {
-    #[link_name = "\u{1}seed48"]
-    pub fn cseed48(__seed16v: *mut ::std::os::raw::c_ushort) -> *mut ::std::os::raw::c_ushort;
-}
-extern "C" {
-    #[link_name = "\u{1}lcong48"]
-    pub fn clcong48(__param: *mut ::std::os::raw::c_ushort);
-}
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct cdrand48_data {
-    pub __x: [::std::os::raw::c_ushort; 3usize],
-    pub __old_x: [::std::os::raw::c_ushort; 3usize],
-    pub __c: ::std::os::raw::c_ushort,
-    pub __init: ::std::os::raw::c_ushort,
-    pub __a: ::std::os::raw::c_ulonglong,
+pub struct cbw_CookieJarImpl {
+    pub handle_ptr: *mut ::std::os::raw::c_void,
 }
 #[test]
-fn bindgen_test_layout_cdrand48_data() {
+fn bindgen_test_layout_cbw_CookieJarImpl() {
     assert_eq!(
-        ::std::mem::size_of::<cdrand48_data>(),
-        24usize,
-        concat!("Size of: ", stringify!(cdrand48_data))
+        ::std::mem::size_of::<cbw_CookieJarImpl>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_CookieJarImpl))
     );
     assert_eq!(
-        ::std::mem::align_of::<cdrand48_data>(),
+        ::std::mem::align_of::<cbw_CookieJarImpl>(),
         8usize,
-        concat!("Alignment of ", stringify!(cdrand48_data))
+        concat!("Alignment of ", stringify!(cbw_CookieJarImpl))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__x as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<cbw_CookieJarImpl>())).handle_ptr as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cdrand48_data),
+            stringify!(cbw_CookieJarImpl),
             "::",
-            stringify!(__x)
+            stringify!(handle_ptr)
         )
     );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_CookieIteratorImpl {
+    pub visitor_ptr: *mut ::std::os::raw::c_void,
+}
+#[test]
+fn bindgen_test_layout_cbw_CookieIteratorImpl() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_CookieIteratorImpl>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_CookieIteratorImpl))
+    );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__old_x as *const _ as usize },
-        6usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cdrand48_data),
-            "::",
-            stringify!(__old_x)
-        )
+        ::std::mem::align_of::<cbw_CookieIteratorImpl>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_CookieIteratorImpl))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__c as *const _ as usize },
-        12usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_CookieIteratorImpl>())).visitor_ptr as *const _ as usize
+        },
+        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cdrand48_data),
+            stringify!(cbw_CookieIteratorImpl),
             "::",
-            stringify!(__c)
+            stringify!(visitor_ptr)
         )
     );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_Cookie {
+    pub impl_: cbw_CookieImpl,
+}
+#[test]
+fn bindgen_test_layout_cbw_Cookie() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_Cookie>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_Cookie))
+    );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__init as *const _ as usize },
-        14usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cdrand48_data),
-            "::",
-            stringify!(__init)
-        )
+        ::std::mem::align_of::<cbw_Cookie>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_Cookie))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__a as *const _ as usize },
-        16usize,
+        unsafe { &(*(::std::ptr::null::<cbw_Cookie>())).impl_ as *const _ as usize },
+        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cdrand48_data),
+            stringify!(cbw_Cookie),
             "::",
-            stringify!(__a)
+            stringify!(impl_)
         )
     );
 }
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_CookieJar {
+    pub impl_: cbw_CookieJarImpl,
+}
+#[test]
+fn bindgen_test_layout_cbw_CookieJar() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_CookieJar>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_CookieJar))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_CookieJar>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_CookieJar))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieJar>())).impl_ as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieJar),
+            "::",
+            stringify!(impl_)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_CookieIterator {
+    pub impl_: cbw_CookieIteratorImpl,
+}
+#[test]
+fn bindgen_test_layout_cbw_CookieIterator() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_CookieIterator>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_CookieIterator))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_CookieIterator>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_CookieIterator))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieIterator>())).impl_ as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieIterator),
+            "::",
+            stringify!(impl_)
+        )
+    );
+}
+#[doc = " Selects which cookies are visited by `bw_CookieJar_iteratorFiltered` and `bw_CookieJar_count`, and which of their fields are copied."]
+#[doc = " The predicates are checked before a cookie is copied, so cookies that don't match cost next to nothing."]
+#[doc = " Empty strings and zero timestamps match everything."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_CookieFilter {
+    #[doc = " Only cookies of which the domain ends with this, such that `example.com` also matches `.www.example.com`"]
+    pub domain: cbw_CStrSlice,
+    #[doc = " Only cookies of which the path starts with this"]
+    pub path: cbw_CStrSlice,
+    #[doc = " Only cookies with exactly this name"]
+    pub name: cbw_CStrSlice,
+    #[doc = " Only cookies that expire at or after this time, in milliseconds since the unix epoch"]
+    pub expires_after: u64,
+    #[doc = " Only cookies that expire before this time, in milliseconds since the unix epoch"]
+    pub expires_before: u64,
+    #[doc = " A combination of `BW_COOKIE_FIELD_*` flags of the fields that are copied, the others are left empty"]
+    pub fields: ::std::os::raw::c_uchar,
+}
+#[test]
+fn bindgen_test_layout_cbw_CookieFilter() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_CookieFilter>(),
+        72usize,
+        concat!("Size of: ", stringify!(cbw_CookieFilter))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_CookieFilter>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_CookieFilter))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieFilter>())).domain as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieFilter),
+            "::",
+            stringify!(domain)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieFilter>())).path as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieFilter),
+            "::",
+            stringify!(path)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieFilter>())).name as *const _ as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieFilter),
+            "::",
+            stringify!(name)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieFilter>())).expires_after as *const _ as usize },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieFilter),
+            "::",
+            stringify!(expires_after)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieFilter>())).expires_before as *const _ as usize },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieFilter),
+            "::",
+            stringify!(expires_before)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieFilter>())).fields as *const _ as usize },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieFilter),
+            "::",
+            stringify!(fields)
+        )
+    );
+}
+#[doc = " The string fields of a cookie, as written by `bw_Cookie_getFieldsInto`."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_CookieStrings {
+    pub name: cbw_CStrSlice,
+    pub value: cbw_CStrSlice,
+    pub domain: cbw_CStrSlice,
+    pub path: cbw_CStrSlice,
+}
+#[test]
+fn bindgen_test_layout_cbw_CookieStrings() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_CookieStrings>(),
+        64usize,
+        concat!("Size of: ", stringify!(cbw_CookieStrings))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_CookieStrings>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_CookieStrings))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieStrings>())).name as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieStrings),
+            "::",
+            stringify!(name)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieStrings>())).value as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieStrings),
+            "::",
+            stringify!(value)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieStrings>())).domain as *const _ as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieStrings),
+            "::",
+            stringify!(domain)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_CookieStrings>())).path as *const _ as usize },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_CookieStrings),
+            "::",
+            stringify!(path)
+        )
+    );
+}
+pub type cbw_CookieJarStorageCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(cj: *mut cbw_CookieJar, data: *mut ::std::os::raw::c_void, error: cbw_Err),
+>;
+pub type cbw_CookieIteratorNextCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        ci: *mut cbw_CookieIterator,
+        data: *mut ::std::os::raw::c_void,
+        cookie: *mut cbw_Cookie,
+    ),
+>;
+#[doc = " Like `bw_CookieIteratorNextCallbackFn`, but the cookie is only borrowed, and is only valid during the invocation of the callback."]
+#[doc = " `cookie` is null if the visit ended without another cookie that matches the iterator's filter."]
+pub type cbw_CookieIteratorNextBorrowedCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        ci: *mut cbw_CookieIterator,
+        data: *mut ::std::os::raw::c_void,
+        cookie: *const cbw_Cookie,
+    ),
+>;
+pub type cbw_CookieJarDeleteCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        cj: *mut cbw_CookieJar,
+        data: *mut ::std::os::raw::c_void,
+        deleted: ::std::os::raw::c_uint,
+    ),
+>;
+#[doc = " Receives the number of cookies that `bw_CookieJar_count` has counted."]
+pub type cbw_CookieJarCountCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(cj: *mut cbw_CookieJar, data: *mut ::std::os::raw::c_void, count: csize_t),
+>;
+#[doc = " Receives the number of cookies that `bw_CookieJar_storeMany` has been able to store."]
+pub type cbw_CookieJarStoreManyCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        cj: *mut cbw_CookieJar,
+        data: *mut ::std::os::raw::c_void,
+        stored: csize_t,
+    ),
+>;
 extern "C" {
-    #[link_name = "\u{1}drand48_r"]
-    pub fn cdrand48_r(__buffer: *mut cdrand48_data, __result: *mut f64) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}erand48_r"]
-    pub fn cerand48_r(
-        __xsubi: *mut ::std::os::raw::c_ushort,
-        __buffer: *mut cdrand48_data,
-        __result: *mut f64,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_free"]
+    pub fn cbw_Cookie_free(cookie: *mut cbw_Cookie);
 }
 extern "C" {
-    #[link_name = "\u{1}lrand48_r"]
-    pub fn clrand48_r(
-        __buffer: *mut cdrand48_data,
-        __result: *mut ::std::os::raw::c_long,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_new"]
+    pub fn cbw_Cookie_new(name: cbw_CStrSlice, value: cbw_CStrSlice) -> *mut cbw_Cookie;
 }
 extern "C" {
-    #[link_name = "\u{1}nrand48_r"]
-    pub fn cnrand48_r(
-        __xsubi: *mut ::std::os::raw::c_ushort,
-        __buffer: *mut cdrand48_data,
-        __result: *mut ::std::os::raw::c_long,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_getCreationTime"]
+    pub fn cbw_Cookie_getCreationTime(cookie: *const cbw_Cookie) -> u64;
 }
 extern "C" {
-    #[link_name = "\u{1}mrand48_r"]
-    pub fn cmrand48_r(
-        __buffer: *mut cdrand48_data,
-        __result: *mut ::std::os::raw::c_long,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_setCreationTime"]
+    pub fn cbw_Cookie_setCreationTime(cookie: *mut cbw_Cookie, time: u64);
 }
 extern "C" {
-    #[link_name = "\u{1}jrand48_r"]
-    pub fn cjrand48_r(
-        __xsubi: *mut ::std::os::raw::c_ushort,
-        __buffer: *mut cdrand48_data,
-        __result: *mut ::std::os::raw::c_long,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_getDomain"]
+    pub fn cbw_Cookie_getDomain(cookie: *const cbw_Cookie, domain: *mut cbw_StrSlice) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}srand48_r"]
-    pub fn csrand48_r(
-        __seedval: ::std::os::raw::c_long,
-        __buffer: *mut cdrand48_data,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_setDomain"]
+    pub fn cbw_Cookie_setDomain(cookie: *mut cbw_Cookie, domain: cbw_CStrSlice);
 }
 extern "C" {
-    #[link_name = "\u{1}seed48_r"]
-    pub fn cseed48_r(
-        __seed16v: *mut ::std::os::raw::c_ushort,
-        __buffer: *mut cdrand48_data,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_getExpires"]
+    pub fn cbw_Cookie_getExpires(cookie: *const cbw_Cookie) -> u64;
 }
 extern "C" {
-    #[link_name = "\u{1}lcong48_r"]
-    pub fn clcong48_r(
-        __param: *mut ::std::os::raw::c_ushort,
-        __buffer: *mut cdrand48_data,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_setExpires"]
+    pub fn cbw_Cookie_setExpires(cookie: *mut cbw_Cookie, time: u64);
 }
 extern "C" {
-    #[link_name = "\u{1}malloc"]
-    pub fn cmalloc(__size: ::std::os::raw::c_ulong) -> *mut ::std::os::raw::c_void;
+    #[doc = " Writes the name, value, domain and path of the cookie as UTF-8 into `buffer`, one after the other, and points the slices of `strings` into it."]
+    #[doc = " Nothing needs to be freed, so a whole batch of cookies can be written into one buffer."]
+    #[doc = " Returns the number of bytes that the fields take up."]
+    #[doc = " If that is more than `capacity`, nothing is written, and the call can be repeated with a large enough buffer."]
+    #[link_name = "\u{1}bw_Cookie_getFieldsInto"]
+    pub fn cbw_Cookie_getFieldsInto(
+        cookie: *const cbw_Cookie,
+        buffer: *mut ::std::os::raw::c_char,
+        capacity: csize_t,
+        strings: *mut cbw_CookieStrings,
+    ) -> csize_t;
 }
 extern "C" {
-    #[link_name = "\u{1}calloc"]
-    pub fn ccalloc(
-        __nmemb: ::std::os::raw::c_ulong,
-        __size: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_void;
+    #[link_name = "\u{1}bw_Cookie_getName"]
+    pub fn cbw_Cookie_getName(cookie: *const cbw_Cookie, name: *mut cbw_StrSlice) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}realloc"]
-    pub fn crealloc(
-        __ptr: *mut ::std::os::raw::c_void,
-        __size: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_void;
+    #[link_name = "\u{1}bw_Cookie_setName"]
+    pub fn cbw_Cookie_setName(cookie: *mut cbw_Cookie, name: cbw_CStrSlice);
 }
 extern "C" {
-    #[link_name = "\u{1}reallocarray"]
-    pub fn creallocarray(
-        __ptr: *mut ::std::os::raw::c_void,
-        __nmemb: csize_t,
-        __size: csize_t,
-    ) -> *mut ::std::os::raw::c_void;
+    #[link_name = "\u{1}bw_Cookie_getPath"]
+    pub fn cbw_Cookie_getPath(cookie: *const cbw_Cookie, path: *mut cbw_StrSlice) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}free"]
-    pub fn cfree(__ptr: *mut ::std::os::raw::c_void);
+    #[link_name = "\u{1}bw_Cookie_setPath"]
+    pub fn cbw_Cookie_setPath(cookie: *mut cbw_Cookie, path: cbw_CStrSlice);
 }
 extern "C" {
-    #[link_name = "\u{1}alloca"]
-    pub fn calloca(__size: ::std::os::raw::c_ulong) -> *mut ::std::os::raw::c_void;
+    #[link_name = "\u{1}bw_Cookie_getValue"]
+    pub fn cbw_Cookie_getValue(cookie: *const cbw_Cookie, value: *mut cbw_StrSlice) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}valloc"]
-    pub fn cvalloc(__size: csize_t) -> *mut ::std::os::raw::c_void;
+    #[link_name = "\u{1}bw_Cookie_setValue"]
+    pub fn cbw_Cookie_setValue(cookie: *mut cbw_Cookie, value: cbw_CStrSlice);
 }
 extern "C" {
-    #[link_name = "\u{1}posix_memalign"]
-    pub fn cposix_memalign(
-        __memptr: *mut *mut ::std::os::raw::c_void,
-        __alignment: csize_t,
-        __size: csize_t,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_isHttpOnly"]
+    pub fn cbw_Cookie_isHttpOnly(cookie: *const cbw_Cookie) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}aligned_alloc"]
-    pub fn caligned_alloc(__alignment: csize_t, __size: csize_t) -> *mut ::std::os::raw::c_void;
+    #[link_name = "\u{1}bw_Cookie_makeHttpOnly"]
+    pub fn cbw_Cookie_makeHttpOnly(cookie: *mut cbw_Cookie);
 }
 extern "C" {
-    #[link_name = "\u{1}abort"]
-    pub fn cabort();
+    #[link_name = "\u{1}bw_Cookie_isSecure"]
+    pub fn cbw_Cookie_isSecure(cookie: *const cbw_Cookie) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}atexit"]
-    pub fn catexit(__func: ::std::option::Option<unsafe extern "C" fn()>) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_Cookie_makeSecure"]
+    pub fn cbw_Cookie_makeSecure(cookie: *mut cbw_Cookie);
 }
 extern "C" {
-    #[link_name = "\u{1}at_quick_exit"]
-    pub fn cat_quick_exit(
-        __func: ::std::option::Option<unsafe extern "C" fn()>,
-    ) -> ::std::os::raw::c_int;
+    #[doc = " Counts the cookies that match the filter, without copying any of them."]
+    #[doc = " If `url` is empty, cookies of all urls are counted."]
+    #[link_name = "\u{1}bw_CookieJar_count"]
+    pub fn cbw_CookieJar_count(
+        jar: *mut cbw_CookieJar,
+        include_http_only: cBOOL,
+        url: cbw_CStrSlice,
+        filter: *const cbw_CookieFilter,
+        cb: cbw_CookieJarCountCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}on_exit"]
-    pub fn con_exit(
-        __func: ::std::option::Option<
-            unsafe extern "C" fn(
-                __status: ::std::os::raw::c_int,
-                __arg: *mut ::std::os::raw::c_void,
-            ),
-        >,
-        __arg: *mut ::std::os::raw::c_void,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_CookieJar_delete"]
+    pub fn cbw_CookieJar_delete(
+        jar: *mut cbw_CookieJar,
+        url: cbw_CStrSlice,
+        name: cbw_CStrSlice,
+        cb: cbw_CookieJarDeleteCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}exit"]
-    pub fn cexit(__status: ::std::os::raw::c_int);
+    #[doc = " Deletes the cookies with any of the given names, like `bw_CookieJar_delete` does for one name."]
+    #[doc = " The callback is invoked only once, with the total number of deleted cookies, after all deletions have completed."]
+    #[link_name = "\u{1}bw_CookieJar_deleteMany"]
+    pub fn cbw_CookieJar_deleteMany(
+        jar: *mut cbw_CookieJar,
+        url: cbw_CStrSlice,
+        names: *const cbw_CStrSlice,
+        count: csize_t,
+        cb: cbw_CookieJarDeleteCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}quick_exit"]
-    pub fn cquick_exit(__status: ::std::os::raw::c_int);
+    #[link_name = "\u{1}bw_CookieJar_free"]
+    pub fn cbw_CookieJar_free(jar: *mut cbw_CookieJar);
 }
 extern "C" {
-    #[link_name = "\u{1}_Exit"]
-    pub fn c_Exit(__status: ::std::os::raw::c_int);
+    #[link_name = "\u{1}bw_CookieJar_iterator"]
+    pub fn cbw_CookieJar_iterator(
+        jar: *mut cbw_CookieJar,
+        iterator: *mut *mut cbw_CookieIterator,
+        include_http_only: cBOOL,
+        url: cbw_CStrSlice,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}getenv"]
-    pub fn cgetenv(__name: *const ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+    #[link_name = "\u{1}bw_CookieJar_iteratorAll"]
+    pub fn cbw_CookieJar_iteratorAll(
+        jar: *mut cbw_CookieJar,
+        iterator: *mut *mut cbw_CookieIterator,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}putenv"]
-    pub fn cputenv(__string: *mut ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+    #[doc = " Like `bw_CookieJar_iterator`, but only visits the cookies that match `filter`, and only copies the fields selected by it."]
+    #[doc = " If `url` is empty, cookies of all urls are visited."]
+    #[link_name = "\u{1}bw_CookieJar_iteratorFiltered"]
+    pub fn cbw_CookieJar_iteratorFiltered(
+        jar: *mut cbw_CookieJar,
+        iterator: *mut *mut cbw_CookieIterator,
+        include_http_only: cBOOL,
+        url: cbw_CStrSlice,
+        filter: *const cbw_CookieFilter,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}setenv"]
-    pub fn csetenv(
-        __name: *const ::std::os::raw::c_char,
-        __value: *const ::std::os::raw::c_char,
-        __replace: ::std::os::raw::c_int,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_CookieJar_newGlobal"]
+    pub fn cbw_CookieJar_newGlobal() -> *mut cbw_CookieJar;
 }
 extern "C" {
-    #[link_name = "\u{1}unsetenv"]
-    pub fn cunsetenv(__name: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bw_CookieJar_store"]
+    pub fn cbw_CookieJar_store(
+        jar: *mut cbw_CookieJar,
+        url: cbw_CStrSlice,
+        cookie: *const cbw_Cookie,
+        cb: cbw_CookieJarStorageCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    ) -> cbw_Err;
 }
 extern "C" {
-    #[link_name = "\u{1}clearenv"]
-    pub fn cclearenv() -> ::std::os::raw::c_int;
+    #[doc = " Stores all given cookies for the given url."]
+    #[doc = " The callback is invoked only once, with the number of cookies that have been stored successfully, after all of them have been processed."]
+    #[doc = " `cb` may be null."]
+    #[link_name = "\u{1}bw_CookieJar_storeMany"]
+    pub fn cbw_CookieJar_storeMany(
+        jar: *mut cbw_CookieJar,
+        url: cbw_CStrSlice,
+        cookies: *const *const cbw_Cookie,
+        count: csize_t,
+        cb: cbw_CookieJarStoreManyCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}mktemp"]
-    pub fn cmktemp(__template: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+    #[link_name = "\u{1}bw_CookieIterator_free"]
+    pub fn cbw_CookieIterator_free(iterator: *mut cbw_CookieIterator);
 }
 extern "C" {
-    #[link_name = "\u{1}mkstemp"]
-    pub fn cmkstemp(__template: *mut ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+    #[doc = " Provides the next cookie to `on_next`, which might be invoked later on if the cookie hasn't been visited yet."]
+    #[doc = " Cookies are buffered only until they are handed out, so iterating doesn't keep the whole jar in memory."]
+    #[doc = " Returns false if there are no more cookies, in which case `on_next` is not invoked."]
+    #[link_name = "\u{1}bw_CookieIterator_next"]
+    pub fn cbw_CookieIterator_next(
+        iterator: *mut cbw_CookieIterator,
+        on_next: cbw_CookieIteratorNextCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    ) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}mkstemps"]
-    pub fn cmkstemps(
-        __template: *mut ::std::os::raw::c_char,
-        __suffixlen: ::std::os::raw::c_int,
-    ) -> ::std::os::raw::c_int;
+    #[doc = " Like `bw_CookieIterator_next`, but lends the cookie to `on_next` instead of allocating a copy of it that needs to be freed."]
+    #[link_name = "\u{1}bw_CookieIterator_nextBorrowed"]
+    pub fn cbw_CookieIterator_nextBorrowed(
+        iterator: *mut cbw_CookieIterator,
+        on_next: cbw_CookieIteratorNextBorrowedCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    ) -> cBOOL;
 }
-extern "C" {
-    #[link_name = "\u{1}mkdtemp"]
-    pub fn cmkdtemp(__template: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_RequestContextImpl {
+    pub handle_ptr: *mut ::std::os::raw::c_void,
 }
-extern "C" {
-    #[link_name = "\u{1}system"]
-    pub fn csystem(__command: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+#[test]
+fn bindgen_test_layout_cbw_RequestContextImpl() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_RequestContextImpl>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_RequestContextImpl))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_RequestContextImpl>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_RequestContextImpl))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_RequestContextImpl>())).handle_ptr as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_RequestContextImpl),
+            "::",
+            stringify!(handle_ptr)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}realpath"]
-    pub fn crealpath(
-        __name: *const ::std::os::raw::c_char,
-        __resolved: *mut ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
+#[doc = " An isolated browsing session, with its own cookies, cache and local storage."]
+#[doc = " Browser windows that are created with the same request context share their state, but never with windows of another request context."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_RequestContext {
+    pub impl_: cbw_RequestContextImpl,
 }
-pub type c__compar_fn_t = ::std::option::Option<
-    unsafe extern "C" fn(
-        arg1: *const ::std::os::raw::c_void,
-        arg2: *const ::std::os::raw::c_void,
-    ) -> ::std::os::raw::c_int,
->;
-extern "C" {
-    #[link_name = "\u{1}bsearch"]
-    pub fn cbsearch(
-        __key: *const ::std::os::raw::c_void,
-        __base: *const ::std::os::raw::c_void,
-        __nmemb: csize_t,
-        __size: csize_t,
-        __compar: c__compar_fn_t,
-    ) -> *mut ::std::os::raw::c_void;
+#[test]
+fn bindgen_test_layout_cbw_RequestContext() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_RequestContext>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_RequestContext))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_RequestContext>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_RequestContext))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_RequestContext>())).impl_ as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_RequestContext),
+            "::",
+            stringify!(impl_)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}qsort"]
-    pub fn cqsort(
-        __base: *mut ::std::os::raw::c_void,
-        __nmemb: csize_t,
-        __size: csize_t,
-        __compar: c__compar_fn_t,
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_RequestContextOptions {
+    #[doc = " The directory in which the cache and cookies are stored."]
+    #[doc = " If empty, nothing is written to disk at all, and everything is gone as soon as the request context and all browser windows using it are freed."]
+    pub cache_path: cbw_CStrSlice,
+}
+#[test]
+fn bindgen_test_layout_cbw_RequestContextOptions() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_RequestContextOptions>(),
+        16usize,
+        concat!("Size of: ", stringify!(cbw_RequestContextOptions))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_RequestContextOptions>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_RequestContextOptions))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_RequestContextOptions>())).cache_path as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_RequestContextOptions),
+            "::",
+            stringify!(cache_path)
+        )
     );
 }
 extern "C" {
-    #[link_name = "\u{1}abs"]
-    pub fn cabs(__x: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
+    #[doc = " Creates a new request context."]
+    #[doc = " It can be passed to any number of browser windows through `bw_BrowserWindowOptions`."]
+    #[link_name = "\u{1}bw_RequestContext_new"]
+    pub fn cbw_RequestContext_new(
+        options: *const cbw_RequestContextOptions,
+    ) -> *mut cbw_RequestContext;
 }
 extern "C" {
-    #[link_name = "\u{1}labs"]
-    pub fn clabs(__x: ::std::os::raw::c_long) -> ::std::os::raw::c_long;
+    #[doc = " Creates another handle to the same request context, which needs to be freed separately."]
+    #[link_name = "\u{1}bw_RequestContext_copy"]
+    pub fn cbw_RequestContext_copy(context: *const cbw_RequestContext) -> *mut cbw_RequestContext;
 }
 extern "C" {
-    #[link_name = "\u{1}llabs"]
-    pub fn cllabs(__x: ::std::os::raw::c_longlong) -> ::std::os::raw::c_longlong;
+    #[doc = " Frees the handle."]
+    #[doc = " The state of the request context is only released once all the browser windows that use it have been closed as well."]
+    #[link_name = "\u{1}bw_RequestContext_free"]
+    pub fn cbw_RequestContext_free(context: *mut cbw_RequestContext);
 }
 extern "C" {
-    #[link_name = "\u{1}div"]
-    pub fn cdiv(__numer: ::std::os::raw::c_int, __denom: ::std::os::raw::c_int) -> cdiv_t;
+    #[doc = " Creates a handle to the cookie jar that only contains the cookies of this request context."]
+    #[doc = " The cookie jar needs to be freed with `bw_CookieJar_free`."]
+    #[link_name = "\u{1}bw_RequestContext_getCookieJar"]
+    pub fn cbw_RequestContext_getCookieJar(
+        context: *const cbw_RequestContext,
+    ) -> *mut cbw_CookieJar;
 }
+pub type cbw_ResourceFreeFn =
+    ::std::option::Option<unsafe extern "C" fn(user_data: *mut ::std::os::raw::c_void)>;
 extern "C" {
-    #[link_name = "\u{1}ldiv"]
-    pub fn cldiv(__numer: ::std::os::raw::c_long, __denom: ::std::os::raw::c_long) -> cldiv_t;
+    #[doc = " Serves the given data at the given path, which includes the host, e.g. `bundle/index.html` for `app://bundle/index.html`."]
+    #[doc = " The data is not copied, so it needs to stay valid until `free_fn` is invoked with `user_data`."]
+    #[doc = " That happens once the resource has been replaced or unregistered, and no response is being read from it anymore, possibly on another thread."]
+    #[doc = " If `free_fn` is null, the data needs to stay valid for as long as the application runs."]
+    #[doc = " If `mime_type` is empty, it is derived from the extension of the path."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Resource_register"]
+    pub fn cbw_Resource_register(
+        path: cbw_CStrSlice,
+        data: *const ::std::os::raw::c_void,
+        size: csize_t,
+        mime_type: cbw_CStrSlice,
+        free_fn: cbw_ResourceFreeFn,
+        user_data: *mut ::std::os::raw::c_void,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}lldiv"]
-    pub fn clldiv(
-        __numer: ::std::os::raw::c_longlong,
-        __denom: ::std::os::raw::c_longlong,
-    ) -> clldiv_t;
+    #[doc = " Maps a resource pack file into memory, and serves all resources inside of it."]
+    #[doc = " Resources registered with `bw_Resource_register` take precedence, and so do packs that have been loaded before."]
+    #[doc = " Fails if the file doesn't exist or isn't a valid pack."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Resource_loadPack"]
+    pub fn cbw_Resource_loadPack(path: cbw_CStrSlice) -> cbw_Err;
 }
 extern "C" {
-    #[link_name = "\u{1}ecvt"]
-    pub fn cecvt(
-        __value: f64,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
+    #[doc = " Stops serving the resource that has been registered at the given path."]
+    #[doc = " Returns false if there was none."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Resource_unregister"]
+    pub fn cbw_Resource_unregister(path: cbw_CStrSlice) -> cBOOL;
 }
 extern "C" {
-    #[link_name = "\u{1}fcvt"]
-    pub fn cfcvt(
-        __value: f64,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
+    #[doc = " Serves the files inside the given directory at the given host, e.g. `app://bundle/js/main.js` for `<directory>/js/main.js` with host `bundle`."]
+    #[doc = " The files are memory mapped instead of read, and are never served from outside of the directory."]
+    #[doc = " Resources registered with `bw_Resource_register` take precedence."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Resource_mountDirectory"]
+    pub fn cbw_Resource_mountDirectory(host: cbw_CStrSlice, directory: cbw_CStrSlice);
 }
-extern "C" {
-    #[link_name = "\u{1}gcvt"]
-    pub fn cgcvt(
-        __value: f64,
-        __ndigit: ::std::os::raw::c_int,
-        __buf: *mut ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
+pub type c__int_least8_t = c__int8_t;
+pub type c__uint_least8_t = c__uint8_t;
+pub type c__int_least16_t = c__int16_t;
+pub type c__uint_least16_t = c__uint16_t;
+pub type c__int_least32_t = c__int32_t;
+pub type c__uint_least32_t = c__uint32_t;
+pub type c__int_least64_t = c__int64_t;
+pub type c__uint_least64_t = c__uint64_t;
+pub type c__quad_t = ::std::os::raw::c_long;
+pub type c__u_quad_t = ::std::os::raw::c_ulong;
+pub type c__intmax_t = ::std::os::raw::c_long;
+pub type c__uintmax_t = ::std::os::raw::c_ulong;
+pub type c__dev_t = ::std::os::raw::c_ulong;
+pub type c__uid_t = ::std::os::raw::c_uint;
+pub type c__gid_t = ::std::os::raw::c_uint;
+pub type c__ino_t = ::std::os::raw::c_ulong;
+pub type c__ino64_t = ::std::os::raw::c_ulong;
+pub type c__mode_t = ::std::os::raw::c_uint;
+pub type c__nlink_t = ::std::os::raw::c_ulong;
+pub type c__off_t = ::std::os::raw::c_long;
+pub type c__off64_t = ::std::os::raw::c_long;
+pub type c__pid_t = ::std::os::raw::c_int;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__fsid_t {
+    pub __val: [::std::os::raw::c_int; 2usize],
 }
-extern "C" {
-    #[link_name = "\u{1}qecvt"]
-    pub fn cqecvt(
-        __value: u128,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
+#[test]
+fn bindgen_test_layout_c__fsid_t() {
+    assert_eq!(
+        ::std::mem::size_of::<c__fsid_t>(),
+        8usize,
+        concat!("Size of: ", stringify!(c__fsid_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__fsid_t>(),
+        4usize,
+        concat!("Alignment of ", stringify!(c__fsid_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__fsid_t>())).__val as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__fsid_t),
+            "::",
+            stringify!(__val)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}qfcvt"]
-    pub fn cqfcvt(
-        __value: u128,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
+pub type c__clock_t = ::std::os::raw::c_long;
+pub type c__rlim_t = ::std::os::raw::c_ulong;
+pub type c__rlim64_t = ::std::os::raw::c_ulong;
+pub type c__id_t = ::std::os::raw::c_uint;
+pub type c__time_t = ::std::os::raw::c_long;
+pub type c__useconds_t = ::std::os::raw::c_uint;
+pub type c__suseconds_t = ::std::os::raw::c_long;
+pub type c__daddr_t = ::std::os::raw::c_int;
+pub type c__key_t = ::std::os::raw::c_int;
+pub type c__clockid_t = ::std::os::raw::c_int;
+pub type c__timer_t = *mut ::std::os::raw::c_void;
+pub type c__blksize_t = ::std::os::raw::c_long;
+pub type c__blkcnt_t = ::std::os::raw::c_long;
+pub type c__blkcnt64_t = ::std::os::raw::c_long;
+pub type c__fsblkcnt_t = ::std::os::raw::c_ulong;
+pub type c__fsblkcnt64_t = ::std::os::raw::c_ulong;
+pub type c__fsfilcnt_t = ::std::os::raw::c_ulong;
+pub type c__fsfilcnt64_t = ::std::os::raw::c_ulong;
+pub type c__fsword_t = ::std::os::raw::c_long;
+pub type c__ssize_t = ::std::os::raw::c_long;
+pub type c__syscall_slong_t = ::std::os::raw::c_long;
+pub type c__syscall_ulong_t = ::std::os::raw::c_ulong;
+pub type c__loff_t = c__off64_t;
+pub type c__caddr_t = *mut ::std::os::raw::c_char;
+pub type c__intptr_t = ::std::os::raw::c_long;
+pub type c__socklen_t = ::std::os::raw::c_uint;
+pub type c__sig_atomic_t = ::std::os::raw::c_int;
+pub type cu_char = c__u_char;
+pub type cu_short = c__u_short;
+pub type cu_int = c__u_int;
+pub type cu_long = c__u_long;
+pub type cquad_t = c__quad_t;
+pub type cu_quad_t = c__u_quad_t;
+pub type cfsid_t = c__fsid_t;
+pub type cloff_t = c__loff_t;
+pub type cino_t = c__ino_t;
+pub type cdev_t = c__dev_t;
+pub type cgid_t = c__gid_t;
+pub type cmode_t = c__mode_t;
+pub type cnlink_t = c__nlink_t;
+pub type cuid_t = c__uid_t;
+pub type coff_t = c__off_t;
+pub type cpid_t = c__pid_t;
+pub type cid_t = c__id_t;
+pub type cssize_t = c__ssize_t;
+pub type cdaddr_t = c__daddr_t;
+pub type ccaddr_t = c__caddr_t;
+pub type ckey_t = c__key_t;
+pub type cclock_t = c__clock_t;
+pub type cclockid_t = c__clockid_t;
+pub type ctime_t = c__time_t;
+pub type ctimer_t = c__timer_t;
+pub type culong = ::std::os::raw::c_ulong;
+pub type cushort = ::std::os::raw::c_ushort;
+pub type cuint = ::std::os::raw::c_uint;
+pub type cu_int8_t = c__uint8_t;
+pub type cu_int16_t = c__uint16_t;
+pub type cu_int32_t = c__uint32_t;
+pub type cu_int64_t = c__uint64_t;
+pub type cregister_t = ::std::os::raw::c_long;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__sigset_t {
+    pub __val: [::std::os::raw::c_ulong; 16usize],
 }
-extern "C" {
-    #[link_name = "\u{1}qgcvt"]
-    pub fn cqgcvt(
-        __value: u128,
-        __ndigit: ::std::os::raw::c_int,
-        __buf: *mut ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
+#[test]
+fn bindgen_test_layout_c__sigset_t() {
+    assert_eq!(
+        ::std::mem::size_of::<c__sigset_t>(),
+        128usize,
+        concat!("Size of: ", stringify!(c__sigset_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__sigset_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__sigset_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__sigset_t>())).__val as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__sigset_t),
+            "::",
+            stringify!(__val)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}ecvt_r"]
-    pub fn cecvt_r(
-        __value: f64,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-        __buf: *mut ::std::os::raw::c_char,
-        __len: csize_t,
-    ) -> ::std::os::raw::c_int;
+pub type csigset_t = c__sigset_t;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct ctimeval {
+    pub tv_sec: c__time_t,
+    pub tv_usec: c__suseconds_t,
 }
-extern "C" {
-    #[link_name = "\u{1}fcvt_r"]
-    pub fn cfcvt_r(
-        __value: f64,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-        __buf: *mut ::std::os::raw::c_char,
-        __len: csize_t,
-    ) -> ::std::os::raw::c_int;
+#[test]
+fn bindgen_test_layout_ctimeval() {
+    assert_eq!(
+        ::std::mem::size_of::<ctimeval>(),
+        16usize,
+        concat!("Size of: ", stringify!(ctimeval))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<ctimeval>(),
+        8usize,
+        concat!("Alignment of ", stringify!(ctimeval))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<ctimeval>())).tv_sec as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ctimeval),
+            "::",
+            stringify!(tv_sec)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<ctimeval>())).tv_usec as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(ctimeval),
+            "::",
+            stringify!(tv_usec)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}qecvt_r"]
-    pub fn cqecvt_r(
-        __value: u128,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-        __buf: *mut ::std::os::raw::c_char,
-        __len: csize_t,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}qfcvt_r"]
-    pub fn cqfcvt_r(
-        __value: u128,
-        __ndigit: ::std::os::raw::c_int,
-        __decpt: *mut ::std::os::raw::c_int,
-        __sign: *mut ::std::os::raw::c_int,
-        __buf: *mut ::std::os::raw::c_char,
-        __len: csize_t,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}mblen"]
-    pub fn cmblen(__s: *const ::std::os::raw::c_char, __n: csize_t) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}mbtowc"]
-    pub fn cmbtowc(
-        __pwc: *mut cwchar_t,
-        __s: *const ::std::os::raw::c_char,
-        __n: csize_t,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}wctomb"]
-    pub fn cwctomb(__s: *mut ::std::os::raw::c_char, __wchar: cwchar_t) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}mbstowcs"]
-    pub fn cmbstowcs(
-        __pwcs: *mut cwchar_t,
-        __s: *const ::std::os::raw::c_char,
-        __n: csize_t,
-    ) -> csize_t;
-}
-extern "C" {
-    #[link_name = "\u{1}wcstombs"]
-    pub fn cwcstombs(
-        __s: *mut ::std::os::raw::c_char,
-        __pwcs: *const cwchar_t,
-        __n: csize_t,
-    ) -> csize_t;
-}
-extern "C" {
-    #[link_name = "\u{1}rpmatch"]
-    pub fn crpmatch(__response: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}getsubopt"]
-    pub fn cgetsubopt(
-        __optionp: *mut *mut ::std::os::raw::c_char,
-        __tokens: *const *mut ::std::os::raw::c_char,
-        __valuep: *mut *mut ::std::os::raw::c_char,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}getloadavg"]
-    pub fn cgetloadavg(
-        __loadavg: *mut f64,
-        __nelem: ::std::os::raw::c_int,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}memcpy"]
-    pub fn cmemcpy(
-        __dest: *mut ::std::os::raw::c_void,
-        __src: *const ::std::os::raw::c_void,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_void;
-}
-extern "C" {
-    #[link_name = "\u{1}memmove"]
-    pub fn cmemmove(
-        __dest: *mut ::std::os::raw::c_void,
-        __src: *const ::std::os::raw::c_void,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_void;
-}
-extern "C" {
-    #[link_name = "\u{1}memccpy"]
-    pub fn cmemccpy(
-        __dest: *mut ::std::os::raw::c_void,
-        __src: *const ::std::os::raw::c_void,
-        __c: ::std::os::raw::c_int,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_void;
-}
-extern "C" {
-    #[link_name = "\u{1}memset"]
-    pub fn cmemset(
-        __s: *mut ::std::os::raw::c_void,
-        __c: ::std::os::raw::c_int,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_void;
-}
-extern "C" {
-    #[link_name = "\u{1}memcmp"]
-    pub fn cmemcmp(
-        __s1: *const ::std::os::raw::c_void,
-        __s2: *const ::std::os::raw::c_void,
-        __n: ::std::os::raw::c_ulong,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}memchr"]
-    pub fn cmemchr(
-        __s: *const ::std::os::raw::c_void,
-        __c: ::std::os::raw::c_int,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_void;
-}
-extern "C" {
-    #[link_name = "\u{1}strcpy"]
-    pub fn cstrcpy(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strncpy"]
-    pub fn cstrncpy(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strcat"]
-    pub fn cstrcat(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strncat"]
-    pub fn cstrncat(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strcmp"]
-    pub fn cstrcmp(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}strncmp"]
-    pub fn cstrncmp(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_ulong,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}strcoll"]
-    pub fn cstrcoll(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[link_name = "\u{1}strxfrm"]
-    pub fn cstrxfrm(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_ulong,
-    ) -> ::std::os::raw::c_ulong;
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct c__locale_struct {
-    pub __locales: [*mut c__locale_data; 13usize],
-    pub __ctype_b: *const ::std::os::raw::c_ushort,
-    pub __ctype_tolower: *const ::std::os::raw::c_int,
-    pub __ctype_toupper: *const ::std::os::raw::c_int,
-    pub __names: [*const ::std::os::raw::c_char; 13usize],
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct ctimespec {
+    pub tv_sec: c__time_t,
+    pub tv_nsec: c__syscall_slong_t,
 }
 #[test]
-fn bindgen_test_layout_c__locale_struct() {
+fn bindgen_test_layout_ctimespec() {
     assert_eq!(
-        ::std::mem::size_of::<c__locale_struct>(),
-        232usize,
-        concat!("Size of: ", stringify!(c__locale_struct))
+        ::std::mem::size_of::<ctimespec>(),
+        16usize,
+        concat!("Size of: ", stringify!(ctimespec))
     );
     assert_eq!(
-        ::std::mem::align_of::<c__locale_struct>(),
+        ::std::mem::align_of::<ctimespec>(),
         8usize,
-        concat!("Alignment of ", stringify!(c__locale_struct))
+        concat!("Alignment of ", stringify!(ctimespec))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__locale_struct>())).__locales as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<ctimespec>())).tv_sec as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__locale_struct),
+            stringify!(ctimespec),
             "::",
-            stringify!(__locales)
+            stringify!(tv_sec)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__locale_struct>())).__ctype_b as *const _ as usize },
-        104usize,
+        unsafe { &(*(::std::ptr::null::<ctimespec>())).tv_nsec as *const _ as usize },
+        8usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__locale_struct),
+            stringify!(ctimespec),
             "::",
-            stringify!(__ctype_b)
+            stringify!(tv_nsec)
         )
     );
+}
+pub type csuseconds_t = c__suseconds_t;
+pub type c__fd_mask = ::std::os::raw::c_long;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cfd_set {
+    pub __fds_bits: [c__fd_mask; 16usize],
+}
+#[test]
+fn bindgen_test_layout_cfd_set() {
     assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__locale_struct>())).__ctype_tolower as *const _ as usize
-        },
-        112usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__locale_struct),
-            "::",
-            stringify!(__ctype_tolower)
-        )
+        ::std::mem::size_of::<cfd_set>(),
+        128usize,
+        concat!("Size of: ", stringify!(cfd_set))
     );
     assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<c__locale_struct>())).__ctype_toupper as *const _ as usize
-        },
-        120usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c__locale_struct),
-            "::",
-            stringify!(__ctype_toupper)
-        )
+        ::std::mem::align_of::<cfd_set>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cfd_set))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__locale_struct>())).__names as *const _ as usize },
-        128usize,
+        unsafe { &(*(::std::ptr::null::<cfd_set>())).__fds_bits as *const _ as usize },
+        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__locale_struct),
+            stringify!(cfd_set),
             "::",
-            stringify!(__names)
+            stringify!(__fds_bits)
         )
     );
 }
-pub type c__locale_t = *mut c__locale_struct;
-pub type clocale_t = c__locale_t;
-extern "C" {
-    #[link_name = "\u{1}strcoll_l"]
-    pub fn cstrcoll_l(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-        __l: clocale_t,
-    ) -> ::std::os::raw::c_int;
-}
+pub type cfd_mask = c__fd_mask;
 extern "C" {
-    #[link_name = "\u{1}strxfrm_l"]
-    pub fn cstrxfrm_l(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-        __n: csize_t,
-        __l: clocale_t,
-    ) -> csize_t;
-}
-extern "C" {
-    #[link_name = "\u{1}strdup"]
-    pub fn cstrdup(__s: *const ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strndup"]
-    pub fn cstrndup(
-        __string: *const ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strchr"]
-    pub fn cstrchr(
-        __s: *const ::std::os::raw::c_char,
-        __c: ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strrchr"]
-    pub fn cstrrchr(
-        __s: *const ::std::os::raw::c_char,
-        __c: ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strcspn"]
-    pub fn cstrcspn(
-        __s: *const ::std::os::raw::c_char,
-        __reject: *const ::std::os::raw::c_char,
-    ) -> ::std::os::raw::c_ulong;
-}
-extern "C" {
-    #[link_name = "\u{1}strspn"]
-    pub fn cstrspn(
-        __s: *const ::std::os::raw::c_char,
-        __accept: *const ::std::os::raw::c_char,
-    ) -> ::std::os::raw::c_ulong;
-}
-extern "C" {
-    #[link_name = "\u{1}strpbrk"]
-    pub fn cstrpbrk(
-        __s: *const ::std::os::raw::c_char,
-        __accept: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strstr"]
-    pub fn cstrstr(
-        __haystack: *const ::std::os::raw::c_char,
-        __needle: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strtok"]
-    pub fn cstrtok(
-        __s: *mut ::std::os::raw::c_char,
-        __delim: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}__strtok_r"]
-    pub fn c__strtok_r(
-        __s: *mut ::std::os::raw::c_char,
-        __delim: *const ::std::os::raw::c_char,
-        __save_ptr: *mut *mut ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strtok_r"]
-    pub fn cstrtok_r(
-        __s: *mut ::std::os::raw::c_char,
-        __delim: *const ::std::os::raw::c_char,
-        __save_ptr: *mut *mut ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}strlen"]
-    pub fn cstrlen(__s: *const ::std::os::raw::c_char) -> ::std::os::raw::c_ulong;
-}
-extern "C" {
-    #[link_name = "\u{1}strnlen"]
-    pub fn cstrnlen(__string: *const ::std::os::raw::c_char, __maxlen: csize_t) -> csize_t;
-}
-extern "C" {
-    #[link_name = "\u{1}strerror"]
-    pub fn cstrerror(__errnum: ::std::os::raw::c_int) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}__xpg_strerror_r"]
-    pub fn cstrerror_r(
-        __errnum: ::std::os::raw::c_int,
-        __buf: *mut ::std::os::raw::c_char,
-        __buflen: csize_t,
+    #[link_name = "\u{1}select"]
+    pub fn cselect(
+        __nfds: ::std::os::raw::c_int,
+        __readfds: *mut cfd_set,
+        __writefds: *mut cfd_set,
+        __exceptfds: *mut cfd_set,
+        __timeout: *mut ctimeval,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}strerror_l"]
-    pub fn cstrerror_l(
-        __errnum: ::std::os::raw::c_int,
-        __l: clocale_t,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}bcmp"]
-    pub fn cbcmp(
-        __s1: *const ::std::os::raw::c_void,
-        __s2: *const ::std::os::raw::c_void,
-        __n: ::std::os::raw::c_ulong,
+    #[link_name = "\u{1}pselect"]
+    pub fn cpselect(
+        __nfds: ::std::os::raw::c_int,
+        __readfds: *mut cfd_set,
+        __writefds: *mut cfd_set,
+        __exceptfds: *mut cfd_set,
+        __timeout: *const ctimespec,
+        __sigmask: *const c__sigset_t,
     ) -> ::std::os::raw::c_int;
 }
-extern "C" {
-    #[link_name = "\u{1}bcopy"]
-    pub fn cbcopy(
-        __src: *const ::std::os::raw::c_void,
-        __dest: *mut ::std::os::raw::c_void,
-        __n: csize_t,
-    );
-}
-extern "C" {
-    #[link_name = "\u{1}bzero"]
-    pub fn cbzero(__s: *mut ::std::os::raw::c_void, __n: ::std::os::raw::c_ulong);
-}
-extern "C" {
-    #[link_name = "\u{1}index"]
-    pub fn cindex(
-        __s: *const ::std::os::raw::c_char,
-        __c: ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}rindex"]
-    pub fn crindex(
-        __s: *const ::std::os::raw::c_char,
-        __c: ::std::os::raw::c_int,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}ffs"]
-    pub fn cffs(__i: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
+pub type cblksize_t = c__blksize_t;
+pub type cblkcnt_t = c__blkcnt_t;
+pub type cfsblkcnt_t = c__fsblkcnt_t;
+pub type cfsfilcnt_t = c__fsfilcnt_t;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__pthread_internal_list {
+    pub __prev: *mut c__pthread_internal_list,
+    pub __next: *mut c__pthread_internal_list,
 }
-extern "C" {
-    #[link_name = "\u{1}ffsl"]
-    pub fn cffsl(__l: ::std::os::raw::c_long) -> ::std::os::raw::c_int;
+#[test]
+fn bindgen_test_layout_c__pthread_internal_list() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_internal_list>(),
+        16usize,
+        concat!("Size of: ", stringify!(c__pthread_internal_list))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_internal_list>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__pthread_internal_list))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_internal_list>())).__prev as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_internal_list),
+            "::",
+            stringify!(__prev)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_internal_list>())).__next as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_internal_list),
+            "::",
+            stringify!(__next)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}ffsll"]
-    pub fn cffsll(__ll: ::std::os::raw::c_longlong) -> ::std::os::raw::c_int;
+pub type c__pthread_list_t = c__pthread_internal_list;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__pthread_internal_slist {
+    pub __next: *mut c__pthread_internal_slist,
 }
-extern "C" {
-    #[link_name = "\u{1}strcasecmp"]
-    pub fn cstrcasecmp(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-    ) -> ::std::os::raw::c_int;
+#[test]
+fn bindgen_test_layout_c__pthread_internal_slist() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_internal_slist>(),
+        8usize,
+        concat!("Size of: ", stringify!(c__pthread_internal_slist))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_internal_slist>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__pthread_internal_slist))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_internal_slist>())).__next as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_internal_slist),
+            "::",
+            stringify!(__next)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}strncasecmp"]
-    pub fn cstrncasecmp(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_ulong,
-    ) -> ::std::os::raw::c_int;
+pub type c__pthread_slist_t = c__pthread_internal_slist;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__pthread_mutex_s {
+    pub __lock: ::std::os::raw::c_int,
+    pub __count: ::std::os::raw::c_uint,
+    pub __owner: ::std::os::raw::c_int,
+    pub __nusers: ::std::os::raw::c_uint,
+    pub __kind: ::std::os::raw::c_int,
+    pub __spins: ::std::os::raw::c_short,
+    pub __elision: ::std::os::raw::c_short,
+    pub __list: c__pthread_list_t,
+}
+#[test]
+fn bindgen_test_layout_c__pthread_mutex_s() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_mutex_s>(),
+        40usize,
+        concat!("Size of: ", stringify!(c__pthread_mutex_s))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_mutex_s>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__pthread_mutex_s))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__lock as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__lock)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__count as *const _ as usize },
+        4usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__count)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__owner as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__owner)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__nusers as *const _ as usize },
+        12usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__nusers)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__kind as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__kind)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__spins as *const _ as usize },
+        20usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__spins)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__elision as *const _ as usize },
+        22usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__elision)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_mutex_s>())).__list as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_mutex_s),
+            "::",
+            stringify!(__list)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__pthread_rwlock_arch_t {
+    pub __readers: ::std::os::raw::c_uint,
+    pub __writers: ::std::os::raw::c_uint,
+    pub __wrphase_futex: ::std::os::raw::c_uint,
+    pub __writers_futex: ::std::os::raw::c_uint,
+    pub __pad3: ::std::os::raw::c_uint,
+    pub __pad4: ::std::os::raw::c_uint,
+    pub __cur_writer: ::std::os::raw::c_int,
+    pub __shared: ::std::os::raw::c_int,
+    pub __rwelision: ::std::os::raw::c_schar,
+    pub __pad1: [::std::os::raw::c_uchar; 7usize],
+    pub __pad2: ::std::os::raw::c_ulong,
+    pub __flags: ::std::os::raw::c_uint,
+}
+#[test]
+fn bindgen_test_layout_c__pthread_rwlock_arch_t() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_rwlock_arch_t>(),
+        56usize,
+        concat!("Size of: ", stringify!(c__pthread_rwlock_arch_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_rwlock_arch_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__pthread_rwlock_arch_t))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__readers as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__readers)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__writers as *const _ as usize
+        },
+        4usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__writers)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__wrphase_futex as *const _
+                as usize
+        },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__wrphase_futex)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__writers_futex as *const _
+                as usize
+        },
+        12usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__writers_futex)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad3 as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__pad3)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad4 as *const _ as usize },
+        20usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__pad4)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__cur_writer as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__cur_writer)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__shared as *const _ as usize
+        },
+        28usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__shared)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__rwelision as *const _ as usize
+        },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__rwelision)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad1 as *const _ as usize },
+        33usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__pad1)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__pad2 as *const _ as usize },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__pad2)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_rwlock_arch_t>())).__flags as *const _ as usize
+        },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_rwlock_arch_t),
+            "::",
+            stringify!(__flags)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct c__pthread_cond_s {
+    pub __bindgen_anon_1: c__pthread_cond_s__bindgen_ty_1,
+    pub __bindgen_anon_2: c__pthread_cond_s__bindgen_ty_2,
+    pub __g_refs: [::std::os::raw::c_uint; 2usize],
+    pub __g_size: [::std::os::raw::c_uint; 2usize],
+    pub __g1_orig_size: ::std::os::raw::c_uint,
+    pub __wrefs: ::std::os::raw::c_uint,
+    pub __g_signals: [::std::os::raw::c_uint; 2usize],
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union c__pthread_cond_s__bindgen_ty_1 {
+    pub __wseq: ::std::os::raw::c_ulonglong,
+    pub __wseq32: c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1,
+    _bindgen_union_align: u64,
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1 {
+    pub __low: ::std::os::raw::c_uint,
+    pub __high: ::std::os::raw::c_uint,
+}
+#[test]
+fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>(),
+        8usize,
+        concat!(
+            "Size of: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1)
+        )
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>(),
+        4usize,
+        concat!(
+            "Alignment of ",
+            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>())).__low
+                as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1),
+            "::",
+            stringify!(__low)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1>())).__high
+                as *const _ as usize
+        },
+        4usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_1__bindgen_ty_1),
+            "::",
+            stringify!(__high)
+        )
+    );
+}
+#[test]
+fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_1() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_1>(),
+        8usize,
+        concat!("Size of: ", stringify!(c__pthread_cond_s__bindgen_ty_1))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_1>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__pthread_cond_s__bindgen_ty_1))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1>())).__wseq as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_1),
+            "::",
+            stringify!(__wseq)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_1>())).__wseq32 as *const _
+                as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_1),
+            "::",
+            stringify!(__wseq32)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union c__pthread_cond_s__bindgen_ty_2 {
+    pub __g1_start: ::std::os::raw::c_ulonglong,
+    pub __g1_start32: c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1,
+    _bindgen_union_align: u64,
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1 {
+    pub __low: ::std::os::raw::c_uint,
+    pub __high: ::std::os::raw::c_uint,
+}
+#[test]
+fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>(),
+        8usize,
+        concat!(
+            "Size of: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1)
+        )
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>(),
+        4usize,
+        concat!(
+            "Alignment of ",
+            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>())).__low
+                as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1),
+            "::",
+            stringify!(__low)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1>())).__high
+                as *const _ as usize
+        },
+        4usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_2__bindgen_ty_1),
+            "::",
+            stringify!(__high)
+        )
+    );
+}
+#[test]
+fn bindgen_test_layout_c__pthread_cond_s__bindgen_ty_2() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_cond_s__bindgen_ty_2>(),
+        8usize,
+        concat!("Size of: ", stringify!(c__pthread_cond_s__bindgen_ty_2))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_cond_s__bindgen_ty_2>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__pthread_cond_s__bindgen_ty_2))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2>())).__g1_start as *const _
+                as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_2),
+            "::",
+            stringify!(__g1_start)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s__bindgen_ty_2>())).__g1_start32 as *const _
+                as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s__bindgen_ty_2),
+            "::",
+            stringify!(__g1_start32)
+        )
+    );
+}
+#[test]
+fn bindgen_test_layout_c__pthread_cond_s() {
+    assert_eq!(
+        ::std::mem::size_of::<c__pthread_cond_s>(),
+        48usize,
+        concat!("Size of: ", stringify!(c__pthread_cond_s))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__pthread_cond_s>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__pthread_cond_s))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__g_refs as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s),
+            "::",
+            stringify!(__g_refs)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__g_size as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s),
+            "::",
+            stringify!(__g_size)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__pthread_cond_s>())).__g1_orig_size as *const _ as usize
+        },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s),
+            "::",
+            stringify!(__g1_orig_size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__wrefs as *const _ as usize },
+        36usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s),
+            "::",
+            stringify!(__wrefs)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__pthread_cond_s>())).__g_signals as *const _ as usize },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__pthread_cond_s),
+            "::",
+            stringify!(__g_signals)
+        )
+    );
+}
+pub type cpthread_t = ::std::os::raw::c_ulong;
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_mutexattr_t {
+    pub __size: [::std::os::raw::c_char; 4usize],
+    pub __align: ::std::os::raw::c_int,
+    _bindgen_union_align: u32,
+}
+#[test]
+fn bindgen_test_layout_cpthread_mutexattr_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_mutexattr_t>(),
+        4usize,
+        concat!("Size of: ", stringify!(cpthread_mutexattr_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_mutexattr_t>(),
+        4usize,
+        concat!("Alignment of ", stringify!(cpthread_mutexattr_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_mutexattr_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_mutexattr_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_mutexattr_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_mutexattr_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_condattr_t {
+    pub __size: [::std::os::raw::c_char; 4usize],
+    pub __align: ::std::os::raw::c_int,
+    _bindgen_union_align: u32,
+}
+#[test]
+fn bindgen_test_layout_cpthread_condattr_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_condattr_t>(),
+        4usize,
+        concat!("Size of: ", stringify!(cpthread_condattr_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_condattr_t>(),
+        4usize,
+        concat!("Alignment of ", stringify!(cpthread_condattr_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_condattr_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_condattr_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_condattr_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_condattr_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+pub type cpthread_key_t = ::std::os::raw::c_uint;
+pub type cpthread_once_t = ::std::os::raw::c_int;
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_attr_t {
+    pub __size: [::std::os::raw::c_char; 56usize],
+    pub __align: ::std::os::raw::c_long,
+    _bindgen_union_align: [u64; 7usize],
+}
+#[test]
+fn bindgen_test_layout_cpthread_attr_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_attr_t>(),
+        56usize,
+        concat!("Size of: ", stringify!(cpthread_attr_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_attr_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cpthread_attr_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_attr_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_attr_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_attr_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_attr_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_mutex_t {
+    pub __data: c__pthread_mutex_s,
+    pub __size: [::std::os::raw::c_char; 40usize],
+    pub __align: ::std::os::raw::c_long,
+    _bindgen_union_align: [u64; 5usize],
+}
+#[test]
+fn bindgen_test_layout_cpthread_mutex_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_mutex_t>(),
+        40usize,
+        concat!("Size of: ", stringify!(cpthread_mutex_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_mutex_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cpthread_mutex_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_mutex_t>())).__data as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_mutex_t),
+            "::",
+            stringify!(__data)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_mutex_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_mutex_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_mutex_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_mutex_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_cond_t {
+    pub __data: c__pthread_cond_s,
+    pub __size: [::std::os::raw::c_char; 48usize],
+    pub __align: ::std::os::raw::c_longlong,
+    _bindgen_union_align: [u64; 6usize],
+}
+#[test]
+fn bindgen_test_layout_cpthread_cond_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_cond_t>(),
+        48usize,
+        concat!("Size of: ", stringify!(cpthread_cond_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_cond_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cpthread_cond_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_cond_t>())).__data as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_cond_t),
+            "::",
+            stringify!(__data)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_cond_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_cond_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_cond_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_cond_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_rwlock_t {
+    pub __data: c__pthread_rwlock_arch_t,
+    pub __size: [::std::os::raw::c_char; 56usize],
+    pub __align: ::std::os::raw::c_long,
+    _bindgen_union_align: [u64; 7usize],
+}
+#[test]
+fn bindgen_test_layout_cpthread_rwlock_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_rwlock_t>(),
+        56usize,
+        concat!("Size of: ", stringify!(cpthread_rwlock_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_rwlock_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cpthread_rwlock_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_rwlock_t>())).__data as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_rwlock_t),
+            "::",
+            stringify!(__data)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_rwlock_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_rwlock_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_rwlock_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_rwlock_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_rwlockattr_t {
+    pub __size: [::std::os::raw::c_char; 8usize],
+    pub __align: ::std::os::raw::c_long,
+    _bindgen_union_align: u64,
+}
+#[test]
+fn bindgen_test_layout_cpthread_rwlockattr_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_rwlockattr_t>(),
+        8usize,
+        concat!("Size of: ", stringify!(cpthread_rwlockattr_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_rwlockattr_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cpthread_rwlockattr_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_rwlockattr_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_rwlockattr_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_rwlockattr_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_rwlockattr_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+pub type cpthread_spinlock_t = ::std::os::raw::c_int;
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_barrier_t {
+    pub __size: [::std::os::raw::c_char; 32usize],
+    pub __align: ::std::os::raw::c_long,
+    _bindgen_union_align: [u64; 4usize],
+}
+#[test]
+fn bindgen_test_layout_cpthread_barrier_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_barrier_t>(),
+        32usize,
+        concat!("Size of: ", stringify!(cpthread_barrier_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_barrier_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cpthread_barrier_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_barrier_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_barrier_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_barrier_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_barrier_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union cpthread_barrierattr_t {
+    pub __size: [::std::os::raw::c_char; 4usize],
+    pub __align: ::std::os::raw::c_int,
+    _bindgen_union_align: u32,
+}
+#[test]
+fn bindgen_test_layout_cpthread_barrierattr_t() {
+    assert_eq!(
+        ::std::mem::size_of::<cpthread_barrierattr_t>(),
+        4usize,
+        concat!("Size of: ", stringify!(cpthread_barrierattr_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cpthread_barrierattr_t>(),
+        4usize,
+        concat!("Alignment of ", stringify!(cpthread_barrierattr_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_barrierattr_t>())).__size as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_barrierattr_t),
+            "::",
+            stringify!(__size)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cpthread_barrierattr_t>())).__align as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cpthread_barrierattr_t),
+            "::",
+            stringify!(__align)
+        )
+    );
+}
+extern "C" {
+    #[link_name = "\u{1}random"]
+    pub fn crandom() -> ::std::os::raw::c_long;
+}
+extern "C" {
+    #[link_name = "\u{1}srandom"]
+    pub fn csrandom(__seed: ::std::os::raw::c_uint);
+}
+extern "C" {
+    #[link_name = "\u{1}initstate"]
+    pub fn cinitstate(
+        __seed: ::std::os::raw::c_uint,
+        __statebuf: *mut ::std::os::raw::c_char,
+        __statelen: csize_t,
+    ) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}setstate"]
+    pub fn csetstate(__statebuf: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct crandom_data {
+    pub fptr: *mut i32,
+    pub rptr: *mut i32,
+    pub state: *mut i32,
+    pub rand_type: ::std::os::raw::c_int,
+    pub rand_deg: ::std::os::raw::c_int,
+    pub rand_sep: ::std::os::raw::c_int,
+    pub end_ptr: *mut i32,
+}
+#[test]
+fn bindgen_test_layout_crandom_data() {
+    assert_eq!(
+        ::std::mem::size_of::<crandom_data>(),
+        48usize,
+        concat!("Size of: ", stringify!(crandom_data))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<crandom_data>(),
+        8usize,
+        concat!("Alignment of ", stringify!(crandom_data))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<crandom_data>())).fptr as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(crandom_data),
+            "::",
+            stringify!(fptr)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<crandom_data>())).rptr as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(crandom_data),
+            "::",
+            stringify!(rptr)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<crandom_data>())).state as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(crandom_data),
+            "::",
+            stringify!(state)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<crandom_data>())).rand_type as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(crandom_data),
+            "::",
+            stringify!(rand_type)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<crandom_data>())).rand_deg as *const _ as usize },
+        28usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(crandom_data),
+            "::",
+            stringify!(rand_deg)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<crandom_data>())).rand_sep as *const _ as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(crandom_data),
+            "::",
+            stringify!(rand_sep)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<crandom_data>())).end_ptr as *const _ as usize },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(crandom_data),
+            "::",
+            stringify!(end_ptr)
+        )
+    );
+}
+extern "C" {
+    #[link_name = "\u{1}random_r"]
+    pub fn crandom_r(__buf: *mut crandom_data, __result: *mut i32) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}srandom_r"]
+    pub fn csrandom_r(
+        __seed: ::std::os::raw::c_uint,
+        __buf: *mut crandom_data,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}initstate_r"]
+    pub fn cinitstate_r(
+        __seed: ::std::os::raw::c_uint,
+        __statebuf: *mut ::std::os::raw::c_char,
+        __statelen: csize_t,
+        __buf: *mut crandom_data,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}setstate_r"]
+    pub fn csetstate_r(
+        __statebuf: *mut ::std::os::raw::c_char,
+        __buf: *mut crandom_data,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}rand"]
+    pub fn crand() -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}srand"]
+    pub fn csrand(__seed: ::std::os::raw::c_uint);
+}
+extern "C" {
+    #[link_name = "\u{1}rand_r"]
+    pub fn crand_r(__seed: *mut ::std::os::raw::c_uint) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}drand48"]
+    pub fn cdrand48() -> f64;
+}
+extern "C" {
+    #[link_name = "\u{1}erand48"]
+    pub fn cerand48(__xsubi: *mut ::std::os::raw::c_ushort) -> f64;
+}
+extern "C" {
+    #[link_name = "\u{1}lrand48"]
+    pub fn clrand48() -> ::std::os::raw::c_long;
+}
+extern "C" {
+    #[link_name = "\u{1}nrand48"]
+    pub fn cnrand48(__xsubi: *mut ::std::os::raw::c_ushort) -> ::std::os::raw::c_long;
+}
+extern "C" {
+    #[link_name = "\u{1}mrand48"]
+    pub fn cmrand48() -> ::std::os::raw::c_long;
+}
+extern "C" {
+    #[link_name = "\u{1}jrand48"]
+    pub fn cjrand48(__xsubi: *mut ::std::os::raw::c_ushort) -> ::std::os::raw::c_long;
+}
+extern "C" {
+    #[link_name = "\u{1}srand48"]
+    pub fn csrand48(__seedval: ::std::os::raw::c_long);
+}
+extern "C" {
+    #[link_name = "\u{1}seed48"]
+    pub fn cseed48(__seed16v: *mut ::std::os::raw::c_ushort) -> *mut ::std::os::raw::c_ushort;
+}
+extern "C" {
+    #[link_name = "\u{1}lcong48"]
+    pub fn clcong48(__param: *mut ::std::os::raw::c_ushort);
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cdrand48_data {
+    pub __x: [::std::os::raw::c_ushort; 3usize],
+    pub __old_x: [::std::os::raw::c_ushort; 3usize],
+    pub __c: ::std::os::raw::c_ushort,
+    pub __init: ::std::os::raw::c_ushort,
+    pub __a: ::std::os::raw::c_ulonglong,
+}
+#[test]
+fn bindgen_test_layout_cdrand48_data() {
+    assert_eq!(
+        ::std::mem::size_of::<cdrand48_data>(),
+        24usize,
+        concat!("Size of: ", stringify!(cdrand48_data))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cdrand48_data>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cdrand48_data))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__x as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cdrand48_data),
+            "::",
+            stringify!(__x)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__old_x as *const _ as usize },
+        6usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cdrand48_data),
+            "::",
+            stringify!(__old_x)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__c as *const _ as usize },
+        12usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cdrand48_data),
+            "::",
+            stringify!(__c)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__init as *const _ as usize },
+        14usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cdrand48_data),
+            "::",
+            stringify!(__init)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cdrand48_data>())).__a as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cdrand48_data),
+            "::",
+            stringify!(__a)
+        )
+    );
+}
+extern "C" {
+    #[link_name = "\u{1}drand48_r"]
+    pub fn cdrand48_r(__buffer: *mut cdrand48_data, __result: *mut f64) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}erand48_r"]
+    pub fn cerand48_r(
+        __xsubi: *mut ::std::os::raw::c_ushort,
+        __buffer: *mut cdrand48_data,
+        __result: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}lrand48_r"]
+    pub fn clrand48_r(
+        __buffer: *mut cdrand48_data,
+        __result: *mut ::std::os::raw::c_long,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}nrand48_r"]
+    pub fn cnrand48_r(
+        __xsubi: *mut ::std::os::raw::c_ushort,
+        __buffer: *mut cdrand48_data,
+        __result: *mut ::std::os::raw::c_long,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}mrand48_r"]
+    pub fn cmrand48_r(
+        __buffer: *mut cdrand48_data,
+        __result: *mut ::std::os::raw::c_long,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}jrand48_r"]
+    pub fn cjrand48_r(
+        __xsubi: *mut ::std::os::raw::c_ushort,
+        __buffer: *mut cdrand48_data,
+        __result: *mut ::std::os::raw::c_long,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}srand48_r"]
+    pub fn csrand48_r(
+        __seedval: ::std::os::raw::c_long,
+        __buffer: *mut cdrand48_data,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}seed48_r"]
+    pub fn cseed48_r(
+        __seed16v: *mut ::std::os::raw::c_ushort,
+        __buffer: *mut cdrand48_data,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}lcong48_r"]
+    pub fn clcong48_r(
+        __param: *mut ::std::os::raw::c_ushort,
+        __buffer: *mut cdrand48_data,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}malloc"]
+    pub fn cmalloc(__size: ::std::os::raw::c_ulong) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}calloc"]
+    pub fn ccalloc(
+        __nmemb: ::std::os::raw::c_ulong,
+        __size: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}realloc"]
+    pub fn crealloc(
+        __ptr: *mut ::std::os::raw::c_void,
+        __size: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}reallocarray"]
+    pub fn creallocarray(
+        __ptr: *mut ::std::os::raw::c_void,
+        __nmemb: csize_t,
+        __size: csize_t,
+    ) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}free"]
+    pub fn cfree(__ptr: *mut ::std::os::raw::c_void);
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_Dims2D {
+    pub width: u16,
+    pub height: u16,
+}
+#[test]
+fn bindgen_test_layout_cbw_Dims2D() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_Dims2D>(),
+        4usize,
+        concat!("Size of: ", stringify!(cbw_Dims2D))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_Dims2D>(),
+        2usize,
+        concat!("Alignment of ", stringify!(cbw_Dims2D))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Dims2D>())).width as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Dims2D),
+            "::",
+            stringify!(width)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Dims2D>())).height as *const _ as usize },
+        2usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Dims2D),
+            "::",
+            stringify!(height)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_Pos2D {
+    pub x: u16,
+    pub y: u16,
+}
+#[test]
+fn bindgen_test_layout_cbw_Pos2D() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_Pos2D>(),
+        4usize,
+        concat!("Size of: ", stringify!(cbw_Pos2D))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_Pos2D>(),
+        2usize,
+        concat!("Alignment of ", stringify!(cbw_Pos2D))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Pos2D>())).x as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Pos2D),
+            "::",
+            stringify!(x)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Pos2D>())).y as *const _ as usize },
+        2usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Pos2D),
+            "::",
+            stringify!(y)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_WindowImpl {}
+#[test]
+fn bindgen_test_layout_cbw_WindowImpl() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_WindowImpl>(),
+        0usize,
+        concat!("Size of: ", stringify!(cbw_WindowImpl))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_WindowImpl>(),
+        1usize,
+        concat!("Alignment of ", stringify!(cbw_WindowImpl))
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_WindowCallbacks {
+    #[doc = " Fired just before the window gets destroyed and freed from memory."]
+    #[doc = " Should be implemented to free the user data provided to the window."]
+    pub do_cleanup: ::std::option::Option<unsafe extern "C" fn(arg1: *mut cbw_Window)>,
+    #[doc = " Fired when the window has been closed, either by the user or programmatically."]
+    pub on_close: ::std::option::Option<unsafe extern "C" fn(arg1: *const cbw_Window)>,
+    #[doc = " Fired when a window has finished loading"]
+    pub on_loaded: ::std::option::Option<unsafe extern "C" fn(arg1: *const cbw_Window)>,
+    #[doc = " Fired when a window is resizing"]
+    pub on_resize: ::std::option::Option<
+        unsafe extern "C" fn(
+            arg1: *const cbw_Window,
+            width: ::std::os::raw::c_uint,
+            height: ::std::os::raw::c_uint,
+        ),
+    >,
+    #[doc = " Fired when the window becomes visible, occluded or hidden, but only for the changes that its throttling policy cares about."]
+    pub on_visibility_change:
+        ::std::option::Option<unsafe extern "C" fn(arg1: *const cbw_Window, visibility: u8)>,
+}
+#[test]
+fn bindgen_test_layout_cbw_WindowCallbacks() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_WindowCallbacks>(),
+        40usize,
+        concat!("Size of: ", stringify!(cbw_WindowCallbacks))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_WindowCallbacks>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_WindowCallbacks))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).do_cleanup as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowCallbacks),
+            "::",
+            stringify!(do_cleanup)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).on_close as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowCallbacks),
+            "::",
+            stringify!(on_close)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).on_loaded as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowCallbacks),
+            "::",
+            stringify!(on_loaded)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).on_resize as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowCallbacks),
+            "::",
+            stringify!(on_resize)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_WindowCallbacks>())).on_visibility_change as *const _
+                as usize
+        },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowCallbacks),
+            "::",
+            stringify!(on_visibility_change)
+        )
+    );
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_WindowOptions {
+    pub borders: bool,
+    pub minimizable: bool,
+    pub resizable: bool,
+    #[doc = " One of the `BW_WINDOW_THROTTLE_*` policies."]
+    pub throttling: u8,
+}
+#[test]
+fn bindgen_test_layout_cbw_WindowOptions() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_WindowOptions>(),
+        4usize,
+        concat!("Size of: ", stringify!(cbw_WindowOptions))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_WindowOptions>(),
+        1usize,
+        concat!("Alignment of ", stringify!(cbw_WindowOptions))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowOptions>())).borders as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowOptions),
+            "::",
+            stringify!(borders)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowOptions>())).minimizable as *const _ as usize },
+        1usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowOptions),
+            "::",
+            stringify!(minimizable)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowOptions>())).resizable as *const _ as usize },
+        2usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowOptions),
+            "::",
+            stringify!(resizable)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_WindowOptions>())).throttling as *const _ as usize },
+        3usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_WindowOptions),
+            "::",
+            stringify!(throttling)
+        )
+    );
+}
+pub type cbw_WindowDispatchFn = ::std::option::Option<
+    unsafe extern "C" fn(window: *mut cbw_Window, data: *mut ::std::os::raw::c_void),
+>;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_WindowDispatchData {
+    _unused: [u8; 0],
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_Window {
+    pub app: *mut cbw_Application,
+    pub parent: *const cbw_Window,
+    pub closed: bool,
+    pub dropped: bool,
+    pub minimized: bool,
+    pub occluded: bool,
+    pub throttling: u8,
+    pub visibility: u8,
+    pub callbacks: cbw_WindowCallbacks,
+    pub user_data: *mut ::std::os::raw::c_void,
+    pub impl_: cbw_WindowImpl,
+}
+#[test]
+fn bindgen_test_layout_cbw_Window() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_Window>(),
+        72usize,
+        concat!("Size of: ", stringify!(cbw_Window))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_Window>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_Window))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).app as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(app)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).parent as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(parent)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).closed as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(closed)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).dropped as *const _ as usize },
+        17usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(dropped)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).minimized as *const _ as usize },
+        18usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(minimized)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).occluded as *const _ as usize },
+        19usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(occluded)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).throttling as *const _ as usize },
+        20usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(throttling)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).visibility as *const _ as usize },
+        21usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(visibility)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).callbacks as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(callbacks)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).user_data as *const _ as usize },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(user_data)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_Window>())).impl_ as *const _ as usize },
+        72usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_Window),
+            "::",
+            stringify!(impl_)
+        )
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}strcasecmp_l"]
-    pub fn cstrcasecmp_l(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-        __loc: clocale_t,
-    ) -> ::std::os::raw::c_int;
+    #[doc = " Destroy the window, releasing all resources it holds."]
+    #[doc = " After this call, the handle is considered invalid."]
+    #[link_name = "\u{1}bw_Window_destroy"]
+    pub fn cbw_Window_destroy(window: *mut cbw_Window);
+}
+extern "C" {
+    #[doc = " Invalidates the window handle."]
+    #[doc = " The window will get destroyed when it is deemed possible."]
+    #[link_name = "\u{1}bw_Window_drop"]
+    pub fn cbw_Window_drop(window: *mut cbw_Window);
+}
+extern "C" {
+    #[doc = " Gets the width and height of the usable area inside the window."]
+    #[link_name = "\u{1}bw_Window_getContentDimensions"]
+    pub fn cbw_Window_getContentDimensions(window: *mut cbw_Window) -> cbw_Dims2D;
+}
+extern "C" {
+    #[doc = " Gets the opacity of the window as a value from 0 to 255."]
+    #[link_name = "\u{1}bw_Window_getOpacity"]
+    pub fn cbw_Window_getOpacity(window: *mut cbw_Window) -> u8;
+}
+extern "C" {
+    #[doc = " Gets the X and Y coordinates of the window position relative to the desktop screen."]
+    #[link_name = "\u{1}bw_Window_getPosition"]
+    pub fn cbw_Window_getPosition(window: *mut cbw_Window) -> cbw_Pos2D;
+}
+extern "C" {
+    #[doc = " Copies as many bytes into `title` that fit in there."]
+    #[doc = " Returns the number of characters the title actually has."]
+    #[link_name = "\u{1}bw_Window_getTitle"]
+    pub fn cbw_Window_getTitle(
+        window: *mut cbw_Window,
+        title: *mut *mut ::std::os::raw::c_char,
+    ) -> csize_t;
+}
+extern "C" {
+    #[doc = " Gets the width and height of the window including the title bar and borders."]
+    #[link_name = "\u{1}bw_Window_getWindowDimensions"]
+    pub fn cbw_Window_getWindowDimensions(window: *mut cbw_Window) -> cbw_Dims2D;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Window_hide"]
+    pub fn cbw_Window_hide(window: *mut cbw_Window);
+}
+extern "C" {
+    #[doc = " Returns whether or not the window is not hidden."]
+    #[doc = " `bw_Window_show` and `bw_Window_hide` change the visibility."]
+    #[link_name = "\u{1}bw_Window_isVisible"]
+    pub fn cbw_Window_isVisible(window: *const cbw_Window) -> bool;
+}
+extern "C" {
+    #[doc = " Creates a new (empty) window"]
+    #[doc = " The returned pointer is a handler for the window."]
+    #[doc = " bw_Window_drop needs to be called on it after it is done being used,"]
+    #[doc = "     otherwise the window is never actually destroyed and memory leakes happen."]
+    #[link_name = "\u{1}bw_Window_new"]
+    pub fn cbw_Window_new(
+        app: *mut cbw_Application,
+        parent: *const cbw_Window,
+        _title: cbw_CStrSlice,
+        width: ::std::os::raw::c_int,
+        height: ::std::os::raw::c_int,
+        options: *const cbw_WindowOptions,
+        user_data: *mut ::std::os::raw::c_void,
+    ) -> *mut cbw_Window;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Window_setContentDimensions"]
+    pub fn cbw_Window_setContentDimensions(window: *mut cbw_Window, dimensions: cbw_Dims2D);
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Window_setOpacity"]
+    pub fn cbw_Window_setOpacity(window: *mut cbw_Window, opacity: u8);
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Window_setPosition"]
+    pub fn cbw_Window_setPosition(window: *mut cbw_Window, position: cbw_Pos2D);
+}
+extern "C" {
+    #[doc = " Applies the given title;"]
+    #[link_name = "\u{1}bw_Window_setTitle"]
+    pub fn cbw_Window_setTitle(window: *mut cbw_Window, title: cbw_CStrSlice);
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Window_setWindowDimensions"]
+    pub fn cbw_Window_setWindowDimensions(window: *mut cbw_Window, dimensions: cbw_Dims2D);
+}
+extern "C" {
+    #[doc = " Shows the window if it was previously hidden"]
+    #[doc = " Is generally called after window creation."]
+    #[link_name = "\u{1}bw_Window_show"]
+    pub fn cbw_Window_show(window: *mut cbw_Window);
+}
+extern "C" {
+    #[link_name = "\u{1}bw_Window_triggerClose"]
+    pub fn cbw_Window_triggerClose(window: *mut cbw_Window);
+}
+extern "C" {
+    #[link_name = "\u{1}_bw_Window_onResize"]
+    pub fn c_bw_Window_onResize(
+        window: *const cbw_Window,
+        width: ::std::os::raw::c_uint,
+        height: ::std::os::raw::c_uint,
+    );
+}
+extern "C" {
+    #[doc = " Should be called by the window implementations when the window gets minimized or restored."]
+    #[link_name = "\u{1}_bw_Window_setMinimized"]
+    pub fn c_bw_Window_setMinimized(window: *mut cbw_Window, minimized: bool);
+}
+extern "C" {
+    #[doc = " Should be called by the window implementations when the window gets completely covered or uncovered by other windows."]
+    #[link_name = "\u{1}_bw_Window_setOccluded"]
+    pub fn c_bw_Window_setOccluded(window: *mut cbw_Window, occluded: bool);
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowQueue {
+    _unused: [u8; 0],
+}
+#[doc = " Identifies a browser window for as long as it exists, and never refers to any browser window after it has been destroyed."]
+#[doc = " Anything that is handled some time after it has been received, refers to its browser window by this id instead of by pointer."]
+pub type cbw_BrowserWindowId = cbw_SlabHandle;
+pub type cbw_BrowserWindowCreationCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(window: *mut cbw_BrowserWindow, data: *mut ::std::os::raw::c_void),
+>;
+#[doc = " Receives the browser windows created by `bw_BrowserWindow_newMany`, in the order of their specs."]
+#[doc = " The `windows` array is only valid during the invocation of the callback."]
+pub type cbw_BrowserWindowManyCreationCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        windows: *mut *mut cbw_BrowserWindow,
+        count: csize_t,
+        data: *mut ::std::os::raw::c_void,
+    ),
+>;
+pub type cbw_BrowserWindowHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        cmd: cbw_CStrSlice,
+        args: *mut cbw_CStrSlice,
+        arg_count: csize_t,
+    ),
+>;
+pub type cbw_BrowserWindowJsCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        result: *const ::std::os::raw::c_char,
+        err: *const cbw_Err,
+    ),
+>;
+#[doc = " Like `bw_BrowserWindowHandlerFn`, but receives the arguments as structured values."]
+#[doc = " The `args` values are only valid during the invocation of the handler."]
+pub type cbw_BrowserWindowStructuredHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        cmd: cbw_CStrSlice,
+        args: *const cbw_JsValue,
+        arg_count: csize_t,
+    ),
+>;
+#[doc = " Receives the data given to `invoke_extern_binary`, which is only valid during the invocation of the handler."]
+#[doc = " CEF 87 gives the renderer no access to the contents of an `ArrayBuffer`, so the page's bytes are read out as javascript strings of one character per byte."]
+#[doc = " Those take two bytes per byte in the renderer until they are narrowed back into bytes there; only the message to the application carries the bytes as they are."]
+pub type cbw_BrowserWindowBinaryHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        cmd: cbw_CStrSlice,
+        data: *const u8,
+        size: csize_t,
+    ),
+>;
+#[doc = " Receives the bytes that the page has written with `write_extern_stream`, which are only valid during the invocation of the handler."]
+#[doc = " The bytes leave the page in the same way as those of `invoke_extern_binary`, see `bw_BrowserWindowBinaryHandlerFn`."]
+pub type cbw_BrowserWindowStreamHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        data: *const u8,
+        size: csize_t,
+    ),
+>;
+#[doc = " What happens to a call of `invoke_extern` when the queue of calls that are waiting for the GUI thread is full."]
+pub type cbw_BrowserWindowInvokeOverflow = ::std::os::raw::c_uchar;
+#[doc = " One call of `invoke_extern`, as it is given to a `bw_BrowserWindowBatchHandlerFn`."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowInvocation {
+    pub cmd: cbw_CStrSlice,
+    pub args: *const cbw_CStrSlice,
+    pub arg_count: csize_t,
+}
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowInvocation() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowInvocation>(),
+        32usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowInvocation))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowInvocation>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowInvocation))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowInvocation>())).cmd as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowInvocation),
+            "::",
+            stringify!(cmd)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowInvocation>())).args as *const _ as usize
+        },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowInvocation),
+            "::",
+            stringify!(args)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowInvocation>())).arg_count as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowInvocation),
+            "::",
+            stringify!(arg_count)
+        )
+    );
+}
+#[doc = " Receives the calls of `invoke_extern` that the page has made during one task, in the order in which they were made."]
+#[doc = " The `calls` are only valid during the invocation of the handler."]
+pub type cbw_BrowserWindowBatchHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        calls: *const cbw_BrowserWindowInvocation,
+        call_count: csize_t,
+    ),
+>;
+#[doc = " Receives the calls of `invoke_native`, of which the promise is settled by `bw_BrowserWindow_replyToInvocation` with the same `request_id`."]
+#[doc = " The `args` strings are only valid during the invocation of the handler."]
+pub type cbw_BrowserWindowNativeHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        cmd: cbw_CStrSlice,
+        args: *mut cbw_CStrSlice,
+        arg_count: csize_t,
+        request_id: ::std::os::raw::c_uint,
+    ),
+>;
+#[doc = " Receives the calls of `invoke_extern` on one of the threads of the worker pool, instead of on the GUI thread."]
+#[doc = " Calls of the same browser window may be handled at the same time on different threads, and so may finish out of order."]
+#[doc = " The browser window can be closed on the GUI thread while the handler runs, so `window` should only be used to take its id right away, and be looked up again with `bw_Application_findBrowserWindow` whenever it is needed."]
+#[doc = " The `args` strings are only valid during the invocation of the handler."]
+pub type cbw_BrowserWindowThreadedHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        cmd: cbw_CStrSlice,
+        args: *const cbw_CStrSlice,
+        arg_count: csize_t,
+    ),
+>;
+#[doc = " Receives the calls of `invoke_extern` of a command that has been registered with `bw_BrowserWindow_registerCommand`, on the GUI thread."]
+#[doc = " The `args` strings are only valid during the invocation of the handler."]
+pub type cbw_BrowserWindowCommandHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        command_id: ::std::os::raw::c_uint,
+        args: *const cbw_CStrSlice,
+        arg_count: csize_t,
+    ),
+>;
+#[doc = " The `result` value is only valid during the invocation of the callback."]
+pub type cbw_BrowserWindowJsStructuredCallbackFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        result: *const cbw_JsValue,
+        err: *const cbw_Err,
+    ),
+>;
+#[doc = " What has happened to the page of a browser window, as it is given to a `bw_BrowserWindowEventHandlerFn`."]
+pub type cbw_BrowserWindowEventKind = ::std::os::raw::c_uchar;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowEvent {
+    pub kind: cbw_BrowserWindowEventKind,
+    pub text: cbw_CStrSlice,
+    pub http_status: ::std::os::raw::c_int,
+    pub progress: f64,
+}
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowEvent() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowEvent>(),
+        40usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowEvent))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowEvent>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowEvent))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowEvent>())).kind as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowEvent),
+            "::",
+            stringify!(kind)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowEvent>())).text as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowEvent),
+            "::",
+            stringify!(text)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowEvent>())).http_status as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowEvent),
+            "::",
+            stringify!(http_status)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowEvent>())).progress as *const _ as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowEvent),
+            "::",
+            stringify!(progress)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}strncasecmp_l"]
-    pub fn cstrncasecmp_l(
-        __s1: *const ::std::os::raw::c_char,
-        __s2: *const ::std::os::raw::c_char,
-        __n: csize_t,
-        __loc: clocale_t,
-    ) -> ::std::os::raw::c_int;
+#[doc = " Receives the events of the page of a browser window, on the GUI thread."]
+#[doc = " The `event` is only valid during the invocation of the handler."]
+pub type cbw_BrowserWindowEventHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        event: *const cbw_BrowserWindowEvent,
+    ),
+>;
+#[doc = " Decides whether a browser window receives the payload given to `bw_Application_broadcast`."]
+pub type cbw_ApplicationBroadcastFilterFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+    ) -> cBOOL,
+>;
+#[doc = " A request made by the page, as it is given to a `bw_BrowserWindowRequestHandlerFn`."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowRequest {
+    pub method: cbw_CStrSlice,
+    pub url: cbw_CStrSlice,
+    #[doc = " All request headers, as lines of the form `Name: value`, seperated by newlines."]
+    pub headers: cbw_CStrSlice,
 }
-extern "C" {
-    #[link_name = "\u{1}explicit_bzero"]
-    pub fn cexplicit_bzero(__s: *mut ::std::os::raw::c_void, __n: csize_t);
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowRequest() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowRequest>(),
+        48usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowRequest))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowRequest>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowRequest))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowRequest>())).method as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowRequest),
+            "::",
+            stringify!(method)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowRequest>())).url as *const _ as usize },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowRequest),
+            "::",
+            stringify!(url)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRequest>())).headers as *const _ as usize
+        },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowRequest),
+            "::",
+            stringify!(headers)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}strsep"]
-    pub fn cstrsep(
-        __stringp: *mut *mut ::std::os::raw::c_char,
-        __delim: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
+#[doc = " The response that a `bw_BrowserWindowRequestHandlerFn` answers a request with."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowResponse {
+    pub status: ::std::os::raw::c_uint,
+    #[doc = " If empty, it is derived from the extension of the url."]
+    pub mime_type: cbw_CStrSlice,
+    #[doc = " The body, which is not copied."]
+    #[doc = " `free_fn` is invoked with `free_data` once it isn't used anymore, possibly on another thread."]
+    pub data: *const ::std::os::raw::c_void,
+    pub size: csize_t,
+    pub free_fn: cbw_ResourceFreeFn,
+    pub free_data: *mut ::std::os::raw::c_void,
+    #[doc = " Whether the response can be stored in the response cache, and be used for later requests with the same url and key headers."]
+    pub cacheable: cBOOL,
 }
-extern "C" {
-    #[link_name = "\u{1}strsignal"]
-    pub fn cstrsignal(__sig: ::std::os::raw::c_int) -> *mut ::std::os::raw::c_char;
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowResponse() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowResponse>(),
+        64usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowResponse))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowResponse>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowResponse))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowResponse>())).status as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowResponse),
+            "::",
+            stringify!(status)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowResponse>())).mime_type as *const _ as usize
+        },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowResponse),
+            "::",
+            stringify!(mime_type)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowResponse>())).data as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowResponse),
+            "::",
+            stringify!(data)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowResponse>())).size as *const _ as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowResponse),
+            "::",
+            stringify!(size)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowResponse>())).free_fn as *const _ as usize
+        },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowResponse),
+            "::",
+            stringify!(free_fn)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowResponse>())).free_data as *const _ as usize
+        },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowResponse),
+            "::",
+            stringify!(free_data)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowResponse>())).cacheable as *const _ as usize
+        },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowResponse),
+            "::",
+            stringify!(cacheable)
+        )
+    );
+}
+#[doc = " Answers a request from native code, by filling in `response` and returning true."]
+#[doc = " Returning false lets the request go to the network like usual."]
+#[doc = " This handler is invoked on the browser engine's IO thread, not on the GUI thread."]
+pub type cbw_BrowserWindowRequestHandlerFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        request: *const cbw_BrowserWindowRequest,
+        response: *mut cbw_BrowserWindowResponse,
+    ) -> cBOOL,
+>;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowInterceptOptions {
+    #[doc = " Only the requests of which the url starts with this are intercepted."]
+    pub url_prefix: cbw_CStrSlice,
+    #[doc = " The maximum number of bytes that the cached responses can take up together, or 0 to disable the response cache."]
+    #[doc = " The least recently used responses are evicted first."]
+    pub cache_budget: csize_t,
+    #[doc = " The names of the request headers that are part of the cache key, besides the url, separated by commas."]
+    pub cache_key_headers: cbw_CStrSlice,
+}
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowInterceptOptions() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowInterceptOptions>(),
+        40usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowInterceptOptions))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowInterceptOptions>(),
+        8usize,
+        concat!(
+            "Alignment of ",
+            stringify!(cbw_BrowserWindowInterceptOptions)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowInterceptOptions>())).url_prefix as *const _
+                as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowInterceptOptions),
+            "::",
+            stringify!(url_prefix)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowInterceptOptions>())).cache_budget as *const _
+                as usize
+        },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowInterceptOptions),
+            "::",
+            stringify!(cache_budget)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowInterceptOptions>())).cache_key_headers
+                as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowInterceptOptions),
+            "::",
+            stringify!(cache_key_headers)
+        )
+    );
+}
+#[doc = " An area of the view of a windowless browser window, in pixels."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowRect {
+    pub x: ::std::os::raw::c_int,
+    pub y: ::std::os::raw::c_int,
+    pub width: ::std::os::raw::c_int,
+    pub height: ::std::os::raw::c_int,
+}
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowRect() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowRect>(),
+        16usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowRect))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowRect>(),
+        4usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowRect))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowRect>())).x as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowRect),
+            "::",
+            stringify!(x)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowRect>())).y as *const _ as usize },
+        4usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowRect),
+            "::",
+            stringify!(y)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowRect>())).width as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowRect),
+            "::",
+            stringify!(width)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowRect>())).height as *const _ as usize },
+        12usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowRect),
+            "::",
+            stringify!(height)
+        )
+    );
+}
+#[doc = " A frame that a windowless browser window has painted into memory."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowFrame {
+    #[doc = " The pixels of the whole view, in BGRA order, with rows of `width * 4` bytes."]
+    #[doc = " Only valid during the invocation of the paint handler."]
+    pub buffer: *const ::std::os::raw::c_void,
+    pub width: ::std::os::raw::c_int,
+    pub height: ::std::os::raw::c_int,
+    #[doc = " The areas that have changed since the previous frame, so that only those need to be uploaded."]
+    pub dirty_rects: *const cbw_BrowserWindowRect,
+    pub dirty_rect_count: csize_t,
+    #[doc = " Whether this is a frame of a popup widget, like the list of a `<select>` element, instead of a frame of the view."]
+    pub is_popup: cBOOL,
+}
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowFrame() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowFrame>(),
+        40usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowFrame))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowFrame>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowFrame))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowFrame>())).buffer as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowFrame),
+            "::",
+            stringify!(buffer)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowFrame>())).width as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowFrame),
+            "::",
+            stringify!(width)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowFrame>())).height as *const _ as usize },
+        12usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowFrame),
+            "::",
+            stringify!(height)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowFrame>())).dirty_rects as *const _ as usize
+        },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowFrame),
+            "::",
+            stringify!(dirty_rects)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowFrame>())).dirty_rect_count as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowFrame),
+            "::",
+            stringify!(dirty_rect_count)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowFrame>())).is_popup as *const _ as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowFrame),
+            "::",
+            stringify!(is_popup)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}__stpcpy"]
-    pub fn c__stpcpy(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
+#[doc = " A frame that a windowless browser window has painted into a texture on the GPU, which can be opened by another graphics device without reading it back."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowSharedFrame {
+    #[doc = " On Windows, the shared handle of a D3D11 texture. On macOS, an `IOSurfaceRef`."]
+    #[doc = " Only valid during the invocation of the paint handler."]
+    pub shared_handle: *mut ::std::os::raw::c_void,
+    pub dirty_rects: *const cbw_BrowserWindowRect,
+    pub dirty_rect_count: csize_t,
+    pub is_popup: cBOOL,
 }
-extern "C" {
-    #[link_name = "\u{1}stpcpy"]
-    pub fn cstpcpy(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-    ) -> *mut ::std::os::raw::c_char;
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowSharedFrame() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowSharedFrame>(),
+        32usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowSharedFrame))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowSharedFrame>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowSharedFrame))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowSharedFrame>())).shared_handle as *const _
+                as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSharedFrame),
+            "::",
+            stringify!(shared_handle)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowSharedFrame>())).dirty_rects as *const _
+                as usize
+        },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSharedFrame),
+            "::",
+            stringify!(dirty_rects)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowSharedFrame>())).dirty_rect_count as *const _
+                as usize
+        },
+        16usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSharedFrame),
+            "::",
+            stringify!(dirty_rect_count)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowSharedFrame>())).is_popup as *const _ as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSharedFrame),
+            "::",
+            stringify!(is_popup)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}__stpncpy"]
-    pub fn c__stpncpy(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-        __n: csize_t,
-    ) -> *mut ::std::os::raw::c_char;
+#[doc = " Receives the frames of a windowless browser window."]
+#[doc = " This handler is invoked on the browser engine's UI thread, which is not the GUI thread on Windows."]
+pub type cbw_BrowserWindowPaintFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        frame: *const cbw_BrowserWindowFrame,
+    ),
+>;
+#[doc = " Receives the frames of a windowless browser window that shares its textures, on the same thread as `bw_BrowserWindowPaintFn`."]
+pub type cbw_BrowserWindowSharedPaintFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        frame: *const cbw_BrowserWindowSharedFrame,
+    ),
+>;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowOptions {
+    pub dev_tools: cBOOL,
+    pub resource_path: cbw_CStrSlice,
+    #[doc = " If set, the arguments given to `invoke_extern` are passed to this handler as structured values, instead of to the regular handler as strings."]
+    pub structured_handler: cbw_BrowserWindowStructuredHandlerFn,
+    #[doc = " The handler that receives the binary data given to `invoke_extern_binary` in javascript."]
+    pub binary_handler: cbw_BrowserWindowBinaryHandlerFn,
+    #[doc = " The handler that receives the calls of `invoke_native` in javascript."]
+    #[doc = " If not set, the promises that `invoke_native` returns are rejected right away."]
+    pub native_handler: cbw_BrowserWindowNativeHandlerFn,
+    #[doc = " If set, the calls of `invoke_extern` are collected by the renderer process until the task that made them has finished."]
+    #[doc = " They are then sent in one message, and passed to this handler all at once instead of to the regular handler."]
+    #[doc = " This is not used when there is a structured handler."]
+    pub batch_handler: cbw_BrowserWindowBatchHandlerFn,
+    #[doc = " If set, the calls of `invoke_extern` are passed to this handler on the worker pool, instead of to the regular handler on the GUI thread."]
+    #[doc = " This is not used when there is a structured or batch handler."]
+    #[doc = " `free_threaded_handler_data` is invoked with `threaded_handler_data` once the browser window is gone and the last call has been handled."]
+    pub threaded_handler: cbw_BrowserWindowThreadedHandlerFn,
+    pub threaded_handler_data: *mut ::std::os::raw::c_void,
+    pub free_threaded_handler_data: cbw_ResourceFreeFn,
+    #[doc = " The request context to browse in, or null for the global one that is shared with all other browser windows."]
+    #[doc = " The browser window keeps the request context alive, so it can be freed right after the browser window has been created."]
+    pub request_context: *const cbw_RequestContext,
+    #[doc = " If set, the browser window isn't shown in its window, but renders its frames off-screen into the paint handlers instead."]
+    #[doc = " This requires `windowless_rendering` to be enabled in the application settings."]
+    pub windowless: cBOOL,
+    #[doc = " The maximum number of frames per second that a windowless browser window paints, or 0 for the default of 60."]
+    pub windowless_frame_rate: ::std::os::raw::c_uint,
+    #[doc = " Lets a windowless browser window paint into shared textures, which are given to the shared paint handler instead of the paint handler."]
+    pub shared_textures: cBOOL,
+    #[doc = " Keeps a windowless browser window rendering, while its window isn't shown."]
+    #[doc = " Otherwise, it stops painting as long as its window is hidden, like any other browser window."]
+    #[doc = " This is meant for browser windows that only render pages into memory, of which the window is never shown at all."]
+    pub headless: cBOOL,
 }
-extern "C" {
-    #[link_name = "\u{1}stpncpy"]
-    pub fn cstpncpy(
-        __dest: *mut ::std::os::raw::c_char,
-        __src: *const ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_ulong,
-    ) -> *mut ::std::os::raw::c_char;
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindowOptions() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_BrowserWindowOptions>(),
+        104usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowOptions))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindowOptions>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowOptions))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).dev_tools as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(dev_tools)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).resource_path as *const _ as usize
+        },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(resource_path)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).structured_handler as *const _
+                as usize
+        },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(structured_handler)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).binary_handler as *const _ as usize
+        },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(binary_handler)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).native_handler as *const _ as usize
+        },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(native_handler)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).batch_handler as *const _ as usize
+        },
+        48usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(batch_handler)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).threaded_handler as *const _
+                as usize
+        },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(threaded_handler)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).threaded_handler_data as *const _
+                as usize
+        },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(threaded_handler_data)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).free_threaded_handler_data
+                as *const _ as usize
+        },
+        72usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(free_threaded_handler_data)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).request_context as *const _
+                as usize
+        },
+        80usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(request_context)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).windowless as *const _ as usize
+        },
+        88usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(windowless)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).windowless_frame_rate as *const _
+                as usize
+        },
+        92usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(windowless_frame_rate)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).shared_textures as *const _
+                as usize
+        },
+        96usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(shared_textures)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).headless as *const _ as usize
+        },
+        100usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowOptions),
+            "::",
+            stringify!(headless)
+        )
+    );
 }
-pub type cbw_ErrCode = ::std::os::raw::c_uint;
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct cbw_Err {
-    pub code: cbw_ErrCode,
-    pub data: *const ::std::os::raw::c_void,
-    pub alloc_message: ::std::option::Option<
-        unsafe extern "C" fn(
-            code: cbw_ErrCode,
-            data: *const ::std::os::raw::c_void,
-        ) -> *mut ::std::os::raw::c_char,
-    >,
+pub struct cbw_BrowserWindowSource {
+    pub data: cbw_CStrSlice,
+    pub is_html: cBOOL,
 }
 #[test]
-fn bindgen_test_layout_cbw_Err() {
+fn bindgen_test_layout_cbw_BrowserWindowSource() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_Err>(),
+        ::std::mem::size_of::<cbw_BrowserWindowSource>(),
         24usize,
-        concat!("Size of: ", stringify!(cbw_Err))
+        concat!("Size of: ", stringify!(cbw_BrowserWindowSource))
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_Err>(),
+        ::std::mem::align_of::<cbw_BrowserWindowSource>(),
         8usize,
-        concat!("Alignment of ", stringify!(cbw_Err))
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowSource))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Err>())).code as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSource>())).data as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Err),
-            "::",
-            stringify!(code)
-        )
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Err>())).data as *const _ as usize },
-        8usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_Err),
+            stringify!(cbw_BrowserWindowSource),
             "::",
             stringify!(data)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Err>())).alloc_message as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSource>())).is_html as *const _ as usize },
         16usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Err),
+            stringify!(cbw_BrowserWindowSource),
             "::",
-            stringify!(alloc_message)
+            stringify!(is_html)
         )
     );
 }
-extern "C" {
-    #[link_name = "\u{1}bw_Err_msg_success"]
-    pub fn cbw_Err_msg_success(
-        arg1: cbw_ErrCode,
-        arg2: *const ::std::os::raw::c_void,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}bw_Err_msg_string"]
-    pub fn cbw_Err_msg_string(
-        arg1: cbw_ErrCode,
-        arg2: *const ::std::os::raw::c_void,
-    ) -> *mut ::std::os::raw::c_char;
-}
-extern "C" {
-    #[link_name = "\u{1}bw_Err_free"]
-    pub fn cbw_Err_free(err: *mut cbw_Err);
-}
-extern "C" {
-    #[link_name = "\u{1}bw_Err_new_with_msg"]
-    pub fn cbw_Err_new_with_msg(code: cbw_ErrCode, msg: *const ::std::os::raw::c_char) -> cbw_Err;
-}
-extern "C" {
-    #[link_name = "\u{1}bw_Err_message"]
-    pub fn cbw_Err_message(error: *const cbw_Err) -> *mut ::std::os::raw::c_char;
-}
-pub type cint_least8_t = c__int_least8_t;
-pub type cint_least16_t = c__int_least16_t;
-pub type cint_least32_t = c__int_least32_t;
-pub type cint_least64_t = c__int_least64_t;
-pub type cuint_least8_t = c__uint_least8_t;
-pub type cuint_least16_t = c__uint_least16_t;
-pub type cuint_least32_t = c__uint_least32_t;
-pub type cuint_least64_t = c__uint_least64_t;
-pub type cint_fast8_t = ::std::os::raw::c_schar;
-pub type cint_fast16_t = ::std::os::raw::c_long;
-pub type cint_fast32_t = ::std::os::raw::c_long;
-pub type cint_fast64_t = ::std::os::raw::c_long;
-pub type cuint_fast8_t = ::std::os::raw::c_uchar;
-pub type cuint_fast16_t = ::std::os::raw::c_ulong;
-pub type cuint_fast32_t = ::std::os::raw::c_ulong;
-pub type cuint_fast64_t = ::std::os::raw::c_ulong;
-pub type cintmax_t = c__intmax_t;
-pub type cuintmax_t = c__uintmax_t;
+#[doc = " The arguments of `bw_BrowserWindow_new` for one of the browser windows created by `bw_BrowserWindow_newMany`."]
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct cbw_Application {
-    pub windows_alive: ::std::os::raw::c_uint,
-    pub is_running: cBOOL,
-    pub is_done: cBOOL,
-    pub impl_: cbw_ApplicationImpl,
-    pub engine_impl: cbw_ApplicationEngineImpl,
+pub struct cbw_BrowserWindowSpec {
+    pub parent: *const cbw_Window,
+    pub source: cbw_BrowserWindowSource,
+    pub title: cbw_CStrSlice,
+    pub width: ::std::os::raw::c_int,
+    pub height: ::std::os::raw::c_int,
+    pub window_options: *const cbw_WindowOptions,
+    pub browser_window_options: *const cbw_BrowserWindowOptions,
+    pub handler: cbw_BrowserWindowHandlerFn,
+    pub user_data: *mut ::std::os::raw::c_void,
+    #[doc = " If set, is invoked as soon as this browser window has been created, before the callback for all of them."]
+    pub callback: cbw_BrowserWindowCreationCallbackFn,
+    pub callback_data: *mut ::std::os::raw::c_void,
 }
 #[test]
-fn bindgen_test_layout_cbw_Application() {
+fn bindgen_test_layout_cbw_BrowserWindowSpec() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_Application>(),
-        12usize,
-        concat!("Size of: ", stringify!(cbw_Application))
+        ::std::mem::size_of::<cbw_BrowserWindowSpec>(),
+        104usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowSpec))
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_Application>(),
-        4usize,
-        concat!("Alignment of ", stringify!(cbw_Application))
+        ::std::mem::align_of::<cbw_BrowserWindowSpec>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowSpec))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Application>())).windows_alive as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).parent as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Application),
+            stringify!(cbw_BrowserWindowSpec),
             "::",
-            stringify!(windows_alive)
+            stringify!(parent)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Application>())).is_running as *const _ as usize },
-        4usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).source as *const _ as usize },
+        8usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Application),
+            stringify!(cbw_BrowserWindowSpec),
             "::",
-            stringify!(is_running)
+            stringify!(source)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Application>())).is_done as *const _ as usize },
-        8usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).title as *const _ as usize },
+        32usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Application),
+            stringify!(cbw_BrowserWindowSpec),
             "::",
-            stringify!(is_done)
+            stringify!(title)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Application>())).impl_ as *const _ as usize },
-        12usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).width as *const _ as usize },
+        48usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Application),
+            stringify!(cbw_BrowserWindowSpec),
             "::",
-            stringify!(impl_)
+            stringify!(width)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Application>())).engine_impl as *const _ as usize },
-        12usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).height as *const _ as usize },
+        52usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Application),
+            stringify!(cbw_BrowserWindowSpec),
             "::",
-            stringify!(engine_impl)
+            stringify!(height)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).window_options as *const _ as usize
+        },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSpec),
+            "::",
+            stringify!(window_options)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).browser_window_options as *const _
+                as usize
+        },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSpec),
+            "::",
+            stringify!(browser_window_options)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).handler as *const _ as usize },
+        72usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSpec),
+            "::",
+            stringify!(handler)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).user_data as *const _ as usize },
+        80usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSpec),
+            "::",
+            stringify!(user_data)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).callback as *const _ as usize },
+        88usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSpec),
+            "::",
+            stringify!(callback)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowSpec>())).callback_data as *const _ as usize
+        },
+        96usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowSpec),
+            "::",
+            stringify!(callback_data)
         )
     );
 }
+#[doc = " The latencies, in microseconds, and the number of messages and bytes that a browser window exchanged with its renderer process."]
 #[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_ApplicationEngineData {
-    _unused: [u8; 0],
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_ApplicationDispatchData {
-    pub func: cbw_ApplicationDispatchFn,
-    pub data: *mut ::std::os::raw::c_void,
+#[derive(Copy, Clone)]
+pub struct cbw_BrowserWindowMetrics {
+    pub eval_js: cbw_LatencyHistogram,
+    pub eval_js_execution: cbw_LatencyHistogram,
+    pub invoke: cbw_LatencyHistogram,
+    pub messages_sent: u64,
+    pub messages_received: u64,
+    pub bytes_sent: u64,
+    pub bytes_received: u64,
+    pub invocations_dropped: u64,
+    pub invoke_queue_depth: csize_t,
+    pub invoke_queue_peak: csize_t,
 }
 #[test]
-fn bindgen_test_layout_cbw_ApplicationDispatchData() {
+fn bindgen_test_layout_cbw_BrowserWindowMetrics() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_ApplicationDispatchData>(),
-        16usize,
-        concat!("Size of: ", stringify!(cbw_ApplicationDispatchData))
+        ::std::mem::size_of::<cbw_BrowserWindowMetrics>(),
+        6656usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowMetrics))
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_ApplicationDispatchData>(),
+        ::std::mem::align_of::<cbw_BrowserWindowMetrics>(),
         8usize,
-        concat!("Alignment of ", stringify!(cbw_ApplicationDispatchData))
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowMetrics))
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<cbw_ApplicationDispatchData>())).func as *const _ as usize
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).eval_js as *const _ as usize
         },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_ApplicationDispatchData),
+            stringify!(cbw_BrowserWindowMetrics),
             "::",
-            stringify!(func)
+            stringify!(eval_js)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<cbw_ApplicationDispatchData>())).data as *const _ as usize
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).eval_js_execution as *const _
+                as usize
         },
-        8usize,
+        2200usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_ApplicationDispatchData),
+            stringify!(cbw_BrowserWindowMetrics),
             "::",
-            stringify!(data)
+            stringify!(eval_js_execution)
         )
     );
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_ApplicationSettings {
-    pub engine_seperate_executable_path: cbw_CStrSlice,
-    pub resource_dir: cbw_CStrSlice,
-}
-#[test]
-fn bindgen_test_layout_cbw_ApplicationSettings() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_ApplicationSettings>(),
-        32usize,
-        concat!("Size of: ", stringify!(cbw_ApplicationSettings))
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).invoke as *const _ as usize },
+        4400usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowMetrics),
+            "::",
+            stringify!(invoke)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_ApplicationSettings>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_ApplicationSettings))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).messages_sent as *const _ as usize
+        },
+        6600usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowMetrics),
+            "::",
+            stringify!(messages_sent)
+        )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).engine_seperate_executable_path
-                as *const _ as usize
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).messages_received as *const _
+                as usize
         },
-        0usize,
+        6608usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_ApplicationSettings),
+            stringify!(cbw_BrowserWindowMetrics),
             "::",
-            stringify!(engine_seperate_executable_path)
+            stringify!(messages_received)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<cbw_ApplicationSettings>())).resource_dir as *const _ as usize
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).bytes_sent as *const _ as usize
         },
-        16usize,
+        6616usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_ApplicationSettings),
+            stringify!(cbw_BrowserWindowMetrics),
             "::",
-            stringify!(resource_dir)
+            stringify!(bytes_sent)
         )
     );
-}
-extern "C" {
-    #[doc = " Safety check that makes sure the given application handle is used on the correct thread."]
-    #[doc = " Does nothing in release mode."]
-    #[link_name = "\u{1}bw_Application_assertCorrectThread"]
-    pub fn cbw_Application_assertCorrectThread(arg1: *const cbw_Application);
-}
-extern "C" {
-    #[doc = " Exits the main loop, returning execution to the function that invoked the run call."]
-    #[doc = " The exit_code will be returned by bw_Application_run."]
-    #[link_name = "\u{1}bw_Application_exit"]
-    pub fn cbw_Application_exit(app: *mut cbw_Application, exit_code: ::std::os::raw::c_int);
-}
-extern "C" {
-    #[doc = " Same as bw_Application_exit, but guaranteed to be thread-safe"]
-    #[doc = " The exit_code will be returned by bw_Application_run."]
-    #[link_name = "\u{1}bw_Application_exitAsync"]
-    pub fn cbw_Application_exitAsync(app: *mut cbw_Application, exit_code: ::std::os::raw::c_int);
-}
-extern "C" {
-    #[doc = " Dispatches the given function to be executed on the thread this application instance has been created on,"]
-    #[doc = "     and passes the given data to it."]
-    #[doc = " This function is thread safe."]
-    #[doc = ""]
-    #[doc = " # Returns"]
-    #[doc = " An indication of whether or not the function was able to be dispatched."]
-    #[doc = " Dispatching a function fails when the application has already been terminated."]
-    #[link_name = "\u{1}bw_Application_dispatch"]
-    pub fn cbw_Application_dispatch(
-        app: *mut cbw_Application,
-        func: cbw_ApplicationDispatchFn,
-        data: *mut ::std::os::raw::c_void,
-    ) -> cBOOL;
-}
-extern "C" {
-    #[doc = " Shuts down all application processes and performs necessary clean-up code."]
-    #[link_name = "\u{1}bw_Application_finish"]
-    pub fn cbw_Application_finish(app: *mut cbw_Application);
-}
-extern "C" {
-    #[doc = " Frees memory for the application handle."]
-    #[doc = " Call `bw_Application_finish` before you call this function."]
-    #[doc = " Freeing the application handle is generally not necessary, as all memory in use by the process gets released anyway after shutdown."]
-    #[link_name = "\u{1}bw_Application_free"]
-    pub fn cbw_Application_free(app: *mut cbw_Application);
-}
-extern "C" {
-    #[doc = " Initializes browser window."]
-    #[doc = " Starts up browser engine process(es)."]
-    #[doc = " Returns an application handle."]
-    #[link_name = "\u{1}bw_Application_initialize"]
-    pub fn cbw_Application_initialize(
-        application: *mut *mut cbw_Application,
-        argc: ::std::os::raw::c_int,
-        argv: *mut *mut ::std::os::raw::c_char,
-        settings: *const cbw_ApplicationSettings,
-    ) -> cbw_Err;
-}
-extern "C" {
-    #[link_name = "\u{1}bw_Application_isRunning"]
-    pub fn cbw_Application_isRunning(app: *const cbw_Application) -> cBOOL;
-}
-extern "C" {
-    #[link_name = "\u{1}bw_Application_markAsDone"]
-    pub fn cbw_Application_markAsDone(app: *mut cbw_Application);
-}
-extern "C" {
-    #[doc = " Runs the event loop."]
-    #[doc = " Calls the `on_ready` callback when `app` can be used."]
-    #[link_name = "\u{1}bw_Application_run"]
-    pub fn cbw_Application_run(
-        app: *mut cbw_Application,
-        on_ready: cbw_ApplicationReadyFn,
-        user_data: *mut ::std::os::raw::c_void,
-    ) -> ::std::os::raw::c_int;
-}
-extern "C" {
-    #[doc = " Executes the given closure after the specified delay."]
-    #[link_name = "\u{1}bw_Application_dispatchDelayed"]
-    pub fn cbw_Application_dispatchDelayed(
-        app: *mut cbw_Application,
-        func: cbw_ApplicationDispatchFn,
-        user_data: *mut ::std::os::raw::c_void,
-        milliseconds: u64,
-    ) -> cBOOL;
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_BrowserWindowImpl {
-    pub cef_ptr: *mut ::std::os::raw::c_void,
-    pub resource_path: *mut ::std::os::raw::c_char,
-}
-#[test]
-fn bindgen_test_layout_cbw_BrowserWindowImpl() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_BrowserWindowImpl>(),
-        16usize,
-        concat!("Size of: ", stringify!(cbw_BrowserWindowImpl))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).bytes_received as *const _ as usize
+        },
+        6624usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowMetrics),
+            "::",
+            stringify!(bytes_received)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_BrowserWindowImpl>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_BrowserWindowImpl))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).invocations_dropped as *const _
+                as usize
+        },
+        6632usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowMetrics),
+            "::",
+            stringify!(invocations_dropped)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).cef_ptr as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).invoke_queue_depth as *const _
+                as usize
+        },
+        6640usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_BrowserWindowImpl),
+            stringify!(cbw_BrowserWindowMetrics),
             "::",
-            stringify!(cef_ptr)
+            stringify!(invoke_queue_depth)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<cbw_BrowserWindowImpl>())).resource_path as *const _ as usize
+            &(*(::std::ptr::null::<cbw_BrowserWindowMetrics>())).invoke_queue_peak as *const _
+                as usize
         },
-        8usize,
+        6648usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_BrowserWindowImpl),
+            stringify!(cbw_BrowserWindowMetrics),
             "::",
-            stringify!(resource_path)
+            stringify!(invoke_queue_peak)
         )
     );
 }
-extern "C" {
-    #[link_name = "\u{1}__assert_fail"]
-    pub fn c__assert_fail(
-        __assertion: *const ::std::os::raw::c_char,
-        __file: *const ::std::os::raw::c_char,
-        __line: ::std::os::raw::c_uint,
-        __function: *const ::std::os::raw::c_char,
-    );
-}
-extern "C" {
-    #[link_name = "\u{1}__assert_perror_fail"]
-    pub fn c__assert_perror_fail(
-        __errnum: ::std::os::raw::c_int,
-        __file: *const ::std::os::raw::c_char,
-        __line: ::std::os::raw::c_uint,
-        __function: *const ::std::os::raw::c_char,
-    );
-}
-extern "C" {
-    #[link_name = "\u{1}__assert"]
-    pub fn c__assert(
-        __assertion: *const ::std::os::raw::c_char,
-        __file: *const ::std::os::raw::c_char,
-        __line: ::std::os::raw::c_int,
-    );
-}
-pub type cva_list = c__builtin_va_list;
-pub type c__gnuc_va_list = c__builtin_va_list;
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub struct c__mbstate_t {
-    pub __count: ::std::os::raw::c_int,
-    pub __value: c__mbstate_t__bindgen_ty_1,
-}
+#[doc = " The memory that a browser window is using, in bytes."]
 #[repr(C)]
-#[derive(Copy, Clone)]
-pub union c__mbstate_t__bindgen_ty_1 {
-    pub __wch: ::std::os::raw::c_uint,
-    pub __wchb: [::std::os::raw::c_char; 4usize],
-    _bindgen_union_align: u32,
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowMemoryStats {
+    pub pending_calls: csize_t,
+    pub queued_bytes: csize_t,
+    pub cached_response_bytes: csize_t,
+    pub renderer_measured: cBOOL,
+    pub js_heap_used: u64,
+    pub js_heap_total: u64,
+    pub js_heap_limit: u64,
+    pub renderer_private_bytes: u64,
 }
 #[test]
-fn bindgen_test_layout_c__mbstate_t__bindgen_ty_1() {
+fn bindgen_test_layout_cbw_BrowserWindowMemoryStats() {
     assert_eq!(
-        ::std::mem::size_of::<c__mbstate_t__bindgen_ty_1>(),
-        4usize,
-        concat!("Size of: ", stringify!(c__mbstate_t__bindgen_ty_1))
+        ::std::mem::size_of::<cbw_BrowserWindowMemoryStats>(),
+        64usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowMemoryStats))
     );
     assert_eq!(
-        ::std::mem::align_of::<c__mbstate_t__bindgen_ty_1>(),
-        4usize,
-        concat!("Alignment of ", stringify!(c__mbstate_t__bindgen_ty_1))
+        ::std::mem::align_of::<cbw_BrowserWindowMemoryStats>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowMemoryStats))
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__mbstate_t__bindgen_ty_1>())).__wch as *const _ as usize
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).pending_calls as *const _
+                as usize
         },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__mbstate_t__bindgen_ty_1),
+            stringify!(cbw_BrowserWindowMemoryStats),
             "::",
-            stringify!(__wch)
+            stringify!(pending_calls)
         )
     );
     assert_eq!(
         unsafe {
-            &(*(::std::ptr::null::<c__mbstate_t__bindgen_ty_1>())).__wchb as *const _ as usize
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).queued_bytes as *const _
+                as usize
         },
-        0usize,
+        8usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__mbstate_t__bindgen_ty_1),
+            stringify!(cbw_BrowserWindowMemoryStats),
             "::",
-            stringify!(__wchb)
+            stringify!(queued_bytes)
         )
     );
-}
-#[test]
-fn bindgen_test_layout_c__mbstate_t() {
-    assert_eq!(
-        ::std::mem::size_of::<c__mbstate_t>(),
-        8usize,
-        concat!("Size of: ", stringify!(c__mbstate_t))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<c__mbstate_t>(),
-        4usize,
-        concat!("Alignment of ", stringify!(c__mbstate_t))
-    );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__mbstate_t>())).__count as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).cached_response_bytes
+                as *const _ as usize
+        },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__mbstate_t),
+            stringify!(cbw_BrowserWindowMemoryStats),
             "::",
-            stringify!(__count)
+            stringify!(cached_response_bytes)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c__mbstate_t>())).__value as *const _ as usize },
-        4usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).renderer_measured as *const _
+                as usize
+        },
+        24usize,
         concat!(
             "Offset of field: ",
-            stringify!(c__mbstate_t),
+            stringify!(cbw_BrowserWindowMemoryStats),
             "::",
-            stringify!(__value)
+            stringify!(renderer_measured)
         )
     );
-}
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub struct c_G_fpos_t {
-    pub __pos: c__off_t,
-    pub __state: c__mbstate_t,
-}
-#[test]
-fn bindgen_test_layout_c_G_fpos_t() {
     assert_eq!(
-        ::std::mem::size_of::<c_G_fpos_t>(),
-        16usize,
-        concat!("Size of: ", stringify!(c_G_fpos_t))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).js_heap_used as *const _
+                as usize
+        },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowMemoryStats),
+            "::",
+            stringify!(js_heap_used)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<c_G_fpos_t>(),
-        8usize,
-        concat!("Alignment of ", stringify!(c_G_fpos_t))
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).js_heap_total as *const _
+                as usize
+        },
+        40usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindowMemoryStats),
+            "::",
+            stringify!(js_heap_total)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_G_fpos_t>())).__pos as *const _ as usize },
-        0usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).js_heap_limit as *const _
+                as usize
+        },
+        48usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_G_fpos_t),
+            stringify!(cbw_BrowserWindowMemoryStats),
             "::",
-            stringify!(__pos)
+            stringify!(js_heap_limit)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_G_fpos_t>())).__state as *const _ as usize },
-        8usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowMemoryStats>())).renderer_private_bytes
+                as *const _ as usize
+        },
+        56usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_G_fpos_t),
+            stringify!(cbw_BrowserWindowMemoryStats),
             "::",
-            stringify!(__state)
+            stringify!(renderer_private_bytes)
         )
     );
 }
-pub type c__fpos_t = c_G_fpos_t;
+#[doc = " Receives the memory statistics of a browser window, which are only valid during the invocation of the callback."]
+pub type cbw_BrowserWindowMemoryStatsFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        stats: *const cbw_BrowserWindowMemoryStats,
+    ),
+>;
+#[doc = " The forms in which the page of a browser window can be rendered into memory."]
+pub type cbw_BrowserWindowOutputFormat = ::std::os::raw::c_uchar;
+#[doc = " Receives what a browser window has rendered into memory, on the GUI thread, or the error `err` if it failed, in which case `data` is null."]
+#[doc = " `data` is only valid during the invocation of the callback."]
+#[doc = " `width` and `height` are the size of the image in pixels, and 0 for a PDF document."]
+pub type cbw_BrowserWindowOutputFn = ::std::option::Option<
+    unsafe extern "C" fn(
+        window: *mut cbw_BrowserWindow,
+        user_data: *mut ::std::os::raw::c_void,
+        data: *const u8,
+        size: csize_t,
+        width: ::std::os::raw::c_int,
+        height: ::std::os::raw::c_int,
+        err: *const cbw_Err,
+    ),
+>;
 #[repr(C)]
-#[derive(Copy, Clone)]
-pub struct c_G_fpos64_t {
-    pub __pos: c__off64_t,
-    pub __state: c__mbstate_t,
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_BrowserWindowPdfOptions {
+    pub landscape: cBOOL,
+    #[doc = " Whether the background colors and images of the page are printed as well."]
+    pub backgrounds: cBOOL,
 }
 #[test]
-fn bindgen_test_layout_c_G_fpos64_t() {
+fn bindgen_test_layout_cbw_BrowserWindowPdfOptions() {
     assert_eq!(
-        ::std::mem::size_of::<c_G_fpos64_t>(),
-        16usize,
-        concat!("Size of: ", stringify!(c_G_fpos64_t))
+        ::std::mem::size_of::<cbw_BrowserWindowPdfOptions>(),
+        8usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowPdfOptions))
     );
     assert_eq!(
-        ::std::mem::align_of::<c_G_fpos64_t>(),
-        8usize,
-        concat!("Alignment of ", stringify!(c_G_fpos64_t))
+        ::std::mem::align_of::<cbw_BrowserWindowPdfOptions>(),
+        4usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowPdfOptions))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_G_fpos64_t>())).__pos as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowPdfOptions>())).landscape as *const _ as usize
+        },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_G_fpos64_t),
+            stringify!(cbw_BrowserWindowPdfOptions),
             "::",
-            stringify!(__pos)
+            stringify!(landscape)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_G_fpos64_t>())).__state as *const _ as usize },
-        8usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowPdfOptions>())).backgrounds as *const _ as usize
+        },
+        4usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_G_fpos64_t),
+            stringify!(cbw_BrowserWindowPdfOptions),
             "::",
-            stringify!(__state)
+            stringify!(backgrounds)
         )
     );
 }
-pub type c__fpos64_t = c_G_fpos64_t;
-pub type c__FILE = c_IO_FILE;
-pub type cFILE = c_IO_FILE;
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct c_IO_marker {
-    _unused: [u8; 0],
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct c_IO_codecvt {
-    _unused: [u8; 0],
-}
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct c_IO_wide_data {
+pub struct cbw_BrowserWindowRenderQueue {
     _unused: [u8; 0],
 }
-pub type c_IO_lock_t = ::std::os::raw::c_void;
+#[doc = " A page to render with a `bw_BrowserWindowRenderQueue`."]
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct c_IO_FILE {
-    pub _flags: ::std::os::raw::c_int,
-    pub _IO_read_ptr: *mut ::std::os::raw::c_char,
-    pub _IO_read_end: *mut ::std::os::raw::c_char,
-    pub _IO_read_base: *mut ::std::os::raw::c_char,
-    pub _IO_write_base: *mut ::std::os::raw::c_char,
-    pub _IO_write_ptr: *mut ::std::os::raw::c_char,
-    pub _IO_write_end: *mut ::std::os::raw::c_char,
-    pub _IO_buf_base: *mut ::std::os::raw::c_char,
-    pub _IO_buf_end: *mut ::std::os::raw::c_char,
-    pub _IO_save_base: *mut ::std::os::raw::c_char,
-    pub _IO_backup_base: *mut ::std::os::raw::c_char,
-    pub _IO_save_end: *mut ::std::os::raw::c_char,
-    pub _markers: *mut c_IO_marker,
-    pub _chain: *mut c_IO_FILE,
-    pub _fileno: ::std::os::raw::c_int,
-    pub _flags2: ::std::os::raw::c_int,
-    pub _old_offset: c__off_t,
-    pub _cur_column: ::std::os::raw::c_ushort,
-    pub _vtable_offset: ::std::os::raw::c_schar,
-    pub _shortbuf: [::std::os::raw::c_char; 1usize],
-    pub _lock: *mut c_IO_lock_t,
-    pub _offset: c__off64_t,
-    pub _codecvt: *mut c_IO_codecvt,
-    pub _wide_data: *mut c_IO_wide_data,
-    pub _freeres_list: *mut c_IO_FILE,
-    pub _freeres_buf: *mut ::std::os::raw::c_void,
-    pub __pad5: csize_t,
-    pub _mode: ::std::os::raw::c_int,
-    pub _unused2: [::std::os::raw::c_char; 20usize],
+pub struct cbw_BrowserWindowRenderJob {
+    pub source: cbw_BrowserWindowSource,
+    #[doc = " The size of the view, in pixels."]
+    pub width: ::std::os::raw::c_int,
+    pub height: ::std::os::raw::c_int,
+    pub format: cbw_BrowserWindowOutputFormat,
+    #[doc = " Only used for `BW_BROWSER_WINDOW_OUTPUT_PDF`."]
+    pub pdf_options: cbw_BrowserWindowPdfOptions,
+    #[doc = " The number of milliseconds to wait after the page has finished loading, for the scripts, fonts and animations that only settle down afterwards."]
+    pub settle_time: ::std::os::raw::c_uint,
+    #[doc = " The number of milliseconds, counted from the moment that the browser has been created, in which the page needs to be rendered, or 0 for 30 seconds."]
+    #[doc = " Once it has passed, the callback receives a `BW_BROWSER_WINDOW_OUTPUT_ERROR_TIMED_OUT` error, and the browser window is destroyed to make room for the next job."]
+    pub timeout: ::std::os::raw::c_uint,
 }
 #[test]
-fn bindgen_test_layout_c_IO_FILE() {
+fn bindgen_test_layout_cbw_BrowserWindowRenderJob() {
     assert_eq!(
-        ::std::mem::size_of::<c_IO_FILE>(),
-        216usize,
-        concat!("Size of: ", stringify!(c_IO_FILE))
+        ::std::mem::size_of::<cbw_BrowserWindowRenderJob>(),
+        56usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindowRenderJob))
     );
     assert_eq!(
-        ::std::mem::align_of::<c_IO_FILE>(),
+        ::std::mem::align_of::<cbw_BrowserWindowRenderJob>(),
         8usize,
-        concat!("Alignment of ", stringify!(c_IO_FILE))
+        concat!("Alignment of ", stringify!(cbw_BrowserWindowRenderJob))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._flags as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRenderJob>())).source as *const _ as usize
+        },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindowRenderJob),
             "::",
-            stringify!(_flags)
+            stringify!(source)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_read_ptr as *const _ as usize },
-        8usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRenderJob>())).width as *const _ as usize
+        },
+        24usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindowRenderJob),
             "::",
-            stringify!(_IO_read_ptr)
+            stringify!(width)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_read_end as *const _ as usize },
-        16usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRenderJob>())).height as *const _ as usize
+        },
+        28usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindowRenderJob),
             "::",
-            stringify!(_IO_read_end)
+            stringify!(height)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_read_base as *const _ as usize },
-        24usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRenderJob>())).format as *const _ as usize
+        },
+        32usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindowRenderJob),
             "::",
-            stringify!(_IO_read_base)
+            stringify!(format)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_write_base as *const _ as usize },
-        32usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRenderJob>())).pdf_options as *const _ as usize
+        },
+        36usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindowRenderJob),
             "::",
-            stringify!(_IO_write_base)
+            stringify!(pdf_options)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_write_ptr as *const _ as usize },
-        40usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRenderJob>())).settle_time as *const _ as usize
+        },
+        44usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindowRenderJob),
             "::",
-            stringify!(_IO_write_ptr)
+            stringify!(settle_time)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_write_end as *const _ as usize },
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindowRenderJob>())).timeout as *const _ as usize
+        },
         48usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindowRenderJob),
             "::",
-            stringify!(_IO_write_end)
+            stringify!(timeout)
         )
     );
+}
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct cbw_BrowserWindow {
+    pub window: *mut cbw_Window,
+    pub external_handler: cbw_BrowserWindowHandlerFn,
+    pub structured_handler: cbw_BrowserWindowStructuredHandlerFn,
+    pub binary_handler: cbw_BrowserWindowBinaryHandlerFn,
+    pub native_handler: cbw_BrowserWindowNativeHandlerFn,
+    pub batch_handler: cbw_BrowserWindowBatchHandlerFn,
+    pub user_data: *mut ::std::os::raw::c_void,
+    pub js_queue: *mut cbw_BrowserWindowQueue,
+    pub stream_queue: *mut cbw_BrowserWindowQueue,
+    pub event_handler: cbw_BrowserWindowEventHandlerFn,
+    pub event_handler_data: *mut ::std::os::raw::c_void,
+    pub free_event_handler_data: cbw_ResourceFreeFn,
+    pub url: cbw_StrSlice,
+    pub page_title: cbw_StrSlice,
+    pub metrics: cbw_BrowserWindowMetrics,
+    pub impl_: cbw_BrowserWindowImpl,
+}
+#[test]
+fn bindgen_test_layout_cbw_BrowserWindow() {
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_buf_base as *const _ as usize },
-        56usize,
+        ::std::mem::size_of::<cbw_BrowserWindow>(),
+        6864usize,
+        concat!("Size of: ", stringify!(cbw_BrowserWindow))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<cbw_BrowserWindow>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_BrowserWindow))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).window as *const _ as usize },
+        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_IO_buf_base)
+            stringify!(window)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_buf_end as *const _ as usize },
-        64usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindow>())).external_handler as *const _ as usize
+        },
+        8usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_IO_buf_end)
+            stringify!(external_handler)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_save_base as *const _ as usize },
-        72usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindow>())).structured_handler as *const _ as usize
+        },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_IO_save_base)
+            stringify!(structured_handler)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_backup_base as *const _ as usize },
-        80usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindow>())).binary_handler as *const _ as usize
+        },
+        24usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_IO_backup_base)
+            stringify!(binary_handler)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_save_end as *const _ as usize },
-        88usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindow>())).native_handler as *const _ as usize
+        },
+        32usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_IO_save_end)
+            stringify!(native_handler)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._markers as *const _ as usize },
-        96usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).batch_handler as *const _ as usize },
+        40usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_markers)
+            stringify!(batch_handler)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._chain as *const _ as usize },
-        104usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).user_data as *const _ as usize },
+        48usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_chain)
+            stringify!(user_data)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._fileno as *const _ as usize },
-        112usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).js_queue as *const _ as usize },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindow),
+            "::",
+            stringify!(js_queue)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).stream_queue as *const _ as usize },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(cbw_BrowserWindow),
+            "::",
+            stringify!(stream_queue)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).event_handler as *const _ as usize },
+        72usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_fileno)
+            stringify!(event_handler)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._flags2 as *const _ as usize },
-        116usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindow>())).event_handler_data as *const _ as usize
+        },
+        80usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_flags2)
+            stringify!(event_handler_data)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._old_offset as *const _ as usize },
-        120usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_BrowserWindow>())).free_event_handler_data as *const _
+                as usize
+        },
+        88usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_old_offset)
+            stringify!(free_event_handler_data)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._cur_column as *const _ as usize },
-        128usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).url as *const _ as usize },
+        96usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_cur_column)
+            stringify!(url)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._vtable_offset as *const _ as usize },
-        130usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).page_title as *const _ as usize },
+        112usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_vtable_offset)
+            stringify!(page_title)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._shortbuf as *const _ as usize },
-        131usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).metrics as *const _ as usize },
+        128usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_shortbuf)
+            stringify!(metrics)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._lock as *const _ as usize },
-        136usize,
+        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).impl_ as *const _ as usize },
+        6784usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_BrowserWindow),
             "::",
-            stringify!(_lock)
+            stringify!(impl_)
         )
     );
+}
+extern "C" {
+    #[doc = " Keeps `count` hidden browser windows ready, so that `bw_BrowserWindow_new` can take one of them instead of waiting for a new renderer to start up."]
+    #[doc = " A pooled browser window is only taken for browser windows that are created with the same window options and resource path, with the same kind of `invoke_extern` handler, and without a parent."]
+    #[doc = " Dev tools, windowless rendering, request contexts, and batch and threaded handlers are never pooled."]
+    #[doc = " If `refill` is set, a replacement is created in the background when the GUI thread is idle, whenever a browser window has been taken."]
+    #[doc = " Calling this again changes the number of browser windows to keep ready, and a `count` of 0 destroys them all."]
+    #[doc = " Pooled browser windows don't keep the application from exiting."]
+    #[link_name = "\u{1}bw_Application_prewarmBrowserWindows"]
+    pub fn cbw_Application_prewarmBrowserWindows(
+        app: *mut cbw_Application,
+        count: ::std::os::raw::c_uint,
+        window_options: *const cbw_WindowOptions,
+        browser_window_options: *const cbw_BrowserWindowOptions,
+        refill: cBOOL,
+    );
+}
+#[doc = " What `bw_Application_broadcast` sends to every browser window."]
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct cbw_ApplicationBroadcastPayload {
+    #[doc = " Executed like with `bw_BrowserWindow_execJs`, unless it is empty."]
+    pub js: cbw_CStrSlice,
+    #[doc = " Posted like with `bw_BrowserWindow_postBinary`, unless `size` is 0."]
+    pub data: *const u8,
+    pub size: csize_t,
+}
+#[test]
+fn bindgen_test_layout_cbw_ApplicationBroadcastPayload() {
+    assert_eq!(
+        ::std::mem::size_of::<cbw_ApplicationBroadcastPayload>(),
+        32usize,
+        concat!("Size of: ", stringify!(cbw_ApplicationBroadcastPayload))
+    );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._offset as *const _ as usize },
-        144usize,
+        ::std::mem::align_of::<cbw_ApplicationBroadcastPayload>(),
+        8usize,
+        concat!("Alignment of ", stringify!(cbw_ApplicationBroadcastPayload))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationBroadcastPayload>())).js as *const _ as usize
+        },
+        0usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_ApplicationBroadcastPayload),
             "::",
-            stringify!(_offset)
+            stringify!(js)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._codecvt as *const _ as usize },
-        152usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationBroadcastPayload>())).data as *const _ as usize
+        },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_ApplicationBroadcastPayload),
             "::",
-            stringify!(_codecvt)
+            stringify!(data)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._wide_data as *const _ as usize },
-        160usize,
+        unsafe {
+            &(*(::std::ptr::null::<cbw_ApplicationBroadcastPayload>())).size as *const _ as usize
+        },
+        24usize,
         concat!(
             "Offset of field: ",
-            stringify!(c_IO_FILE),
+            stringify!(cbw_ApplicationBroadcastPayload),
             "::",
-            stringify!(_wide_data)
+            stringify!(size)
         )
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._freeres_list as *const _ as usize },
-        168usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c_IO_FILE),
-            "::",
-            stringify!(_freeres_list)
-        )
+}
+extern "C" {
+    #[doc = " Sends the same payload to all browser windows of the application for which `filter` returns true, or to all of them if `filter` is null."]
+    #[doc = " The payload is converted only once, instead of once for every browser window."]
+    #[doc = " Browser windows that are waiting in the prewarm pool are left out."]
+    #[doc = " Returns the number of browser windows that the payload has been sent to."]
+    #[link_name = "\u{1}bw_Application_broadcast"]
+    pub fn cbw_Application_broadcast(
+        app: *mut cbw_Application,
+        payload: *const cbw_ApplicationBroadcastPayload,
+        filter: cbw_ApplicationBroadcastFilterFn,
+        user_data: *mut ::std::os::raw::c_void,
+    ) -> csize_t;
+}
+extern "C" {
+    #[doc = " Returns the browser window with the given id, or null if it has been destroyed in the meantime."]
+    #[doc = " This function is thread safe, but the browser window can only be used on the GUI thread."]
+    #[link_name = "\u{1}bw_Application_findBrowserWindow"]
+    pub fn cbw_Application_findBrowserWindow(
+        app: *const cbw_Application,
+        id: cbw_BrowserWindowId,
+    ) -> *mut cbw_BrowserWindow;
+}
+extern "C" {
+    #[doc = " Creates a queue of render jobs, of which at most `concurrency` are loaded at the same time, each in a headless browser window of its own."]
+    #[doc = " The browser windows are created with the given options, except that they are always windowless and headless."]
+    #[doc = " This requires `windowless_rendering` to be enabled in the application settings."]
+    #[doc = " The browsers render off-screen, but every browser window is still tied to a native window of its own, which is never shown."]
+    #[doc = " A browser window can't exist without its window in this library, and on Linux that window and GTK itself need a display, so a server without one still needs a virtual display, like Xvfb."]
+    #[doc = " Should be called on the GUI thread, like all other functions of the render queue."]
+    #[link_name = "\u{1}bw_BrowserWindowRenderQueue_new"]
+    pub fn cbw_BrowserWindowRenderQueue_new(
+        app: *mut cbw_Application,
+        concurrency: ::std::os::raw::c_uint,
+        options: *const cbw_BrowserWindowOptions,
+    ) -> *mut cbw_BrowserWindowRenderQueue;
+}
+extern "C" {
+    #[doc = " Drops the jobs that are still waiting, of which the callbacks are invoked with an error, and frees the queue once the jobs that are loading have finished."]
+    #[link_name = "\u{1}bw_BrowserWindowRenderQueue_free"]
+    pub fn cbw_BrowserWindowRenderQueue_free(queue: *mut cbw_BrowserWindowRenderQueue);
+}
+extern "C" {
+    #[doc = " Adds a job to the end of the queue."]
+    #[doc = " `callback` receives the output, with the browser window in which it has been rendered, right before that browser window gets destroyed."]
+    #[doc = " The job is copied, so it doesn't need to stay around."]
+    #[link_name = "\u{1}bw_BrowserWindowRenderQueue_push"]
+    pub fn cbw_BrowserWindowRenderQueue_push(
+        queue: *mut cbw_BrowserWindowRenderQueue,
+        job: *const cbw_BrowserWindowRenderJob,
+        callback: cbw_BrowserWindowOutputFn,
+        user_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Returns the number of jobs that are waiting, and sets `running` to the number of jobs that are loading, if not null."]
+    #[link_name = "\u{1}bw_BrowserWindowRenderQueue_pending"]
+    pub fn cbw_BrowserWindowRenderQueue_pending(
+        queue: *const cbw_BrowserWindowRenderQueue,
+        running: *mut csize_t,
+    ) -> csize_t;
+}
+extern "C" {
+    #[doc = " Changes the number of jobs that may be loaded at the same time, which starts waiting jobs right away if it has been raised."]
+    #[link_name = "\u{1}bw_BrowserWindowRenderQueue_setConcurrency"]
+    pub fn cbw_BrowserWindowRenderQueue_setConcurrency(
+        queue: *mut cbw_BrowserWindowRenderQueue,
+        concurrency: ::std::os::raw::c_uint,
+    );
+}
+extern "C" {
+    #[doc = " Renders the view of a windowless browser window into memory, with the next frame that it paints."]
+    #[doc = " A PDF document is rendered like with `bw_BrowserWindow_printToPdfBuffer` with its default options, which also works for browser windows that are not windowless."]
+    #[doc = " Frames are only painted while the window is shown, unless the browser window is headless."]
+    #[link_name = "\u{1}bw_BrowserWindow_captureToBuffer"]
+    pub fn cbw_BrowserWindow_captureToBuffer(
+        bw: *mut cbw_BrowserWindow,
+        format: cbw_BrowserWindowOutputFormat,
+        callback: cbw_BrowserWindowOutputFn,
+        user_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[link_name = "\u{1}bw_BrowserWindow_destroy"]
+    pub fn cbw_BrowserWindow_destroy(bw: *mut cbw_BrowserWindow);
+}
+extern "C" {
+    #[doc = " Marks the browser window handle as not being used anymore."]
+    #[doc = " This makes it so that if and when the window gets closed, everything is freed and cleaned from memory."]
+    #[doc = " This function can be called from any thread so it needs to be thread safe."]
+    #[link_name = "\u{1}bw_BrowserWindow_drop"]
+    pub fn cbw_BrowserWindow_drop(bw: *mut cbw_BrowserWindow);
+}
+extern "C" {
+    #[doc = " Executes the given JavaScript and calls the given callback (on the GUI thread) to provide the result."]
+    #[link_name = "\u{1}bw_BrowserWindow_evalJs"]
+    pub fn cbw_BrowserWindow_evalJs(
+        bw: *mut cbw_BrowserWindow,
+        js: cbw_CStrSlice,
+        callback: cbw_BrowserWindowJsCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Like `bw_BrowserWindow_evalJs`, but invokes the callback with a `BW_BROWSER_WINDOW_JS_ERROR_TIMED_OUT` error if the result takes longer than `timeout` milliseconds."]
+    #[doc = " A `timeout` of 0 means no timeout."]
+    #[doc = " Returns an id that can be passed to `bw_BrowserWindow_cancelJs`."]
+    #[link_name = "\u{1}bw_BrowserWindow_evalJsWithTimeout"]
+    pub fn cbw_BrowserWindow_evalJsWithTimeout(
+        bw: *mut cbw_BrowserWindow,
+        js: cbw_CStrSlice,
+        timeout: ::std::os::raw::c_uint,
+        callback: cbw_BrowserWindowJsCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    ) -> u64;
+}
+extern "C" {
+    #[doc = " Stops waiting on the result of the evaluation with the given id, and invokes its callback with a `BW_BROWSER_WINDOW_JS_ERROR_CANCELLED` error right away."]
+    #[doc = " The result is dropped when it still arrives."]
+    #[doc = " Returns false if the evaluation has already completed."]
+    #[link_name = "\u{1}bw_BrowserWindow_cancelJs"]
+    pub fn cbw_BrowserWindow_cancelJs(bw: *mut cbw_BrowserWindow, id: u64) -> cBOOL;
+}
+extern "C" {
+    #[doc = " Like `bw_BrowserWindow_evalJs`, but can be called from any thread, with the id of the browser window instead of the browser window itself."]
+    #[doc = " The callback is not invoked on the GUI thread, but on whatever thread the browser engine receives the result on, and it receives a null browser window."]
+    #[doc = " If the browser window doesn't exist (anymore), or its browser hasn't been created yet, the callback is invoked right away with a `BW_BROWSER_WINDOW_JS_ERROR_CANCELLED` error."]
+    #[link_name = "\u{1}bw_BrowserWindow_evalJsThreaded"]
+    pub fn cbw_BrowserWindow_evalJsThreaded(
+        app: *mut cbw_Application,
+        id: cbw_BrowserWindowId,
+        js: cbw_CStrSlice,
+        callback: cbw_BrowserWindowJsCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Like `bw_BrowserWindow_evalJs`, but provides the result as a structured value instead of a string."]
+    #[doc = " Arrays and objects are transferred as a whole, making a `JSON.stringify` round trip unnecessary."]
+    #[link_name = "\u{1}bw_BrowserWindow_evalJsStructured"]
+    pub fn cbw_BrowserWindow_evalJsStructured(
+        bw: *mut cbw_BrowserWindow,
+        js: cbw_CStrSlice,
+        callback: cbw_BrowserWindowJsStructuredCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Executes all given scripts with one round trip to the renderer process."]
+    #[doc = " For every script, its callback (`callbacks[i]`) is invoked with its data (`cb_data[i]`), in the same order as the scripts are given."]
+    #[doc = " If `count` is 0, nothing happens and the arrays may be null."]
+    #[link_name = "\u{1}bw_BrowserWindow_evalJsBatch"]
+    pub fn cbw_BrowserWindow_evalJsBatch(
+        bw: *mut cbw_BrowserWindow,
+        scripts: *const cbw_CStrSlice,
+        count: csize_t,
+        callbacks: *const cbw_BrowserWindowJsCallbackFn,
+        cb_data: *const *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Executes the given JavaScript without providing its result."]
+    #[doc = " If coalescing is enabled, the script is buffered and executed together with all other buffered scripts at a later time."]
+    #[link_name = "\u{1}bw_BrowserWindow_execJs"]
+    pub fn cbw_BrowserWindow_execJs(bw: *mut cbw_BrowserWindow, js: cbw_CStrSlice);
+}
+extern "C" {
+    #[doc = " Executes all scripts that have been buffered by `bw_BrowserWindow_execJs`."]
+    #[link_name = "\u{1}bw_BrowserWindow_flushJs"]
+    pub fn cbw_BrowserWindow_flushJs(bw: *mut cbw_BrowserWindow);
+}
+extern "C" {
+    #[link_name = "\u{1}bw_BrowserWindow_getApp"]
+    pub fn cbw_BrowserWindow_getApp(bw: *mut cbw_BrowserWindow) -> *mut cbw_Application;
+}
+extern "C" {
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_BrowserWindow_getId"]
+    pub fn cbw_BrowserWindow_getId(bw: *const cbw_BrowserWindow) -> cbw_BrowserWindowId;
+}
+extern "C" {
+    #[doc = " Copies the latencies and counters of the messages that the browser window exchanged with its renderer process."]
+    #[link_name = "\u{1}bw_BrowserWindow_getMetrics"]
+    pub fn cbw_BrowserWindow_getMetrics(
+        bw: *const cbw_BrowserWindow,
+        metrics: *mut cbw_BrowserWindowMetrics,
+    );
+}
+extern "C" {
+    #[doc = " Like `bw_BrowserWindow_getMetrics`, but can be called from any thread, with the id of the browser window instead of the browser window itself."]
+    #[doc = " Returns false if the browser window doesn't exist (anymore), in which case `metrics` is left alone."]
+    #[link_name = "\u{1}bw_BrowserWindow_getMetricsThreaded"]
+    pub fn cbw_BrowserWindow_getMetricsThreaded(
+        app: *const cbw_Application,
+        id: cbw_BrowserWindowId,
+        metrics: *mut cbw_BrowserWindowMetrics,
+    ) -> cBOOL;
+}
+extern "C" {
+    #[doc = " Measures the memory that the browser window uses, both in this process and in its renderer process, and invokes the callback on the GUI thread with the results."]
+    #[doc = " If the browser window gets closed before the renderer process answers, the callback is still invoked, but only with the memory used in this process."]
+    #[link_name = "\u{1}bw_BrowserWindow_getMemoryStats"]
+    pub fn cbw_BrowserWindow_getMemoryStats(
+        bw: *mut cbw_BrowserWindow,
+        callback: cbw_BrowserWindowMemoryStatsFn,
+        user_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Fills in the memory that the browser window uses in this process, without asking its renderer process."]
+    #[doc = " Should be called on the GUI thread."]
+    #[link_name = "\u{1}bw_BrowserWindow_getNativeMemoryStats"]
+    pub fn cbw_BrowserWindow_getNativeMemoryStats(
+        bw: *const cbw_BrowserWindow,
+        stats: *mut cbw_BrowserWindowMemoryStats,
+    );
+}
+extern "C" {
+    #[doc = " Gets the title of the page, as it has been reported last."]
+    #[doc = " The title is only valid until the GUI thread handles the next event of the browser window."]
+    #[link_name = "\u{1}bw_BrowserWindow_getPageTitle"]
+    pub fn cbw_BrowserWindow_getPageTitle(bw: *const cbw_BrowserWindow, title: *mut cbw_CStrSlice);
+}
+extern "C" {
+    #[link_name = "\u{1}bw_BrowserWindow_getUserData"]
+    pub fn cbw_BrowserWindow_getUserData(bw: *mut cbw_BrowserWindow)
+        -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[doc = " Gets the url of the main frame."]
+    #[doc = " Returns false if `url` borrows the url that has been reported last, which is only valid until the GUI thread handles the next event of the browser window."]
+    #[doc = " Returns true if `url` has been allocated and needs to be freed with `bw_string_free`."]
+    #[link_name = "\u{1}bw_BrowserWindow_getUrl"]
+    pub fn cbw_BrowserWindow_getUrl(bw: *mut cbw_BrowserWindow, url: *mut cbw_StrSlice) -> cBOOL;
+}
+extern "C" {
+    #[link_name = "\u{1}bw_BrowserWindow_getWindow"]
+    pub fn cbw_BrowserWindow_getWindow(bw: *mut cbw_BrowserWindow) -> *mut cbw_Window;
+}
+extern "C" {
+    #[doc = " Prints the page into a PDF document in memory."]
+    #[doc = " The browser engine only prints into files, so the document goes through a temporary file that is deleted right after it has been read."]
+    #[doc = " `options` may be null for the defaults."]
+    #[link_name = "\u{1}bw_BrowserWindow_printToPdfBuffer"]
+    pub fn cbw_BrowserWindow_printToPdfBuffer(
+        bw: *mut cbw_BrowserWindow,
+        options: *const cbw_BrowserWindowPdfOptions,
+        callback: cbw_BrowserWindowOutputFn,
+        user_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Sends the given bytes to the page, without any text encoding."]
+    #[doc = " They arrive in javascript as an `ArrayBuffer`, as the argument of the global function `on_extern_binary`, if the page has defined it."]
+    #[doc = " Unlike the bytes that the page sends, these are never converted into javascript strings along the way."]
+    #[link_name = "\u{1}bw_BrowserWindow_postBinary"]
+    pub fn cbw_BrowserWindow_postBinary(bw: *mut cbw_BrowserWindow, data: *const u8, size: csize_t);
+}
+extern "C" {
+    #[doc = " Appends the given bytes to the page's binary stream."]
+    #[doc = " The stream is flushed on the next iteration of the event loop, or as soon as 1 MiB is buffered, so that a lot of small writes take only one message to the renderer."]
+    #[doc = " The page receives every flushed part of the stream as an `ArrayBuffer`, as the argument of the global function `on_extern_stream`, if it has defined it."]
+    #[doc = " That `ArrayBuffer` is a copy of the page's own, so the page's writes into it never reach the application; for that direction, see `bw_BrowserWindow_setStreamHandler`."]
+    #[link_name = "\u{1}bw_BrowserWindow_writeStream"]
+    pub fn cbw_BrowserWindow_writeStream(
+        bw: *mut cbw_BrowserWindow,
+        data: *const u8,
+        size: csize_t,
+    );
+}
+extern "C" {
+    #[doc = " Sends the bytes written to the page's stream by `bw_BrowserWindow_writeStream` right away."]
+    #[link_name = "\u{1}bw_BrowserWindow_flushStream"]
+    pub fn cbw_BrowserWindow_flushStream(bw: *mut cbw_BrowserWindow);
+}
+extern "C" {
+    #[doc = " Sets the handler that receives the bytes that the page writes to the application, with its global function `write_extern_stream`."]
+    #[doc = " That function takes an `ArrayBuffer` or a view on one, and its writes are coalesced like those of `bw_BrowserWindow_writeStream`: they are sent once the page's current task has finished, or as soon as 1 MiB is buffered."]
+    #[doc = " While there is no handler, `write_extern_stream` throws an exception in the page, rather than dropping the data."]
+    #[doc = " Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null."]
+    #[link_name = "\u{1}bw_BrowserWindow_setStreamHandler"]
+    pub fn cbw_BrowserWindow_setStreamHandler(
+        bw: *mut cbw_BrowserWindow,
+        handler: cbw_BrowserWindowStreamHandlerFn,
+        user_data: *mut ::std::os::raw::c_void,
+        free_user_data: cbw_ResourceFreeFn,
+    );
+}
+extern "C" {
+    #[doc = " Settles the promise that `invoke_native` has returned for the given request, without evaluating any javascript."]
+    #[doc = " If `success` is set, the promise is resolved with `value` as a string, otherwise it is rejected with an `Error` that has `value` as its message."]
+    #[doc = " Every request should be replied to once, and replies to requests made by a page that has been unloaded in the meantime are dropped."]
+    #[doc = " The `request_id` is given out by the browser process, so a reply never reaches a page other than the one that has made the request."]
+    #[link_name = "\u{1}bw_BrowserWindow_replyToInvocation"]
+    pub fn cbw_BrowserWindow_replyToInvocation(
+        bw: *mut cbw_BrowserWindow,
+        request_id: ::std::os::raw::c_uint,
+        success: cBOOL,
+        value: cbw_CStrSlice,
+    );
+}
+extern "C" {
+    #[doc = " Calls the function of a script that has been registered with `bw_BrowserWindow_registerScript`, with the given strings as its arguments."]
+    #[doc = " If `callback` is not null, it is invoked with the function's return value, just like with `bw_BrowserWindow_evalJs`."]
+    #[link_name = "\u{1}bw_BrowserWindow_invokeScript"]
+    pub fn cbw_BrowserWindow_invokeScript(
+        bw: *mut cbw_BrowserWindow,
+        script_id: ::std::os::raw::c_uint,
+        args: *const cbw_CStrSlice,
+        arg_count: csize_t,
+        callback: cbw_BrowserWindowJsCallbackFn,
+        cb_data: *mut ::std::os::raw::c_void,
+    );
+}
+extern "C" {
+    #[doc = " Lets `handler` answer the requests of the page, before they go through the network stack."]
+    #[doc = " Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null."]
+    #[doc = " If `handler` is null, requests aren't intercepted anymore."]
+    #[link_name = "\u{1}bw_BrowserWindow_interceptRequests"]
+    pub fn cbw_BrowserWindow_interceptRequests(
+        bw: *mut cbw_BrowserWindow,
+        options: *const cbw_BrowserWindowInterceptOptions,
+        handler: cbw_BrowserWindowRequestHandlerFn,
+        user_data: *mut ::std::os::raw::c_void,
+        free_user_data: cbw_ResourceFreeFn,
+    );
+}
+extern "C" {
+    #[link_name = "\u{1}bw_BrowserWindow_navigate"]
+    pub fn cbw_BrowserWindow_navigate(bw: *mut cbw_BrowserWindow, url: cbw_CStrSlice) -> cbw_Err;
+}
+extern "C" {
+    #[doc = " Sets the handler that receives the events of the page, like the start and end of loading it, and changes of its url and title."]
+    #[doc = " Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null."]
+    #[doc = " If `handler` is null, events are not received anymore."]
+    #[link_name = "\u{1}bw_BrowserWindow_setEventHandler"]
+    pub fn cbw_BrowserWindow_setEventHandler(
+        bw: *mut cbw_BrowserWindow,
+        handler: cbw_BrowserWindowEventHandlerFn,
+        user_data: *mut ::std::os::raw::c_void,
+        free_user_data: cbw_ResourceFreeFn,
+    );
+}
+extern "C" {
+    #[doc = " Sets the handler that receives the frames of a windowless browser window, and requests a new frame of the whole view."]
+    #[doc = " Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null."]
+    #[doc = " If a paint is still using the previous handler, its user data is freed once that paint is done, on the thread that painted."]
+    #[doc = " If `handler` is null, frames are not received anymore."]
+    #[doc = " Doesn't do anything for browser windows that are not windowless."]
+    #[link_name = "\u{1}bw_BrowserWindow_setPaintHandler"]
+    pub fn cbw_BrowserWindow_setPaintHandler(
+        bw: *mut cbw_BrowserWindow,
+        handler: cbw_BrowserWindowPaintFn,
+        user_data: *mut ::std::os::raw::c_void,
+        free_user_data: cbw_ResourceFreeFn,
+    );
+}
+extern "C" {
+    #[doc = " Like `bw_BrowserWindow_setPaintHandler`, but for the frames that are painted into shared textures."]
+    #[link_name = "\u{1}bw_BrowserWindow_setSharedPaintHandler"]
+    pub fn cbw_BrowserWindow_setSharedPaintHandler(
+        bw: *mut cbw_BrowserWindow,
+        handler: cbw_BrowserWindowSharedPaintFn,
+        user_data: *mut ::std::os::raw::c_void,
+        free_user_data: cbw_ResourceFreeFn,
+    );
+}
+extern "C" {
+    #[doc = " Changes the size of the view of a windowless browser window, after which it paints frames of that size."]
+    #[doc = " `scale_factor` is the number of pixels per device independent pixel."]
+    #[doc = " The view also follows the size of its window when that gets resized."]
+    #[link_name = "\u{1}bw_BrowserWindow_setViewSize"]
+    pub fn cbw_BrowserWindow_setViewSize(
+        bw: *mut cbw_BrowserWindow,
+        width: ::std::os::raw::c_int,
+        height: ::std::os::raw::c_int,
+        scale_factor: f32,
+    );
+}
+extern "C" {
+    #[doc = " Registers a script with the browser window, which is compiled once for every page that gets loaded."]
+    #[doc = " `source` should be a JavaScript expression that evaluates to a function, which can then be called by `bw_BrowserWindow_invokeScript` without sending the source again."]
+    #[doc = " `name` is used as the script's url in error messages and stack traces."]
+    #[doc = " Returns the id of the script."]
+    #[link_name = "\u{1}bw_BrowserWindow_registerScript"]
+    pub fn cbw_BrowserWindow_registerScript(
+        bw: *mut cbw_BrowserWindow,
+        name: cbw_CStrSlice,
+        source: cbw_CStrSlice,
+    ) -> ::std::os::raw::c_uint;
+}
+extern "C" {
+    #[doc = " Registers a command of `invoke_extern`, of which the calls are passed to `handler` instead of to the regular handler."]
+    #[doc = " The renderer process is told the command's id, so that a call of `invoke_extern(name, ...args)` only sends that id, and is routed to its handler without comparing or copying the name."]
+    #[doc = " `invoke_extern` can also be called with the id itself instead of the name."]
+    #[doc = " `free_user_data` is invoked with `user_data` when the browser window is destroyed, if not null."]
+    #[doc = " Calls with structured values, and batched calls, are not routed to registered commands."]
+    #[doc = " Returns the id of the command, which is never 0."]
+    #[link_name = "\u{1}bw_BrowserWindow_registerCommand"]
+    pub fn cbw_BrowserWindow_registerCommand(
+        bw: *mut cbw_BrowserWindow,
+        name: cbw_CStrSlice,
+        handler: cbw_BrowserWindowCommandHandlerFn,
+        user_data: *mut ::std::os::raw::c_void,
+        free_user_data: cbw_ResourceFreeFn,
+    ) -> ::std::os::raw::c_uint;
+}
+extern "C" {
+    #[doc = " Releases the memory that the browser window can do without."]
+    #[doc = " This flushes the coalesced scripts and the binary stream and frees their buffers, and empties the response cache of the request interceptor."]
+    #[doc = " The renderer process then calls `on_memory_pressure` of the page with \"moderate\" or \"critical\", if the page has defined it."]
+    #[doc = " If the engine has been started with `--js-flags=--expose-gc`, the renderer process also collects the garbage of the page."]
+    #[link_name = "\u{1}bw_BrowserWindow_trimMemory"]
+    pub fn cbw_BrowserWindow_trimMemory(
+        bw: *mut cbw_BrowserWindow,
+        level: cbw_ApplicationMemoryPressure,
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._freeres_buf as *const _ as usize },
-        176usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c_IO_FILE),
-            "::",
-            stringify!(_freeres_buf)
-        )
+}
+extern "C" {
+    #[doc = " Limits the number of `invoke_extern` calls that can be waiting for the GUI thread to `limit`, or lifts the limit if `limit` is 0."]
+    #[doc = " `policy` decides what happens to calls when the limit has been reached."]
+    #[doc = " By default there is no limit, and calls are never dropped."]
+    #[doc = " Calls with binary data or structured values, batched calls, and calls that go to a threaded handler, are not limited."]
+    #[link_name = "\u{1}bw_BrowserWindow_setInvokeQueueLimit"]
+    pub fn cbw_BrowserWindow_setInvokeQueueLimit(
+        bw: *mut cbw_BrowserWindow,
+        limit: csize_t,
+        policy: cbw_BrowserWindowInvokeOverflow,
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>())).__pad5 as *const _ as usize },
-        184usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c_IO_FILE),
-            "::",
-            stringify!(__pad5)
-        )
+}
+extern "C" {
+    #[doc = " Enables or disables the coalescing of scripts executed with `bw_BrowserWindow_execJs`."]
+    #[doc = " When enabled, scripts are buffered and flushed as one script on the next iteration of the event loop,"]
+    #[doc = "  or as soon as the buffer reaches `flush_threshold` bytes."]
+    #[doc = " A `flush_threshold` of 0 selects a default threshold."]
+    #[doc = " Disabling it flushes the buffer right away."]
+    #[link_name = "\u{1}bw_BrowserWindow_setJsCoalescing"]
+    pub fn cbw_BrowserWindow_setJsCoalescing(
+        bw: *mut cbw_BrowserWindow,
+        enabled: cBOOL,
+        flush_threshold: csize_t,
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._mode as *const _ as usize },
-        192usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c_IO_FILE),
-            "::",
-            stringify!(_mode)
-        )
+}
+extern "C" {
+    #[doc = " Creates a new browser window"]
+    #[link_name = "\u{1}bw_BrowserWindow_new"]
+    pub fn cbw_BrowserWindow_new(
+        app: *mut cbw_Application,
+        parent: *const cbw_Window,
+        source: cbw_BrowserWindowSource,
+        _title: cbw_CStrSlice,
+        width: ::std::os::raw::c_int,
+        height: ::std::os::raw::c_int,
+        window_options: *const cbw_WindowOptions,
+        browser_window_options: *const cbw_BrowserWindowOptions,
+        handler: cbw_BrowserWindowHandlerFn,
+        user_data: *mut ::std::os::raw::c_void,
+        callback: cbw_BrowserWindowCreationCallbackFn,
+        callback_data: *mut ::std::os::raw::c_void,
     );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._unused2 as *const _ as usize },
-        196usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(c_IO_FILE),
-            "::",
-            stringify!(_unused2)
-        )
+}
+extern "C" {
+    #[doc = " Creates a browser window for each of the `count` specs, all at once, so that their renderers start up at the same time."]
+    #[doc = " `callback` is invoked once, when the last of them has been created, which is never from within this function."]
+    #[doc = " The specs and what they point to only need to stay around during this call."]
+    #[link_name = "\u{1}bw_BrowserWindow_newMany"]
+    pub fn cbw_BrowserWindow_newMany(
+        app: *mut cbw_Application,
+        specs: *const cbw_BrowserWindowSpec,
+        count: csize_t,
+        callback: cbw_BrowserWindowManyCreationCallbackFn,
+        callback_data: *mut ::std::os::raw::c_void,
     );
 }
-pub type cfpos_t = c__fpos_t;
 extern "C" {
-    #[link_name = "\u{1}stdin"]
-    pub static mut cstdin: *mut cFILE;
+    #[doc = " Should be called by the browser engine on the GUI thread, when something has happened to the page."]
+    #[doc = " Keeps the url and title up to date, and passes the event on to the event handler and the `on_loaded` callback of the window."]
+    #[link_name = "\u{1}_bw_BrowserWindow_onEvent"]
+    pub fn c_bw_BrowserWindow_onEvent(
+        bw: *mut cbw_BrowserWindow,
+        event: *const cbw_BrowserWindowEvent,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}stdout"]
-    pub static mut cstdout: *mut cFILE;
+    #[doc = " Starts recording trace events into a ring buffer of `capacity` events for every thread that records them, throwing away the ones of an earlier recording."]
+    #[doc = " When a buffer is full, the oldest events in it are overwritten."]
+    #[doc = " The capacity of a thread's buffer is fixed the first time the thread records an event."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Trace_start"]
+    pub fn cbw_Trace_start(capacity: csize_t);
 }
 extern "C" {
-    #[link_name = "\u{1}stderr"]
-    pub static mut cstderr: *mut cFILE;
+    #[doc = " Stops recording trace events."]
+    #[doc = " The recorded events are kept, so that they can be written with bw_Trace_write."]
+    #[doc = " This function is thread safe."]
+    #[link_name = "\u{1}bw_Trace_stop"]
+    pub fn cbw_Trace_stop();
 }
 extern "C" {
-    #[link_name = "\u{1}remove"]
-    pub fn cremove(__filename: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+    #[doc = " Returns the time at which a span starts, or 0 if tracing is disabled."]
+    #[link_name = "\u{1}bw_Trace_begin"]
+    pub fn cbw_Trace_begin() -> u64;
 }
 extern "C" {
-    #[link_name = "\u{1}rename"]
-    pub fn crename(
-        __old: *const ::std::os::raw::c_char,
-        __new: *const ::std::os::raw::c_char,
+    #[doc = " Records a span that started at `begin`, and ends now."]
+    #[doc = " `name` is kept as it is, so it needs to be a static string."]
+    #[link_name = "\u{1}bw_Trace_end"]
+    pub fn cbw_Trace_end(name: *const ::std::os::raw::c_char, begin: u64);
+}
+extern "C" {
+    #[doc = " Records an event without a duration, if tracing is enabled."]
+    #[doc = " `name` is kept as it is, so it needs to be a static string."]
+    #[link_name = "\u{1}bw_Trace_instant"]
+    pub fn cbw_Trace_instant(name: *const ::std::os::raw::c_char);
+}
+extern "C" {
+    #[doc = " Writes the recorded events to a file at `path`, as a trace in Chrome's JSON trace event format."]
+    #[doc = " If `engine_trace` is not empty, it is the path of a trace that the browser engine has written, with which the events are merged."]
+    #[doc = " In that case, the events appear next to those of the engine's browser process, and the file at `engine_trace` is removed."]
+    #[doc = " Should only be called after tracing has stopped."]
+    #[link_name = "\u{1}bw_Trace_write"]
+    pub fn cbw_Trace_write(path: cbw_CStrSlice, engine_trace: cbw_CStrSlice) -> cbw_Err;
+}
+extern "C" {
+    #[link_name = "\u{1}alloca"]
+    pub fn calloca(__size: ::std::os::raw::c_ulong) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}valloc"]
+    pub fn cvalloc(__size: csize_t) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}posix_memalign"]
+    pub fn cposix_memalign(
+        __memptr: *mut *mut ::std::os::raw::c_void,
+        __alignment: csize_t,
+        __size: csize_t,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}renameat"]
-    pub fn crenameat(
-        __oldfd: ::std::os::raw::c_int,
-        __old: *const ::std::os::raw::c_char,
-        __newfd: ::std::os::raw::c_int,
-        __new: *const ::std::os::raw::c_char,
+    #[link_name = "\u{1}aligned_alloc"]
+    pub fn caligned_alloc(__alignment: csize_t, __size: csize_t) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}abort"]
+    pub fn cabort();
+}
+extern "C" {
+    #[link_name = "\u{1}atexit"]
+    pub fn catexit(__func: ::std::option::Option<unsafe extern "C" fn()>) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}at_quick_exit"]
+    pub fn cat_quick_exit(
+        __func: ::std::option::Option<unsafe extern "C" fn()>,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}tmpfile"]
-    pub fn ctmpfile() -> *mut cFILE;
+    #[link_name = "\u{1}on_exit"]
+    pub fn con_exit(
+        __func: ::std::option::Option<
+            unsafe extern "C" fn(
+                __status: ::std::os::raw::c_int,
+                __arg: *mut ::std::os::raw::c_void,
+            ),
+        >,
+        __arg: *mut ::std::os::raw::c_void,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}tmpnam"]
-    pub fn ctmpnam(__s: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+    #[link_name = "\u{1}exit"]
+    pub fn cexit(__status: ::std::os::raw::c_int);
 }
 extern "C" {
-    #[link_name = "\u{1}tmpnam_r"]
-    pub fn ctmpnam_r(__s: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+    #[link_name = "\u{1}quick_exit"]
+    pub fn cquick_exit(__status: ::std::os::raw::c_int);
 }
 extern "C" {
-    #[link_name = "\u{1}tempnam"]
-    pub fn ctempnam(
-        __dir: *const ::std::os::raw::c_char,
-        __pfx: *const ::std::os::raw::c_char,
+    #[link_name = "\u{1}_Exit"]
+    pub fn c_Exit(__status: ::std::os::raw::c_int);
+}
+extern "C" {
+    #[link_name = "\u{1}getenv"]
+    pub fn cgetenv(__name: *const ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}putenv"]
+    pub fn cputenv(__string: *mut ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}setenv"]
+    pub fn csetenv(
+        __name: *const ::std::os::raw::c_char,
+        __value: *const ::std::os::raw::c_char,
+        __replace: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}unsetenv"]
+    pub fn cunsetenv(__name: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}clearenv"]
+    pub fn cclearenv() -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}mktemp"]
+    pub fn cmktemp(__template: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}mkstemp"]
+    pub fn cmkstemp(__template: *mut ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}mkstemps"]
+    pub fn cmkstemps(
+        __template: *mut ::std::os::raw::c_char,
+        __suffixlen: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}mkdtemp"]
+    pub fn cmkdtemp(__template: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}system"]
+    pub fn csystem(__command: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}realpath"]
+    pub fn crealpath(
+        __name: *const ::std::os::raw::c_char,
+        __resolved: *mut ::std::os::raw::c_char,
     ) -> *mut ::std::os::raw::c_char;
 }
+pub type c__compar_fn_t = ::std::option::Option<
+    unsafe extern "C" fn(
+        arg1: *const ::std::os::raw::c_void,
+        arg2: *const ::std::os::raw::c_void,
+    ) -> ::std::os::raw::c_int,
+>;
+extern "C" {
+    #[link_name = "\u{1}bsearch"]
+    pub fn cbsearch(
+        __key: *const ::std::os::raw::c_void,
+        __base: *const ::std::os::raw::c_void,
+        __nmemb: csize_t,
+        __size: csize_t,
+        __compar: c__compar_fn_t,
+    ) -> *mut ::std::os::raw::c_void;
+}
+extern "C" {
+    #[link_name = "\u{1}qsort"]
+    pub fn cqsort(
+        __base: *mut ::std::os::raw::c_void,
+        __nmemb: csize_t,
+        __size: csize_t,
+        __compar: c__compar_fn_t,
+    );
+}
+extern "C" {
+    #[link_name = "\u{1}abs"]
+    pub fn cabs(__x: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}labs"]
+    pub fn clabs(__x: ::std::os::raw::c_long) -> ::std::os::raw::c_long;
+}
+extern "C" {
+    #[link_name = "\u{1}llabs"]
+    pub fn cllabs(__x: ::std::os::raw::c_longlong) -> ::std::os::raw::c_longlong;
+}
 extern "C" {
-    #[link_name = "\u{1}fclose"]
-    pub fn cfclose(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}div"]
+    pub fn cdiv(__numer: ::std::os::raw::c_int, __denom: ::std::os::raw::c_int) -> cdiv_t;
 }
 extern "C" {
-    #[link_name = "\u{1}fflush"]
-    pub fn cfflush(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}ldiv"]
+    pub fn cldiv(__numer: ::std::os::raw::c_long, __denom: ::std::os::raw::c_long) -> cldiv_t;
 }
 extern "C" {
-    #[link_name = "\u{1}fflush_unlocked"]
-    pub fn cfflush_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}lldiv"]
+    pub fn clldiv(
+        __numer: ::std::os::raw::c_longlong,
+        __denom: ::std::os::raw::c_longlong,
+    ) -> clldiv_t;
 }
 extern "C" {
-    #[link_name = "\u{1}fopen"]
-    pub fn cfopen(
-        __filename: *const ::std::os::raw::c_char,
-        __modes: *const ::std::os::raw::c_char,
-    ) -> *mut cFILE;
+    #[link_name = "\u{1}ecvt"]
+    pub fn cecvt(
+        __value: f64,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}freopen"]
-    pub fn cfreopen(
-        __filename: *const ::std::os::raw::c_char,
-        __modes: *const ::std::os::raw::c_char,
-        __stream: *mut cFILE,
-    ) -> *mut cFILE;
+    #[link_name = "\u{1}fcvt"]
+    pub fn cfcvt(
+        __value: f64,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fdopen"]
-    pub fn cfdopen(
-        __fd: ::std::os::raw::c_int,
-        __modes: *const ::std::os::raw::c_char,
-    ) -> *mut cFILE;
+    #[link_name = "\u{1}gcvt"]
+    pub fn cgcvt(
+        __value: f64,
+        __ndigit: ::std::os::raw::c_int,
+        __buf: *mut ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fmemopen"]
-    pub fn cfmemopen(
-        __s: *mut ::std::os::raw::c_void,
-        __len: csize_t,
-        __modes: *const ::std::os::raw::c_char,
-    ) -> *mut cFILE;
+    #[link_name = "\u{1}qecvt"]
+    pub fn cqecvt(
+        __value: u128,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}open_memstream"]
-    pub fn copen_memstream(
-        __bufloc: *mut *mut ::std::os::raw::c_char,
-        __sizeloc: *mut csize_t,
-    ) -> *mut cFILE;
+    #[link_name = "\u{1}qfcvt"]
+    pub fn cqfcvt(
+        __value: u128,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}setbuf"]
-    pub fn csetbuf(__stream: *mut cFILE, __buf: *mut ::std::os::raw::c_char);
+    #[link_name = "\u{1}qgcvt"]
+    pub fn cqgcvt(
+        __value: u128,
+        __ndigit: ::std::os::raw::c_int,
+        __buf: *mut ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}setvbuf"]
-    pub fn csetvbuf(
-        __stream: *mut cFILE,
+    #[link_name = "\u{1}ecvt_r"]
+    pub fn cecvt_r(
+        __value: f64,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
         __buf: *mut ::std::os::raw::c_char,
-        __modes: ::std::os::raw::c_int,
-        __n: csize_t,
+        __len: csize_t,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}setbuffer"]
-    pub fn csetbuffer(__stream: *mut cFILE, __buf: *mut ::std::os::raw::c_char, __size: csize_t);
+    #[link_name = "\u{1}fcvt_r"]
+    pub fn cfcvt_r(
+        __value: f64,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
+        __buf: *mut ::std::os::raw::c_char,
+        __len: csize_t,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}setlinebuf"]
-    pub fn csetlinebuf(__stream: *mut cFILE);
+    #[link_name = "\u{1}qecvt_r"]
+    pub fn cqecvt_r(
+        __value: u128,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
+        __buf: *mut ::std::os::raw::c_char,
+        __len: csize_t,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}fprintf"]
-    pub fn cfprintf(
-        __stream: *mut cFILE,
-        __format: *const ::std::os::raw::c_char,
-        ...
+    #[link_name = "\u{1}qfcvt_r"]
+    pub fn cqfcvt_r(
+        __value: u128,
+        __ndigit: ::std::os::raw::c_int,
+        __decpt: *mut ::std::os::raw::c_int,
+        __sign: *mut ::std::os::raw::c_int,
+        __buf: *mut ::std::os::raw::c_char,
+        __len: csize_t,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}printf"]
-    pub fn cprintf(__format: *const ::std::os::raw::c_char, ...) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}mblen"]
+    pub fn cmblen(__s: *const ::std::os::raw::c_char, __n: csize_t) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}sprintf"]
-    pub fn csprintf(
-        __s: *mut ::std::os::raw::c_char,
-        __format: *const ::std::os::raw::c_char,
-        ...
+    #[link_name = "\u{1}mbtowc"]
+    pub fn cmbtowc(
+        __pwc: *mut cwchar_t,
+        __s: *const ::std::os::raw::c_char,
+        __n: csize_t,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}vfprintf"]
-    pub fn cvfprintf(
-        __s: *mut cFILE,
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}wctomb"]
+    pub fn cwctomb(__s: *mut ::std::os::raw::c_char, __wchar: cwchar_t) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}vprintf"]
-    pub fn cvprintf(
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}mbstowcs"]
+    pub fn cmbstowcs(
+        __pwcs: *mut cwchar_t,
+        __s: *const ::std::os::raw::c_char,
+        __n: csize_t,
+    ) -> csize_t;
 }
 extern "C" {
-    #[link_name = "\u{1}vsprintf"]
-    pub fn cvsprintf(
+    #[link_name = "\u{1}wcstombs"]
+    pub fn cwcstombs(
         __s: *mut ::std::os::raw::c_char,
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
-    ) -> ::std::os::raw::c_int;
+        __pwcs: *const cwchar_t,
+        __n: csize_t,
+    ) -> csize_t;
 }
 extern "C" {
-    #[link_name = "\u{1}snprintf"]
-    pub fn csnprintf(
-        __s: *mut ::std::os::raw::c_char,
-        __maxlen: ::std::os::raw::c_ulong,
-        __format: *const ::std::os::raw::c_char,
-        ...
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}rpmatch"]
+    pub fn crpmatch(__response: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}vsnprintf"]
-    pub fn cvsnprintf(
-        __s: *mut ::std::os::raw::c_char,
-        __maxlen: ::std::os::raw::c_ulong,
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
+    #[link_name = "\u{1}getsubopt"]
+    pub fn cgetsubopt(
+        __optionp: *mut *mut ::std::os::raw::c_char,
+        __tokens: *const *mut ::std::os::raw::c_char,
+        __valuep: *mut *mut ::std::os::raw::c_char,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}vdprintf"]
-    pub fn cvdprintf(
-        __fd: ::std::os::raw::c_int,
-        __fmt: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
+    #[link_name = "\u{1}getloadavg"]
+    pub fn cgetloadavg(
+        __loadavg: *mut f64,
+        __nelem: ::std::os::raw::c_int,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}dprintf"]
-    pub fn cdprintf(
-        __fd: ::std::os::raw::c_int,
-        __fmt: *const ::std::os::raw::c_char,
-        ...
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}memcpy"]
+    pub fn cmemcpy(
+        __dest: *mut ::std::os::raw::c_void,
+        __src: *const ::std::os::raw::c_void,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_void;
 }
 extern "C" {
-    #[link_name = "\u{1}fscanf"]
-    pub fn cfscanf(
-        __stream: *mut cFILE,
-        __format: *const ::std::os::raw::c_char,
-        ...
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}memmove"]
+    pub fn cmemmove(
+        __dest: *mut ::std::os::raw::c_void,
+        __src: *const ::std::os::raw::c_void,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_void;
 }
 extern "C" {
-    #[link_name = "\u{1}scanf"]
-    pub fn cscanf(__format: *const ::std::os::raw::c_char, ...) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}memccpy"]
+    pub fn cmemccpy(
+        __dest: *mut ::std::os::raw::c_void,
+        __src: *const ::std::os::raw::c_void,
+        __c: ::std::os::raw::c_int,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_void;
 }
 extern "C" {
-    #[link_name = "\u{1}sscanf"]
-    pub fn csscanf(
-        __s: *const ::std::os::raw::c_char,
-        __format: *const ::std::os::raw::c_char,
-        ...
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}memset"]
+    pub fn cmemset(
+        __s: *mut ::std::os::raw::c_void,
+        __c: ::std::os::raw::c_int,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_void;
 }
 extern "C" {
-    #[link_name = "\u{1}__isoc99_fscanf"]
-    pub fn cfscanf1(
-        __stream: *mut cFILE,
-        __format: *const ::std::os::raw::c_char,
-        ...
+    #[link_name = "\u{1}memcmp"]
+    pub fn cmemcmp(
+        __s1: *const ::std::os::raw::c_void,
+        __s2: *const ::std::os::raw::c_void,
+        __n: ::std::os::raw::c_ulong,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}__isoc99_scanf"]
-    pub fn cscanf1(__format: *const ::std::os::raw::c_char, ...) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}memchr"]
+    pub fn cmemchr(
+        __s: *const ::std::os::raw::c_void,
+        __c: ::std::os::raw::c_int,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_void;
 }
 extern "C" {
-    #[link_name = "\u{1}__isoc99_sscanf"]
-    pub fn csscanf1(
-        __s: *const ::std::os::raw::c_char,
-        __format: *const ::std::os::raw::c_char,
-        ...
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strcpy"]
+    pub fn cstrcpy(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}vfscanf"]
-    pub fn cvfscanf(
-        __s: *mut cFILE,
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strncpy"]
+    pub fn cstrncpy(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}vscanf"]
-    pub fn cvscanf(
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strcat"]
+    pub fn cstrcat(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}vsscanf"]
-    pub fn cvsscanf(
-        __s: *const ::std::os::raw::c_char,
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strncat"]
+    pub fn cstrncat(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}__isoc99_vfscanf"]
-    pub fn cvfscanf1(
-        __s: *mut cFILE,
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
+    #[link_name = "\u{1}strcmp"]
+    pub fn cstrcmp(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}__isoc99_vscanf"]
-    pub fn cvscanf1(
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
+    #[link_name = "\u{1}strncmp"]
+    pub fn cstrncmp(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_ulong,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}__isoc99_vsscanf"]
-    pub fn cvsscanf1(
-        __s: *const ::std::os::raw::c_char,
-        __format: *const ::std::os::raw::c_char,
-        __arg: *mut c__va_list_tag,
+    #[link_name = "\u{1}strcoll"]
+    pub fn cstrcoll(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}fgetc"]
-    pub fn cfgetc(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strxfrm"]
+    pub fn cstrxfrm(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_ulong,
+    ) -> ::std::os::raw::c_ulong;
 }
-extern "C" {
-    #[link_name = "\u{1}getc"]
-    pub fn cgetc(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c__locale_struct {
+    pub __locales: [*mut c__locale_data; 13usize],
+    pub __ctype_b: *const ::std::os::raw::c_ushort,
+    pub __ctype_tolower: *const ::std::os::raw::c_int,
+    pub __ctype_toupper: *const ::std::os::raw::c_int,
+    pub __names: [*const ::std::os::raw::c_char; 13usize],
+}
+#[test]
+fn bindgen_test_layout_c__locale_struct() {
+    assert_eq!(
+        ::std::mem::size_of::<c__locale_struct>(),
+        232usize,
+        concat!("Size of: ", stringify!(c__locale_struct))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__locale_struct>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c__locale_struct))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__locale_struct>())).__locales as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__locale_struct),
+            "::",
+            stringify!(__locales)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__locale_struct>())).__ctype_b as *const _ as usize },
+        104usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__locale_struct),
+            "::",
+            stringify!(__ctype_b)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__locale_struct>())).__ctype_tolower as *const _ as usize
+        },
+        112usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__locale_struct),
+            "::",
+            stringify!(__ctype_tolower)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__locale_struct>())).__ctype_toupper as *const _ as usize
+        },
+        120usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__locale_struct),
+            "::",
+            stringify!(__ctype_toupper)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__locale_struct>())).__names as *const _ as usize },
+        128usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__locale_struct),
+            "::",
+            stringify!(__names)
+        )
+    );
 }
+pub type c__locale_t = *mut c__locale_struct;
+pub type clocale_t = c__locale_t;
 extern "C" {
-    #[link_name = "\u{1}getchar"]
-    pub fn cgetchar() -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strcoll_l"]
+    pub fn cstrcoll_l(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
+        __l: clocale_t,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}getc_unlocked"]
-    pub fn cgetc_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strxfrm_l"]
+    pub fn cstrxfrm_l(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+        __n: csize_t,
+        __l: clocale_t,
+    ) -> csize_t;
 }
 extern "C" {
-    #[link_name = "\u{1}getchar_unlocked"]
-    pub fn cgetchar_unlocked() -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strdup"]
+    pub fn cstrdup(__s: *const ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fgetc_unlocked"]
-    pub fn cfgetc_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strndup"]
+    pub fn cstrndup(
+        __string: *const ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fputc"]
-    pub fn cfputc(__c: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strchr"]
+    pub fn cstrchr(
+        __s: *const ::std::os::raw::c_char,
+        __c: ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}putc"]
-    pub fn cputc(__c: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strrchr"]
+    pub fn cstrrchr(
+        __s: *const ::std::os::raw::c_char,
+        __c: ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}putchar"]
-    pub fn cputchar(__c: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strcspn"]
+    pub fn cstrcspn(
+        __s: *const ::std::os::raw::c_char,
+        __reject: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_ulong;
 }
 extern "C" {
-    #[link_name = "\u{1}fputc_unlocked"]
-    pub fn cfputc_unlocked(
-        __c: ::std::os::raw::c_int,
-        __stream: *mut cFILE,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strspn"]
+    pub fn cstrspn(
+        __s: *const ::std::os::raw::c_char,
+        __accept: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_ulong;
 }
 extern "C" {
-    #[link_name = "\u{1}putc_unlocked"]
-    pub fn cputc_unlocked(
-        __c: ::std::os::raw::c_int,
-        __stream: *mut cFILE,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strpbrk"]
+    pub fn cstrpbrk(
+        __s: *const ::std::os::raw::c_char,
+        __accept: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}putchar_unlocked"]
-    pub fn cputchar_unlocked(__c: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strstr"]
+    pub fn cstrstr(
+        __haystack: *const ::std::os::raw::c_char,
+        __needle: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}getw"]
-    pub fn cgetw(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strtok"]
+    pub fn cstrtok(
+        __s: *mut ::std::os::raw::c_char,
+        __delim: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}putw"]
-    pub fn cputw(__w: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}__strtok_r"]
+    pub fn c__strtok_r(
+        __s: *mut ::std::os::raw::c_char,
+        __delim: *const ::std::os::raw::c_char,
+        __save_ptr: *mut *mut ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fgets"]
-    pub fn cfgets(
+    #[link_name = "\u{1}strtok_r"]
+    pub fn cstrtok_r(
         __s: *mut ::std::os::raw::c_char,
-        __n: ::std::os::raw::c_int,
-        __stream: *mut cFILE,
+        __delim: *const ::std::os::raw::c_char,
+        __save_ptr: *mut *mut ::std::os::raw::c_char,
     ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}__getdelim"]
-    pub fn c__getdelim(
-        __lineptr: *mut *mut ::std::os::raw::c_char,
-        __n: *mut csize_t,
-        __delimiter: ::std::os::raw::c_int,
-        __stream: *mut cFILE,
-    ) -> c__ssize_t;
+    #[link_name = "\u{1}strlen"]
+    pub fn cstrlen(__s: *const ::std::os::raw::c_char) -> ::std::os::raw::c_ulong;
 }
 extern "C" {
-    #[link_name = "\u{1}getdelim"]
-    pub fn cgetdelim(
-        __lineptr: *mut *mut ::std::os::raw::c_char,
-        __n: *mut csize_t,
-        __delimiter: ::std::os::raw::c_int,
-        __stream: *mut cFILE,
-    ) -> c__ssize_t;
+    #[link_name = "\u{1}strnlen"]
+    pub fn cstrnlen(__string: *const ::std::os::raw::c_char, __maxlen: csize_t) -> csize_t;
 }
 extern "C" {
-    #[link_name = "\u{1}getline"]
-    pub fn cgetline(
-        __lineptr: *mut *mut ::std::os::raw::c_char,
-        __n: *mut csize_t,
-        __stream: *mut cFILE,
-    ) -> c__ssize_t;
+    #[link_name = "\u{1}strerror"]
+    pub fn cstrerror(__errnum: ::std::os::raw::c_int) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fputs"]
-    pub fn cfputs(
-        __s: *const ::std::os::raw::c_char,
-        __stream: *mut cFILE,
+    #[link_name = "\u{1}__xpg_strerror_r"]
+    pub fn cstrerror_r(
+        __errnum: ::std::os::raw::c_int,
+        __buf: *mut ::std::os::raw::c_char,
+        __buflen: csize_t,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}puts"]
-    pub fn cputs(__s: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strerror_l"]
+    pub fn cstrerror_l(
+        __errnum: ::std::os::raw::c_int,
+        __l: clocale_t,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}ungetc"]
-    pub fn cungetc(__c: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}bcmp"]
+    pub fn cbcmp(
+        __s1: *const ::std::os::raw::c_void,
+        __s2: *const ::std::os::raw::c_void,
+        __n: ::std::os::raw::c_ulong,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}fread"]
-    pub fn cfread(
-        __ptr: *mut ::std::os::raw::c_void,
-        __size: ::std::os::raw::c_ulong,
-        __n: ::std::os::raw::c_ulong,
-        __stream: *mut cFILE,
-    ) -> ::std::os::raw::c_ulong;
+    #[link_name = "\u{1}bcopy"]
+    pub fn cbcopy(
+        __src: *const ::std::os::raw::c_void,
+        __dest: *mut ::std::os::raw::c_void,
+        __n: csize_t,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}fwrite"]
-    pub fn cfwrite(
-        __ptr: *const ::std::os::raw::c_void,
-        __size: ::std::os::raw::c_ulong,
-        __n: ::std::os::raw::c_ulong,
-        __s: *mut cFILE,
-    ) -> ::std::os::raw::c_ulong;
+    #[link_name = "\u{1}bzero"]
+    pub fn cbzero(__s: *mut ::std::os::raw::c_void, __n: ::std::os::raw::c_ulong);
 }
 extern "C" {
-    #[link_name = "\u{1}fread_unlocked"]
-    pub fn cfread_unlocked(
-        __ptr: *mut ::std::os::raw::c_void,
-        __size: csize_t,
-        __n: csize_t,
-        __stream: *mut cFILE,
-    ) -> csize_t;
+    #[link_name = "\u{1}index"]
+    pub fn cindex(
+        __s: *const ::std::os::raw::c_char,
+        __c: ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fwrite_unlocked"]
-    pub fn cfwrite_unlocked(
-        __ptr: *const ::std::os::raw::c_void,
-        __size: csize_t,
-        __n: csize_t,
-        __stream: *mut cFILE,
-    ) -> csize_t;
+    #[link_name = "\u{1}rindex"]
+    pub fn crindex(
+        __s: *const ::std::os::raw::c_char,
+        __c: ::std::os::raw::c_int,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}fseek"]
-    pub fn cfseek(
-        __stream: *mut cFILE,
-        __off: ::std::os::raw::c_long,
-        __whence: ::std::os::raw::c_int,
-    ) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}ffs"]
+    pub fn cffs(__i: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}ftell"]
-    pub fn cftell(__stream: *mut cFILE) -> ::std::os::raw::c_long;
+    #[link_name = "\u{1}ffsl"]
+    pub fn cffsl(__l: ::std::os::raw::c_long) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}rewind"]
-    pub fn crewind(__stream: *mut cFILE);
+    #[link_name = "\u{1}ffsll"]
+    pub fn cffsll(__ll: ::std::os::raw::c_longlong) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}fseeko"]
-    pub fn cfseeko(
-        __stream: *mut cFILE,
-        __off: c__off_t,
-        __whence: ::std::os::raw::c_int,
+    #[link_name = "\u{1}strcasecmp"]
+    pub fn cstrcasecmp(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
     ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}ftello"]
-    pub fn cftello(__stream: *mut cFILE) -> c__off_t;
+    #[link_name = "\u{1}strncasecmp"]
+    pub fn cstrncasecmp(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_ulong,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}fgetpos"]
-    pub fn cfgetpos(__stream: *mut cFILE, __pos: *mut cfpos_t) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strcasecmp_l"]
+    pub fn cstrcasecmp_l(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
+        __loc: clocale_t,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}fsetpos"]
-    pub fn cfsetpos(__stream: *mut cFILE, __pos: *const cfpos_t) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strncasecmp_l"]
+    pub fn cstrncasecmp_l(
+        __s1: *const ::std::os::raw::c_char,
+        __s2: *const ::std::os::raw::c_char,
+        __n: csize_t,
+        __loc: clocale_t,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}clearerr"]
-    pub fn cclearerr(__stream: *mut cFILE);
+    #[link_name = "\u{1}explicit_bzero"]
+    pub fn cexplicit_bzero(__s: *mut ::std::os::raw::c_void, __n: csize_t);
 }
 extern "C" {
-    #[link_name = "\u{1}feof"]
-    pub fn cfeof(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strsep"]
+    pub fn cstrsep(
+        __stringp: *mut *mut ::std::os::raw::c_char,
+        __delim: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}ferror"]
-    pub fn cferror(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}strsignal"]
+    pub fn cstrsignal(__sig: ::std::os::raw::c_int) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}clearerr_unlocked"]
-    pub fn cclearerr_unlocked(__stream: *mut cFILE);
+    #[link_name = "\u{1}__stpcpy"]
+    pub fn c__stpcpy(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}feof_unlocked"]
-    pub fn cfeof_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}stpcpy"]
+    pub fn cstpcpy(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}ferror_unlocked"]
-    pub fn cferror_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}__stpncpy"]
+    pub fn c__stpncpy(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+        __n: csize_t,
+    ) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}perror"]
-    pub fn cperror(__s: *const ::std::os::raw::c_char);
+    #[link_name = "\u{1}stpncpy"]
+    pub fn cstpncpy(
+        __dest: *mut ::std::os::raw::c_char,
+        __src: *const ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_ulong,
+    ) -> *mut ::std::os::raw::c_char;
 }
+pub type cint_least8_t = c__int_least8_t;
+pub type cint_least16_t = c__int_least16_t;
+pub type cint_least32_t = c__int_least32_t;
+pub type cint_least64_t = c__int_least64_t;
+pub type cuint_least8_t = c__uint_least8_t;
+pub type cuint_least16_t = c__uint_least16_t;
+pub type cuint_least32_t = c__uint_least32_t;
+pub type cuint_least64_t = c__uint_least64_t;
+pub type cint_fast8_t = ::std::os::raw::c_schar;
+pub type cint_fast16_t = ::std::os::raw::c_long;
+pub type cint_fast32_t = ::std::os::raw::c_long;
+pub type cint_fast64_t = ::std::os::raw::c_long;
+pub type cuint_fast8_t = ::std::os::raw::c_uchar;
+pub type cuint_fast16_t = ::std::os::raw::c_ulong;
+pub type cuint_fast32_t = ::std::os::raw::c_ulong;
+pub type cuint_fast64_t = ::std::os::raw::c_ulong;
+pub type cintmax_t = c__intmax_t;
+pub type cuintmax_t = c__uintmax_t;
 extern "C" {
-    #[link_name = "\u{1}sys_nerr"]
-    pub static mut csys_nerr: ::std::os::raw::c_int;
+    #[link_name = "\u{1}__assert_fail"]
+    pub fn c__assert_fail(
+        __assertion: *const ::std::os::raw::c_char,
+        __file: *const ::std::os::raw::c_char,
+        __line: ::std::os::raw::c_uint,
+        __function: *const ::std::os::raw::c_char,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}sys_errlist"]
-    pub static mut csys_errlist: [*const ::std::os::raw::c_char; 0usize];
+    #[link_name = "\u{1}__assert_perror_fail"]
+    pub fn c__assert_perror_fail(
+        __errnum: ::std::os::raw::c_int,
+        __file: *const ::std::os::raw::c_char,
+        __line: ::std::os::raw::c_uint,
+        __function: *const ::std::os::raw::c_char,
+    );
 }
 extern "C" {
-    #[link_name = "\u{1}fileno"]
-    pub fn cfileno(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+    #[link_name = "\u{1}__assert"]
+    pub fn c__assert(
+        __assertion: *const ::std::os::raw::c_char,
+        __file: *const ::std::os::raw::c_char,
+        __line: ::std::os::raw::c_int,
+    );
+}
+pub type cva_list = c__builtin_va_list;
+pub type c__gnuc_va_list = c__builtin_va_list;
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct c__mbstate_t {
+    pub __count: ::std::os::raw::c_int,
+    pub __value: c__mbstate_t__bindgen_ty_1,
 }
-extern "C" {
-    #[link_name = "\u{1}fileno_unlocked"]
-    pub fn cfileno_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union c__mbstate_t__bindgen_ty_1 {
+    pub __wch: ::std::os::raw::c_uint,
+    pub __wchb: [::std::os::raw::c_char; 4usize],
+    _bindgen_union_align: u32,
 }
-extern "C" {
-    #[link_name = "\u{1}popen"]
-    pub fn cpopen(
-        __command: *const ::std::os::raw::c_char,
-        __modes: *const ::std::os::raw::c_char,
-    ) -> *mut cFILE;
+#[test]
+fn bindgen_test_layout_c__mbstate_t__bindgen_ty_1() {
+    assert_eq!(
+        ::std::mem::size_of::<c__mbstate_t__bindgen_ty_1>(),
+        4usize,
+        concat!("Size of: ", stringify!(c__mbstate_t__bindgen_ty_1))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__mbstate_t__bindgen_ty_1>(),
+        4usize,
+        concat!("Alignment of ", stringify!(c__mbstate_t__bindgen_ty_1))
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__mbstate_t__bindgen_ty_1>())).__wch as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__mbstate_t__bindgen_ty_1),
+            "::",
+            stringify!(__wch)
+        )
+    );
+    assert_eq!(
+        unsafe {
+            &(*(::std::ptr::null::<c__mbstate_t__bindgen_ty_1>())).__wchb as *const _ as usize
+        },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__mbstate_t__bindgen_ty_1),
+            "::",
+            stringify!(__wchb)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}pclose"]
-    pub fn cpclose(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+#[test]
+fn bindgen_test_layout_c__mbstate_t() {
+    assert_eq!(
+        ::std::mem::size_of::<c__mbstate_t>(),
+        8usize,
+        concat!("Size of: ", stringify!(c__mbstate_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c__mbstate_t>(),
+        4usize,
+        concat!("Alignment of ", stringify!(c__mbstate_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__mbstate_t>())).__count as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__mbstate_t),
+            "::",
+            stringify!(__count)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c__mbstate_t>())).__value as *const _ as usize },
+        4usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c__mbstate_t),
+            "::",
+            stringify!(__value)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}ctermid"]
-    pub fn cctermid(__s: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct c_G_fpos_t {
+    pub __pos: c__off_t,
+    pub __state: c__mbstate_t,
 }
-extern "C" {
-    #[link_name = "\u{1}flockfile"]
-    pub fn cflockfile(__stream: *mut cFILE);
+#[test]
+fn bindgen_test_layout_c_G_fpos_t() {
+    assert_eq!(
+        ::std::mem::size_of::<c_G_fpos_t>(),
+        16usize,
+        concat!("Size of: ", stringify!(c_G_fpos_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c_G_fpos_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c_G_fpos_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c_G_fpos_t>())).__pos as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_G_fpos_t),
+            "::",
+            stringify!(__pos)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c_G_fpos_t>())).__state as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_G_fpos_t),
+            "::",
+            stringify!(__state)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}ftrylockfile"]
-    pub fn cftrylockfile(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+pub type c__fpos_t = c_G_fpos_t;
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct c_G_fpos64_t {
+    pub __pos: c__off64_t,
+    pub __state: c__mbstate_t,
 }
-extern "C" {
-    #[link_name = "\u{1}funlockfile"]
-    pub fn cfunlockfile(__stream: *mut cFILE);
+#[test]
+fn bindgen_test_layout_c_G_fpos64_t() {
+    assert_eq!(
+        ::std::mem::size_of::<c_G_fpos64_t>(),
+        16usize,
+        concat!("Size of: ", stringify!(c_G_fpos64_t))
+    );
+    assert_eq!(
+        ::std::mem::align_of::<c_G_fpos64_t>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c_G_fpos64_t))
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c_G_fpos64_t>())).__pos as *const _ as usize },
+        0usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_G_fpos64_t),
+            "::",
+            stringify!(__pos)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c_G_fpos64_t>())).__state as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_G_fpos64_t),
+            "::",
+            stringify!(__state)
+        )
+    );
 }
-extern "C" {
-    #[link_name = "\u{1}__uflow"]
-    pub fn c__uflow(arg1: *mut cFILE) -> ::std::os::raw::c_int;
+pub type c__fpos64_t = c_G_fpos64_t;
+pub type c__FILE = c_IO_FILE;
+pub type cFILE = c_IO_FILE;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c_IO_marker {
+    _unused: [u8; 0],
 }
-extern "C" {
-    #[link_name = "\u{1}__overflow"]
-    pub fn c__overflow(arg1: *mut cFILE, arg2: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c_IO_codecvt {
+    _unused: [u8; 0],
 }
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
-pub struct cbw_Dims2D {
-    pub width: u16,
-    pub height: u16,
+pub struct c_IO_wide_data {
+    _unused: [u8; 0],
+}
+pub type c_IO_lock_t = ::std::os::raw::c_void;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct c_IO_FILE {
+    pub _flags: ::std::os::raw::c_int,
+    pub _IO_read_ptr: *mut ::std::os::raw::c_char,
+    pub _IO_read_end: *mut ::std::os::raw::c_char,
+    pub _IO_read_base: *mut ::std::os::raw::c_char,
+    pub _IO_write_base: *mut ::std::os::raw::c_char,
+    pub _IO_write_ptr: *mut ::std::os::raw::c_char,
+    pub _IO_write_end: *mut ::std::os::raw::c_char,
+    pub _IO_buf_base: *mut ::std::os::raw::c_char,
+    pub _IO_buf_end: *mut ::std::os::raw::c_char,
+    pub _IO_save_base: *mut ::std::os::raw::c_char,
+    pub _IO_backup_base: *mut ::std::os::raw::c_char,
+    pub _IO_save_end: *mut ::std::os::raw::c_char,
+    pub _markers: *mut c_IO_marker,
+    pub _chain: *mut c_IO_FILE,
+    pub _fileno: ::std::os::raw::c_int,
+    pub _flags2: ::std::os::raw::c_int,
+    pub _old_offset: c__off_t,
+    pub _cur_column: ::std::os::raw::c_ushort,
+    pub _vtable_offset: ::std::os::raw::c_schar,
+    pub _shortbuf: [::std::os::raw::c_char; 1usize],
+    pub _lock: *mut c_IO_lock_t,
+    pub _offset: c__off64_t,
+    pub _codecvt: *mut c_IO_codecvt,
+    pub _wide_data: *mut c_IO_wide_data,
+    pub _freeres_list: *mut c_IO_FILE,
+    pub _freeres_buf: *mut ::std::os::raw::c_void,
+    pub __pad5: csize_t,
+    pub _mode: ::std::os::raw::c_int,
+    pub _unused2: [::std::os::raw::c_char; 20usize],
 }
 #[test]
-fn bindgen_test_layout_cbw_Dims2D() {
+fn bindgen_test_layout_c_IO_FILE() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_Dims2D>(),
-        4usize,
-        concat!("Size of: ", stringify!(cbw_Dims2D))
+        ::std::mem::size_of::<c_IO_FILE>(),
+        216usize,
+        concat!("Size of: ", stringify!(c_IO_FILE))
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_Dims2D>(),
-        2usize,
-        concat!("Alignment of ", stringify!(cbw_Dims2D))
+        ::std::mem::align_of::<c_IO_FILE>(),
+        8usize,
+        concat!("Alignment of ", stringify!(c_IO_FILE))
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Dims2D>())).width as *const _ as usize },
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._flags as *const _ as usize },
         0usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Dims2D),
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_flags)
+        )
+    );
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_read_ptr as *const _ as usize },
+        8usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(width)
+            stringify!(_IO_read_ptr)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Dims2D>())).height as *const _ as usize },
-        2usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_read_end as *const _ as usize },
+        16usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Dims2D),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(height)
+            stringify!(_IO_read_end)
         )
     );
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_Pos2D {
-    pub x: u16,
-    pub y: u16,
-}
-#[test]
-fn bindgen_test_layout_cbw_Pos2D() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_Pos2D>(),
-        4usize,
-        concat!("Size of: ", stringify!(cbw_Pos2D))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_read_base as *const _ as usize },
+        24usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_IO_read_base)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_Pos2D>(),
-        2usize,
-        concat!("Alignment of ", stringify!(cbw_Pos2D))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_write_base as *const _ as usize },
+        32usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_IO_write_base)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Pos2D>())).x as *const _ as usize },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_write_ptr as *const _ as usize },
+        40usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Pos2D),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(x)
+            stringify!(_IO_write_ptr)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Pos2D>())).y as *const _ as usize },
-        2usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_write_end as *const _ as usize },
+        48usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Pos2D),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(y)
+            stringify!(_IO_write_end)
         )
     );
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_WindowImpl {}
-#[test]
-fn bindgen_test_layout_cbw_WindowImpl() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_WindowImpl>(),
-        0usize,
-        concat!("Size of: ", stringify!(cbw_WindowImpl))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_buf_base as *const _ as usize },
+        56usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_IO_buf_base)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_WindowImpl>(),
-        1usize,
-        concat!("Alignment of ", stringify!(cbw_WindowImpl))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_buf_end as *const _ as usize },
+        64usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_IO_buf_end)
+        )
     );
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_WindowCallbacks {
-    #[doc = " Fired just before the window gets destroyed and freed from memory."]
-    #[doc = " Should be implemented to free the user data provided to the window."]
-    pub do_cleanup: ::std::option::Option<unsafe extern "C" fn(arg1: *mut cbw_Window)>,
-    #[doc = " Fired when the window has been closed, either by the user or programmatically."]
-    pub on_close: ::std::option::Option<unsafe extern "C" fn(arg1: *const cbw_Window)>,
-    #[doc = " Fired when a window has finished loading"]
-    pub on_loaded: ::std::option::Option<unsafe extern "C" fn(arg1: *const cbw_Window)>,
-    #[doc = " Fired when a window is resizing"]
-    pub on_resize: ::std::option::Option<
-        unsafe extern "C" fn(
-            arg1: *const cbw_Window,
-            width: ::std::os::raw::c_uint,
-            height: ::std::os::raw::c_uint,
-        ),
-    >,
-}
-#[test]
-fn bindgen_test_layout_cbw_WindowCallbacks() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_WindowCallbacks>(),
-        32usize,
-        concat!("Size of: ", stringify!(cbw_WindowCallbacks))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_save_base as *const _ as usize },
+        72usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_IO_save_base)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_WindowCallbacks>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_WindowCallbacks))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_backup_base as *const _ as usize },
+        80usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_IO_backup_base)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).do_cleanup as *const _ as usize },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._IO_save_end as *const _ as usize },
+        88usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_WindowCallbacks),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(do_cleanup)
+            stringify!(_IO_save_end)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).on_close as *const _ as usize },
-        8usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._markers as *const _ as usize },
+        96usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_WindowCallbacks),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(on_close)
+            stringify!(_markers)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).on_loaded as *const _ as usize },
-        16usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._chain as *const _ as usize },
+        104usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_WindowCallbacks),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(on_loaded)
+            stringify!(_chain)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_WindowCallbacks>())).on_resize as *const _ as usize },
-        24usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._fileno as *const _ as usize },
+        112usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_WindowCallbacks),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(on_resize)
+            stringify!(_fileno)
         )
     );
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_WindowOptions {
-    pub borders: bool,
-    pub minimizable: bool,
-    pub resizable: bool,
-}
-#[test]
-fn bindgen_test_layout_cbw_WindowOptions() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_WindowOptions>(),
-        3usize,
-        concat!("Size of: ", stringify!(cbw_WindowOptions))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._flags2 as *const _ as usize },
+        116usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_flags2)
+        )
     );
     assert_eq!(
-        ::std::mem::align_of::<cbw_WindowOptions>(),
-        1usize,
-        concat!("Alignment of ", stringify!(cbw_WindowOptions))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._old_offset as *const _ as usize },
+        120usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_old_offset)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_WindowOptions>())).borders as *const _ as usize },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._cur_column as *const _ as usize },
+        128usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_WindowOptions),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(borders)
+            stringify!(_cur_column)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_WindowOptions>())).minimizable as *const _ as usize },
-        1usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._vtable_offset as *const _ as usize },
+        130usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_WindowOptions),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(minimizable)
+            stringify!(_vtable_offset)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_WindowOptions>())).resizable as *const _ as usize },
-        2usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._shortbuf as *const _ as usize },
+        131usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_WindowOptions),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(resizable)
+            stringify!(_shortbuf)
         )
     );
-}
-pub type cbw_WindowDispatchFn = ::std::option::Option<
-    unsafe extern "C" fn(window: *mut cbw_Window, data: *mut ::std::os::raw::c_void),
->;
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_WindowDispatchData {
-    _unused: [u8; 0],
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_Window {
-    pub app: *mut cbw_Application,
-    pub parent: *const cbw_Window,
-    pub closed: bool,
-    pub dropped: bool,
-    pub callbacks: cbw_WindowCallbacks,
-    pub user_data: *mut ::std::os::raw::c_void,
-    pub impl_: cbw_WindowImpl,
-}
-#[test]
-fn bindgen_test_layout_cbw_Window() {
     assert_eq!(
-        ::std::mem::size_of::<cbw_Window>(),
-        64usize,
-        concat!("Size of: ", stringify!(cbw_Window))
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._lock as *const _ as usize },
+        136usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_lock)
+        )
     );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_Window>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_Window))
+    assert_eq!(
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._offset as *const _ as usize },
+        144usize,
+        concat!(
+            "Offset of field: ",
+            stringify!(c_IO_FILE),
+            "::",
+            stringify!(_offset)
+        )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Window>())).app as *const _ as usize },
-        0usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._codecvt as *const _ as usize },
+        152usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Window),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(app)
+            stringify!(_codecvt)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Window>())).parent as *const _ as usize },
-        8usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._wide_data as *const _ as usize },
+        160usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Window),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(parent)
+            stringify!(_wide_data)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Window>())).closed as *const _ as usize },
-        16usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._freeres_list as *const _ as usize },
+        168usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Window),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(closed)
+            stringify!(_freeres_list)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Window>())).dropped as *const _ as usize },
-        17usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._freeres_buf as *const _ as usize },
+        176usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Window),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(dropped)
+            stringify!(_freeres_buf)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Window>())).callbacks as *const _ as usize },
-        24usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>())).__pad5 as *const _ as usize },
+        184usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Window),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(callbacks)
+            stringify!(__pad5)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Window>())).user_data as *const _ as usize },
-        56usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._mode as *const _ as usize },
+        192usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Window),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(user_data)
+            stringify!(_mode)
         )
     );
     assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Window>())).impl_ as *const _ as usize },
-        64usize,
+        unsafe { &(*(::std::ptr::null::<c_IO_FILE>()))._unused2 as *const _ as usize },
+        196usize,
         concat!(
             "Offset of field: ",
-            stringify!(cbw_Window),
+            stringify!(c_IO_FILE),
             "::",
-            stringify!(impl_)
+            stringify!(_unused2)
         )
     );
 }
+pub type cfpos_t = c__fpos_t;
 extern "C" {
-    #[doc = " Destroy the window, releasing all resources it holds."]
-    #[doc = " After this call, the handle is considered invalid."]
-    #[link_name = "\u{1}bw_Window_destroy"]
-    pub fn cbw_Window_destroy(window: *mut cbw_Window);
+    #[link_name = "\u{1}stdin"]
+    pub static mut cstdin: *mut cFILE;
 }
 extern "C" {
-    #[doc = " Invalidates the window handle."]
-    #[doc = " The window will get destroyed when it is deemed possible."]
-    #[link_name = "\u{1}bw_Window_drop"]
-    pub fn cbw_Window_drop(window: *mut cbw_Window);
+    #[link_name = "\u{1}stdout"]
+    pub static mut cstdout: *mut cFILE;
 }
 extern "C" {
-    #[doc = " Gets the width and height of the usable area inside the window."]
-    #[link_name = "\u{1}bw_Window_getContentDimensions"]
-    pub fn cbw_Window_getContentDimensions(window: *mut cbw_Window) -> cbw_Dims2D;
+    #[link_name = "\u{1}stderr"]
+    pub static mut cstderr: *mut cFILE;
 }
 extern "C" {
-    #[doc = " Gets the opacity of the window as a value from 0 to 255."]
-    #[link_name = "\u{1}bw_Window_getOpacity"]
-    pub fn cbw_Window_getOpacity(window: *mut cbw_Window) -> u8;
+    #[link_name = "\u{1}remove"]
+    pub fn cremove(__filename: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Gets the X and Y coordinates of the window position relative to the desktop screen."]
-    #[link_name = "\u{1}bw_Window_getPosition"]
-    pub fn cbw_Window_getPosition(window: *mut cbw_Window) -> cbw_Pos2D;
+    #[link_name = "\u{1}rename"]
+    pub fn crename(
+        __old: *const ::std::os::raw::c_char,
+        __new: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Copies as many bytes into `title` that fit in there."]
-    #[doc = " Returns the number of characters the title actually has."]
-    #[link_name = "\u{1}bw_Window_getTitle"]
-    pub fn cbw_Window_getTitle(
-        window: *mut cbw_Window,
-        title: *mut *mut ::std::os::raw::c_char,
-    ) -> csize_t;
+    #[link_name = "\u{1}renameat"]
+    pub fn crenameat(
+        __oldfd: ::std::os::raw::c_int,
+        __old: *const ::std::os::raw::c_char,
+        __newfd: ::std::os::raw::c_int,
+        __new: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Gets the width and height of the window including the title bar and borders."]
-    #[link_name = "\u{1}bw_Window_getWindowDimensions"]
-    pub fn cbw_Window_getWindowDimensions(window: *mut cbw_Window) -> cbw_Dims2D;
+    #[link_name = "\u{1}tmpfile"]
+    pub fn ctmpfile() -> *mut cFILE;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Window_hide"]
-    pub fn cbw_Window_hide(window: *mut cbw_Window);
+    #[link_name = "\u{1}tmpnam"]
+    pub fn ctmpnam(__s: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[doc = " Returns whether or not the window is not hidden."]
-    #[doc = " `bw_Window_show` and `bw_Window_hide` change the visibility."]
-    #[link_name = "\u{1}bw_Window_isVisible"]
-    pub fn cbw_Window_isVisible(window: *const cbw_Window) -> bool;
+    #[link_name = "\u{1}tmpnam_r"]
+    pub fn ctmpnam_r(__s: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[doc = " Creates a new (empty) window"]
-    #[doc = " The returned pointer is a handler for the window."]
-    #[doc = " bw_Window_drop needs to be called on it after it is done being used,"]
-    #[doc = "     otherwise the window is never actually destroyed and memory leakes happen."]
-    #[link_name = "\u{1}bw_Window_new"]
-    pub fn cbw_Window_new(
-        app: *mut cbw_Application,
-        parent: *const cbw_Window,
-        _title: cbw_CStrSlice,
-        width: ::std::os::raw::c_int,
-        height: ::std::os::raw::c_int,
-        options: *const cbw_WindowOptions,
-        user_data: *mut ::std::os::raw::c_void,
-    ) -> *mut cbw_Window;
+    #[link_name = "\u{1}tempnam"]
+    pub fn ctempnam(
+        __dir: *const ::std::os::raw::c_char,
+        __pfx: *const ::std::os::raw::c_char,
+    ) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}fclose"]
+    pub fn cfclose(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}fflush"]
+    pub fn cfflush(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}fflush_unlocked"]
+    pub fn cfflush_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}fopen"]
+    pub fn cfopen(
+        __filename: *const ::std::os::raw::c_char,
+        __modes: *const ::std::os::raw::c_char,
+    ) -> *mut cFILE;
+}
+extern "C" {
+    #[link_name = "\u{1}freopen"]
+    pub fn cfreopen(
+        __filename: *const ::std::os::raw::c_char,
+        __modes: *const ::std::os::raw::c_char,
+        __stream: *mut cFILE,
+    ) -> *mut cFILE;
+}
+extern "C" {
+    #[link_name = "\u{1}fdopen"]
+    pub fn cfdopen(
+        __fd: ::std::os::raw::c_int,
+        __modes: *const ::std::os::raw::c_char,
+    ) -> *mut cFILE;
+}
+extern "C" {
+    #[link_name = "\u{1}fmemopen"]
+    pub fn cfmemopen(
+        __s: *mut ::std::os::raw::c_void,
+        __len: csize_t,
+        __modes: *const ::std::os::raw::c_char,
+    ) -> *mut cFILE;
+}
+extern "C" {
+    #[link_name = "\u{1}open_memstream"]
+    pub fn copen_memstream(
+        __bufloc: *mut *mut ::std::os::raw::c_char,
+        __sizeloc: *mut csize_t,
+    ) -> *mut cFILE;
+}
+extern "C" {
+    #[link_name = "\u{1}setbuf"]
+    pub fn csetbuf(__stream: *mut cFILE, __buf: *mut ::std::os::raw::c_char);
+}
+extern "C" {
+    #[link_name = "\u{1}setvbuf"]
+    pub fn csetvbuf(
+        __stream: *mut cFILE,
+        __buf: *mut ::std::os::raw::c_char,
+        __modes: ::std::os::raw::c_int,
+        __n: csize_t,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}setbuffer"]
+    pub fn csetbuffer(__stream: *mut cFILE, __buf: *mut ::std::os::raw::c_char, __size: csize_t);
+}
+extern "C" {
+    #[link_name = "\u{1}setlinebuf"]
+    pub fn csetlinebuf(__stream: *mut cFILE);
+}
+extern "C" {
+    #[link_name = "\u{1}fprintf"]
+    pub fn cfprintf(
+        __stream: *mut cFILE,
+        __format: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}printf"]
+    pub fn cprintf(__format: *const ::std::os::raw::c_char, ...) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}sprintf"]
+    pub fn csprintf(
+        __s: *mut ::std::os::raw::c_char,
+        __format: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}vfprintf"]
+    pub fn cvfprintf(
+        __s: *mut cFILE,
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}vprintf"]
+    pub fn cvprintf(
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}vsprintf"]
+    pub fn cvsprintf(
+        __s: *mut ::std::os::raw::c_char,
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Window_setContentDimensions"]
-    pub fn cbw_Window_setContentDimensions(window: *mut cbw_Window, dimensions: cbw_Dims2D);
+    #[link_name = "\u{1}snprintf"]
+    pub fn csnprintf(
+        __s: *mut ::std::os::raw::c_char,
+        __maxlen: ::std::os::raw::c_ulong,
+        __format: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Window_setOpacity"]
-    pub fn cbw_Window_setOpacity(window: *mut cbw_Window, opacity: u8);
+    #[link_name = "\u{1}vsnprintf"]
+    pub fn cvsnprintf(
+        __s: *mut ::std::os::raw::c_char,
+        __maxlen: ::std::os::raw::c_ulong,
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Window_setPosition"]
-    pub fn cbw_Window_setPosition(window: *mut cbw_Window, position: cbw_Pos2D);
+    #[link_name = "\u{1}vdprintf"]
+    pub fn cvdprintf(
+        __fd: ::std::os::raw::c_int,
+        __fmt: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Applies the given title;"]
-    #[link_name = "\u{1}bw_Window_setTitle"]
-    pub fn cbw_Window_setTitle(window: *mut cbw_Window, title: cbw_CStrSlice);
+    #[link_name = "\u{1}dprintf"]
+    pub fn cdprintf(
+        __fd: ::std::os::raw::c_int,
+        __fmt: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Window_setWindowDimensions"]
-    pub fn cbw_Window_setWindowDimensions(window: *mut cbw_Window, dimensions: cbw_Dims2D);
+    #[link_name = "\u{1}fscanf"]
+    pub fn cfscanf(
+        __stream: *mut cFILE,
+        __format: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Shows the window if it was previously hidden"]
-    #[doc = " Is generally called after window creation."]
-    #[link_name = "\u{1}bw_Window_show"]
-    pub fn cbw_Window_show(window: *mut cbw_Window);
+    #[link_name = "\u{1}scanf"]
+    pub fn cscanf(__format: *const ::std::os::raw::c_char, ...) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Window_triggerClose"]
-    pub fn cbw_Window_triggerClose(window: *mut cbw_Window);
+    #[link_name = "\u{1}sscanf"]
+    pub fn csscanf(
+        __s: *const ::std::os::raw::c_char,
+        __format: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}_bw_Window_onResize"]
-    pub fn c_bw_Window_onResize(
-        window: *const cbw_Window,
-        width: ::std::os::raw::c_uint,
-        height: ::std::os::raw::c_uint,
-    );
-}
-pub type cbw_BrowserWindowCreationCallbackFn = ::std::option::Option<
-    unsafe extern "C" fn(window: *mut cbw_BrowserWindow, data: *mut ::std::os::raw::c_void),
->;
-pub type cbw_BrowserWindowHandlerFn = ::std::option::Option<
-    unsafe extern "C" fn(
-        window: *mut cbw_BrowserWindow,
-        cmd: cbw_CStrSlice,
-        args: *mut cbw_CStrSlice,
-        arg_count: csize_t,
-    ),
->;
-pub type cbw_BrowserWindowJsCallbackFn = ::std::option::Option<
-    unsafe extern "C" fn(
-        window: *mut cbw_BrowserWindow,
-        user_data: *mut ::std::os::raw::c_void,
-        result: *const ::std::os::raw::c_char,
-        err: *const cbw_Err,
-    ),
->;
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_BrowserWindowOptions {
-    pub dev_tools: cBOOL,
-    pub resource_path: cbw_CStrSlice,
+    #[link_name = "\u{1}__isoc99_fscanf"]
+    pub fn cfscanf1(
+        __stream: *mut cFILE,
+        __format: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_BrowserWindowOptions() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_BrowserWindowOptions>(),
-        24usize,
-        concat!("Size of: ", stringify!(cbw_BrowserWindowOptions))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_BrowserWindowOptions>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_BrowserWindowOptions))
-    );
-    assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).dev_tools as *const _ as usize
-        },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindowOptions),
-            "::",
-            stringify!(dev_tools)
-        )
-    );
-    assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<cbw_BrowserWindowOptions>())).resource_path as *const _ as usize
-        },
-        8usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindowOptions),
-            "::",
-            stringify!(resource_path)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}__isoc99_scanf"]
+    pub fn cscanf1(__format: *const ::std::os::raw::c_char, ...) -> ::std::os::raw::c_int;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_BrowserWindowSource {
-    pub data: cbw_CStrSlice,
-    pub is_html: cBOOL,
+extern "C" {
+    #[link_name = "\u{1}__isoc99_sscanf"]
+    pub fn csscanf1(
+        __s: *const ::std::os::raw::c_char,
+        __format: *const ::std::os::raw::c_char,
+        ...
+    ) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_BrowserWindowSource() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_BrowserWindowSource>(),
-        24usize,
-        concat!("Size of: ", stringify!(cbw_BrowserWindowSource))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_BrowserWindowSource>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_BrowserWindowSource))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSource>())).data as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindowSource),
-            "::",
-            stringify!(data)
-        )
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindowSource>())).is_html as *const _ as usize },
-        16usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindowSource),
-            "::",
-            stringify!(is_html)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}vfscanf"]
+    pub fn cvfscanf(
+        __s: *mut cFILE,
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_BrowserWindow {
-    pub window: *mut cbw_Window,
-    pub external_handler: cbw_BrowserWindowHandlerFn,
-    pub user_data: *mut ::std::os::raw::c_void,
-    pub impl_: cbw_BrowserWindowImpl,
+extern "C" {
+    #[link_name = "\u{1}vscanf"]
+    pub fn cvscanf(
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_BrowserWindow() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_BrowserWindow>(),
-        40usize,
-        concat!("Size of: ", stringify!(cbw_BrowserWindow))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_BrowserWindow>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_BrowserWindow))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).window as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindow),
-            "::",
-            stringify!(window)
-        )
-    );
-    assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<cbw_BrowserWindow>())).external_handler as *const _ as usize
-        },
-        8usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindow),
-            "::",
-            stringify!(external_handler)
-        )
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).user_data as *const _ as usize },
-        16usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindow),
-            "::",
-            stringify!(user_data)
-        )
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_BrowserWindow>())).impl_ as *const _ as usize },
-        24usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_BrowserWindow),
-            "::",
-            stringify!(impl_)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}vsscanf"]
+    pub fn cvsscanf(
+        __s: *const ::std::os::raw::c_char,
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_BrowserWindow_destroy"]
-    pub fn cbw_BrowserWindow_destroy(bw: *mut cbw_BrowserWindow);
+    #[link_name = "\u{1}__isoc99_vfscanf"]
+    pub fn cvfscanf1(
+        __s: *mut cFILE,
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Marks the browser window handle as not being used anymore."]
-    #[doc = " This makes it so that if and when the window gets closed, everything is freed and cleaned from memory."]
-    #[doc = " This function can be called from any thread so it needs to be thread safe."]
-    #[link_name = "\u{1}bw_BrowserWindow_drop"]
-    pub fn cbw_BrowserWindow_drop(bw: *mut cbw_BrowserWindow);
+    #[link_name = "\u{1}__isoc99_vscanf"]
+    pub fn cvscanf1(
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Executes the given JavaScript and calls the given callback (on the GUI thread) to provide the result."]
-    #[link_name = "\u{1}bw_BrowserWindow_evalJs"]
-    pub fn cbw_BrowserWindow_evalJs(
-        bw: *mut cbw_BrowserWindow,
-        js: cbw_CStrSlice,
-        callback: cbw_BrowserWindowJsCallbackFn,
-        cb_data: *mut ::std::os::raw::c_void,
-    );
+    #[link_name = "\u{1}__isoc99_vsscanf"]
+    pub fn cvsscanf1(
+        __s: *const ::std::os::raw::c_char,
+        __format: *const ::std::os::raw::c_char,
+        __arg: *mut c__va_list_tag,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_BrowserWindow_evalJsThreaded"]
-    pub fn cbw_BrowserWindow_evalJsThreaded(
-        bw: *mut cbw_BrowserWindow,
-        js: cbw_CStrSlice,
-        callback: cbw_BrowserWindowJsCallbackFn,
-        cb_data: *mut ::std::os::raw::c_void,
-    );
+    #[link_name = "\u{1}fgetc"]
+    pub fn cfgetc(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_BrowserWindow_getApp"]
-    pub fn cbw_BrowserWindow_getApp(bw: *mut cbw_BrowserWindow) -> *mut cbw_Application;
+    #[link_name = "\u{1}getc"]
+    pub fn cgetc(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_BrowserWindow_getUserData"]
-    pub fn cbw_BrowserWindow_getUserData(bw: *mut cbw_BrowserWindow)
-        -> *mut ::std::os::raw::c_void;
+    #[link_name = "\u{1}getchar"]
+    pub fn cgetchar() -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_BrowserWindow_getUrl"]
-    pub fn cbw_BrowserWindow_getUrl(bw: *mut cbw_BrowserWindow, url: *mut cbw_StrSlice) -> cBOOL;
+    #[link_name = "\u{1}getc_unlocked"]
+    pub fn cgetc_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_BrowserWindow_getWindow"]
-    pub fn cbw_BrowserWindow_getWindow(bw: *mut cbw_BrowserWindow) -> *mut cbw_Window;
+    #[link_name = "\u{1}getchar_unlocked"]
+    pub fn cgetchar_unlocked() -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_BrowserWindow_navigate"]
-    pub fn cbw_BrowserWindow_navigate(bw: *mut cbw_BrowserWindow, url: cbw_CStrSlice) -> cbw_Err;
+    #[link_name = "\u{1}fgetc_unlocked"]
+    pub fn cfgetc_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[doc = " Creates a new browser window"]
-    #[link_name = "\u{1}bw_BrowserWindow_new"]
-    pub fn cbw_BrowserWindow_new(
-        app: *mut cbw_Application,
-        parent: *const cbw_Window,
-        source: cbw_BrowserWindowSource,
-        _title: cbw_CStrSlice,
-        width: ::std::os::raw::c_int,
-        height: ::std::os::raw::c_int,
-        window_options: *const cbw_WindowOptions,
-        browser_window_options: *const cbw_BrowserWindowOptions,
-        handler: cbw_BrowserWindowHandlerFn,
-        user_data: *mut ::std::os::raw::c_void,
-        callback: cbw_BrowserWindowCreationCallbackFn,
-        callback_data: *mut ::std::os::raw::c_void,
-    );
+    #[link_name = "\u{1}fputc"]
+    pub fn cfputc(__c: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_CookieImpl {
-    pub handle_ptr: *mut ::std::os::raw::c_void,
+extern "C" {
+    #[link_name = "\u{1}putc"]
+    pub fn cputc(__c: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_CookieImpl() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_CookieImpl>(),
-        8usize,
-        concat!("Size of: ", stringify!(cbw_CookieImpl))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_CookieImpl>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_CookieImpl))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_CookieImpl>())).handle_ptr as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_CookieImpl),
-            "::",
-            stringify!(handle_ptr)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}putchar"]
+    pub fn cputchar(__c: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_CookieJarImpl {
-    pub handle_ptr: *mut ::std::os::raw::c_void,
+extern "C" {
+    #[link_name = "\u{1}fputc_unlocked"]
+    pub fn cfputc_unlocked(
+        __c: ::std::os::raw::c_int,
+        __stream: *mut cFILE,
+    ) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_CookieJarImpl() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_CookieJarImpl>(),
-        8usize,
-        concat!("Size of: ", stringify!(cbw_CookieJarImpl))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_CookieJarImpl>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_CookieJarImpl))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_CookieJarImpl>())).handle_ptr as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_CookieJarImpl),
-            "::",
-            stringify!(handle_ptr)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}putc_unlocked"]
+    pub fn cputc_unlocked(
+        __c: ::std::os::raw::c_int,
+        __stream: *mut cFILE,
+    ) -> ::std::os::raw::c_int;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_CookieIteratorImpl {
-    pub index: csize_t,
-    pub visitor_ptr: *mut ::std::os::raw::c_void,
+extern "C" {
+    #[link_name = "\u{1}putchar_unlocked"]
+    pub fn cputchar_unlocked(__c: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_CookieIteratorImpl() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_CookieIteratorImpl>(),
-        16usize,
-        concat!("Size of: ", stringify!(cbw_CookieIteratorImpl))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_CookieIteratorImpl>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_CookieIteratorImpl))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_CookieIteratorImpl>())).index as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_CookieIteratorImpl),
-            "::",
-            stringify!(index)
-        )
-    );
-    assert_eq!(
-        unsafe {
-            &(*(::std::ptr::null::<cbw_CookieIteratorImpl>())).visitor_ptr as *const _ as usize
-        },
-        8usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_CookieIteratorImpl),
-            "::",
-            stringify!(visitor_ptr)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}getw"]
+    pub fn cgetw(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_Cookie {
-    pub impl_: cbw_CookieImpl,
+extern "C" {
+    #[link_name = "\u{1}putw"]
+    pub fn cputw(__w: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_Cookie() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_Cookie>(),
-        8usize,
-        concat!("Size of: ", stringify!(cbw_Cookie))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_Cookie>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_Cookie))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_Cookie>())).impl_ as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_Cookie),
-            "::",
-            stringify!(impl_)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}fgets"]
+    pub fn cfgets(
+        __s: *mut ::std::os::raw::c_char,
+        __n: ::std::os::raw::c_int,
+        __stream: *mut cFILE,
+    ) -> *mut ::std::os::raw::c_char;
+}
+extern "C" {
+    #[link_name = "\u{1}__getdelim"]
+    pub fn c__getdelim(
+        __lineptr: *mut *mut ::std::os::raw::c_char,
+        __n: *mut csize_t,
+        __delimiter: ::std::os::raw::c_int,
+        __stream: *mut cFILE,
+    ) -> c__ssize_t;
+}
+extern "C" {
+    #[link_name = "\u{1}getdelim"]
+    pub fn cgetdelim(
+        __lineptr: *mut *mut ::std::os::raw::c_char,
+        __n: *mut csize_t,
+        __delimiter: ::std::os::raw::c_int,
+        __stream: *mut cFILE,
+    ) -> c__ssize_t;
+}
+extern "C" {
+    #[link_name = "\u{1}getline"]
+    pub fn cgetline(
+        __lineptr: *mut *mut ::std::os::raw::c_char,
+        __n: *mut csize_t,
+        __stream: *mut cFILE,
+    ) -> c__ssize_t;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_CookieJar {
-    pub impl_: cbw_CookieJarImpl,
+extern "C" {
+    #[link_name = "\u{1}fputs"]
+    pub fn cfputs(
+        __s: *const ::std::os::raw::c_char,
+        __stream: *mut cFILE,
+    ) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_CookieJar() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_CookieJar>(),
-        8usize,
-        concat!("Size of: ", stringify!(cbw_CookieJar))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_CookieJar>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_CookieJar))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_CookieJar>())).impl_ as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_CookieJar),
-            "::",
-            stringify!(impl_)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}puts"]
+    pub fn cputs(__s: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
 }
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct cbw_CookieIterator {
-    pub impl_: cbw_CookieIteratorImpl,
+extern "C" {
+    #[link_name = "\u{1}ungetc"]
+    pub fn cungetc(__c: ::std::os::raw::c_int, __stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
-#[test]
-fn bindgen_test_layout_cbw_CookieIterator() {
-    assert_eq!(
-        ::std::mem::size_of::<cbw_CookieIterator>(),
-        16usize,
-        concat!("Size of: ", stringify!(cbw_CookieIterator))
-    );
-    assert_eq!(
-        ::std::mem::align_of::<cbw_CookieIterator>(),
-        8usize,
-        concat!("Alignment of ", stringify!(cbw_CookieIterator))
-    );
-    assert_eq!(
-        unsafe { &(*(::std::ptr::null::<cbw_CookieIterator>())).impl_ as *const _ as usize },
-        0usize,
-        concat!(
-            "Offset of field: ",
-            stringify!(cbw_CookieIterator),
-            "::",
-            stringify!(impl_)
-        )
-    );
+extern "C" {
+    #[link_name = "\u{1}fread"]
+    pub fn cfread(
+        __ptr: *mut ::std::os::raw::c_void,
+        __size: ::std::os::raw::c_ulong,
+        __n: ::std::os::raw::c_ulong,
+        __stream: *mut cFILE,
+    ) -> ::std::os::raw::c_ulong;
 }
-pub type cbw_CookieJarStorageCallbackFn = ::std::option::Option<
-    unsafe extern "C" fn(cj: *mut cbw_CookieJar, data: *mut ::std::os::raw::c_void, error: cbw_Err),
->;
-pub type cbw_CookieIteratorNextCallbackFn = ::std::option::Option<
-    unsafe extern "C" fn(
-        ci: *mut cbw_CookieIterator,
-        data: *mut ::std::os::raw::c_void,
-        cookie: *mut cbw_Cookie,
-    ),
->;
-pub type cbw_CookieJarDeleteCallbackFn = ::std::option::Option<
-    unsafe extern "C" fn(
-        cj: *mut cbw_CookieJar,
-        data: *mut ::std::os::raw::c_void,
-        deleted: ::std::os::raw::c_uint,
-    ),
->;
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_free"]
-    pub fn cbw_Cookie_free(cookie: *mut cbw_Cookie);
+    #[link_name = "\u{1}fwrite"]
+    pub fn cfwrite(
+        __ptr: *const ::std::os::raw::c_void,
+        __size: ::std::os::raw::c_ulong,
+        __n: ::std::os::raw::c_ulong,
+        __s: *mut cFILE,
+    ) -> ::std::os::raw::c_ulong;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_new"]
-    pub fn cbw_Cookie_new(name: cbw_CStrSlice, value: cbw_CStrSlice) -> *mut cbw_Cookie;
+    #[link_name = "\u{1}fread_unlocked"]
+    pub fn cfread_unlocked(
+        __ptr: *mut ::std::os::raw::c_void,
+        __size: csize_t,
+        __n: csize_t,
+        __stream: *mut cFILE,
+    ) -> csize_t;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_getCreationTime"]
-    pub fn cbw_Cookie_getCreationTime(cookie: *const cbw_Cookie) -> u64;
+    #[link_name = "\u{1}fwrite_unlocked"]
+    pub fn cfwrite_unlocked(
+        __ptr: *const ::std::os::raw::c_void,
+        __size: csize_t,
+        __n: csize_t,
+        __stream: *mut cFILE,
+    ) -> csize_t;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_setCreationTime"]
-    pub fn cbw_Cookie_setCreationTime(cookie: *mut cbw_Cookie, time: u64);
+    #[link_name = "\u{1}fseek"]
+    pub fn cfseek(
+        __stream: *mut cFILE,
+        __off: ::std::os::raw::c_long,
+        __whence: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_getDomain"]
-    pub fn cbw_Cookie_getDomain(cookie: *const cbw_Cookie, domain: *mut cbw_StrSlice) -> cBOOL;
+    #[link_name = "\u{1}ftell"]
+    pub fn cftell(__stream: *mut cFILE) -> ::std::os::raw::c_long;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_setDomain"]
-    pub fn cbw_Cookie_setDomain(cookie: *mut cbw_Cookie, domain: cbw_CStrSlice);
+    #[link_name = "\u{1}rewind"]
+    pub fn crewind(__stream: *mut cFILE);
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_getExpires"]
-    pub fn cbw_Cookie_getExpires(cookie: *const cbw_Cookie) -> u64;
+    #[link_name = "\u{1}fseeko"]
+    pub fn cfseeko(
+        __stream: *mut cFILE,
+        __off: c__off_t,
+        __whence: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_setExpires"]
-    pub fn cbw_Cookie_setExpires(cookie: *mut cbw_Cookie, time: u64);
+    #[link_name = "\u{1}ftello"]
+    pub fn cftello(__stream: *mut cFILE) -> c__off_t;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_getName"]
-    pub fn cbw_Cookie_getName(cookie: *const cbw_Cookie, name: *mut cbw_StrSlice) -> cBOOL;
+    #[link_name = "\u{1}fgetpos"]
+    pub fn cfgetpos(__stream: *mut cFILE, __pos: *mut cfpos_t) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_setName"]
-    pub fn cbw_Cookie_setName(cookie: *mut cbw_Cookie, name: cbw_CStrSlice);
+    #[link_name = "\u{1}fsetpos"]
+    pub fn cfsetpos(__stream: *mut cFILE, __pos: *const cfpos_t) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_getPath"]
-    pub fn cbw_Cookie_getPath(cookie: *const cbw_Cookie, path: *mut cbw_StrSlice) -> cBOOL;
+    #[link_name = "\u{1}clearerr"]
+    pub fn cclearerr(__stream: *mut cFILE);
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_setPath"]
-    pub fn cbw_Cookie_setPath(cookie: *mut cbw_Cookie, path: cbw_CStrSlice);
+    #[link_name = "\u{1}feof"]
+    pub fn cfeof(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_getValue"]
-    pub fn cbw_Cookie_getValue(cookie: *const cbw_Cookie, value: *mut cbw_StrSlice) -> cBOOL;
+    #[link_name = "\u{1}ferror"]
+    pub fn cferror(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_setValue"]
-    pub fn cbw_Cookie_setValue(cookie: *mut cbw_Cookie, value: cbw_CStrSlice);
+    #[link_name = "\u{1}clearerr_unlocked"]
+    pub fn cclearerr_unlocked(__stream: *mut cFILE);
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_isHttpOnly"]
-    pub fn cbw_Cookie_isHttpOnly(cookie: *const cbw_Cookie) -> cBOOL;
+    #[link_name = "\u{1}feof_unlocked"]
+    pub fn cfeof_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_makeHttpOnly"]
-    pub fn cbw_Cookie_makeHttpOnly(cookie: *mut cbw_Cookie);
+    #[link_name = "\u{1}ferror_unlocked"]
+    pub fn cferror_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_isSecure"]
-    pub fn cbw_Cookie_isSecure(cookie: *const cbw_Cookie) -> cBOOL;
+    #[link_name = "\u{1}perror"]
+    pub fn cperror(__s: *const ::std::os::raw::c_char);
 }
 extern "C" {
-    #[link_name = "\u{1}bw_Cookie_makeSecure"]
-    pub fn cbw_Cookie_makeSecure(cookie: *mut cbw_Cookie);
+    #[link_name = "\u{1}sys_nerr"]
+    pub static mut csys_nerr: ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieJar_delete"]
-    pub fn cbw_CookieJar_delete(
-        jar: *mut cbw_CookieJar,
-        url: cbw_CStrSlice,
-        name: cbw_CStrSlice,
-        cb: cbw_CookieJarDeleteCallbackFn,
-        cb_data: *mut ::std::os::raw::c_void,
-    );
+    #[link_name = "\u{1}sys_errlist"]
+    pub static mut csys_errlist: [*const ::std::os::raw::c_char; 0usize];
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieJar_free"]
-    pub fn cbw_CookieJar_free(jar: *mut cbw_CookieJar);
+    #[link_name = "\u{1}fileno"]
+    pub fn cfileno(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieJar_iterator"]
-    pub fn cbw_CookieJar_iterator(
-        jar: *mut cbw_CookieJar,
-        iterator: *mut *mut cbw_CookieIterator,
-        include_http_only: cBOOL,
-        url: cbw_CStrSlice,
-    );
+    #[link_name = "\u{1}fileno_unlocked"]
+    pub fn cfileno_unlocked(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieJar_iteratorAll"]
-    pub fn cbw_CookieJar_iteratorAll(
-        jar: *mut cbw_CookieJar,
-        iterator: *mut *mut cbw_CookieIterator,
-    );
+    #[link_name = "\u{1}popen"]
+    pub fn cpopen(
+        __command: *const ::std::os::raw::c_char,
+        __modes: *const ::std::os::raw::c_char,
+    ) -> *mut cFILE;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieJar_newGlobal"]
-    pub fn cbw_CookieJar_newGlobal() -> *mut cbw_CookieJar;
+    #[link_name = "\u{1}pclose"]
+    pub fn cpclose(__stream: *mut cFILE) -> ::std::os::raw::c_int;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieJar_store"]
-    pub fn cbw_CookieJar_store(
-        jar: *mut cbw_CookieJar,
-        url: cbw_CStrSlice,
-        cookie: *const cbw_Cookie,
-        cb: cbw_CookieJarStorageCallbackFn,
-        cb_data: *mut ::std::os::raw::c_void,
-    ) -> cbw_Err;
+    #[link_name = "\u{1}ctermid"]
+    pub fn cctermid(__s: *mut ::std::os::raw::c_char) -> *mut ::std::os::raw::c_char;
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieIterator_free"]
-    pub fn cbw_CookieIterator_free(iterator: *mut cbw_CookieIterator);
+    #[link_name = "\u{1}flockfile"]
+    pub fn cflockfile(__stream: *mut cFILE);
 }
 extern "C" {
-    #[link_name = "\u{1}bw_CookieIterator_next"]
-    pub fn cbw_CookieIterator_next(
-        iterator: *mut cbw_CookieIterator,
-        on_next: cbw_CookieIteratorNextCallbackFn,
-        cb_data: *mut ::std::os::raw::c_void,
-    ) -> cBOOL;
+    #[link_name = "\u{1}ftrylockfile"]
+    pub fn cftrylockfile(__stream: *mut cFILE) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}funlockfile"]
+    pub fn cfunlockfile(__stream: *mut cFILE);
+}
+extern "C" {
+    #[link_name = "\u{1}__uflow"]
+    pub fn c__uflow(arg1: *mut cFILE) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    #[link_name = "\u{1}__overflow"]
+    pub fn c__overflow(arg1: *mut cFILE, arg2: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
 }
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
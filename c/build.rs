@@ -140,7 +140,12 @@ fn main() {
 		.header("src/cookie.h")
 		.header("src/common.h")
 		.header("src/err.h")
+		.header("src/js_value.h")
+		.header("src/metrics.h")
+		.header("src/request_context.h")
+		.header("src/resource.h")
 		.header("src/string.h")
+		.header("src/trace.h")
 		.header("src/window.h");
 
 	/**************************************
@@ -192,6 +197,18 @@ fn main() {
 				}
 			}
 		}
+
+		// The GL surface renders with GLX into the X window of GTK
+		if cfg!(feature = "gl") {
+			bgbuilder = bgbuilder.header("src/gl_surface.h");
+			build
+				.file("src/gl_surface/common.c")
+				.file("src/gl_surface/glx.c");
+
+			if let Err(e) = pkg_config::Config::new().probe("gl") {
+				panic!("Unable to find the OpenGL development files: {}", e);
+			}
+		}
 	}
 	// Non-windows systems that opt for using CEF, use CEF's own internal windowing features
 	else if cfg!(feature = "cef") && !target.contains("windows") {
@@ -272,10 +289,23 @@ fn main() {
 			.file("src/application/cef.cpp")
 			.file("src/browser_window/cef.cpp")
 			.file("src/cookie/cef.cpp")
+			.file("src/request_context/cef.cpp")
+			.file("src/resource/cef.cpp")
+			.file("src/cef/browser_registry.cpp")
 			.file("src/cef/bw_handle_map.cpp")
+			.file("src/cef/call_table.cpp")
 			.file("src/cef/client_handler.cpp")
 			.file("src/cef/exception.cpp")
+			.file("src/cef/invocation_queue.cpp")
+			.file("src/cef/mapped_file.cpp")
+			.file("src/cef/offscreen_renderer.cpp")
+			.file("src/cef/request_interceptor.cpp")
+			.file("src/cef/resource_handler.cpp")
+			.file("src/cef/resource_pack.cpp")
+			.file("src/cef/resource_registry.cpp")
 			.file("src/cef/util.cpp")
+			.file("src/cef/value.cpp")
+			.file("src/cef/worker_pool.cpp")
 			.define("BW_CEF", None)
 			.cpp(true);
 
@@ -311,9 +341,16 @@ fn main() {
 	 **************************************/
 	build
 		.file("src/application/common.c")
+		.file("src/application/timer_heap.c")
 		.file("src/browser_window/common.c")
+		.file("src/browser_window/pool.c")
+		.file("src/browser_window/render_queue.c")
 		.file("src/err.c")
+		.file("src/js_value.c")
+		.file("src/metrics.c")
+		.file("src/slab.c")
 		.file("src/string.c")
+		.file("src/trace.c")
 		.file("src/window/common.c")
 		.flag( std_flag )
 		.compile("browser-window-c");
@@ -6,6 +6,8 @@ extern "C" {
 #endif
 
 #include "bool.h"
+#include "metrics.h"
+#include "slab.h"
 #include "string.h"
 
 
@@ -14,6 +16,23 @@ struct bw_Application;
 typedef void (*bw_ApplicationDispatchFn)( struct bw_Application* app, void* data );
 typedef bw_ApplicationDispatchFn bw_ApplicationReadyFn;
 
+typedef unsigned char bw_ApplicationDispatchPriority;
+
+/// Executed before any other dispatched work.
+#define BW_APPLICATION_DISPATCH_PRIORITY_HIGH 0
+/// The priority used by bw_Application_dispatch.
+#define BW_APPLICATION_DISPATCH_PRIORITY_NORMAL 1
+/// Only executed when there are no other events to process, in slices of limited time.
+#define BW_APPLICATION_DISPATCH_PRIORITY_IDLE 2
+#define BW_APPLICATION_DISPATCH_PRIORITY_COUNT 3
+
+typedef unsigned char bw_ApplicationMemoryPressure;
+
+/// Memory is getting low: caches that can be rebuilt are purged, and the renderer processes are asked to release memory.
+#define BW_APPLICATION_MEMORY_PRESSURE_MODERATE 0
+/// Memory is about to run out: the browser windows that are waiting in the prewarm pool are destroyed as well.
+#define BW_APPLICATION_MEMORY_PRESSURE_CRITICAL 1
+
 
 
 #ifndef BW_BINDGEN
@@ -46,10 +65,65 @@ typedef struct {} bw_ApplicationEngineImpl;
 
 
 
+typedef struct bw_ApplicationDispatchData bw_ApplicationDispatchData;
+struct bw_ApplicationDispatchData {
+	bw_ApplicationDispatchFn func;
+	void* data;
+	bw_ApplicationDispatchData* next;	// The dispatch that has been queued after this one
+	uint64_t queued_at;	// When the dispatch got queued, or 0 if it has been delayed
+};
+
+/// An intrusive multi-producer single-consumer queue of dispatched functions, that is drained by the GUI thread.
+/// Any thread can push without taking a lock, and the GUI thread only needs to be woken up when the queue wasn't already waiting to be drained.
+typedef struct {
+	bw_ApplicationDispatchData* head;	// The most recently queued dispatch
+	bw_ApplicationDispatchData* tail;	// The oldest queued dispatch, only used by the GUI thread
+	bw_ApplicationDispatchData stub;	// Keeps the queue from ever being completely empty
+	int wakeup_pending;
+	uint64_t length;	// The number of queued dispatches
+} bw_ApplicationDispatchQueue;
+
+typedef struct bw_BrowserWindowPool bw_BrowserWindowPool;
+
+/// The memory in use by the application in this process, in bytes.
+typedef struct {
+	size_t browser_windows;	// The number of browser windows, including the prewarmed ones
+	size_t pending_calls;	// The following three are the sums of those of all browser windows
+	size_t queued_bytes;
+	size_t cached_response_bytes;
+	size_t queued_dispatches;	// The number of dispatched functions that are waiting to be executed, without the delayed ones
+	uint64_t process_private_bytes;	// The memory that only this process uses
+} bw_ApplicationMemoryStats;
+
+/// The moments at which the phases of the startup of the application have been reached.
+/// They are timestamps of a monotonic clock, in microseconds, that can only be compared with each other.
+/// A phase that hasn't been reached yet is 0.
+typedef struct {
+	uint64_t initialize;	// When bw_Application_initialize got called
+	uint64_t engine_processes;	// When the browser engine was done with its sub-process check, which is where sub-processes branch off
+	uint64_t engine_initialized;	// When the browser engine got initialized
+	uint64_t initialized;	// When bw_Application_initialize returned
+	uint64_t ready;	// When the on_ready callback of bw_Application_run got invoked
+	uint64_t first_window;	// When the first window had been created
+	uint64_t first_browser_requested;	// When the browser engine was asked to create the first browser
+	uint64_t first_browser_created;	// When the renderer of the first browser had been set up, right before its creation callback got invoked
+	uint64_t first_load;	// When the first page had finished loading in a main frame
+	uint64_t first_paint;	// When the first frame got painted, which is only known for windowless browser windows
+} bw_ApplicationStartupMetrics;
+
 struct bw_Application {
 	unsigned int windows_alive;
 	BOOL is_running;
 	BOOL is_done;
+	int has_stopped;	// Whether the event loop has returned, after which dispatched work won't be executed anymore
+	bw_ApplicationDispatchQueue dispatch_queues[BW_APPLICATION_DISPATCH_PRIORITY_COUNT];	// One for every priority
+	uint64_t dispatch_budget;	// In microseconds
+	bw_BrowserWindowPool* browser_window_pool;	// The browser windows that have been created in advance, if any
+	bw_ApplicationStartupMetrics startup_metrics;
+	bw_LatencyHistogram dispatch_latencies[BW_APPLICATION_DISPATCH_PRIORITY_COUNT];	// How long dispatched work has been waiting in each queue before it got executed
+	BOOL engine_tracing;	// Whether the browser engine is recording a trace as well
+	bw_Slab window_slab;	// The memory of all windows
+	bw_Slab browser_window_slab;	// The memory of all browser windows, which gives them the handles that anything received later on refers to them by
 	bw_ApplicationImpl impl;
 	bw_ApplicationEngineImpl engine_impl;	/// Can be set by the implementation of a browser engine
 };
@@ -57,14 +131,22 @@ struct bw_Application {
 typedef struct bw_Application bw_Application;
 typedef struct bw_ApplicationEngineData bw_ApplicationEngineData;
 
-typedef struct {
-	bw_ApplicationDispatchFn func;
-	void* data;
-} bw_ApplicationDispatchData;
+/// Invoked on the GUI thread when a trace has been written, with an error that has a code of 0 if it succeeded.
+typedef void (*bw_ApplicationTraceWrittenFn)( bw_Application* app, void* data, bw_Err error );
 
 typedef struct {
 	bw_CStrSlice engine_seperate_executable_path;
 	bw_CStrSlice resource_dir;
+	unsigned int dispatch_budget;	// The maximum number of microseconds spent on dispatched work per turn of the event loop, or 0 for no limit
+	bw_CStrSlice resource_pack;	// The path of a resource pack to serve at the resource scheme, if not empty
+	BOOL windowless_rendering;	// Whether windowless browser windows can be created, which may slow down the rendering of other browser windows on some systems
+	BOOL process_per_site;	// Lets all browser windows that show the same site share one renderer process, instead of giving each one a process of its own
+	unsigned int renderer_process_limit;	// The maximum number of renderer processes, after which browser windows share the existing ones, or 0 to let the engine decide
+	BOOL isolate_popups;	// Gives popups a renderer process of their own, instead of sharing the one of the page that opened them, which then can't script them anymore
+	bw_CStrSlice cache_dir;	// The directory in which the cache, cookies and local storage of the default request context are kept between launches, or empty to keep them in memory only
+	uint64_t cache_size_limit;	// The maximum number of bytes the disk cache may take up, or 0 to let the engine decide
+	BOOL persist_session_cookies;	// Whether cookies without an expiry date are kept in the cache directory as well, so that sessions survive a restart
+	BOOL lazy_engine;	// Leaves the startup of the browser engine to bw_Application_startEngine, or to the first browser window, request context or cookie jar that gets created
 } bw_ApplicationSettings;
 
 
@@ -88,10 +170,36 @@ void bw_Application_exitAsync(  bw_Application* app, int exit_code );
 /// # Returns
 /// An indication of whether or not the function was able to be dispatched.
 /// Dispatching a function fails when the application has already been terminated.
+/// Functions dispatched before the event loop runs are executed once it has started.
 BOOL bw_Application_dispatch( bw_Application* app, bw_ApplicationDispatchFn func, void* data );
 
+/// Same as bw_Application_dispatch, but queues the function with the given priority.
+/// Work with a higher priority is executed first, and idle work is only executed when the GUI thread has nothing else to do.
+BOOL bw_Application_dispatchWithPriority( bw_Application* app, bw_ApplicationDispatchFn func, void* data, bw_ApplicationDispatchPriority priority );
+
 /// Shuts down all application processes and performs necessary clean-up code.
+/// Jobs on the worker pool that are still running after five seconds are abandoned, in which case the shutdown of the browser engine is skipped.
 void bw_Application_finish( bw_Application* app );
+/// Same as `bw_Application_finish`, but for when the process is about to exit anyway, like when a service restarts.
+/// All browsers that are still open are closed at once, without waiting for their pages and without the cleanup of their windows.
+/// Only the cookie stores are written to disk, and the rest is left to the operating system.
+/// The browser engine gets at most `timeout` milliseconds, after which its shutdown is skipped, and jobs that are still running on the worker pool are abandoned.
+/// Nothing of the application can be used afterwards, except for `bw_Application_free`.
+void bw_Application_finishFast( bw_Application* app, unsigned int timeout );
+
+/// Copies the histogram of how long work that has been dispatched with the given priority waited before it got executed, in microseconds.
+/// Delayed dispatches are not included.
+/// This function is thread safe.
+void bw_Application_getDispatchLatencies( const bw_Application* app, bw_ApplicationDispatchPriority priority, bw_LatencyHistogram* histogram );
+
+/// Fills in the memory that the application uses in this process.
+/// The memory used by renderer processes can be measured for each browser window with `bw_BrowserWindow_getMemoryStats`.
+/// Should be called on the GUI thread.
+void bw_Application_getMemoryStats( const bw_Application* app, bw_ApplicationMemoryStats* stats );
+
+/// Copies the moments at which the phases of the startup have been reached into `metrics`.
+/// This function is thread safe.
+void bw_Application_getStartupMetrics( const bw_Application* app, bw_ApplicationStartupMetrics* metrics );
 
 /// Frees memory for the application handle.
 /// Call `bw_Application_finish` before you call this function.
@@ -114,6 +222,38 @@ int bw_Application_run( bw_Application* app, bw_ApplicationReadyFn on_ready, voi
 /// Executes the given closure after the specified delay.
 BOOL bw_Application_dispatchDelayed(bw_Application* app, bw_ApplicationDispatchFn func, void* user_data, uint64_t milliseconds);
 
+/// Starts the browser engine, if the application has been initialized with `lazy_engine` and the engine hasn't been started yet.
+/// This happens by itself when the first browser window, request context or cookie jar is created, or when a message is broadcast.
+/// It can also be dispatched with the idle priority once the first window is shown, to warm the engine up in the meantime.
+/// Should be called on the GUI thread.
+void bw_Application_startEngine( bw_Application* app );
+
+/// Starts recording trace events of the internals of browser window, like the execution of dispatched work and the messages between the browser and renderer processes.
+/// Every thread keeps its last `capacity` events.
+/// If `engine_categories` is not empty, the browser engine records a trace of the given comma separated categories as well, like "toplevel,ipc,v8".
+/// Should be called on the GUI thread.
+void bw_Application_startTracing( bw_Application* app, size_t capacity, bw_CStrSlice engine_categories );
+
+/// Stops recording trace events, and writes them to a file at `path` in Chrome's JSON trace event format, merged with the trace of the browser engine if it has recorded one.
+/// The file can be opened with `chrome://tracing` or Perfetto.
+/// `on_written` is invoked when the file has been written, which can happen after this function returns.
+/// Should be called on the GUI thread.
+void bw_Application_stopTracing( bw_Application* app, bw_CStrSlice path, bw_ApplicationTraceWrittenFn on_written, void* data );
+
+/// Releases memory that can be done without, in all browser windows and their renderer processes.
+/// See `bw_BrowserWindow_trimMemory`, and `BW_APPLICATION_MEMORY_PRESSURE_CRITICAL` for what happens in addition to that.
+/// This is done automatically when the operating system signals that memory is running low.
+/// Should be called on the GUI thread.
+void bw_Application_trimMemory( bw_Application* app, bw_ApplicationMemoryPressure level );
+
+/// Writes the startup phases that have been reached to a file at `path`, in Chromium's trace event format.
+/// The file can be opened with `chrome://tracing` or Perfetto, and shows how long every phase took.
+bw_Err bw_Application_writeStartupTrace( const bw_Application* app, bw_CStrSlice path );
+
+/// Records the current time for the given phase of `app->startup_metrics`, unless it has been recorded already.
+/// This function is thread safe.
+void _bw_Application_markStartupPhase( bw_Application* app, uint64_t* phase );
+
 
 
 #ifdef __cplusplus
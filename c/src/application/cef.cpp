@@ -1,17 +1,34 @@
 #include "../application.h"
 #include "../debug.h"
 #include "../cef/app_handler.hpp"
+#include "../cef/bw_handle_map.hpp"
 #include "../cef/client_handler.hpp"
+#include "../cef/process_memory.hpp"
+#include "../cef/resource_registry.hpp"
+#include "../cef/worker_pool.hpp"
+#include "../resource.h"
 
 #include "impl.h"
 
 #include <include/cef_app.h>
 #include <include/cef_base.h>
+#include <include/cef_cookie.h>
+#include <include/cef_request_context.h>
+#include <include/cef_trace.h>
+#include <include/base/cef_bind.h>
+#include <include/wrapper/cef_closure_task.h>
 #ifdef BW_MACOS
 #include <include/wrapper/cef_library_loader.h>
 #endif
 #include <stdlib.h>
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+
 // X11 headers, when used by CEF
 #if defined(CEF_X11)
 #include <X11/Xlib.h>
@@ -22,9 +39,87 @@
 #pragma comment(lib, "shell32.lib")
 #endif
 
+// The milliseconds that bw_Application_finish waits for the jobs that are still running on the worker pool
+#define BW_APPLICATION_CEF_WORKER_TIMEOUT 5000
+
+#if defined(BW_GTK)
+// Lets the GTK main loop know when CEF needs to do work, as CEF doesn't run a message loop of its own there.
+class BrowserProcessHandler : public CefBrowserProcessHandler {
+	bw_Application* app;
+
+public:
+	BrowserProcessHandler( bw_Application* app ) : app(app) {}
+
+	// Can be called from any thread
+	virtual void OnScheduleMessagePumpWork( int64 delay_ms ) override {
+		bw_ApplicationImpl_scheduleEngineWork( this->app, delay_ms );
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(BrowserProcessHandler);
+};
+#endif
+
+// What CefInitialize needs, kept from the initialization of the application until the engine is started.
+struct bw_ApplicationCefStartup {
+	CefMainArgs main_args;
+	CefSettings settings;
+	CefRefPtr<CefApp> app_handle;
+};
+
+// Lets the GUI thread know when the engine has written its trace.
+class EndTracingCallback : public CefEndTracingCallback {
+	bw_Application* app;
+	bw_ApplicationDispatchFn on_written;
+	void* data;
+
+public:
+	EndTracingCallback( bw_Application* app, bw_ApplicationDispatchFn on_written, void* data ) : app(app), on_written(on_written), data(data) {}
+
+	virtual void OnEndTracingComplete( const CefString& tracing_file ) override {
+		(void)(tracing_file);
+		bw_Application_dispatch( this->app, this->on_written, this->data );
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(EndTracingCallback);
+};
+
+// Counts down the cookie stores that a fast shutdown is waiting for to be flushed.
+class FlushCallback : public CefCompletionCallback {
+	std::atomic<size_t> remaining;
+
+public:
+	FlushCallback( size_t count ) : remaining(count) {}
+
+	bool done() const {
+		return this->remaining == 0;
+	}
+
+	virtual void OnComplete() override {
+		this->remaining -= 1;
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(FlushCallback);
+};
+
+// The browsers that a fast shutdown has closed, but that haven't been destroyed yet
+static std::mutex bw_ApplicationCef_closingMutex;
+static std::set<int> bw_ApplicationCef_closingBrowsers;
+// The application that has postponed starting the browser engine, for the functions that aren't given one.
+// The engine belongs to the whole process, so there can only be one.
+static bw_Application* bw_ApplicationCef_lazyApp = nullptr;
+
+
+
 // Causes the current process to exit with the given exit code.
 void _bw_Application_exitProcess( int exit_code );
 CefString to_string( bw_CStrSlice );
+void _bw_ApplicationCef_beginTracing( CefString categories );
+void _bw_ApplicationCef_endTracing( CefString path, CefRefPtr<EndTracingCallback> callback );
+// Lets CEF do its work until `done` returns true, or until the deadline has passed, in which case it returns false.
+bool bw_ApplicationCef_waitUntil( std::chrono::steady_clock::time_point deadline, const std::function<bool()>& done );
 
 #ifdef CEF_X11
 int _bw_ApplicationCef_xErrorHandler( Display* display, XErrorEvent* event );
@@ -56,7 +151,11 @@ bw_Err bw_ApplicationEngineImpl_initialize( bw_ApplicationEngineImpl* impl, bw_A
 #endif
 
 	CefSettings app_settings;
-	CefRefPtr<CefApp> cef_app_handle( new AppHandler( app ) );
+#if defined(BW_GTK)
+	CefRefPtr<CefApp> cef_app_handle( new AppHandler( app, new BrowserProcessHandler( app ), settings ) );
+#else
+	CefRefPtr<CefApp> cef_app_handle( new AppHandler( app, nullptr, settings ) );
+#endif
 
 	if (settings->engine_seperate_executable_path.len == 0) {
 		int exit_code = CefExecuteProcess( main_args, cef_app_handle.get(), 0 );
@@ -70,38 +169,243 @@ bw_Err bw_ApplicationEngineImpl_initialize( bw_ApplicationEngineImpl* impl, bw_A
 		CefString( &app_settings.browser_subprocess_path ) = path;
 		bw_string_freeCstr(path);
 	}
+	_bw_Application_markStartupPhase( app, &app->startup_metrics.engine_processes );
 
 	// Only works on Windows and Linux according to docs.
 	// Here it says it works on Windows only: https://bitbucket.org/chromiumembedded/cef/wiki/GeneralUsage.md#markdown-header-linux
-	// TODO: Check if the GTK implementation works when it is set to false, and with CefMessageDoWork() called repeatedly from somewhere else.
+	// On GTK, CEF asks for the moments it needs to do work through OnScheduleMessagePumpWork, and the GLib main loop calls CefDoMessageLoopWork at those moments.
 	// TODO: Check if it works on BSD by any chance.
-	// TODO: For unsupported systems (like macOS), CefDoMessageLoopWork needs to be called repeatedly.
-	//       This is usually less effecient than using the multithreaded message loop though.
+	// TODO: For unsupported systems (like macOS), the external message pump needs to be implemented as well.
 	// TODO: If GTK will be used on macOS in the future, the 'if' macro below needs to be corrected.
 #if defined(BW_WIN32)
 	app_settings.multi_threaded_message_loop = true;
+#elif defined(BW_GTK)
+	app_settings.external_message_pump = true;
 #endif
+	// Windowless rendering may slow down the rendering of normal browser windows, so it is only enabled when asked for
+	app_settings.windowless_rendering_enabled = settings->windowless_rendering != FALSE;
 	if ( settings->resource_dir.data != 0 ) {
 		char* path = bw_string_copyAsNewCstr( settings->resource_dir );
 		CefString( &app_settings.resources_dir_path ) = path;
 		bw_string_freeCstr(path);
 	}
+	// Without a cache directory, everything is kept in memory and a warm start is just as slow as a cold one
+	if ( settings->cache_dir.len > 0 ) {
+		char* path = bw_string_copyAsNewCstr( settings->cache_dir );
+		CefString( &app_settings.root_cache_path ) = path;
+		CefString( &app_settings.cache_path ) = path;
+		bw_string_freeCstr(path);
+		app_settings.persist_session_cookies = settings->persist_session_cookies != FALSE;
+	}
 
-	CefInitialize( main_args, app_settings, cef_app_handle.get(), 0 );
+	// The pack is mapped only once, so that no resource needs to be read from disk by itself
+	if ( settings->resource_pack.len > 0 ) {
+		bw_Err error = bw_Resource_loadPack( settings->resource_pack );
+		if ( BW_ERR_IS_FAIL( error ) )
+			return error;
+	}
 
 	CefRefPtr<CefClient>* client = new CefRefPtr<CefClient>(new ClientHandler( app ));
 
 	impl->exit_code = 0;
 	impl->cef_client = (void*)client;
+	impl->isolate_popups = settings->isolate_popups;
+	impl->startup = new bw_ApplicationCefStartup { main_args, app_settings, cef_app_handle };
+
+	// Only the sub-processes had to be started right away, the rest can wait until a browser window needs the engine.
+	// When CEF provides the windows as well, nothing can be shown without it.
+#if !defined(BW_CEF_WINDOW)
+	if ( settings->lazy_engine ) {
+		bw_ApplicationCef_lazyApp = app;
+		BW_ERR_RETURN_SUCCESS;
+	}
+#endif
+	bw_ApplicationEngineImpl_start( app );
 
 	BW_ERR_RETURN_SUCCESS;
 }
 
+void bw_ApplicationEngineImpl_start( bw_Application* app ) {
+	bw_ApplicationCefStartup* startup = (bw_ApplicationCefStartup*)app->engine_impl.startup;
+	if ( startup == nullptr )
+		return;
+	app->engine_impl.startup = nullptr;
+	bw_ApplicationCef_lazyApp = nullptr;
+
+	CefInitialize( startup->main_args, startup->settings, startup->app_handle.get(), 0 );
+	_bw_Application_markStartupPhase( app, &app->startup_metrics.engine_initialized );
+
+	// Requests to the resource scheme are answered from memory, without going through the network stack
+	CefRegisterSchemeHandlerFactory( BW_RESOURCE_SCHEME, "", new bw::ResourceSchemeHandlerFactory() );
+
+	delete startup;
+}
+
+void bw_ApplicationEngineImpl_startPending() {
+	if ( bw_ApplicationCef_lazyApp != nullptr )
+		bw_ApplicationEngineImpl_start( bw_ApplicationCef_lazyApp );
+}
+
+void bw_ApplicationEngineImpl_doMessageLoopWork( bw_Application* app ) {
+	if ( app->engine_impl.startup != nullptr )
+		return;
+	CefDoMessageLoopWork();
+}
+
+BOOL bw_ApplicationEngineImpl_startTracing( bw_Application* app, bw_CStrSlice categories ) {
+	// An engine that hasn't been started has nothing to trace yet
+	if ( app->engine_impl.startup != nullptr )
+		return FALSE;
+
+	// Tracing can only be controlled from CEF's UI thread, which is not the GUI thread when CEF runs its own message loop
+	if ( !CefCurrentlyOn( TID_UI ) )
+		return CefPostTask( TID_UI, base::Bind( &_bw_ApplicationCef_beginTracing, to_string( categories ) ) );
+
+	return CefBeginTracing( to_string( categories ), nullptr );
+}
+
+void bw_ApplicationEngineImpl_stopTracing( bw_Application* app, bw_CStrSlice path, bw_ApplicationDispatchFn on_written, void* data ) {
+	CefRefPtr<EndTracingCallback> callback = new EndTracingCallback( app, on_written, data );
+
+	if ( !CefCurrentlyOn( TID_UI ) ) {
+		if ( !CefPostTask( TID_UI, base::Bind( &_bw_ApplicationCef_endTracing, to_string( path ), callback ) ) )
+			bw_Application_dispatch( app, on_written, data );
+	}
+	else
+		_bw_ApplicationCef_endTracing( to_string( path ), callback );
+}
+
+void _bw_ApplicationCef_beginTracing( CefString categories ) {
+	CefBeginTracing( categories, nullptr );
+}
+
+void _bw_ApplicationCef_endTracing( CefString path, CefRefPtr<EndTracingCallback> callback ) {
+	// The callback isn't invoked when the engine wasn't tracing, in which case there is nothing to merge
+	if ( !CefEndTracing( path, callback ) )
+		callback->OnEndTracingComplete( path );
+}
+
+void bw_ApplicationEngineImpl_getMemoryStats( const bw_Application* app, bw_ApplicationMemoryStats* stats ) {
+	(void)(app);
+
+	// Every browser window of which the browser has been created is linked in the handle map
+	std::vector<bw_BrowserWindow*> handles = bw::bw_handle_map.all();
+	for ( auto it = handles.begin(); it != handles.end(); it++ ) {
+		bw_BrowserWindowMemoryStats window_stats;
+		bw_BrowserWindow_getNativeMemoryStats( *it, &window_stats );
+
+		stats->browser_windows += 1;
+		stats->pending_calls += window_stats.pending_calls;
+		stats->queued_bytes += window_stats.queued_bytes;
+		stats->cached_response_bytes += window_stats.cached_response_bytes;
+	}
+
+	stats->process_private_bytes = bw_cef_privateBytes();
+}
+
+void bw_ApplicationEngineImpl_trimMemory( bw_Application* app, bw_ApplicationMemoryPressure level ) {
+	(void)(app);
+
+	std::vector<bw_BrowserWindow*> handles = bw::bw_handle_map.all();
+	for ( auto it = handles.begin(); it != handles.end(); it++ ) {
+		bw_BrowserWindow_trimMemory( *it, level );
+	}
+}
+
 void bw_ApplicationEngineImpl_finish( bw_ApplicationEngineImpl* app ) {
-	CefShutdown();
+	// Threaded handlers may still be using the browser engine.
+	// A handler that waits for work it has dispatched to the GUI thread will never finish now that the event loop has stopped, so they only get a limited time.
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( BW_APPLICATION_CEF_WORKER_TIMEOUT );
+	bool idle = bw::worker_pool.stop( deadline );
+	if ( app->startup != nullptr ) {
+		delete (bw_ApplicationCefStartup*)app->startup;
+		bw_ApplicationCef_lazyApp = nullptr;
+	}
+	// Shutting down CEF while a handler is still using it would wait for that handler as well
+	else if ( idle )
+		CefShutdown();
+	delete (CefRefPtr<CefClient>*)app->cef_client;
+}
+
+void bw_ApplicationEngineImpl_finishFast( bw_ApplicationEngineImpl* app, unsigned int timeout ) {
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( timeout );
+
+	// Without the engine, there is nothing to flush or close
+	if ( app->startup != nullptr ) {
+		bw::worker_pool.stop( deadline );
+		delete (bw_ApplicationCefStartup*)app->startup;
+		delete (CefRefPtr<CefClient>*)app->cef_client;
+		bw_ApplicationCef_lazyApp = nullptr;
+		return;
+	}
+
+	// The cookie stores of all request contexts that are in use are flushed, which is all that needs to be on disk before the process exits
+	std::vector<CefRefPtr<CefBrowser>> browsers;
+	std::vector<CefRefPtr<CefRequestContext>> contexts = { CefRequestContext::GetGlobalContext() };
+	std::vector<bw_BrowserWindow*> handles = bw::bw_handle_map.all();
+	for ( auto it = handles.begin(); it != handles.end(); it++ ) {
+		CefRefPtr<CefBrowser> browser = *(CefRefPtr<CefBrowser>*)(*it)->impl.cef_ptr;
+		browsers.push_back( browser );
+
+		CefRefPtr<CefRequestContext> context = browser->GetHost()->GetRequestContext();
+		bool known = false;
+		for ( auto known_it = contexts.begin(); known_it != contexts.end() && !known; known_it++ ) {
+			known = (*known_it)->IsSame( context );
+		}
+		if ( !known )
+			contexts.push_back( context );
+	}
+
+	CefRefPtr<FlushCallback> flushed = new FlushCallback( contexts.size() );
+	for ( auto it = contexts.begin(); it != contexts.end(); it++ ) {
+		CefRefPtr<CefCookieManager> cookie_manager = (*it)->GetCookieManager( nullptr );
+		if ( cookie_manager == nullptr || !cookie_manager->FlushStore( flushed ) )
+			flushed->OnComplete();
+	}
+
+	// All browsers are closed at the same time, without running the unload handlers of their pages or the cleanup of their browser windows
+	{
+		std::lock_guard<std::mutex> lock( bw_ApplicationCef_closingMutex );
+		for ( auto it = browsers.begin(); it != browsers.end(); it++ ) {
+			bw_ApplicationCef_closingBrowsers.insert( (*it)->GetIdentifier() );
+		}
+	}
+	for ( auto it = browsers.begin(); it != browsers.end(); it++ ) {
+		(*it)->GetHost()->CloseBrowser( true );
+	}
+
+	bool closed = bw_ApplicationCef_waitUntil( deadline, [flushed]() {
+		std::lock_guard<std::mutex> lock( bw_ApplicationCef_closingMutex );
+		return bw_ApplicationCef_closingBrowsers.empty() && flushed->done();
+	} );
+
+	// Shutting down CEF waits for everything that it is still doing, so it is skipped when time has run out
+	bool idle = bw::worker_pool.stop( deadline );
+	if ( closed && idle )
+		CefShutdown();
 	delete (CefRefPtr<CefClient>*)app->cef_client;
 }
 
+void _bw_ApplicationCef_onBrowserClosed( int browser_id ) {
+	std::lock_guard<std::mutex> lock( bw_ApplicationCef_closingMutex );
+
+	bw_ApplicationCef_closingBrowsers.erase( browser_id );
+}
+
+bool bw_ApplicationCef_waitUntil( std::chrono::steady_clock::time_point deadline, const std::function<bool()>& done ) {
+	while ( !done() ) {
+		if ( std::chrono::steady_clock::now() >= deadline )
+			return false;
+
+		// When CEF runs its own message loop, it does its work on another thread
+#if !defined(BW_WIN32)
+		CefDoMessageLoopWork();
+#endif
+		std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+	}
+	return true;
+}
+
 
 
 #ifdef CEF_X11
@@ -10,6 +10,8 @@ extern "C" {
 typedef struct {
 	void* cef_client;
 	int exit_code;
+	BOOL isolate_popups;
+	void* startup;	// The initialization that is left to do when the engine is started lazily, or null once it has been started
 } bw_ApplicationEngineImpl;
 
 
@@ -6,10 +6,18 @@
 #include <include/cef_app.h>
 #include <include/base/cef_bind.h>
 #include <include/wrapper/cef_closure_task.h>
+#ifdef BW_MACOS
+#include <dispatch/dispatch.h>
+#endif
 
 
 
 void bw_ApplicationImpl_dispatchHandler( bw_Application* app, bw_ApplicationDispatchData* data );
+void bw_ApplicationImpl_idleDispatchHandler( bw_Application* app );
+void bw_ApplicationImpl_runDispatches( bw_Application* app );
+#ifdef BW_MACOS
+void bw_ApplicationCefWindow_onMemoryPressure( void* _app );
+#endif
 
 
 
@@ -40,17 +48,41 @@ void bw_ApplicationImpl_dispatchHandler( bw_Application* app, bw_ApplicationDisp
 	data->func( app, data->data );
 }
 
+// Posts itself again at the back of the task queue when the dispatch budget has been used up
+void bw_ApplicationImpl_runDispatches( bw_Application* app ) {
+	if ( bw_Application_runDispatches( app ) )
+		CefPostTask( TID_UI, base::Bind( &bw_ApplicationImpl_runDispatches, app ) );
+}
+
+// Posts itself again at the back of the task queue for as long as there is idle work left, so that other tasks can go in between
+void bw_ApplicationImpl_idleDispatchHandler( bw_Application* app ) {
+	if ( bw_Application_runIdleDispatches( app ) )
+		CefPostTask( TID_UI, base::Bind( &bw_ApplicationImpl_idleDispatchHandler, app ) );
+}
 
 
-BOOL bw_ApplicationImpl_dispatch( bw_Application* app, bw_ApplicationDispatchData* data ) {
 
-	CefPostTask( TID_UI, base::Bind( &bw_ApplicationImpl_dispatchHandler, app, data ) );
+BOOL bw_ApplicationImpl_wakeUp( bw_Application* app, bw_ApplicationDispatchPriority priority ) {
+
+	// CEF's task runner has no priorities, so the dispatches are only ordered among themselves
+	if ( priority == BW_APPLICATION_DISPATCH_PRIORITY_IDLE )
+		CefPostTask( TID_UI, base::Bind( &bw_ApplicationImpl_idleDispatchHandler, app ) );
+	else
+		CefPostTask( TID_UI, base::Bind( &bw_ApplicationImpl_runDispatches, app ) );
 	return TRUE;
 }
 
 void bw_ApplicationImpl_finish( bw_ApplicationImpl* app ) {
+#ifdef BW_MACOS
+	if ( app->memory_pressure_source != 0 ) {
+		dispatch_source_t source = (dispatch_source_t)app->memory_pressure_source;
+		dispatch_source_cancel( source );
+		dispatch_release( source );
+	}
+#else
 	UNUSED( app );
-	CefShutdown();
+#endif
+	// CEF is shut down by the browser engine, in bw_ApplicationEngineImpl_finish
 }
 
 int bw_ApplicationImpl_run( bw_Application* app, bw_ApplicationImpl_ReadyHandlerData* ready_handler_data ) {
@@ -66,11 +98,35 @@ int bw_ApplicationImpl_run( bw_Application* app, bw_ApplicationImpl_ReadyHandler
 
 // Doesn't need to be implemented because it is already done so in bw_ApplicationEngineImpl_initialize
 bw_ApplicationImpl bw_ApplicationImpl_initialize( bw_Application* app, int argc, char** argv, const bw_ApplicationSettings* settings ) {
-	UNUSED( app );
 	UNUSED( argc );
 	UNUSED( argv );
 	UNUSED( settings );
 
 	bw_ApplicationImpl impl;
+	impl.memory_pressure_source = 0;
+
+#ifdef BW_MACOS
+	// The main queue is drained by the message loop on the GUI thread
+	dispatch_source_t source = dispatch_source_create( DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL, dispatch_get_main_queue() );
+	if ( source != 0 ) {
+		dispatch_set_context( source, app );
+		dispatch_source_set_event_handler_f( source, bw_ApplicationCefWindow_onMemoryPressure );
+		dispatch_resume( source );
+		impl.memory_pressure_source = (void*)source;
+	}
+#else
+	UNUSED( app );
+#endif
+
 	return impl;
-}
\ No newline at end of file
+}
+
+#ifdef BW_MACOS
+void bw_ApplicationCefWindow_onMemoryPressure( void* _app ) {
+	bw_Application* app = (bw_Application*)_app;
+	dispatch_source_t source = (dispatch_source_t)app->impl.memory_pressure_source;
+
+	unsigned long level = dispatch_source_get_data( source );
+	bw_Application_trimMemory( app, ( level & DISPATCH_MEMORYPRESSURE_CRITICAL ) != 0 ? BW_APPLICATION_MEMORY_PRESSURE_CRITICAL : BW_APPLICATION_MEMORY_PRESSURE_MODERATE );
+}
+#endif
\ No newline at end of file
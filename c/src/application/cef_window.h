@@ -15,6 +15,7 @@ extern "C" {
 
 typedef struct {
 	int exit_code;
+	void* memory_pressure_source;	// The dispatch source that signals memory pressure on macOS, or null
 } bw_ApplicationImpl;
 
 
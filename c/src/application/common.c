@@ -1,13 +1,78 @@
+// Needed for clock_gettime
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include "../application.h"
+#include "../atomic.h"
+#include "../browser_window/pool.h"
 #include "../common.h"
+#include "../trace.h"
+#include "../window.h"
 
 #include "impl.h"
 
+#include <stddef.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+
+
+// The startup phases in the order in which they are normally reached, as they are named in startup traces
+typedef struct {
+	const char* name;
+	size_t offset;
+} bw_ApplicationStartupPhase;
+
+static const bw_ApplicationStartupPhase bw_Application_startupPhases[] = {
+	{ "engine_processes", offsetof( bw_ApplicationStartupMetrics, engine_processes ) },
+	{ "engine_initialized", offsetof( bw_ApplicationStartupMetrics, engine_initialized ) },
+	{ "initialized", offsetof( bw_ApplicationStartupMetrics, initialized ) },
+	{ "ready", offsetof( bw_ApplicationStartupMetrics, ready ) },
+	{ "first_window", offsetof( bw_ApplicationStartupMetrics, first_window ) },
+	{ "first_browser_requested", offsetof( bw_ApplicationStartupMetrics, first_browser_requested ) },
+	{ "first_browser_created", offsetof( bw_ApplicationStartupMetrics, first_browser_created ) },
+	{ "first_load", offsetof( bw_ApplicationStartupMetrics, first_load ) },
+	{ "first_paint", offsetof( bw_ApplicationStartupMetrics, first_paint ) }
+};
+
+// The browser engine writes its trace next to the one that is requested, to be merged into it
+#define BW_APPLICATION_ENGINE_TRACE_SUFFIX ".engine.json"
+
+typedef struct {
+	char* path;	// Followed by the suffix of the engine's trace
+	size_t path_len;	// The length of the path without the suffix
+	BOOL engine_trace;
+	bw_ApplicationTraceWrittenFn on_written;
+	void* data;
+} bw_ApplicationTraceData;
+
+
+
+void bw_Application_execute( bw_Application* app, bw_ApplicationDispatchData* dispatch_data, bw_ApplicationDispatchPriority priority );
+void bw_Application_writeTrace( bw_Application* app, void* data );
+void bw_ApplicationDispatchQueue_init( bw_ApplicationDispatchQueue* queue );
+void bw_ApplicationDispatchQueue_link( bw_ApplicationDispatchQueue* queue, bw_ApplicationDispatchData* node );
+bw_ApplicationDispatchData* bw_ApplicationDispatchQueue_pop( bw_ApplicationDispatchQueue* queue );
+BOOL bw_ApplicationDispatchQueue_push( bw_ApplicationDispatchQueue* queue, bw_ApplicationDispatchData* node );
+void bw_ApplicationDispatchQueue_clear( bw_ApplicationDispatchQueue* queue );
 
 
 
 void bw_Application_free( bw_Application* app ) {
+	// Work that got dispatched after the event loop had stopped will never be executed
+	for ( int i = 0; i < BW_APPLICATION_DISPATCH_PRIORITY_COUNT; i++ ) {
+		bw_ApplicationDispatchQueue_clear( &app->dispatch_queues[i] );
+	}
+	bw_Slab_destroy( &app->window_slab );
+	bw_Slab_destroy( &app->browser_window_slab );
 	free( app );
 }
 
@@ -16,6 +81,9 @@ BOOL bw_Application_isRunning( const bw_Application* app ) {
 }
 
 void bw_Application_markAsDone(bw_Application* app) {
+	// Pooled browser windows won't ever be used anymore
+	bw_BrowserWindowPool_drain(app);
+
 	app->is_done = TRUE;
 	if (app->windows_alive == 0)
 		bw_Application_exit(app, 0);
@@ -24,6 +92,14 @@ void bw_Application_markAsDone(bw_Application* app) {
 void bw_Application_runOnReady(bw_Application* app, void* user_data) {
 	bw_ApplicationImpl_ReadyHandlerData* ready_handler_data = (bw_ApplicationImpl_ReadyHandlerData*)user_data;
 
+	_bw_Application_markStartupPhase( app, &app->startup_metrics.ready );
+
+	// Work that has been dispatched before the event loop was running couldn't wake it up, so it gets picked up now
+	for ( bw_ApplicationDispatchPriority i = 0; i < BW_APPLICATION_DISPATCH_PRIORITY_COUNT; i++ ) {
+		bw_atomic_storeInt( &app->dispatch_queues[i].wakeup_pending, 1 );
+		bw_ApplicationImpl_wakeUp( app, i );
+	}
+
 	ready_handler_data->func(app, ready_handler_data->data);
 }
 
@@ -46,43 +122,361 @@ int bw_Application_run( bw_Application* app, bw_ApplicationReadyFn on_ready, voi
 
 	int exit_code = bw_ApplicationImpl_run( app, &handler_data_wrapper );
 	app->is_running = FALSE;
+	bw_atomic_storeInt( &app->has_stopped, 1 );
 	return exit_code;
 }
 
+void bw_Application_getDispatchLatencies( const bw_Application* app, bw_ApplicationDispatchPriority priority, bw_LatencyHistogram* histogram ) {
+	BW_ASSERT( priority < BW_APPLICATION_DISPATCH_PRIORITY_COUNT, "Invalid dispatch priority" );
+
+	bw_LatencyHistogram_snapshot( &app->dispatch_latencies[ priority ], histogram );
+}
+
+void bw_Application_getMemoryStats( const bw_Application* app, bw_ApplicationMemoryStats* stats ) {
+	memset( stats, 0, sizeof( bw_ApplicationMemoryStats ) );
+
+	for ( int i = 0; i < BW_APPLICATION_DISPATCH_PRIORITY_COUNT; i++ ) {
+		stats->queued_dispatches += (size_t)_bw_Metrics_read( &app->dispatch_queues[i].length );
+	}
+	bw_ApplicationEngineImpl_getMemoryStats( app, stats );
+}
+
+void bw_Application_trimMemory( bw_Application* app, bw_ApplicationMemoryPressure level ) {
+	bw_Application_assertCorrectThread( app );
+	BW_TRACE_BEGIN( span );
+
+	bw_ApplicationEngineImpl_trimMemory( app, level );
+
+	// Prewarmed browser windows are only there to be fast, and their renderer processes take up the most memory of all.
+	// Browser windows that are created afterwards aren't taken from a pool anymore, until it is prewarmed again.
+	if ( level >= BW_APPLICATION_MEMORY_PRESSURE_CRITICAL )
+		bw_BrowserWindowPool_drain( app );
+
+	BW_TRACE_END( span, "trim_memory" );
+}
+
+void bw_Application_getStartupMetrics( const bw_Application* app, bw_ApplicationStartupMetrics* metrics ) {
+	// Phases can be reached on other threads, so every timestamp is read atomically
+	uint64_t* source = (uint64_t*)&app->startup_metrics;
+	uint64_t* destination = (uint64_t*)metrics;
+	for ( size_t i = 0; i < sizeof( bw_ApplicationStartupMetrics ) / sizeof( uint64_t ); i++ ) {
+		destination[i] = bw_atomic_compareExchangeU64( &source[i], 0, 0 );
+	}
+}
+
+void _bw_Application_markStartupPhase( bw_Application* app, uint64_t* phase ) {
+	// Only the first time counts
+	if ( *phase == 0 )
+		bw_atomic_compareExchangeU64( phase, 0, bw_Application_now() );
+}
+
 void bw_Application_finish( bw_Application* app ) {
 
 	bw_ApplicationEngineImpl_finish( &app->engine_impl );
 	bw_ApplicationImpl_finish( &app->impl );
 }
 
+void bw_Application_finishFast( bw_Application* app, unsigned int timeout ) {
+
+	bw_ApplicationEngineImpl_finishFast( &app->engine_impl, timeout );
+	bw_ApplicationImpl_finish( &app->impl );
+}
+
 bw_Err bw_Application_initialize( bw_Application** app, int argc, char** argv, const bw_ApplicationSettings* settings ) {
 
 	*app = (bw_Application*)malloc( sizeof( bw_Application ) );
+	memset( &(*app)->startup_metrics, 0, sizeof( bw_ApplicationStartupMetrics ) );
+	memset( (*app)->dispatch_latencies, 0, sizeof( (*app)->dispatch_latencies ) );
+	_bw_Application_markStartupPhase( *app, &(*app)->startup_metrics.initialize );
+	for ( int i = 0; i < BW_APPLICATION_DISPATCH_PRIORITY_COUNT; i++ ) {
+		bw_ApplicationDispatchQueue_init( &(*app)->dispatch_queues[i] );
+	}
 	(*app)->windows_alive = 0;
 	(*app)->is_running = FALSE;
 	(*app)->is_done = FALSE;
+	(*app)->has_stopped = 0;
+	(*app)->dispatch_budget = settings->dispatch_budget;
+	(*app)->browser_window_pool = 0;
+	(*app)->engine_tracing = FALSE;
+	bw_Slab_init( &(*app)->window_slab, sizeof( bw_Window ) );
+	bw_Slab_init( &(*app)->browser_window_slab, sizeof( bw_BrowserWindow ) );
 
 	bw_Err error = bw_ApplicationEngineImpl_initialize( &(*app)->engine_impl, (*app), argc, argv, settings );
 	if (BW_ERR_IS_FAIL(error))	return error;
 	(*app)->impl = bw_ApplicationImpl_initialize( (*app), argc, argv, settings );
 
+	_bw_Application_markStartupPhase( *app, &(*app)->startup_metrics.initialized );
 	BW_ERR_RETURN_SUCCESS;
 }
 
+void bw_Application_startEngine( bw_Application* app ) {
+	bw_Application_assertCorrectThread( app );
+
+	bw_ApplicationEngineImpl_start( app );
+}
+
 BOOL bw_Application_dispatch( bw_Application* app, bw_ApplicationDispatchFn func, void* data ) {
+	return bw_Application_dispatchWithPriority( app, func, data, BW_APPLICATION_DISPATCH_PRIORITY_NORMAL );
+}
+
+BOOL bw_Application_dispatchDelayed( bw_Application* app, bw_ApplicationDispatchFn func, void* data, uint64_t milliseconds ) {
 
 	bw_ApplicationDispatchData* dispatch_data = (bw_ApplicationDispatchData*)malloc( sizeof(bw_ApplicationDispatchData) );
 	dispatch_data->func = func;
 	dispatch_data->data = data;
+	dispatch_data->queued_at = 0;
 
-	return bw_ApplicationImpl_dispatch( app, dispatch_data );
+	return bw_ApplicationImpl_dispatchDelayed( app, dispatch_data, milliseconds );
 }
 
-BOOL bw_Application_dispatchDelayed( bw_Application* app, bw_ApplicationDispatchFn func, void* data, uint64_t milliseconds ) {
+BOOL bw_Application_dispatchWithPriority( bw_Application* app, bw_ApplicationDispatchFn func, void* data, bw_ApplicationDispatchPriority priority ) {
+	BW_ASSERT( priority < BW_APPLICATION_DISPATCH_PRIORITY_COUNT, "Invalid dispatch priority" );
 
 	bw_ApplicationDispatchData* dispatch_data = (bw_ApplicationDispatchData*)malloc( sizeof(bw_ApplicationDispatchData) );
 	dispatch_data->func = func;
 	dispatch_data->data = data;
+	dispatch_data->queued_at = bw_Application_now();
 
-	return bw_ApplicationImpl_dispatchDelayed( app, dispatch_data, milliseconds );
+	// Only the first dispatch after the queue has been drained needs to wake up the GUI thread.
+	// All others are executed by the same wakeup.
+	bw_ApplicationDispatchQueue* queue = &app->dispatch_queues[ priority ];
+	if ( bw_ApplicationDispatchQueue_push( queue, dispatch_data ) && !bw_ApplicationImpl_wakeUp( app, priority ) ) {
+		// Let the next dispatch try again
+		bw_atomic_storeInt( &queue->wakeup_pending, 0 );
+	}
+
+	// Before the event loop runs, the queue gets drained as soon as it starts.
+	// Once it has stopped, the queued dispatch is freed along with the application, but its data remains the caller's.
+	return !bw_atomic_loadInt( &app->has_stopped );
+}
+
+uint64_t bw_Application_now() {
+#ifdef _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency( &frequency );
+	QueryPerformanceCounter( &counter );
+	return (uint64_t)( counter.QuadPart / frequency.QuadPart * 1000000 + counter.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart );
+#else
+	struct timespec time;
+	clock_gettime( CLOCK_MONOTONIC, &time );
+	return (uint64_t)time.tv_sec * 1000000 + (uint64_t)time.tv_nsec / 1000;
+#endif
+}
+
+// Executes and frees queued work, and records how long it has been waiting in its queue
+void bw_Application_execute( bw_Application* app, bw_ApplicationDispatchData* dispatch_data, bw_ApplicationDispatchPriority priority ) {
+	if ( dispatch_data->queued_at != 0 )
+		bw_LatencyHistogram_record( &app->dispatch_latencies[ priority ], bw_Application_now() - dispatch_data->queued_at );
+
+	BW_TRACE_BEGIN( span );
+	dispatch_data->func( app, dispatch_data->data );
+	BW_TRACE_END( span, "dispatch" );
+	free( dispatch_data );
+}
+
+BOOL bw_Application_runDispatches( bw_Application* app ) {
+	bw_ApplicationDispatchQueue* high = &app->dispatch_queues[ BW_APPLICATION_DISPATCH_PRIORITY_HIGH ];
+	bw_ApplicationDispatchQueue* normal = &app->dispatch_queues[ BW_APPLICATION_DISPATCH_PRIORITY_NORMAL ];
+
+	// Reset the flags before draining the queues, so that dispatches queued in the meantime will cause another wakeup
+	bw_atomic_storeInt( &high->wakeup_pending, 0 );
+	bw_atomic_storeInt( &normal->wakeup_pending, 0 );
+
+	uint64_t deadline = app->dispatch_budget != 0 ? bw_Application_now() + app->dispatch_budget : 0;
+
+	// High priority work that gets queued while normal work is being executed, still goes first
+	bw_ApplicationDispatchData* dispatch_data;
+	while ( 1 ) {
+		bw_ApplicationDispatchPriority priority = BW_APPLICATION_DISPATCH_PRIORITY_HIGH;
+		if ( ( dispatch_data = bw_ApplicationDispatchQueue_pop( high ) ) == 0 ) {
+			priority = BW_APPLICATION_DISPATCH_PRIORITY_NORMAL;
+			if ( ( dispatch_data = bw_ApplicationDispatchQueue_pop( normal ) ) == 0 )
+				break;
+		}
+		bw_Application_execute( app, dispatch_data, priority );
+
+		if ( deadline != 0 && bw_Application_now() >= deadline ) {
+			// Mark the queues as pending again, because the implementation is going to continue with them anyway
+			bw_atomic_storeInt( &high->wakeup_pending, 1 );
+			bw_atomic_storeInt( &normal->wakeup_pending, 1 );
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+BOOL bw_Application_runIdleDispatches( bw_Application* app ) {
+	bw_ApplicationDispatchQueue* queue = &app->dispatch_queues[ BW_APPLICATION_DISPATCH_PRIORITY_IDLE ];
+
+	bw_atomic_storeInt( &queue->wakeup_pending, 0 );
+
+	uint64_t deadline = app->dispatch_budget != 0 ? bw_Application_now() + app->dispatch_budget : 0;
+	bw_ApplicationDispatchData* dispatch_data;
+	while ( ( dispatch_data = bw_ApplicationDispatchQueue_pop( queue ) ) != 0 ) {
+		bw_Application_execute( app, dispatch_data, BW_APPLICATION_DISPATCH_PRIORITY_IDLE );
+
+		if ( deadline != 0 && bw_Application_now() >= deadline ) {
+			bw_atomic_storeInt( &queue->wakeup_pending, 1 );
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+void bw_ApplicationDispatchQueue_init( bw_ApplicationDispatchQueue* queue ) {
+	queue->stub.next = 0;
+	queue->head = &queue->stub;
+	queue->tail = &queue->stub;
+	queue->wakeup_pending = 0;
+	queue->length = 0;
+}
+
+void bw_ApplicationDispatchQueue_link( bw_ApplicationDispatchQueue* queue, bw_ApplicationDispatchData* node ) {
+	node->next = 0;
+
+	// Between these two steps, the queue is briefly disconnected.
+	// If the GUI thread drains the queue right then, it stops at the previous node, but the wakeup that follows picks up the rest.
+	bw_ApplicationDispatchData* prev = (bw_ApplicationDispatchData*)bw_atomic_exchangePtr( &queue->head, node );
+	bw_atomic_storePtr( &prev->next, node );
+}
+
+// Takes the oldest dispatch out of the queue.
+// Returns null if the queue is empty, or if the next dispatch is still being linked in by another thread.
+// This function can only be called from the GUI thread.
+bw_ApplicationDispatchData* bw_ApplicationDispatchQueue_pop( bw_ApplicationDispatchQueue* queue ) {
+	bw_ApplicationDispatchData* tail = queue->tail;
+	bw_ApplicationDispatchData* next = (bw_ApplicationDispatchData*)bw_atomic_loadPtr( &tail->next );
+
+	// Skip the stub
+	if ( tail == &queue->stub ) {
+		if ( next == 0 )
+			return 0;
+
+		queue->tail = next;
+		tail = next;
+		next = (bw_ApplicationDispatchData*)bw_atomic_loadPtr( &tail->next );
+	}
+
+	if ( next != 0 ) {
+		queue->tail = next;
+		bw_atomic_addU64( &queue->length, (uint64_t)-1 );
+		return tail;
+	}
+
+	// The tail is the last node, unless another node is being linked in right now
+	bw_ApplicationDispatchData* head = (bw_ApplicationDispatchData*)bw_atomic_loadPtr( &queue->head );
+	if ( tail != head )
+		return 0;
+
+	// Put the stub back behind the last node, so that the last node can be taken out as well
+	bw_ApplicationDispatchQueue_link( queue, &queue->stub );
+
+	next = (bw_ApplicationDispatchData*)bw_atomic_loadPtr( &tail->next );
+	if ( next != 0 ) {
+		queue->tail = next;
+		bw_atomic_addU64( &queue->length, (uint64_t)-1 );
+		return tail;
+	}
+
+	return 0;
+}
+
+// Queues up the dispatch.
+// Returns whether the GUI thread needs to be woken up to process it.
+BOOL bw_ApplicationDispatchQueue_push( bw_ApplicationDispatchQueue* queue, bw_ApplicationDispatchData* node ) {
+	bw_atomic_addU64( &queue->length, 1 );
+	bw_ApplicationDispatchQueue_link( queue, node );
+
+	return bw_atomic_exchangeInt( &queue->wakeup_pending, 1 ) == 0;
+}
+
+// Frees all dispatches that are still queued, without executing them.
+void bw_ApplicationDispatchQueue_clear( bw_ApplicationDispatchQueue* queue ) {
+	bw_ApplicationDispatchData* dispatch_data;
+	while ( ( dispatch_data = bw_ApplicationDispatchQueue_pop( queue ) ) != 0 ) {
+		free( dispatch_data );
+	}
+}
+
+void bw_Application_startTracing( bw_Application* app, size_t capacity, bw_CStrSlice engine_categories ) {
+	bw_Trace_start( capacity );
+
+	if ( engine_categories.len > 0 && !app->engine_tracing )
+		app->engine_tracing = bw_ApplicationEngineImpl_startTracing( app, engine_categories );
+}
+
+// Writes our own events, merged with the trace that the browser engine has written next to it
+void bw_Application_writeTrace( bw_Application* app, void* _data ) {
+	bw_ApplicationTraceData* data = (bw_ApplicationTraceData*)_data;
+
+	bw_CStrSlice path = { data->path_len, data->path };
+	bw_CStrSlice engine_path = { data->engine_trace ? strlen( data->path ) : 0, data->path };
+	bw_Err error = bw_Trace_write( path, engine_path );
+	data->on_written( app, data->data, error );
+
+	free( data->path );
+	free( data );
+}
+
+void bw_Application_stopTracing( bw_Application* app, bw_CStrSlice path, bw_ApplicationTraceWrittenFn on_written, void* data ) {
+	bw_Trace_stop();
+
+	bw_ApplicationTraceData* trace_data = (bw_ApplicationTraceData*)malloc( sizeof( bw_ApplicationTraceData ) );
+	trace_data->path = (char*)malloc( path.len + sizeof( BW_APPLICATION_ENGINE_TRACE_SUFFIX ) );
+	memcpy( trace_data->path, path.data, path.len );
+	memcpy( trace_data->path + path.len, BW_APPLICATION_ENGINE_TRACE_SUFFIX, sizeof( BW_APPLICATION_ENGINE_TRACE_SUFFIX ) );
+	trace_data->path_len = path.len;
+	trace_data->engine_trace = app->engine_tracing;
+	trace_data->on_written = on_written;
+	trace_data->data = data;
+
+	if ( app->engine_tracing ) {
+		app->engine_tracing = FALSE;
+		bw_CStrSlice engine_path = { strlen( trace_data->path ), trace_data->path };
+		bw_ApplicationEngineImpl_stopTracing( app, engine_path, bw_Application_writeTrace, trace_data );
+	}
+	else
+		bw_Application_writeTrace( app, trace_data );
+}
+
+bw_Err bw_Application_writeStartupTrace( const bw_Application* app, bw_CStrSlice path ) {
+	bw_ApplicationStartupMetrics metrics;
+	bw_Application_getStartupMetrics( app, &metrics );
+
+	char* cpath = bw_string_copyAsNewCstr( path );
+	FILE* file = fopen( cpath, "w" );
+	bw_string_freeCstr( cpath );
+	if ( file == 0 )
+		return bw_Err_new_with_msg( 1, "unable to open the startup trace file" );
+
+	// Every phase becomes a slice that starts where the phase before it ended, on a timeline that starts at bw_Application_initialize.
+	// Phases that have been reached out of order, like the first paint of a windowless browser window before the first load, are marked as instants.
+	fprintf( file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+	fprintf( file, "{\"name\":\"initialize\",\"cat\":\"startup\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":1,\"ts\":0}" );
+	uint64_t start = metrics.initialize;
+	for ( size_t i = 0; i < sizeof( bw_Application_startupPhases ) / sizeof( bw_ApplicationStartupPhase ); i++ ) {
+		const bw_ApplicationStartupPhase* phase = &bw_Application_startupPhases[i];
+		uint64_t reached = *(const uint64_t*)( (const char*)&metrics + phase->offset );
+		if ( reached == 0 )
+			continue;
+
+		if ( reached >= start ) {
+			fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%llu,\"dur\":%llu}",
+				phase->name, (unsigned long long)( start - metrics.initialize ), (unsigned long long)( reached - start )
+			);
+			start = reached;
+		}
+		else
+			fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"startup\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":1,\"ts\":%llu}",
+				phase->name, (unsigned long long)( reached - metrics.initialize )
+			);
+	}
+	fprintf( file, "\n]}\n" );
+
+	BOOL failed = ferror( file ) != 0;
+	if ( fclose( file ) != 0 || failed )
+		return bw_Err_new_with_msg( 1, "unable to write the startup trace file" );
+	BW_ERR_RETURN_SUCCESS;
 }
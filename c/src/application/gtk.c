@@ -1,9 +1,12 @@
 #include "../application.h"
 
 #include "impl.h"
+#include "../atomic.h"
+#include "timer_heap.h"
 #include "../common.h"
 
 #include <gtk/gtk.h>
+#include <stdlib.h>
 
 
 
@@ -13,14 +16,45 @@ typedef struct {
 } bw_ApplicationGtkAsyncExitData;
 
 typedef struct {
+	bw_ApplicationDispatchData* dispatch_data;
+	uint64_t delay;
+} bw_ApplicationGtkDelayedData;
+
+// One custom source for all delayed dispatches, so that there is only a single GLib source to wake up for, no matter how many timers there are.
+typedef struct {
+	GSource source;
 	bw_Application* app;
-	bw_ApplicationDispatchData* inner;
-} bw_ApplicationImplDispatchData;
+	bw_TimerHeap timers;	// Deadlines are in microseconds of GLib's monotonic time
+} bw_ApplicationGtkTimerSource;
 
 
 
 gboolean _bw_ApplicationImpl_dispatchHandler( gpointer _dispatch_data );
 gboolean _bw_ApplicationImpl_exitHandler( gpointer data );
+gboolean _bw_ApplicationImpl_idleDispatchHandler( gpointer _app );
+void bw_ApplicationGtk_armTimerSource( bw_ApplicationGtkTimerSource* source );
+void bw_ApplicationGtk_delayedDispatchWrapper( bw_Application* app, void* _data );
+#if GLIB_CHECK_VERSION(2, 64, 0)
+void bw_ApplicationGtk_onLowMemory( GMemoryMonitor* monitor, GMemoryMonitorWarningLevel level, gpointer _app );
+#endif
+#if defined(BW_CEF)
+gboolean bw_ApplicationGtk_engineWorkHandler( gpointer _app );
+gboolean bw_ApplicationGtk_engineWorkScheduler( gpointer _app );
+#endif
+void bw_ApplicationGtk_setTimer( bw_Application* app, bw_ApplicationDispatchData* dispatch_data, uint64_t milliseconds );
+gboolean bw_ApplicationGtkTimerSource_dispatch( GSource* source, GSourceFunc callback, gpointer user_data );
+void bw_ApplicationGtkTimerSource_finalize( GSource* source );
+
+
+
+static GSourceFuncs bw_ApplicationGtkTimerSource_funcs = {
+	NULL,	// The source only becomes ready through its ready time
+	NULL,
+	bw_ApplicationGtkTimerSource_dispatch,
+	bw_ApplicationGtkTimerSource_finalize,
+	NULL,
+	NULL
+};
 
 
 
@@ -45,13 +79,41 @@ void bw_Application_exit( bw_Application* app, int exit_code ) {
 }
 
 void bw_Application_exitAsync( bw_Application* app, int exit_code ) {
-	bw_ApplicationGtkAsyncExitData data;
-	data.app = app;
-	data.exit_code = exit_code;
+	// The data is freed by the handler, as this function may have returned by then
+	bw_ApplicationGtkAsyncExitData* data = (bw_ApplicationGtkAsyncExitData*)malloc( sizeof( bw_ApplicationGtkAsyncExitData ) );
+	data->app = app;
+	data->exit_code = exit_code;
+
+	gdk_threads_add_idle( _bw_ApplicationImpl_exitHandler, (gpointer)data );
+}
+
+// Makes the source ready at the earliest deadline, or never if there are no timers left.
+void bw_ApplicationGtk_armTimerSource( bw_ApplicationGtkTimerSource* source ) {
+	uint64_t deadline;
+
+	if ( bw_TimerHeap_peek( &source->timers, &deadline ) )
+		g_source_set_ready_time( &source->source, deadline <= G_MAXINT64 ? (gint64)deadline : G_MAXINT64 );
+	else
+		g_source_set_ready_time( &source->source, -1 );
+}
+
+void bw_ApplicationGtk_delayedDispatchWrapper( bw_Application* app, void* _data ) {
+	bw_ApplicationGtkDelayedData* data = (bw_ApplicationGtkDelayedData*)_data;
+
+	bw_ApplicationGtk_setTimer( app, data->dispatch_data, data->delay );
 
-	gdk_threads_add_idle( _bw_ApplicationImpl_exitHandler, (gpointer)&data );
+	free( data );
 }
 
+#if GLIB_CHECK_VERSION(2, 64, 0)
+void bw_ApplicationGtk_onLowMemory( GMemoryMonitor* monitor, GMemoryMonitorWarningLevel level, gpointer _app ) {
+	UNUSED( monitor );
+
+	// The low and medium levels are both a warning, only at the critical level the system is about to kill processes
+	bw_Application_trimMemory( (bw_Application*)_app, level >= G_MEMORY_MONITOR_WARNING_LEVEL_CRITICAL ? BW_APPLICATION_MEMORY_PRESSURE_CRITICAL : BW_APPLICATION_MEMORY_PRESSURE_MODERATE );
+}
+#endif
+
 void bw_ApplicationGtk_onActivate( GtkApplication* gtk_handle, gpointer data ) {
 	UNUSED( gtk_handle );
 
@@ -75,17 +137,25 @@ int bw_ApplicationImpl_run( bw_Application* app, bw_ApplicationImpl_ReadyHandler
 	return app->impl.exit_code;
 }
 
-BOOL bw_ApplicationImpl_dispatch( bw_Application* app, bw_ApplicationDispatchData* _data ) {
+BOOL bw_ApplicationImpl_wakeUp( bw_Application* app, bw_ApplicationDispatchPriority priority ) {
 	BOOL is_running = true;
 	
 	pthread_mutex_lock( &app->impl.is_running_mtx );
 
-	bw_ApplicationImplDispatchData* data = (bw_ApplicationImplDispatchData*)malloc( sizeof( bw_ApplicationImplDispatchData ) );
-	data->app = app;
-	data->inner = _data;
-
-	if ( app->impl.is_running )
-		gdk_threads_add_idle( _bw_ApplicationImpl_dispatchHandler, (gpointer)data );
+	// One idle source drains all queued dispatches.
+	// High priority work goes before any other events, and idle work only when nothing else is pending.
+	if ( app->impl.is_running ) {
+		switch ( priority ) {
+		case BW_APPLICATION_DISPATCH_PRIORITY_HIGH:
+			gdk_threads_add_idle_full( G_PRIORITY_HIGH, _bw_ApplicationImpl_dispatchHandler, (gpointer)app, NULL );
+			break;
+		case BW_APPLICATION_DISPATCH_PRIORITY_IDLE:
+			gdk_threads_add_idle_full( G_PRIORITY_LOW, _bw_ApplicationImpl_idleDispatchHandler, (gpointer)app, NULL );
+			break;
+		default:
+			gdk_threads_add_idle( _bw_ApplicationImpl_dispatchHandler, (gpointer)app );
+		}
+	}
 	else
 		is_running = false;
 
@@ -94,12 +164,48 @@ BOOL bw_ApplicationImpl_dispatch( bw_Application* app, bw_ApplicationDispatchDat
 	return is_running;
 }
 
-void bw_ApplicationImpl_dispatchHandler( bw_Application* app, bw_ApplicationDispatchData* data ) {
-	data->func( app, data->data );
+#if defined(BW_CEF)
+void bw_ApplicationImpl_scheduleEngineWork( bw_Application* app, int64_t delay_ms ) {
+	bw_atomic_storeU64( &app->impl.engine_work_delay, (uint64_t)delay_ms );
+
+	// Schedules that come in before the scheduler has run only update the delay it picks up.
+	// This may be called before the main loop runs, in which case the source is picked up once it starts.
+	if ( bw_atomic_exchangeInt( &app->impl.engine_work_pending, 1 ) == 0 )
+		gdk_threads_add_idle_full( G_PRIORITY_HIGH, bw_ApplicationGtk_engineWorkScheduler, (gpointer)app, NULL );
+}
+#endif
+
+BOOL bw_ApplicationImpl_dispatchDelayed( bw_Application* app, bw_ApplicationDispatchData* dispatch_data, uint64_t milliseconds ) {
+	BOOL is_running;
+
+	pthread_mutex_lock( &app->impl.is_running_mtx );
+	is_running = app->impl.is_running;
+	pthread_mutex_unlock( &app->impl.is_running_mtx );
+
+	if ( !is_running ) {
+		free( dispatch_data );
+		return false;
+	}
+
+	// The timer heap is only accessed from the GUI thread
+	if ( pthread_equal( app->impl.thread_id, pthread_self() ) )
+		bw_ApplicationGtk_setTimer( app, dispatch_data, milliseconds );
+	else {
+		bw_ApplicationGtkDelayedData* delayed_data = (bw_ApplicationGtkDelayedData*)malloc( sizeof( bw_ApplicationGtkDelayedData ) );
+		delayed_data->dispatch_data = dispatch_data;
+		delayed_data->delay = milliseconds;
+
+		if ( !bw_Application_dispatch( app, bw_ApplicationGtk_delayedDispatchWrapper, (void*)delayed_data ) ) {
+			free( delayed_data );
+			free( dispatch_data );
+			return false;
+		}
+	}
+
+	return true;
 }
 
 bw_ApplicationImpl bw_ApplicationImpl_initialize( bw_Application* _app, int argc, char** argv, const bw_ApplicationSettings* settings ) {
-	UNUSED( _app );
 	UNUSED( settings );
 
 	bw_ApplicationImpl app;
@@ -109,38 +215,151 @@ bw_ApplicationImpl bw_ApplicationImpl_initialize( bw_Application* _app, int argc
 	app.argv = argv;
 	app.is_running = false;
 	app.thread_id = pthread_self();
+	app.engine_work_source = 0;
+	app.engine_work_delay = 0;
+	app.engine_work_pending = 0;
 
 	// Initialize mutex
 	int result = pthread_mutex_init( &app.is_running_mtx, NULL );
 	BW_POSIX_ASSERT_SUCCESS( result );
 
+	// The source is attached right away, but it won't be dispatched before the main loop runs
+	bw_ApplicationGtkTimerSource* timer_source = (bw_ApplicationGtkTimerSource*)g_source_new( &bw_ApplicationGtkTimerSource_funcs, sizeof( bw_ApplicationGtkTimerSource ) );
+	timer_source->app = _app;
+	bw_TimerHeap_init( &timer_source->timers );
+	g_source_set_ready_time( &timer_source->source, -1 );
+	g_source_attach( &timer_source->source, NULL );
+	app.timer_source = &timer_source->source;
+
+	// The signal is emitted on the main context of the thread that obtained the monitor, which is the GUI thread
+	app.memory_monitor = 0;
+#if GLIB_CHECK_VERSION(2, 64, 0)
+	GMemoryMonitor* memory_monitor = g_memory_monitor_dup_default();
+	if ( memory_monitor != 0 ) {
+		g_signal_connect( memory_monitor, "low-memory-warning", G_CALLBACK( bw_ApplicationGtk_onLowMemory ), _app );
+		app.memory_monitor = G_OBJECT( memory_monitor );
+	}
+#endif
+
 	return app;
 }
 
 // There is no 'free' function for GtkApplication*
 void bw_ApplicationImpl_finish( bw_ApplicationImpl* app ) {
 
+	if ( app->engine_work_source != 0 )
+		g_source_remove( app->engine_work_source );
+
+	// Destroying the source finalizes it, which frees the timers that are left
+	g_source_destroy( app->timer_source );
+	g_source_unref( app->timer_source );
+
+#if GLIB_CHECK_VERSION(2, 64, 0)
+	// The monitor is shared, so it may outlive the application
+	if ( app->memory_monitor != 0 ) {
+		g_signal_handlers_disconnect_matched( app->memory_monitor, G_SIGNAL_MATCH_FUNC, 0, 0, 0, (gpointer)bw_ApplicationGtk_onLowMemory, 0 );
+		g_object_unref( app->memory_monitor );
+	}
+#endif
+
 	pthread_mutex_destroy( &app->is_running_mtx );
 	g_object_unref( app->handle );
 }
 
 
 
-gboolean _bw_ApplicationImpl_dispatchHandler( gpointer _dispatch_data ) {
-	bw_ApplicationImplDispatchData* dispatch_data = (bw_ApplicationImplDispatchData*)(_dispatch_data);
-
-	dispatch_data->inner->func( dispatch_data->app, dispatch_data->inner->data );
+gboolean _bw_ApplicationImpl_dispatchHandler( gpointer _app ) {
+	bw_Application* app = (bw_Application*)_app;
 
-	free( dispatch_data->inner );
-	free( dispatch_data );
+	// Leftover work continues in a new source with the default idle priority, so that redraws go first, even if this source had a high priority
+	if ( bw_Application_runDispatches( app ) )
+		gdk_threads_add_idle( _bw_ApplicationImpl_dispatchHandler, (gpointer)app );
 
 	return FALSE;
 }
 
+// Keeps the source around for as long as there is idle work left
+gboolean _bw_ApplicationImpl_idleDispatchHandler( gpointer _app ) {
+	bw_Application* app = (bw_Application*)_app;
+
+	return bw_Application_runIdleDispatches( app ) ? G_SOURCE_CONTINUE : G_SOURCE_REMOVE;
+}
+
 gboolean _bw_ApplicationImpl_exitHandler( gpointer _data ) {
 	bw_ApplicationGtkAsyncExitData* data = (bw_ApplicationGtkAsyncExitData*)_data;
 
 	bw_Application_exit( data->app, data->exit_code );
+	free( data );
+
+	return FALSE;
+}
+
+#if defined(BW_CEF)
+// Runs on the GUI thread, because the GLib source ID is only used from there
+gboolean bw_ApplicationGtk_engineWorkScheduler( gpointer _app ) {
+	bw_Application* app = (bw_Application*)_app;
+
+	// Reset the flag before reading the delay, so that a schedule that comes in after that adds a new scheduler
+	bw_atomic_storeInt( &app->impl.engine_work_pending, 0 );
+	int64_t delay_ms = (int64_t)bw_atomic_loadU64( &app->impl.engine_work_delay );
+
+	// Only the latest schedule counts
+	if ( app->impl.engine_work_source != 0 ) {
+		g_source_remove( app->impl.engine_work_source );
+		app->impl.engine_work_source = 0;
+	}
+
+	if ( delay_ms <= 0 )
+		bw_ApplicationEngineImpl_doMessageLoopWork( app );
+	else {
+		guint delay = delay_ms < G_MAXUINT ? (guint)delay_ms : G_MAXUINT;
+		app->impl.engine_work_source = gdk_threads_add_timeout( delay, bw_ApplicationGtk_engineWorkHandler, (gpointer)app );
+	}
 
 	return FALSE;
 }
+
+gboolean bw_ApplicationGtk_engineWorkHandler( gpointer _app ) {
+	bw_Application* app = (bw_Application*)_app;
+
+	app->impl.engine_work_source = 0;
+	bw_ApplicationEngineImpl_doMessageLoopWork( app );
+
+	return FALSE;
+}
+#endif
+
+void bw_ApplicationGtk_setTimer( bw_Application* app, bw_ApplicationDispatchData* dispatch_data, uint64_t milliseconds ) {
+	bw_ApplicationGtkTimerSource* source = (bw_ApplicationGtkTimerSource*)app->impl.timer_source;
+
+	uint64_t now = (uint64_t)g_get_monotonic_time();
+	uint64_t delay = milliseconds < UINT64_MAX / 1000 ? milliseconds * 1000 : UINT64_MAX;
+	uint64_t deadline = delay < UINT64_MAX - now ? now + delay : UINT64_MAX;
+
+	// The ready time only changes when the new timer is the first one to go off
+	if ( bw_TimerHeap_push( &source->timers, deadline, dispatch_data ) )
+		bw_ApplicationGtk_armTimerSource( source );
+}
+
+gboolean bw_ApplicationGtkTimerSource_dispatch( GSource* _source, GSourceFunc callback, gpointer user_data ) {
+	UNUSED( callback );
+	UNUSED( user_data );
+	bw_ApplicationGtkTimerSource* source = (bw_ApplicationGtkTimerSource*)_source;
+
+	// All timers that have expired by now are run in one go
+	uint64_t now = (uint64_t)g_get_monotonic_time();
+	bw_ApplicationDispatchData* dispatch_data;
+	while ( (dispatch_data = bw_TimerHeap_popExpired( &source->timers, now )) != 0 ) {
+		dispatch_data->func( source->app, dispatch_data->data );
+		free( dispatch_data );
+	}
+
+	bw_ApplicationGtk_armTimerSource( source );
+	return G_SOURCE_CONTINUE;
+}
+
+void bw_ApplicationGtkTimerSource_finalize( GSource* _source ) {
+	bw_ApplicationGtkTimerSource* source = (bw_ApplicationGtkTimerSource*)_source;
+
+	bw_TimerHeap_free( &source->timers );
+}
@@ -15,6 +15,11 @@ typedef struct {
 	bool is_running;
 	pthread_mutex_t is_running_mtx;
 	pthread_t thread_id;
+	GSource* timer_source;	// Executes all delayed dispatches
+	guint engine_work_source;	// The timeout that calls into the browser engine, or 0
+	uint64_t engine_work_delay;	// The delay of the latest schedule of the browser engine, in milliseconds
+	int engine_work_pending;	// Whether the scheduler source has been added but hasn't run yet
+	GObject* memory_monitor;	// Signals when the system is low on memory, or null when GLib is too old to have one
 } bw_ApplicationImpl;
 
 
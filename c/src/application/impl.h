@@ -17,13 +17,53 @@ typedef struct {
 
 
 
-BOOL bw_ApplicationImpl_dispatch( bw_Application* app, bw_ApplicationDispatchData* data );
+// Executes functions that are queued up with a high or normal priority, the high priority ones first, until the dispatch budget has been used up.
+// Returns whether there is work left, in which case the implementation should call this again in the next turn of its event loop, after other events had a chance.
+// Should be called on the GUI thread by the implementation after it has been woken up by bw_ApplicationImpl_wakeUp.
+BOOL bw_Application_runDispatches( bw_Application* app );
+
+// Executes functions that are queued up with the idle priority, until the dispatch budget has been used up.
+// Returns whether there is idle work left, in which case the implementation should call this again the next time it is idle.
+// Should be called on the GUI thread when there are no other events to process.
+BOOL bw_Application_runIdleDispatches( bw_Application* app );
+
+// The time of a monotonic clock in microseconds, which is the same clock that Chromium uses for its trace events on Linux and Windows.
+uint64_t bw_Application_now();
+
+// Should make the GUI thread call bw_Application_runDispatches, or bw_Application_runIdleDispatches for the idle priority.
+// Returns FALSE if the application is not running anymore.
+BOOL bw_ApplicationImpl_wakeUp( bw_Application* app, bw_ApplicationDispatchPriority priority );
+// Makes the GUI thread call bw_ApplicationEngineImpl_doMessageLoopWork after the given delay, replacing any work that was scheduled before.
+// Only implemented by platforms on which the browser engine doesn't run its own message loop.
+// This function is thread safe.
+void bw_ApplicationImpl_scheduleEngineWork( bw_Application* app, int64_t delay_ms );
 BOOL bw_ApplicationImpl_dispatchDelayed( bw_Application* app, bw_ApplicationDispatchData* data, uint64_t milliseconds );
 void bw_ApplicationImpl_finish( bw_ApplicationImpl* );
 int bw_ApplicationImpl_run( bw_Application* app, bw_ApplicationImpl_ReadyHandlerData* ready_handler_data );
 bw_ApplicationImpl bw_ApplicationImpl_initialize( bw_Application* app, int argc, char** argv, const bw_ApplicationSettings* settings );
 
+// Does the work that the browser engine has scheduled with bw_ApplicationImpl_scheduleEngineWork.
+// Should be called on the GUI thread.
+void bw_ApplicationEngineImpl_doMessageLoopWork( bw_Application* app );
 void bw_ApplicationEngineImpl_finish( bw_ApplicationEngineImpl* );
+// Does the part of the initialization of the browser engine that has been postponed, if there is any.
+// Should be called on the GUI thread.
+void bw_ApplicationEngineImpl_start( bw_Application* app );
+// Starts the browser engine like bw_ApplicationEngineImpl_start, for functions that use the engine but aren't given the application.
+// Should be called on the GUI thread.
+void bw_ApplicationEngineImpl_startPending();
+// Shuts the browser engine down like `bw_Application_finishFast` describes, within `timeout` milliseconds.
+void bw_ApplicationEngineImpl_finishFast( bw_ApplicationEngineImpl*, unsigned int timeout );
+// Adds the memory used by the browser engine and its browser windows to `stats`.
+void bw_ApplicationEngineImpl_getMemoryStats( const bw_Application* app, bw_ApplicationMemoryStats* stats );
+// Trims the memory of every browser window with bw_BrowserWindow_trimMemory, and releases what the browser engine can do without.
+void bw_ApplicationEngineImpl_trimMemory( bw_Application* app, bw_ApplicationMemoryPressure level );
+// Starts recording a trace of the given categories in the browser engine.
+// Returns whether tracing could be started.
+BOOL bw_ApplicationEngineImpl_startTracing( bw_Application* app, bw_CStrSlice categories );
+// Stops the trace of the browser engine and writes it to a file at `path`.
+// Then makes the GUI thread call `on_written` with `data`, whether the trace could be written or not.
+void bw_ApplicationEngineImpl_stopTracing( bw_Application* app, bw_CStrSlice path, bw_ApplicationDispatchFn on_written, void* data );
 bw_Err bw_ApplicationEngineImpl_initialize( bw_ApplicationEngineImpl* impl, bw_Application* app, int argc, char** argv, const bw_ApplicationSettings* settings );
 
 
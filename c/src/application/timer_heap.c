@@ -0,0 +1,108 @@
+#include "timer_heap.h"
+#include "../application.h"
+
+#include <stdlib.h>
+
+
+
+BOOL bw_TimerHeap_isBefore( const bw_TimerHeapEntry* a, const bw_TimerHeapEntry* b );
+void bw_TimerHeap_swap( bw_TimerHeap* heap, size_t a, size_t b );
+
+
+
+void bw_TimerHeap_free( bw_TimerHeap* heap ) {
+	for ( size_t i = 0; i < heap->count; i++ ) {
+		free( heap->entries[i].dispatch_data );
+	}
+
+	free( heap->entries );
+	heap->entries = 0;
+	heap->count = 0;
+	heap->capacity = 0;
+}
+
+void bw_TimerHeap_init( bw_TimerHeap* heap ) {
+	heap->entries = 0;
+	heap->count = 0;
+	heap->capacity = 0;
+	heap->next_sequence = 0;
+}
+
+BOOL bw_TimerHeap_isBefore( const bw_TimerHeapEntry* a, const bw_TimerHeapEntry* b ) {
+	if ( a->deadline != b->deadline )
+		return a->deadline < b->deadline;
+	return a->sequence < b->sequence;
+}
+
+BOOL bw_TimerHeap_peek( const bw_TimerHeap* heap, uint64_t* deadline ) {
+	if ( heap->count == 0 )
+		return FALSE;
+
+	*deadline = heap->entries[0].deadline;
+	return TRUE;
+}
+
+bw_ApplicationDispatchData* bw_TimerHeap_popExpired( bw_TimerHeap* heap, uint64_t now ) {
+
+	if ( heap->count == 0 || heap->entries[0].deadline > now )
+		return 0;
+
+	bw_ApplicationDispatchData* dispatch_data = heap->entries[0].dispatch_data;
+
+	// Move the last entry to the root, and let it sift down
+	heap->count -= 1;
+	heap->entries[0] = heap->entries[ heap->count ];
+
+	size_t i = 0;
+	while ( TRUE ) {
+		size_t left = i * 2 + 1;
+		size_t right = left + 1;
+		size_t smallest = i;
+
+		if ( left < heap->count && bw_TimerHeap_isBefore( &heap->entries[left], &heap->entries[smallest] ) )
+			smallest = left;
+		if ( right < heap->count && bw_TimerHeap_isBefore( &heap->entries[right], &heap->entries[smallest] ) )
+			smallest = right;
+
+		if ( smallest == i )
+			break;
+
+		bw_TimerHeap_swap( heap, i, smallest );
+		i = smallest;
+	}
+
+	return dispatch_data;
+}
+
+BOOL bw_TimerHeap_push( bw_TimerHeap* heap, uint64_t deadline, bw_ApplicationDispatchData* dispatch_data ) {
+
+	if ( heap->count == heap->capacity ) {
+		heap->capacity = heap->capacity != 0 ? heap->capacity * 2 : 16;
+		heap->entries = (bw_TimerHeapEntry*)realloc( heap->entries, heap->capacity * sizeof( bw_TimerHeapEntry ) );
+	}
+
+	size_t i = heap->count;
+	heap->count += 1;
+	heap->entries[i].deadline = deadline;
+	heap->entries[i].sequence = heap->next_sequence++;
+	heap->entries[i].dispatch_data = dispatch_data;
+
+	// Let the new entry sift up
+	while ( i > 0 ) {
+		size_t parent = ( i - 1 ) / 2;
+
+		if ( !bw_TimerHeap_isBefore( &heap->entries[i], &heap->entries[parent] ) )
+			break;
+
+		bw_TimerHeap_swap( heap, i, parent );
+		i = parent;
+	}
+
+	return i == 0;
+}
+
+void bw_TimerHeap_swap( bw_TimerHeap* heap, size_t a, size_t b ) {
+	bw_TimerHeapEntry temp = heap->entries[a];
+	heap->entries[a] = heap->entries[b];
+	heap->entries[b] = temp;
+}
@@ -0,0 +1,56 @@
+#ifndef BW_APPLICATION_TIMER_HEAP_H
+#define BW_APPLICATION_TIMER_HEAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../bool.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+struct bw_ApplicationDispatchData;
+
+typedef struct {
+	uint64_t deadline;
+	uint64_t sequence;	// Keeps timers with the same deadline in the order they were added
+	struct bw_ApplicationDispatchData* dispatch_data;
+} bw_TimerHeapEntry;
+
+/// A binary min-heap of delayed dispatches, ordered by their deadline.
+/// The unit of the deadlines is up to the implementation that uses it.
+typedef struct {
+	bw_TimerHeapEntry* entries;
+	size_t count;
+	size_t capacity;
+	uint64_t next_sequence;
+} bw_TimerHeap;
+
+
+
+/// Frees the heap, including the dispatch data of the timers that haven't expired yet.
+void bw_TimerHeap_free( bw_TimerHeap* heap );
+
+void bw_TimerHeap_init( bw_TimerHeap* heap );
+
+/// Returns whether the heap contains any timers, and if so, stores the earliest deadline in `deadline`.
+BOOL bw_TimerHeap_peek( const bw_TimerHeap* heap, uint64_t* deadline );
+
+/// Removes and returns the timer with the earliest deadline if it is at or before `now`.
+/// Returns null otherwise.
+struct bw_ApplicationDispatchData* bw_TimerHeap_popExpired( bw_TimerHeap* heap, uint64_t now );
+
+/// Adds a timer.
+/// Returns whether its deadline became the earliest one.
+BOOL bw_TimerHeap_push( bw_TimerHeap* heap, uint64_t deadline, struct bw_ApplicationDispatchData* dispatch_data );
+
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif//BW_APPLICATION_TIMER_HEAP_H
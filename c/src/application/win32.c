@@ -20,22 +20,19 @@
 
 
 
-typedef struct {
-	void* next;
-	UINT_PTR timer_id;
-	bw_Application* app;
-	bw_ApplicationDispatchData* dispatch_data;
-} bw_ApplicationTimerMapEntry;
-
-
+// The notification stays signaled while memory is low, so it is only waited on again after this many milliseconds
+#define BW_APPLICATION_WIN32_LOW_MEMORY_INTERVAL 10000
 
-void bw_ApplicationWin32_dispatchWrapper(bw_Application* app, void* _data);
-void bw_ApplicationWin32_setTimer(bw_Application* app, bw_ApplicationDispatchData* dispatch_data, uint64_t delay);
-void bw_ApplicationWin32_timerHandler(HWND _hwnd, UINT _, UINT_PTR nIDEvent, DWORD _2);
 
 
+void bw_ApplicationWin32_armTimer( bw_Application* app );
+void bw_ApplicationWin32_dispatchWrapper( bw_Application* app, void* _data );
+VOID CALLBACK bw_ApplicationWin32_onLowMemory( PVOID _app, BOOLEAN timed_out );
+void bw_ApplicationWin32_runTimers( bw_Application* app );
+void bw_ApplicationWin32_setTimer( bw_Application* app, bw_ApplicationDispatchData* dispatch_data, uint64_t delay );
+void bw_ApplicationWin32_trimMemory( bw_Application* app, void* data );
+void bw_ApplicationWin32_watchMemory( bw_Application* app, void* data );
 
-PSLIST_HEADER timer_map = NULL;
 
 
 void bw_Application_assertCorrectThread( const bw_Application* app ) {
@@ -47,7 +44,7 @@ void bw_Application_assertCorrectThread( const bw_Application* app ) {
 #endif
 }
 
-BOOL bw_ApplicationImpl_dispatch( bw_Application* app, bw_ApplicationDispatchData* dispatch_data ) {
+BOOL bw_ApplicationImpl_wakeUp( bw_Application* app, bw_ApplicationDispatchPriority priority ) {
 	
 	// Check if the runtime is still running
 	AcquireSRWLockShared( &app->impl.is_running_mtx );
@@ -56,140 +53,133 @@ BOOL bw_ApplicationImpl_dispatch( bw_Application* app, bw_ApplicationDispatchDat
 	if ( result == false )
 		return false;
 
-	PostThreadMessageW( app->impl.thread_id, WM_APP, (WPARAM)NULL, (LPARAM)dispatch_data );
+	// The message only carries the priority, all dispatches are taken from the dispatch queues
+	PostThreadMessageW( app->impl.thread_id, WM_APP, (WPARAM)priority, (LPARAM)NULL );
 
 	return true;
 }
 
 BOOL bw_ApplicationImpl_dispatchDelayed(bw_Application* app, bw_ApplicationDispatchData* dispatch_data,  uint64_t milliseconds) {
-	BW_ASSERT(milliseconds < (1ul << (8*sizeof(UINT)-1)), "too many milliseconds");
-	// TODO: Support up to 2^62-1 milliseconds using the timer multiple times.
 
 	// Check if the runtime is still running
 	AcquireSRWLockShared( &app->impl.is_running_mtx );
 	bool result = app->is_running;
 	ReleaseSRWLockShared( &app->impl.is_running_mtx );
-	if ( result == false )
+	if ( result == false ) {
+		free( dispatch_data );
 		return false;
+	}
 
-	// If we are on the right thread, just call `SendMessageTimeout`.
-	if (app->impl.thread_id == GetCurrentThreadId()) {;
+	// If we are on the right thread, the timer can be added right away.
+	if (app->impl.thread_id == GetCurrentThreadId()) {
 		bw_ApplicationWin32_setTimer(app, dispatch_data, milliseconds);
 	}
-	// Otherwise, post to the GUI thread first
+	// Otherwise, post to the GUI thread first, because the timer heap is only accessed from there.
 	else {
 		bw_ApplicationDispatchDelayedData* delayed_data = (bw_ApplicationDispatchDelayedData*)malloc(sizeof(bw_ApplicationDispatchDelayedData));
 		delayed_data->dispatch_data = dispatch_data;
-		delayed_data->delay = (UINT)milliseconds;
+		delayed_data->delay = milliseconds;
 		delayed_data->app = app;
 
-		bw_ApplicationDispatchData* wrapper_data = (bw_ApplicationDispatchData*)malloc(sizeof(bw_ApplicationDispatchData));
-		wrapper_data->func = bw_ApplicationWin32_dispatchWrapper;
-		wrapper_data->data = (void*)delayed_data;
+		if ( !bw_Application_dispatch(app, bw_ApplicationWin32_dispatchWrapper, (void*)delayed_data) ) {
+			free( delayed_data );
+			free( dispatch_data );
+			return false;
+		}
+	}
 
-		bw_ApplicationImpl_dispatch(app, wrapper_data);
-	};
+	return true;
 }
 
-void bw_ApplicationWin32_addToTimerMap(bw_Application* app, UINT_PTR timer_id, bw_ApplicationDispatchData* dispatch_data) {
-
-	// Create new timer map entry
-	bw_ApplicationTimerMapEntry* new_entry = (bw_ApplicationTimerMapEntry*)malloc(sizeof(bw_ApplicationTimerMapEntry));
-	new_entry->next = 0;
-	new_entry->timer_id = timer_id;
-	new_entry->app = app;
-	new_entry->dispatch_data = dispatch_data;
+// (Re)sets the one timer to go off at the earliest deadline, or removes it if there are no timers left.
+void bw_ApplicationWin32_armTimer( bw_Application* app ) {
+	uint64_t deadline;
 
-	if (timer_map != 0) {
-		bw_ApplicationTimerMapEntry* entry = timer_map;
-
-		// Skip all but last entry
-		while (entry->next != 0) {
-			entry = entry->next;
+	if ( !bw_TimerHeap_peek( &app->impl.timers, &deadline ) ) {
+		if ( app->impl.timer_id != 0 ) {
+			KillTimer( NULL, app->impl.timer_id );
+			app->impl.timer_id = 0;
 		}
-
-		entry->next = new_entry;
+		return;
 	}
-	else {
-		timer_map = new_entry;
+
+	// SetTimer can't wait longer than USER_TIMER_MAXIMUM.
+	// If the deadline is further away than that, the timer just goes off early and gets armed again.
+	uint64_t now = GetTickCount64();
+	uint64_t delay = deadline > now ? deadline - now : 0;
+	if ( delay > USER_TIMER_MAXIMUM )
+		delay = USER_TIMER_MAXIMUM;
+
+	// Passing the ID of the existing timer replaces it.
+	// Without a window or a timer function, WM_TIMER is posted to the thread's message queue.
+	app->impl.timer_id = SetTimer( NULL, app->impl.timer_id, (UINT)delay, NULL );
+	if ( app->impl.timer_id == 0 ) {
+		BW_WIN32_PANIC_LAST_ERROR;
 	}
 }
 
 void bw_ApplicationWin32_dispatchWrapper(bw_Application* app, void* _data) {
 	bw_ApplicationDispatchDelayedData* data = (bw_ApplicationDispatchDelayedData*)_data;
 	
-	bw_ApplicationWin32_setTimer(app, data->dispatch_data, data->delay);
+	bw_ApplicationWin32_setTimer(app, (bw_ApplicationDispatchData*)data->dispatch_data, data->delay);
 
 	free(data);
 }
 
-bw_ApplicationTimerMapEntry* bw_ApplicationWin32_findInTimerMap(UINT_PTR timer_id) {
-	if (timer_map == 0)
-		return 0;
+// Invoked on a thread of the thread pool
+VOID CALLBACK bw_ApplicationWin32_onLowMemory( PVOID _app, BOOLEAN timed_out ) {
+	UNUSED( timed_out );
 
-	bw_ApplicationTimerMapEntry* entry = timer_map;
-	while (entry->timer_id != timer_id) {
-		if (entry->next == 0)
-			return 0;
-	}
-
-	return entry;
+	bw_Application_dispatch( (bw_Application*)_app, bw_ApplicationWin32_trimMemory, NULL );
 }
 
-void bw_ApplicationWin32_freeTimerMap() {
-	bw_ApplicationTimerMapEntry* entry = timer_map;
-
-	while (entry != 0) {
-		bw_ApplicationTimerMapEntry* next = entry->next;
+// Executes all timers of which the deadline has passed.
+void bw_ApplicationWin32_runTimers( bw_Application* app ) {
+	uint64_t now = GetTickCount64();
 
-		KillTimer(NULL, entry->timer_id);
-		free(entry);
-
-		entry = next;
+	bw_ApplicationDispatchData* dispatch_data;
+	while ( (dispatch_data = bw_TimerHeap_popExpired( &app->impl.timers, now )) != 0 ) {
+		dispatch_data->func( app, dispatch_data->data );
+		free( dispatch_data );
 	}
+
+	bw_ApplicationWin32_armTimer( app );
 }
 
-bool bw_ApplicationWin32_removeFromTimerMap(bw_ApplicationTimerMapEntry* entry) {
-	
-	if (timer_map == entry) {
-		timer_map = entry->next;
-		free(entry);
-		return true;
-	}
+void bw_ApplicationWin32_setTimer(bw_Application* app, bw_ApplicationDispatchData* dispatch_data, uint64_t delay) {
+	uint64_t now = GetTickCount64();
+	uint64_t deadline = delay < UINT64_MAX - now ? now + delay : UINT64_MAX;
 
-	bw_ApplicationTimerMapEntry* prev = timer_map;
-	bw_ApplicationTimerMapEntry* i = prev->next;
-	while (i != 0) {
-		if (i == entry) {
-			prev = i->next;
-			free(i);
-			return true;
-		}
+	// Only when the new timer is the first one to go off, the OS timer needs to change.
+	if ( bw_TimerHeap_push( &app->impl.timers, deadline, dispatch_data ) )
+		bw_ApplicationWin32_armTimer( app );
+}
 
-		i = i->next;
-	}
 
-	return false;
-}
 
-void bw_ApplicationWin32_setTimer(bw_Application* app, bw_ApplicationDispatchData* dispatch_data, uint64_t delay) {
-	UINT_PTR timer_id = SetTimer(0, 0, delay, bw_ApplicationWin32_timerHandler);
+// Windows only knows of one level of low memory, which is already quite low
+void bw_ApplicationWin32_trimMemory( bw_Application* app, void* data ) {
+	UNUSED( data );
 
-	bw_ApplicationWin32_addToTimerMap(app, timer_id, dispatch_data);
-}
+	// The wait has been registered to be executed once, but still needs to be unregistered
+	if ( app->impl.low_memory_wait != NULL ) {
+		UnregisterWait( app->impl.low_memory_wait );
+		app->impl.low_memory_wait = NULL;
+	}
 
-void bw_ApplicationWin32_timerHandler(HWND hwnd, UINT _, UINT_PTR timer_id, DWORD _2) {
-	KillTimer(hwnd, timer_id);
+	bw_Application_trimMemory( app, BW_APPLICATION_MEMORY_PRESSURE_CRITICAL );
 
-	bw_ApplicationTimerMapEntry* entry = bw_ApplicationWin32_findInTimerMap(timer_id);
+	bw_Application_dispatchDelayed( app, bw_ApplicationWin32_watchMemory, NULL, BW_APPLICATION_WIN32_LOW_MEMORY_INTERVAL );
+}
 
-	bw_ApplicationDispatchData* dispatch_data = (bw_ApplicationDispatchData*)entry->dispatch_data;
+void bw_ApplicationWin32_watchMemory( bw_Application* app, void* data ) {
+	UNUSED( data );
 
-	dispatch_data->func(entry->app, dispatch_data->data);
-	
-	free(dispatch_data);
-	bw_ApplicationWin32_removeFromTimerMap(entry);
+	if ( app->impl.low_memory_notification == NULL || app->impl.low_memory_wait != NULL )
+		return;
 
+	if ( !RegisterWaitForSingleObject( &app->impl.low_memory_wait, app->impl.low_memory_notification, bw_ApplicationWin32_onLowMemory, app, INFINITE, WT_EXECUTEONLYONCE ) )
+		app->impl.low_memory_wait = NULL;
 }
 
 
@@ -200,13 +190,27 @@ int bw_ApplicationImpl_run( bw_Application* app, bw_ApplicationImpl_ReadyHandler
 	BOOL res;
 	int exit_code = 0;
 
+	bw_ApplicationWin32_watchMemory( app, NULL );
 	(ready_handler_data->func)( app, ready_handler_data->data );
 
 	bool exiting = false;
+	BOOL dispatch_pending = FALSE;
+	BOOL idle_pending = FALSE;
 	while ( true ) {
 
 		// When not exitting, just wait on messages normally.
 		if ( !exiting ) {
+
+			// Dispatches that didn't fit in the budget of the previous turn, and idle work, only continue when there are no messages waiting.
+			// That way input and paint messages get handled in between.
+			if ( ( dispatch_pending || idle_pending ) && !PeekMessageW( &msg, 0, 0, 0, PM_NOREMOVE ) ) {
+				if ( dispatch_pending )
+					dispatch_pending = bw_Application_runDispatches( app );
+				else
+					idle_pending = bw_Application_runIdleDispatches( app );
+				continue;
+			}
+
 			res = GetMessageW( &msg, 0, 0, 0 );
 
 			// When WM_QUIT is received, turn on exiting mode
@@ -231,15 +235,25 @@ int bw_ApplicationImpl_run( bw_Application* app, bw_ApplicationImpl_ReadyHandler
 			TranslateMessage( &msg );
 			DispatchMessageW( &msg );
 
-			// Execute the dispatch functions when given
+			// Execute all queued dispatch functions when woken up, except for idle work, which waits until the message queue is empty
 			if ( msg.message == WM_APP ) {
-				bw_ApplicationDispatchData* params = (bw_ApplicationDispatchData*)msg.lParam;
-				(params->func)( app, params->data );
-				free( params );
+				if ( msg.wParam == BW_APPLICATION_DISPATCH_PRIORITY_IDLE )
+					idle_pending = TRUE;
+				else
+					dispatch_pending = bw_Application_runDispatches( app );
 			}
+			// The timer of the delayed dispatches is posted to the thread, not to a window
+			else if ( msg.message == WM_TIMER && msg.hwnd == NULL && msg.wParam == app->impl.timer_id )
+				bw_ApplicationWin32_runTimers( app );
 		}
 	}
 
+	// Waits until a callback that is still running has returned, because it uses the application
+	if ( app->impl.low_memory_wait != NULL ) {
+		UnregisterWaitEx( app->impl.low_memory_wait, INVALID_HANDLE_VALUE );
+		app->impl.low_memory_wait = NULL;
+	}
+
 	// TODO: Wakeup all waiting delegation futures, so that they can return an error indiating that the runtime has exitted.
 	return exit_code;
 }
@@ -255,6 +269,10 @@ bw_ApplicationImpl bw_ApplicationImpl_initialize( bw_Application* _app, int argc
 	InitializeSRWLock( &app.is_running_mtx );
 	app.thread_id = GetCurrentThreadId();
 	app.handle = GetModuleHandle(NULL);
+	bw_TimerHeap_init( &app.timers );
+	app.timer_id = 0;
+	app.low_memory_notification = CreateMemoryResourceNotification( LowMemoryResourceNotification );
+	app.low_memory_wait = NULL;
 
 	// Register window class
 	memset( &app.wc, 0, sizeof(WNDCLASSEXW) );
@@ -282,6 +300,10 @@ void bw_Application_exitAsync( bw_Application* app, int code ) {
 }
 
 void bw_ApplicationImpl_finish( bw_ApplicationImpl* app ) {
-	bw_ApplicationWin32_freeTimerMap();
+	if ( app->timer_id != 0 )
+		KillTimer( NULL, app->timer_id );
+	bw_TimerHeap_free( &app->timers );
+	if ( app->low_memory_notification != NULL )
+		CloseHandle( app->low_memory_notification );
 	UnregisterClassW( L"bw-window", app->handle );
 }
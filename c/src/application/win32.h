@@ -17,6 +17,8 @@ extern "C" {
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 
+#include "timer_heap.h"
+
 
 
 typedef struct {
@@ -24,11 +26,15 @@ typedef struct {
 	HINSTANCE handle;
 	WNDCLASSEXW wc;
 	SRWLOCK is_running_mtx;
+	bw_TimerHeap timers;	// Deadlines are in milliseconds since system startup
+	UINT_PTR timer_id;	// The one timer that fires at the earliest deadline, or 0 when not set
+	HANDLE low_memory_notification;	// Is signaled for as long as the system is low on memory, or null if it couldn't be created
+	HANDLE low_memory_wait;	// The wait on low_memory_notification, or null when nothing is waiting on it
 } bw_ApplicationImpl;
 
 typedef struct {
 	void* dispatch_data;
-	UINT delay;
+	uint64_t delay;
 	struct bw_Application* app;
 } bw_ApplicationDispatchDelayedData;
 
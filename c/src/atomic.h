@@ -0,0 +1,72 @@
+#ifndef BW_ATOMIC_H
+#define BW_ATOMIC_H
+
+// A few sequentially consistent atomic operations on plain variables.
+// C11's <stdatomic.h> can't be used, because the C sources are compiled as C++ when CEF is used.
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+#define bw_atomic_exchangePtr( PTR, VALUE ) \
+	_InterlockedExchangePointer( (void* volatile*)(PTR), (void*)(VALUE) )
+#define bw_atomic_loadPtr( PTR ) \
+	_InterlockedCompareExchangePointer( (void* volatile*)(PTR), 0, 0 )
+#define bw_atomic_storePtr( PTR, VALUE ) \
+	(void)_InterlockedExchangePointer( (void* volatile*)(PTR), (void*)(VALUE) )
+// Stores VALUE in a pointer if it is EXPECTED, and returns the value it had.
+#define bw_atomic_compareExchangePtr( PTR, EXPECTED, VALUE ) \
+	_InterlockedCompareExchangePointer( (void* volatile*)(PTR), (void*)(VALUE), (void*)(EXPECTED) )
+#define bw_atomic_exchangeInt( PTR, VALUE ) \
+	_InterlockedExchange( (volatile long*)(PTR), (long)(VALUE) )
+#define bw_atomic_loadInt( PTR ) \
+	(int)_InterlockedCompareExchange( (volatile long*)(PTR), 0, 0 )
+#define bw_atomic_storeInt( PTR, VALUE ) \
+	(void)_InterlockedExchange( (volatile long*)(PTR), (long)(VALUE) )
+// Stores VALUE in a 64-bit integer if it is EXPECTED, and returns the value it had.
+#define bw_atomic_compareExchangeU64( PTR, EXPECTED, VALUE ) \
+	(uint64_t)_InterlockedCompareExchange64( (volatile __int64*)(PTR), (__int64)(VALUE), (__int64)(EXPECTED) )
+#define bw_atomic_addU64( PTR, VALUE ) \
+	(void)_InterlockedExchangeAdd64( (volatile __int64*)(PTR), (__int64)(VALUE) )
+#if defined(_M_X64)
+// Aligned 64-bit loads are atomic on x64, and don't need a locked instruction to be sequentially consistent.
+#define bw_atomic_loadU64( PTR ) \
+	(uint64_t)( *(const volatile __int64*)(PTR) )
+#else
+#define bw_atomic_loadU64( PTR ) \
+	(uint64_t)_InterlockedCompareExchange64( (volatile __int64*)(PTR), 0, 0 )
+#endif
+#define bw_atomic_storeU64( PTR, VALUE ) \
+	(void)_InterlockedExchange64( (volatile __int64*)(PTR), (__int64)(VALUE) )
+
+#else
+
+#define bw_atomic_exchangePtr( PTR, VALUE ) \
+	__atomic_exchange_n( (PTR), (VALUE), __ATOMIC_SEQ_CST )
+#define bw_atomic_loadPtr( PTR ) \
+	__atomic_load_n( (PTR), __ATOMIC_SEQ_CST )
+#define bw_atomic_storePtr( PTR, VALUE ) \
+	__atomic_store_n( (PTR), (VALUE), __ATOMIC_SEQ_CST )
+// Stores VALUE in a pointer if it is EXPECTED, and returns the value it had.
+#define bw_atomic_compareExchangePtr( PTR, EXPECTED, VALUE ) \
+	__sync_val_compare_and_swap( (PTR), (EXPECTED), (VALUE) )
+#define bw_atomic_exchangeInt( PTR, VALUE ) \
+	__atomic_exchange_n( (PTR), (VALUE), __ATOMIC_SEQ_CST )
+#define bw_atomic_loadInt( PTR ) \
+	__atomic_load_n( (PTR), __ATOMIC_SEQ_CST )
+#define bw_atomic_storeInt( PTR, VALUE ) \
+	__atomic_store_n( (PTR), (VALUE), __ATOMIC_SEQ_CST )
+// Stores VALUE in a 64-bit integer if it is EXPECTED, and returns the value it had.
+#define bw_atomic_compareExchangeU64( PTR, EXPECTED, VALUE ) \
+	__sync_val_compare_and_swap( (PTR), (uint64_t)(EXPECTED), (uint64_t)(VALUE) )
+#define bw_atomic_addU64( PTR, VALUE ) \
+	(void)__atomic_fetch_add( (PTR), (uint64_t)(VALUE), __ATOMIC_SEQ_CST )
+#define bw_atomic_loadU64( PTR ) \
+	__atomic_load_n( (PTR), __ATOMIC_SEQ_CST )
+#define bw_atomic_storeU64( PTR, VALUE ) \
+	__atomic_store_n( (PTR), (uint64_t)(VALUE), __ATOMIC_SEQ_CST )
+
+#endif
+
+
+
+#endif//BW_ATOMIC_H
@@ -13,6 +13,9 @@ extern "C" {
 
 #include "application.h"
 #include "err.h"
+#include "js_value.h"
+#include "request_context.h"
+#include "resource.h"
 #include "string.h"
 #include "window.h"
 
@@ -21,18 +24,219 @@ extern "C" {
 
 
 typedef struct bw_BrowserWindow bw_BrowserWindow;
+/// A buffer of data that is waiting to be sent to the renderer, like the scripts buffered when coalescing is enabled.
+typedef struct bw_BrowserWindowQueue bw_BrowserWindowQueue;
+/// Identifies a browser window for as long as it exists, and never refers to any browser window after it has been destroyed.
+/// Anything that is handled some time after it has been received, refers to its browser window by this id instead of by pointer.
+typedef bw_SlabHandle bw_BrowserWindowId;
+
+
+
+/// The error codes that the callbacks of `bw_BrowserWindow_evalJs` and its variants can receive.
+/// The code threw an exception, or couldn't be evaluated at all.
+#define BW_BROWSER_WINDOW_JS_ERROR_EXCEPTION 1
+/// The evaluation has been cancelled, either explicitly or because the browser window has been closed.
+#define BW_BROWSER_WINDOW_JS_ERROR_CANCELLED 2
+/// The result didn't arrive within the timeout.
+#define BW_BROWSER_WINDOW_JS_ERROR_TIMED_OUT 3
+
+/// The error codes that the callbacks of `bw_BrowserWindow_captureToBuffer`, `bw_BrowserWindow_printToPdfBuffer` and render jobs can receive.
+/// Only windowless browser windows paint frames that can be captured.
+#define BW_BROWSER_WINDOW_OUTPUT_ERROR_UNSUPPORTED 1
+/// The browser window has been closed before the output was ready, or the render job has been dropped from its queue.
+#define BW_BROWSER_WINDOW_OUTPUT_ERROR_CANCELLED 2
+/// The browser engine has been unable to produce the output.
+#define BW_BROWSER_WINDOW_OUTPUT_ERROR_FAILED 3
+/// The render job hasn't been rendered within its timeout.
+#define BW_BROWSER_WINDOW_OUTPUT_ERROR_TIMED_OUT 4
 
 
 
 typedef void (*bw_BrowserWindowCreationCallbackFn)( bw_BrowserWindow* window, void* data );
+/// Receives the browser windows created by `bw_BrowserWindow_newMany`, in the order of their specs.
+/// The `windows` array is only valid during the invocation of the callback.
+typedef void (*bw_BrowserWindowManyCreationCallbackFn)( bw_BrowserWindow** windows, size_t count, void* data );
 typedef void (*bw_BrowserWindowHandlerFn)( bw_BrowserWindow* window, bw_CStrSlice cmd, bw_CStrSlice* args, size_t arg_count );
 typedef void (*bw_BrowserWindowJsCallbackFn)( bw_BrowserWindow* window, void* user_data, const char* result, const bw_Err* err );
+/// Like `bw_BrowserWindowHandlerFn`, but receives the arguments as structured values.
+/// The `args` values are only valid during the invocation of the handler.
+typedef void (*bw_BrowserWindowStructuredHandlerFn)( bw_BrowserWindow* window, bw_CStrSlice cmd, const bw_JsValue* args, size_t arg_count );
+/// Receives the data given to `invoke_extern_binary`, which is only valid during the invocation of the handler.
+/// CEF 87 gives the renderer no access to the contents of an `ArrayBuffer`, so the page's bytes are read out as javascript strings of one character per byte.
+/// Those take two bytes per byte in the renderer until they are narrowed back into bytes there; only the message to the application carries the bytes as they are.
+typedef void (*bw_BrowserWindowBinaryHandlerFn)( bw_BrowserWindow* window, bw_CStrSlice cmd, const uint8_t* data, size_t size );
+/// Receives the bytes that the page has written with `write_extern_stream`, which are only valid during the invocation of the handler.
+/// The bytes leave the page in the same way as those of `invoke_extern_binary`, see `bw_BrowserWindowBinaryHandlerFn`.
+typedef void (*bw_BrowserWindowStreamHandlerFn)( bw_BrowserWindow* window, void* user_data, const uint8_t* data, size_t size );
+/// What happens to a call of `invoke_extern` when the queue of calls that are waiting for the GUI thread is full.
+typedef unsigned char bw_BrowserWindowInvokeOverflow;
+/// `invoke_extern` throws an exception in the page, until the GUI thread has caught up.
+#define BW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK 0
+/// The oldest waiting call is dropped to make room.
+#define BW_BROWSER_WINDOW_INVOKE_OVERFLOW_DROP_OLDEST 1
+/// A call replaces the arguments of the waiting call with the same command, even if the queue isn't full, which suits calls that report the latest state of something.
+/// If there is no such call and the queue is full, the oldest waiting call is dropped.
+#define BW_BROWSER_WINDOW_INVOKE_OVERFLOW_COALESCE 2
+
+/// One call of `invoke_extern`, as it is given to a `bw_BrowserWindowBatchHandlerFn`.
+typedef struct {
+	bw_CStrSlice cmd;
+	const bw_CStrSlice* args;
+	size_t arg_count;
+} bw_BrowserWindowInvocation;
+/// Receives the calls of `invoke_extern` that the page has made during one task, in the order in which they were made.
+/// The `calls` are only valid during the invocation of the handler.
+typedef void (*bw_BrowserWindowBatchHandlerFn)( bw_BrowserWindow* window, const bw_BrowserWindowInvocation* calls, size_t call_count );
+/// Receives the calls of `invoke_native`, of which the promise is settled by `bw_BrowserWindow_replyToInvocation` with the same `request_id`.
+/// The `args` strings are only valid during the invocation of the handler.
+typedef void (*bw_BrowserWindowNativeHandlerFn)( bw_BrowserWindow* window, bw_CStrSlice cmd, bw_CStrSlice* args, size_t arg_count, unsigned int request_id );
+/// Receives the calls of `invoke_extern` on one of the threads of the worker pool, instead of on the GUI thread.
+/// Calls of the same browser window may be handled at the same time on different threads, and so may finish out of order.
+/// The browser window can be closed on the GUI thread while the handler runs, so `window` should only be used to take its id right away, and be looked up again with `bw_Application_findBrowserWindow` whenever it is needed.
+/// The `args` strings are only valid during the invocation of the handler.
+typedef void (*bw_BrowserWindowThreadedHandlerFn)( bw_BrowserWindow* window, void* user_data, bw_CStrSlice cmd, const bw_CStrSlice* args, size_t arg_count );
+/// Receives the calls of `invoke_extern` of a command that has been registered with `bw_BrowserWindow_registerCommand`, on the GUI thread.
+/// The `args` strings are only valid during the invocation of the handler.
+typedef void (*bw_BrowserWindowCommandHandlerFn)( bw_BrowserWindow* window, void* user_data, unsigned int command_id, const bw_CStrSlice* args, size_t arg_count );
+/// The `result` value is only valid during the invocation of the callback.
+typedef void (*bw_BrowserWindowJsStructuredCallbackFn)( bw_BrowserWindow* window, void* user_data, const bw_JsValue* result, const bw_Err* err );
+/// What has happened to the page of a browser window, as it is given to a `bw_BrowserWindowEventHandlerFn`.
+typedef unsigned char bw_BrowserWindowEventKind;
+/// The main frame has started loading a page.
+#define BW_BROWSER_WINDOW_EVENT_LOAD_START 0
+/// The main frame has finished loading a page, with the HTTP status code in `http_status`.
+#define BW_BROWSER_WINDOW_EVENT_LOAD_END 1
+/// The url of the main frame has changed to `text`, which also happens for navigation within the page.
+#define BW_BROWSER_WINDOW_EVENT_URL_CHANGE 2
+/// The title of the page has changed to `text`.
+#define BW_BROWSER_WINDOW_EVENT_TITLE_CHANGE 3
+/// The loading progress of the page has changed to `progress`, which goes from 0 to 1.
+#define BW_BROWSER_WINDOW_EVENT_PROGRESS 4
+
+typedef struct {
+	bw_BrowserWindowEventKind kind;
+	bw_CStrSlice text;
+	int http_status;
+	double progress;
+} bw_BrowserWindowEvent;
+/// Receives the events of the page of a browser window, on the GUI thread.
+/// The `event` is only valid during the invocation of the handler.
+typedef void (*bw_BrowserWindowEventHandlerFn)( bw_BrowserWindow* window, void* user_data, const bw_BrowserWindowEvent* event );
+/// Decides whether a browser window receives the payload given to `bw_Application_broadcast`.
+typedef BOOL (*bw_ApplicationBroadcastFilterFn)( bw_BrowserWindow* window, void* user_data );
+
+
+
+/// A request made by the page, as it is given to a `bw_BrowserWindowRequestHandlerFn`.
+typedef struct {
+	bw_CStrSlice method;
+	bw_CStrSlice url;
+	/// All request headers, as lines of the form `Name: value`, seperated by newlines.
+	bw_CStrSlice headers;
+} bw_BrowserWindowRequest;
+
+/// The response that a `bw_BrowserWindowRequestHandlerFn` answers a request with.
+typedef struct {
+	unsigned int status;
+	/// If empty, it is derived from the extension of the url.
+	bw_CStrSlice mime_type;
+	/// The body, which is not copied.
+	/// `free_fn` is invoked with `free_data` once it isn't used anymore, possibly on another thread.
+	const void* data;
+	size_t size;
+	bw_ResourceFreeFn free_fn;
+	void* free_data;
+	/// Whether the response can be stored in the response cache, and be used for later requests with the same url and key headers.
+	BOOL cacheable;
+} bw_BrowserWindowResponse;
+
+/// Answers a request from native code, by filling in `response` and returning true.
+/// Returning false lets the request go to the network like usual.
+/// This handler is invoked on the browser engine's IO thread, not on the GUI thread.
+typedef BOOL (*bw_BrowserWindowRequestHandlerFn)( bw_BrowserWindow* window, void* user_data, const bw_BrowserWindowRequest* request, bw_BrowserWindowResponse* response );
+
+typedef struct {
+	/// Only the requests of which the url starts with this are intercepted.
+	bw_CStrSlice url_prefix;
+	/// The maximum number of bytes that the cached responses can take up together, or 0 to disable the response cache.
+	/// The least recently used responses are evicted first.
+	size_t cache_budget;
+	/// The names of the request headers that are part of the cache key, besides the url, separated by commas.
+	bw_CStrSlice cache_key_headers;
+} bw_BrowserWindowInterceptOptions;
+
+/// An area of the view of a windowless browser window, in pixels.
+typedef struct {
+	int x;
+	int y;
+	int width;
+	int height;
+} bw_BrowserWindowRect;
+
+/// A frame that a windowless browser window has painted into memory.
+typedef struct {
+	/// The pixels of the whole view, in BGRA order, with rows of `width * 4` bytes.
+	/// Only valid during the invocation of the paint handler.
+	const void* buffer;
+	int width;
+	int height;
+	/// The areas that have changed since the previous frame, so that only those need to be uploaded.
+	const bw_BrowserWindowRect* dirty_rects;
+	size_t dirty_rect_count;
+	/// Whether this is a frame of a popup widget, like the list of a `<select>` element, instead of a frame of the view.
+	BOOL is_popup;
+} bw_BrowserWindowFrame;
 
+/// A frame that a windowless browser window has painted into a texture on the GPU, which can be opened by another graphics device without reading it back.
+typedef struct {
+	/// On Windows, the shared handle of a D3D11 texture. On macOS, an `IOSurfaceRef`.
+	/// Only valid during the invocation of the paint handler.
+	void* shared_handle;
+	const bw_BrowserWindowRect* dirty_rects;
+	size_t dirty_rect_count;
+	BOOL is_popup;
+} bw_BrowserWindowSharedFrame;
 
+/// Receives the frames of a windowless browser window.
+/// This handler is invoked on the browser engine's UI thread, which is not the GUI thread on Windows.
+typedef void (*bw_BrowserWindowPaintFn)( bw_BrowserWindow* window, void* user_data, const bw_BrowserWindowFrame* frame );
+/// Receives the frames of a windowless browser window that shares its textures, on the same thread as `bw_BrowserWindowPaintFn`.
+typedef void (*bw_BrowserWindowSharedPaintFn)( bw_BrowserWindow* window, void* user_data, const bw_BrowserWindowSharedFrame* frame );
 
 typedef struct bw_BrowserWindowOptions {
 	BOOL dev_tools;
 	bw_CStrSlice resource_path;
+	/// If set, the arguments given to `invoke_extern` are passed to this handler as structured values, instead of to the regular handler as strings.
+	bw_BrowserWindowStructuredHandlerFn structured_handler;
+	/// The handler that receives the binary data given to `invoke_extern_binary` in javascript.
+	bw_BrowserWindowBinaryHandlerFn binary_handler;
+	/// The handler that receives the calls of `invoke_native` in javascript.
+	/// If not set, the promises that `invoke_native` returns are rejected right away.
+	bw_BrowserWindowNativeHandlerFn native_handler;
+	/// If set, the calls of `invoke_extern` are collected by the renderer process until the task that made them has finished.
+	/// They are then sent in one message, and passed to this handler all at once instead of to the regular handler.
+	/// This is not used when there is a structured handler.
+	bw_BrowserWindowBatchHandlerFn batch_handler;
+	/// If set, the calls of `invoke_extern` are passed to this handler on the worker pool, instead of to the regular handler on the GUI thread.
+	/// This is not used when there is a structured or batch handler.
+	/// `free_threaded_handler_data` is invoked with `threaded_handler_data` once the browser window is gone and the last call has been handled.
+	bw_BrowserWindowThreadedHandlerFn threaded_handler;
+	void* threaded_handler_data;
+	bw_ResourceFreeFn free_threaded_handler_data;
+	/// The request context to browse in, or null for the global one that is shared with all other browser windows.
+	/// The browser window keeps the request context alive, so it can be freed right after the browser window has been created.
+	const bw_RequestContext* request_context;
+	/// If set, the browser window isn't shown in its window, but renders its frames off-screen into the paint handlers instead.
+	/// This requires `windowless_rendering` to be enabled in the application settings.
+	BOOL windowless;
+	/// The maximum number of frames per second that a windowless browser window paints, or 0 for the default of 60.
+	unsigned int windowless_frame_rate;
+	/// Lets a windowless browser window paint into shared textures, which are given to the shared paint handler instead of the paint handler.
+	BOOL shared_textures;
+	/// Keeps a windowless browser window rendering, while its window isn't shown.
+	/// Otherwise, it stops painting as long as its window is hidden, like any other browser window.
+	/// This is meant for browser windows that only render pages into memory, of which the window is never shown at all.
+	BOOL headless;
 } bw_BrowserWindowOptions;
 
 typedef struct bw_BrowserWindowSource {
@@ -40,17 +244,164 @@ typedef struct bw_BrowserWindowSource {
 	BOOL is_html;
 } bw_BrowserWindowSource;
 
+/// The arguments of `bw_BrowserWindow_new` for one of the browser windows created by `bw_BrowserWindow_newMany`.
+typedef struct {
+	const bw_Window* parent;
+	bw_BrowserWindowSource source;
+	bw_CStrSlice title;
+	int width;
+	int height;
+	const bw_WindowOptions* window_options;
+	const bw_BrowserWindowOptions* browser_window_options;
+	bw_BrowserWindowHandlerFn handler;
+	void* user_data;
+	/// If set, is invoked as soon as this browser window has been created, before the callback for all of them.
+	bw_BrowserWindowCreationCallbackFn callback;
+	void* callback_data;
+} bw_BrowserWindowSpec;
+
+
+
+/// The latencies, in microseconds, and the number of messages and bytes that a browser window exchanged with its renderer process.
+typedef struct {
+	bw_LatencyHistogram eval_js;	// From sending a script to the renderer process, until its result came back
+	bw_LatencyHistogram eval_js_execution;	// The part of that, that the renderer process spent on evaluating the script and converting its result
+	bw_LatencyHistogram invoke;	// From receiving the message of an `invoke_extern` call, until its handler got invoked on the GUI thread or the worker pool
+	uint64_t messages_sent;
+	uint64_t messages_received;
+	uint64_t bytes_sent;	// The size of the scripts, strings and binary data carried by the sent messages
+	uint64_t bytes_received;	// The size of the strings and binary data carried by the received messages, except for structured values
+	uint64_t invocations_dropped;	// The calls of `invoke_extern` that have been dropped or coalesced by the overflow policy of the invocation queue
+	size_t invoke_queue_depth;	// The number of calls of `invoke_extern` that are waiting for the GUI thread
+	size_t invoke_queue_peak;	// The highest that `invoke_queue_depth` has been
+} bw_BrowserWindowMetrics;
+
+/// The memory that a browser window is using, in bytes.
+typedef struct {
+	size_t pending_calls;	// The number of evaluations and other calls into the renderer process of which the result hasn't come back yet
+	size_t queued_bytes;	// The buffers of the coalesced scripts and the binary stream that are waiting to be sent
+	size_t cached_response_bytes;	// The responses cached by the request interceptor
+	BOOL renderer_measured;	// Whether the renderer process has reported the fields below, which are 0 otherwise
+	uint64_t js_heap_used;	// As reported by `performance.memory` in the page, which Chromium rounds unless it runs with --enable-precise-memory-info
+	uint64_t js_heap_total;
+	uint64_t js_heap_limit;
+	uint64_t renderer_private_bytes;	// The memory that only the renderer process uses, which may be shared with other browser windows that use the same process
+} bw_BrowserWindowMemoryStats;
+
+/// Receives the memory statistics of a browser window, which are only valid during the invocation of the callback.
+typedef void (*bw_BrowserWindowMemoryStatsFn)( bw_BrowserWindow* window, void* user_data, const bw_BrowserWindowMemoryStats* stats );
+
+/// The forms in which the page of a browser window can be rendered into memory.
+typedef unsigned char bw_BrowserWindowOutputFormat;
+/// The pixels of the whole view, in RGBA order, with rows of `width * 4` bytes.
+#define BW_BROWSER_WINDOW_OUTPUT_RGBA 0
+/// A PNG image of the whole view.
+#define BW_BROWSER_WINDOW_OUTPUT_PNG 1
+/// A PDF document of the page, as it would be printed.
+#define BW_BROWSER_WINDOW_OUTPUT_PDF 2
 
+/// Receives what a browser window has rendered into memory, on the GUI thread, or the error `err` if it failed, in which case `data` is null.
+/// `data` is only valid during the invocation of the callback.
+/// `width` and `height` are the size of the image in pixels, and 0 for a PDF document.
+typedef void (*bw_BrowserWindowOutputFn)( bw_BrowserWindow* window, void* user_data, const uint8_t* data, size_t size, int width, int height, const bw_Err* err );
+
+typedef struct {
+	BOOL landscape;
+	/// Whether the background colors and images of the page are printed as well.
+	BOOL backgrounds;
+} bw_BrowserWindowPdfOptions;
+
+/// A number of pages that are rendered into memory by headless browser windows, of which no more than a given number are loaded at the same time.
+typedef struct bw_BrowserWindowRenderQueue bw_BrowserWindowRenderQueue;
+
+/// A page to render with a `bw_BrowserWindowRenderQueue`.
+typedef struct {
+	bw_BrowserWindowSource source;
+	/// The size of the view, in pixels.
+	int width;
+	int height;
+	bw_BrowserWindowOutputFormat format;
+	/// Only used for `BW_BROWSER_WINDOW_OUTPUT_PDF`.
+	bw_BrowserWindowPdfOptions pdf_options;
+	/// The number of milliseconds to wait after the page has finished loading, for the scripts, fonts and animations that only settle down afterwards.
+	unsigned int settle_time;
+	/// The number of milliseconds, counted from the moment that the browser has been created, in which the page needs to be rendered, or 0 for 30 seconds.
+	/// Once it has passed, the callback receives a `BW_BROWSER_WINDOW_OUTPUT_ERROR_TIMED_OUT` error, and the browser window is destroyed to make room for the next job.
+	unsigned int timeout;
+} bw_BrowserWindowRenderJob;
 
 struct bw_BrowserWindow {
 	bw_Window* window;
 	bw_BrowserWindowHandlerFn external_handler;
+	bw_BrowserWindowStructuredHandlerFn structured_handler;
+	bw_BrowserWindowBinaryHandlerFn binary_handler;
+	bw_BrowserWindowNativeHandlerFn native_handler;
+	bw_BrowserWindowBatchHandlerFn batch_handler;
 	void* user_data;
+	bw_BrowserWindowQueue* js_queue;
+	bw_BrowserWindowQueue* stream_queue;
+	bw_BrowserWindowEventHandlerFn event_handler;
+	void* event_handler_data;
+	bw_ResourceFreeFn free_event_handler_data;
+	// The url and title that the page has reported last, so that getting them doesn't need to ask the browser engine
+	bw_StrSlice url;
+	bw_StrSlice page_title;
+	bw_BrowserWindowMetrics metrics;
 	bw_BrowserWindowImpl impl;
 };
 
 
 
+/// Keeps `count` hidden browser windows ready, so that `bw_BrowserWindow_new` can take one of them instead of waiting for a new renderer to start up.
+/// A pooled browser window is only taken for browser windows that are created with the same window options and resource path, with the same kind of `invoke_extern` handler, and without a parent.
+/// Dev tools, windowless rendering, request contexts, and batch and threaded handlers are never pooled.
+/// If `refill` is set, a replacement is created in the background when the GUI thread is idle, whenever a browser window has been taken.
+/// Calling this again changes the number of browser windows to keep ready, and a `count` of 0 destroys them all.
+/// Pooled browser windows don't keep the application from exiting.
+void bw_Application_prewarmBrowserWindows( bw_Application* app, unsigned int count, const bw_WindowOptions* window_options, const bw_BrowserWindowOptions* browser_window_options, BOOL refill );
+
+/// What `bw_Application_broadcast` sends to every browser window.
+typedef struct {
+	/// Executed like with `bw_BrowserWindow_execJs`, unless it is empty.
+	bw_CStrSlice js;
+	/// Posted like with `bw_BrowserWindow_postBinary`, unless `size` is 0.
+	const uint8_t* data;
+	size_t size;
+} bw_ApplicationBroadcastPayload;
+
+/// Sends the same payload to all browser windows of the application for which `filter` returns true, or to all of them if `filter` is null.
+/// The payload is converted only once, instead of once for every browser window.
+/// Browser windows that are waiting in the prewarm pool are left out.
+/// Returns the number of browser windows that the payload has been sent to.
+size_t bw_Application_broadcast( bw_Application* app, const bw_ApplicationBroadcastPayload* payload, bw_ApplicationBroadcastFilterFn filter, void* user_data );
+
+/// Returns the browser window with the given id, or null if it has been destroyed in the meantime.
+/// This function is thread safe, but the browser window can only be used on the GUI thread.
+bw_BrowserWindow* bw_Application_findBrowserWindow( const bw_Application* app, bw_BrowserWindowId id );
+
+/// Creates a queue of render jobs, of which at most `concurrency` are loaded at the same time, each in a headless browser window of its own.
+/// The browser windows are created with the given options, except that they are always windowless and headless.
+/// This requires `windowless_rendering` to be enabled in the application settings.
+/// The browsers render off-screen, but every browser window is still tied to a native window of its own, which is never shown.
+/// A browser window can't exist without its window in this library, and on Linux that window and GTK itself need a display, so a server without one still needs a virtual display, like Xvfb.
+/// Should be called on the GUI thread, like all other functions of the render queue.
+bw_BrowserWindowRenderQueue* bw_BrowserWindowRenderQueue_new( bw_Application* app, unsigned int concurrency, const bw_BrowserWindowOptions* options );
+/// Drops the jobs that are still waiting, of which the callbacks are invoked with an error, and frees the queue once the jobs that are loading have finished.
+void bw_BrowserWindowRenderQueue_free( bw_BrowserWindowRenderQueue* queue );
+/// Adds a job to the end of the queue.
+/// `callback` receives the output, with the browser window in which it has been rendered, right before that browser window gets destroyed.
+/// The job is copied, so it doesn't need to stay around.
+void bw_BrowserWindowRenderQueue_push( bw_BrowserWindowRenderQueue* queue, const bw_BrowserWindowRenderJob* job, bw_BrowserWindowOutputFn callback, void* user_data );
+/// Returns the number of jobs that are waiting, and sets `running` to the number of jobs that are loading, if not null.
+size_t bw_BrowserWindowRenderQueue_pending( const bw_BrowserWindowRenderQueue* queue, size_t* running );
+/// Changes the number of jobs that may be loaded at the same time, which starts waiting jobs right away if it has been raised.
+void bw_BrowserWindowRenderQueue_setConcurrency( bw_BrowserWindowRenderQueue* queue, unsigned int concurrency );
+
+/// Renders the view of a windowless browser window into memory, with the next frame that it paints.
+/// A PDF document is rendered like with `bw_BrowserWindow_printToPdfBuffer` with its default options, which also works for browser windows that are not windowless.
+/// Frames are only painted while the window is shown, unless the browser window is headless.
+void bw_BrowserWindow_captureToBuffer( bw_BrowserWindow* bw, bw_BrowserWindowOutputFormat format, bw_BrowserWindowOutputFn callback, void* user_data );
+
 void bw_BrowserWindow_destroy( bw_BrowserWindow* bw );
 
 /// Marks the browser window handle as not being used anymore.
@@ -60,15 +411,153 @@ void bw_BrowserWindow_drop( bw_BrowserWindow* bw );
 
 /// Executes the given JavaScript and calls the given callback (on the GUI thread) to provide the result.
 void bw_BrowserWindow_evalJs( bw_BrowserWindow* bw, bw_CStrSlice js, bw_BrowserWindowJsCallbackFn callback, void* cb_data );
-void bw_BrowserWindow_evalJsThreaded( bw_BrowserWindow* bw, bw_CStrSlice js, bw_BrowserWindowJsCallbackFn callback, void* cb_data );
+/// Like `bw_BrowserWindow_evalJs`, but invokes the callback with a `BW_BROWSER_WINDOW_JS_ERROR_TIMED_OUT` error if the result takes longer than `timeout` milliseconds.
+/// A `timeout` of 0 means no timeout.
+/// Returns an id that can be passed to `bw_BrowserWindow_cancelJs`.
+uint64_t bw_BrowserWindow_evalJsWithTimeout( bw_BrowserWindow* bw, bw_CStrSlice js, unsigned int timeout, bw_BrowserWindowJsCallbackFn callback, void* cb_data );
+/// Stops waiting on the result of the evaluation with the given id, and invokes its callback with a `BW_BROWSER_WINDOW_JS_ERROR_CANCELLED` error right away.
+/// The result is dropped when it still arrives.
+/// Returns false if the evaluation has already completed.
+BOOL bw_BrowserWindow_cancelJs( bw_BrowserWindow* bw, uint64_t id );
+/// Like `bw_BrowserWindow_evalJs`, but can be called from any thread, with the id of the browser window instead of the browser window itself.
+/// The callback is not invoked on the GUI thread, but on whatever thread the browser engine receives the result on, and it receives a null browser window.
+/// If the browser window doesn't exist (anymore), or its browser hasn't been created yet, the callback is invoked right away with a `BW_BROWSER_WINDOW_JS_ERROR_CANCELLED` error.
+void bw_BrowserWindow_evalJsThreaded( bw_Application* app, bw_BrowserWindowId id, bw_CStrSlice js, bw_BrowserWindowJsCallbackFn callback, void* cb_data );
+/// Like `bw_BrowserWindow_evalJs`, but provides the result as a structured value instead of a string.
+/// Arrays and objects are transferred as a whole, making a `JSON.stringify` round trip unnecessary.
+void bw_BrowserWindow_evalJsStructured( bw_BrowserWindow* bw, bw_CStrSlice js, bw_BrowserWindowJsStructuredCallbackFn callback, void* cb_data );
+
+/// Executes all given scripts with one round trip to the renderer process.
+/// For every script, its callback (`callbacks[i]`) is invoked with its data (`cb_data[i]`), in the same order as the scripts are given.
+/// If `count` is 0, nothing happens and the arrays may be null.
+void bw_BrowserWindow_evalJsBatch( bw_BrowserWindow* bw, const bw_CStrSlice* scripts, size_t count, const bw_BrowserWindowJsCallbackFn* callbacks, void* const* cb_data );
+
+/// Executes the given JavaScript without providing its result.
+/// If coalescing is enabled, the script is buffered and executed together with all other buffered scripts at a later time.
+void bw_BrowserWindow_execJs( bw_BrowserWindow* bw, bw_CStrSlice js );
+
+/// Executes all scripts that have been buffered by `bw_BrowserWindow_execJs`.
+void bw_BrowserWindow_flushJs( bw_BrowserWindow* bw );
 
 bw_Application* bw_BrowserWindow_getApp( bw_BrowserWindow* bw );
+/// This function is thread safe.
+bw_BrowserWindowId bw_BrowserWindow_getId( const bw_BrowserWindow* bw );
+/// Copies the latencies and counters of the messages that the browser window exchanged with its renderer process.
+void bw_BrowserWindow_getMetrics( const bw_BrowserWindow* bw, bw_BrowserWindowMetrics* metrics );
+/// Like `bw_BrowserWindow_getMetrics`, but can be called from any thread, with the id of the browser window instead of the browser window itself.
+/// Returns false if the browser window doesn't exist (anymore), in which case `metrics` is left alone.
+BOOL bw_BrowserWindow_getMetricsThreaded( const bw_Application* app, bw_BrowserWindowId id, bw_BrowserWindowMetrics* metrics );
+/// Measures the memory that the browser window uses, both in this process and in its renderer process, and invokes the callback on the GUI thread with the results.
+/// If the browser window gets closed before the renderer process answers, the callback is still invoked, but only with the memory used in this process.
+void bw_BrowserWindow_getMemoryStats( bw_BrowserWindow* bw, bw_BrowserWindowMemoryStatsFn callback, void* user_data );
+/// Fills in the memory that the browser window uses in this process, without asking its renderer process.
+/// Should be called on the GUI thread.
+void bw_BrowserWindow_getNativeMemoryStats( const bw_BrowserWindow* bw, bw_BrowserWindowMemoryStats* stats );
+/// Gets the title of the page, as it has been reported last.
+/// The title is only valid until the GUI thread handles the next event of the browser window.
+void bw_BrowserWindow_getPageTitle( const bw_BrowserWindow* bw, bw_CStrSlice* title );
 void* bw_BrowserWindow_getUserData( bw_BrowserWindow* bw );
+/// Gets the url of the main frame.
+/// Returns false if `url` borrows the url that has been reported last, which is only valid until the GUI thread handles the next event of the browser window.
+/// Returns true if `url` has been allocated and needs to be freed with `bw_string_free`.
 BOOL bw_BrowserWindow_getUrl(bw_BrowserWindow* bw, bw_StrSlice* url);
 bw_Window* bw_BrowserWindow_getWindow( bw_BrowserWindow* bw );
 
+/// Prints the page into a PDF document in memory.
+/// The browser engine only prints into files, so the document goes through a temporary file that is deleted right after it has been read.
+/// `options` may be null for the defaults.
+void bw_BrowserWindow_printToPdfBuffer( bw_BrowserWindow* bw, const bw_BrowserWindowPdfOptions* options, bw_BrowserWindowOutputFn callback, void* user_data );
+
+/// Sends the given bytes to the page, without any text encoding.
+/// They arrive in javascript as an `ArrayBuffer`, as the argument of the global function `on_extern_binary`, if the page has defined it.
+/// Unlike the bytes that the page sends, these are never converted into javascript strings along the way.
+void bw_BrowserWindow_postBinary( bw_BrowserWindow* bw, const uint8_t* data, size_t size );
+
+/// Appends the given bytes to the page's binary stream.
+/// The stream is flushed on the next iteration of the event loop, or as soon as 1 MiB is buffered, so that a lot of small writes take only one message to the renderer.
+/// The page receives every flushed part of the stream as an `ArrayBuffer`, as the argument of the global function `on_extern_stream`, if it has defined it.
+/// That `ArrayBuffer` is a copy of the page's own, so the page's writes into it never reach the application; for that direction, see `bw_BrowserWindow_setStreamHandler`.
+void bw_BrowserWindow_writeStream( bw_BrowserWindow* bw, const uint8_t* data, size_t size );
+
+/// Sends the bytes written to the page's stream by `bw_BrowserWindow_writeStream` right away.
+void bw_BrowserWindow_flushStream( bw_BrowserWindow* bw );
+
+/// Sets the handler that receives the bytes that the page writes to the application, with its global function `write_extern_stream`.
+/// That function takes an `ArrayBuffer` or a view on one, and its writes are coalesced like those of `bw_BrowserWindow_writeStream`: they are sent once the page's current task has finished, or as soon as 1 MiB is buffered.
+/// While there is no handler, `write_extern_stream` throws an exception in the page, rather than dropping the data.
+/// Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null.
+void bw_BrowserWindow_setStreamHandler( bw_BrowserWindow* bw, bw_BrowserWindowStreamHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+
+/// Settles the promise that `invoke_native` has returned for the given request, without evaluating any javascript.
+/// If `success` is set, the promise is resolved with `value` as a string, otherwise it is rejected with an `Error` that has `value` as its message.
+/// Every request should be replied to once, and replies to requests made by a page that has been unloaded in the meantime are dropped.
+/// The `request_id` is given out by the browser process, so a reply never reaches a page other than the one that has made the request.
+void bw_BrowserWindow_replyToInvocation( bw_BrowserWindow* bw, unsigned int request_id, BOOL success, bw_CStrSlice value );
+
+/// Calls the function of a script that has been registered with `bw_BrowserWindow_registerScript`, with the given strings as its arguments.
+/// If `callback` is not null, it is invoked with the function's return value, just like with `bw_BrowserWindow_evalJs`.
+void bw_BrowserWindow_invokeScript( bw_BrowserWindow* bw, unsigned int script_id, const bw_CStrSlice* args, size_t arg_count, bw_BrowserWindowJsCallbackFn callback, void* cb_data );
+
+/// Lets `handler` answer the requests of the page, before they go through the network stack.
+/// Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null.
+/// If `handler` is null, requests aren't intercepted anymore.
+void bw_BrowserWindow_interceptRequests( bw_BrowserWindow* bw, const bw_BrowserWindowInterceptOptions* options, bw_BrowserWindowRequestHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+
 bw_Err bw_BrowserWindow_navigate( bw_BrowserWindow* bw, bw_CStrSlice url );
 
+/// Sets the handler that receives the events of the page, like the start and end of loading it, and changes of its url and title.
+/// Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null.
+/// If `handler` is null, events are not received anymore.
+void bw_BrowserWindow_setEventHandler( bw_BrowserWindow* bw, bw_BrowserWindowEventHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+
+/// Sets the handler that receives the frames of a windowless browser window, and requests a new frame of the whole view.
+/// Replaces the handler that has been set before, after which `free_user_data` is invoked with its user data, if not null.
+/// If a paint is still using the previous handler, its user data is freed once that paint is done, on the thread that painted.
+/// If `handler` is null, frames are not received anymore.
+/// Doesn't do anything for browser windows that are not windowless.
+void bw_BrowserWindow_setPaintHandler( bw_BrowserWindow* bw, bw_BrowserWindowPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+
+/// Like `bw_BrowserWindow_setPaintHandler`, but for the frames that are painted into shared textures.
+void bw_BrowserWindow_setSharedPaintHandler( bw_BrowserWindow* bw, bw_BrowserWindowSharedPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+
+/// Changes the size of the view of a windowless browser window, after which it paints frames of that size.
+/// `scale_factor` is the number of pixels per device independent pixel.
+/// The view also follows the size of its window when that gets resized.
+void bw_BrowserWindow_setViewSize( bw_BrowserWindow* bw, int width, int height, float scale_factor );
+
+/// Registers a script with the browser window, which is compiled once for every page that gets loaded.
+/// `source` should be a JavaScript expression that evaluates to a function, which can then be called by `bw_BrowserWindow_invokeScript` without sending the source again.
+/// `name` is used as the script's url in error messages and stack traces.
+/// Returns the id of the script.
+unsigned int bw_BrowserWindow_registerScript( bw_BrowserWindow* bw, bw_CStrSlice name, bw_CStrSlice source );
+
+/// Registers a command of `invoke_extern`, of which the calls are passed to `handler` instead of to the regular handler.
+/// The renderer process is told the command's id, so that a call of `invoke_extern(name, ...args)` only sends that id, and is routed to its handler without comparing or copying the name.
+/// `invoke_extern` can also be called with the id itself instead of the name.
+/// `free_user_data` is invoked with `user_data` when the browser window is destroyed, if not null.
+/// Calls with structured values, and batched calls, are not routed to registered commands.
+/// Returns the id of the command, which is never 0.
+unsigned int bw_BrowserWindow_registerCommand( bw_BrowserWindow* bw, bw_CStrSlice name, bw_BrowserWindowCommandHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+
+/// Releases the memory that the browser window can do without.
+/// This flushes the coalesced scripts and the binary stream and frees their buffers, and empties the response cache of the request interceptor.
+/// The renderer process then calls `on_memory_pressure` of the page with "moderate" or "critical", if the page has defined it.
+/// If the engine has been started with `--js-flags=--expose-gc`, the renderer process also collects the garbage of the page.
+void bw_BrowserWindow_trimMemory( bw_BrowserWindow* bw, bw_ApplicationMemoryPressure level );
+
+/// Limits the number of `invoke_extern` calls that can be waiting for the GUI thread to `limit`, or lifts the limit if `limit` is 0.
+/// `policy` decides what happens to calls when the limit has been reached.
+/// By default there is no limit, and calls are never dropped.
+/// Calls with binary data or structured values, batched calls, and calls that go to a threaded handler, are not limited.
+void bw_BrowserWindow_setInvokeQueueLimit( bw_BrowserWindow* bw, size_t limit, bw_BrowserWindowInvokeOverflow policy );
+
+/// Enables or disables the coalescing of scripts executed with `bw_BrowserWindow_execJs`.
+/// When enabled, scripts are buffered and flushed as one script on the next iteration of the event loop,
+///  or as soon as the buffer reaches `flush_threshold` bytes.
+/// A `flush_threshold` of 0 selects a default threshold.
+/// Disabling it flushes the buffer right away.
+void bw_BrowserWindow_setJsCoalescing( bw_BrowserWindow* bw, BOOL enabled, size_t flush_threshold );
+
 /// Creates a new browser window
 void bw_BrowserWindow_new(
 	bw_Application* app,
@@ -84,6 +573,23 @@ void bw_BrowserWindow_new(
 	void* callback_data	// Data that will be passed to the creation callback
 );
 
+/// Creates a browser window for each of the `count` specs, all at once, so that their renderers start up at the same time.
+/// `callback` is invoked once, when the last of them has been created, which is never from within this function.
+/// The specs and what they point to only need to stay around during this call.
+void bw_BrowserWindow_newMany(
+	bw_Application* app,
+	const bw_BrowserWindowSpec* specs,
+	size_t count,
+	bw_BrowserWindowManyCreationCallbackFn callback,
+	void* callback_data
+);
+
+
+
+/// Should be called by the browser engine on the GUI thread, when something has happened to the page.
+/// Keeps the url and title up to date, and passes the event on to the event handler and the `on_loaded` callback of the window.
+void _bw_BrowserWindow_onEvent( bw_BrowserWindow* bw, const bw_BrowserWindowEvent* event );
+
 
 
 #ifdef __cplusplus
@@ -2,17 +2,32 @@
 #include "../assert.h"
 #include "../application/cef.h"
 #include "../browser_window.h"
+#include "../cef/browser_registry.hpp"
 #include "../cef/bw_handle_map.hpp"
+#include "../cef/call_table.hpp"
+#include "../cef/client_handler.hpp"
 #include "../cef/exception.hpp"
+#include "../cef/invocation_queue.hpp"
+#include "../cef/offscreen_renderer.hpp"
+#include "../cef/request_interceptor.hpp"
 #include "../cef/util.hpp"
+#include "../cef/worker_pool.hpp"
 #include "../common.h"
 #include "../debug.h"
+#include "../trace.h"
 #include "impl.h"
 
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <string>
+#include <system_error>
+#include <vector>
 #include <include/base/cef_bind.h>
 #include <include/cef_browser.h>
 #include <include/cef_client.h>
+#include <include/cef_request_context.h>
 #include <include/cef_v8.h>
 #include <include/views/cef_browser_view.h>
 #include <include/views/cef_window.h>
@@ -38,51 +53,429 @@
 
 
 
+// The time between applying the sizes of a window that is being resized, which is about one frame.
+#define BW_BROWSER_WINDOW_CEF_RESIZE_DELAY 16
+// The minimum time between notifying the browser of a new size, because that causes the whole page to be laid out again.
+#define BW_BROWSER_WINDOW_CEF_RESIZE_NOTIFY_INTERVAL 100
+
+
+
+// The latest size of a window that is being resized.
+// A window can get a lot of resize events per frame while the user drags its border, so the size is only applied to the browser once per frame.
+struct bw_BrowserWindowCefResize {
+	bw_BrowserWindow* bw;	// Is set to null when the browser window gets destroyed while something is still pending
+	unsigned int width;
+	unsigned int height;
+	bool apply_pending;
+	bool notify_pending;
+	std::chrono::steady_clock::time_point last_notified;
+};
+
+// Reads the PDF document that the browser engine has printed into a temporary file, and hands it to the GUI thread.
+// The file is read on the worker pool, so that neither CEF's UI thread nor the GUI thread waits for the disk.
+class bw_BrowserWindowCefPdfCallback : public CefPdfPrintCallback {
+	bw_Application* app;
+	uint64_t call_id;
+
+public:
+	bw_BrowserWindowCefPdfCallback( bw_Application* app, uint64_t call_id ) : app(app), call_id(call_id) {}
+
+	void OnPdfPrintFinished( const CefString& path, bool ok ) override {
+		bw_Application* app = this->app;
+		uint64_t call_id = this->call_id;
+#if defined(BW_WIN32)
+		std::filesystem::path file_path( path.ToWString() );
+#else
+		std::filesystem::path file_path( path.ToString() );
+#endif
+
+		bw::worker_pool.submit( [app, call_id, file_path, ok]() {
+			bw::PendingOutput* output = new bw::PendingOutput { call_id, false, {}, 0, 0 };
+			if ( ok ) {
+				std::ifstream file( file_path, std::ios::binary | std::ios::ate );
+				if ( file ) {
+					output->data.resize( (size_t)file.tellg() );
+					file.seekg( 0 );
+					output->success = (bool)file.read( (char*)output->data.data(), (std::streamsize)output->data.size() );
+				}
+			}
+
+			std::error_code error;
+			std::filesystem::remove( file_path, error );
+			bw::dispatchOutput( app, output );
+		} );
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(bw_BrowserWindowCefPdfCallback);
+};
+
+
+
+void bw_BrowserWindowCef_applyResize( bw_Application* app, void* data );
 void bw_BrowserWindowCef_connectToGtkWindow( bw_BrowserWindow* bw, CefWindowInfo& info, int width, int height );
 void bw_BrowserWindowCef_connectToWin32Window( bw_BrowserWindow* bw, CefWindowInfo& info, int width, int height );
+void bw_BrowserWindowCef_notifyResize( bw_Application* app, void* data );
+// Frees the resize if nothing is pending anymore, and returns whether it has been freed.
+bool bw_BrowserWindowCef_releaseResize( bw_BrowserWindowCefResize* resize );
 
 
 
 // Sends the given Javascript code to the renderer process, expecting the code to be executed over there.
-// script_id should be a script id obtained from storing a callback in the eval callback store.
-void bw_BrowserWindowCef_sendJsToRendererProcess(
-	bw_BrowserWindow* bw,
-	CefRefPtr<CefBrowser>& cef_browser,
-	CefString& code,
-	bw_BrowserWindowJsCallbackFn cb,
-	void* user_data
-);
+// The call is stored in the call table, and only its ID is sent along.
+uint64_t bw_BrowserWindowCef_sendJsToRendererProcess( bw_BrowserWindow* bw, bw_CStrSlice js, const bw::PendingCall& call );
+// Sends the message to the renderer process of the browser window, and counts it in its metrics.
+// `size` is the number of bytes of the scripts, strings and binary data that the message carries.
+// The browser window is used as it is, so other threads than the GUI thread should send through `bw::browser_registry` instead.
+void bw_BrowserWindowCef_sendToRenderer( bw_BrowserWindow* bw, CefRefPtr<CefProcessMessage> msg, size_t size );
+// Settles the promise of invoke_native with the given id of the renderer process, in the frame that has made the request.
+void bw_BrowserWindowCef_replyToFrame( bw_BrowserWindow* bw, CefRefPtr<CefFrame> frame, unsigned int renderer_id, bool success, bw_CStrSlice value );
+// Times out the call of which the ID is stored in the `uint64_t` that `data` points to, if it is still pending.
+void bw_BrowserWindowCef_timeoutJs( bw_Application* app, void* data );
 char* bw_cef_errorMessage( bw_ErrCode code, const void* data );
+void bw_BrowserWindowCef_postBinary( bw_BrowserWindow* bw, const uint8_t* data, size_t size, bool stream );
 /// Constructs the platform-specific window info needed by CEF.
 CefWindowInfo _bw_BrowserWindow_windowInfo( bw_Window* window, int width, int height );
+// A path in the temporary directory that no other print uses, in this process or any other.
+std::filesystem::path bw_BrowserWindowCef_tempPdfPath();
 
 
 
 void bw_BrowserWindow_evalJs( bw_BrowserWindow* bw, bw_CStrSlice js, bw_BrowserWindowJsCallbackFn cb, void* user_data ) {
 
-	// Wrap the JS code within a temporary function and execute it, and convert the return value to a string
-	// This allows executing JS code that isn't terminated with a semicolon, and does the javascript value string conversion inside JS.
-	std::string _code = "(function () { return ";
-	_code.append( js.data, js.len );
-	_code += "; })()";
-	CefString code = _code;
-	// Note: For the sake of simplicity, I've used std::string to append some strings together.
-	//       CefString unfortunately doesn't provide this functionality.
-	//       There is some overhead because of this, but for now it is ok.
-
+	// The code is converted only once, and is wrapped in a function by the renderer process.
+	// This way, large scripts don't need to be copied around in the browser process.
 	// Execute the javascript on the renderer process, and invoke the callback from there:
-	CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)(bw->impl.cef_ptr);
+	bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), false, false, cb, 0, user_data };
 
-	bw_BrowserWindowCef_sendJsToRendererProcess( bw, cef_browser, code, cb, user_data );
+	bw_BrowserWindowCef_sendJsToRendererProcess( bw, js, call );
+}
+
+uint64_t bw_BrowserWindow_evalJsWithTimeout( bw_BrowserWindow* bw, bw_CStrSlice js, unsigned int timeout, bw_BrowserWindowJsCallbackFn cb, void* user_data ) {
+
+	bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), false, false, cb, 0, user_data };
+	if ( timeout != 0 )
+		call.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( timeout );
+
+	uint64_t call_id = bw_BrowserWindowCef_sendJsToRendererProcess( bw, js, call );
+
+	// The ID doesn't fit in a pointer on every platform, so the timer keeps a copy of it
+	if ( timeout != 0 ) {
+		uint64_t* timer_data = new uint64_t( call_id );
+		if ( !bw_Application_dispatchDelayed( bw->window->app, bw_BrowserWindowCef_timeoutJs, timer_data, timeout ) )
+			delete timer_data;
+	}
+
+	return call_id;
+}
+
+BOOL bw_BrowserWindow_cancelJs( bw_BrowserWindow* bw, uint64_t id ) {
+
+	std::optional<bw::PendingCall> call = bw::call_table.take( id, bw_BrowserWindow_getId( bw ) );
+	if ( !call.has_value() )
+		return FALSE;
+
+	call->fail( BW_BROWSER_WINDOW_JS_ERROR_CANCELLED, "evaluation has been cancelled" );
+	return TRUE;
+}
+
+void bw_BrowserWindow_evalJsStructured( bw_BrowserWindow* bw, bw_CStrSlice js, bw_BrowserWindowJsStructuredCallbackFn cb, void* user_data ) {
+
+	// The renderer process converts the result into a CefValue instead of a string
+	bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), true, false, 0, cb, user_data };
+
+	bw_BrowserWindowCef_sendJsToRendererProcess( bw, js, call );
+}
+
+void bw_BrowserWindow_evalJsBatch( bw_BrowserWindow* bw, const bw_CStrSlice* scripts, size_t count, const bw_BrowserWindowJsCallbackFn* callbacks, void* const* cb_data ) {
+
+	// An empty batch has no callbacks to invoke, and the arrays may be null
+	if ( count == 0 )
+		return;
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("eval-js-batch");
+	CefRefPtr<CefListValue> args = msg->GetArgumentList();
+
+	CefRefPtr<CefListValue> code_list = CefListValue::Create();
+	CefRefPtr<CefListValue> call_ids = CefListValue::Create();
+	code_list->SetSize( count );
+	call_ids->SetSize( count );
+	size_t size = 0;
+	for ( size_t i = 0; i < count; i++ ) {
+		code_list->SetString( i, bw_cef_copyFromStrSlice( scripts[i] ) );
+		size += scripts[i].len;
+
+		bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), false, false, callbacks[i], 0, cb_data[i] };
+		call_ids->SetValue( i, bw::callIdToValue( bw::call_table.store( call ) ) );
+	}
+
+	// Every script has its own entry in the call table, so that each of them can be cancelled on its own
+	args->SetList( 0, code_list );
+	args->SetList( 1, call_ids );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, size );
 }
 
 // It really doesn't matter from which thread we're sending the JavaScript code from,
 //  we're sending it off to another process anyway.
-void bw_BrowserWindow_evalJsThreaded( bw_BrowserWindow* bw, bw_CStrSlice js, bw_BrowserWindowJsCallbackFn cb, void* user_data ) {
-	bw_BrowserWindow_evalJs( bw, js, cb, user_data );
+// The result doesn't go through the GUI thread either, the callback is invoked on CEF's UI thread.
+// The browser window is only used while the browser registry is locked, so that the GUI thread can't clean it up in the meantime.
+void bw_BrowserWindow_evalJsThreaded( bw_Application* app, bw_BrowserWindowId id, bw_CStrSlice js, bw_BrowserWindowJsCallbackFn cb, void* user_data ) {
+
+	bw::PendingCall call = { app, id, false, true, cb, 0, user_data };
+
+	bool sent = false;
+	bw::browser_registry.with( app, id, [&]( bw_BrowserWindow* bw, CefRefPtr<CefBrowser> browser ) {
+		if ( browser == nullptr )
+			return;
+
+		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("eval-js");
+		CefRefPtr<CefListValue> args = msg->GetArgumentList();
+		args->SetString( 0, bw_cef_copyFromStrSlice( js ) );
+		args->SetValue( 1, bw::callIdToValue( bw::call_table.store( call ) ) );
+		args->SetBool( 2, false );
+
+		// The metrics are counters and histograms that can be updated from any thread
+		_bw_Metrics_count( &bw->metrics.messages_sent, 1 );
+		_bw_Metrics_count( &bw->metrics.bytes_sent, js.len );
+		bw_Trace_instant( "ipc_send" );
+		browser->GetMainFrame()->SendProcessMessage( PID_RENDERER, msg );
+		sent = true;
+	} );
+
+	// The callback is invoked outside of the lock, as it may take a while
+	if ( !sent )
+		call.fail( BW_BROWSER_WINDOW_JS_ERROR_CANCELLED, "browser window has been closed" );
+}
+
+void bw_BrowserWindowImpl_execJs( bw_BrowserWindow* bw, bw_CStrSlice js ) {
+
+	// The code is executed as-is, and the renderer process doesn't send back any result.
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("exec-js");
+	CefRefPtr<CefListValue> args = msg->GetArgumentList();
+	args->SetString( 0, bw_cef_copyFromStrSlice( js ) );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, js.len );
+}
+
+void bw_BrowserWindow_postBinary( bw_BrowserWindow* bw, const uint8_t* data, size_t size ) {
+	bw_BrowserWindowCef_postBinary( bw, data, size, false );
+}
+
+void bw_BrowserWindowImpl_postStream( bw_BrowserWindow* bw, const uint8_t* data, size_t size ) {
+	bw_BrowserWindowCef_postBinary( bw, data, size, true );
+}
+
+void bw_BrowserWindow_setStreamHandler( bw_BrowserWindow* bw, bw_BrowserWindowStreamHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	(*(CefRefPtr<bw::StreamReader>*)bw->impl.stream_reader_ptr)->set( bw, handler, user_data, free_user_data );
+}
+
+void bw_BrowserWindowCef_postBinary( bw_BrowserWindow* bw, const uint8_t* data, size_t size, bool stream ) {
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("post-binary");
+	CefRefPtr<CefListValue> args = msg->GetArgumentList();
+
+	// CEF can't hold empty binary values, so in that case the data is left out
+	if ( size > 0 )
+		args->SetBinary( 0, CefBinaryValue::Create( (const void*)data, size ) );
+	else
+		args->SetNull( 0 );
+	// Whether the data is part of the stream, or has been posted on its own
+	args->SetBool( 1, stream );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, size );
+}
+
+size_t bw_Application_broadcast( bw_Application* app, const bw_ApplicationBroadcastPayload* payload, bw_ApplicationBroadcastFilterFn filter, void* user_data ) {
+	bw_Application_assertCorrectThread( app );
+	bw_ApplicationEngineImpl_start( app );
+
+	// The script is converted to UTF-16 and the data is copied only once here.
+	// A message can only be sent once, but setting the converted values on every message only copies them.
+	CefString js;
+	if ( payload->js.len > 0 )
+		js = bw_cef_copyFromStrSlice( payload->js );
+	CefRefPtr<CefListValue> shared = CefListValue::Create();
+	if ( payload->size > 0 )
+		shared->SetBinary( 0, CefBinaryValue::Create( (const void*)payload->data, payload->size ) );
+
+	size_t sent = 0;
+	std::vector<bw_BrowserWindow*> handles = bw::bw_handle_map.all();
+	for ( auto it = handles.begin(); it != handles.end(); it++ ) {
+		bw_BrowserWindow* bw = *it;
+
+		// Browser windows that are waiting in the pool haven't been given a handler yet
+		if ( bw->window->app != app || bw->external_handler == 0 )
+			continue;
+		if ( filter != 0 && !filter( bw, user_data ) )
+			continue;
+
+		if ( payload->js.len > 0 ) {
+			// Scripts that have been buffered before are executed first
+			if ( bw->js_queue != 0 )
+				bw_BrowserWindow_flushJs( bw );
+
+			CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("exec-js");
+			msg->GetArgumentList()->SetString( 0, js );
+			bw_BrowserWindowCef_sendToRenderer( bw, msg, payload->js.len );
+		}
+
+		if ( payload->size > 0 ) {
+			CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("post-binary");
+			CefRefPtr<CefListValue> args = msg->GetArgumentList();
+			args->SetBinary( 0, shared->GetBinary( 0 ) );
+			args->SetBool( 1, false );
+			bw_BrowserWindowCef_sendToRenderer( bw, msg, payload->size );
+		}
+
+		sent += 1;
+	}
+	return sent;
+}
+
+void bw_BrowserWindow_replyToInvocation( bw_BrowserWindow* bw, unsigned int request_id, BOOL success, bw_CStrSlice value ) {
+
+	// The page that has made the request may be gone, in which case there is nobody to reply to
+	CefRefPtr<CefFrame> frame;
+	unsigned int renderer_id;
+	if ( !(*(CefRefPtr<bw::NativeRequests>*)bw->impl.native_requests_ptr)->take( request_id, frame, renderer_id ) )
+		return;
+
+	bw_BrowserWindowCef_replyToFrame( bw, frame, renderer_id, success != FALSE, value );
+}
+
+void bw_BrowserWindowCef_replyToFrame( bw_BrowserWindow* bw, CefRefPtr<CefFrame> frame, unsigned int renderer_id, bool success, bw_CStrSlice value ) {
+
+	// The renderer process hands the value to the promise as it is, so nothing needs to be evaluated
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-reply");
+	CefRefPtr<CefListValue> args = msg->GetArgumentList();
+	args->SetInt( 0, (int)renderer_id );
+	args->SetBool( 1, success );
+	args->SetString( 2, bw_cef_copyFromStrSlice( value ) );
+
+	_bw_Metrics_count( &bw->metrics.messages_sent, 1 );
+	_bw_Metrics_count( &bw->metrics.bytes_sent, value.len );
+	bw_Trace_instant( "ipc_send" );
+	frame->SendProcessMessage( PID_RENDERER, msg );
+}
+
+void bw_BrowserWindow_invokeScript( bw_BrowserWindow* bw, unsigned int script_id, const bw_CStrSlice* args, size_t arg_count, bw_BrowserWindowJsCallbackFn cb, void* user_data ) {
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-script");
+	CefRefPtr<CefListValue> msg_args = msg->GetArgumentList();
+
+	CefRefPtr<CefListValue> arg_list = CefListValue::Create();
+	arg_list->SetSize( arg_count );
+	size_t size = 0;
+	for ( size_t i = 0; i < arg_count; i++ ) {
+		arg_list->SetString( i, bw_cef_copyFromStrSlice( args[i] ) );
+		size += args[i].len;
+	}
+
+	msg_args->SetInt( 0, (int)script_id );
+	msg_args->SetList( 1, arg_list );
+	// Only when a callback is given, the renderer process sends back the result
+	msg_args->SetBool( 2, cb != 0 );
+	if ( cb != 0 ) {
+		bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), false, false, cb, 0, user_data };
+		msg_args->SetValue( 3, bw::callIdToValue( bw::call_table.store( call ) ) );
+	}
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, size );
+}
+
+unsigned int bw_BrowserWindow_registerScript( bw_BrowserWindow* bw, bw_CStrSlice name, bw_CStrSlice source ) {
+	CefRefPtr<bw::RegisteredScripts> scripts = *(CefRefPtr<bw::RegisteredScripts>*)bw->impl.scripts_ptr;
+
+	// The renderer process keeps the source around for every new page, until the browser process sends it to a new renderer process.
+	// Scripts registered before the browser has been created are sent when the first page starts loading.
+	unsigned int script_id = scripts->add( name, source );
+	scripts->send( bw, script_id );
+
+	return script_id;
+}
+
+unsigned int bw_BrowserWindow_registerCommand( bw_BrowserWindow* bw, bw_CStrSlice name, bw_BrowserWindowCommandHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	// Commands registered before the browser has been created are sent to the renderer process when the first page starts loading
+	return (*(CefRefPtr<bw::InvocationQueue>*)bw->impl.invoke_queue_ptr)->registerCommand( name, handler, user_data, free_user_data );
+}
+
+void bw_BrowserWindow_getMemoryStats( bw_BrowserWindow* bw, bw_BrowserWindowMemoryStatsFn callback, void* user_data ) {
+
+	// Before the browser has been created, there is no renderer process to ask
+	if ( bw->impl.cef_ptr == 0 ) {
+		bw_BrowserWindowMemoryStats stats;
+		bw_BrowserWindow_getNativeMemoryStats( bw, &stats );
+		callback( bw, user_data, &stats );
+		return;
+	}
+
+	// The renderer process measures itself, and sends its figures back under the ID of the call
+	bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), false, false, 0, 0, user_data };
+	call.memory_stats_callback = callback;
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("get-memory-stats");
+	msg->GetArgumentList()->SetValue( 0, bw::callIdToValue( bw::call_table.store( call ) ) );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, 0 );
+}
+
+BOOL bw_BrowserWindow_getMetricsThreaded( const bw_Application* app, bw_BrowserWindowId id, bw_BrowserWindowMetrics* metrics ) {
+	// The metrics of the invocation queue are read under its own lock
+	return bw::browser_registry.with( app, id, [metrics]( bw_BrowserWindow* bw, CefRefPtr<CefBrowser> ) {
+		bw_BrowserWindow_getMetrics( bw, metrics );
+	} ) ? TRUE : FALSE;
+}
+
+void bw_BrowserWindowImpl_getMetrics( const bw_BrowserWindow* bw, bw_BrowserWindowMetrics* metrics ) {
+	if ( bw->impl.invoke_queue_ptr != 0 )
+		(*(CefRefPtr<bw::InvocationQueue>*)bw->impl.invoke_queue_ptr)->metrics( metrics );
+}
+
+void bw_BrowserWindow_setInvokeQueueLimit( bw_BrowserWindow* bw, size_t limit, bw_BrowserWindowInvokeOverflow policy ) {
+	// The calls don't go through the queue, so the renderer process shouldn't wait for them to be acknowledged either
+	if ( bw->impl.threaded_handler_ptr != 0 )
+		return;
+
+	(*(CefRefPtr<bw::InvocationQueue>*)bw->impl.invoke_queue_ptr)->setLimit( limit, policy );
+}
+
+void bw_BrowserWindowImpl_getMemoryStats( const bw_BrowserWindow* bw, bw_BrowserWindowMemoryStats* stats ) {
+	stats->pending_calls = bw::call_table.count( bw_BrowserWindow_getId( bw ) );
+
+	if ( bw->impl.cef_ptr != 0 ) {
+		CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+
+		CefRefPtr<bw::RequestInterceptor> interceptor = bw::request_interceptors.get( cef_browser->GetIdentifier() );
+		if ( interceptor != nullptr )
+			stats->cached_response_bytes = interceptor->cachedBytes();
+	}
+}
+
+void bw_BrowserWindowImpl_trimMemory( bw_BrowserWindow* bw, bw_ApplicationMemoryPressure level ) {
+	if ( bw->impl.cef_ptr == 0 )
+		return;
+	CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+
+	// Cached responses can always be asked from the handler again
+	CefRefPtr<bw::RequestInterceptor> interceptor = bw::request_interceptors.get( cef_browser->GetIdentifier() );
+	if ( interceptor != nullptr )
+		interceptor->clearCache();
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("trim-memory");
+	msg->GetArgumentList()->SetBool( 0, level >= BW_APPLICATION_MEMORY_PRESSURE_CRITICAL );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, 0 );
 }
 
 BOOL bw_BrowserWindow_getUrl(bw_BrowserWindow* bw, bw_StrSlice* url) {
+
+	// Once the page has reported its url, it is kept up to date by the address change events
+	if ( bw->url.data != 0 ) {
+		*url = bw->url;
+		return FALSE;
+	}
+
 	CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
 
 	CefString _url = cef_browser->GetMainFrame()->GetURL();
@@ -135,15 +528,182 @@ void bw_BrowserWindowImpl_doCleanup( bw_Window* window ) {
 
 	auto bw_ptr = (bw_BrowserWindow*)window->user_data;
 
+	// Waits for other threads that are still using the browser window, after which they won't find it anymore
+	bw::browser_registry.remove( bw_ptr );
+
 	// Remove the link between our bw_BrowserWindow handle and the CefBrowser handle
 	CefRefPtr<CefBrowser>* cef_ptr = (CefRefPtr<CefBrowser>*)bw_ptr->impl.cef_ptr;
 	bw::bw_handle_map.drop( *cef_ptr );
+	bw::request_interceptors.set( (*cef_ptr)->GetIdentifier(), nullptr );
+
+	// The renderer may outlive the window for a bit, but its paint handlers shouldn't be invoked anymore
+	if ( bw_ptr->impl.offscreen_ptr != 0 ) {
+		CefRefPtr<bw::OffscreenRenderer>* renderer = (CefRefPtr<bw::OffscreenRenderer>*)bw_ptr->impl.offscreen_ptr;
+		(*renderer)->setPaintHandler( 0, 0, 0 );
+		(*renderer)->setSharedPaintHandler( 0, 0, 0 );
+		delete renderer;
+		bw_ptr->impl.offscreen_ptr = 0;
+	}
+
+	// Calls that are still waiting for their result would otherwise be invoked with a handle that is no longer valid.
+	// Their callbacks are invoked with an error instead, so that any data that has been given to them can still be released.
+	std::vector<bw::PendingCall> calls = bw::call_table.takeAll( bw_BrowserWindow_getId( bw_ptr ) );
+	for ( auto it = calls.begin(); it != calls.end(); it++ ) {
+		it->fail( BW_BROWSER_WINDOW_JS_ERROR_CANCELLED, "browser window has been closed" );
+	}
+
+	// A resize that is still pending frees itself, once it finds out that the browser window is gone
+	if ( bw_ptr->impl.resize_ptr != 0 ) {
+		bw_BrowserWindowCefResize* resize = (bw_BrowserWindowCefResize*)bw_ptr->impl.resize_ptr;
+		resize->bw = 0;
+		bw_BrowserWindowCef_releaseResize( resize );
+		bw_ptr->impl.resize_ptr = 0;
+	}
+
+	// A dispatch that is still pending keeps the queue alive, but drops its calls
+	CefRefPtr<bw::InvocationQueue>* invoke_queue = (CefRefPtr<bw::InvocationQueue>*)bw_ptr->impl.invoke_queue_ptr;
+	(*invoke_queue)->close();
+	delete invoke_queue;
+	bw_ptr->impl.invoke_queue_ptr = 0;
+
+	delete (CefRefPtr<bw::RegisteredScripts>*)bw_ptr->impl.scripts_ptr;
+	bw_ptr->impl.scripts_ptr = 0;
+
+	// Replies that are still to come are dropped
+	delete (CefRefPtr<bw::NativeRequests>*)bw_ptr->impl.native_requests_ptr;
+	bw_ptr->impl.native_requests_ptr = 0;
+
+	// Data of the page that is still to come is dropped
+	delete (CefRefPtr<bw::StreamReader>*)bw_ptr->impl.stream_reader_ptr;
+	bw_ptr->impl.stream_reader_ptr = 0;
+
+	// Calls that are still running on the worker pool keep the threaded handler alive, but those that haven't started are dropped
+	if ( bw_ptr->impl.threaded_handler_ptr != 0 ) {
+		CefRefPtr<bw::ThreadedHandler>* threaded_handler = (CefRefPtr<bw::ThreadedHandler>*)bw_ptr->impl.threaded_handler_ptr;
+		(*threaded_handler)->close();
+		delete threaded_handler;
+		bw_ptr->impl.threaded_handler_ptr = 0;
+	}
 
 	// Delete the CefBrowser pointer that we have stored in our bw_BrowserWindow handle
 	delete cef_ptr;
 	delete bw_ptr->impl.resource_path;
 }
 
+void bw_BrowserWindow_interceptRequests( bw_BrowserWindow* bw, const bw_BrowserWindowInterceptOptions* options, bw_BrowserWindowRequestHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	CefRefPtr<CefBrowser>* cef_ptr = (CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+
+	CefRefPtr<bw::RequestInterceptor> interceptor;
+	if ( handler != 0 )
+		interceptor = new bw::RequestInterceptor( bw, options, handler, user_data, free_user_data );
+
+	bw::request_interceptors.set( (*cef_ptr)->GetIdentifier(), interceptor );
+}
+
+void bw_BrowserWindow_captureToBuffer( bw_BrowserWindow* bw, bw_BrowserWindowOutputFormat format, bw_BrowserWindowOutputFn callback, void* user_data ) {
+	if ( format == BW_BROWSER_WINDOW_OUTPUT_PDF ) {
+		bw_BrowserWindow_printToPdfBuffer( bw, 0, callback, user_data );
+		return;
+	}
+
+	bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), false, false, 0, 0, user_data };
+	call.output_callback = callback;
+	if ( bw->impl.offscreen_ptr == 0 || format > BW_BROWSER_WINDOW_OUTPUT_PNG ) {
+		call.fail( BW_BROWSER_WINDOW_OUTPUT_ERROR_UNSUPPORTED, "only the views of windowless browser windows can be captured" );
+		return;
+	}
+
+	// The call stays in the call table while it waits for a frame, so that it is cancelled when the browser window gets closed
+	CefRefPtr<bw::OffscreenRenderer> renderer = *(CefRefPtr<bw::OffscreenRenderer>*)bw->impl.offscreen_ptr;
+	renderer->capture( bw::call_table.store( call ), format );
+
+	// Until the browser has been created, its first frame is taken
+	if ( bw->impl.cef_ptr != 0 ) {
+		CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+		cef_browser->GetHost()->Invalidate( PET_VIEW );
+	}
+}
+
+void bw_BrowserWindow_printToPdfBuffer( bw_BrowserWindow* bw, const bw_BrowserWindowPdfOptions* options, bw_BrowserWindowOutputFn callback, void* user_data ) {
+	bw::PendingCall call = { bw->window->app, bw_BrowserWindow_getId( bw ), false, false, 0, 0, user_data };
+	call.output_callback = callback;
+	if ( bw->impl.cef_ptr == 0 ) {
+		call.fail( BW_BROWSER_WINDOW_OUTPUT_ERROR_FAILED, "the page hasn't been loaded yet" );
+		return;
+	}
+
+	CefPdfPrintSettings settings;
+	if ( options != 0 ) {
+		settings.landscape = options->landscape != FALSE;
+		settings.backgrounds_enabled = options->backgrounds != FALSE;
+	}
+
+	uint64_t call_id = bw::call_table.store( call );
+	std::filesystem::path path = bw_BrowserWindowCef_tempPdfPath();
+	CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+	cef_browser->GetHost()->PrintToPDF( path.native(), settings, new bw_BrowserWindowCefPdfCallback( bw->window->app, call_id ) );
+}
+
+std::filesystem::path bw_BrowserWindowCef_tempPdfPath() {
+	static std::atomic<uint32_t> counter( 0 );
+
+	// The clock tells the processes apart, and the counter the prints of this one
+	std::error_code error;
+	std::string name = "bw-print-" + std::to_string( std::chrono::steady_clock::now().time_since_epoch().count() ) + "-" + std::to_string( counter++ ) + ".pdf";
+	return std::filesystem::temp_directory_path( error ) / name;
+}
+
+void bw_BrowserWindow_setPaintHandler( bw_BrowserWindow* bw, bw_BrowserWindowPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	if ( bw->impl.offscreen_ptr == 0 ) {
+		if ( free_user_data != 0 )
+			free_user_data( user_data );
+		return;
+	}
+
+	CefRefPtr<bw::OffscreenRenderer> renderer = *(CefRefPtr<bw::OffscreenRenderer>*)bw->impl.offscreen_ptr;
+	renderer->setPaintHandler( handler, user_data, free_user_data );
+
+	// The new handler hasn't seen anything yet, so it gets a frame of the whole view
+	if ( handler != 0 && bw->impl.cef_ptr != 0 ) {
+		CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+		cef_browser->GetHost()->Invalidate( PET_VIEW );
+	}
+}
+
+void bw_BrowserWindow_setSharedPaintHandler( bw_BrowserWindow* bw, bw_BrowserWindowSharedPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	if ( bw->impl.offscreen_ptr == 0 ) {
+		if ( free_user_data != 0 )
+			free_user_data( user_data );
+		return;
+	}
+
+	CefRefPtr<bw::OffscreenRenderer> renderer = *(CefRefPtr<bw::OffscreenRenderer>*)bw->impl.offscreen_ptr;
+	renderer->setSharedPaintHandler( handler, user_data, free_user_data );
+
+	if ( handler != 0 && bw->impl.cef_ptr != 0 ) {
+		CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+		cef_browser->GetHost()->Invalidate( PET_VIEW );
+	}
+}
+
+void bw_BrowserWindow_setViewSize( bw_BrowserWindow* bw, int width, int height, float scale_factor ) {
+	if ( bw->impl.offscreen_ptr == 0 )
+		return;
+
+	CefRefPtr<bw::OffscreenRenderer> renderer = *(CefRefPtr<bw::OffscreenRenderer>*)bw->impl.offscreen_ptr;
+	std::pair<bool, bool> changed = renderer->setViewSize( width, height, scale_factor );
+
+	// Until the browser has been created, it will pick up the new size by itself
+	if ( bw->impl.cef_ptr == 0 )
+		return;
+
+	CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+	if ( changed.second )
+		cef_browser->GetHost()->NotifyScreenInfoChanged();
+	if ( changed.first || changed.second )
+		cef_browser->GetHost()->WasResized();
+}
+
 bw_Err bw_BrowserWindow_navigate( bw_BrowserWindow* bw, bw_CStrSlice url ) {
 
 	// TODO: Check if bw_CStrSlice can be converted into CefString in one step.
@@ -179,13 +739,49 @@ void bw_BrowserWindowImpl_new(
 		source_string = CefString( data );
 	}
 
-	// Update window size in CefWindowInfo
-	bw_BrowserWindowCef_connectToWindow( browser, info, width, height );
-
 	// Create the browser window handle
 	bw_BrowserWindowImpl bw;
 	bw.cef_ptr = 0;
 	bw.resource_path = 0;
+	bw.scripts_ptr = (void*)new CefRefPtr<bw::RegisteredScripts>( new bw::RegisteredScripts );
+	bw.offscreen_ptr = 0;
+	bw.headless = browser_window_options->windowless && browser_window_options->headless;
+	bw.resize_ptr = 0;
+	bw.invoke_queue_ptr = (void*)new CefRefPtr<bw::InvocationQueue>( new bw::InvocationQueue( browser ) );
+	bw.threaded_handler_ptr = 0;
+	bw.native_requests_ptr = (void*)new CefRefPtr<bw::NativeRequests>( new bw::NativeRequests );
+	bw.stream_reader_ptr = (void*)new CefRefPtr<bw::StreamReader>( new bw::StreamReader );
+	if ( browser_window_options->threaded_handler != 0 ) {
+		CefRefPtr<bw::ThreadedHandler> threaded_handler = new bw::ThreadedHandler(
+			browser,
+			browser_window_options->threaded_handler,
+			browser_window_options->threaded_handler_data,
+			browser_window_options->free_threaded_handler_data
+		);
+		bw.threaded_handler_ptr = (void*)new CefRefPtr<bw::ThreadedHandler>( threaded_handler );
+	}
+
+	CefRefPtr<CefClient> cef_client = *(CefRefPtr<CefClient>*)browser->window->app->engine_impl.cef_client;
+	bool windowless = browser_window_options->windowless != FALSE;
+	if ( windowless ) {
+		// The renderer is given to a client of its own, so that the clients of other browser windows don't need to look it up for every frame
+		CefRefPtr<bw::OffscreenRenderer> renderer = new bw::OffscreenRenderer( browser, width, height );
+		bw.offscreen_ptr = (void*)new CefRefPtr<bw::OffscreenRenderer>( renderer );
+		cef_client = new ClientHandler( browser->window->app, renderer );
+
+		// The window is only used as the parent of dialogs, which GTK windows can't be
+#if defined(BW_WIN32)
+		info.SetAsWindowless( browser->window->impl.handle );
+#else
+		info.SetAsWindowless( kNullWindowHandle );
+#endif
+		info.shared_texture_enabled = browser_window_options->shared_textures != FALSE;
+		settings.windowless_frame_rate = browser_window_options->windowless_frame_rate != 0 ? (int)browser_window_options->windowless_frame_rate : 60;
+	}
+	else {
+		// Update window size in CefWindowInfo
+		bw_BrowserWindowCef_connectToWindow( browser, info, width, height );
+	}
 
 	// Store the resource path if set
 	if ( browser_window_options->resource_path.len != 0 ) {
@@ -194,51 +790,87 @@ void bw_BrowserWindowImpl_new(
 		bw.resource_path[ browser_window_options->resource_path.len ] = '\0';
 	}
 
-	// Create a CefDictionary containing the bw_BrowserWindow pointer to pass along CreateBrowser
+	// Create a CefDictionary containing the id of the bw_BrowserWindow to pass along CreateBrowser.
+	// The renderer process sends it back once the browser has been created, when the browser window may already be gone.
 	CefRefPtr<CefDictionaryValue> dict = CefDictionaryValue::Create();
-	dict->SetBinary( "handle", CefBinaryValue::Create( (const void*)&browser, sizeof(browser) ) );
+	bw_BrowserWindowId id = bw_BrowserWindow_getId( browser );
+	dict->SetBinary( "handle", CefBinaryValue::Create( (const void*)&id, sizeof(id) ) );
 	dict->SetBinary( "callback", CefBinaryValue::Create( (const void*)&callback, sizeof(callback) ) );
 	dict->SetBinary( "callback-data", CefBinaryValue::Create( (const void*)&callback_data, sizeof(callback_data) ) );
 	dict->SetBool( "dev-tools", browser_window_options->dev_tools );
+	dict->SetBool( "structured-handler", browser_window_options->structured_handler != 0 );
+	dict->SetBool( "batched-handler", browser_window_options->batch_handler != 0 );
 	
+	// Without a request context, CEF uses the global one
+	CefRefPtr<CefRequestContext> request_context;
+	if ( browser_window_options->request_context != 0 )
+		request_context = *(CefRefPtr<CefRequestContext>*)browser_window_options->request_context->impl.handle_ptr;
+
+	// The browser window can be found from other threads from now on, so it needs to be complete before the browser gets created
+	browser->impl = bw;
+	bw::browser_registry.add( browser );
+
 	// Create the browser
-	CefRefPtr<CefClient>* cef_client = (CefRefPtr<CefClient>*)browser->window->app->engine_impl.cef_client;
-#ifndef BW_CEF_WINDOW
-	bool success = CefBrowserHost::CreateBrowser( info, *cef_client, source_string, settings, dict, nullptr );
-	BW_ASSERT( success, "CefBrowserHost::CreateBrowser failed!\n" );
-#else
+	_bw_Application_markStartupPhase( browser->window->app, &browser->window->app->startup_metrics.first_browser_requested );
+#ifdef BW_CEF_WINDOW
 	// CefBrowserHoset::CreateBrowser doesn't work well with Cefwindow, so we use the CefBrowserView
-	CefRefPtr<CefBrowserView> browser_view = CefBrowserView::CreateBrowserView( *cef_client, source_string, settings, dict, nullptr, nullptr );
-	CefRefPtr<CefWindow>* window = (CefRefPtr<CefWindow>*)browser->window->impl.handle_ptr;
-	(*window)->AddChildView(browser_view);
+	// Windowless browsers aren't shown in the window at all, so they don't need a view
+	if ( !windowless ) {
+		CefRefPtr<CefBrowserView> browser_view = CefBrowserView::CreateBrowserView( cef_client, source_string, settings, dict, request_context, nullptr );
+		CefRefPtr<CefWindow>* window = (CefRefPtr<CefWindow>*)browser->window->impl.handle_ptr;
+		(*window)->AddChildView(browser_view);
+	}
+	else
 #endif
-
-	browser->impl = bw;
+	{
+		bool success = CefBrowserHost::CreateBrowser( info, cef_client, source_string, settings, dict, request_context );
+		BW_ASSERT( success, "CefBrowserHost::CreateBrowser failed!\n" );
+	}
 }
 
-void bw_BrowserWindowCef_sendJsToRendererProcess(
-	bw_BrowserWindow* bw,
-	CefRefPtr<CefBrowser>& cef_browser,
-	CefString& code,
-	bw_BrowserWindowJsCallbackFn cb,
-	void* user_data
-) {
+uint64_t bw_BrowserWindowCef_sendJsToRendererProcess( bw_BrowserWindow* bw, bw_CStrSlice js, const bw::PendingCall& call ) {
 	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("eval-js");
 	CefRefPtr<CefListValue> args = msg->GetArgumentList();
 
 	// eval-js message arguments
-	args->SetString( 0, code );
-	// Conver the callback data into binary blobs so we can send them to the renderer process
-	CefRefPtr<CefBinaryValue> bw_bin = CefBinaryValue::Create( (const void*)&bw, sizeof( bw ) );
-	args->SetBinary( 1, bw_bin );
-	CefRefPtr<CefBinaryValue> cb_bin = CefBinaryValue::Create( (const void*)&cb, sizeof( cb ) );
-	args->SetBinary( 2, cb_bin );
-	CefRefPtr<CefBinaryValue> user_data_bin = CefBinaryValue::Create( (const void*)&user_data, sizeof( user_data ) );
-	args->SetBinary( 3, user_data_bin );
+	args->SetString( 0, bw_cef_copyFromStrSlice( js ) );
+	// The ID is sent back along with the result, so that the callback can be found again
+	uint64_t call_id = bw::call_table.store( call );
+	args->SetValue( 1, bw::callIdToValue( call_id ) );
+	args->SetBool( 2, call.structured );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, js.len );
+	return call_id;
+}
+
+void bw_BrowserWindowCef_sendToRenderer( bw_BrowserWindow* bw, CefRefPtr<CefProcessMessage> msg, size_t size ) {
+	_bw_Metrics_count( &bw->metrics.messages_sent, 1 );
+	_bw_Metrics_count( &bw->metrics.bytes_sent, size );
+	bw_Trace_instant( "ipc_send" );
 
+	CefRefPtr<CefBrowser> cef_browser = *(CefRefPtr<CefBrowser>*)(bw->impl.cef_ptr);
 	cef_browser->GetMainFrame()->SendProcessMessage( PID_RENDERER, msg );
 }
 
+void bw_BrowserWindowCef_timeoutJs( bw_Application* app, void* data ) {
+	uint64_t* call_id = (uint64_t*)data;
+
+	auto now = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point deadline;
+	std::optional<bw::PendingCall> call = bw::call_table.takeExpired( *call_id, now, deadline );
+
+	if ( call.has_value() )
+		call->fail( BW_BROWSER_WINDOW_JS_ERROR_TIMED_OUT, "evaluation has timed out" );
+	// The timer went off a bit too early
+	else if ( deadline != std::chrono::steady_clock::time_point::max() ) {
+		auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>( deadline - now ).count() + 1;
+		if ( bw_Application_dispatchDelayed( app, bw_BrowserWindowCef_timeoutJs, data, (uint64_t)remaining ) )
+			return;
+	}
+
+	delete call_id;
+}
+
 
 
 void bw_BrowserWindowImpl_onResize( const bw_Window* window, unsigned int width, unsigned int height ) {
@@ -247,13 +879,111 @@ void bw_BrowserWindowImpl_onResize( const bw_Window* window, unsigned int width,
 	// Only do something when our browser window object and the underlying CEF implementation has been created.
 	if ( bw != 0 && bw->impl.cef_ptr != 0 ) {
 
-		CefRefPtr<CefBrowser> cef = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+		if ( bw->impl.resize_ptr == 0 )
+			bw->impl.resize_ptr = (void*)new bw_BrowserWindowCefResize { bw, 0, 0, false, false, std::chrono::steady_clock::time_point() };
+		bw_BrowserWindowCefResize* resize = (bw_BrowserWindowCefResize*)bw->impl.resize_ptr;
+
+		// Only the latest size matters, so it is applied once the current frame is over
+		resize->width = width;
+		resize->height = height;
+		if ( !resize->apply_pending ) {
+			resize->apply_pending = true;
+			bw_Application_dispatchDelayed( bw->window->app, bw_BrowserWindowCef_applyResize, resize, BW_BROWSER_WINDOW_CEF_RESIZE_DELAY );
+		}
+	}
+}
 
-#if defined(BW_WIN32)
-		SetWindowPos( cef->GetHost()->GetWindowHandle(), 0, 0, 0, width, height, SWP_SHOWWINDOW | SWP_NOZORDER | SWP_NOACTIVATE );
-#elif defined(BW_GTK)
-		//Window x_handle = cef->GetHost()->GetWindowHandle();
+void bw_BrowserWindowImpl_onVisibilityChange( const bw_Window* window, uint8_t visibility ) {
+	bw_BrowserWindow* bw = (bw_BrowserWindow*)window->user_data;
+
+	// The visibility is applied once the browser has been created otherwise
+	if ( bw == 0 || bw->impl.cef_ptr == 0 )
+		return;
+	// Headless browser windows render whether their window is shown or not
+	if ( bw->impl.headless )
+		return;
+	CefRefPtr<CefBrowserHost> host = (*(CefRefPtr<CefBrowser>*)(bw->impl.cef_ptr))->GetHost();
+
+	// A hidden browser stops rendering altogether and throttles its timers.
+	// An occluded browser keeps its page state, but skips painting until it is uncovered.
+	switch ( visibility ) {
+	case BW_WINDOW_VISIBILITY_HIDDEN:
+		host->WasOccluded( false );
+		host->WasHidden( true );
+		break;
+	case BW_WINDOW_VISIBILITY_OCCLUDED:
+		host->WasHidden( false );
+		host->WasOccluded( true );
+		break;
+	default:
+		host->WasHidden( false );
+		host->WasOccluded( false );
+		// Hidden windowless browsers don't paint, so make sure a fresh frame is produced right away
+		if ( bw->impl.offscreen_ptr != 0 )
+			host->Invalidate( PET_VIEW );
+	}
+}
+
+void bw_BrowserWindowCef_applyResize( bw_Application* app, void* data ) {
+	bw_BrowserWindowCefResize* resize = (bw_BrowserWindowCefResize*)data;
+	resize->apply_pending = false;
+	if ( bw_BrowserWindowCef_releaseResize( resize ) )
+		return;
 
+	bw_BrowserWindow* bw = resize->bw;
+	CefRefPtr<CefBrowser> cef = *(CefRefPtr<CefBrowser>*)bw->impl.cef_ptr;
+
+	// The view of a windowless browser window follows the size of its window
+	if ( bw->impl.offscreen_ptr != 0 ) {
+		CefRefPtr<bw::OffscreenRenderer> renderer = *(CefRefPtr<bw::OffscreenRenderer>*)bw->impl.offscreen_ptr;
+		renderer->setViewSize( (int)resize->width, (int)resize->height, 0.0f );
+	}
+	else {
+#if defined(BW_WIN32)
+		// Deferring lets Windows move the window together with any other window that is repositioned in the same frame
+		HDWP defer = BeginDeferWindowPos( 1 );
+		if ( defer != 0 ) {
+			defer = DeferWindowPos( defer, cef->GetHost()->GetWindowHandle(), 0, 0, 0, resize->width, resize->height, SWP_SHOWWINDOW | SWP_NOZORDER | SWP_NOACTIVATE );
+			if ( defer != 0 )
+				EndDeferWindowPos( defer );
+		}
+#elif defined(BW_GTK) && defined(CEF_X11)
+		// CEF's child window doesn't follow the size of GTK's window by itself
+		GdkWindow* gdk_window = gtk_widget_get_window( bw->window->impl.handle );
+		XResizeWindow( GDK_WINDOW_XDISPLAY( gdk_window ), cef->GetHost()->GetWindowHandle(), resize->width, resize->height );
 #endif
 	}
+
+	// The page is laid out again at a capped rate, and once more after the resizing has settled
+	auto now = std::chrono::steady_clock::now();
+	auto since_notified = std::chrono::duration_cast<std::chrono::milliseconds>( now - resize->last_notified ).count();
+	if ( since_notified >= BW_BROWSER_WINDOW_CEF_RESIZE_NOTIFY_INTERVAL ) {
+		resize->last_notified = now;
+		cef->GetHost()->WasResized();
+	}
+	else if ( !resize->notify_pending ) {
+		resize->notify_pending = true;
+		bw_Application_dispatchDelayed( app, bw_BrowserWindowCef_notifyResize, resize, (uint64_t)(BW_BROWSER_WINDOW_CEF_RESIZE_NOTIFY_INTERVAL - since_notified) );
+	}
+}
+
+void bw_BrowserWindowCef_notifyResize( bw_Application* app, void* data ) {
+	(void)(app);
+	bw_BrowserWindowCefResize* resize = (bw_BrowserWindowCefResize*)data;
+	resize->notify_pending = false;
+	if ( bw_BrowserWindowCef_releaseResize( resize ) )
+		return;
+
+	CefRefPtr<CefBrowser> cef = *(CefRefPtr<CefBrowser>*)resize->bw->impl.cef_ptr;
+	resize->last_notified = std::chrono::steady_clock::now();
+	cef->GetHost()->WasResized();
+}
+
+bool bw_BrowserWindowCef_releaseResize( bw_BrowserWindowCefResize* resize ) {
+	if ( resize->bw != 0 )
+		return false;
+
+	if ( !resize->apply_pending && !resize->notify_pending )
+		delete resize;
+	return true;
 }
@@ -5,11 +5,29 @@
 extern "C" {
 #endif
 
+#include "../bool.h"
+
 
 
 typedef struct {
 	void* cef_ptr;
 	char* resource_path;
+	// The CefRefPtr<bw::RegisteredScripts> of the scripts registered with bw_BrowserWindow_registerScript
+	void* scripts_ptr;
+	// The CefRefPtr<bw::OffscreenRenderer> of a windowless browser window, or null
+	void* offscreen_ptr;
+	// Whether the windowless browser window keeps rendering while its window is hidden
+	BOOL headless;
+	// The bw_BrowserWindowCefResize that coalesces the resizes of the window, or null until the window gets resized
+	void* resize_ptr;
+	// The CefRefPtr<bw::InvocationQueue> of the calls of invoke_extern that are waiting for the GUI thread
+	void* invoke_queue_ptr;
+	// The CefRefPtr<bw::ThreadedHandler> that runs the calls of invoke_extern on the worker pool, or null
+	void* threaded_handler_ptr;
+	// The CefRefPtr<bw::NativeRequests> of the calls of invoke_native that are waiting for their reply
+	void* native_requests_ptr;
+	// The CefRefPtr<bw::StreamReader> that passes the bytes of write_extern_stream to the handler set with bw_BrowserWindow_setStreamHandler
+	void* stream_reader_ptr;
 } bw_BrowserWindowImpl;
 
 
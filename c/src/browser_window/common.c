@@ -2,15 +2,65 @@
 #include "../common.h"
 
 #include "impl.h"
+#include "pool.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#define BW_BROWSER_WINDOW_JS_QUEUE_DEFAULT_THRESHOLD 65536
+#define BW_BROWSER_WINDOW_STREAM_QUEUE_THRESHOLD 1048576
+
+struct bw_BrowserWindowQueue {
+	bw_BrowserWindow* bw;	// Is set to null when the browser window gets destroyed while a flush is still pending
+	char* data;
+	size_t len;
+	size_t capacity;
+	size_t threshold;
+	BOOL flush_pending;
+};
+
+typedef struct bw_BrowserWindowBatch bw_BrowserWindowBatch;
+
+typedef struct {
+	bw_BrowserWindowBatch* batch;
+	size_t index;	// The index of the spec
+	bw_BrowserWindowCreationCallbackFn callback;
+	void* callback_data;
+} bw_BrowserWindowBatchEntry;
+
+// The browser windows of one call to bw_BrowserWindow_newMany, which is allocated together with its entries and windows.
+struct bw_BrowserWindowBatch {
+	bw_BrowserWindowBatchEntry* entries;
+	bw_BrowserWindow** windows;
+	size_t count;
+	size_t remaining;	// The number of browser windows that haven't been created yet
+	bw_BrowserWindowManyCreationCallbackFn callback;
+	void* callback_data;
+};
 
 
 
 void bw_BrowserWindow_onLoad( bw_Window* w );
 void bw_BrowserWindow_onDestroy( bw_Window* w );
+void bw_BrowserWindow_doCleanup( bw_Window* w );
+void bw_BrowserWindow_flushJsQueue( bw_Application* app, void* data );
+void bw_BrowserWindow_flushStreamQueue( bw_Application* app, void* data );
+void bw_BrowserWindowQueue_append( bw_BrowserWindowQueue* queue, const char* data, size_t len );
+BOOL bw_BrowserWindowQueue_onFlush( bw_BrowserWindowQueue* queue );
+void bw_BrowserWindowQueue_release( bw_BrowserWindowQueue* queue );
+void bw_BrowserWindowQueue_shrink( bw_BrowserWindowQueue* queue );
+void bw_BrowserWindowBatch_onCreated( bw_BrowserWindow* bw, void* data );
+void bw_BrowserWindowBatch_onEmpty( bw_Application* app, void* data );
+void bw_BrowserWindow_storeString( bw_StrSlice* str, bw_CStrSlice value );
 
 
 
+bw_BrowserWindow* bw_Application_findBrowserWindow( const bw_Application* app, bw_BrowserWindowId id ) {
+	return (bw_BrowserWindow*)bw_Slab_get( &app->browser_window_slab, id );
+}
+
 void bw_BrowserWindow_destroy( bw_BrowserWindow* bw ) {
 	bw_Window_destroy( bw->window );
 }
@@ -22,14 +72,173 @@ void bw_BrowserWindow_drop( bw_BrowserWindow* bw ) {
 	bw_Window_drop( bw->window );
 }
 
+void bw_BrowserWindow_doCleanup( bw_Window* window ) {
+	bw_BrowserWindow* bw = (bw_BrowserWindow*)window->user_data;
+
+	// Scripts that are still in the queue won't be executed anymore
+	if ( bw->js_queue != 0 ) {
+		bw_BrowserWindowQueue_release( bw->js_queue );
+		bw->js_queue = 0;
+	}
+	if ( bw->stream_queue != 0 ) {
+		bw_BrowserWindowQueue_release( bw->stream_queue );
+		bw->stream_queue = 0;
+	}
+
+	bw_BrowserWindow_setEventHandler( bw, 0, 0, 0 );
+	free( bw->url.data );
+	free( bw->page_title.data );
+
+	bw_BrowserWindowImpl_doCleanup( window );
+
+	// Anything that still refers to the browser window by its id won't find it anymore
+	bw_Slab_free( &window->app->browser_window_slab, bw );
+}
+
+void bw_BrowserWindow_execJs( bw_BrowserWindow* bw, bw_CStrSlice js ) {
+	bw_BrowserWindowQueue* queue = bw->js_queue;
+
+	if ( queue == 0 ) {
+		bw_BrowserWindowImpl_execJs( bw, js );
+		return;
+	}
+
+	// Isolate every script in its own try block, so that an exception doesn't prevent the other scripts from executing
+	static const char prefix[] = "try{";
+	static const char postfix[] = "\n}catch(e){console.error(e)}\n";
+	bw_BrowserWindowQueue_append( queue, prefix, sizeof( prefix ) - 1 );
+	bw_BrowserWindowQueue_append( queue, js.data, js.len );
+	bw_BrowserWindowQueue_append( queue, postfix, sizeof( postfix ) - 1 );
+
+	if ( queue->len >= queue->threshold )
+		bw_BrowserWindow_flushJs( bw );
+	// Flush on the next iteration of the event loop, but only dispatch once until it did
+	else if ( !queue->flush_pending ) {
+		queue->flush_pending = TRUE;
+		bw_Application_dispatch( bw->window->app, bw_BrowserWindow_flushJsQueue, queue );
+	}
+}
+
+void bw_BrowserWindow_flushJs( bw_BrowserWindow* bw ) {
+	bw_BrowserWindowQueue* queue = bw->js_queue;
+
+	if ( queue == 0 || queue->len == 0 )
+		return;
+
+	bw_CStrSlice script = { queue->len, queue->data };
+	queue->len = 0;
+	bw_BrowserWindowImpl_execJs( bw, script );
+}
+
+void bw_BrowserWindow_flushJsQueue( bw_Application* app, void* data ) {
+	UNUSED( app );
+	bw_BrowserWindowQueue* queue = (bw_BrowserWindowQueue*)data;
+
+	if ( bw_BrowserWindowQueue_onFlush( queue ) )
+		bw_BrowserWindow_flushJs( queue->bw );
+}
+
+void bw_BrowserWindow_flushStream( bw_BrowserWindow* bw ) {
+	bw_BrowserWindowQueue* queue = bw->stream_queue;
+
+	if ( queue == 0 || queue->len == 0 )
+		return;
+
+	size_t len = queue->len;
+	queue->len = 0;
+	bw_BrowserWindowImpl_postStream( bw, (const uint8_t*)queue->data, len );
+}
+
+void bw_BrowserWindow_flushStreamQueue( bw_Application* app, void* data ) {
+	UNUSED( app );
+	bw_BrowserWindowQueue* queue = (bw_BrowserWindowQueue*)data;
+
+	if ( bw_BrowserWindowQueue_onFlush( queue ) )
+		bw_BrowserWindow_flushStream( queue->bw );
+}
+
+void _bw_BrowserWindow_onEvent( bw_BrowserWindow* bw, const bw_BrowserWindowEvent* event ) {
+
+	if ( event->kind == BW_BROWSER_WINDOW_EVENT_URL_CHANGE )
+		bw_BrowserWindow_storeString( &bw->url, event->text );
+	else if ( event->kind == BW_BROWSER_WINDOW_EVENT_TITLE_CHANGE )
+		bw_BrowserWindow_storeString( &bw->page_title, event->text );
+	else if ( event->kind == BW_BROWSER_WINDOW_EVENT_LOAD_END && bw->window->callbacks.on_loaded != 0 )
+		bw->window->callbacks.on_loaded( bw->window );
+
+	if ( bw->event_handler != 0 )
+		bw->event_handler( bw, bw->event_handler_data, event );
+}
+
+// Replaces the string with a copy of `value`.
+void bw_BrowserWindow_storeString( bw_StrSlice* str, bw_CStrSlice value ) {
+
+	// Most events leave the url or title as it was, in which case it doesn't need to be copied again
+	if ( str->data != 0 && str->len == value.len && memcmp( str->data, value.data, value.len ) == 0 )
+		return;
+
+	str->data = (char*)realloc( str->data, value.len + 1 );
+	memcpy( str->data, value.data, value.len );
+	str->data[ value.len ] = '\0';
+	str->len = value.len;
+}
+
 bw_Application* bw_BrowserWindow_getApp( bw_BrowserWindow* bw ) {
 	return bw->window->app;
 }
 
+bw_BrowserWindowId bw_BrowserWindow_getId( const bw_BrowserWindow* bw ) {
+	return bw_Slab_handle( bw );
+}
+
+void bw_BrowserWindow_getPageTitle( const bw_BrowserWindow* bw, bw_CStrSlice* title ) {
+	title->data = bw->page_title.data != 0 ? bw->page_title.data : "";
+	title->len = bw->page_title.len;
+}
+
 void* bw_BrowserWindow_getUserData( bw_BrowserWindow* bw ) {
 	return bw->user_data;
 }
 
+void bw_BrowserWindow_getMetrics( const bw_BrowserWindow* bw, bw_BrowserWindowMetrics* metrics ) {
+	bw_LatencyHistogram_snapshot( &bw->metrics.eval_js, &metrics->eval_js );
+	bw_LatencyHistogram_snapshot( &bw->metrics.eval_js_execution, &metrics->eval_js_execution );
+	bw_LatencyHistogram_snapshot( &bw->metrics.invoke, &metrics->invoke );
+	metrics->messages_sent = _bw_Metrics_read( &bw->metrics.messages_sent );
+	metrics->messages_received = _bw_Metrics_read( &bw->metrics.messages_received );
+	metrics->bytes_sent = _bw_Metrics_read( &bw->metrics.bytes_sent );
+	metrics->bytes_received = _bw_Metrics_read( &bw->metrics.bytes_received );
+	metrics->invocations_dropped = 0;
+	metrics->invoke_queue_depth = 0;
+	metrics->invoke_queue_peak = 0;
+	bw_BrowserWindowImpl_getMetrics( bw, metrics );
+}
+
+void bw_BrowserWindow_getNativeMemoryStats( const bw_BrowserWindow* bw, bw_BrowserWindowMemoryStats* stats ) {
+	memset( stats, 0, sizeof( bw_BrowserWindowMemoryStats ) );
+
+	if ( bw->js_queue != 0 )
+		stats->queued_bytes += sizeof( bw_BrowserWindowQueue ) + bw->js_queue->capacity;
+	if ( bw->stream_queue != 0 )
+		stats->queued_bytes += sizeof( bw_BrowserWindowQueue ) + bw->stream_queue->capacity;
+	bw_BrowserWindowImpl_getMemoryStats( bw, stats );
+}
+
+void bw_BrowserWindow_trimMemory( bw_BrowserWindow* bw, bw_ApplicationMemoryPressure level ) {
+
+	// The buffers are only freed once they are empty, so whatever is buffered is sent right away
+	if ( bw->js_queue != 0 ) {
+		bw_BrowserWindow_flushJs( bw );
+		bw_BrowserWindowQueue_shrink( bw->js_queue );
+	}
+	if ( bw->stream_queue != 0 ) {
+		bw_BrowserWindow_flushStream( bw );
+		bw_BrowserWindowQueue_shrink( bw->stream_queue );
+	}
+
+	bw_BrowserWindowImpl_trimMemory( bw, level );
+}
+
 bw_Window* bw_BrowserWindow_getWindow( bw_BrowserWindow* bw ) {
     return bw->window;
 }
@@ -49,12 +258,117 @@ void bw_BrowserWindow_new(
 ) {
 	bw_Application_assertCorrectThread( app );
 
-	bw_BrowserWindow* browser = (bw_BrowserWindow*)malloc( sizeof( bw_BrowserWindow ) );
+	// Browser windows that have been created in advance only need to load the source
+	if ( bw_BrowserWindowPool_claim( app, parent, source, title, width, height, window_options, browser_window_options, handler, user_data, callback, callback_data ) )
+		return;
+
+	bw_BrowserWindow_create( app, parent, source, title, width, height, window_options, browser_window_options, handler, user_data, callback, callback_data );
+}
+
+void bw_BrowserWindow_newMany(
+	bw_Application* app,
+	const bw_BrowserWindowSpec* specs,
+	size_t count,
+	bw_BrowserWindowManyCreationCallbackFn callback,
+	void* callback_data
+) {
+	bw_Application_assertCorrectThread( app );
+
+	bw_BrowserWindowBatch* batch = (bw_BrowserWindowBatch*)malloc( sizeof( bw_BrowserWindowBatch ) + count * ( sizeof( bw_BrowserWindowBatchEntry ) + sizeof( bw_BrowserWindow* ) ) );
+	batch->entries = (bw_BrowserWindowBatchEntry*)( batch + 1 );
+	batch->windows = (bw_BrowserWindow**)( batch->entries + count );
+	batch->count = count;
+	batch->remaining = count;
+	batch->callback = callback;
+	batch->callback_data = callback_data;
+
+	if ( count == 0 ) {
+		bw_Application_dispatch( app, bw_BrowserWindowBatch_onEmpty, batch );
+		return;
+	}
+
+	// None of the creation callbacks can be invoked before all browser windows have been requested
+	for ( size_t i = 0; i < count; i++ ) {
+		bw_BrowserWindowBatchEntry* entry = &batch->entries[i];
+		entry->batch = batch;
+		entry->index = i;
+		entry->callback = specs[i].callback;
+		entry->callback_data = specs[i].callback_data;
+
+		bw_BrowserWindow_new(
+			app,
+			specs[i].parent,
+			specs[i].source,
+			specs[i].title,
+			specs[i].width,
+			specs[i].height,
+			specs[i].window_options,
+			specs[i].browser_window_options,
+			specs[i].handler,
+			specs[i].user_data,
+			bw_BrowserWindowBatch_onCreated,
+			entry
+		);
+	}
+}
+
+void bw_BrowserWindowBatch_onCreated( bw_BrowserWindow* bw, void* data ) {
+	bw_BrowserWindowBatchEntry* entry = (bw_BrowserWindowBatchEntry*)data;
+	bw_BrowserWindowBatch* batch = entry->batch;
+
+	batch->windows[ entry->index ] = bw;
+	if ( entry->callback != 0 )
+		entry->callback( bw, entry->callback_data );
+
+	batch->remaining -= 1;
+	if ( batch->remaining == 0 ) {
+		batch->callback( batch->windows, batch->count, batch->callback_data );
+		free( batch );
+	}
+}
+
+void bw_BrowserWindowBatch_onEmpty( bw_Application* app, void* data ) {
+	UNUSED( app );
+	bw_BrowserWindowBatch* batch = (bw_BrowserWindowBatch*)data;
+
+	batch->callback( 0, 0, batch->callback_data );
+	free( batch );
+}
+
+void bw_BrowserWindow_create(
+	bw_Application* app,
+	const bw_Window* parent,
+	bw_BrowserWindowSource source,
+	bw_CStrSlice title,
+	int width, int height,
+	const bw_WindowOptions* window_options,
+	const bw_BrowserWindowOptions* browser_window_options,
+	bw_BrowserWindowHandlerFn handler,
+	void* user_data,
+	bw_BrowserWindowCreationCallbackFn callback,
+	void* callback_data
+) {
+	bw_Application_assertCorrectThread( app );
+	bw_Application_startEngine( app );
+
+	bw_BrowserWindow* browser = (bw_BrowserWindow*)bw_Slab_alloc( &app->browser_window_slab );
+	BW_ASSERT( browser != 0, "Too many browser windows" );
 	browser->window = bw_Window_new( app, parent, title, width, height, window_options, browser );
-	browser->window->callbacks.do_cleanup = bw_BrowserWindowImpl_doCleanup;
+	browser->window->callbacks.do_cleanup = bw_BrowserWindow_doCleanup;
 	browser->external_handler = handler;
+	browser->structured_handler = browser_window_options->structured_handler;
+	browser->binary_handler = browser_window_options->binary_handler;
+	browser->native_handler = browser_window_options->native_handler;
+	browser->batch_handler = browser_window_options->batch_handler;
 	browser->user_data = user_data;
-
+	browser->js_queue = 0;
+	browser->stream_queue = 0;
+	browser->event_handler = 0;
+	browser->event_handler_data = 0;
+	browser->free_event_handler_data = 0;
+	memset( &browser->url, 0, sizeof( bw_StrSlice ) );
+	memset( &browser->page_title, 0, sizeof( bw_StrSlice ) );
+	memset( &browser->metrics, 0, sizeof( bw_BrowserWindowMetrics ) );
 
 	bw_BrowserWindowImpl_new(
 		browser,
@@ -69,4 +383,108 @@ void bw_BrowserWindow_new(
 	// bw_BrowserWindowImpl_onResize depends on browser->impl being initialized already.
 	// Therefore we initialize this event after everything
 	browser->window->callbacks.on_resize = bw_BrowserWindowImpl_onResize;
+	browser->window->callbacks.on_visibility_change = bw_BrowserWindowImpl_onVisibilityChange;
+}
+
+void bw_BrowserWindow_setEventHandler( bw_BrowserWindow* bw, bw_BrowserWindowEventHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	bw_ResourceFreeFn free_replaced = bw->free_event_handler_data;
+	void* replaced_data = bw->event_handler_data;
+
+	bw->event_handler = handler;
+	bw->event_handler_data = user_data;
+	bw->free_event_handler_data = free_user_data;
+
+	if ( free_replaced != 0 )
+		free_replaced( replaced_data );
+}
+
+void bw_BrowserWindow_setJsCoalescing( bw_BrowserWindow* bw, BOOL enabled, size_t flush_threshold ) {
+	bw_Application_assertCorrectThread( bw->window->app );
+
+	if ( enabled ) {
+		if ( bw->js_queue == 0 ) {
+			bw->js_queue = (bw_BrowserWindowQueue*)calloc( 1, sizeof( bw_BrowserWindowQueue ) );
+			bw->js_queue->bw = bw;
+		}
+
+		bw->js_queue->threshold = flush_threshold != 0 ? flush_threshold : BW_BROWSER_WINDOW_JS_QUEUE_DEFAULT_THRESHOLD;
+	}
+	else if ( bw->js_queue != 0 ) {
+		bw_BrowserWindow_flushJs( bw );
+
+		bw_BrowserWindowQueue_release( bw->js_queue );
+		bw->js_queue = 0;
+	}
+}
+
+void bw_BrowserWindow_writeStream( bw_BrowserWindow* bw, const uint8_t* data, size_t size ) {
+	bw_Application_assertCorrectThread( bw->window->app );
+
+	if ( bw->stream_queue == 0 ) {
+		bw->stream_queue = (bw_BrowserWindowQueue*)calloc( 1, sizeof( bw_BrowserWindowQueue ) );
+		bw->stream_queue->bw = bw;
+		bw->stream_queue->threshold = BW_BROWSER_WINDOW_STREAM_QUEUE_THRESHOLD;
+	}
+	bw_BrowserWindowQueue* queue = bw->stream_queue;
+
+	bw_BrowserWindowQueue_append( queue, (const char*)data, size );
+
+	if ( queue->len >= queue->threshold )
+		bw_BrowserWindow_flushStream( bw );
+	else if ( !queue->flush_pending ) {
+		queue->flush_pending = TRUE;
+		bw_Application_dispatch( bw->window->app, bw_BrowserWindow_flushStreamQueue, queue );
+	}
+}
+
+void bw_BrowserWindowQueue_append( bw_BrowserWindowQueue* queue, const char* data, size_t len ) {
+
+	if ( queue->len + len > queue->capacity ) {
+		size_t new_capacity = queue->capacity != 0 ? queue->capacity * 2 : 1024;
+		while ( new_capacity < queue->len + len )
+			new_capacity *= 2;
+
+		queue->data = (char*)realloc( queue->data, new_capacity );
+		queue->capacity = new_capacity;
+	}
+
+	memcpy( queue->data + queue->len, data, len );
+	queue->len += len;
+}
+
+// Should be called by the dispatched flush of a queue.
+// Frees the queue and returns FALSE if it has been released in the meantime.
+BOOL bw_BrowserWindowQueue_onFlush( bw_BrowserWindowQueue* queue ) {
+
+	queue->flush_pending = FALSE;
+
+	// The browser window has been destroyed, or coalescing has been disabled in the meantime
+	if ( queue->bw == 0 ) {
+		free( queue->data );
+		free( queue );
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+// Frees the queue, or leaves that to the pending flush if there is one.
+void bw_BrowserWindowQueue_release( bw_BrowserWindowQueue* queue ) {
+
+	if ( queue->flush_pending )
+		queue->bw = 0;
+	else {
+		free( queue->data );
+		free( queue );
+	}
+}
+
+// Frees the buffer of an empty queue, which is allocated again when something is appended.
+void bw_BrowserWindowQueue_shrink( bw_BrowserWindowQueue* queue ) {
+
+	if ( queue->len == 0 ) {
+		free( queue->data );
+		queue->data = 0;
+		queue->capacity = 0;
+	}
 }
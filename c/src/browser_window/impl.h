@@ -9,6 +9,21 @@ extern "C" {
 
 void bw_BrowserWindowImpl_doCleanup( bw_Window* bw );
 
+// Should be implemented by the underlying browser engine to add the memory that it keeps for the browser window to `stats`.
+void bw_BrowserWindowImpl_getMemoryStats( const bw_BrowserWindow* bw, bw_BrowserWindowMemoryStats* stats );
+
+// Should be implemented by the underlying browser engine to fill in the metrics that it keeps for the browser window itself.
+void bw_BrowserWindowImpl_getMetrics( const bw_BrowserWindow* bw, bw_BrowserWindowMetrics* metrics );
+
+// Should be implemented by the underlying browser engine to execute the given JavaScript as-is, without providing a result.
+void bw_BrowserWindowImpl_execJs( bw_BrowserWindow* bw, bw_CStrSlice js );
+
+// Should be implemented by the underlying browser engine to release the memory that it keeps for the browser window, and to let the renderer do the same.
+void bw_BrowserWindowImpl_trimMemory( bw_BrowserWindow* bw, bw_ApplicationMemoryPressure level );
+
+// Should be implemented by the underlying browser engine to pass a part of the binary stream to the page.
+void bw_BrowserWindowImpl_postStream( bw_BrowserWindow* bw, const uint8_t* data, size_t size );
+
 // Should be implemented by the underlying browser engine to create a new browser and invoke the callback.
 void bw_BrowserWindowImpl_new(
 	bw_BrowserWindow* browser,
@@ -20,6 +35,7 @@ void bw_BrowserWindowImpl_new(
 );
 
 void bw_BrowserWindowImpl_onResize( const bw_Window* window, unsigned int width, unsigned int height );
+void bw_BrowserWindowImpl_onVisibilityChange( const bw_Window* window, uint8_t visibility );
 
 
 
@@ -0,0 +1,283 @@
+#include "pool.h"
+
+#include "../common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+// The page that pooled browser windows are created with, which is as cheap to load as a page gets
+#define BW_BROWSER_WINDOW_POOL_URL "about:blank"
+// The size that claimed browser windows get when only one dimension has been given
+#define BW_BROWSER_WINDOW_POOL_DEFAULT_WIDTH 800
+#define BW_BROWSER_WINDOW_POOL_DEFAULT_HEIGHT 600
+
+// Browser windows that have been created in advance, so that opening a browser window doesn't need to wait for a renderer to start up.
+// Pooled browser windows are hidden and don't count as alive, so they don't keep the application from exiting.
+struct bw_BrowserWindowPool {
+	bw_Application* app;	// Is set to null when the pool gets drained while browser windows are still being created
+	unsigned int target;	// The number of browser windows to keep ready
+	unsigned int pending;	// The number of browser windows that are still being created
+	BOOL refill;
+	BOOL refill_pending;
+	bw_WindowOptions window_options;
+	BOOL structured_handler;	// Whether invoke_extern has been set up for a structured handler
+	char* resource_path;
+	size_t resource_path_len;
+	bw_BrowserWindow** ready;	// The browser windows that have been created and can be claimed, the oldest first
+	unsigned int ready_count;
+	unsigned int ready_capacity;
+};
+
+typedef struct {
+	bw_BrowserWindow* bw;
+	bw_BrowserWindowCreationCallbackFn callback;
+	void* callback_data;
+} bw_BrowserWindowPoolClaim;
+
+
+
+BOOL bw_BrowserWindowPool_accepts( const bw_BrowserWindowPool* pool, const bw_WindowOptions* window_options, const bw_BrowserWindowOptions* browser_window_options );
+void bw_BrowserWindowPool_destroyWindow( bw_BrowserWindow* bw );
+void bw_BrowserWindowPool_fill( bw_BrowserWindowPool* pool );
+void bw_BrowserWindowPool_onClaimed( bw_Application* app, void* data );
+void bw_BrowserWindowPool_onCreated( bw_BrowserWindow* bw, void* data );
+void bw_BrowserWindowPool_onInvokeStructured( bw_BrowserWindow* bw, bw_CStrSlice cmd, const bw_JsValue* args, size_t arg_count );
+void bw_BrowserWindowPool_onRefill( bw_Application* app, void* data );
+BOOL bw_BrowserWindowPool_release( bw_BrowserWindowPool* pool );
+
+
+
+void bw_Application_prewarmBrowserWindows( bw_Application* app, unsigned int count, const bw_WindowOptions* window_options, const bw_BrowserWindowOptions* browser_window_options, BOOL refill ) {
+	bw_Application_assertCorrectThread( app );
+
+	// These browser windows would never be taken from the pool
+	if ( browser_window_options->dev_tools || browser_window_options->request_context != 0 || browser_window_options->windowless || browser_window_options->batch_handler != 0 || browser_window_options->threaded_handler != 0 )
+		count = 0;
+
+	// Browser windows that have been created with other options can't be claimed anymore
+	bw_BrowserWindowPool* pool = app->browser_window_pool;
+	if ( pool != 0 && ( count == 0 || !bw_BrowserWindowPool_accepts( pool, window_options, browser_window_options ) ) ) {
+		bw_BrowserWindowPool_drain( app );
+		pool = 0;
+	}
+	if ( count == 0 )
+		return;
+
+	if ( pool == 0 ) {
+		pool = (bw_BrowserWindowPool*)calloc( 1, sizeof( bw_BrowserWindowPool ) );
+		pool->app = app;
+		pool->window_options = *window_options;
+		pool->structured_handler = browser_window_options->structured_handler != 0;
+		if ( browser_window_options->resource_path.len != 0 ) {
+			pool->resource_path = (char*)malloc( browser_window_options->resource_path.len );
+			memcpy( pool->resource_path, browser_window_options->resource_path.data, browser_window_options->resource_path.len );
+			pool->resource_path_len = browser_window_options->resource_path.len;
+		}
+		app->browser_window_pool = pool;
+	}
+	pool->refill = refill;
+
+	// Destroy the browser windows that aren't needed anymore, the oldest first
+	pool->target = count;
+	while ( pool->ready_count > count ) {
+		bw_BrowserWindow* bw = pool->ready[0];
+		pool->ready_count -= 1;
+		memmove( pool->ready, pool->ready + 1, pool->ready_count * sizeof( bw_BrowserWindow* ) );
+		bw_BrowserWindowPool_destroyWindow( bw );
+	}
+
+	bw_BrowserWindowPool_fill( pool );
+}
+
+// Only the options that can't be changed after creation need to be the same.
+// Browser windows with dev tools, a request context of their own, batched or threaded invocations, or without a window are never pooled.
+BOOL bw_BrowserWindowPool_accepts( const bw_BrowserWindowPool* pool, const bw_WindowOptions* window_options, const bw_BrowserWindowOptions* browser_window_options ) {
+	if ( window_options->borders != pool->window_options.borders ||
+		window_options->minimizable != pool->window_options.minimizable ||
+		window_options->resizable != pool->window_options.resizable ||
+		window_options->throttling != pool->window_options.throttling
+	)
+		return FALSE;
+
+	if ( browser_window_options->dev_tools || browser_window_options->request_context != 0 || browser_window_options->windowless )
+		return FALSE;
+	if ( browser_window_options->batch_handler != 0 || browser_window_options->threaded_handler != 0 )
+		return FALSE;
+
+	if ( (browser_window_options->structured_handler != 0) != pool->structured_handler )
+		return FALSE;
+
+	return browser_window_options->resource_path.len == pool->resource_path_len &&
+		( pool->resource_path_len == 0 || memcmp( browser_window_options->resource_path.data, pool->resource_path, pool->resource_path_len ) == 0 );
+}
+
+BOOL bw_BrowserWindowPool_claim(
+	bw_Application* app,
+	const bw_Window* parent,
+	bw_BrowserWindowSource source,
+	bw_CStrSlice title,
+	int width, int height,
+	const bw_WindowOptions* window_options,
+	const bw_BrowserWindowOptions* browser_window_options,
+	bw_BrowserWindowHandlerFn handler,
+	void* user_data,
+	bw_BrowserWindowCreationCallbackFn callback,
+	void* callback_data
+) {
+	bw_BrowserWindowPool* pool = app->browser_window_pool;
+
+	// The parent can't be changed afterwards on all platforms
+	if ( pool == 0 || pool->ready_count == 0 || parent != 0 || !bw_BrowserWindowPool_accepts( pool, window_options, browser_window_options ) )
+		return FALSE;
+
+	// Take the browser window that has been waiting the longest, which is the most likely to have settled down
+	bw_BrowserWindow* bw = pool->ready[0];
+	pool->ready_count -= 1;
+	memmove( pool->ready, pool->ready + 1, pool->ready_count * sizeof( bw_BrowserWindow* ) );
+
+	// It is a real browser window from now on
+	app->windows_alive += 1;
+	bw->external_handler = handler;
+	bw->structured_handler = browser_window_options->structured_handler;
+	bw->binary_handler = browser_window_options->binary_handler;
+	bw->native_handler = browser_window_options->native_handler;
+	bw->batch_handler = browser_window_options->batch_handler;
+	bw->user_data = user_data;
+
+	bw_Window_setTitle( bw->window, title );
+	if ( width != -1 || height != -1 ) {
+		bw_Dims2D dimensions = {
+			(uint16_t)( width < 1 ? BW_BROWSER_WINDOW_POOL_DEFAULT_WIDTH : width ),
+			(uint16_t)( height < 1 ? BW_BROWSER_WINDOW_POOL_DEFAULT_HEIGHT : height )
+		};
+		bw_Window_setWindowDimensions( bw->window, dimensions );
+	}
+
+	// Load the source in the same way as a new browser window would
+	if ( !source.is_html )
+		bw_BrowserWindow_navigate( bw, source.data );
+	else {
+		static const char prefix[] = "data:text/html,";
+		char* url = (char*)malloc( sizeof( prefix ) - 1 + source.data.len );
+		memcpy( url, prefix, sizeof( prefix ) - 1 );
+		memcpy( url + sizeof( prefix ) - 1, source.data.data, source.data.len );
+
+		bw_CStrSlice url_slice = { sizeof( prefix ) - 1 + source.data.len, url };
+		bw_BrowserWindow_navigate( bw, url_slice );
+		free( url );
+	}
+
+	// The creation callback is never invoked from within bw_BrowserWindow_new
+	bw_BrowserWindowPoolClaim* claim = (bw_BrowserWindowPoolClaim*)malloc( sizeof( bw_BrowserWindowPoolClaim ) );
+	claim->bw = bw;
+	claim->callback = callback;
+	claim->callback_data = callback_data;
+	bw_Application_dispatch( app, bw_BrowserWindowPool_onClaimed, claim );
+
+	// Create the replacement when there is nothing else to do, so that it doesn't slow down the browser window that has just been claimed
+	if ( pool->refill && !pool->refill_pending ) {
+		pool->refill_pending = TRUE;
+		bw_Application_dispatchWithPriority( app, bw_BrowserWindowPool_onRefill, pool, BW_APPLICATION_DISPATCH_PRIORITY_IDLE );
+	}
+	return TRUE;
+}
+
+void bw_BrowserWindowPool_destroyWindow( bw_BrowserWindow* bw ) {
+	// Destroying a window decreases the number of windows that are alive, which pooled browser windows aren't part of
+	bw->window->app->windows_alive += 1;
+	bw_BrowserWindow_destroy( bw );
+}
+
+void bw_BrowserWindowPool_drain( bw_Application* app ) {
+	bw_BrowserWindowPool* pool = app->browser_window_pool;
+	if ( pool == 0 )
+		return;
+	app->browser_window_pool = 0;
+
+	for ( unsigned int i = 0; i < pool->ready_count; i++ ) {
+		bw_BrowserWindowPool_destroyWindow( pool->ready[i] );
+	}
+	pool->ready_count = 0;
+
+	pool->app = 0;
+	bw_BrowserWindowPool_release( pool );
+}
+
+void bw_BrowserWindowPool_fill( bw_BrowserWindowPool* pool ) {
+	bw_BrowserWindowOptions options;
+	memset( &options, 0, sizeof( options ) );
+	options.resource_path.data = pool->resource_path;
+	options.resource_path.len = pool->resource_path_len;
+	// The renderer only needs to know whether there is a structured handler, the handler itself is set when the browser window gets claimed
+	if ( pool->structured_handler )
+		options.structured_handler = bw_BrowserWindowPool_onInvokeStructured;
+
+	bw_BrowserWindowSource source = { { sizeof( BW_BROWSER_WINDOW_POOL_URL ) - 1, BW_BROWSER_WINDOW_POOL_URL }, FALSE };
+	bw_CStrSlice title = { 0, "" };
+
+	while ( pool->ready_count + pool->pending < pool->target ) {
+		pool->pending += 1;
+		bw_BrowserWindow_create( pool->app, 0, source, title, -1, -1, &pool->window_options, &options, 0, 0, bw_BrowserWindowPool_onCreated, pool );
+		pool->app->windows_alive -= 1;
+	}
+}
+
+void bw_BrowserWindowPool_onClaimed( bw_Application* app, void* data ) {
+	UNUSED( app );
+	bw_BrowserWindowPoolClaim* claim = (bw_BrowserWindowPoolClaim*)data;
+
+	claim->callback( claim->bw, claim->callback_data );
+	free( claim );
+}
+
+void bw_BrowserWindowPool_onCreated( bw_BrowserWindow* bw, void* data ) {
+	bw_BrowserWindowPool* pool = (bw_BrowserWindowPool*)data;
+	pool->pending -= 1;
+
+	// The pool has been drained or shrunk in the meantime
+	if ( pool->app == 0 || pool->ready_count >= pool->target ) {
+		bw_BrowserWindowPool_destroyWindow( bw );
+		bw_BrowserWindowPool_release( pool );
+		return;
+	}
+
+	if ( pool->ready_count == pool->ready_capacity ) {
+		pool->ready_capacity = pool->ready_capacity != 0 ? pool->ready_capacity * 2 : 4;
+		pool->ready = (bw_BrowserWindow**)realloc( pool->ready, pool->ready_capacity * sizeof( bw_BrowserWindow* ) );
+	}
+	pool->ready[ pool->ready_count ] = bw;
+	pool->ready_count += 1;
+}
+
+// Stands in for the structured handler until the browser window gets claimed, which the blank page never invokes
+void bw_BrowserWindowPool_onInvokeStructured( bw_BrowserWindow* bw, bw_CStrSlice cmd, const bw_JsValue* args, size_t arg_count ) {
+	UNUSED( bw );
+	UNUSED( cmd );
+	UNUSED( args );
+	UNUSED( arg_count );
+}
+
+void bw_BrowserWindowPool_onRefill( bw_Application* app, void* data ) {
+	UNUSED( app );
+	bw_BrowserWindowPool* pool = (bw_BrowserWindowPool*)data;
+	pool->refill_pending = FALSE;
+
+	if ( !bw_BrowserWindowPool_release( pool ) )
+		bw_BrowserWindowPool_fill( pool );
+}
+
+// Frees the pool once it has been drained, and nothing refers to it anymore.
+// Returns whether the pool has been drained.
+BOOL bw_BrowserWindowPool_release( bw_BrowserWindowPool* pool ) {
+	if ( pool->app != 0 )
+		return FALSE;
+
+	if ( pool->pending == 0 && !pool->refill_pending ) {
+		free( pool->resource_path );
+		free( pool->ready );
+		free( pool );
+	}
+	return TRUE;
+}
@@ -0,0 +1,55 @@
+#ifndef BW_BROWSER_WINDOW_POOL_H
+#define BW_BROWSER_WINDOW_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../browser_window.h"
+
+
+
+// Creates a new browser window, without taking one from the pool.
+// Takes the same arguments as `bw_BrowserWindow_new`.
+void bw_BrowserWindow_create(
+	bw_Application* app,
+	const bw_Window* parent,
+	bw_BrowserWindowSource source,
+	bw_CStrSlice title,
+	int width, int height,
+	const bw_WindowOptions* window_options,
+	const bw_BrowserWindowOptions* browser_window_options,
+	bw_BrowserWindowHandlerFn handler,
+	void* user_data,
+	bw_BrowserWindowCreationCallbackFn callback,
+	void* callback_data
+);
+
+// Takes a browser window from the pool of the application, if it has one that has been created with compatible options.
+// The browser window is then set up with the given arguments, and navigated to the source.
+// Returns whether a browser window has been taken, in which case the creation callback will be invoked later on.
+BOOL bw_BrowserWindowPool_claim(
+	bw_Application* app,
+	const bw_Window* parent,
+	bw_BrowserWindowSource source,
+	bw_CStrSlice title,
+	int width, int height,
+	const bw_WindowOptions* window_options,
+	const bw_BrowserWindowOptions* browser_window_options,
+	bw_BrowserWindowHandlerFn handler,
+	void* user_data,
+	bw_BrowserWindowCreationCallbackFn callback,
+	void* callback_data
+);
+
+// Destroys the browser windows that are waiting in the pool of the application, and removes the pool.
+// Browser windows that are still being created are destroyed once they are.
+void bw_BrowserWindowPool_drain( bw_Application* app );
+
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif//BW_BROWSER_WINDOW_POOL_H
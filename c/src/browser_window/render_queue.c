@@ -0,0 +1,307 @@
+#include "../browser_window.h"
+#include "../common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+// The timeout of a job that doesn't specify one, in milliseconds
+#define BW_BROWSER_WINDOW_RENDER_DEFAULT_TIMEOUT 30000
+
+
+
+typedef struct bw_BrowserWindowRenderTask bw_BrowserWindowRenderTask;
+
+struct bw_BrowserWindowRenderQueue {
+	bw_Application* app;
+	unsigned int concurrency;
+	size_t running;	// The number of jobs that have a browser window
+	size_t waiting;
+	BOOL freed;	// Whether the queue is freed as soon as the last running job has finished
+	bw_BrowserWindowOptions options;
+	char* resource_path;
+	bw_RequestContext* request_context;
+	// The jobs that are waiting, the oldest first
+	bw_BrowserWindowRenderTask* first;
+	bw_BrowserWindowRenderTask* last;
+};
+
+struct bw_BrowserWindowRenderTask {
+	bw_BrowserWindowRenderQueue* queue;
+	bw_BrowserWindowRenderJob job;	// The source points to a copy of its own
+	bw_BrowserWindowOutputFn callback;	// Is set to null once it has been invoked
+	void* user_data;
+	bw_BrowserWindowId bw_id;
+	BOOL loaded;
+	BOOL settling;	// Whether the delayed dispatch that waits for the page to settle down is still pending
+	BOOL timing;	// Whether the delayed dispatch of the timeout is still pending
+	BOOL released;	// Whether the browser window is gone, while one of the delayed dispatches was still pending
+	bw_BrowserWindowRenderTask* next;
+};
+
+
+
+void bw_BrowserWindowRenderQueue_cancel( bw_BrowserWindowRenderTask* task );
+// Frees the task once its browser window is gone, unless one of its delayed dispatches is still pending, which frees it instead.
+void bw_BrowserWindowRenderQueue_freeTask( bw_BrowserWindowRenderTask* task );
+void bw_BrowserWindowRenderQueue_onCreated( bw_BrowserWindow* bw, void* data );
+void bw_BrowserWindowRenderQueue_onEvent( bw_BrowserWindow* bw, void* user_data, const bw_BrowserWindowEvent* event );
+void bw_BrowserWindowRenderQueue_onFinished( bw_Application* app, void* data );
+void bw_BrowserWindowRenderQueue_onOutput( bw_BrowserWindow* bw, void* user_data, const uint8_t* data, size_t size, int width, int height, const bw_Err* err );
+void bw_BrowserWindowRenderQueue_onReleased( void* data );
+void bw_BrowserWindowRenderQueue_onRendered( bw_Application* app, void* data );
+void bw_BrowserWindowRenderQueue_onSettled( bw_Application* app, void* data );
+void bw_BrowserWindowRenderQueue_onTimeout( bw_Application* app, void* data );
+void bw_BrowserWindowRenderQueue_release( bw_BrowserWindowRenderQueue* queue );
+void bw_BrowserWindowRenderQueue_render( bw_BrowserWindow* bw, bw_BrowserWindowRenderTask* task );
+void bw_BrowserWindowRenderQueue_run( bw_BrowserWindowRenderQueue* queue );
+
+
+
+bw_BrowserWindowRenderQueue* bw_BrowserWindowRenderQueue_new( bw_Application* app, unsigned int concurrency, const bw_BrowserWindowOptions* options ) {
+	bw_Application_assertCorrectThread( app );
+
+	bw_BrowserWindowRenderQueue* queue = (bw_BrowserWindowRenderQueue*)calloc( 1, sizeof( bw_BrowserWindowRenderQueue ) );
+	queue->app = app;
+	// A queue that never starts a job would never get anything done
+	queue->concurrency = concurrency != 0 ? concurrency : 1;
+
+	queue->options = *options;
+	queue->options.dev_tools = FALSE;
+	queue->options.windowless = TRUE;
+	queue->options.headless = TRUE;
+	// The data of the threaded handler would be freed once for every browser window
+	queue->options.threaded_handler = 0;
+	queue->options.threaded_handler_data = 0;
+	queue->options.free_threaded_handler_data = 0;
+	if ( options->resource_path.len != 0 ) {
+		queue->resource_path = (char*)malloc( options->resource_path.len );
+		memcpy( queue->resource_path, options->resource_path.data, options->resource_path.len );
+	}
+	queue->options.resource_path.data = queue->resource_path;
+	if ( options->request_context != 0 )
+		queue->request_context = bw_RequestContext_copy( options->request_context );
+	queue->options.request_context = queue->request_context;
+
+	return queue;
+}
+
+void bw_BrowserWindowRenderQueue_cancel( bw_BrowserWindowRenderTask* task ) {
+	if ( task->callback == 0 )
+		return;
+
+	bw_Err error = bw_Err_new_with_msg( BW_BROWSER_WINDOW_OUTPUT_ERROR_CANCELLED, "the page has not been rendered" );
+	task->callback( 0, task->user_data, 0, 0, 0, 0, &error );
+	task->callback = 0;
+	bw_Err_free( &error );
+}
+
+void bw_BrowserWindowRenderQueue_free( bw_BrowserWindowRenderQueue* queue ) {
+	bw_Application_assertCorrectThread( queue->app );
+
+	bw_BrowserWindowRenderTask* task = queue->first;
+	queue->first = 0;
+	queue->last = 0;
+	queue->waiting = 0;
+	while ( task != 0 ) {
+		bw_BrowserWindowRenderTask* next = task->next;
+		bw_BrowserWindowRenderQueue_cancel( task );
+		free( (void*)task->job.source.data.data );
+		free( task );
+		task = next;
+	}
+
+	queue->freed = TRUE;
+	if ( queue->running == 0 )
+		bw_BrowserWindowRenderQueue_release( queue );
+}
+
+void bw_BrowserWindowRenderQueue_freeTask( bw_BrowserWindowRenderTask* task ) {
+	if ( !task->released || task->settling || task->timing )
+		return;
+
+	free( (void*)task->job.source.data.data );
+	free( task );
+}
+
+void bw_BrowserWindowRenderQueue_onCreated( bw_BrowserWindow* bw, void* data ) {
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)data;
+
+	// From now on, the task lives until the browser window is gone
+	task->bw_id = bw_BrowserWindow_getId( bw );
+	bw_BrowserWindow_setEventHandler( bw, bw_BrowserWindowRenderQueue_onEvent, task, bw_BrowserWindowRenderQueue_onReleased );
+
+	// A page that never finishes loading would otherwise keep its place in the queue forever
+	unsigned int timeout = task->job.timeout != 0 ? task->job.timeout : BW_BROWSER_WINDOW_RENDER_DEFAULT_TIMEOUT;
+	task->timing = bw_Application_dispatchDelayed( bw->window->app, bw_BrowserWindowRenderQueue_onTimeout, task, timeout );
+}
+
+void bw_BrowserWindowRenderQueue_onEvent( bw_BrowserWindow* bw, void* user_data, const bw_BrowserWindowEvent* event ) {
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)user_data;
+
+	// Only the page itself is rendered, not the pages that its scripts navigate to afterwards
+	if ( event->kind != BW_BROWSER_WINDOW_EVENT_LOAD_END || task->loaded )
+		return;
+	task->loaded = TRUE;
+
+	if ( task->job.settle_time != 0 ) {
+		task->settling = bw_Application_dispatchDelayed( bw->window->app, bw_BrowserWindowRenderQueue_onSettled, task, task->job.settle_time );
+		if ( task->settling )
+			return;
+	}
+	bw_BrowserWindowRenderQueue_render( bw, task );
+}
+
+void bw_BrowserWindowRenderQueue_onFinished( bw_Application* app, void* data ) {
+	UNUSED( app );
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)data;
+	bw_BrowserWindowRenderQueue* queue = task->queue;
+
+	// The browser window may have been destroyed by someone else before its page got rendered
+	bw_BrowserWindowRenderQueue_cancel( task );
+	task->released = TRUE;
+	bw_BrowserWindowRenderQueue_freeTask( task );
+
+	queue->running -= 1;
+	if ( queue->freed ) {
+		if ( queue->running == 0 )
+			bw_BrowserWindowRenderQueue_release( queue );
+	}
+	else
+		bw_BrowserWindowRenderQueue_run( queue );
+}
+
+void bw_BrowserWindowRenderQueue_onOutput( bw_BrowserWindow* bw, void* user_data, const uint8_t* data, size_t size, int width, int height, const bw_Err* err ) {
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)user_data;
+
+	if ( task->callback != 0 ) {
+		task->callback( bw, task->user_data, data, size, width, height, err );
+		task->callback = 0;
+	}
+
+	// A cancelled call means that the browser window is already being destroyed.
+	// Otherwise, it is destroyed after the callback, as its output may have been given from within one of its own calls.
+	if ( err == 0 || err->code != BW_BROWSER_WINDOW_OUTPUT_ERROR_CANCELLED )
+		bw_Application_dispatch( bw->window->app, bw_BrowserWindowRenderQueue_onRendered, task );
+}
+
+void bw_BrowserWindowRenderQueue_onReleased( void* data ) {
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)data;
+
+	// This is invoked while the browser window is being destroyed, so the job is finished once that is done
+	bw_Application_dispatch( task->queue->app, bw_BrowserWindowRenderQueue_onFinished, task );
+}
+
+void bw_BrowserWindowRenderQueue_onRendered( bw_Application* app, void* data ) {
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)data;
+
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, task->bw_id );
+	if ( bw != 0 )
+		bw_BrowserWindow_destroy( bw );
+}
+
+void bw_BrowserWindowRenderQueue_onSettled( bw_Application* app, void* data ) {
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)data;
+	task->settling = FALSE;
+
+	if ( task->released ) {
+		bw_BrowserWindowRenderQueue_freeTask( task );
+		return;
+	}
+
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, task->bw_id );
+	if ( bw != 0 )
+		bw_BrowserWindowRenderQueue_render( bw, task );
+}
+
+void bw_BrowserWindowRenderQueue_onTimeout( bw_Application* app, void* data ) {
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)data;
+	task->timing = FALSE;
+
+	if ( task->released ) {
+		bw_BrowserWindowRenderQueue_freeTask( task );
+		return;
+	}
+	// The output has already been given, and the browser window is on its way out
+	if ( task->callback == 0 )
+		return;
+
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, task->bw_id );
+	bw_Err error = bw_Err_new_with_msg( BW_BROWSER_WINDOW_OUTPUT_ERROR_TIMED_OUT, "the page has not been rendered in time" );
+	task->callback( bw, task->user_data, 0, 0, 0, 0, &error );
+	task->callback = 0;
+	bw_Err_free( &error );
+
+	// A capture or print that is still underway is cancelled, and the job finishes once the browser window is gone
+	bw = bw_Application_findBrowserWindow( app, task->bw_id );
+	if ( bw != 0 )
+		bw_BrowserWindow_destroy( bw );
+}
+
+size_t bw_BrowserWindowRenderQueue_pending( const bw_BrowserWindowRenderQueue* queue, size_t* running ) {
+	if ( running != 0 )
+		*running = queue->running;
+	return queue->waiting;
+}
+
+void bw_BrowserWindowRenderQueue_push( bw_BrowserWindowRenderQueue* queue, const bw_BrowserWindowRenderJob* job, bw_BrowserWindowOutputFn callback, void* user_data ) {
+	bw_Application_assertCorrectThread( queue->app );
+
+	bw_BrowserWindowRenderTask* task = (bw_BrowserWindowRenderTask*)calloc( 1, sizeof( bw_BrowserWindowRenderTask ) );
+	task->queue = queue;
+	task->job = *job;
+	char* source = (char*)malloc( job->source.data.len != 0 ? job->source.data.len : 1 );
+	memcpy( source, job->source.data.data, job->source.data.len );
+	task->job.source.data.data = source;
+	task->callback = callback;
+	task->user_data = user_data;
+
+	if ( queue->last != 0 )
+		queue->last->next = task;
+	else
+		queue->first = task;
+	queue->last = task;
+	queue->waiting += 1;
+
+	bw_BrowserWindowRenderQueue_run( queue );
+}
+
+void bw_BrowserWindowRenderQueue_release( bw_BrowserWindowRenderQueue* queue ) {
+	if ( queue->request_context != 0 )
+		bw_RequestContext_free( queue->request_context );
+	free( queue->resource_path );
+	free( queue );
+}
+
+void bw_BrowserWindowRenderQueue_render( bw_BrowserWindow* bw, bw_BrowserWindowRenderTask* task ) {
+	if ( task->job.format == BW_BROWSER_WINDOW_OUTPUT_PDF )
+		bw_BrowserWindow_printToPdfBuffer( bw, &task->job.pdf_options, bw_BrowserWindowRenderQueue_onOutput, task );
+	else
+		bw_BrowserWindow_captureToBuffer( bw, task->job.format, bw_BrowserWindowRenderQueue_onOutput, task );
+}
+
+void bw_BrowserWindowRenderQueue_run( bw_BrowserWindowRenderQueue* queue ) {
+	// The window is never shown, and is not throttled, so that the browser engine keeps painting into it
+	bw_WindowOptions window_options = { TRUE, TRUE, FALSE, BW_WINDOW_THROTTLE_NEVER };
+	bw_CStrSlice title = { 0, "" };
+
+	while ( queue->running < queue->concurrency && queue->first != 0 ) {
+		bw_BrowserWindowRenderTask* task = queue->first;
+		queue->first = task->next;
+		if ( queue->first == 0 )
+			queue->last = 0;
+		task->next = 0;
+		queue->waiting -= 1;
+		queue->running += 1;
+
+		bw_BrowserWindow_new( queue->app, 0, task->job.source, title, task->job.width, task->job.height, &window_options, &queue->options, 0, 0, bw_BrowserWindowRenderQueue_onCreated, task );
+	}
+}
+
+void bw_BrowserWindowRenderQueue_setConcurrency( bw_BrowserWindowRenderQueue* queue, unsigned int concurrency ) {
+	bw_Application_assertCorrectThread( queue->app );
+
+	queue->concurrency = concurrency != 0 ? concurrency : 1;
+	bw_BrowserWindowRenderQueue_run( queue );
+}
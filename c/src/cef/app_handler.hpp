@@ -4,28 +4,98 @@
 #include "../assert.h"
 #include "../application.h"
 #include "../browser_window.h"
+#include "../resource.h"
 
 #include "external_invocation_handler.hpp"
 #include "v8_to_string.hpp"
+#include "v8_to_value.hpp"
 #include "../cef/bw_handle_map.hpp"
+#include "../cef/process_memory.hpp"
 
 #include <include/cef_app.h>
 #include <include/cef_client.h>
 #include <include/cef_life_span_handler.h>
 #include <include/cef_v8.h>
 
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
 
 
+
+// Frees the memory of ArrayBuffers that are created from binary data received from the browser process.
+class BinaryReleaseCallback : public CefV8ArrayBufferReleaseCallback {
+public:
+	virtual void ReleaseBuffer( void* buffer ) override {
+		free( buffer );
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(BinaryReleaseCallback);
+};
+
 class AppHandler : public CefApp, public CefRenderProcessHandler {
 
+	// A script that has been registered by the browser process, which is compiled for every page that gets loaded
+	struct RegisteredScript {
+		CefString name;
+		CefString source;
+	};
+
 	bw_Application* app;
+	// Only set in the browser process, by the platforms that need it
+	CefRefPtr<CefBrowserProcessHandler> browser_process_handler;
+	// The process model, which the browser process passes on to Chromium as command line switches
+	bool process_per_site;
+	unsigned int renderer_process_limit;
+	uint64_t cache_size_limit;
+	// The registered scripts, and their compiled functions for the page currently loaded in the main frame, by browser id
+	std::map<int, std::map<unsigned int, RegisteredScript>> scripts;
+	std::map<int, std::map<unsigned int, CefRefPtr<CefV8Value>>> compiled_scripts;
+	// The ids of the browsers that have a structured handler for invoke_extern
+	std::set<int> structured_handlers;
+	// The ids of the browsers that have a batch handler for invoke_extern
+	std::set<int> batched_handlers;
+	// The limits of the invocation queues, by browser id
+	std::map<int, bw::InvocationCredits> invocation_credits;
+	// The commands registered for invoke_extern, by browser id
+	std::map<int, bw::RegisteredCommands> commands;
+	// The ids of the browsers of which the browser process reads what the page writes with write_extern_stream
+	std::set<int> stream_readers;
+	// The promises of invoke_native of all pages in this renderer process
+	bw::PendingReplies pending_replies;
 
 public:
-	AppHandler( bw_Application* app ) : app(app) {}
+	AppHandler( bw_Application* app, CefRefPtr<CefBrowserProcessHandler> browser_process_handler = nullptr, const bw_ApplicationSettings* settings = nullptr ) :
+		app(app),
+		browser_process_handler(browser_process_handler),
+		process_per_site( settings != nullptr && settings->process_per_site ),
+		renderer_process_limit( settings != nullptr ? settings->renderer_process_limit : 0 ),
+		cache_size_limit( settings != nullptr ? settings->cache_size_limit : 0 )
+	{}
+
+	virtual void OnBeforeCommandLineProcessing( const CefString& process_type, CefRefPtr<CefCommandLine> command_line ) override {
+
+		// The sub-processes are started with the switches of the browser process already
+		if ( !process_type.empty() )
+			return;
+
+		if ( this->process_per_site )
+			command_line->AppendSwitch( "process-per-site" );
+		if ( this->renderer_process_limit != 0 )
+			command_line->AppendSwitchWithValue( "renderer-process-limit", std::to_string( this->renderer_process_limit ) );
+		if ( this->cache_size_limit != 0 )
+			command_line->AppendSwitchWithValue( "disk-cache-size", std::to_string( this->cache_size_limit ) );
+	}
 
 	virtual void OnBrowserCreated( CefRefPtr<CefBrowser> browser, CefRefPtr<CefDictionaryValue> extra_info ) override {
 
-		// Lets send the handle and callback data back to the browser process, where we can actually use them
+		// Lets send the id and callback data back to the browser process, where we can actually use them
 		auto msg = CefProcessMessage::Create( "on-browser-created" );
 		auto args = msg->GetArgumentList();
 
@@ -35,24 +105,77 @@ public:
 		args->SetBinary( 2, extra_info->GetBinary( "callback-data" ) );
 		args->SetBool( 3, extra_info->GetBool( "dev-tools" ) );
 
-		auto test = extra_info->GetBinary( "handle" );
-		void* ptr = 0;
-		test->GetData( &ptr, sizeof( ptr ), 0 );
+		if ( extra_info->GetBool( "structured-handler" ) )
+			this->structured_handlers.insert( browser->GetIdentifier() );
+		if ( extra_info->GetBool( "batched-handler" ) )
+			this->batched_handlers.insert( browser->GetIdentifier() );
 
 		browser->GetMainFrame()->SendProcessMessage( PID_BROWSER, msg );
 	}
 
+	virtual void OnBrowserDestroyed( CefRefPtr<CefBrowser> browser ) override {
+		this->scripts.erase( browser->GetIdentifier() );
+		this->compiled_scripts.erase( browser->GetIdentifier() );
+		this->structured_handlers.erase( browser->GetIdentifier() );
+		this->batched_handlers.erase( browser->GetIdentifier() );
+		this->invocation_credits.erase( browser->GetIdentifier() );
+		this->commands.erase( browser->GetIdentifier() );
+		this->stream_readers.erase( browser->GetIdentifier() );
+	}
+
 	virtual void OnContextCreated( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, CefRefPtr<CefV8Context> context ) override {
-		// Unused parameters
-		(void)(frame);
 
 		CefRefPtr<CefV8Value> object = context->GetGlobal();
 
-		CefRefPtr<CefV8Handler> handler = new bw::ExternalInvocationHandler( browser );
+		bool structured = this->structured_handlers.count( browser->GetIdentifier() ) > 0;
+		bool batched = this->batched_handlers.count( browser->GetIdentifier() ) > 0;
+		CefRefPtr<CefV8Value> promise_factory;
+		CefRefPtr<CefV8Exception> exception;
+		if ( !context->Eval( bw::PROMISE_FACTORY_JS, CefString( "invoke-native" ), 0, promise_factory, exception ) )
+			fprintf(stderr, "Unable to compile the promise factory of invoke_native: %s\n", exception->GetMessage().ToString().c_str() );
+		CefRefPtr<CefV8Handler> handler = new bw::ExternalInvocationHandler( browser, structured, batched, &this->pending_replies, &this->invocation_credits[ browser->GetIdentifier() ], &this->commands[ browser->GetIdentifier() ], &this->stream_readers, promise_factory );
 		CefRefPtr<CefV8Value> func = CefV8Value::CreateFunction("invoke_extern", handler);
 
 		bool result = object->SetValue( "invoke_extern", func, V8_PROPERTY_ATTRIBUTE_NONE );
 		BW_ASSERT( result, "Unable to set invoke_extern function." );
+
+		CefRefPtr<CefV8Value> binary_func = CefV8Value::CreateFunction("invoke_extern_binary", handler);
+		result = object->SetValue( "invoke_extern_binary", binary_func, V8_PROPERTY_ATTRIBUTE_NONE );
+		BW_ASSERT( result, "Unable to set invoke_extern_binary function." );
+
+		CefRefPtr<CefV8Value> native_func = CefV8Value::CreateFunction("invoke_native", handler);
+		result = object->SetValue( "invoke_native", native_func, V8_PROPERTY_ATTRIBUTE_NONE );
+		BW_ASSERT( result, "Unable to set invoke_native function." );
+
+		CefRefPtr<CefV8Value> stream_func = CefV8Value::CreateFunction("write_extern_stream", handler);
+		result = object->SetValue( "write_extern_stream", stream_func, V8_PROPERTY_ATTRIBUTE_NONE );
+		BW_ASSERT( result, "Unable to set write_extern_stream function." );
+
+		// Registered scripts are compiled again for every new page
+		if ( frame->IsMain() ) {
+			auto scripts = this->scripts.find( browser->GetIdentifier() );
+			if ( scripts != this->scripts.end() ) {
+				for ( auto it = scripts->second.begin(); it != scripts->second.end(); it++ ) {
+					this->compile_script( browser, context, it->first, it->second );
+				}
+			}
+		}
+	}
+
+	virtual void OnContextReleased( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, CefRefPtr<CefV8Context> context ) override {
+		// The compiled functions belong to the page that is being unloaded
+		if ( frame->IsMain() )
+			this->compiled_scripts.erase( browser->GetIdentifier() );
+		this->pending_replies.release( context );
+	}
+
+	virtual void OnRegisterCustomSchemes( CefRawPtr<CefSchemeRegistrar> registrar ) override {
+		// The scheme needs to be registered in every process, so that the renderer processes treat it like a regular web origin
+		registrar->AddCustomScheme( BW_RESOURCE_SCHEME, CEF_SCHEME_OPTION_STANDARD | CEF_SCHEME_OPTION_SECURE | CEF_SCHEME_OPTION_CORS_ENABLED | CEF_SCHEME_OPTION_FETCH_ENABLED );
+	}
+
+	virtual CefRefPtr<CefBrowserProcessHandler> GetBrowserProcessHandler() override {
+		return this->browser_process_handler;
 	}
 
 	virtual CefRefPtr<CefRenderProcessHandler> GetRenderProcessHandler() override {
@@ -77,13 +200,124 @@ public:
 			// Javascript to execute
 			CefString js = msg_args->GetString( 0 );
 
-			// Browser window handle
-			CefRefPtr<CefBinaryValue> bw_bin = msg_args->GetBinary( 1 );
-			CefRefPtr<CefBinaryValue> cb_bin = msg_args->GetBinary( 2 );
-			CefRefPtr<CefBinaryValue> user_data_bin = msg_args->GetBinary( 3 );
+			// The ID of the call in the browser process, which is sent back along with the result as it is
+			CefRefPtr<CefValue> call_id = msg_args->GetValue( 1 );
+			// Whether the result should be sent back as a CefValue, or as a string
+			bool structured = msg_args->GetBool( 2 );
+
+			this->eval_js( browser, frame, js, call_id, structured );
+
+			return true;
+		}
+		// The message to execute multiple scripts at once, and return all their outputs in one message
+		else if ( message->GetName() == "eval-js-batch" ) {
+			auto msg_args = message->GetArgumentList();
+
+			this->eval_js_batch( frame, msg_args->GetList( 0 ), msg_args->GetList( 1 ) );
+
+			return true;
+		}
+		// The message with the registered scripts that will be compiled for every page, from the id in the first argument onwards
+		else if ( message->GetName() == "register-scripts" ) {
+			auto msg_args = message->GetArgumentList();
+
+			std::map<unsigned int, RegisteredScript>& scripts = this->scripts[ browser->GetIdentifier() ];
+			unsigned int first_id = (unsigned int)msg_args->GetInt( 0 );
+			CefRefPtr<CefListValue> names = msg_args->GetList( 1 );
+			CefRefPtr<CefListValue> sources = msg_args->GetList( 2 );
+			CefRefPtr<CefV8Context> context = frame->GetV8Context();
+			for ( size_t i = 0; i < names->GetSize(); i++ ) {
+				unsigned int script_id = first_id + (unsigned int)i;
+
+				// The scripts are sent again on every navigation, but a script never changes under its id
+				if ( scripts.count( script_id ) != 0 )
+					continue;
+				RegisteredScript& script = scripts[ script_id ];
+				script.name = names->GetString( i );
+				script.source = sources->GetString( i );
+
+				// If a page is already loaded, it needs the script right away
+				if ( context != nullptr && context->IsValid() )
+					this->compile_script( browser, context, script_id, script );
+			}
+
+			return true;
+		}
+		// The message with the names of commands that have been registered, from the id in the first argument onwards
+		else if ( message->GetName() == "register-commands" ) {
+			auto msg_args = message->GetArgumentList();
+
+			bw::RegisteredCommands& commands = this->commands[ browser->GetIdentifier() ];
+			unsigned int first_id = (unsigned int)msg_args->GetInt( 0 );
+			CefRefPtr<CefListValue> names = msg_args->GetList( 1 );
+			for ( size_t i = 0; i < names->GetSize(); i++ ) {
+				commands.ids[ names->GetString( i ).ToString() ] = first_id + (unsigned int)i;
+			}
+			commands.count = std::max( commands.count, first_id + (unsigned int)names->GetSize() - 1 );
+
+			return true;
+		}
+		// The message that tells whether the browser process reads the page's writes of write_extern_stream
+		else if ( message->GetName() == "set-stream-reader" ) {
+			if ( message->GetArgumentList()->GetBool( 0 ) )
+				this->stream_readers.insert( browser->GetIdentifier() );
+			else
+				this->stream_readers.erase( browser->GetIdentifier() );
+
+			return true;
+		}
+		// The message to call the function of a registered script
+		else if ( message->GetName() == "invoke-script" ) {
+			this->invoke_script( browser, frame, message->GetArgumentList() );
+
+			return true;
+		}
+		// The message to hand over binary data to the page
+		else if ( message->GetName() == "post-binary" ) {
+			this->post_binary( frame, message->GetArgumentList() );
+
+			return true;
+		}
+		// The message to execute some javascript, without sending back anything
+		else if ( message->GetName() == "exec-js" ) {
+			auto msg_args = message->GetArgumentList();
+
+			this->exec_js( frame, msg_args->GetString( 0 ) );
+
+			return true;
+		}
+		// The message with the reply to a call of invoke_native
+		else if ( message->GetName() == "invoke-reply" ) {
+			auto msg_args = message->GetArgumentList();
+
+			this->pending_replies.settle( (uint32_t)msg_args->GetInt( 0 ), msg_args->GetBool( 1 ), msg_args->GetString( 2 ) );
+
+			return true;
+		}
+		// The message with the limit of the invocation queue, which the calls that have been sent before don't count against
+		else if ( message->GetName() == "set-invoke-limit" ) {
+			bw::InvocationCredits& credits = this->invocation_credits[ browser->GetIdentifier() ];
+			credits.limit = (unsigned int)message->GetArgumentList()->GetInt( 0 );
+			credits.in_flight = 0;
+
+			return true;
+		}
+		// The message with the number of calls of invoke_extern that have left the invocation queue
+		else if ( message->GetName() == "invoke-ack" ) {
+			bw::InvocationCredits& credits = this->invocation_credits[ browser->GetIdentifier() ];
+			credits.in_flight -= std::min( credits.in_flight, (unsigned int)message->GetArgumentList()->GetInt( 0 ) );
 
+			return true;
+		}
+		// The message to release the memory that the page can do without
+		else if ( message->GetName() == "trim-memory" ) {
+			this->trim_memory( frame, message->GetArgumentList()->GetBool( 0 ) );
 
-			this->eval_js( browser, frame, js, bw_bin, cb_bin, user_data_bin );
+			return true;
+		}
+		// The message to measure the memory that this renderer process uses
+		else if ( message->GetName() == "get-memory-stats" ) {
+			this->get_memory_stats( frame, message->GetArgumentList()->GetValue( 0 ) );
 
 			return true;
 		}
@@ -98,18 +332,19 @@ public:
 		CefRefPtr<CefBrowser> browser,
 		CefRefPtr<CefFrame> frame,
 		const CefString& js,
-		CefRefPtr<CefBinaryValue> bw_handle_binary,
-		CefRefPtr<CefBinaryValue> callback_binary,
-		CefRefPtr<CefBinaryValue> user_data_binary
+		CefRefPtr<CefValue> call_id,
+		bool structured
 	) {
 		// Unused parameters
 		(void)(browser);
 
+		auto started_at = std::chrono::steady_clock::now();
 		CefString script_url( "eval" );
 		CefRefPtr<CefV8Value> ret_val;
 		CefRefPtr<CefV8Exception> exception;
 
-		bool result = frame->GetV8Context()->Eval( js, script_url, 0, ret_val, exception );
+		std::vector<CefString::char_type> buffer;
+		bool result = frame->GetV8Context()->Eval( wrap_js( js, buffer ), script_url, 0, ret_val, exception );
 
 		// IPC message to be send to notify browser process of eval result
 		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("eval-js-result");
@@ -122,6 +357,31 @@ public:
 			// The second parameter specifies the error message
 			msg_args->SetString( 1, exception->GetMessage() );
 		}
+		else if ( structured ) {
+
+			// The context needs to be entered for binary data to be converted
+			CefRefPtr<CefV8Context> context = frame->GetV8Context();
+			context->Enter();
+			CefString error;
+			CefRefPtr<CefValue> result_value = V8ToValue::convert( ret_val, error );
+			context->Exit();
+
+			// A result that can't be converted, like a cyclic structure, is reported like an exception
+			if ( !error.empty() ) {
+				msg_args->SetBool( 0, false );
+				msg_args->SetString( 1, error );
+			}
+			else {
+				// The first parameter specifies whether or not an error has resulted
+				msg_args->SetBool( 0, true );
+				// The second parameter specifies the result as a CefValue, or null if it is undefined
+				if ( result_value != nullptr )
+					msg_args->SetValue( 1, result_value );
+				else
+					msg_args->SetNull( 1 );
+				msg_args->SetBool( 3, result_value == nullptr );
+			}
+		}
 		else {
 
 			CefString result_string = V8ToString::convert( ret_val );
@@ -132,16 +392,242 @@ public:
 			msg_args->SetString( 1, result_string );
 		}
 
-		// Send along the binaries of the callback data
-		msg_args->SetBinary( 2, bw_handle_binary );
-		msg_args->SetBinary( 3, callback_binary );
-		msg_args->SetBinary( 4, user_data_binary );
+		// The browser process looks up the callback by this ID
+		msg_args->SetValue( 2, call_id );
+		// The number of microseconds spent on the evaluation and the conversion of its result, for the metrics of the browser window
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - started_at ).count();
+		msg_args->SetInt( 4, (int)std::min<long long>( elapsed, INT_MAX ) );
 
 		// Send the message back to the browser process
 		frame->SendProcessMessage( PID_BROWSER, msg );
 	}
 
+	// Execute JavaScript without converting its result, and without replying to the main process
+	void exec_js( CefRefPtr<CefFrame> frame, const CefString& js ) {
+		CefString script_url( "exec" );
+		CefRefPtr<CefV8Value> ret_val;
+		CefRefPtr<CefV8Exception> exception;
+
+		if ( !frame->GetV8Context()->Eval( js, script_url, 0, ret_val, exception ) )
+			fprintf(stderr, "Uncaught exception in executed javascript: %s\n", exception->GetMessage().ToString().c_str() );
+	}
+
+	// Call the compiled function of a registered script, and send back its result if the main process asked for it
+	void invoke_script( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, CefRefPtr<CefListValue> msg_args ) {
+		unsigned int script_id = (unsigned int)msg_args->GetInt( 0 );
+		CefRefPtr<CefListValue> arg_list = msg_args->GetList( 1 );
+		bool reply = msg_args->GetBool( 2 );
+
+		CefRefPtr<CefV8Value> func;
+		auto compiled = this->compiled_scripts.find( browser->GetIdentifier() );
+		if ( compiled != this->compiled_scripts.end() ) {
+			auto it = compiled->second.find( script_id );
+			if ( it != compiled->second.end() )
+				func = it->second;
+		}
+
+		bool success = false;
+		CefString result;
+		if ( func == nullptr )
+			result = "script " + std::to_string( script_id ) + " is not available on this page";
+		else {
+			CefRefPtr<CefV8Context> context = frame->GetV8Context();
+			context->Enter();
+
+			CefV8ValueList args;
+			for ( size_t i = 0; i < arg_list->GetSize(); i++ ) {
+				args.push_back( CefV8Value::CreateString( arg_list->GetString( i ) ) );
+			}
+
+			CefRefPtr<CefV8Value> ret_val = func->ExecuteFunction( nullptr, args );
+			if ( ret_val != nullptr ) {
+				success = true;
+				if ( reply )
+					result = V8ToString::convert( ret_val );
+			}
+			else if ( func->HasException() ) {
+				result = func->GetException()->GetMessage();
+				func->ClearException();
+			}
+
+			context->Exit();
+		}
+
+		if ( !reply ) {
+			if ( !success )
+				fprintf(stderr, "Unable to invoke script: %s\n", result.ToString().c_str() );
+			return;
+		}
+
+		// The result is sent back just like the result of eval-js
+		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("eval-js-result");
+		CefRefPtr<CefListValue> reply_args = msg->GetArgumentList();
+		reply_args->SetBool( 0, success );
+		reply_args->SetString( 1, result );
+		reply_args->SetValue( 2, msg_args->GetValue( 3 ) );
+
+		frame->SendProcessMessage( PID_BROWSER, msg );
+	}
+
+	// Pass the binary data to the page's on_extern_binary or on_extern_stream function as an ArrayBuffer
+	void post_binary( CefRefPtr<CefFrame> frame, CefRefPtr<CefListValue> msg_args ) {
+		CefRefPtr<CefV8Context> context = frame->GetV8Context();
+		if ( context == nullptr || !context->IsValid() )
+			return;
+
+		context->Enter();
+
+		const char* func_name = msg_args->GetBool( 1 ) ? "on_extern_stream" : "on_extern_binary";
+		CefRefPtr<CefV8Value> func = context->GetGlobal()->GetValue( func_name );
+		if ( func != nullptr && func->IsFunction() ) {
+
+			// The data is copied once out of the message, and the ArrayBuffer takes ownership of that copy.
+			// Empty data isn't sent along, but a buffer is allocated anyway so that it can be freed like any other.
+			size_t size = 0;
+			if ( msg_args->GetType( 0 ) == VTYPE_BINARY )
+				size = msg_args->GetBinary( 0 )->GetSize();
+			void* data = malloc( size > 0 ? size : 1 );
+			if ( size > 0 )
+				msg_args->GetBinary( 0 )->GetData( data, size, 0 );
+
+			CefV8ValueList args;
+			args.push_back( CefV8Value::CreateArrayBuffer( data, size, new BinaryReleaseCallback ) );
+			func->ExecuteFunction( nullptr, args );
+			if ( func->HasException() ) {
+				fprintf(stderr, "Uncaught exception in %s: %s\n", func_name, func->GetException()->GetMessage().ToString().c_str() );
+				func->ClearException();
+			}
+		}
+
+		context->Exit();
+	}
+
+	// Evaluate a list of scripts within one context scope, and send back one message to the main process with all results
+	void eval_js_batch(
+		CefRefPtr<CefFrame> frame,
+		CefRefPtr<CefListValue> scripts,
+		CefRefPtr<CefListValue> call_ids
+	) {
+		CefString script_url( "eval" );
+		CefRefPtr<CefV8Context> context = frame->GetV8Context();
+
+		// The results are stored as pairs of a success flag and the result or error message
+		size_t count = scripts->GetSize();
+		std::vector<CefString::char_type> buffer;
+		CefRefPtr<CefListValue> results = CefListValue::Create();
+		results->SetSize( count * 2 );
+
+		context->Enter();
+		for ( size_t i = 0; i < count; i++ ) {
+			CefRefPtr<CefV8Value> ret_val;
+			CefRefPtr<CefV8Exception> exception;
+
+			bool result = context->Eval( wrap_js( scripts->GetString( i ), buffer ), script_url, 0, ret_val, exception );
+
+			results->SetBool( i * 2, result );
+			if ( result )
+				results->SetString( i * 2 + 1, V8ToString::convert( ret_val ) );
+			else
+				results->SetString( i * 2 + 1, exception->GetMessage() );
+		}
+		context->Exit();
+
+		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("eval-js-batch-result");
+		CefRefPtr<CefListValue> msg_args = msg->GetArgumentList();
+		msg_args->SetList( 0, results );
+		msg_args->SetList( 1, call_ids );
+
+		frame->SendProcessMessage( PID_BROWSER, msg );
+	}
+
+	// Let the page release what it can do without, and collect its garbage if the page is allowed to
+	void trim_memory( CefRefPtr<CefFrame> frame, bool critical ) {
+		CefRefPtr<CefV8Context> context = frame->GetV8Context();
+		if ( context == nullptr || !context->IsValid() )
+			return;
+
+		context->Enter();
+		CefRefPtr<CefV8Value> global = context->GetGlobal();
+
+		// The page gets the chance to drop its own caches first, so that they can be collected right after
+		CefRefPtr<CefV8Value> handler = global->GetValue( "on_memory_pressure" );
+		if ( handler != nullptr && handler->IsFunction() ) {
+			CefV8ValueList args;
+			args.push_back( CefV8Value::CreateString( critical ? "critical" : "moderate" ) );
+			handler->ExecuteFunction( nullptr, args );
+			if ( handler->HasException() ) {
+				fprintf(stderr, "Uncaught exception in on_memory_pressure: %s\n", handler->GetException()->GetMessage().ToString().c_str() );
+				handler->ClearException();
+			}
+		}
+
+		// V8 only exposes its garbage collector when it runs with --expose-gc
+		CefRefPtr<CefV8Value> gc = global->GetValue( "gc" );
+		if ( gc != nullptr && gc->IsFunction() )
+			gc->ExecuteFunction( nullptr, CefV8ValueList() );
+
+		context->Exit();
+	}
+
+	// Measure the private memory of this process and the JavaScript heap of the page, and send them back to the main process
+	void get_memory_stats( CefRefPtr<CefFrame> frame, CefRefPtr<CefValue> call_id ) {
+		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("memory-stats-result");
+		CefRefPtr<CefListValue> msg_args = msg->GetArgumentList();
+
+		// The sizes are sent as doubles, because CEF has no 64-bit integers
+		msg_args->SetValue( 0, call_id );
+		msg_args->SetDouble( 1, (double)bw_cef_privateBytes() );
+		for ( int i = 0; i < 3; i++ ) {
+			msg_args->SetDouble( 2 + i, 0.0 );
+		}
+
+		// V8 doesn't expose its heap statistics through CEF, but Chromium does through performance.memory
+		CefRefPtr<CefV8Context> context = frame->GetV8Context();
+		if ( context != nullptr && context->IsValid() ) {
+			CefString script_url( "memory-stats" );
+			CefRefPtr<CefV8Value> ret_val;
+			CefRefPtr<CefV8Exception> exception;
+
+			const char* js = "performance.memory ? [performance.memory.usedJSHeapSize, performance.memory.totalJSHeapSize, performance.memory.jsHeapSizeLimit] : null";
+			if ( context->Eval( js, script_url, 0, ret_val, exception ) && ret_val->IsArray() ) {
+				for ( int i = 0; i < 3; i++ ) {
+					msg_args->SetDouble( 2 + i, ret_val->GetValue( i )->GetDoubleValue() );
+				}
+			}
+		}
+
+		frame->SendProcessMessage( PID_BROWSER, msg );
+	}
+
 protected:
+	// Evaluates the source of a registered script, and keeps the resulting function for the current page
+	void compile_script( CefRefPtr<CefBrowser> browser, CefRefPtr<CefV8Context> context, unsigned int script_id, const RegisteredScript& script ) {
+		CefRefPtr<CefV8Value> func;
+		CefRefPtr<CefV8Exception> exception;
+
+		if ( !context->Eval( script.source, script.name, 0, func, exception ) )
+			fprintf(stderr, "Unable to compile script %s: %s\n", script.name.ToString().c_str(), exception->GetMessage().ToString().c_str() );
+		else if ( !func->IsFunction() )
+			fprintf(stderr, "Script %s doesn't evaluate to a function\n", script.name.ToString().c_str() );
+		else
+			this->compiled_scripts[ browser->GetIdentifier() ][ script_id ] = func;
+	}
+
+	// Wraps the code inside a function, so that statements can be evaluated as an expression.
+	// The wrapped code is written into `buffer` in one go, and the returned string refers to it without owning it.
+	static CefString wrap_js( const CefString& js, std::vector<CefString::char_type>& buffer ) {
+		static const char prefix[] = "(function () { return ";
+		static const char suffix[] = "; })()";
+
+		buffer.clear();
+		buffer.reserve( sizeof( prefix ) - 1 + js.length() + sizeof( suffix ) - 1 );
+		buffer.insert( buffer.end(), prefix, prefix + sizeof( prefix ) - 1 );
+		buffer.insert( buffer.end(), js.c_str(), js.c_str() + js.length() );
+		buffer.insert( buffer.end(), suffix, suffix + sizeof( suffix ) - 1 );
+
+		return CefString( buffer.data(), buffer.size(), false );
+	}
+
 	IMPLEMENT_REFCOUNTING(AppHandler);
 };
 
@@ -0,0 +1,5 @@
+#include "browser_registry.hpp"
+
+
+
+bw::BrowserRegistry bw::browser_registry;
@@ -0,0 +1,79 @@
+#ifndef BW_CEF_BROWSER_REGISTRY_HPP
+#define BW_CEF_BROWSER_REGISTRY_HPP
+
+#include "../browser_window.h"
+
+#include <include/cef_browser.h>
+#include <map>
+#include <mutex>
+#include <utility>
+
+
+
+namespace bw {
+
+	// A thread safe registry of the browser windows that exist, by their application and id.
+	// bw_Application_findBrowserWindow can be called from any thread, but the browser window it returns can be cleaned up by the GUI thread at any moment.
+	// Functions that can be called from any thread therefore only use a browser window within `with`, which holds the lock of the registry.
+	// The GUI thread removes a browser window under that same lock before it cleans it up, so it waits for whoever is still using it.
+	class BrowserRegistry {
+
+		struct Entry {
+			bw_BrowserWindow* bw;
+			// Null until the browser has been created
+			CefRefPtr<CefBrowser> browser;
+		};
+
+		std::map<std::pair<const bw_Application*, bw_BrowserWindowId>, Entry> entries;
+		std::mutex mutex;
+
+	public:
+		BrowserRegistry() {}
+
+		// Adds a browser window of which the browser hasn't been created yet.
+		void add( bw_BrowserWindow* bw ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			this->entries[ { bw->window->app, bw_BrowserWindow_getId( bw ) } ] = Entry { bw, nullptr };
+		}
+
+		// Removes the browser window, after which `with` won't find it anymore.
+		// Should be called on the GUI thread before anything of the browser window gets freed.
+		void remove( const bw_BrowserWindow* bw ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			this->entries.erase( { bw->window->app, bw_BrowserWindow_getId( bw ) } );
+		}
+
+		// Stores the browser that has been created for the browser window, if the browser window still exists.
+		void setBrowser( const bw_Application* app, bw_BrowserWindowId id, CefRefPtr<CefBrowser> browser ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			auto it = this->entries.find( { app, id } );
+			if ( it != this->entries.end() )
+				it->second.browser = browser;
+		}
+
+		// Invokes `func` with the browser window and its browser, which is null if it hasn't been created yet, while holding the lock.
+		// The browser window can't be cleaned up until `func` returns, so `func` shouldn't take long, nor wait for the GUI thread.
+		// Returns false without invoking `func` if the browser window doesn't exist (anymore).
+		template <typename F>
+		bool with( const bw_Application* app, bw_BrowserWindowId id, F func ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			auto it = this->entries.find( { app, id } );
+			if ( it == this->entries.end() )
+				return false;
+
+			func( it->second.bw, it->second.browser );
+			return true;
+		}
+	};
+
+	// A global instance
+	extern BrowserRegistry browser_registry;
+}
+
+
+
+#endif//BW_CEF_BROWSER_REGISTRY_HPP
@@ -4,9 +4,10 @@
 #include "../browser_window.h"
 
 #include <include/cef_browser.h>
-#include <optional>
-#include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <vector>
 
 
 
@@ -14,44 +15,118 @@ namespace bw {
 
 	// A thread safe class that links CEF browser handles to our browser window handdles.
 	// This makes it possible to get a bw_BrowserWindow* from a CefRefPtr<CefBrowser>, from any thread.
+	//
+	// The map is consulted for almost every message that comes from a renderer process, while links are only stored and dropped when browser windows come and go.
+	// So the links are kept in an immutable snapshot that is replaced as a whole whenever a link changes, and readers search it without holding any lock.
+	// This is not lock-free: std::atomic_load and std::atomic_store on a shared_ptr lock one of a small pool of mutexes while they copy the pointer.
+	// But that lock is only held for a reference count, so readers never wait for a writer to copy or build a table.
 	class BwHandleMap {
-		// The CefBrowser's GetIdentifier output is used as the key to identify CEF browser handles
-		std::map<int, bw_BrowserWindow*> map;
-		std::mutex mutex;
+
+		// A flat open-addressed table, of which the capacity is a power of two.
+		// Empty slots have a null handle.
+		struct Table {
+			struct Entry {
+				int id;
+				bw_BrowserWindow* handle;
+			};
+
+			std::vector<Entry> entries;
+			size_t count;
+
+			// Builds a table that can hold `count` links while staying at most half full.
+			Table( size_t count ) : count(0) {
+				size_t capacity = 8;
+				while ( capacity < count * 2 )
+					capacity *= 2;
+				this->entries.resize( capacity, Entry { 0, nullptr } );
+			}
+
+			// CEF hands out browser identifiers incrementally, so the lower bits alone already spread them out evenly.
+			size_t slot( int id ) const {
+				return (size_t)(unsigned int)id & (this->entries.size() - 1);
+			}
+
+			bw_BrowserWindow* find( int id ) const {
+				for ( size_t i = this->slot( id ); this->entries[i].handle != nullptr; i = (i + 1) & (this->entries.size() - 1) ) {
+					if ( this->entries[i].id == id )
+						return this->entries[i].handle;
+				}
+				return nullptr;
+			}
+
+			void insert( int id, bw_BrowserWindow* handle ) {
+				size_t i = this->slot( id );
+				while ( this->entries[i].handle != nullptr && this->entries[i].id != id ) {
+					i = (i + 1) & (this->entries.size() - 1);
+				}
+
+				if ( this->entries[i].handle == nullptr )
+					this->count += 1;
+				this->entries[i] = Entry { id, handle };
+			}
+		};
+
+		// The current snapshot, which is only ever accessed with std::atomic_load and std::atomic_store, which briefly lock a mutex of the standard library.
+		std::shared_ptr<const Table> table;
+		// Serializes the writers, which copy the snapshot before they modify it.
+		std::mutex write_mutex;
+
+		// Builds a new snapshot with all links of the current one, except for the one of `skip_id`.
+		std::shared_ptr<Table> copyTable( size_t extra, int skip_id ) {
+			std::shared_ptr<const Table> current = std::atomic_load( &this->table );
+
+			auto copy = std::make_shared<Table>( current->count + extra );
+			for ( auto it = current->entries.begin(); it != current->entries.end(); it++ ) {
+				if ( it->handle != nullptr && it->id != skip_id )
+					copy->insert( it->id, it->handle );
+			}
+			return copy;
+		}
 
 	public:
 		// The only constructor is the default constructor
-		BwHandleMap() {}
+		BwHandleMap() : table( std::make_shared<const Table>( 0 ) ) {}
 
 		// Remove a link
 		void drop( CefRefPtr<CefBrowser> cef_handle ) {
-			this->mutex.lock();
-				this->map.erase( cef_handle->GetIdentifier() );
-			this->mutex.unlock();
+			std::lock_guard<std::mutex> lock( this->write_mutex );
+
+			std::shared_ptr<const Table> table = this->copyTable( 0, cef_handle->GetIdentifier() );
+			std::atomic_store( &this->table, table );
 		}
 
 		// Stores a link
 		void store( CefRefPtr<CefBrowser> cef_handle, bw_BrowserWindow* our_handle ) {
-			this->mutex.lock();
-				this->map[ cef_handle->GetIdentifier() ] = our_handle;
-			this->mutex.unlock();
+			std::lock_guard<std::mutex> lock( this->write_mutex );
+
+			int id = cef_handle->GetIdentifier();
+			std::shared_ptr<Table> table = this->copyTable( 1, id );
+			table->insert( id, our_handle );
+			std::atomic_store( &this->table, std::shared_ptr<const Table>( table ) );
 		}
 
 		// Fetches a bw_BrowserWindow handle from a cef handle.
 		// Returns an optional bw_BrowserWindow pointer.
 		std::optional<bw_BrowserWindow*> fetch( CefRefPtr<CefBrowser> cef_handle ) {
-			this->mutex.lock();
-				auto it = this->map.find( cef_handle->GetIdentifier() );
+			std::shared_ptr<const Table> table = std::atomic_load( &this->table );
 
-				// If not found return nothing
-				if ( it == this->map.end() )
-					return std::optional<bw_BrowserWindow*>();
+			bw_BrowserWindow* handle = table->find( cef_handle->GetIdentifier() );
+			if ( handle == nullptr )
+				return std::optional<bw_BrowserWindow*>();
+
+			return std::optional<bw_BrowserWindow*>( handle );
+		}
 
-				// If found:
-				std::optional<bw_BrowserWindow*> result( (*it).second );
-			this->mutex.unlock();
+		// Returns the handles of all browser windows that are linked at the moment.
+		std::vector<bw_BrowserWindow*> all() {
+			std::shared_ptr<const Table> table = std::atomic_load( &this->table );
 
-			return result;
+			std::vector<bw_BrowserWindow*> handles; handles.reserve( table->count );
+			for ( auto it = table->entries.begin(); it != table->entries.end(); it++ ) {
+				if ( it->handle != nullptr )
+					handles.push_back( it->handle );
+			}
+			return handles;
 		}
 	};
 
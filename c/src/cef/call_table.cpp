@@ -0,0 +1,101 @@
+#include "call_table.hpp"
+
+#include "../err.h"
+
+#include <cstring>
+
+
+
+bw::CallTable bw::call_table;
+
+
+
+static void bw_cef_deliverOutput( bw_Application* app, void* data ) {
+	(void)(app);
+	bw::PendingOutput* output = (bw::PendingOutput*)data;
+
+	std::optional<bw::PendingCall> call = bw::call_table.take( output->call_id );
+	if ( call.has_value() ) {
+		bw_BrowserWindow* bw = call->window();
+		if ( bw == nullptr )
+			call->fail( BW_BROWSER_WINDOW_OUTPUT_ERROR_CANCELLED, "browser window has been closed" );
+		else if ( output->success )
+			call->output_callback( bw, call->user_data, output->data.data(), output->data.size(), output->width, output->height, 0 );
+		else
+			call->fail( BW_BROWSER_WINDOW_OUTPUT_ERROR_FAILED, "the browser engine was unable to render the output" );
+	}
+
+	delete output;
+}
+
+void bw::dispatchOutput( bw_Application* app, PendingOutput* output ) {
+	if ( !bw_Application_dispatch( app, bw_cef_deliverOutput, output ) )
+		delete output;
+}
+
+CefRefPtr<CefValue> bw::callIdToValue( uint64_t id ) {
+	// Both processes run on the same machine, so the byte order is the same
+	CefRefPtr<CefValue> value = CefValue::Create();
+	value->SetBinary( CefBinaryValue::Create( &id, sizeof( id ) ) );
+	return value;
+}
+
+uint64_t bw::callIdFromValue( CefRefPtr<CefValue> value ) {
+	if ( value == nullptr || value->GetType() != VTYPE_BINARY )
+		return 0;
+
+	CefRefPtr<CefBinaryValue> binary = value->GetBinary();
+	uint64_t id = 0;
+	if ( binary->GetSize() != sizeof( id ) )
+		return 0;
+	binary->GetData( &id, sizeof( id ), 0 );
+	return id;
+}
+
+
+
+void bw::PendingCall::complete( bool success, const std::string& result, const bw_JsValue* value ) const {
+	bw_BrowserWindow* bw = this->window();
+
+	// The result can still arrive after the browser window has been closed
+	if ( bw == nullptr )
+		this->fail( BW_BROWSER_WINDOW_JS_ERROR_CANCELLED, "browser window has been closed" );
+	else if ( success ) {
+		// The callback of a threaded call doesn't run on the GUI thread, where the browser window could be used
+		if ( this->threaded )
+			bw = nullptr;
+
+		if ( this->structured )
+			this->structured_callback( bw, this->user_data, value, 0 );
+		else
+			this->callback( bw, this->user_data, result.c_str(), 0 );
+	}
+	// Invoke the callback with an error instead
+	else
+		this->fail( BW_BROWSER_WINDOW_JS_ERROR_EXCEPTION, result.c_str() );
+}
+
+void bw::PendingCall::fail( bw_ErrCode code, const char* message ) const {
+	bw_BrowserWindow* bw = this->threaded ? nullptr : this->window();
+
+	// Without an answer of the renderer process, only the memory used by this process is known, and nothing at all without the browser window
+	if ( this->memory_stats_callback != nullptr ) {
+		bw_BrowserWindowMemoryStats stats;
+		if ( bw != nullptr )
+			bw_BrowserWindow_getNativeMemoryStats( bw, &stats );
+		else
+			memset( &stats, 0, sizeof( stats ) );
+		this->memory_stats_callback( bw, this->user_data, &stats );
+		return;
+	}
+
+	bw_Err error = bw_Err_new_with_msg( code, message );
+
+	if ( this->output_callback != nullptr )
+		this->output_callback( bw, this->user_data, 0, 0, 0, 0, &error );
+	else if ( this->structured )
+		this->structured_callback( bw, this->user_data, 0, &error );
+	else
+		this->callback( bw, this->user_data, 0, &error );
+	bw_Err_free( &error );
+}
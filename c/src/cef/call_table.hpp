@@ -0,0 +1,188 @@
+#ifndef BW_CEF_CALL_TABLE_HPP
+#define BW_CEF_CALL_TABLE_HPP
+
+#include "../browser_window.h"
+#include "../js_value.h"
+
+#include <include/cef_values.h>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+
+namespace bw {
+
+	// A call into the renderer process of which the result hasn't come back yet.
+	// It refers to its browser window by id, because the result can arrive on another thread, after the browser window has been closed.
+	struct PendingCall {
+		bw_Application* app;
+		bw_BrowserWindowId bw_id;
+		bool structured;	// Whether `structured_callback` is set instead of `callback`
+		bool threaded;	// Whether the callback may be invoked from any thread, in which case it receives a null browser window
+		bw_BrowserWindowJsCallbackFn callback;
+		bw_BrowserWindowJsStructuredCallbackFn structured_callback;
+		void* user_data;
+		// The moment at which the call times out, if it has a timeout
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+		// The moment at which the call has been stored, right before it got sent to the renderer process
+		std::chrono::steady_clock::time_point sent_at;
+		// Set instead of the other callbacks for a request of the memory statistics of the renderer process
+		bw_BrowserWindowMemoryStatsFn memory_stats_callback = nullptr;
+		// Set instead of the other callbacks for a capture or print into memory
+		bw_BrowserWindowOutputFn output_callback = nullptr;
+
+		// Looks up the browser window of the call, which is null once it has been closed.
+		bw_BrowserWindow* window() const {
+			return bw_Application_findBrowserWindow( this->app, this->bw_id );
+		}
+
+		// Invokes the callback with the result, or with `result` as the error message if `success` is false.
+		// Structured calls get their result from `value`, all others from `result`.
+		// If the browser window has been closed in the meantime, the callback gets a cancellation error instead.
+		void complete( bool success, const std::string& result, const bw_JsValue* value ) const;
+		// Invokes the callback with an error of the given code.
+		// The callback receives a null browser window if it has been closed already.
+		void fail( bw_ErrCode code, const char* message ) const;
+	};
+
+	// What a capture or print has rendered into memory, on its way to the GUI thread.
+	struct PendingOutput {
+		uint64_t call_id;
+		bool success;
+		std::vector<uint8_t> data;
+		int width;
+		int height;
+	};
+
+	// Hands the output to the callback of its call on the GUI thread, unless the call has been cancelled in the meantime.
+	// Takes ownership of `output`.
+	// This function is thread safe.
+	void dispatchOutput( bw_Application* app, PendingOutput* output );
+
+	// Wraps the ID of a call in a value that can be sent along with a message, as CEF has no 64-bit integers.
+	// The renderer process sends it back as it is.
+	CefRefPtr<CefValue> callIdToValue( uint64_t id );
+	// Reads the ID of a call from a message, or returns 0, which is never the ID of a call, if the value isn't one.
+	uint64_t callIdFromValue( CefRefPtr<CefValue> value );
+
+	// A thread safe slab of pending calls.
+	// Only the 64-bit ID of a call is sent along with the message to the renderer process, which sends it back with the result.
+	// The lower 24 bits of an ID are the index of its slot, and the upper 40 bits are incremented every time the slot is reused.
+	// Because of this, the result of a call that has been cancelled is not mistaken for that of a newer call, as a slot would have to be reused 2^40 times for its IDs to repeat.
+	class CallTable {
+		struct Slot {
+			PendingCall call;
+			uint64_t id;
+			bool used;
+		};
+
+		std::vector<Slot> slots;
+		std::vector<uint32_t> free_slots;
+		std::mutex mutex;
+
+	public:
+		CallTable() {}
+
+		// Stores a call, and returns the ID to send along to the renderer process.
+		uint64_t store( const PendingCall& call ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			uint32_t index;
+			if ( !this->free_slots.empty() ) {
+				index = this->free_slots.back();
+				this->free_slots.pop_back();
+			}
+			else {
+				index = (uint32_t)this->slots.size();
+				this->slots.push_back( Slot { call, index, false } );
+			}
+
+			// The first ID of a slot has generation 1, so that 0 is never an ID
+			Slot& slot = this->slots[index];
+			slot.call = call;
+			slot.call.sent_at = std::chrono::steady_clock::now();
+			slot.id += (uint64_t)1 << 24;
+			slot.used = true;
+			return slot.id;
+		}
+
+		// Takes the call out of the table.
+		// Returns nothing if the call doesn't exist (anymore), or if `bw_id` is given and the call belongs to another browser window.
+		std::optional<PendingCall> take( uint64_t id, bw_BrowserWindowId bw_id = 0 ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			uint32_t index = (uint32_t)( id & 0xFFFFFF );
+			if ( index >= this->slots.size() || !this->slots[index].used || this->slots[index].id != id )
+				return std::optional<PendingCall>();
+			if ( bw_id != 0 && this->slots[index].call.bw_id != bw_id )
+				return std::optional<PendingCall>();
+
+			this->slots[index].used = false;
+			this->free_slots.push_back( index );
+			return this->slots[index].call;
+		}
+
+		// Takes the call out of the table, but only if its deadline has passed.
+		// Otherwise, `deadline` is set to the deadline of the call that is stored under the ID, or to `time_point::max()` if there is none.
+		// Timers can fire a little bit early, in which case they can use `deadline` to try again later.
+		std::optional<PendingCall> takeExpired( uint64_t id, std::chrono::steady_clock::time_point now, std::chrono::steady_clock::time_point& deadline ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			deadline = std::chrono::steady_clock::time_point::max();
+
+			uint32_t index = (uint32_t)( id & 0xFFFFFF );
+			if ( index >= this->slots.size() || !this->slots[index].used || this->slots[index].id != id )
+				return std::optional<PendingCall>();
+
+			// The ID may have been reused by a newer call, which still has time left or has no timeout at all
+			if ( this->slots[index].call.deadline > now ) {
+				deadline = this->slots[index].call.deadline;
+				return std::optional<PendingCall>();
+			}
+
+			this->slots[index].used = false;
+			this->free_slots.push_back( index );
+			return this->slots[index].call;
+		}
+
+		// Returns the number of calls in the table that belong to the given browser window.
+		size_t count( bw_BrowserWindowId bw_id ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			size_t count = 0;
+			for ( auto it = this->slots.begin(); it != this->slots.end(); it++ ) {
+				if ( it->used && it->call.bw_id == bw_id )
+					count += 1;
+			}
+			return count;
+		}
+
+		// Takes all calls out of the table that belong to the given browser window.
+		std::vector<PendingCall> takeAll( bw_BrowserWindowId bw_id ) {
+			std::lock_guard<std::mutex> lock( this->mutex );
+
+			std::vector<PendingCall> calls;
+			for ( uint32_t i = 0; i < this->slots.size(); i++ ) {
+				Slot& slot = this->slots[i];
+
+				if ( slot.used && slot.call.bw_id == bw_id ) {
+					calls.push_back( slot.call );
+					slot.used = false;
+					this->free_slots.push_back( i );
+				}
+			}
+			return calls;
+		}
+	};
+
+	// A global instance
+	extern CallTable call_table;
+}
+
+
+
+#endif//BW_CEF_CALL_TABLE_HPP
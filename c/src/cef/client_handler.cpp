@@ -1,33 +1,224 @@
 #include "client_handler.hpp"
 
 
-void ClientHandler::externalInvocationHandlerFunc( bw_Application* app, void* _data ) {
-	auto data = (ExternalInvocationHandlerData*)_data;
+void ClientHandler::evalJsResultFunc( bw_Application* app, void* _data ) {
+	UNUSED( app );
+	auto data = (EvalJsResultData*)_data;
+
+	data->call.complete( data->success, data->result, &data->value );
+	if ( data->success && data->call.structured )
+		bw_JsValue_free( &data->value );
+
+	delete data;
+}
+
+void ClientHandler::evalJsBatchResultFunc( bw_Application* app, void* _data ) {
+	UNUSED( app );
+	auto data = (EvalJsBatchResultData*)_data;
+
+	for ( auto& result : data->results ) {
+		result.call.complete( result.success, result.result, nullptr );
+	}
+
+	delete data;
+}
+
+void ClientHandler::browserWindowEventFunc( bw_Application* app, void* _data ) {
+	UNUSED( app );
+	auto data = (BrowserWindowEventData*)_data;
+
+	// The browser window may have been destroyed in the meantime
+	std::optional<bw_BrowserWindow*> bw = bw::bw_handle_map.fetch( data->browser );
+	if ( bw.has_value() ) {
+		bw_BrowserWindowEvent event;
+		event.kind = data->kind;
+		event.text = { data->text.length(), data->text.c_str() };
+		event.http_status = data->http_status;
+		event.progress = data->progress;
+		_bw_BrowserWindow_onEvent( *bw, &event );
+	}
+
+	delete data;
+}
+
+void ClientHandler::receivedMetricsFunc( bw_Application* app, void* _data ) {
+	auto data = (ReceivedMetricsData*)_data;
+
+	// The browser window may have been destroyed in the meantime
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, data->bw_id );
+	if ( bw != nullptr ) {
+		for ( uint64_t latency : data->latencies ) {
+			bw_LatencyHistogram_record( &bw->metrics.eval_js, latency );
+		}
+		if ( data->execution_time >= 0 )
+			bw_LatencyHistogram_record( &bw->metrics.eval_js_execution, (uint64_t)data->execution_time );
+		_bw_Metrics_count( &bw->metrics.messages_received, 1 );
+		_bw_Metrics_count( &bw->metrics.bytes_received, data->size );
+	}
+
+	delete data;
+}
+
+void ClientHandler::memoryStatsResultFunc( bw_Application* app, void* _data ) {
+	UNUSED( app );
+	auto data = (MemoryStatsResultData*)_data;
+
+	// The browser window may have been closed while the result was on its way
+	bw_BrowserWindow* bw = data->call.window();
+	if ( bw == nullptr ) {
+		data->call.fail( BW_BROWSER_WINDOW_JS_ERROR_CANCELLED, "browser window has been closed" );
+		delete data;
+		return;
+	}
+
+	// The native figures are taken right before the callback, so that they are as recent as those of the renderer process
+	bw_BrowserWindowMemoryStats stats;
+	bw_BrowserWindow_getNativeMemoryStats( bw, &stats );
+	stats.renderer_measured = TRUE;
+	stats.renderer_private_bytes = data->renderer_private_bytes;
+	stats.js_heap_used = data->js_heap_used;
+	stats.js_heap_total = data->js_heap_total;
+	stats.js_heap_limit = data->js_heap_limit;
+	data->call.memory_stats_callback( bw, data->call.user_data, &stats );
+
+	delete data;
+}
+
+void ClientHandler::externalInvocationBatchHandlerFunc( bw_Application* app, void* _data ) {
+	auto data = (ExternalInvocationBatchData*)_data;
+
+	// The browser window may have been destroyed while the call was waiting
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, data->bw_id );
+	if ( bw == nullptr ) {
+		delete data;
+		return;
+	}
+
+	// The slices of all arguments are stored in one vector, so it needs to be filled before they can be pointed to
+	size_t arg_count = 0;
+	for ( size_t i = 0; i < data->calls.size(); i++ ) {
+		arg_count += data->calls[i].params.size();
+	}
+	std::vector<bw_CStrSlice> args; args.reserve( arg_count );
+	for ( size_t i = 0; i < data->calls.size(); i++ ) {
+		for ( const std::string& param : data->calls[i].params ) {
+			args.push_back( { param.length(), param.c_str() } );
+		}
+	}
+
+	std::vector<bw_BrowserWindowInvocation> calls; calls.reserve( data->calls.size() );
+	const bw_CStrSlice* call_args = args.data();
+	uint64_t latency = bw_cef_microsecondsSince( data->received_at );
+	for ( size_t i = 0; i < data->calls.size(); i++ ) {
+		const ExternalInvocationBatchData::Call& call = data->calls[i];
+
+		calls.push_back( { { call.cmd.length(), call.cmd.c_str() }, call_args, call.params.size() } );
+		call_args += call.params.size();
+		bw_LatencyHistogram_record( &bw->metrics.invoke, latency );
+	}
+
+	bw->batch_handler( bw, calls.data(), calls.size() );
+
+	delete data;
+}
+
+void ClientHandler::externalNativeInvocationHandlerFunc( bw_Application* app, void* _data ) {
+	auto data = (ExternalNativeInvocationHandlerData*)_data;
+
+	// The browser window may have been destroyed while the call was waiting
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, data->bw_id );
+	if ( bw == nullptr ) {
+		delete data;
+		return;
+	}
 
-	// Slice of the command string
 	bw_CStrSlice cmd_str_slice = {
 		data->cmd.length(),
 		data->cmd.c_str()
 	};
 
-	// Slices of the arguments
-	std::vector<bw_CStrSlice> params_slices; params_slices.reserve( data->params.capacity() );
+	std::vector<bw_CStrSlice> params_slices; params_slices.reserve( data->params.size() );
 	for ( size_t i = 0; i < data->params.size(); i++ ) {
-		std::string& param = data->params[i];
-
-		// Convert the stored param into a bw_CStrSlice
-		bw_CStrSlice param_str_slice = {
-			param.length(),
-			param.c_str()
-		};
-		params_slices.push_back( param_str_slice );
+		params_slices.push_back( { data->params[i].length(), data->params[i].c_str() } );
 	}
 
-	// Fire!
-	data->bw->external_handler(
-		data->bw,
+	bw_LatencyHistogram_record( &bw->metrics.invoke, bw_cef_microsecondsSince( data->received_at ) );
+	bw->native_handler(
+		bw,
 		cmd_str_slice,
 		params_slices.data(),
-		params_slices.size()
+		params_slices.size(),
+		data->request_id
+	);
+
+	delete data;
+}
+
+void ClientHandler::externalStructuredInvocationHandlerFunc( bw_Application* app, void* _data ) {
+	auto data = (ExternalStructuredInvocationHandlerData*)_data;
+
+	// The browser window may have been destroyed while the call was waiting
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, data->bw_id );
+	if ( bw == nullptr ) {
+		for ( size_t i = 0; i < data->params.size(); i++ ) {
+			bw_JsValue_free( &data->params[i] );
+		}
+		delete data;
+		return;
+	}
+
+	bw_CStrSlice cmd_str_slice = {
+		data->cmd.length(),
+		data->cmd.c_str()
+	};
+
+	bw_LatencyHistogram_record( &bw->metrics.invoke, bw_cef_microsecondsSince( data->received_at ) );
+	bw->structured_handler(
+		bw,
+		cmd_str_slice,
+		data->params.data(),
+		data->params.size()
+	);
+
+	for ( size_t i = 0; i < data->params.size(); i++ ) {
+		bw_JsValue_free( &data->params[i] );
+	}
+	delete data;
+}
+
+void ClientHandler::streamDataFunc( bw_Application* app, void* _data ) {
+	auto data = (StreamData*)_data;
+
+	// The browser window may have been destroyed while the data was waiting
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, data->bw_id );
+	if ( bw != nullptr )
+		(*(CefRefPtr<bw::StreamReader>*)bw->impl.stream_reader_ptr)->read( bw, data->data.data(), data->data.size() );
+
+	delete data;
+}
+
+void ClientHandler::externalBinaryInvocationHandlerFunc( bw_Application* app, void* _data ) {
+	auto data = (ExternalBinaryInvocationHandlerData*)_data;
+
+	// The browser window may have been destroyed while the call was waiting
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( app, data->bw_id );
+	if ( bw == nullptr ) {
+		delete data;
+		return;
+	}
+
+	bw_CStrSlice cmd_str_slice = {
+		data->cmd.length(),
+		data->cmd.c_str()
+	};
+
+	bw_LatencyHistogram_record( &bw->metrics.invoke, bw_cef_microsecondsSince( data->received_at ) );
+	bw->binary_handler(
+		bw,
+		cmd_str_slice,
+		data->data.data(),
+		data->data.size()
 	);
-}
\ No newline at end of file
+
+	delete data;
+}
@@ -2,34 +2,255 @@
 #define BW_CEF_CLIENT_HANDLER_H
 
 #include <include/cef_client.h>
+#include <include/cef_display_handler.h>
 #include <include/cef_life_span_handler.h>
+#include <include/cef_load_handler.h>
+#include <include/cef_render_handler.h>
 #include <include/cef_v8.h>
+#include <chrono>
+#include <cstring>
 #include <string>
 #include <vector>
 
+#include "browser_registry.hpp"
 #include "bw_handle_map.hpp"
+#include "call_table.hpp"
+#include "invocation_queue.hpp"
+#include "request_interceptor.hpp"
+#include "util.hpp"
+#include "value.hpp"
 #include "../application.h"
+#include "../browser_window/impl.h"
 #include "../common.h"
+#include "../trace.h"
 
 
 
-struct ExternalInvocationHandlerData {
-	bw_BrowserWindow* bw;
+// Implemented in application/cef.cpp
+void _bw_ApplicationCef_onBrowserClosed( int browser_id );
+// Implemented in browser_window/cef.cpp
+void bw_BrowserWindowCef_replyToFrame( bw_BrowserWindow* bw, CefRefPtr<CefFrame> frame, unsigned int renderer_id, bool success, bw_CStrSlice value );
+
+
+
+// The result of an eval-js message, converted so that it can be handed to the callback on another thread.
+struct EvalJsResultData {
+	bw::PendingCall call;
+	bool success;
+	std::string result;	// The result string, or the error message
+	bw_JsValue value;	// The structured result
+};
+
+// The results of an eval-js-batch message, to be handed to their callbacks on the GUI thread.
+struct EvalJsBatchResultData {
+	struct Result {
+		bw::PendingCall call;
+		bool success;
+		std::string result;	// The result string, or the error message
+	};
+
+	std::vector<Result> results;
+};
+
+// The figures of a message that a renderer process has sent back, to be recorded in the metrics of its browser window on the GUI thread.
+struct ReceivedMetricsData {
+	bw_BrowserWindowId bw_id;
+	std::vector<uint64_t> latencies;	// The round-trip time of each evaluation in the message, in microseconds
+	int64_t execution_time;	// The time the renderer process took to evaluate, or -1 if it didn't tell
+	size_t size;	// The number of bytes of the results
+};
+
+// The memory statistics that a renderer process has sent back, to be handed to the callback on the GUI thread.
+struct MemoryStatsResultData {
+	bw::PendingCall call;
+	uint64_t renderer_private_bytes;
+	uint64_t js_heap_used;
+	uint64_t js_heap_total;
+	uint64_t js_heap_limit;
+};
+
+// The data of the calls below refers to its browser window by id, because the browser window may have been destroyed before the call is handled on the GUI thread.
+
+// All calls of invoke_extern that the page has made during one task.
+struct ExternalInvocationBatchData {
+	struct Call {
+		std::string cmd;
+		std::vector<std::string> params;
+	};
+
+	bw_BrowserWindowId bw_id;
+	std::vector<Call> calls;
+	std::chrono::steady_clock::time_point received_at;
+};
+
+struct ExternalNativeInvocationHandlerData {
+	bw_BrowserWindowId bw_id;
+	unsigned int request_id;
 	std::string cmd;
 	std::vector<std::string> params;
+	std::chrono::steady_clock::time_point received_at;
+};
+
+struct ExternalBinaryInvocationHandlerData {
+	bw_BrowserWindowId bw_id;
+	std::string cmd;
+	std::vector<uint8_t> data;
+	std::chrono::steady_clock::time_point received_at;
+};
+
+// The bytes that the page has written with write_extern_stream.
+struct StreamData {
+	bw_BrowserWindowId bw_id;
+	std::vector<uint8_t> data;
+};
+
+struct ExternalStructuredInvocationHandlerData {
+	bw_BrowserWindowId bw_id;
+	std::string cmd;
+	std::vector<bw_JsValue> params;
+	std::chrono::steady_clock::time_point received_at;
+};
+
+// An event of the page, to be handed to the browser window on the GUI thread.
+// The browser is looked up again there, because the browser window may have been destroyed in the meantime.
+struct BrowserWindowEventData {
+	CefRefPtr<CefBrowser> browser;
+	bw_BrowserWindowEventKind kind;
+	std::string text;
+	int http_status;
+	double progress;
 };
 
-class ClientHandler : public CefClient, public CefLifeSpanHandler {
+class ClientHandler : public CefClient, public CefDisplayHandler, public CefLifeSpanHandler, public CefLoadHandler, public CefRequestHandler {
 
 	bw_Application* app;
+	// Only set for windowless browser windows, which each get a client of their own
+	CefRefPtr<CefRenderHandler> render_handler;
 
 public:
-	ClientHandler( bw_Application* app ) : app(app) {}
+	ClientHandler( bw_Application* app, CefRefPtr<CefRenderHandler> render_handler = nullptr ) : app(app), render_handler(render_handler) {}
+
+	virtual CefRefPtr<CefRenderHandler> GetRenderHandler() override {
+		return this->render_handler;
+	}
+
+	virtual CefRefPtr<CefDisplayHandler> GetDisplayHandler() override {
+		return this;
+	}
 
 	virtual CefRefPtr<CefLifeSpanHandler> GetLifeSpanHandler() override {
 		return this;
 	}
 
+	virtual CefRefPtr<CefLoadHandler> GetLoadHandler() override {
+		return this;
+	}
+
+	virtual CefRefPtr<CefRequestHandler> GetRequestHandler() override {
+		return this;
+	}
+
+	virtual void OnLoadStart( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, TransitionType transition_type ) override {
+		(void)(transition_type);
+
+		// A page may have been loaded in a new renderer process, which doesn't know the limit of the invocation queue, the registered commands and scripts, and whether the stream is read yet
+		if ( !frame->IsMain() )
+			return;
+		this->dispatchEvent( browser, BW_BROWSER_WINDOW_EVENT_LOAD_START );
+		std::optional<bw_BrowserWindow*> bw = bw::bw_handle_map.fetch( browser );
+		if ( bw.has_value() && (*bw)->impl.invoke_queue_ptr != 0 ) {
+			(*(CefRefPtr<bw::InvocationQueue>*)(*bw)->impl.invoke_queue_ptr)->sendLimit();
+			(*(CefRefPtr<bw::InvocationQueue>*)(*bw)->impl.invoke_queue_ptr)->sendCommands();
+		}
+		if ( bw.has_value() && (*bw)->impl.scripts_ptr != 0 )
+			(*(CefRefPtr<bw::RegisteredScripts>*)(*bw)->impl.scripts_ptr)->send( *bw );
+		if ( bw.has_value() && (*bw)->impl.stream_reader_ptr != 0 )
+			(*(CefRefPtr<bw::StreamReader>*)(*bw)->impl.stream_reader_ptr)->send( *bw );
+	}
+
+	virtual void OnLoadEnd( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, int http_status_code ) override {
+		if ( !frame->IsMain() )
+			return;
+
+		_bw_Application_markStartupPhase( this->app, &this->app->startup_metrics.first_load );
+		this->dispatchEvent( browser, BW_BROWSER_WINDOW_EVENT_LOAD_END, std::string(), http_status_code );
+	}
+
+	virtual void OnAddressChange( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, const CefString& url ) override {
+		if ( frame->IsMain() )
+			this->dispatchEvent( browser, BW_BROWSER_WINDOW_EVENT_URL_CHANGE, url.ToString() );
+	}
+
+	virtual void OnTitleChange( CefRefPtr<CefBrowser> browser, const CefString& title ) override {
+		this->dispatchEvent( browser, BW_BROWSER_WINDOW_EVENT_TITLE_CHANGE, title.ToString() );
+	}
+
+	virtual void OnLoadingProgressChange( CefRefPtr<CefBrowser> browser, double progress ) override {
+		this->dispatchEvent( browser, BW_BROWSER_WINDOW_EVENT_PROGRESS, std::string(), 0, progress );
+	}
+
+	// A fast shutdown waits for the browsers it has closed
+	virtual void OnBeforeClose( CefRefPtr<CefBrowser> browser ) override {
+		_bw_ApplicationCef_onBrowserClosed( browser->GetIdentifier() );
+	}
+
+	// Popups are related to the page that opened them, so that they can script each other, which keeps them in the same renderer process.
+	// Taking away the script access lets Chromium put them in a process of their own.
+	virtual bool OnBeforePopup(
+		CefRefPtr<CefBrowser> browser,
+		CefRefPtr<CefFrame> frame,
+		const CefString& target_url,
+		const CefString& target_frame_name,
+		WindowOpenDisposition target_disposition,
+		bool user_gesture,
+		const CefPopupFeatures& popup_features,
+		CefWindowInfo& window_info,
+		CefRefPtr<CefClient>& client,
+		CefBrowserSettings& settings,
+		CefRefPtr<CefDictionaryValue>& extra_info,
+		bool* no_javascript_access
+	) override {
+		// Unused parameters
+		(void)(browser);
+		(void)(frame);
+		(void)(target_url);
+		(void)(target_frame_name);
+		(void)(target_disposition);
+		(void)(user_gesture);
+		(void)(popup_features);
+		(void)(window_info);
+		(void)(client);
+		(void)(settings);
+		(void)(extra_info);
+
+		if ( this->app->engine_impl.isolate_popups )
+			*no_javascript_access = true;
+		return false;
+	}
+
+	// Invoked on the IO thread for every request, so only browser windows that intercept requests get a handler
+	virtual CefRefPtr<CefResourceRequestHandler> GetResourceRequestHandler(
+		CefRefPtr<CefBrowser> browser,
+		CefRefPtr<CefFrame> frame,
+		CefRefPtr<CefRequest> request,
+		bool is_navigation,
+		bool is_download,
+		const CefString& request_initiator,
+		bool& disable_default_handling
+	) override {
+		// Unused parameters
+		(void)(frame);
+		(void)(is_navigation);
+		(void)(is_download);
+		(void)(request_initiator);
+		(void)(disable_default_handling);
+
+		if ( browser == nullptr )
+			return nullptr;
+
+		return bw::request_interceptors.find( browser->GetIdentifier(), request->GetURL() ).get();
+	}
+
 	virtual bool OnProcessMessageReceived(
 		CefRefPtr<CefBrowser> browser,
 		CefRefPtr<CefFrame> frame,
@@ -39,7 +260,19 @@ public:
 
 		// The message to reveal the result of some javascript code
 		if ( message->GetName() == "eval-js-result" ) {
+			BW_TRACE_BEGIN( span );
 			this->onEvalJsResultReceived( browser, frame, source_process, message );
+			BW_TRACE_END( span, "eval_js_result" );
+			return true;
+		}
+		// The message containing the results of multiple pieces of javascript code
+		else if ( message->GetName() == "eval-js-batch-result" ) {
+			this->onEvalJsBatchResultReceived( message );
+			return true;
+		}
+		// The message with the memory statistics of the renderer process
+		else if ( message->GetName() == "memory-stats-result" ) {
+			this->onMemoryStatsResultReceived( message );
 			return true;
 		}
 		// The message to send data from within javascript to application code
@@ -47,9 +280,36 @@ public:
 			this->onInvokeHandlerReceived( browser, frame, source_process, message );
 			return true;
 		}
+		// The message with all calls of invoke_extern made during one task, when they are batched
+		else if ( message->GetName() == "invoke-handler-batch" ) {
+			this->onInvokeHandlerBatchReceived( browser, message );
+			return true;
+		}
+		// The message to send data from within javascript to application code, which is replied to
+		else if ( message->GetName() == "invoke-native-handler" ) {
+			this->onInvokeNativeHandlerReceived( browser, frame, message );
+			return true;
+		}
+		// The message to send structured data from within javascript to application code
+		else if ( message->GetName() == "invoke-structured-handler" ) {
+			this->onInvokeStructuredHandlerReceived( browser, message );
+			return true;
+		}
+		// The message to send binary data from within javascript to application code
+		else if ( message->GetName() == "invoke-binary-handler" ) {
+			this->onInvokeBinaryHandlerReceived( browser, message );
+			return true;
+		}
+		// The message with the bytes that the page has written with write_extern_stream
+		else if ( message->GetName() == "stream-data" ) {
+			this->onStreamDataReceived( browser, message );
+			return true;
+		}
 		// The message to send data from within javascript to application code
 		else if ( message->GetName() == "on-browser-created" ) {
+			BW_TRACE_BEGIN( span );
 			this->onBrowserCreated( browser, frame, source_process, message );
+			BW_TRACE_END( span, "browser_created" );
 			return true;
 		}
 		else
@@ -60,7 +320,41 @@ public:
 
 protected:
 
-	static void externalInvocationHandlerFunc( bw_Application* app, void* data );
+	static void evalJsResultFunc( bw_Application* app, void* data );
+	static void evalJsBatchResultFunc( bw_Application* app, void* data );
+	static void memoryStatsResultFunc( bw_Application* app, void* data );
+	static void externalInvocationBatchHandlerFunc( bw_Application* app, void* data );
+	static void externalNativeInvocationHandlerFunc( bw_Application* app, void* data );
+	static void externalStructuredInvocationHandlerFunc( bw_Application* app, void* data );
+	static void externalBinaryInvocationHandlerFunc( bw_Application* app, void* data );
+	static void streamDataFunc( bw_Application* app, void* data );
+	static void browserWindowEventFunc( bw_Application* app, void* data );
+	static void receivedMetricsFunc( bw_Application* app, void* data );
+
+	void dispatchEvent( CefRefPtr<CefBrowser> browser, bw_BrowserWindowEventKind kind, std::string text = std::string(), int http_status = 0, double progress = 0 ) {
+		auto data = new BrowserWindowEventData;
+		data->browser = browser;
+		data->kind = kind;
+		data->text = std::move( text );
+		data->http_status = http_status;
+		data->progress = progress;
+
+		bw_Application_dispatch( this->app, browserWindowEventFunc, data );
+	}
+
+	static void countReceived( bw_BrowserWindow* bw, size_t size ) {
+		_bw_Metrics_count( &bw->metrics.messages_received, 1 );
+		_bw_Metrics_count( &bw->metrics.bytes_received, size );
+	}
+
+	// The browser window of a pending call is only looked up on the GUI thread, because it may be destroyed there at any time.
+	void recordReceived( ReceivedMetricsData* data ) {
+#if defined(BW_WIN32)
+		bw_Application_dispatch( this->app, receivedMetricsFunc, data );
+#else
+		receivedMetricsFunc( this->app, data );
+#endif
+	}
 
 	void onBrowserCreated(
 		CefRefPtr<CefBrowser> browser,
@@ -71,26 +365,40 @@ protected:
 		auto args = msg->GetArgumentList();
 
 		// Process message arguments
-		bw_BrowserWindow* bw_handle;
-		args->GetBinary( 0 )->GetData( (void*)&bw_handle, sizeof( bw_handle ), 0 );
+		bw_BrowserWindowId bw_id;
+		args->GetBinary( 0 )->GetData( (void*)&bw_id, sizeof( bw_id ), 0 );
 		bw_BrowserWindowCreationCallbackFn callback;
 		args->GetBinary( 1 )->GetData( (void*)&callback, sizeof( callback ), 0 );
 		void* callback_data;
 		args->GetBinary( 2 )->GetData( (void*)&callback_data, sizeof( callback_data ), 0 );
 		bool dev_tools_enabled = args->GetBool( 3 );
 
+		// The message of a browser window that has been destroyed in the meantime is stale
+		bw_BrowserWindow* bw_handle = bw_Application_findBrowserWindow( this->app, bw_id );
+		if ( bw_handle == nullptr )
+			return;
+
 		// Make a copy on the heap to store in our handle
 		CefRefPtr<CefBrowser>* cef_ptr = new CefRefPtr<CefBrowser>( browser );
 		bw_handle->impl.cef_ptr = (void*)cef_ptr;
 
 		// Store a link with the cef browser handle and our handle in a global map
 		bw::bw_handle_map.store( *cef_ptr, bw_handle );
+		// Other threads can send messages to the browser from now on
+		bw::browser_registry.setBrowser( this->app, bw_id, browser );
+		// Events that have been handled before the link existed were dropped, so the url may not have been reported yet
+		this->dispatchEvent( browser, BW_BROWSER_WINDOW_EVENT_URL_CHANGE, browser->GetMainFrame()->GetURL().ToString() );
+
+		// Windows that are not visible from the start should not render at full rate until they are
+		if ( bw_handle->window->visibility != BW_WINDOW_VISIBILITY_VISIBLE )
+			bw_BrowserWindowImpl_onVisibilityChange( bw_handle->window, bw_handle->window->visibility );
 
 		// Open dev-tools window
 		if ( dev_tools_enabled )
 			this->openDevTools( bw_handle, browser->GetHost() );
 
 		// Invoke the completion callback
+		_bw_Application_markStartupPhase( this->app, &this->app->startup_metrics.first_browser_created );
 		callback( bw_handle, callback_data );
 	}
 
@@ -107,38 +415,107 @@ protected:
 
 		auto msg_args = message->GetArgumentList();
 
-		// Parameters
-		bool success = msg_args->GetBool( 0 );
-		CefString cef_result = msg_args->GetString( 1 );
-		std::string result = cef_result.ToString();
+		// Only the ID of the call has been sent along, so the callback is looked up in the call table.
+		// If it isn't there anymore, the call has been cancelled because its browser window has been closed.
+		std::optional<bw::PendingCall> call = bw::call_table.take( bw::callIdFromValue( msg_args->GetValue( 2 ) ) );
+		if ( !call.has_value() )
+			return;
+
+		auto data = new EvalJsResultData;
+		data->call = *call;
+		data->success = msg_args->GetBool( 0 );
+
+		auto metrics = new ReceivedMetricsData;
+		metrics->bw_id = call->bw_id;
+		metrics->latencies.push_back( bw_cef_microsecondsSince( call->sent_at ) );
+		// The renderer process tells how long the evaluation itself took, except for registered scripts
+		metrics->execution_time = msg_args->GetType( 4 ) == VTYPE_INT ? msg_args->GetInt( 4 ) : -1;
+
+		// The result is converted right away, so that the message doesn't need to be kept around
+		if ( data->success && data->call.structured ) {
+			// Undefined has no CefValue counterpart, so it is flagged seperately
+			if ( msg_args->GetBool( 3 ) )
+				bw_cef_toJsValue( nullptr, &data->value );
+			else
+				bw_cef_toJsValue( msg_args->GetValue( 1 ), &data->value );
+		}
+		else
+			data->result = msg_args->GetString( 1 ).ToString();
+		metrics->size = data->result.size();
+		this->recordReceived( metrics );
+
+		// The callback of bw_BrowserWindow_evalJsThreaded is invoked right here, on CEF's UI thread.
+		// All other callbacks are invoked on the GUI thread.
+		// CEF's UI thread only differs from the GUI thread on Windows, where CEF runs its own message loop.
+#if defined(BW_WIN32)
+		if ( !data->call.threaded ) {
+			bw_Application_dispatch( this->app, evalJsResultFunc, data );
+			return;
+		}
+#endif
+		evalJsResultFunc( this->app, data );
+	}
 
-		// Browser window handle
-		bw_BrowserWindow* bw_handle;
-		CefRefPtr<CefBinaryValue> bw_handle_bin = msg_args->GetBinary( 2 );
-		bw_handle_bin->GetData( (void*)&bw_handle, sizeof( bw_handle ), 0 );
+	void onEvalJsBatchResultReceived( CefRefPtr<CefProcessMessage> message ) {
+		auto msg_args = message->GetArgumentList();
 
-		// Callback function
-		bw_BrowserWindowJsCallbackFn callback;
-		CefRefPtr<CefBinaryValue> cb_bin = msg_args->GetBinary( 3 );
-		cb_bin->GetData( (void*)&callback, sizeof( callback ), 0 );
+		CefRefPtr<CefListValue> results = msg_args->GetList( 0 );
+		CefRefPtr<CefListValue> call_ids = msg_args->GetList( 1 );
+
+		auto data = new EvalJsBatchResultData;
+		data->results.reserve( call_ids->GetSize() );
+
+		// All calls of a batch belong to the same browser window
+		auto metrics = new ReceivedMetricsData;
+		metrics->bw_id = 0;
+		metrics->execution_time = -1;
+		metrics->size = 0;
+		for ( size_t i = 0; i < call_ids->GetSize(); i++ ) {
+			std::optional<bw::PendingCall> call = bw::call_table.take( bw::callIdFromValue( call_ids->GetValue( i ) ) );
+			if ( !call.has_value() )
+				continue;
+			metrics->bw_id = call->bw_id;
+			metrics->latencies.push_back( bw_cef_microsecondsSince( call->sent_at ) );
+
+			EvalJsBatchResultData::Result result = { *call, results->GetBool( i * 2 ), results->GetString( i * 2 + 1 ).ToString() };
+			metrics->size += result.result.size();
+			data->results.push_back( std::move( result ) );
+		}
 
-		// User data for the callback function
-		void* user_data;
-		CefRefPtr<CefBinaryValue> user_data_bin = msg_args->GetBinary( 4 );
-		user_data_bin->GetData( (void*)&user_data, sizeof( user_data ), 0 );
+		this->recordReceived( metrics );
 
-		// FIXME: call the relevant code on the right thread...
+		// The callbacks are invoked on the GUI thread, which only differs from CEF's UI thread on Windows
+#if defined(BW_WIN32)
+		bw_Application_dispatch( this->app, evalJsBatchResultFunc, data );
+#else
+		evalJsBatchResultFunc( this->app, data );
+#endif
+	}
 
-		// // Invoke the callback with either a result string or an error
-		if (success) {
-			callback( bw_handle, user_data, result.c_str(), 0 );
-		}
-		else {
-			bw_Err error = bw_Err_new_with_msg( 1, result.c_str() );
+	void onMemoryStatsResultReceived( CefRefPtr<CefProcessMessage> message ) {
+		auto msg_args = message->GetArgumentList();
 
-			callback( bw_handle, user_data, 0, &error );
-			bw_Err_free( &error );
-		}
+		std::optional<bw::PendingCall> call = bw::call_table.take( bw::callIdFromValue( msg_args->GetValue( 0 ) ) );
+		if ( !call.has_value() )
+			return;
+		auto metrics = new ReceivedMetricsData;
+		metrics->bw_id = call->bw_id;
+		metrics->execution_time = -1;
+		metrics->size = 0;
+		this->recordReceived( metrics );
+
+		auto data = new MemoryStatsResultData;
+		data->call = *call;
+		data->renderer_private_bytes = (uint64_t)msg_args->GetDouble( 1 );
+		data->js_heap_used = (uint64_t)msg_args->GetDouble( 2 );
+		data->js_heap_total = (uint64_t)msg_args->GetDouble( 3 );
+		data->js_heap_limit = (uint64_t)msg_args->GetDouble( 4 );
+
+#if defined(BW_WIN32)
+		bw_Application_dispatch( this->app, memoryStatsResultFunc, data );
+#else
+		memoryStatsResultFunc( this->app, data );
+#endif
 	}
 
 	void onInvokeHandlerReceived(
@@ -156,28 +533,202 @@ protected:
 		bw_BrowserWindow* our_handle = *_bw_handle;
 
 		auto msg_args = msg->GetArgumentList();
-
-		// This argument is the command string
-		CefString cmd = msg_args->GetString( 0 );
-		std::string cmd_str = cmd.ToString();
+		// A message without a command is dropped, rather than trusting the renderer to never send one
+		if ( msg_args->GetSize() == 0 )
+			return;
+
+		// This argument is the command string, or the id of a registered command
+		bw::Invocation call;
+		size_t size = 0;
+		if ( msg_args->GetType( 0 ) == VTYPE_INT )
+			call.command_id = (unsigned int)msg_args->GetInt( 0 );
+		else {
+			call.cmd = msg_args->GetString( 0 ).ToString();
+			size = call.cmd.size();
+		}
 
 		// All next message arguments are the arguments of the command
-		std::vector<std::string> params; params.reserve( msg_args->GetSize() - 1 );
+		call.params.reserve( msg_args->GetSize() - 1 );
 		for ( size_t i = 1; i < msg_args->GetSize(); i++ ) {
 			std::string param = msg_args->GetString( i ).ToString();
 
-			params.push_back( param );
+			size += param.size();
+			call.params.push_back( std::move( param ) );
+		}
+		countReceived( our_handle, size );
+		call.received_at = std::chrono::steady_clock::now();
+
+		// A threaded handler doesn't need the GUI thread, so the call goes straight to the worker pool, unless it is for a registered command
+		if ( our_handle->impl.threaded_handler_ptr != 0 && call.command_id == 0 )
+			(*(CefRefPtr<bw::ThreadedHandler>*)our_handle->impl.threaded_handler_ptr)->push( std::move( call ) );
+		// The queue dispatches the invocation of the external handler to the thread from which the BrowserWindow main loop runs.
+		else
+			(*(CefRefPtr<bw::InvocationQueue>*)our_handle->impl.invoke_queue_ptr)->push( std::move( call ) );
+	}
+
+	void onInvokeHandlerBatchReceived( CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg ) {
+
+		// Obtain our browser window handle
+		std::optional<bw_BrowserWindow*> _bw_handle = bw::bw_handle_map.fetch( browser );
+		BW_ASSERT( _bw_handle.has_value(), "Link between CEF's browser handle and our handle does not exist!\n" );
+		bw_BrowserWindow* our_handle = *_bw_handle;
+
+		if ( our_handle->batch_handler == 0 )
+			return;
+
+		// Every call is a list of the command, followed by its arguments
+		CefRefPtr<CefListValue> calls = msg->GetArgumentList()->GetList( 0 );
+
+		auto dispatch_data = new ExternalInvocationBatchData;
+		dispatch_data->bw_id = bw_BrowserWindow_getId( our_handle );
+		dispatch_data->calls.resize( calls->GetSize() );
+		size_t size = 0;
+		for ( size_t i = 0; i < calls->GetSize(); i++ ) {
+			CefRefPtr<CefListValue> call_args = calls->GetList( i );
+			ExternalInvocationBatchData::Call& call = dispatch_data->calls[i];
+
+			// A call without any arguments is left without a command, rather than trusting the renderer to never send one
+			if ( call_args->GetSize() == 0 )
+				continue;
+
+			call.cmd = call_args->GetString( 0 ).ToString();
+			size += call.cmd.size();
+			call.params.reserve( call_args->GetSize() - 1 );
+			for ( size_t j = 1; j < call_args->GetSize(); j++ ) {
+				call.params.push_back( call_args->GetString( j ).ToString() );
+				size += call.params.back().size();
+			}
+		}
+		dispatch_data->received_at = std::chrono::steady_clock::now();
+		countReceived( our_handle, size );
+
+		// The whole batch takes only one dispatch to the GUI thread
+		bw_Application_dispatch(
+			our_handle->window->app,
+			externalInvocationBatchHandlerFunc,
+			dispatch_data
+		);
+	}
+
+	void onInvokeNativeHandlerReceived( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, CefRefPtr<CefProcessMessage> msg ) {
+
+		// Obtain our browser window handle
+		std::optional<bw_BrowserWindow*> _bw_handle = bw::bw_handle_map.fetch( browser );
+		BW_ASSERT( _bw_handle.has_value(), "Link between CEF's browser handle and our handle does not exist!\n" );
+		bw_BrowserWindow* our_handle = *_bw_handle;
+
+		auto msg_args = msg->GetArgumentList();
+		unsigned int renderer_id = (unsigned int)msg_args->GetInt( 0 );
+
+		// Without a handler, there is nobody to wait for
+		if ( our_handle->native_handler == 0 ) {
+			const char* message = "no native handler has been set for this browser window";
+			bw_BrowserWindowCef_replyToFrame( our_handle, frame, renderer_id, false, { strlen( message ), message } );
+			return;
+		}
+		unsigned int request_id = (*(CefRefPtr<bw::NativeRequests>*)our_handle->impl.native_requests_ptr)->add( frame, renderer_id );
+
+		auto dispatch_data = new ExternalNativeInvocationHandlerData;
+		dispatch_data->bw_id = bw_BrowserWindow_getId( our_handle );
+		dispatch_data->request_id = request_id;
+		dispatch_data->cmd = msg_args->GetString( 1 ).ToString();
+		size_t size = dispatch_data->cmd.size();
+		dispatch_data->params.reserve( msg_args->GetSize() - 2 );
+		for ( size_t i = 2; i < msg_args->GetSize(); i++ ) {
+			dispatch_data->params.push_back( msg_args->GetString( i ).ToString() );
+			size += dispatch_data->params.back().size();
+		}
+		dispatch_data->received_at = std::chrono::steady_clock::now();
+		countReceived( our_handle, size );
+
+		bw_Application_dispatch(
+			our_handle->window->app,
+			externalNativeInvocationHandlerFunc,
+			dispatch_data
+		);
+	}
+
+	void onInvokeBinaryHandlerReceived( CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg ) {
+
+		// Obtain our browser window handle
+		std::optional<bw_BrowserWindow*> _bw_handle = bw::bw_handle_map.fetch( browser );
+		BW_ASSERT( _bw_handle.has_value(), "Link between CEF's browser handle and our handle does not exist!\n" );
+		bw_BrowserWindow* our_handle = *_bw_handle;
+
+		if ( our_handle->binary_handler == 0 )
+			return;
+
+		auto msg_args = msg->GetArgumentList();
+
+		auto dispatch_data = new ExternalBinaryInvocationHandlerData;
+		dispatch_data->bw_id = bw_BrowserWindow_getId( our_handle );
+		dispatch_data->cmd = msg_args->GetString( 0 ).ToString();
+		if ( msg_args->GetType( 1 ) == VTYPE_BINARY ) {
+			CefRefPtr<CefBinaryValue> binary = msg_args->GetBinary( 1 );
+			dispatch_data->data.resize( binary->GetSize() );
+			binary->GetData( dispatch_data->data.data(), dispatch_data->data.size(), 0 );
+		}
+		dispatch_data->received_at = std::chrono::steady_clock::now();
+		countReceived( our_handle, dispatch_data->cmd.size() + dispatch_data->data.size() );
+
+		bw_Application_dispatch(
+			our_handle->window->app,
+			externalBinaryInvocationHandlerFunc,
+			dispatch_data
+		);
+	}
+
+	void onStreamDataReceived( CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg ) {
+
+		// Obtain our browser window handle
+		std::optional<bw_BrowserWindow*> _bw_handle = bw::bw_handle_map.fetch( browser );
+		BW_ASSERT( _bw_handle.has_value(), "Link between CEF's browser handle and our handle does not exist!\n" );
+		bw_BrowserWindow* our_handle = *_bw_handle;
+
+		auto msg_args = msg->GetArgumentList();
+		if ( msg_args->GetType( 0 ) != VTYPE_BINARY )
+			return;
+
+		auto dispatch_data = new StreamData;
+		dispatch_data->bw_id = bw_BrowserWindow_getId( our_handle );
+		CefRefPtr<CefBinaryValue> binary = msg_args->GetBinary( 0 );
+		dispatch_data->data.resize( binary->GetSize() );
+		binary->GetData( dispatch_data->data.data(), dispatch_data->data.size(), 0 );
+		countReceived( our_handle, dispatch_data->data.size() );
+
+		bw_Application_dispatch(
+			our_handle->window->app,
+			streamDataFunc,
+			dispatch_data
+		);
+	}
+
+	void onInvokeStructuredHandlerReceived( CefRefPtr<CefBrowser> browser, CefRefPtr<CefProcessMessage> msg ) {
+
+		// Obtain our browser window handle
+		std::optional<bw_BrowserWindow*> _bw_handle = bw::bw_handle_map.fetch( browser );
+		BW_ASSERT( _bw_handle.has_value(), "Link between CEF's browser handle and our handle does not exist!\n" );
+		bw_BrowserWindow* our_handle = *_bw_handle;
+
+		auto msg_args = msg->GetArgumentList();
+		// A message without a command is dropped, rather than trusting the renderer to never send one
+		if ( msg_args->GetSize() == 0 )
+			return;
+
+		// The values are converted right away, so that the message doesn't need to be kept around
+		auto dispatch_data = new ExternalStructuredInvocationHandlerData;
+		dispatch_data->bw_id = bw_BrowserWindow_getId( our_handle );
+		dispatch_data->cmd = msg_args->GetString( 0 ).ToString();
+		dispatch_data->params.resize( msg_args->GetSize() - 1 );
+		for ( size_t i = 1; i < msg_args->GetSize(); i++ ) {
+			bw_cef_toJsValue( msg_args->GetValue( i ), &dispatch_data->params[i - 1] );
 		}
+		dispatch_data->received_at = std::chrono::steady_clock::now();
+		countReceived( our_handle, dispatch_data->cmd.size() );
 
-		// Dispatch the invocation of the external handler to the thread from which the BrowserWindow main loop runs.
-		auto dispatch_data = new ExternalInvocationHandlerData {
-			our_handle,
-			cmd_str,
-			params
-		};
 		bw_Application_dispatch(
 			our_handle->window->app,
-			externalInvocationHandlerFunc,
+			externalStructuredInvocationHandlerFunc,
 			dispatch_data
 		);
 	}
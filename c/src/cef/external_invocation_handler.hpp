@@ -1,22 +1,155 @@
 #ifndef BW_CEF_EXTERNAL_INVOCATION_HANDLER
 #define BW_CEF_EXTERNAL_INVOCATION_HANDLER
 
+#include <include/cef_task.h>
 #include <include/cef_v8.h>
+#include <cstdint>
+#include <map>
 #include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "bw_handle_map.hpp"
 #include "v8_to_string.hpp"
+#include "v8_to_value.hpp"
 #include "../assert.h"
 
 
 
 namespace bw {
 
+	// The promises returned by invoke_native that are still waiting for their reply from the browser process.
+	// They are only ever touched from the renderer thread, so no locking is needed.
+	class PendingReplies {
+		struct Pending {
+			CefRefPtr<CefV8Context> context;
+			CefRefPtr<CefV8Value> resolve;
+			CefRefPtr<CefV8Value> reject;
+		};
+
+		std::map<uint32_t, Pending> pending;
+		uint32_t next_id = 0;
+
+	public:
+		uint32_t add( CefRefPtr<CefV8Context> context, CefRefPtr<CefV8Value> resolve, CefRefPtr<CefV8Value> reject ) {
+			uint32_t id = this->next_id++;
+			this->pending[id] = { context, resolve, reject };
+			return id;
+		}
+
+		// Resolves or rejects the promise with the given string, if its page is still there
+		void settle( uint32_t id, bool success, const CefString& value ) {
+			auto it = this->pending.find( id );
+			if ( it == this->pending.end() )
+				return;
+			Pending settled = it->second;
+			this->pending.erase( it );
+
+			if ( !settled.context->IsValid() )
+				return;
+
+			CefV8ValueList args;
+			args.push_back( CefV8Value::CreateString( value ) );
+			settled.context->Enter();
+			( success ? settled.resolve : settled.reject )->ExecuteFunction( nullptr, args );
+			settled.context->Exit();
+		}
+
+		// Forgets the promises of a page that is being unloaded, as their functions can't be called anymore
+		void release( CefRefPtr<CefV8Context> context ) {
+			for ( auto it = this->pending.begin(); it != this->pending.end(); ) {
+				if ( it->second.context->IsSame( context ) )
+					it = this->pending.erase( it );
+				else
+					it++;
+			}
+		}
+	};
+
+	// The number of calls of invoke_extern that the browser process lets a browser have waiting, as it has told the renderer process.
+	struct InvocationCredits {
+		unsigned int limit = 0;	// 0 if there is no limit
+		unsigned int in_flight = 0;	// The calls that have been sent, but not yet acknowledged
+	};
+
+	// The commands that the browser process has registered for a browser, of which invoke_extern sends the id instead of the name.
+	struct RegisteredCommands {
+		std::unordered_map<std::string, unsigned int> ids;
+		unsigned int count = 0;	// The highest id that has been registered
+
+		// The id of the command that `cmd` names or is the id of, or 0 if it isn't registered.
+		unsigned int find( CefRefPtr<CefV8Value> cmd ) const {
+			if ( cmd->IsUInt() ) {
+				unsigned int id = cmd->GetUIntValue();
+				return id <= this->count ? id : 0;
+			}
+			if ( cmd->IsString() && !this->ids.empty() ) {
+				auto it = this->ids.find( cmd->GetStringValue().ToString() );
+				if ( it != this->ids.end() )
+					return it->second;
+			}
+			return 0;
+		}
+	};
+
+	// Evaluates to a function that returns a new promise along with the functions that resolve and reject it.
+	// CEF can't create promises by itself, so this is compiled once for every page instead.
+	const char PROMISE_FACTORY_JS[] = "(function() {"
+		"let settle;"
+		"const promise = new Promise( ( resolve, reject ) => { settle = [ resolve, message => reject( new Error( message ) ) ]; } );"
+		"return [ promise, settle[0], settle[1] ];"
+	"})";
+
 	class ExternalInvocationHandler : public CefV8Handler {
 		CefRefPtr<CefBrowser> cef_browser;
+		// Whether the arguments are sent as structured values, instead of as strings
+		bool structured;
+		// Whether the calls of invoke_extern are collected in `batch`, instead of being sent one by one
+		bool batched;
+		// The calls of invoke_extern made during the current task, which are sent once the task has finished
+		CefRefPtr<CefListValue> batch;
+		// The bytes written with write_extern_stream, which are sent once the task has finished, or when there are enough of them
+		std::vector<uint8_t> stream;
+		bool flush_scheduled;
+		// The ids of the browsers of which the browser process reads the stream
+		const std::set<int>* stream_readers;
+		PendingReplies* replies;
+		InvocationCredits* credits;
+		const RegisteredCommands* commands;
+		// The function made by `PROMISE_FACTORY_JS` for the page of this handler
+		CefRefPtr<CefV8Value> promise_factory;
 
 	public:
-		ExternalInvocationHandler( CefRefPtr<CefBrowser> browser ) : cef_browser(browser) {}
+		ExternalInvocationHandler( CefRefPtr<CefBrowser> browser, bool structured, bool batched, PendingReplies* replies, InvocationCredits* credits, const RegisteredCommands* commands, const std::set<int>* stream_readers, CefRefPtr<CefV8Value> promise_factory ) :
+			cef_browser(browser), structured(structured), batched(batched), flush_scheduled(false), stream_readers(stream_readers), replies(replies), credits(credits), commands(commands), promise_factory(promise_factory) {}
+
+		// Sends all calls that have been batched so far in one message, and the bytes written to the stream in another
+		void flush() {
+			this->flush_scheduled = false;
+			this->flushStream();
+
+			if ( this->batch == nullptr )
+				return;
+
+			CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-handler-batch");
+			msg->GetArgumentList()->SetList( 0, this->batch );
+			this->batch = nullptr;
+
+			this->cef_browser->GetMainFrame()->SendProcessMessage( PID_BROWSER, msg );
+		}
+
+		void flushStream() {
+			if ( this->stream.empty() )
+				return;
+
+			CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("stream-data");
+			msg->GetArgumentList()->SetBinary( 0, CefBinaryValue::Create( this->stream.data(), this->stream.size() ) );
+			this->stream.clear();
+
+			this->cef_browser->GetMainFrame()->SendProcessMessage( PID_BROWSER, msg );
+		}
 
 		virtual bool Execute(
 			const CefString& name,
@@ -26,18 +159,138 @@ namespace bw {
 			CefString& exception
 		) override  {
 			(void)(object);
-			(void)(retval);
-			(void)(exception);
 
-			if ( name == "invoke_extern" ) {
+			if ( name == "invoke_extern" && this->structured ) {
+
+				if ( arguments.size() == 0 ) {
+					exception = "invoke_extern needs a command";
+					return true;
+				}
+
+				CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-structured-handler");
+				CefRefPtr<CefListValue> msg_args = msg->GetArgumentList();
+
+				// The command is always a string, but all other arguments are sent along as they are
+				size_t index = 0;
+				for ( auto it = arguments.begin(); it != arguments.end(); it++, index++ ) {
+
+					if ( index == 0 ) {
+						msg_args->SetString( index, V8ToString::convert(*it) );
+						continue;
+					}
+
+					// Like with JSON.stringify, an argument that can't be converted throws, and the call isn't made
+					CefString error;
+					CefRefPtr<CefValue> value = V8ToValue::convert( *it, error );
+					if ( !error.empty() ) {
+						exception = error;
+						return true;
+					}
+					if ( value != nullptr )
+						msg_args->SetValue( index, value );
+					else
+						msg_args->SetNull( index );
+				}
+
+				this->cef_browser->GetMainFrame()->SendProcessMessage( PID_BROWSER, msg );
+			}
+			else if ( name == "invoke_extern_binary" ) {
+
+				CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-binary-handler");
+				CefRefPtr<CefListValue> msg_args = msg->GetArgumentList();
+
+				if ( arguments.size() < 1 ) {
+					exception = "invoke_extern_binary expects a command and an ArrayBuffer or typed array";
+					return true;
+				}
+				msg_args->SetString( 0, V8ToString::convert( arguments[0] ) );
+
+				// The data is left out when it is empty
+				if ( arguments.size() >= 2 ) {
+					CefRefPtr<CefBinaryValue> data = V8ToValue::convertBinary( arguments[1] );
+					if ( data != nullptr )
+						msg_args->SetBinary( 1, data );
+				}
+
+				this->cef_browser->GetMainFrame()->SendProcessMessage( PID_BROWSER, msg );
+			}
+			else if ( name == "invoke_extern" && this->batched ) {
+
+				if ( arguments.size() == 0 ) {
+					exception = "invoke_extern needs a command";
+					return true;
+				}
+
+				CefRefPtr<CefListValue> call = CefListValue::Create();
+				for ( size_t i = 0; i < arguments.size(); i++ ) {
+					call->SetString( i, V8ToString::convert( arguments[i] ) );
+				}
+
+				// The batch is flushed by a task that is posted behind the one that is running now, which includes its microtasks
+				if ( this->batch == nullptr )
+					this->batch = CefListValue::Create();
+				if ( !this->flush_scheduled )
+					this->scheduleFlush();
+				this->batch->SetList( this->batch->GetSize(), call );
+			}
+			else if ( name == "write_extern_stream" ) {
+
+				// Without a handler, the data would be dropped without the page ever knowing
+				if ( this->stream_readers->count( this->cef_browser->GetIdentifier() ) == 0 ) {
+					exception = "write_extern_stream can't be used, because the application doesn't read the page's stream";
+					return true;
+				}
+
+				bool is_binary = false;
+				CefRefPtr<CefBinaryValue> data = arguments.size() == 1 ? V8ToValue::convertBinary( arguments[0], &is_binary ) : nullptr;
+				if ( !is_binary ) {
+					exception = "write_extern_stream expects an ArrayBuffer or typed array";
+					return true;
+				}
+
+				if ( data != nullptr ) {
+					size_t offset = this->stream.size();
+					this->stream.resize( offset + data->GetSize() );
+					data->GetData( this->stream.data() + offset, data->GetSize(), 0 );
+				}
+
+				// Just like the stream to the page, it is sent after the current task, or as soon as 1 MiB is buffered
+				if ( this->stream.size() >= STREAM_FLUSH_THRESHOLD )
+					this->flushStream();
+				else if ( !this->stream.empty() && !this->flush_scheduled )
+					this->scheduleFlush();
+			}
+			else if ( name == "invoke_extern" ) {
+
+				if ( arguments.size() == 0 ) {
+					exception = "invoke_extern needs a command";
+					return true;
+				}
+
+				// This is how the page is held back when the invocation queue is full, as it can't wait for the browser process
+				if ( this->credits->limit != 0 ) {
+					if ( this->credits->in_flight >= this->credits->limit ) {
+						exception = "invoke_extern has too many calls waiting to be handled";
+						return true;
+					}
+					this->credits->in_flight += 1;
+				}
 
 				CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-handler");
 				CefRefPtr<CefListValue> msg_args = msg->GetArgumentList();
 
+				// A registered command is sent as its id, so that the browser process doesn't need to look up its name
+				unsigned int command_id = this->commands->find( arguments[0] );
+
 				// Convert all function arguments to strings
 				size_t index = 0;
 				for ( auto it = arguments.begin(); it != arguments.end(); it++, index++ ) {
 
+					if ( index == 0 && command_id != 0 ) {
+						msg_args->SetInt( index, (int)command_id );
+						continue;
+					}
+
 					CefString string = V8ToString::convert(*it);
 
 					msg_args->SetString( index, string );
@@ -45,13 +298,67 @@ namespace bw {
 
 				this->cef_browser->GetMainFrame()->SendProcessMessage( PID_BROWSER, msg );
 			}
+			else if ( name == "invoke_native" ) {
+
+				if ( arguments.size() < 1 ) {
+					exception = "invoke_native expects a command";
+					return true;
+				}
+
+				CefRefPtr<CefV8Value> settlers;
+				if ( this->promise_factory != nullptr )
+					settlers = this->promise_factory->ExecuteFunction( nullptr, CefV8ValueList() );
+				if ( settlers == nullptr || !settlers->IsArray() ) {
+					exception = "Unable to create a promise for invoke_native";
+					return true;
+				}
+
+				// The request id is sent along, so that the reply can settle the promise without evaluating anything
+				uint32_t request_id = this->replies->add( CefV8Context::GetCurrentContext(), settlers->GetValue( 1 ), settlers->GetValue( 2 ) );
+
+				CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-native-handler");
+				CefRefPtr<CefListValue> msg_args = msg->GetArgumentList();
+				msg_args->SetInt( 0, (int)request_id );
+				for ( size_t i = 0; i < arguments.size(); i++ ) {
+					msg_args->SetString( i + 1, V8ToString::convert( arguments[i] ) );
+				}
+
+				this->cef_browser->GetMainFrame()->SendProcessMessage( PID_BROWSER, msg );
+
+				retval = settlers->GetValue( 0 );
+				return true;
+			}
 
 			return false;
 		}
 
 	protected:
+		static const size_t STREAM_FLUSH_THRESHOLD = 1048576;
+
+		void scheduleFlush();
+
 		IMPLEMENT_REFCOUNTING(ExternalInvocationHandler);
 	};
+
+	// Flushes the batch of an `ExternalInvocationHandler` on the renderer thread.
+	class InvocationFlushTask : public CefTask {
+		CefRefPtr<ExternalInvocationHandler> handler;
+
+	public:
+		InvocationFlushTask( CefRefPtr<ExternalInvocationHandler> handler ) : handler(handler) {}
+
+		virtual void Execute() override {
+			this->handler->flush();
+		}
+
+	protected:
+		IMPLEMENT_REFCOUNTING(InvocationFlushTask);
+	};
+
+	inline void ExternalInvocationHandler::scheduleFlush() {
+		this->flush_scheduled = true;
+		CefPostTask( TID_RENDERER, new InvocationFlushTask( this ) );
+	}
 }
 
 
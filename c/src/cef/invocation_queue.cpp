@@ -0,0 +1,450 @@
+#include "invocation_queue.hpp"
+
+#include "util.hpp"
+#include "worker_pool.hpp"
+#include "../application.h"
+#include "../common.h"
+
+#include <include/cef_process_message.h>
+
+
+
+// Implemented in browser_window/cef.cpp
+void bw_BrowserWindowCef_sendToRenderer( bw_BrowserWindow* bw, CefRefPtr<CefProcessMessage> msg, size_t size );
+
+
+
+void bw::InvocationQueue::close() {
+	// The data of the commands is freed outside of the lock, because that may call back into the user's code
+	std::vector<Command> commands;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		this->bw = nullptr;
+		this->calls.clear();
+		this->by_command.clear();
+		commands.swap( this->commands );
+		this->command_ids.clear();
+	}
+
+	for ( auto it = commands.begin(); it != commands.end(); it++ ) {
+		if ( it->free_user_data != 0 )
+			it->free_user_data( it->user_data );
+	}
+}
+
+void bw::InvocationQueue::metrics( bw_BrowserWindowMetrics* metrics ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	metrics->invocations_dropped = this->dropped;
+	metrics->invoke_queue_depth = this->calls.size();
+	metrics->invoke_queue_peak = this->peak;
+}
+
+void bw::InvocationQueue::push( Invocation&& call ) {
+	std::unique_lock<std::mutex> lock( this->mutex );
+	if ( this->bw == nullptr )
+		return;
+
+	// A page that was loaded before the renderer process knew the id of a command, still sends its name
+	if ( call.command_id == 0 && !this->command_ids.empty() ) {
+		auto id = this->command_ids.find( call.cmd );
+		if ( id != this->command_ids.end() ) {
+			call.command_id = id->second;
+			call.cmd.clear();
+		}
+	}
+	// An id that hasn't been registered is passed on as the name of a command
+	else if ( call.command_id > this->commands.size() ) {
+		call.cmd = std::to_string( call.command_id );
+		call.command_id = 0;
+	}
+
+	if ( this->policy == BW_BROWSER_WINDOW_INVOKE_OVERFLOW_COALESCE ) {
+		auto waiting = this->by_command.find( this->commandName( call ) );
+		if ( waiting != this->by_command.end() ) {
+			// The waiting call keeps its place, but takes the arguments of the latest one
+			waiting->second->params = std::move( call.params );
+			this->dropped += 1;
+			return;
+		}
+	}
+
+	if ( this->limit != 0 && this->calls.size() >= this->limit ) {
+		// The renderer process holds back calls by itself, so only calls that were on their way when the limit was set get here.
+		// As the queue isn't empty, the dispatch that acknowledges them is already pending.
+		if ( this->policy == BW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK ) {
+			this->dropped += 1;
+			this->unacknowledged += 1;
+			return;
+		}
+		this->dropOldest();
+	}
+
+	this->calls.push_back( std::move( call ) );
+	if ( this->policy == BW_BROWSER_WINDOW_INVOKE_OVERFLOW_COALESCE )
+		this->by_command[ this->commandName( this->calls.back() ) ] = std::prev( this->calls.end() );
+	if ( this->calls.size() > this->peak )
+		this->peak = this->calls.size();
+
+	if ( !this->dispatch_pending ) {
+		this->dispatch_pending = true;
+		bw_Application* app = this->bw->window->app;
+		lock.unlock();
+
+		// The reference is given to the dispatch, which releases it once it has handled the calls
+		this->AddRef();
+		bw_Application_dispatch( app, handle, this );
+	}
+}
+
+unsigned int bw::InvocationQueue::registerCommand( bw_CStrSlice name, bw_BrowserWindowCommandHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	unsigned int command_id;
+	bw_BrowserWindow* bw;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		Command command;
+		command.name = std::string( name.data, name.len );
+		command.handler = handler;
+		command.user_data = user_data;
+		command.free_user_data = free_user_data;
+		this->commands.push_back( std::move( command ) );
+		command_id = (unsigned int)this->commands.size();
+		this->command_ids[ this->commands.back().name ] = command_id;
+		bw = this->bw;
+	}
+
+	if ( bw != nullptr && bw->impl.cef_ptr != 0 )
+		sendCommands( bw, command_id, { std::string( name.data, name.len ) } );
+	return command_id;
+}
+
+void bw::InvocationQueue::sendCommands() {
+	std::vector<std::string> names;
+	bw_BrowserWindow* bw;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		if ( this->commands.empty() )
+			return;
+		for ( auto it = this->commands.begin(); it != this->commands.end(); it++ ) {
+			names.push_back( it->name );
+		}
+		bw = this->bw;
+	}
+	if ( bw == nullptr || bw->impl.cef_ptr == 0 )
+		return;
+
+	sendCommands( bw, 1, names );
+}
+
+void bw::InvocationQueue::sendCommands( bw_BrowserWindow* bw, unsigned int first_id, const std::vector<std::string>& names ) {
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("register-commands");
+	CefRefPtr<CefListValue> args = msg->GetArgumentList();
+	args->SetInt( 0, (int)first_id );
+
+	CefRefPtr<CefListValue> names_list = CefListValue::Create();
+	size_t size = 0;
+	for ( size_t i = 0; i < names.size(); i++ ) {
+		names_list->SetString( i, names[i] );
+		size += names[i].size();
+	}
+	args->SetList( 1, names_list );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, size );
+}
+
+void bw::InvocationQueue::sendLimit() {
+	size_t limit;
+	bw_BrowserWindow* bw;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		limit = this->policy == BW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK ? this->limit : 0;
+		bw = this->bw;
+	}
+	if ( bw == nullptr || bw->impl.cef_ptr == 0 )
+		return;
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("set-invoke-limit");
+	msg->GetArgumentList()->SetInt( 0, (int)limit );
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, 0 );
+}
+
+void bw::InvocationQueue::setLimit( size_t limit, bw_BrowserWindowInvokeOverflow policy ) {
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		this->limit = limit;
+		this->policy = policy;
+		if ( policy == BW_BROWSER_WINDOW_INVOKE_OVERFLOW_COALESCE ) {
+			this->by_command.clear();
+			for ( auto it = this->calls.begin(); it != this->calls.end(); it++ ) {
+				this->by_command[ this->commandName( *it ) ] = it;
+			}
+		}
+		else
+			this->by_command.clear();
+
+		// A lower limit applies to the calls that are already waiting as well, unless they would have been held back
+		while ( policy != BW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK && limit != 0 && this->calls.size() > limit ) {
+			this->dropOldest();
+		}
+	}
+
+	this->sendLimit();
+}
+
+bw_BrowserWindow* bw::InvocationQueue::browserWindow() {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	return this->bw;
+}
+
+const std::string& bw::InvocationQueue::commandName( const Invocation& call ) const {
+	return call.command_id != 0 ? this->commands[ call.command_id - 1 ].name : call.cmd;
+}
+
+void bw::InvocationQueue::dropOldest() {
+	auto oldest = this->by_command.find( this->commandName( this->calls.front() ) );
+	if ( oldest != this->by_command.end() && oldest->second == this->calls.begin() )
+		this->by_command.erase( oldest );
+
+	this->calls.pop_front();
+	this->dropped += 1;
+}
+
+void bw::InvocationQueue::handle( bw_Application* app, void* data ) {
+	UNUSED( app );
+	InvocationQueue* queue = (InvocationQueue*)data;
+
+	std::list<Invocation> calls;
+	bool acknowledge;
+	size_t handled = 0;
+	{
+		std::lock_guard<std::mutex> lock( queue->mutex );
+
+		calls.swap( queue->calls );
+		queue->by_command.clear();
+		queue->dispatch_pending = false;
+		acknowledge = queue->policy == BW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK && queue->limit != 0;
+		handled = queue->unacknowledged;
+		queue->unacknowledged = 0;
+	}
+
+	std::vector<bw_CStrSlice> params_slices;
+	for ( auto it = calls.begin(); it != calls.end(); it++ ) {
+
+		// A handler may destroy the browser window
+		bw_BrowserWindow* bw = queue->browserWindow();
+		if ( bw == nullptr )
+			break;
+
+		params_slices.clear();
+		for ( size_t i = 0; i < it->params.size(); i++ ) {
+			params_slices.push_back( { it->params[i].length(), it->params[i].c_str() } );
+		}
+
+		bw_LatencyHistogram_record( &bw->metrics.invoke, bw_cef_microsecondsSince( it->received_at ) );
+		if ( it->command_id != 0 ) {
+			bw_BrowserWindowCommandHandlerFn handler;
+			void* user_data;
+			{
+				std::lock_guard<std::mutex> lock( queue->mutex );
+				if ( queue->commands.size() < it->command_id )
+					break;
+				handler = queue->commands[ it->command_id - 1 ].handler;
+				user_data = queue->commands[ it->command_id - 1 ].user_data;
+			}
+
+			handler( bw, user_data, it->command_id, params_slices.data(), params_slices.size() );
+		}
+		else {
+			bw->external_handler(
+				bw,
+				{ it->cmd.length(), it->cmd.c_str() },
+				params_slices.data(),
+				params_slices.size()
+			);
+		}
+		handled += 1;
+	}
+
+	// The renderer process counts the calls that it has sent, and holds back new ones while there are as many as the limit
+	bw_BrowserWindow* bw = queue->browserWindow();
+	if ( acknowledge && bw != nullptr && handled > 0 ) {
+		CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("invoke-ack");
+		msg->GetArgumentList()->SetInt( 0, (int)handled );
+		bw_BrowserWindowCef_sendToRenderer( bw, msg, 0 );
+	}
+
+	queue->Release();
+}
+
+
+
+unsigned int bw::NativeRequests::add( CefRefPtr<CefFrame> frame, unsigned int renderer_id ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	// Zero is skipped when the ids wrap around, and so is any id that is still waiting
+	unsigned int id;
+	do {
+		id = this->next_id++;
+	}
+	while ( id == 0 || this->requests.count( id ) != 0 );
+
+	this->requests[id] = { frame, renderer_id };
+	return id;
+}
+
+bool bw::NativeRequests::take( unsigned int request_id, CefRefPtr<CefFrame>& frame, unsigned int& renderer_id ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	auto it = this->requests.find( request_id );
+	if ( it == this->requests.end() )
+		return false;
+	frame = it->second.frame;
+	renderer_id = it->second.renderer_id;
+	this->requests.erase( it );
+
+	// A frame that has been navigated away from, or of which the renderer process has been swapped, is not valid anymore
+	return frame->IsValid();
+}
+
+
+
+unsigned int bw::RegisteredScripts::add( bw_CStrSlice name, bw_CStrSlice source ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	this->scripts.push_back( { std::string( name.data, name.len ), std::string( source.data, source.len ) } );
+	return (unsigned int)this->scripts.size();
+}
+
+void bw::RegisteredScripts::send( bw_BrowserWindow* bw, unsigned int first_id ) {
+	if ( bw->impl.cef_ptr == 0 )
+		return;
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("register-scripts");
+	CefRefPtr<CefListValue> args = msg->GetArgumentList();
+	CefRefPtr<CefListValue> names = CefListValue::Create();
+	CefRefPtr<CefListValue> sources = CefListValue::Create();
+	size_t size = 0;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		if ( first_id > this->scripts.size() )
+			return;
+		for ( size_t i = first_id - 1; i < this->scripts.size(); i++ ) {
+			names->SetString( i - (first_id - 1), this->scripts[i].name );
+			sources->SetString( i - (first_id - 1), this->scripts[i].source );
+			size += this->scripts[i].name.size() + this->scripts[i].source.size();
+		}
+	}
+	args->SetInt( 0, (int)first_id );
+	args->SetList( 1, names );
+	args->SetList( 2, sources );
+
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, size );
+}
+
+
+
+bw::StreamReader::~StreamReader() {
+	if ( this->free_user_data != 0 )
+		this->free_user_data( this->user_data );
+}
+
+void bw::StreamReader::set( bw_BrowserWindow* bw, bw_BrowserWindowStreamHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	void* replaced_data;
+	bw_ResourceFreeFn free_replaced;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		replaced_data = this->user_data;
+		free_replaced = this->free_user_data;
+		this->handler = handler;
+		this->user_data = user_data;
+		this->free_user_data = free_user_data;
+	}
+
+	if ( free_replaced != 0 )
+		free_replaced( replaced_data );
+	this->send( bw );
+}
+
+void bw::StreamReader::send( bw_BrowserWindow* bw ) {
+	if ( bw->impl.cef_ptr == 0 )
+		return;
+
+	bool handled;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+		handled = this->handler != 0;
+	}
+
+	CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create("set-stream-reader");
+	msg->GetArgumentList()->SetBool( 0, handled );
+	bw_BrowserWindowCef_sendToRenderer( bw, msg, 0 );
+}
+
+void bw::StreamReader::read( bw_BrowserWindow* bw, const uint8_t* data, size_t size ) {
+	bw_BrowserWindowStreamHandlerFn handler;
+	void* user_data;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		handler = this->handler;
+		user_data = this->user_data;
+	}
+
+	// The data may still have been underway when the handler got removed
+	if ( handler != 0 )
+		handler( bw, user_data, data, size );
+}
+
+
+
+bw::ThreadedHandler::~ThreadedHandler() {
+	if ( this->free_user_data != 0 )
+		this->free_user_data( this->user_data );
+}
+
+void bw::ThreadedHandler::close() {
+	this->closed = true;
+}
+
+void bw::ThreadedHandler::push( Invocation&& call ) {
+	CefRefPtr<ThreadedHandler> handler = this;
+
+	// A std::function needs to be copyable, which is why the call is shared instead of moved into it
+	auto shared_call = std::make_shared<Invocation>( std::move( call ) );
+	bw::worker_pool.submit( [handler, shared_call]() {
+		handler->handle( *shared_call );
+	} );
+}
+
+void bw::ThreadedHandler::handle( const Invocation& call ) {
+	if ( this->closed )
+		return;
+
+	std::vector<bw_CStrSlice> params_slices;
+	params_slices.reserve( call.params.size() );
+	for ( size_t i = 0; i < call.params.size(); i++ ) {
+		params_slices.push_back( { call.params[i].length(), call.params[i].c_str() } );
+	}
+
+	// The slot of the browser window stays valid, so it can be looked up from here, but the window may have been closed since the call was pushed
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( this->app, this->bw_id );
+	if ( bw == nullptr )
+		return;
+
+	bw_LatencyHistogram_record( &bw->metrics.invoke, bw_cef_microsecondsSince( call.received_at ) );
+	this->handler(
+		bw,
+		this->user_data,
+		{ call.cmd.length(), call.cmd.c_str() },
+		params_slices.data(),
+		params_slices.size()
+	);
+}
@@ -0,0 +1,183 @@
+#ifndef BW_CEF_INVOCATION_QUEUE_HPP
+#define BW_CEF_INVOCATION_QUEUE_HPP
+
+#include "../browser_window.h"
+
+#include <include/cef_base.h>
+#include <include/cef_frame.h>
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace bw {
+
+	// A call of invoke_extern that is waiting for the GUI thread.
+	struct Invocation {
+		std::string cmd;	// Left empty for a registered command
+		unsigned int command_id = 0;	// The id of the registered command, or 0
+		std::vector<std::string> params;
+		std::chrono::steady_clock::time_point received_at;
+	};
+
+	// The calls of invoke_extern of one browser window that are waiting to be handed to its handler.
+	// Calls are pushed on CEF's UI thread and handled on the GUI thread, which only differ on Windows.
+	// All calls that are waiting are handled by the same dispatch, so that a busy page doesn't flood the GUI thread with them.
+	// The commands registered with bw_BrowserWindow_registerCommand are kept here as well, because their calls are routed by the queue.
+	class InvocationQueue : public CefBaseRefCounted {
+		struct Command {
+			std::string name;
+			bw_BrowserWindowCommandHandlerFn handler;
+			void* user_data;
+			bw_ResourceFreeFn free_user_data;
+		};
+
+		std::mutex mutex;
+		bw_BrowserWindow* bw;	// Is set to null when the browser window gets destroyed while a dispatch is still pending
+		std::list<Invocation> calls;
+		// The registered commands by their id minus one, and their ids by name
+		std::vector<Command> commands;
+		std::unordered_map<std::string, unsigned int> command_ids;
+		// The waiting calls by their command, which is only kept for the coalesce policy
+		std::unordered_map<std::string, std::list<Invocation>::iterator> by_command;
+		size_t limit;	// 0 if there is no limit
+		bw_BrowserWindowInvokeOverflow policy;
+		size_t peak;
+		uint64_t dropped;
+		// The calls that have been dropped while the renderer process still counts them as waiting
+		size_t unacknowledged;
+		bool dispatch_pending;
+
+	public:
+		InvocationQueue( bw_BrowserWindow* bw ) : bw(bw), limit(0), policy(BW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK), peak(0), dropped(0), unacknowledged(0), dispatch_pending(false) {}
+
+		// Forgets the browser window, after which waiting calls are dropped instead of handled, and frees the data of the registered commands.
+		void close();
+		// Tells the renderer process the ids of all registered commands.
+		void sendCommands();
+		// Fills in the queue depth and the number of dropped calls.
+		void metrics( bw_BrowserWindowMetrics* metrics );
+		// Queues the call according to the overflow policy, and makes sure that a dispatch to handle it is pending.
+		void push( Invocation&& call );
+		unsigned int registerCommand( bw_CStrSlice name, bw_BrowserWindowCommandHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+		// Tells the renderer process how many calls it may have waiting, if it is supposed to hold back calls.
+		void sendLimit();
+		void setLimit( size_t limit, bw_BrowserWindowInvokeOverflow policy );
+
+	protected:
+		static void handle( bw_Application* app, void* data );
+		bw_BrowserWindow* browserWindow();
+		// The name under which the call is coalesced; must be called with the mutex locked.
+		const std::string& commandName( const Invocation& call ) const;
+		// Removes the oldest waiting call; must be called with the mutex locked.
+		void dropOldest();
+		// Sends the names of the commands from `first_id` onwards to the renderer process.
+		static void sendCommands( bw_BrowserWindow* bw, unsigned int first_id, const std::vector<std::string>& names );
+
+		IMPLEMENT_REFCOUNTING(InvocationQueue);
+	};
+
+	// The calls of invoke_native of one browser window that are waiting for their reply, with the frame that has made them.
+	// The renderer process numbers its requests by itself, so the ids of a new renderer process after a navigation would overlap with those of the old one.
+	// That is why the handler gets an id of the browser process instead, and the reply only goes to the frame that made the request, if it is still there.
+	class NativeRequests : public CefBaseRefCounted {
+		struct Request {
+			CefRefPtr<CefFrame> frame;
+			unsigned int renderer_id;	// The id that the renderer process has given the request
+		};
+
+		std::mutex mutex;
+		std::unordered_map<unsigned int, Request> requests;
+		unsigned int next_id;
+
+	public:
+		NativeRequests() : next_id(1) {}
+
+		// Remembers the request, and gives back the id under which it is to be replied to.
+		unsigned int add( CefRefPtr<CefFrame> frame, unsigned int renderer_id );
+		// Forgets the request, and gives back the frame and the renderer's id if the frame can still receive the reply.
+		bool take( unsigned int request_id, CefRefPtr<CefFrame>& frame, unsigned int& renderer_id );
+
+		IMPLEMENT_REFCOUNTING(NativeRequests);
+	};
+
+	// The scripts registered with bw_BrowserWindow_registerScript, which are kept in the browser process.
+	// A navigation may swap the renderer process for a new one, so they are sent again whenever a main frame starts loading.
+	class RegisteredScripts : public CefBaseRefCounted {
+		struct Script {
+			std::string name;
+			std::string source;
+		};
+
+		std::mutex mutex;
+		std::vector<Script> scripts;	// The id of a script is its index plus one
+
+	public:
+		// Remembers the script, and gives back its id.
+		unsigned int add( bw_CStrSlice name, bw_CStrSlice source );
+		// Sends the scripts from `first_id` onwards to the renderer process, if the browser has been created yet.
+		void send( bw_BrowserWindow* bw, unsigned int first_id = 1 );
+
+		IMPLEMENT_REFCOUNTING(RegisteredScripts);
+	};
+
+	// The handler of the bytes that the page writes to the application with write_extern_stream.
+	// The renderer process is told whether there is one, so that the page's writes fail loudly instead of being dropped, which is sent again whenever a main frame starts loading.
+	class StreamReader : public CefBaseRefCounted {
+		std::mutex mutex;
+		bw_BrowserWindowStreamHandlerFn handler;
+		void* user_data;
+		bw_ResourceFreeFn free_user_data;
+
+	public:
+		StreamReader() : handler(0), user_data(0), free_user_data(0) {}
+		~StreamReader();
+
+		// Replaces the handler, and tells the renderer process whether there is one.
+		void set( bw_BrowserWindow* bw, bw_BrowserWindowStreamHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+		// Tells the renderer process whether there is a handler, if the browser has been created yet.
+		void send( bw_BrowserWindow* bw );
+		// Passes the bytes to the handler, on the GUI thread.
+		void read( bw_BrowserWindow* bw, const uint8_t* data, size_t size );
+
+		IMPLEMENT_REFCOUNTING(StreamReader);
+	};
+
+	// Hands the calls of invoke_extern of one browser window to its threaded handler, on the worker pool.
+	// Every call that is waiting or running holds a reference, so the handler's data is only freed after the last one, even if the browser window is gone by then.
+	// The browser window is referred to by its id, because it may be freed on the GUI thread at any time while a call is running.
+	class ThreadedHandler : public CefBaseRefCounted {
+		bw_Application* app;
+		bw_BrowserWindowId bw_id;
+		std::atomic<bool> closed;	// Is set when the browser window gets destroyed
+		bw_BrowserWindowThreadedHandlerFn handler;
+		void* user_data;
+		bw_ResourceFreeFn free_user_data;
+
+	public:
+		ThreadedHandler( bw_BrowserWindow* bw, bw_BrowserWindowThreadedHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) :
+			app(bw->window->app), bw_id(bw_BrowserWindow_getId( bw )), closed(false), handler(handler), user_data(user_data), free_user_data(free_user_data) {}
+		~ThreadedHandler();
+
+		// Forgets the browser window, after which the calls that haven't started yet are dropped.
+		void close();
+		// Submits the call to the worker pool.
+		void push( Invocation&& call );
+
+	protected:
+		void handle( const Invocation& call );
+
+		IMPLEMENT_REFCOUNTING(ThreadedHandler);
+	};
+}
+
+
+
+#endif//BW_CEF_INVOCATION_QUEUE_HPP
@@ -0,0 +1,109 @@
+#include "mapped_file.hpp"
+
+#ifdef BW_WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+#ifdef BW_WIN32
+
+std::shared_ptr<const bw::MappedFile> bw::MappedFile::open( const std::string& path ) {
+	int length = MultiByteToWideChar( CP_UTF8, 0, path.c_str(), (int)path.size(), nullptr, 0 );
+	std::wstring wide_path( (size_t)length, L'\0' );
+	MultiByteToWideChar( CP_UTF8, 0, path.c_str(), (int)path.size(), &wide_path[0], length );
+
+	HANDLE file = CreateFileW( wide_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+	if ( file == INVALID_HANDLE_VALUE )
+		return nullptr;
+
+	LARGE_INTEGER size;
+	if ( !GetFileSizeEx( file, &size ) ) {
+		CloseHandle( file );
+		return nullptr;
+	}
+
+	std::shared_ptr<MappedFile> mapped( new MappedFile() );
+	mapped->mapping = nullptr;
+	FILETIME modified;
+	if ( GetFileTime( file, nullptr, nullptr, &modified ) )
+		mapped->modified_ = ((uint64_t)modified.dwHighDateTime << 32) | modified.dwLowDateTime;
+
+	// Empty files can't be mapped
+	if ( size.QuadPart > 0 ) {
+		HANDLE mapping = CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+		if ( mapping == nullptr ) {
+			CloseHandle( file );
+			return nullptr;
+		}
+
+		mapped->mapping = mapping;
+		mapped->data_ = (const char*)MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+		if ( mapped->data_ == nullptr ) {
+			CloseHandle( file );
+			return nullptr;
+		}
+		mapped->size_ = (size_t)size.QuadPart;
+	}
+
+	// The mapping keeps the file open by itself
+	CloseHandle( file );
+	return mapped;
+}
+
+bw::MappedFile::~MappedFile() {
+	if ( this->data_ != nullptr )
+		UnmapViewOfFile( this->data_ );
+	if ( this->mapping != nullptr )
+		CloseHandle( (HANDLE)this->mapping );
+}
+
+#else
+
+std::shared_ptr<const bw::MappedFile> bw::MappedFile::open( const std::string& path ) {
+	int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+	if ( fd == -1 )
+		return nullptr;
+
+	struct stat info;
+	if ( fstat( fd, &info ) != 0 || !S_ISREG( info.st_mode ) ) {
+		close( fd );
+		return nullptr;
+	}
+
+	std::shared_ptr<MappedFile> mapped( new MappedFile() );
+#ifdef BW_MACOS
+	mapped->modified_ = (uint64_t)info.st_mtimespec.tv_sec * 1000000000ULL + (uint64_t)info.st_mtimespec.tv_nsec;
+#else
+	mapped->modified_ = (uint64_t)info.st_mtim.tv_sec * 1000000000ULL + (uint64_t)info.st_mtim.tv_nsec;
+#endif
+
+	// Empty files can't be mapped
+	if ( info.st_size > 0 ) {
+		void* data = mmap( nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+		if ( data == MAP_FAILED ) {
+			close( fd );
+			return nullptr;
+		}
+
+		mapped->data_ = (const char*)data;
+		mapped->size_ = (size_t)info.st_size;
+	}
+
+	// The mapping stays valid after the file descriptor is closed
+	close( fd );
+	return mapped;
+}
+
+bw::MappedFile::~MappedFile() {
+	if ( this->data_ != nullptr )
+		munmap( (void*)this->data_, this->size_ );
+}
+
+#endif
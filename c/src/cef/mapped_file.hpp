@@ -0,0 +1,44 @@
+#ifndef BW_CEF_MAPPED_FILE_HPP
+#define BW_CEF_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+
+
+namespace bw {
+
+	// A read-only memory mapping of a whole file.
+	// The contents are paged in by the OS when they are read, so opening a file doesn't read anything from disk yet.
+	class MappedFile {
+		const char* data_;
+		size_t size_;
+		uint64_t modified_;
+#ifdef BW_WIN32
+		void* mapping;
+#endif
+
+		MappedFile() : data_(nullptr), size_(0), modified_(0) {}
+
+	public:
+		MappedFile( const MappedFile& ) = delete;
+		MappedFile& operator=( const MappedFile& ) = delete;
+		~MappedFile();
+
+		// Maps the file at the given (UTF-8 encoded) path.
+		// Returns null if the file can't be opened, or if it is a directory.
+		static std::shared_ptr<const MappedFile> open( const std::string& path );
+
+		// Is null for empty files
+		const char* data() const { return this->data_; }
+		size_t size() const { return this->size_; }
+		// The time the file was last written to, in units of the OS, which only serves to tell versions of the file apart
+		uint64_t modified() const { return this->modified_; }
+	};
+}
+
+
+
+#endif//BW_CEF_MAPPED_FILE_HPP
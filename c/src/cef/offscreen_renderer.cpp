@@ -0,0 +1,186 @@
+#include "offscreen_renderer.hpp"
+#include "call_table.hpp"
+#include "worker_pool.hpp"
+
+#include <include/cef_image.h>
+#include <include/cef_values.h>
+
+
+
+// The size of the view when the window doesn't have a size yet
+#define BW_CEF_OFFSCREEN_DEFAULT_WIDTH 800
+#define BW_CEF_OFFSCREEN_DEFAULT_HEIGHT 600
+
+
+
+bw::OffscreenRenderer::OffscreenRenderer( bw_BrowserWindow* bw, int width, int height ) :
+	app(bw->window->app),
+	bw_id(bw_BrowserWindow_getId( bw )),
+	width( width > 0 ? width : BW_CEF_OFFSCREEN_DEFAULT_WIDTH ),
+	height( height > 0 ? height : BW_CEF_OFFSCREEN_DEFAULT_HEIGHT ),
+	scale_factor(1.0f)
+{}
+
+void bw::OffscreenRenderer::convertDirtyRects( const RectList& rects ) {
+	this->dirty_rects.clear();
+	for ( auto it = rects.begin(); it != rects.end(); it++ ) {
+		this->dirty_rects.push_back( bw_BrowserWindowRect { it->x, it->y, it->width, it->height } );
+	}
+}
+
+void bw::OffscreenRenderer::capture( uint64_t call_id, bw_BrowserWindowOutputFormat format ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	this->captures.push_back( Capture { call_id, format } );
+}
+
+void bw::OffscreenRenderer::deliverCaptures( std::vector<Capture>&& captures, const void* buffer, int width, int height ) {
+	// The buffer is only valid during the paint, so it is copied before the encoding is left to the worker pool.
+	// A std::function needs to be copyable, which is why the pixels and captures are shared instead of moved into it.
+	auto pixels = std::make_shared<std::vector<uint8_t>>( (const uint8_t*)buffer, (const uint8_t*)buffer + (size_t)width * (size_t)height * 4 );
+	auto shared_captures = std::make_shared<std::vector<Capture>>( std::move( captures ) );
+	bw_Application* app = this->app;
+
+	bw::worker_pool.submit( [app, pixels, shared_captures, width, height]() {
+		// The image is only converted once for every format that has been asked for
+		CefRefPtr<CefImage> image = CefImage::CreateImage();
+		if ( !image->AddBitmap( 1.0f, width, height, CEF_COLOR_TYPE_BGRA_8888, CEF_ALPHA_TYPE_PREMULTIPLIED, pixels->data(), pixels->size() ) )
+			image = nullptr;
+		CefRefPtr<CefBinaryValue> encoded[2];
+
+		for ( auto it = shared_captures->begin(); it != shared_captures->end(); it++ ) {
+			int pixel_width = width;
+			int pixel_height = height;
+			if ( image != nullptr && encoded[it->format] == nullptr ) {
+				if ( it->format == BW_BROWSER_WINDOW_OUTPUT_PNG )
+					encoded[it->format] = image->GetAsPNG( 1.0f, true, pixel_width, pixel_height );
+				else
+					encoded[it->format] = image->GetAsBitmap( 1.0f, CEF_COLOR_TYPE_RGBA_8888, CEF_ALPHA_TYPE_POSTMULTIPLIED, pixel_width, pixel_height );
+			}
+
+			PendingOutput* output = new PendingOutput { it->call_id, false, {}, width, height };
+			if ( encoded[it->format] != nullptr ) {
+				output->data.resize( encoded[it->format]->GetSize() );
+				encoded[it->format]->GetData( output->data.data(), output->data.size(), 0 );
+				output->success = true;
+			}
+			dispatchOutput( app, output );
+		}
+	} );
+}
+
+void bw::OffscreenRenderer::setPaintHandler( bw_BrowserWindowPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	auto next = std::make_shared<Handler<bw_BrowserWindowPaintFn>>( handler, user_data, free_user_data );
+
+	// The previous handler is released outside of the lock, and its data is freed once a paint that is still using it is done
+	std::shared_ptr<Handler<bw_BrowserWindowPaintFn>> previous;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+		previous = std::move( this->paint );
+		this->paint = std::move( next );
+	}
+}
+
+void bw::OffscreenRenderer::setSharedPaintHandler( bw_BrowserWindowSharedPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) {
+	auto next = std::make_shared<Handler<bw_BrowserWindowSharedPaintFn>>( handler, user_data, free_user_data );
+
+	std::shared_ptr<Handler<bw_BrowserWindowSharedPaintFn>> previous;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+		previous = std::move( this->shared_paint );
+		this->shared_paint = std::move( next );
+	}
+}
+
+std::pair<bool, bool> bw::OffscreenRenderer::setViewSize( int width, int height, float scale_factor ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	// CEF needs a view of at least one pixel
+	width = width > 0 ? width : 1;
+	height = height > 0 ? height : 1;
+	bool resized = width != this->width || height != this->height;
+	bool rescaled = scale_factor > 0.0f && scale_factor != this->scale_factor;
+
+	this->width = width;
+	this->height = height;
+	if ( rescaled )
+		this->scale_factor = scale_factor;
+	return std::make_pair( resized, rescaled );
+}
+
+void bw::OffscreenRenderer::GetViewRect( CefRefPtr<CefBrowser> browser, CefRect& rect ) {
+	(void)(browser);
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	// The view rect is in device independent pixels, while our size is in actual pixels
+	rect = CefRect( 0, 0, (int)(this->width / this->scale_factor), (int)(this->height / this->scale_factor) );
+	if ( rect.width < 1 ) rect.width = 1;
+	if ( rect.height < 1 ) rect.height = 1;
+}
+
+bool bw::OffscreenRenderer::GetScreenInfo( CefRefPtr<CefBrowser> browser, CefScreenInfo& screen_info ) {
+	(void)(browser);
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	screen_info.device_scale_factor = this->scale_factor;
+	return true;
+}
+
+void bw::OffscreenRenderer::OnPaint( CefRefPtr<CefBrowser> browser, PaintElementType type, const RectList& dirty_rects, const void* buffer, int width, int height ) {
+	(void)(browser);
+	_bw_Application_markStartupPhase( this->app, &this->app->startup_metrics.first_paint );
+
+	std::vector<Capture> captures;
+	std::shared_ptr<Handler<bw_BrowserWindowPaintFn>> paint;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		// Captures only take frames of the whole view
+		if ( type == PET_VIEW )
+			captures.swap( this->captures );
+		paint = this->paint;
+	}
+	if ( !captures.empty() )
+		this->deliverCaptures( std::move( captures ), buffer, width, height );
+	if ( paint == nullptr || paint->func == 0 )
+		return;
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( this->app, this->bw_id );
+	if ( bw == nullptr )
+		return;
+
+	this->convertDirtyRects( dirty_rects );
+	bw_BrowserWindowFrame frame = {
+		buffer,
+		width,
+		height,
+		this->dirty_rects.data(),
+		this->dirty_rects.size(),
+		type == PET_POPUP
+	};
+	paint->func( bw, paint->user_data, &frame );
+}
+
+void bw::OffscreenRenderer::OnAcceleratedPaint( CefRefPtr<CefBrowser> browser, PaintElementType type, const RectList& dirty_rects, void* shared_handle ) {
+	(void)(browser);
+	_bw_Application_markStartupPhase( this->app, &this->app->startup_metrics.first_paint );
+
+	std::shared_ptr<Handler<bw_BrowserWindowSharedPaintFn>> shared_paint;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+		shared_paint = this->shared_paint;
+	}
+	if ( shared_paint == nullptr || shared_paint->func == 0 )
+		return;
+	bw_BrowserWindow* bw = bw_Application_findBrowserWindow( this->app, this->bw_id );
+	if ( bw == nullptr )
+		return;
+
+	this->convertDirtyRects( dirty_rects );
+	bw_BrowserWindowSharedFrame frame = {
+		shared_handle,
+		this->dirty_rects.data(),
+		this->dirty_rects.size(),
+		type == PET_POPUP
+	};
+	shared_paint->func( bw, shared_paint->user_data, &frame );
+}
@@ -0,0 +1,87 @@
+#ifndef BW_CEF_OFFSCREEN_RENDERER_HPP
+#define BW_CEF_OFFSCREEN_RENDERER_HPP
+
+#include "../browser_window.h"
+
+#include <include/cef_render_handler.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+
+namespace bw {
+
+	// Lets a windowless browser window paint its frames into the paint handlers, instead of into a native window.
+	//
+	// The paint handlers are set on the GUI thread, while CEF paints on its UI thread, which is a different thread on Windows.
+	// So the handlers are swapped while holding the mutex, and a paint holds a reference to the handler that it invokes.
+	// The handler is invoked without the mutex, so that it can use the browser window, and its user data is freed when the last reference is gone.
+	class OffscreenRenderer : public CefRenderHandler {
+
+		// A call of bw_BrowserWindow_captureToBuffer that is waiting for the next frame of the view
+		struct Capture {
+			uint64_t call_id;
+			bw_BrowserWindowOutputFormat format;
+		};
+
+		template <typename F>
+		struct Handler {
+			F func;
+			void* user_data;
+			bw_ResourceFreeFn free_user_data;
+
+			Handler( F func, void* user_data, bw_ResourceFreeFn free_user_data ) :
+				func(func), user_data(user_data), free_user_data(free_user_data) {}
+			Handler( const Handler& ) = delete;
+			~Handler() {
+				if ( this->free_user_data != 0 )
+					this->free_user_data( this->user_data );
+			}
+		};
+
+		// The browser window is looked up by its id for every paint, because CEF may still paint after it has been freed
+		bw_Application* app;
+		bw_BrowserWindowId bw_id;
+		std::mutex mutex;
+		int width;
+		int height;
+		float scale_factor;
+		std::shared_ptr<Handler<bw_BrowserWindowPaintFn>> paint;	// Null if no handler has been set
+		std::shared_ptr<Handler<bw_BrowserWindowSharedPaintFn>> shared_paint;	// Null if no handler has been set
+		// Reused for every frame, so that painting doesn't allocate; only used on CEF's UI thread
+		std::vector<bw_BrowserWindowRect> dirty_rects;
+		std::vector<Capture> captures;
+
+		void convertDirtyRects( const RectList& rects );
+		// Copies the frame for the given captures, and encodes it on the worker pool, from which the results are dispatched to the GUI thread.
+		void deliverCaptures( std::vector<Capture>&& captures, const void* buffer, int width, int height );
+
+	public:
+		OffscreenRenderer( bw_BrowserWindow* bw, int width, int height );
+
+		// Captures the next frame of the view for the call with the given id in the call table.
+		// The caller needs to make sure that a frame is painted.
+		void capture( uint64_t call_id, bw_BrowserWindowOutputFormat format );
+		void setPaintHandler( bw_BrowserWindowPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+		void setSharedPaintHandler( bw_BrowserWindowSharedPaintFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+		// A `scale_factor` of 0 keeps the current scale factor.
+		// Returns whether the size has changed, and whether the scale factor has changed.
+		std::pair<bool, bool> setViewSize( int width, int height, float scale_factor );
+
+		void GetViewRect( CefRefPtr<CefBrowser> browser, CefRect& rect ) override;
+		bool GetScreenInfo( CefRefPtr<CefBrowser> browser, CefScreenInfo& screen_info ) override;
+		void OnPaint( CefRefPtr<CefBrowser> browser, PaintElementType type, const RectList& dirty_rects, const void* buffer, int width, int height ) override;
+		void OnAcceleratedPaint( CefRefPtr<CefBrowser> browser, PaintElementType type, const RectList& dirty_rects, void* shared_handle ) override;
+
+	protected:
+		IMPLEMENT_REFCOUNTING(OffscreenRenderer);
+	};
+}
+
+
+
+#endif//BW_CEF_OFFSCREEN_RENDERER_HPP
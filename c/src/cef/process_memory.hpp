@@ -0,0 +1,51 @@
+#ifndef BW_CEF_PROCESS_MEMORY_HPP
+#define BW_CEF_PROCESS_MEMORY_HPP
+
+#include <cstdint>
+#include <cstdio>
+
+#if defined(BW_WIN32)
+#include <Windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#elif defined(BW_MACOS)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+
+
+// Returns the number of bytes of memory that only the current process uses, or 0 if that can't be determined.
+// This is header only, because it is also needed by the separate executable of the renderer processes.
+inline uint64_t bw_cef_privateBytes() {
+#if defined(BW_WIN32)
+	PROCESS_MEMORY_COUNTERS_EX counters;
+	if ( !GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&counters, sizeof( counters ) ) )
+		return 0;
+	return (uint64_t)counters.PrivateUsage;
+#elif defined(BW_MACOS)
+	// The physical footprint is what the activity monitor shows as the memory of a process
+	task_vm_info_data_t info;
+	mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+	if ( task_info( mach_task_self(), TASK_VM_INFO, (task_info_t)&info, &count ) != KERN_SUCCESS )
+		return 0;
+	return (uint64_t)info.phys_footprint;
+#else
+	// The resident pages that are not shared with other processes
+	FILE* file = fopen( "/proc/self/statm", "r" );
+	if ( file == nullptr )
+		return 0;
+
+	unsigned long long size, resident, shared;
+	int read = fscanf( file, "%llu %llu %llu", &size, &resident, &shared );
+	fclose( file );
+	if ( read != 3 || shared > resident )
+		return 0;
+	return (uint64_t)( resident - shared ) * (uint64_t)sysconf( _SC_PAGESIZE );
+#endif
+}
+
+
+
+#endif//BW_CEF_PROCESS_MEMORY_HPP
@@ -0,0 +1,224 @@
+#include "request_interceptor.hpp"
+
+#include <include/cef_parser.h>
+
+#include <cstring>
+
+
+
+bw::RequestInterceptorMap bw::request_interceptors;
+
+
+
+std::optional<bw::Resource> bw::ResponseCache::find( const std::string& key ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	auto it = this->index.find( key );
+	if ( it == this->index.end() )
+		return std::nullopt;
+
+	// Move it to the front, so that it is evicted last
+	this->entries.splice( this->entries.begin(), this->entries, it->second );
+	return it->second->resource;
+}
+
+size_t bw::ResponseCache::size() {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	return this->used;
+}
+
+void bw::ResponseCache::clear() {
+	// The responses are released outside of the lock, because that may call back into the user's code
+	std::list<Entry> evicted;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		evicted.swap( this->entries );
+		this->index.clear();
+		this->used = 0;
+	}
+}
+
+void bw::ResponseCache::store( const std::string& key, const Resource& resource ) {
+	// Evicted responses are released outside of the lock, because that may call back into the user's code
+	std::list<Entry> evicted;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		Entry entry { key, resource };
+		size_t entry_cost = cost( entry );
+		if ( entry_cost > this->budget )
+			return;
+
+		auto existing = this->index.find( key );
+		if ( existing != this->index.end() ) {
+			this->used -= cost( *existing->second );
+			evicted.splice( evicted.end(), this->entries, existing->second );
+			this->index.erase( existing );
+		}
+
+		while ( this->used + entry_cost > this->budget ) {
+			this->used -= cost( this->entries.back() );
+			this->index.erase( this->entries.back().key );
+			evicted.splice( evicted.end(), this->entries, std::prev( this->entries.end() ) );
+		}
+
+		this->entries.push_front( std::move( entry ) );
+		this->index[key] = this->entries.begin();
+		this->used += entry_cost;
+	}
+}
+
+
+
+bw::RequestInterceptor::RequestInterceptor( bw_BrowserWindow* bw, const bw_BrowserWindowInterceptOptions* options, bw_BrowserWindowRequestHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data ) :
+	bw(bw), url_prefix(options->url_prefix.data, options->url_prefix.len), handler(handler), user_data(user_data), free_user_data(free_user_data)
+{
+	if ( options->cache_budget > 0 )
+		this->cache.emplace( options->cache_budget );
+
+	// The header names are case insensitive, so they are looked up in lower case
+	std::string names( options->cache_key_headers.data, options->cache_key_headers.len );
+	size_t start = 0;
+	while ( start <= names.size() ) {
+		size_t end = names.find( ',', start );
+		if ( end == std::string::npos )
+			end = names.size();
+
+		std::string name = names.substr( start, end - start );
+		name.erase( 0, name.find_first_not_of( " \t" ) );
+		name.erase( name.find_last_not_of( " \t" ) + 1 );
+		if ( !name.empty() )
+			this->cache_key_headers.push_back( name );
+
+		start = end + 1;
+	}
+}
+
+bw::RequestInterceptor::~RequestInterceptor() {
+	if ( this->free_user_data != 0 )
+		this->free_user_data( this->user_data );
+}
+
+std::string bw::RequestInterceptor::cacheKey( CefRefPtr<CefRequest> request ) const {
+	std::string key = request->GetURL().ToString();
+
+	for ( auto it = this->cache_key_headers.begin(); it != this->cache_key_headers.end(); it++ ) {
+		key += '\n';
+		key += request->GetHeaderByName( *it ).ToString();
+	}
+	return key;
+}
+
+size_t bw::RequestInterceptor::cachedBytes() {
+	return this->cache.has_value() ? this->cache->size() : 0;
+}
+
+void bw::RequestInterceptor::clearCache() {
+	if ( this->cache.has_value() )
+		this->cache->clear();
+}
+
+bool bw::RequestInterceptor::matches( const CefString& url ) const {
+	return url.ToString().compare( 0, this->url_prefix.size(), this->url_prefix ) == 0;
+}
+
+CefRefPtr<CefResourceHandler> bw::RequestInterceptor::GetResourceHandler( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, CefRefPtr<CefRequest> request ) {
+	(void)(browser);
+	(void)(frame);
+
+	// Only GET requests are answered from the cache, as they are the only ones without side effects
+	std::string method = request->GetMethod().ToString();
+	bool use_cache = this->cache.has_value() && method == "GET";
+	std::string key;
+	if ( use_cache ) {
+		key = this->cacheKey( request );
+		std::optional<Resource> cached = this->cache->find( key );
+		if ( cached.has_value() )
+			return new ResourceHandler( std::move( cached ) );
+	}
+
+	std::string url = request->GetURL().ToString();
+	CefRequest::HeaderMap header_map;
+	request->GetHeaderMap( header_map );
+	std::string headers;
+	for ( auto it = header_map.begin(); it != header_map.end(); it++ ) {
+		headers += it->first.ToString();
+		headers += ": ";
+		headers += it->second.ToString();
+		headers += '\n';
+	}
+
+	bw_BrowserWindowRequest c_request;
+	c_request.method = { method.size(), method.c_str() };
+	c_request.url = { url.size(), url.c_str() };
+	c_request.headers = { headers.size(), headers.c_str() };
+
+	bw_BrowserWindowResponse c_response;
+	memset( &c_response, 0, sizeof( c_response ) );
+	c_response.status = 200;
+
+	if ( !this->handler( this->bw, this->user_data, &c_request, &c_response ) )
+		return nullptr;
+
+	Resource resource;
+	resource.data = (const char*)c_response.data;
+	resource.size = c_response.size;
+	resource.status = (int)c_response.status;
+	if ( c_response.mime_type.len > 0 )
+		resource.mime_type = std::string( c_response.mime_type.data, c_response.mime_type.len );
+	else {
+		CefURLParts parts;
+		CefParseURL( request->GetURL(), parts );
+		resource.mime_type = mimeTypeFor( CefString( &parts.path ).ToString() );
+	}
+	bw_ResourceFreeFn free_fn = c_response.free_fn;
+	void* free_data = c_response.free_data;
+	resource.owner = std::shared_ptr<const void>( c_response.data, [free_fn, free_data]( const void* ) {
+		if ( free_fn != 0 )
+			free_fn( free_data );
+	} );
+
+	if ( use_cache && c_response.cacheable )
+		this->cache->store( key, resource );
+
+	return new ResourceHandler( std::move( resource ) );
+}
+
+
+
+void bw::RequestInterceptorMap::set( int browser_id, CefRefPtr<RequestInterceptor> interceptor ) {
+	// The replaced interceptor is released outside of the lock, because that may call back into the user's code
+	CefRefPtr<RequestInterceptor> replaced;
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	auto it = this->interceptors.find( browser_id );
+	if ( it != this->interceptors.end() ) {
+		replaced = it->second;
+		this->interceptors.erase( it );
+	}
+
+	if ( interceptor != nullptr )
+		this->interceptors[browser_id] = interceptor;
+}
+
+CefRefPtr<bw::RequestInterceptor> bw::RequestInterceptorMap::find( int browser_id, const CefString& url ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	auto it = this->interceptors.find( browser_id );
+	if ( it == this->interceptors.end() || !it->second->matches( url ) )
+		return nullptr;
+
+	return it->second;
+}
+
+CefRefPtr<bw::RequestInterceptor> bw::RequestInterceptorMap::get( int browser_id ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	auto it = this->interceptors.find( browser_id );
+	if ( it == this->interceptors.end() )
+		return nullptr;
+
+	return it->second;
+}
@@ -0,0 +1,98 @@
+#ifndef BW_CEF_REQUEST_INTERCEPTOR_HPP
+#define BW_CEF_REQUEST_INTERCEPTOR_HPP
+
+#include "../browser_window.h"
+#include "resource_handler.hpp"
+
+#include <include/cef_request_handler.h>
+#include <include/cef_resource_request_handler.h>
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace bw {
+
+	// A thread safe LRU cache of responses, that stays within a budget of bytes.
+	class ResponseCache {
+		struct Entry {
+			std::string key;
+			Resource resource;
+		};
+
+		std::mutex mutex;
+		// The most recently used entries come first
+		std::list<Entry> entries;
+		std::unordered_map<std::string, std::list<Entry>::iterator> index;
+		size_t budget;
+		size_t used;
+
+		static size_t cost( const Entry& entry ) { return entry.key.size() + entry.resource.size; }
+
+	public:
+		ResponseCache( size_t budget ) : budget(budget), used(0) {}
+
+		// Drops all cached responses.
+		void clear();
+		std::optional<Resource> find( const std::string& key );
+		// The number of bytes that the cached responses take up, including their keys.
+		size_t size();
+		// Responses that don't fit within the budget by themselves are not stored.
+		void store( const std::string& key, const Resource& resource );
+	};
+
+	// Answers the requests of one browser window with the handler that has been set with bw_BrowserWindow_interceptRequests.
+	class RequestInterceptor : public CefResourceRequestHandler {
+		bw_BrowserWindow* bw;
+		std::string url_prefix;
+		std::vector<std::string> cache_key_headers;
+		std::optional<ResponseCache> cache;
+		bw_BrowserWindowRequestHandlerFn handler;
+		void* user_data;
+		bw_ResourceFreeFn free_user_data;
+
+		std::string cacheKey( CefRefPtr<CefRequest> request ) const;
+
+	public:
+		RequestInterceptor( bw_BrowserWindow* bw, const bw_BrowserWindowInterceptOptions* options, bw_BrowserWindowRequestHandlerFn handler, void* user_data, bw_ResourceFreeFn free_user_data );
+		~RequestInterceptor();
+
+		// The number of bytes that the cached responses of the browser window take up.
+		size_t cachedBytes();
+		void clearCache();
+		bool matches( const CefString& url ) const;
+
+		CefRefPtr<CefResourceHandler> GetResourceHandler( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, CefRefPtr<CefRequest> request ) override;
+
+	protected:
+		IMPLEMENT_REFCOUNTING(RequestInterceptor);
+	};
+
+	// The request interceptors of all browser windows, by browser identifier.
+	// It is consulted on the IO thread for every request.
+	class RequestInterceptorMap {
+		std::mutex mutex;
+		std::map<int, CefRefPtr<RequestInterceptor>> interceptors;
+
+	public:
+		// Replaces the interceptor of the browser, or removes it if `interceptor` is null.
+		void set( int browser_id, CefRefPtr<RequestInterceptor> interceptor );
+		// Finds the interceptor that wants to handle the given url, if any.
+		CefRefPtr<RequestInterceptor> find( int browser_id, const CefString& url );
+		// Finds the interceptor of the browser, if it has one.
+		CefRefPtr<RequestInterceptor> get( int browser_id );
+	};
+
+	// A global instance
+	extern RequestInterceptorMap request_interceptors;
+}
+
+
+
+#endif//BW_CEF_REQUEST_INTERCEPTOR_HPP
@@ -0,0 +1,204 @@
+#include "resource_handler.hpp"
+
+#include <include/cef_parser.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+
+
+// Parses the value of a Range header with a single range, like `bytes=0-499`, `bytes=500-` or `bytes=-500`.
+// Returns false if the range can't be satisfied, in which case the response should be 416 Range Not Satisfiable.
+// Sets `is_partial` to false for ranges that are not supported, in which case the whole resource should be sent.
+static bool bw_cef_parseRange( const std::string& header, size_t size, size_t& start, size_t& end, bool& is_partial ) {
+	is_partial = false;
+	start = 0;
+	end = size;
+
+	// Multiple ranges and other units are not supported, but ignoring the header is always allowed
+	const char prefix[] = "bytes=";
+	if ( header.compare( 0, sizeof( prefix ) - 1, prefix ) != 0 || header.find( ',' ) != std::string::npos )
+		return true;
+
+	std::string range = header.substr( sizeof( prefix ) - 1 );
+	size_t dash = range.find( '-' );
+	if ( dash == std::string::npos )
+		return true;
+
+	std::string first = range.substr( 0, dash );
+	std::string last = range.substr( dash + 1 );
+	if ( first.find_first_not_of( "0123456789" ) != std::string::npos || last.find_first_not_of( "0123456789" ) != std::string::npos || (first.empty() && last.empty()) )
+		return true;
+	// Amounts that don't fit in 64 bits are ignored as well
+	if ( first.size() > 18 || last.size() > 18 )
+		return true;
+
+	is_partial = true;
+
+	// A suffix range, for the last bytes
+	if ( first.empty() ) {
+		unsigned long long count = std::stoull( last );
+		if ( count == 0 || size == 0 )
+			return false;
+		start = size - (size_t)std::min( count, (unsigned long long)size );
+		return true;
+	}
+
+	unsigned long long first_byte = std::stoull( first );
+	if ( first_byte >= size )
+		return false;
+	start = (size_t)first_byte;
+
+	if ( !last.empty() ) {
+		unsigned long long last_byte = std::stoull( last );
+		if ( last_byte < first_byte )
+			return false;
+		end = (size_t)std::min( last_byte + 1, (unsigned long long)size );
+	}
+	return true;
+}
+
+// Whether the value of an If-None-Match header, which may list several tags, contains the given one
+static bool bw_cef_tagMatches( const std::string& header, const std::string& tag ) {
+	size_t first = header.find_first_not_of( " \t" );
+	if ( first == std::string::npos )
+		return false;
+	if ( header[first] == '*' )
+		return true;
+	// Weak tags are compared by their value as well
+	return header.find( tag ) != std::string::npos;
+}
+
+
+
+std::string bw::mimeTypeFor( const std::string& path ) {
+	size_t dot = path.rfind( '.' );
+	size_t slash = path.rfind( '/' );
+
+	if ( dot != std::string::npos && (slash == std::string::npos || dot > slash) ) {
+		std::string mime_type = CefGetMimeType( path.substr( dot + 1 ) ).ToString();
+		if ( !mime_type.empty() )
+			return mime_type;
+	}
+
+	return "application/octet-stream";
+}
+
+// The data is read eight bytes at a time, and only once for every resource, when it is registered or when its pack is loaded.
+std::string bw::entityTag( const char* data, size_t size ) {
+	uint64_t hash = 0xcbf29ce484222325ULL ^ (uint64_t)size;
+
+	size_t i = 0;
+	for ( ; i + 8 <= size; i += 8 ) {
+		uint64_t word;
+		memcpy( &word, data + i, 8 );
+		hash = (hash ^ word) * 0x100000001b3ULL;
+		hash ^= hash >> 29;
+	}
+	for ( ; i < size; i++ ) {
+		hash = (hash ^ (unsigned char)data[i]) * 0x100000001b3ULL;
+	}
+
+	char tag[19];
+	snprintf( tag, sizeof( tag ), "\"%016llx\"", (unsigned long long)hash );
+	return tag;
+}
+
+bool bw::ResourceHandler::Open( CefRefPtr<CefRequest> request, bool& handle_request, CefRefPtr<CefCallback> callback ) {
+	(void)(callback);
+
+	// Everything is in memory already, so the request is handled right away
+	handle_request = true;
+
+	if ( !this->resource.has_value() ) {
+		this->status = 404;
+		return true;
+	}
+
+	size_t size = this->resource->size;
+	if ( this->resource->status != 200 ) {
+		this->status = this->resource->status;
+		this->end = size;
+		return true;
+	}
+
+	// Unchanged resources aren't sent again, so that the engine keeps using what it has cached for them, including the compiled code of scripts
+	if ( !this->resource->etag.empty() && bw_cef_tagMatches( request->GetHeaderByName( "If-None-Match" ).ToString(), this->resource->etag ) ) {
+		this->status = 304;
+		return true;
+	}
+
+	bool is_partial;
+	if ( !bw_cef_parseRange( request->GetHeaderByName( "Range" ).ToString(), size, this->offset, this->end, is_partial ) ) {
+		this->status = 416;
+		this->offset = 0;
+		this->end = 0;
+	}
+	else
+		this->status = is_partial ? 206 : 200;
+
+	return true;
+}
+
+void bw::ResourceHandler::GetResponseHeaders( CefRefPtr<CefResponse> response, int64& response_length, CefString& redirect_url ) {
+	(void)(redirect_url);
+
+	response->SetStatus( this->status );
+	response_length = (int64)(this->end - this->offset);
+
+	if ( this->status == 404 ) {
+		response->SetStatusText( "Not Found" );
+		response->SetMimeType( "text/plain" );
+		return;
+	}
+
+	response->SetMimeType( this->resource->mime_type );
+	if ( this->resource->status == 200 && !this->resource->etag.empty() ) {
+		// Resources can be replaced at any time, so they are always validated, which costs no more than the lookup of a request
+		response->SetHeaderByName( "ETag", this->resource->etag, true );
+		response->SetHeaderByName( "Cache-Control", "no-cache", true );
+	}
+	if ( this->status == 304 ) {
+		response->SetStatusText( "Not Modified" );
+		return;
+	}
+	response->SetHeaderByName( "Accept-Ranges", "bytes", true );
+	if ( this->resource->content_encoding[0] != '\0' )
+		response->SetHeaderByName( "Content-Encoding", this->resource->content_encoding, true );
+
+	std::string size = std::to_string( this->resource->size );
+	if ( this->status == 206 ) {
+		response->SetStatusText( "Partial Content" );
+		response->SetHeaderByName( "Content-Range", "bytes " + std::to_string( this->offset ) + "-" + std::to_string( this->end - 1 ) + "/" + size, true );
+	}
+	else if ( this->status == 416 ) {
+		response->SetStatusText( "Range Not Satisfiable" );
+		response->SetHeaderByName( "Content-Range", "bytes */" + size, true );
+	}
+	else if ( this->status == 200 )
+		response->SetStatusText( "OK" );
+}
+
+bool bw::ResourceHandler::Skip( int64 bytes_to_skip, int64& bytes_skipped, CefRefPtr<CefResourceSkipCallback> callback ) {
+	(void)(callback);
+
+	size_t count = std::min( (size_t)bytes_to_skip, this->end - this->offset );
+	this->offset += count;
+	bytes_skipped = (int64)count;
+	return true;
+}
+
+bool bw::ResourceHandler::Read( void* data_out, int bytes_to_read, int& bytes_read, CefRefPtr<CefResourceReadCallback> callback ) {
+	(void)(callback);
+
+	size_t count = std::min( (size_t)bytes_to_read, this->end - this->offset );
+	if ( count > 0 )
+		memcpy( data_out, this->resource->data + this->offset, count );
+
+	this->offset += count;
+	bytes_read = (int)count;
+	// Returning false with no bytes read marks the end of the response
+	return count > 0;
+}
@@ -0,0 +1,60 @@
+#ifndef BW_CEF_RESOURCE_HANDLER_HPP
+#define BW_CEF_RESOURCE_HANDLER_HPP
+
+#include <include/cef_resource_handler.h>
+#include <include/cef_response.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+
+
+namespace bw {
+
+	// A response body that is already in memory, or in a memory mapping.
+	struct Resource {
+		const char* data;
+		size_t size;
+		std::string mime_type;
+		// Keeps `data` valid for as long as the resource is around
+		std::shared_ptr<const void> owner;
+		// Set if the data is compressed, like "gzip"
+		const char* content_encoding = "";
+		// Range requests are only supported on 200 OK responses
+		int status = 200;
+		// The entity tag that 200 OK responses are validated with, which is determined once for the resource, or empty to not validate it
+		std::string etag;
+	};
+
+	// Guesses the MIME type from the extension of the given path.
+	std::string mimeTypeFor( const std::string& path );
+	// Hashes the whole data into an entity tag, so that a page that is loaded again can be validated against what the engine has cached.
+	std::string entityTag( const char* data, size_t size );
+
+	// Serves a resource as the response of a request, with support for the Range and If-None-Match headers.
+	// Responds with 404 Not Found if there is no resource.
+	class ResourceHandler : public CefResourceHandler {
+		std::optional<Resource> resource;
+		int status;
+		// The part of the resource that still needs to be read
+		size_t offset;
+		size_t end;
+	public:
+		ResourceHandler( std::optional<Resource> resource ) : resource(std::move(resource)), status(0), offset(0), end(0) {}
+
+		bool Open( CefRefPtr<CefRequest> request, bool& handle_request, CefRefPtr<CefCallback> callback ) override;
+		void GetResponseHeaders( CefRefPtr<CefResponse> response, int64& response_length, CefString& redirect_url ) override;
+		bool Skip( int64 bytes_to_skip, int64& bytes_skipped, CefRefPtr<CefResourceSkipCallback> callback ) override;
+		bool Read( void* data_out, int bytes_to_read, int& bytes_read, CefRefPtr<CefResourceReadCallback> callback ) override;
+		void Cancel() override {}
+
+	protected:
+		IMPLEMENT_REFCOUNTING(ResourceHandler);
+	};
+}
+
+
+
+#endif//BW_CEF_RESOURCE_HANDLER_HPP
@@ -0,0 +1,107 @@
+#include "resource_pack.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+
+static uint16_t bw_cef_readU16( const unsigned char* bytes ) {
+	return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
+
+static uint32_t bw_cef_readU32( const unsigned char* bytes ) {
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static uint64_t bw_cef_readU64( const unsigned char* bytes ) {
+	return (uint64_t)bw_cef_readU32( bytes ) | ((uint64_t)bw_cef_readU32( bytes + 4 ) << 32);
+}
+
+// Whether the range lies within a file of the given size
+static bool bw_cef_rangeFits( uint64_t offset, uint64_t length, size_t size ) {
+	return offset <= size && length <= size - offset;
+}
+
+
+
+std::shared_ptr<const bw::ResourcePack> bw::ResourcePack::open( const std::string& path, std::string& error ) {
+	std::shared_ptr<const MappedFile> file = MappedFile::open( path );
+	if ( file == nullptr ) {
+		error = "unable to open resource pack " + path;
+		return nullptr;
+	}
+
+	const unsigned char* data = (const unsigned char*)file->data();
+	size_t size = file->size();
+	if ( size < HEADER_SIZE || memcmp( data, "BWPK", 4 ) != 0 ) {
+		error = "not a resource pack: " + path;
+		return nullptr;
+	}
+	if ( bw_cef_readU32( data + 4 ) != 1 ) {
+		error = "unsupported resource pack version: " + path;
+		return nullptr;
+	}
+
+	// Everything is checked once up front, so that lookups don't need to
+	uint32_t count = bw_cef_readU32( data + 8 );
+	if ( !bw_cef_rangeFits( HEADER_SIZE, (uint64_t)count * ENTRY_SIZE, size ) ) {
+		error = "corrupt resource pack: " + path;
+		return nullptr;
+	}
+	std::vector<std::string> etags;
+	etags.reserve( count );
+	for ( uint32_t i = 0; i < count; i++ ) {
+		const unsigned char* entry = data + HEADER_SIZE + (size_t)i * ENTRY_SIZE;
+
+		if ( !bw_cef_rangeFits( bw_cef_readU32( entry ), bw_cef_readU32( entry + 4 ), size ) ||
+			!bw_cef_rangeFits( bw_cef_readU64( entry + 8 ), bw_cef_readU64( entry + 16 ), size ) ||
+			!bw_cef_rangeFits( bw_cef_readU32( entry + 24 ), bw_cef_readU16( entry + 28 ), size ) ||
+			entry[30] > 2
+		) {
+			error = "corrupt resource pack: " + path;
+			return nullptr;
+		}
+
+		etags.push_back( entityTag( (const char*)data + bw_cef_readU64( entry + 8 ), (size_t)bw_cef_readU64( entry + 16 ) ) );
+	}
+
+	return std::shared_ptr<const ResourcePack>( new ResourcePack( std::move( file ), count, std::move( etags ) ) );
+}
+
+std::optional<bw::Resource> bw::ResourcePack::find( const std::string& path ) const {
+	const char* data = this->file->data();
+
+	// Paths are compared byte by byte, just like the packer sorts them
+	uint32_t low = 0, high = this->count;
+	while ( low < high ) {
+		uint32_t middle = low + (high - low) / 2;
+		const unsigned char* entry = this->entries + (size_t)middle * ENTRY_SIZE;
+
+		const char* entry_path = data + bw_cef_readU32( entry );
+		size_t entry_path_len = bw_cef_readU32( entry + 4 );
+		int order = memcmp( entry_path, path.data(), std::min( entry_path_len, path.size() ) );
+		if ( order == 0 )
+			order = entry_path_len < path.size() ? -1 : entry_path_len > path.size() ? 1 : 0;
+
+		if ( order < 0 )
+			low = middle + 1;
+		else if ( order > 0 )
+			high = middle;
+		else {
+			static const char* ENCODINGS[] = { "", "gzip", "br" };
+
+			Resource resource;
+			resource.data = data + bw_cef_readU64( entry + 8 );
+			resource.size = (size_t)bw_cef_readU64( entry + 16 );
+			size_t mime_len = bw_cef_readU16( entry + 28 );
+			resource.mime_type = mime_len > 0 ? std::string( data + bw_cef_readU32( entry + 24 ), mime_len ) : mimeTypeFor( path );
+			resource.content_encoding = ENCODINGS[entry[30]];
+			resource.etag = this->etags[middle];
+			// The whole mapping stays around for as long as one of its resources is being served
+			resource.owner = this->shared_from_this();
+			return resource;
+		}
+	}
+
+	return std::nullopt;
+}
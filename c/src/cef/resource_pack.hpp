@@ -0,0 +1,53 @@
+#ifndef BW_CEF_RESOURCE_PACK_HPP
+#define BW_CEF_RESOURCE_PACK_HPP
+
+#include "mapped_file.hpp"
+#include "resource_handler.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+
+namespace bw {
+
+	// A file with many resources in it, that is mapped into memory as a whole.
+	// Every resource is served as a slice of the mapping, so no file needs to be opened or read per request.
+	//
+	// The file layout, with all integers in little endian:
+	// * A 16 byte header: the magic bytes `BWPK`, a u32 version (1), a u32 entry count and a u32 that is reserved (0).
+	// * The entries, 32 bytes each, sorted by their path:
+	//   u32 path offset, u32 path length, u64 data offset, u64 data size, u32 MIME type offset, u16 MIME type length, u8 encoding and u8 padding.
+	// * The paths, MIME types and data that the entries point to, anywhere in the rest of the file.
+	// Paths include the host, like `bundle/index.html`.
+	// Empty MIME types are derived from the extension of the path.
+	// The encoding is 0 for none, 1 for gzip and 2 for brotli, and is sent as the Content-Encoding of the response.
+	class ResourcePack : public std::enable_shared_from_this<ResourcePack> {
+		std::shared_ptr<const MappedFile> file;
+		const unsigned char* entries;
+		uint32_t count;
+		// The entity tags of the entries, which are hashed when the pack is loaded instead of on every request
+		std::vector<std::string> etags;
+
+		ResourcePack( std::shared_ptr<const MappedFile> file, uint32_t count, std::vector<std::string> etags ) :
+			file(std::move(file)), entries((const unsigned char*)this->file->data() + HEADER_SIZE), count(count), etags(std::move(etags)) {}
+
+	public:
+		static const size_t HEADER_SIZE = 16;
+		static const size_t ENTRY_SIZE = 32;
+
+		// Maps the pack at the given path, and checks that all its entries point inside of the file.
+		// Returns null and sets `error` if it isn't a valid pack.
+		static std::shared_ptr<const ResourcePack> open( const std::string& path, std::string& error );
+
+		// Looks up the resource with a binary search over the sorted paths.
+		std::optional<Resource> find( const std::string& path ) const;
+	};
+}
+
+
+
+#endif//BW_CEF_RESOURCE_PACK_HPP
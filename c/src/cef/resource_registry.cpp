@@ -0,0 +1,121 @@
+#include "resource_registry.hpp"
+#include "mapped_file.hpp"
+
+#include <include/cef_parser.h>
+
+#include <cstdio>
+
+
+
+bw::ResourceRegistry bw::resource_registry;
+
+
+
+void bw::ResourceRegistry::store( const std::string& path, Resource resource ) {
+	// The resource that gets replaced is released outside of the lock, because that may call back into the user's code
+	std::optional<Resource> replaced;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		auto it = this->buffers.find( path );
+		if ( it != this->buffers.end() ) {
+			replaced = std::move( it->second );
+			it->second = std::move( resource );
+		}
+		else
+			this->buffers.emplace( path, std::move( resource ) );
+	}
+}
+
+bool bw::ResourceRegistry::drop( const std::string& path ) {
+	std::optional<Resource> dropped;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		auto it = this->buffers.find( path );
+		if ( it == this->buffers.end() )
+			return false;
+
+		dropped = std::move( it->second );
+		this->buffers.erase( it );
+	}
+	return true;
+}
+
+void bw::ResourceRegistry::addPack( std::shared_ptr<const ResourcePack> pack ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+	this->packs.push_back( std::move( pack ) );
+}
+
+void bw::ResourceRegistry::mount( const std::string& host, const std::string& directory ) {
+	std::lock_guard<std::mutex> lock( this->mutex );
+
+	// Paths always start with a slash, so the directory shouldn't end with one
+	std::string dir = directory;
+	while ( !dir.empty() && (dir.back() == '/' || dir.back() == '\\') )
+		dir.pop_back();
+	this->directories[host] = dir;
+}
+
+std::optional<bw::Resource> bw::ResourceRegistry::find( const std::string& host, const std::string& path ) {
+	std::string directory;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		std::string key = host + path;
+		auto it = this->buffers.find( key );
+		if ( it != this->buffers.end() )
+			return it->second;
+
+		for ( auto pack = this->packs.begin(); pack != this->packs.end(); pack++ ) {
+			std::optional<Resource> resource = (*pack)->find( key );
+			if ( resource.has_value() )
+				return resource;
+		}
+
+		auto dir = this->directories.find( host );
+		if ( dir == this->directories.end() )
+			return std::nullopt;
+		directory = dir->second;
+	}
+
+	// Don't allow anything outside of the directory to be served
+	if ( path.find( '\\' ) != std::string::npos || path.find( '\0' ) != std::string::npos )
+		return std::nullopt;
+	for ( size_t i = path.find( "/.." ); i != std::string::npos; i = path.find( "/..", i + 1 ) ) {
+		if ( i + 3 == path.size() || path[i + 3] == '/' )
+			return std::nullopt;
+	}
+
+	// The file is mapped instead of read, so only the parts that are actually sent are paged in
+	std::shared_ptr<const MappedFile> file = MappedFile::open( directory + path );
+	if ( file == nullptr )
+		return std::nullopt;
+
+	// Files can change on disk, so hashing them once isn't enough, and hashing them on every request would read them in full.
+	// Their weak tag is derived from their size and modification time instead.
+	Resource resource { file->data(), file->size(), mimeTypeFor( path ), file };
+	char tag[40];
+	snprintf( tag, sizeof( tag ), "W/\"%llx-%llx\"", (unsigned long long)file->size(), (unsigned long long)file->modified() );
+	resource.etag = tag;
+	return resource;
+}
+
+
+
+CefRefPtr<CefResourceHandler> bw::ResourceSchemeHandlerFactory::Create( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, const CefString& scheme_name, CefRefPtr<CefRequest> request ) {
+	(void)(browser);
+	(void)(frame);
+	(void)(scheme_name);
+
+	CefURLParts parts;
+	if ( !CefParseURL( request->GetURL(), parts ) )
+		return new ResourceHandler( std::nullopt );
+
+	std::string host = CefString( &parts.host ).ToString();
+	std::string path = CefURIDecode( CefString( &parts.path ), true, (cef_uri_unescape_rule_t)(UU_NORMAL | UU_SPACES) ).ToString();
+	if ( path.empty() || path == "/" )
+		path = "/index.html";
+
+	return new ResourceHandler( resource_registry.find( host, path ) );
+}
@@ -0,0 +1,56 @@
+#ifndef BW_CEF_RESOURCE_REGISTRY_HPP
+#define BW_CEF_RESOURCE_REGISTRY_HPP
+
+#include "resource_handler.hpp"
+#include "resource_pack.hpp"
+
+#include <include/cef_scheme.h>
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace bw {
+
+	// All resources that are served at the resource scheme, which can be accessed from any thread.
+	// Resources are looked up by their host and path, e.g. `bundle/index.html` for `app://bundle/index.html`.
+	class ResourceRegistry {
+		std::mutex mutex;
+		std::unordered_map<std::string, Resource> buffers;
+		std::vector<std::shared_ptr<const ResourcePack>> packs;
+		// The directories of which the files are served, by host
+		std::unordered_map<std::string, std::string> directories;
+
+	public:
+		// Stores a resource, replacing the one that was stored at the same path before.
+		void store( const std::string& path, Resource resource );
+		// Returns false if there was no resource at the path.
+		bool drop( const std::string& path );
+		// Serves the resources of a pack, after those of the packs that have been added before.
+		void addPack( std::shared_ptr<const ResourcePack> pack );
+		// Serves the files of `directory` at the given host.
+		void mount( const std::string& host, const std::string& directory );
+		// Finds the resource for the given host and (decoded) path, which starts with a slash.
+		std::optional<Resource> find( const std::string& host, const std::string& path );
+	};
+
+	// A global instance
+	extern ResourceRegistry resource_registry;
+
+	// Creates the handlers for requests to the resource scheme.
+	class ResourceSchemeHandlerFactory : public CefSchemeHandlerFactory {
+	public:
+		CefRefPtr<CefResourceHandler> Create( CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, const CefString& scheme_name, CefRefPtr<CefRequest> request ) override;
+
+	protected:
+		IMPLEMENT_REFCOUNTING(ResourceSchemeHandlerFactory);
+	};
+}
+
+
+
+#endif//BW_CEF_RESOURCE_REGISTRY_HPP
@@ -1,46 +1,72 @@
 #include "util.hpp"
 
-#include <string>
+#include <cstdlib>
+#include <type_traits>
+
+
+
+// The type of the code units of a CefString, which differs between versions of CEF and platforms
+typedef std::remove_pointer<decltype( cef_string_t::str )>::type bw_cef_char16;
+static_assert( sizeof( bw_cef_char16 ) == sizeof( uint16_t ), "CEF is expected to use UTF-16 strings" );
+
+static void bw_cef_freeString( bw_cef_char16* str );
 
 
 
 CefString bw_cef_copyFromStrSlice( bw_CStrSlice slice ) {
 
-	std::string temp( slice.data, slice.len );
-	CefString string( temp );
+	// Convert directly into the buffer of the string, which is allocated at its exact size up front
+	CefString string;
+	cef_string_t* str = string.GetWritableStruct();
+	size_t length = bw_string_utf16Length( slice );
+
+	str->str = (bw_cef_char16*)malloc( (length + 1) * sizeof( bw_cef_char16 ) );
+	str->length = bw_string_toUtf16( slice, (uint16_t*)str->str );
+	str->str[ str->length ] = 0;
+	str->dtor = bw_cef_freeString;
 
 	return string;
 }
 
 size_t bw_cef_copyToCstr( const CefString& cef_string, char** cstr ) {
-	std::string temp = cef_string.ToString();
+	const cef_string_t* str = cef_string.GetStruct();
+	size_t length = bw_cef_utf8Length( *str );
 
-	*cstr = (char*)malloc(temp.length());
-	memcpy(*cstr, temp.c_str(), temp.length());
+	*cstr = (char*)malloc( length );
+	return bw_cef_writeUtf8( *str, *cstr );
+}
 
-	return temp.length();
+uint64_t bw_cef_microsecondsSince( std::chrono::steady_clock::time_point moment ) {
+	auto elapsed = std::chrono::steady_clock::now() - moment;
+	return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>( elapsed ).count();
 }
 
 bw_CStrSlice bw_cef_copyToCStrSlice(const CefString& string) {
-	bw_CStrSlice slice;
+	bw_StrSlice copy = bw_cef_copyToStrSlice( string );
 
-	std::string temp = string.ToString();
-
-	char* data = (char*)malloc(temp.length());
-	slice.data = data;
-	slice.len = temp.length();
+	bw_CStrSlice slice;
+	slice.data = copy.data;
+	slice.len = copy.len;
 	return slice;
 }
 
 bw_StrSlice bw_cef_copyToStrSlice(const CefString& string) {
+	const cef_string_t* str = string.GetStruct();
 	bw_StrSlice slice;
 
-	std::string temp = string.ToString();
-
-	size_t len = temp.length();
-	char* data = (char*)malloc(len);
-	memcpy(data, temp.c_str(), len);
-	slice.data = data;
-	slice.len = len;
+	slice.data = (char*)malloc( bw_cef_utf8Length( *str ) );
+	slice.len = bw_cef_writeUtf8( *str, slice.data );
 	return slice;
-}
\ No newline at end of file
+}
+
+size_t bw_cef_utf8Length( const cef_string_t& string ) {
+	return bw_string_utf8Length( (const uint16_t*)string.str, string.length );
+}
+
+size_t bw_cef_writeUtf8( const cef_string_t& string, char* buffer ) {
+	return bw_string_toUtf8( (const uint16_t*)string.str, string.length, buffer );
+}
+
+static void bw_cef_freeString( bw_cef_char16* str ) {
+	free( str );
+}
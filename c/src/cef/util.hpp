@@ -5,12 +5,23 @@
 
 #include <include/internal/cef_string.h>
 
+#include <chrono>
+#include <cstdint>
+
 
 
 CefString bw_cef_copyFromStrSlice( bw_CStrSlice slice );
 size_t bw_cef_copyToCstr( const CefString& cef_string, char** cstr );
+// Returns the number of microseconds that have passed since the given moment.
+uint64_t bw_cef_microsecondsSince( std::chrono::steady_clock::time_point moment );
 bw_CStrSlice bw_cef_copyToCStrSlice(const CefString& string);
 bw_StrSlice bw_cef_copyToStrSlice(const CefString& string);
+// Returns the number of bytes that the UTF-16 string takes up when it is encoded as UTF-8.
+size_t bw_cef_utf8Length( const cef_string_t& string );
+// Encodes the UTF-16 string as UTF-8 straight into `buffer`, which needs to have room for `bw_cef_utf8Length( string )` bytes.
+// Unpaired surrogates become U+FFFD, just like they do with CefString::ToString.
+// Returns the number of bytes written.
+size_t bw_cef_writeUtf8( const cef_string_t& string, char* buffer );
 
 
 
@@ -0,0 +1,277 @@
+#ifndef BW_CEF_V8_TO_VALUE_HPP
+#define BW_CEF_V8_TO_VALUE_HPP
+
+#include <include/cef_v8.h>
+#include <include/cef_values.h>
+
+#include <climits>
+#include <vector>
+
+
+
+class V8ToValue {
+public:
+
+	// Convert a javascript value into a CefValue, so that it can be sent to the browser process without stringifying it.
+	// Returns null for values that have no structured representation (undefined & functions).
+	// Array buffers and their views, like typed arrays, become binary values.
+	// Like JSON.stringify, the conversion fails on a cyclic structure.
+	// It also fails on a structure that is nested too deeply, or that has too many values, as objects that are referred to more than once are converted every time.
+	// In that case, null is returned and `error` is set to what went wrong.
+	static CefRefPtr<CefValue> convert( CefRefPtr<CefV8Value> val, CefString& error ) {
+		State state;
+		CefRefPtr<CefValue> result = convert( val, state );
+		if ( !state.error.empty() ) {
+			error = state.error;
+			return nullptr;
+		}
+		return result;
+	}
+
+	// Copies the contents of an array buffer or a view on one into a binary value.
+	// Returns null if the value doesn't contain binary data, or if it is empty.
+	// If given, `is_binary` is set to whether the value contains binary data.
+	static CefRefPtr<CefBinaryValue> convertBinary( CefRefPtr<CefV8Value> val, bool* is_binary = nullptr ) {
+		BinaryHelpers helpers;
+		bool binary = isBinary( val, helpers );
+		if ( is_binary != nullptr )
+			*is_binary = binary;
+		if ( !binary )
+			return nullptr;
+
+		return copyBinary( val, helpers );
+	}
+
+protected:
+	// The maximum number of nested arrays and objects
+	static const size_t MAX_DEPTH = 64;
+	// The maximum number of values that are converted, which limits the time spent on a structure that refers to the same objects over and over
+	static const size_t MAX_VALUES = 1 << 20;
+
+	// The javascript functions that are needed to recognize and read out binary data.
+	// They are compiled in the current context when a conversion first needs them, and are never installed on the page itself.
+	struct BinaryHelpers {
+		bool loaded = false;
+		CefRefPtr<CefV8Value> is_view;
+		CefRefPtr<CefV8Value> to_chunks;
+	};
+
+	// `ArrayBuffer.isView`, and a function that copies the contents of an array buffer or view into an array of strings.
+	// CEF doesn't provide access to the contents of array buffers, so every byte becomes one character of a string, which is a lot cheaper to transfer than an array of numbers.
+	// The bytes are converted in chunks, because there is a limit on the number of arguments that can be passed to a function.
+	// The chunks aren't joined, because `copyBinary` narrows them into the binary data one by one.
+	static constexpr const char* BINARY_HELPERS_SOURCE =
+		"[ArrayBuffer.isView, function (data) {"
+			"var bytes = data instanceof ArrayBuffer ? new Uint8Array(data) :"
+				"ArrayBuffer.isView(data) ? new Uint8Array(data.buffer, data.byteOffset, data.byteLength) : null;"
+			"if (bytes === null) return null;"
+			"var chunks = [];"
+			"for (var i = 0; i < bytes.length; i += 0x8000)"
+				"chunks.push(String.fromCharCode.apply(null, bytes.subarray(i, i + 0x8000)));"
+			"return chunks;"
+		"}]";
+
+	struct State {
+		BinaryHelpers helpers;
+		// The arrays and objects that are being converted, from the outermost one inwards
+		std::vector<CefRefPtr<CefV8Value>> path;
+		size_t values = 0;
+		// Set once the conversion has failed, after which nothing else gets converted
+		CefString error;
+	};
+
+	static CefRefPtr<CefValue> convert( CefRefPtr<CefV8Value> val, State& state ) {
+
+		if ( val == nullptr || val->IsUndefined() || val->IsFunction() )
+			return nullptr;
+
+		state.values += 1;
+		if ( state.values > MAX_VALUES ) {
+			state.error = "Converting a structure with too many values";
+			return nullptr;
+		}
+
+		CefRefPtr<CefValue> result = CefValue::Create();
+
+		if ( val->IsNull() )
+			result->SetNull();
+		else if ( val->IsBool() )
+			result->SetBool( val->GetBoolValue() );
+		else if ( val->IsInt() )
+			result->SetInt( val->GetIntValue() );
+		else if ( val->IsUInt() ) {
+			uint32 value = val->GetUIntValue();
+			if ( value <= INT_MAX )
+				result->SetInt( (int)value );
+			else
+				result->SetDouble( (double)value );
+		}
+		else if ( val->IsDouble() )
+			result->SetDouble( val->GetDoubleValue() );
+		else if ( val->IsString() )
+			result->SetString( val->GetStringValue() );
+		else if ( val->IsArray() ) {
+			if ( !enter( val, state ) )
+				return nullptr;
+			result->SetList( convertArray( val, state ) );
+			state.path.pop_back();
+		}
+		else if ( isBinary( val, state.helpers ) ) {
+			// CEF can't represent empty binary values, so empty buffers become null
+			CefRefPtr<CefBinaryValue> binary = copyBinary( val, state.helpers );
+			if ( binary != nullptr )
+				result->SetBinary( binary );
+			else
+				result->SetNull();
+		}
+		else if ( val->IsObject() ) {
+			if ( !enter( val, state ) )
+				return nullptr;
+			result->SetDictionary( convertObject( val, state ) );
+			state.path.pop_back();
+		}
+		else
+			return nullptr;
+
+		return result;
+	}
+
+	// Adds the array or object to the path, unless it is already on it, or the path is too long, in which case the conversion fails.
+	static bool enter( CefRefPtr<CefV8Value> val, State& state ) {
+		if ( state.path.size() >= MAX_DEPTH ) {
+			state.error = "Converting a structure that is nested too deeply";
+			return false;
+		}
+
+		for ( auto it = state.path.begin(); it != state.path.end(); it++ ) {
+			if ( (*it)->IsSame( val ) ) {
+				state.error = "Converting circular structure";
+				return false;
+			}
+		}
+
+		state.path.push_back( val );
+		return true;
+	}
+
+	// Compiles the helpers, unless that has been tried already.
+	// Returns whether they are available.
+	static bool loadHelpers( BinaryHelpers& helpers ) {
+		if ( !helpers.loaded ) {
+			helpers.loaded = true;
+
+			CefRefPtr<CefV8Context> context = CefV8Context::GetCurrentContext();
+			CefRefPtr<CefV8Value> funcs;
+			CefRefPtr<CefV8Exception> exception;
+			if ( context != nullptr && context->Eval( BINARY_HELPERS_SOURCE, "v8_to_value", 0, funcs, exception ) && funcs->IsArray() ) {
+				helpers.is_view = funcs->GetValue( 0 );
+				helpers.to_chunks = funcs->GetValue( 1 );
+			}
+		}
+
+		return helpers.is_view != nullptr && helpers.is_view->IsFunction() && helpers.to_chunks != nullptr && helpers.to_chunks->IsFunction();
+	}
+
+	// Whether the value is an array buffer, or a view on one like a typed array or a data view.
+	static bool isBinary( CefRefPtr<CefV8Value> val, BinaryHelpers& helpers ) {
+		if ( val->IsArrayBuffer() )
+			return true;
+
+		// Every view has a buffer, so plain objects are ruled out without calling into javascript
+		if ( !val->IsObject() || !val->HasValue( "buffer" ) || !loadHelpers( helpers ) )
+			return false;
+
+		CefV8ValueList args;
+		args.push_back( val );
+		CefRefPtr<CefV8Value> result = helpers.is_view->ExecuteFunction( nullptr, args );
+		if ( helpers.is_view->HasException() )
+			helpers.is_view->ClearException();
+		return result != nullptr && result->IsBool() && result->GetBoolValue();
+	}
+
+	static CefRefPtr<CefBinaryValue> copyBinary( CefRefPtr<CefV8Value> val, BinaryHelpers& helpers ) {
+		if ( !loadHelpers( helpers ) )
+			return nullptr;
+
+		CefV8ValueList args;
+		args.push_back( val );
+		CefRefPtr<CefV8Value> chunks = helpers.to_chunks->ExecuteFunction( nullptr, args );
+		if ( helpers.to_chunks->HasException() )
+			helpers.to_chunks->ClearException();
+		if ( chunks == nullptr || !chunks->IsArray() )
+			return nullptr;
+
+		// Every chunk but the last one holds 0x8000 bytes
+		int count = chunks->GetArrayLength();
+		std::vector<unsigned char> data;
+		data.reserve( (size_t)count * 0x8000 );
+		for ( int i = 0; i < count; i++ ) {
+			CefRefPtr<CefV8Value> chunk = chunks->GetValue( i );
+			if ( chunk == nullptr || !chunk->IsString() )
+				return nullptr;
+
+			// Every character holds one byte
+			CefString string = chunk->GetStringValue();
+			const CefString::char_type* chars = string.c_str();
+			size_t offset = data.size();
+			data.resize( offset + string.length() );
+			for ( size_t j = 0; j < string.length(); j++ ) {
+				data[ offset + j ] = (unsigned char)chars[j];
+			}
+		}
+		if ( data.empty() )
+			return nullptr;
+
+		return CefBinaryValue::Create( data.data(), data.size() );
+	}
+
+	static CefRefPtr<CefListValue> convertArray( CefRefPtr<CefV8Value> val, State& state ) {
+		CefRefPtr<CefListValue> list = CefListValue::Create();
+
+		int length = val->GetArrayLength();
+		list->SetSize( length );
+
+		for ( int i = 0; i < length && state.error.empty(); i++ ) {
+			CefRefPtr<CefValue> item = convert( getValue( val, i ), state );
+
+			if ( item != nullptr )
+				list->SetValue( i, item );
+			else
+				list->SetNull( i );
+		}
+
+		return list;
+	}
+
+	static CefRefPtr<CefDictionaryValue> convertObject( CefRefPtr<CefV8Value> val, State& state ) {
+		CefRefPtr<CefDictionaryValue> dict = CefDictionaryValue::Create();
+
+		std::vector<CefString> keys;
+		val->GetKeys( keys );
+
+		for ( auto it = keys.begin(); it != keys.end() && state.error.empty(); it++ ) {
+			CefRefPtr<CefValue> item = convert( getValue( val, *it ), state );
+
+			if ( item != nullptr )
+				dict->SetValue( *it, item );
+		}
+
+		return dict;
+	}
+
+	// Reads a property, which may run a getter.
+	// A getter that throws is treated as if the property is undefined, and its exception is cleared so that it doesn't get in the way of the rest of the conversion.
+	template <typename K>
+	static CefRefPtr<CefV8Value> getValue( CefRefPtr<CefV8Value> val, const K& key ) {
+		CefRefPtr<CefV8Value> item = val->GetValue( key );
+		if ( val->HasException() ) {
+			val->ClearException();
+			return nullptr;
+		}
+		return item;
+	}
+};
+
+
+
+#endif//BW_CEF_V8_TO_VALUE_HPP
@@ -0,0 +1,78 @@
+#include "value.hpp"
+#include "util.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+
+
+void bw_cef_toJsValue( const CefRefPtr<CefValue>& value, bw_JsValue* out ) {
+	memset( out, 0, sizeof( bw_JsValue ) );
+
+	if ( value == nullptr ) {
+		out->type = BW_JS_VALUE_UNDEFINED;
+		return;
+	}
+
+	switch ( value->GetType() ) {
+	case VTYPE_BOOL:
+		out->type = BW_JS_VALUE_BOOLEAN;
+		out->boolean = value->GetBool();
+		break;
+	case VTYPE_INT:
+		out->type = BW_JS_VALUE_NUMBER;
+		out->number = (double)value->GetInt();
+		break;
+	case VTYPE_DOUBLE:
+		out->type = BW_JS_VALUE_NUMBER;
+		out->number = value->GetDouble();
+		break;
+	case VTYPE_STRING: {
+		bw_StrSlice string = bw_cef_copyToStrSlice( value->GetString() );
+		out->type = BW_JS_VALUE_STRING;
+		out->string.data = string.data;
+		out->string.len = string.len;
+	}	break;
+	case VTYPE_BINARY: {
+		CefRefPtr<CefBinaryValue> binary = value->GetBinary();
+
+		out->type = BW_JS_VALUE_BINARY;
+		out->string.len = binary->GetSize();
+		char* data = (char*)malloc( out->string.len );
+		binary->GetData( data, out->string.len, 0 );
+		out->string.data = data;
+	}	break;
+	case VTYPE_LIST: {
+		CefRefPtr<CefListValue> list = value->GetList();
+
+		out->type = BW_JS_VALUE_ARRAY;
+		out->item_count = list->GetSize();
+		out->items = (bw_JsValue*)malloc( sizeof( bw_JsValue ) * out->item_count );
+
+		for ( size_t i = 0; i < out->item_count; i++ ) {
+			bw_cef_toJsValue( list->GetValue( i ), &out->items[i] );
+		}
+	}	break;
+	case VTYPE_DICTIONARY: {
+		CefRefPtr<CefDictionaryValue> dict = value->GetDictionary();
+		CefDictionaryValue::KeyList keys;
+		dict->GetKeys( keys );
+
+		out->type = BW_JS_VALUE_OBJECT;
+		out->item_count = keys.size();
+		out->items = (bw_JsValue*)malloc( sizeof( bw_JsValue ) * out->item_count );
+		out->keys = (bw_CStrSlice*)malloc( sizeof( bw_CStrSlice ) * out->item_count );
+
+		for ( size_t i = 0; i < out->item_count; i++ ) {
+			bw_StrSlice key = bw_cef_copyToStrSlice( keys[i] );
+			out->keys[i].data = key.data;
+			out->keys[i].len = key.len;
+
+			bw_cef_toJsValue( dict->GetValue( keys[i] ), &out->items[i] );
+		}
+	}	break;
+	default:
+		out->type = BW_JS_VALUE_NULL;
+		break;
+	}
+}
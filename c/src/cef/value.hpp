@@ -0,0 +1,16 @@
+#ifndef BW_CEF_VALUE_HPP
+#define BW_CEF_VALUE_HPP
+
+#include <include/cef_values.h>
+
+#include "../js_value.h"
+
+
+
+// Converts a CefValue received from the renderer process into a newly allocated bw_JsValue tree.
+// The result should be freed with bw_JsValue_free.
+void bw_cef_toJsValue( const CefRefPtr<CefValue>& value, bw_JsValue* out );
+
+
+
+#endif//BW_CEF_VALUE_HPP
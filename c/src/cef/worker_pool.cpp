@@ -0,0 +1,133 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+
+
+
+bw::WorkerPool bw::worker_pool;
+
+
+
+void bw::WorkerPool::stop() {
+	std::vector<std::thread> threads;
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+
+		this->stopping = true;
+		threads.swap( this->threads );
+	}
+	this->wake.notify_all();
+
+	for ( auto it = threads.begin(); it != threads.end(); it++ ) {
+		it->join();
+	}
+
+	// The jobs that never started release whatever they hold on to here
+	std::lock_guard<std::mutex> lock( this->mutex );
+	this->workers.clear();
+	this->unclaimed = 0;
+}
+
+bool bw::WorkerPool::stop( std::chrono::steady_clock::time_point deadline ) {
+	std::vector<std::thread> threads;
+	bool finished;
+	{
+		std::unique_lock<std::mutex> lock( this->mutex );
+
+		this->stopping = true;
+		threads.swap( this->threads );
+		this->wake.notify_all();
+		finished = this->idle.wait_until( lock, deadline, [this]() { return this->running == 0; } );
+	}
+
+	for ( auto it = threads.begin(); it != threads.end(); it++ ) {
+		if ( finished )
+			it->join();
+		else
+			it->detach();
+	}
+
+	// The workers are kept for the threads that are still running
+	if ( finished ) {
+		std::lock_guard<std::mutex> lock( this->mutex );
+		this->workers.clear();
+		this->unclaimed = 0;
+	}
+	return finished;
+}
+
+void bw::WorkerPool::submit( std::function<void()> job ) {
+	{
+		std::lock_guard<std::mutex> lock( this->mutex );
+		if ( this->stopping )
+			return;
+
+		// One thread is left for the GUI thread, but there are always at least two workers
+		if ( this->workers.empty() ) {
+			size_t count = std::max( std::thread::hardware_concurrency(), 3u ) - 1;
+			for ( size_t i = 0; i < count; i++ ) {
+				this->workers.emplace_back( new Worker );
+			}
+			for ( size_t i = 0; i < count; i++ ) {
+				this->threads.emplace_back( &WorkerPool::run, this, i );
+			}
+		}
+
+		Worker* worker = this->workers[ this->next ].get();
+		this->next = ( this->next + 1 ) % this->workers.size();
+		{
+			std::lock_guard<std::mutex> worker_lock( worker->mutex );
+			worker->jobs.push_back( std::move( job ) );
+		}
+		this->unclaimed += 1;
+	}
+	this->wake.notify_one();
+}
+
+void bw::WorkerPool::run( size_t index ) {
+	std::function<void()> job;
+
+	while ( true ) {
+		{
+			std::unique_lock<std::mutex> lock( this->mutex );
+			this->wake.wait( lock, [this]() { return this->stopping || this->unclaimed > 0; } );
+			if ( this->stopping )
+				return;
+
+			this->unclaimed -= 1;
+			this->running += 1;
+		}
+
+		// Jobs are queued before they can be claimed, so there is always one left for a worker that has claimed one
+		if ( this->take( index, job ) ) {
+			job();
+			job = nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock( this->mutex );
+		this->running -= 1;
+		if ( this->stopping && this->running == 0 )
+			this->idle.notify_all();
+	}
+}
+
+bool bw::WorkerPool::take( size_t index, std::function<void()>& job ) {
+	for ( size_t i = 0; i < this->workers.size(); i++ ) {
+		Worker* worker = this->workers[ ( index + i ) % this->workers.size() ].get();
+		std::lock_guard<std::mutex> lock( worker->mutex );
+
+		if ( !worker->jobs.empty() ) {
+			// A worker takes its own jobs in order, while the others steal the newest ones
+			if ( i == 0 ) {
+				job = std::move( worker->jobs.front() );
+				worker->jobs.pop_front();
+			}
+			else {
+				job = std::move( worker->jobs.back() );
+				worker->jobs.pop_back();
+			}
+			return true;
+		}
+	}
+	return false;
+}
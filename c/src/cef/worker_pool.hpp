@@ -0,0 +1,60 @@
+#ifndef BW_CEF_WORKER_POOL_HPP
+#define BW_CEF_WORKER_POOL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+namespace bw {
+
+	// A bounded pool of threads in the browser process, that runs work which doesn't need the GUI thread.
+	// Every worker has a queue of its own, to which jobs are handed out in turn.
+	// A worker that has run out of jobs steals them from the back of the queues of the others, so that a slow job doesn't hold up the ones behind it.
+	class WorkerPool {
+		struct Worker {
+			std::mutex mutex;
+			std::deque<std::function<void()>> jobs;
+		};
+
+		std::mutex mutex;
+		std::condition_variable wake;
+		std::vector<std::unique_ptr<Worker>> workers;
+		std::vector<std::thread> threads;
+		size_t next;	// The worker that gets the next job
+		size_t unclaimed;	// The jobs that no worker has set out to run yet
+		size_t running;	// The jobs that a worker has set out to run, but that haven't finished yet
+		std::condition_variable idle;	// Notified when the last running job has finished while stopping
+		bool stopping;
+
+	public:
+		WorkerPool() : next(0), unclaimed(0), running(0), stopping(false) {}
+
+		// Drops the jobs that haven't started yet, and waits for the ones that are running.
+		// Jobs that are submitted afterwards are dropped right away.
+		void stop();
+		// Same as `stop`, but only waits for the running jobs until the deadline.
+		// The threads of the jobs that are still running then are left to finish by themselves, which is only meant for when the process is about to exit.
+		// Returns whether all jobs have finished in time.
+		bool stop( std::chrono::steady_clock::time_point deadline );
+		// Queues a job, and starts the threads when this is the first one.
+		void submit( std::function<void()> job );
+
+	protected:
+		void run( size_t index );
+		// Takes a job from the worker's own queue, or steals one from another.
+		bool take( size_t index, std::function<void()>& job );
+	};
+
+	extern WorkerPool worker_pool;
+}
+
+
+
+#endif//BW_CEF_WORKER_POOL_HPP
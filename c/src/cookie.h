@@ -27,9 +27,53 @@ typedef struct {
 	struct bw_CookieIteratorImpl impl;
 } bw_CookieIterator;
 
+/// The fields of a cookie, used as flags in `bw_CookieFilter.fields`.
+#define BW_COOKIE_FIELD_NAME 0x01
+#define BW_COOKIE_FIELD_VALUE 0x02
+#define BW_COOKIE_FIELD_DOMAIN 0x04
+#define BW_COOKIE_FIELD_PATH 0x08
+/// The creation and expiration times
+#define BW_COOKIE_FIELD_TIMES 0x10
+/// The secure and http-only flags
+#define BW_COOKIE_FIELD_FLAGS 0x20
+#define BW_COOKIE_FIELD_ALL 0xFF
+
+/// Selects which cookies are visited by `bw_CookieJar_iteratorFiltered` and `bw_CookieJar_count`, and which of their fields are copied.
+/// The predicates are checked before a cookie is copied, so cookies that don't match cost next to nothing.
+/// Empty strings and zero timestamps match everything.
+typedef struct {
+	/// Only cookies of which the domain ends with this, such that `example.com` also matches `.www.example.com`
+	bw_CStrSlice domain;
+	/// Only cookies of which the path starts with this
+	bw_CStrSlice path;
+	/// Only cookies with exactly this name
+	bw_CStrSlice name;
+	/// Only cookies that expire at or after this time, in milliseconds since the unix epoch
+	uint64_t expires_after;
+	/// Only cookies that expire before this time, in milliseconds since the unix epoch
+	uint64_t expires_before;
+	/// A combination of `BW_COOKIE_FIELD_*` flags of the fields that are copied, the others are left empty
+	unsigned char fields;
+} bw_CookieFilter;
+
+/// The string fields of a cookie, as written by `bw_Cookie_getFieldsInto`.
+typedef struct {
+	bw_CStrSlice name;
+	bw_CStrSlice value;
+	bw_CStrSlice domain;
+	bw_CStrSlice path;
+} bw_CookieStrings;
+
 typedef void (*bw_CookieJarStorageCallbackFn)( bw_CookieJar* cj, void* data, bw_Err error );
 typedef void (*bw_CookieIteratorNextCallbackFn)(bw_CookieIterator* ci, void* data, bw_Cookie* cookie);
+/// Like `bw_CookieIteratorNextCallbackFn`, but the cookie is only borrowed, and is only valid during the invocation of the callback.
+/// `cookie` is null if the visit ended without another cookie that matches the iterator's filter.
+typedef void (*bw_CookieIteratorNextBorrowedCallbackFn)(bw_CookieIterator* ci, void* data, const bw_Cookie* cookie);
 typedef void (*bw_CookieJarDeleteCallbackFn)(bw_CookieJar* cj, void* data, unsigned int deleted);
+/// Receives the number of cookies that `bw_CookieJar_count` has counted.
+typedef void (*bw_CookieJarCountCallbackFn)(bw_CookieJar* cj, void* data, size_t count);
+/// Receives the number of cookies that `bw_CookieJar_storeMany` has been able to store.
+typedef void (*bw_CookieJarStoreManyCallbackFn)(bw_CookieJar* cj, void* data, size_t stored);
 
 
 
@@ -41,6 +85,11 @@ BOOL bw_Cookie_getDomain(const bw_Cookie* cookie, bw_StrSlice* domain);
 void bw_Cookie_setDomain(bw_Cookie* cookie, bw_CStrSlice domain);
 uint64_t bw_Cookie_getExpires(const bw_Cookie* cookie);
 void bw_Cookie_setExpires(bw_Cookie* cookie, uint64_t time);
+/// Writes the name, value, domain and path of the cookie as UTF-8 into `buffer`, one after the other, and points the slices of `strings` into it.
+/// Nothing needs to be freed, so a whole batch of cookies can be written into one buffer.
+/// Returns the number of bytes that the fields take up.
+/// If that is more than `capacity`, nothing is written, and the call can be repeated with a large enough buffer.
+size_t bw_Cookie_getFieldsInto(const bw_Cookie* cookie, char* buffer, size_t capacity, bw_CookieStrings* strings);
 BOOL bw_Cookie_getName(const bw_Cookie* cookie, bw_StrSlice* name);
 void bw_Cookie_setName(bw_Cookie* cookie, bw_CStrSlice name);
 BOOL bw_Cookie_getPath(const bw_Cookie* cookie, bw_StrSlice* path);
@@ -52,15 +101,33 @@ void bw_Cookie_makeHttpOnly(bw_Cookie* cookie);
 BOOL bw_Cookie_isSecure(const bw_Cookie* cookie);
 void bw_Cookie_makeSecure(bw_Cookie* cookie);
 
+/// Counts the cookies that match the filter, without copying any of them.
+/// If `url` is empty, cookies of all urls are counted.
+void bw_CookieJar_count(bw_CookieJar* jar, BOOL include_http_only, bw_CStrSlice url, const bw_CookieFilter* filter, bw_CookieJarCountCallbackFn cb, void* cb_data);
 void bw_CookieJar_delete(bw_CookieJar* jar, bw_CStrSlice url, bw_CStrSlice name, bw_CookieJarDeleteCallbackFn cb, void* cb_data);
+/// Deletes the cookies with any of the given names, like `bw_CookieJar_delete` does for one name.
+/// The callback is invoked only once, with the total number of deleted cookies, after all deletions have completed.
+void bw_CookieJar_deleteMany(bw_CookieJar* jar, bw_CStrSlice url, const bw_CStrSlice* names, size_t count, bw_CookieJarDeleteCallbackFn cb, void* cb_data);
 void bw_CookieJar_free(bw_CookieJar* jar);
 void bw_CookieJar_iterator(bw_CookieJar* jar, bw_CookieIterator** iterator, BOOL include_http_only, bw_CStrSlice url);
 void bw_CookieJar_iteratorAll(bw_CookieJar* jar, bw_CookieIterator** iterator);
+/// Like `bw_CookieJar_iterator`, but only visits the cookies that match `filter`, and only copies the fields selected by it.
+/// If `url` is empty, cookies of all urls are visited.
+void bw_CookieJar_iteratorFiltered(bw_CookieJar* jar, bw_CookieIterator** iterator, BOOL include_http_only, bw_CStrSlice url, const bw_CookieFilter* filter);
 bw_CookieJar* bw_CookieJar_newGlobal();
 bw_Err bw_CookieJar_store(bw_CookieJar* jar, bw_CStrSlice url, const bw_Cookie* cookie, bw_CookieJarStorageCallbackFn cb, void* cb_data);
+/// Stores all given cookies for the given url.
+/// The callback is invoked only once, with the number of cookies that have been stored successfully, after all of them have been processed.
+/// `cb` may be null.
+void bw_CookieJar_storeMany(bw_CookieJar* jar, bw_CStrSlice url, const bw_Cookie* const* cookies, size_t count, bw_CookieJarStoreManyCallbackFn cb, void* cb_data);
 
 void bw_CookieIterator_free(bw_CookieIterator* iterator);
+/// Provides the next cookie to `on_next`, which might be invoked later on if the cookie hasn't been visited yet.
+/// Cookies are buffered only until they are handed out, so iterating doesn't keep the whole jar in memory.
+/// Returns false if there are no more cookies, in which case `on_next` is not invoked.
 BOOL bw_CookieIterator_next(bw_CookieIterator* iterator, bw_CookieIteratorNextCallbackFn on_next, void* cb_data);
+/// Like `bw_CookieIterator_next`, but lends the cookie to `on_next` instead of allocating a copy of it that needs to be freed.
+BOOL bw_CookieIterator_nextBorrowed(bw_CookieIterator* iterator, bw_CookieIteratorNextBorrowedCallbackFn on_next, void* cb_data);
 
 
 
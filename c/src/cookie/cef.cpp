@@ -1,7 +1,12 @@
 #include "../cookie.h"
+#include "../application/impl.h"
 #include "../cef/util.hpp"
 #include "../common.h"
 
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <include/cef_cookie.h>
 
@@ -11,6 +16,8 @@
 
 
 bw_Cookie* bw_Cookie_fromCef(const CefCookie& cef_cookie);
+// Provides the next cookie to one of the given callbacks, of which only one is set.
+BOOL bw_CookieIterator_nextAny(bw_CookieIterator* iterator, bw_CookieIteratorNextCallbackFn on_next, bw_CookieIteratorNextBorrowedCallbackFn on_next_borrowed, void* cb_data);
 
 class BwDeleteCookiesCallback : public CefDeleteCookiesCallback {
 public:
@@ -28,32 +35,220 @@ protected:
 	IMPLEMENT_REFCOUNTING(BwDeleteCookiesCallback);
 };
 
+// One callback that is shared by all deletions of bw_CookieJar_deleteMany.
+// The jar's callback is invoked when the last of them completes.
+class BwDeleteManyCookiesCallback : public CefDeleteCookiesCallback {
+public:
+	bw_CookieJar* jar;
+	bw_CookieJarDeleteCallbackFn cb;
+	void* cb_data;
+	// Starts one higher than the number of deletions, so that it can't reach zero before all of them have been issued
+	std::atomic<size_t> pending;
+	std::atomic<unsigned int> deleted;
+
+	BwDeleteManyCookiesCallback(bw_CookieJar* jar, size_t count, bw_CookieJarDeleteCallbackFn cb, void* cb_data) :
+		jar(jar), cb(cb), cb_data(cb_data), pending(count + 1), deleted(0)
+	{}
+
+	void OnComplete(int num_deleted) override {
+		this->deleted += num_deleted;
+		this->release();
+	}
+
+	// Marks one deletion as done
+	void release() {
+		if (--this->pending == 0)
+			this->cb(this->jar, this->cb_data, this->deleted);
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(BwDeleteManyCookiesCallback);
+};
+
+// The predicates of a bw_CookieFilter, with the strings converted only once.
+// Cookie fields are compared in the UTF-16 form that CEF stores them in, so that a cookie is never converted just to find out it doesn't match.
+class BwCookieFilter {
+public:
+	CefString domain;
+	CefString path;
+	CefString name;
+	uint64_t expires_after;
+	uint64_t expires_before;
+	unsigned char fields;
+
+	BwCookieFilter(const bw_CookieFilter& filter) :
+		domain(bw_cef_copyFromStrSlice(filter.domain)),
+		path(bw_cef_copyFromStrSlice(filter.path)),
+		name(bw_cef_copyFromStrSlice(filter.name)),
+		expires_after(filter.expires_after),
+		expires_before(filter.expires_before),
+		fields(filter.fields)
+	{}
+
+	bool matches(const CefCookie& cookie) const {
+		if (!this->name.empty() && !equals(cookie.name, this->name))
+			return false;
+		if (!this->domain.empty() && !endsWith(cookie.domain, this->domain))
+			return false;
+		if (!this->path.empty() && !startsWith(cookie.path, this->path))
+			return false;
+
+		if (this->expires_after != 0 || this->expires_before != 0) {
+			// Session cookies don't expire at any given time
+			if (!cookie.has_expires)
+				return false;
+
+			CefTime time(cookie.expires);
+			uint64_t expires = (uint64_t)(time.GetDoubleT() * 1000);
+			if (this->expires_after != 0 && expires < this->expires_after)
+				return false;
+			if (this->expires_before != 0 && expires >= this->expires_before)
+				return false;
+		}
+
+		return true;
+	}
+
+	// Copies only the selected fields of the cookie
+	CefCookie project(const CefCookie& cookie) const {
+		if (this->fields == BW_COOKIE_FIELD_ALL)
+			return cookie;
+
+		CefCookie result;
+		if (this->fields & BW_COOKIE_FIELD_NAME)
+			cef_string_set(cookie.name.str, cookie.name.length, &result.name, 1);
+		if (this->fields & BW_COOKIE_FIELD_VALUE)
+			cef_string_set(cookie.value.str, cookie.value.length, &result.value, 1);
+		if (this->fields & BW_COOKIE_FIELD_DOMAIN)
+			cef_string_set(cookie.domain.str, cookie.domain.length, &result.domain, 1);
+		if (this->fields & BW_COOKIE_FIELD_PATH)
+			cef_string_set(cookie.path.str, cookie.path.length, &result.path, 1);
+		if (this->fields & BW_COOKIE_FIELD_TIMES) {
+			result.creation = cookie.creation;
+			result.last_access = cookie.last_access;
+			result.has_expires = cookie.has_expires;
+			result.expires = cookie.expires;
+		}
+		if (this->fields & BW_COOKIE_FIELD_FLAGS) {
+			result.secure = cookie.secure;
+			result.httponly = cookie.httponly;
+		}
+		return result;
+	}
+
+protected:
+	static bool equals(const cef_string_t& string, const CefString& other) {
+		return string.length == other.length() && std::char_traits<CefString::char_type>::compare(string.str, other.c_str(), string.length) == 0;
+	}
+
+	static bool endsWith(const cef_string_t& string, const CefString& suffix) {
+		return string.length >= suffix.length() && std::char_traits<CefString::char_type>::compare(string.str + (string.length - suffix.length()), suffix.c_str(), suffix.length()) == 0;
+	}
+
+	static bool startsWith(const cef_string_t& string, const CefString& prefix) {
+		return string.length >= prefix.length() && std::char_traits<CefString::char_type>::compare(string.str, prefix.c_str(), prefix.length()) == 0;
+	}
+};
+
+// Counts the cookies that match a filter.
+// The count is reported when CEF releases the visitor, which also happens when there are no cookies to visit at all.
+class BwCookieCountVisitor : public CefCookieVisitor {
+public:
+	bw_CookieJar* jar;
+	BwCookieFilter filter;
+	size_t count;
+	bw_CookieJarCountCallbackFn cb;
+	void* cb_data;
+
+	BwCookieCountVisitor(bw_CookieJar* jar, const bw_CookieFilter& filter, bw_CookieJarCountCallbackFn cb, void* cb_data) :
+		jar(jar), filter(filter), count(0), cb(cb), cb_data(cb_data)
+	{}
+
+	~BwCookieCountVisitor() {
+		this->cb(this->jar, this->cb_data, this->count);
+	}
+
+	bool Visit(const CefCookie& cookie, int count, int total, bool& delete_cookie) override {
+		UNUSED(count);
+		UNUSED(total);
+		UNUSED(delete_cookie);
+
+		if (this->filter.matches(cookie))
+			this->count += 1;
+		return true;
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(BwCookieCountVisitor);
+};
+
+// Hands out the visited cookies to the iterator.
+// Cookies are only buffered while nobody is waiting on them, and are removed from the buffer as soon as they are handed out.
+// CEF visits cookies on its UI thread, which isn't necessarily the thread that the iterator is used on, so the state is protected by a mutex.
 class BwCookieVisitor : public CefCookieVisitor {
 public:
 	bw_CookieIterator* iterator;
-	std::vector<CefCookie> cookies;
+	std::deque<CefCookie> cookies;
 	bool finished;
 	bw_CookieIteratorNextCallbackFn next_cb;
+	bw_CookieIteratorNextBorrowedCallbackFn next_borrowed_cb;
 	void* cb_data;
+	std::mutex mutex;
+	std::optional<BwCookieFilter> filter;
 
-	BwCookieVisitor(bw_CookieIterator* iterator) : iterator(iterator), finished(false), next_cb(0) {}
+	BwCookieVisitor(bw_CookieIterator* iterator) : iterator(iterator), finished(false), next_cb(0), next_borrowed_cb(0) {}
 
 	bool Visit(const CefCookie& cookie, int count, int total, bool& delete_cookie) override {
 		UNUSED(delete_cookie);
 
-		this->cookies.push_back(cookie);
+		bool matches = !this->filter.has_value() || this->filter->matches(cookie);
 
-		if (this->next_cb != 0) {
-			this->next_cb(this->iterator, this->cb_data, bw_Cookie_fromCef(cookie));
-			this->next_cb = 0;
-		}
+		std::unique_lock<std::mutex> lock(this->mutex);
 
 		if ((count+1) == total)
 			this->finished = true;
 
+		// If the iterator is waiting on this cookie, it is handed over without being buffered.
+		// If the last cookie doesn't match the filter, a waiting iterator is told that there are no more cookies.
+		if ((matches || this->finished) && (this->next_cb != 0 || this->next_borrowed_cb != 0)) {
+			bw_CookieIteratorNextCallbackFn next_cb = this->next_cb;
+			bw_CookieIteratorNextBorrowedCallbackFn next_borrowed_cb = this->next_borrowed_cb;
+			this->next_cb = 0;
+			this->next_borrowed_cb = 0;
+			lock.unlock();
+
+			if (!matches)
+				this->handOutNothing(next_cb, next_borrowed_cb, this->cb_data);
+			else if (this->filter.has_value())
+				this->handOut(this->filter->project(cookie), next_cb, next_borrowed_cb, this->cb_data);
+			else
+				this->handOut(cookie, next_cb, next_borrowed_cb, this->cb_data);
+		}
+		else if (matches)
+			this->cookies.push_back(this->filter.has_value() ? this->filter->project(cookie) : cookie);
+
 		return true;
 	}
 
+	// Invokes whichever callback is set with the cookie
+	void handOut(const CefCookie& cookie, bw_CookieIteratorNextCallbackFn next_cb, bw_CookieIteratorNextBorrowedCallbackFn next_borrowed_cb, void* cb_data) {
+		if (next_cb != 0)
+			next_cb(this->iterator, cb_data, bw_Cookie_fromCef(cookie));
+		else {
+			bw_Cookie view;
+			view.impl.handle_ptr = (void*)&cookie;
+			next_borrowed_cb(this->iterator, cb_data, &view);
+		}
+	}
+
+	// Invokes whichever callback is set without a cookie
+	void handOutNothing(bw_CookieIteratorNextCallbackFn next_cb, bw_CookieIteratorNextBorrowedCallbackFn next_borrowed_cb, void* cb_data) {
+		if (next_cb != 0)
+			next_cb(this->iterator, cb_data, 0);
+		else
+			next_borrowed_cb(this->iterator, cb_data, 0);
+	}
+
 protected:
 	IMPLEMENT_REFCOUNTING(BwCookieVisitor);
 };
@@ -86,6 +281,36 @@ protected:
 	IMPLEMENT_REFCOUNTING(BwSetCookieCallback);
 };
 
+// One callback that is shared by all cookies of bw_CookieJar_storeMany, so that only one completion is reported.
+class BwSetManyCookiesCallback : public CefSetCookieCallback {
+public:
+	bw_CookieJar* cookie_jar;
+	bw_CookieJarStoreManyCallbackFn cb;
+	void* cb_data;
+	// Starts one higher than the number of cookies, so that it can't reach zero before all of them have been handed to CEF
+	std::atomic<size_t> pending;
+	std::atomic<size_t> stored;
+
+	BwSetManyCookiesCallback(bw_CookieJar* cookie_jar, size_t count, bw_CookieJarStoreManyCallbackFn cb, void* cb_data) : CefSetCookieCallback(),
+		cookie_jar(cookie_jar), cb(cb), cb_data(cb_data), pending(count + 1), stored(0)
+	{}
+
+	void OnComplete(bool success) override {
+		if (success)
+			this->stored += 1;
+		this->release();
+	}
+
+	// Marks one cookie as processed
+	void release() {
+		if (--this->pending == 0 && this->cb != 0)
+			this->cb(this->cookie_jar, this->cb_data, this->stored);
+	}
+
+protected:
+	IMPLEMENT_REFCOUNTING(BwSetManyCookiesCallback);
+};
+
 
 
 void bw_Cookie_free(bw_Cookie* cookie) {
@@ -125,6 +350,32 @@ void bw_Cookie_setCreationTime(bw_Cookie* cookie, uint64_t time) {
 	((CefCookie*)cookie->impl.handle_ptr)->creation = cef_time;
 }
 
+size_t bw_Cookie_getFieldsInto(const bw_Cookie* cookie, char* buffer, size_t capacity, bw_CookieStrings* strings) {
+	const CefCookie* cef_cookie = (const CefCookie*)cookie->impl.handle_ptr;
+	const cef_string_t* fields[4] = { &cef_cookie->name, &cef_cookie->value, &cef_cookie->domain, &cef_cookie->path };
+	bw_CStrSlice* slices[4] = { &strings->name, &strings->value, &strings->domain, &strings->path };
+
+	size_t lengths[4];
+	size_t total = 0;
+	for (size_t i = 0; i < 4; i++) {
+		lengths[i] = bw_cef_utf8Length(*fields[i]);
+		total += lengths[i];
+	}
+
+	if (total > capacity)
+		return total;
+
+	// Every field is converted straight into the buffer, without any temporary copies
+	size_t offset = 0;
+	for (size_t i = 0; i < 4; i++) {
+		slices[i]->data = buffer + offset;
+		slices[i]->len = bw_cef_writeUtf8(*fields[i], buffer + offset);
+		offset += slices[i]->len;
+	}
+
+	return total;
+}
+
 BOOL bw_Cookie_getDomain(const bw_Cookie* cookie, bw_StrSlice* domain) {
 	CefString string(&((CefCookie*)cookie->impl.handle_ptr)->domain);
 	*domain = bw_cef_copyToStrSlice(string);
@@ -208,6 +459,19 @@ void bw_CookieJar_delete(bw_CookieJar* jar, bw_CStrSlice _url, bw_CStrSlice _nam
 	CEF_COOKIE_MANAGER(jar)->DeleteCookies(url, name, cef_cb);
 }
 
+void bw_CookieJar_deleteMany(bw_CookieJar* jar, bw_CStrSlice _url, const bw_CStrSlice* names, size_t count, bw_CookieJarDeleteCallbackFn cb, void* cb_data) {
+	CefRefPtr<BwDeleteManyCookiesCallback> cef_cb(new BwDeleteManyCookiesCallback(jar, count, cb, cb_data));
+
+	CefString url = bw_cef_copyFromStrSlice(_url);
+	CefRefPtr<CefCookieManager> manager = CEF_COOKIE_MANAGER(jar);
+	for (size_t i = 0; i < count; i++) {
+		if (!manager->DeleteCookies(url, bw_cef_copyFromStrSlice(names[i]), cef_cb))
+			cef_cb->release();
+	}
+
+	cef_cb->release();
+}
+
 void bw_CookieJar_free(bw_CookieJar* jar) {
 	delete (CefRefPtr<CefCookieManager>*)jar->impl.handle_ptr;
 	free(jar);
@@ -217,7 +481,6 @@ void bw_CookieJar_iterator(bw_CookieJar* jar, bw_CookieIterator** iterator, BOOL
 	CefString url = bw_cef_copyFromStrSlice(_url);
 
 	*iterator = (bw_CookieIterator*)malloc(sizeof(bw_CookieIterator));
-	(*iterator)->impl.index = 0;
 	CefRefPtr<BwCookieVisitor>* visitor = new CefRefPtr<BwCookieVisitor>(new BwCookieVisitor(*iterator));
 	(*iterator)->impl.visitor_ptr = (void*)visitor;
 	
@@ -226,10 +489,35 @@ void bw_CookieJar_iterator(bw_CookieJar* jar, bw_CookieIterator** iterator, BOOL
 		(*visitor)->finished = true;
 }
 
+void bw_CookieJar_count(bw_CookieJar* jar, BOOL include_http_only, bw_CStrSlice _url, const bw_CookieFilter* filter, bw_CookieJarCountCallbackFn cb, void* cb_data) {
+	// No reference is kept, so that the count is reported as soon as CEF is done with the visitor
+	CefRefPtr<BwCookieCountVisitor> visitor(new BwCookieCountVisitor(jar, *filter, cb, cb_data));
+
+	if (_url.len == 0)
+		CEF_COOKIE_MANAGER(jar)->VisitAllCookies(visitor);
+	else
+		CEF_COOKIE_MANAGER(jar)->VisitUrlCookies(bw_cef_copyFromStrSlice(_url), include_http_only, visitor);
+}
+
+void bw_CookieJar_iteratorFiltered(bw_CookieJar* jar, bw_CookieIterator** iterator, BOOL include_http_only, bw_CStrSlice _url, const bw_CookieFilter* filter) {
+
+	*iterator = (bw_CookieIterator*)malloc(sizeof(bw_CookieIterator));
+	CefRefPtr<BwCookieVisitor>* visitor = new CefRefPtr<BwCookieVisitor>(new BwCookieVisitor(*iterator));
+	(*visitor)->filter.emplace(*filter);
+	(*iterator)->impl.visitor_ptr = (void*)visitor;
+
+	bool not_empty;
+	if (_url.len == 0)
+		not_empty = CEF_COOKIE_MANAGER(jar)->VisitAllCookies(*visitor);
+	else
+		not_empty = CEF_COOKIE_MANAGER(jar)->VisitUrlCookies(bw_cef_copyFromStrSlice(_url), include_http_only, *visitor);
+	if (!not_empty)
+		(*visitor)->finished = true;
+}
+
 void bw_CookieJar_iteratorAll(bw_CookieJar* jar, bw_CookieIterator** iterator) {
 
 	*iterator = (bw_CookieIterator*)malloc(sizeof(bw_CookieIterator));
-	(*iterator)->impl.index = 0;
 	CefRefPtr<BwCookieVisitor>* visitor = new CefRefPtr<BwCookieVisitor>(new BwCookieVisitor(*iterator));
 	(*iterator)->impl.visitor_ptr = (void*)visitor;
 	
@@ -239,6 +527,7 @@ void bw_CookieJar_iteratorAll(bw_CookieJar* jar, bw_CookieIterator** iterator) {
 }
 
 bw_CookieJar* bw_CookieJar_newGlobal() {
+	bw_ApplicationEngineImpl_startPending();
 
 	CefRefPtr<CefCookieManager>* mgr = new CefRefPtr<CefCookieManager>(CefCookieManager::GetGlobalManager(0));
 
@@ -260,37 +549,66 @@ bw_Err bw_CookieJar_store(bw_CookieJar* jar, bw_CStrSlice url, const bw_Cookie*
 	BW_ERR_RETURN_SUCCESS;
 }
 
+void bw_CookieJar_storeMany(bw_CookieJar* jar, bw_CStrSlice url, const bw_Cookie* const* cookies, size_t count, bw_CookieJarStoreManyCallbackFn cb, void* cb_data) {
+	// The url is only converted once, and the cookies are already stored as CefCookies
+	CefString cef_url = bw_cef_copyFromStrSlice(url);
+	CefRefPtr<CefCookieManager> manager = CEF_COOKIE_MANAGER(jar);
+
+	CefRefPtr<BwSetManyCookiesCallback> cef_cb(new BwSetManyCookiesCallback(jar, count, cb, cb_data));
+
+	for (size_t i = 0; i < count; i++) {
+		const CefCookie& cef_cookie = *(const CefCookie*)cookies[i]->impl.handle_ptr;
+
+		// Cookies that CEF refuses right away never complete
+		if (!manager->SetCookie(cef_url, cef_cookie, cef_cb))
+			cef_cb->release();
+	}
+
+	cef_cb->release();
+}
+
 void bw_CookieIterator_free(bw_CookieIterator* iterator) {
 	delete (CefRefPtr<BwCookieVisitor>*)iterator->impl.visitor_ptr;
 	free(iterator);
 }
 
 BOOL bw_CookieIterator_next(bw_CookieIterator* iterator, bw_CookieIteratorNextCallbackFn on_next, void* cb_data) {
+	return bw_CookieIterator_nextAny(iterator, on_next, 0, cb_data);
+}
+
+BOOL bw_CookieIterator_nextAny(bw_CookieIterator* iterator, bw_CookieIteratorNextCallbackFn on_next, bw_CookieIteratorNextBorrowedCallbackFn on_next_borrowed, void* cb_data) {
 	CefRefPtr<BwCookieVisitor> visitor = *(CefRefPtr<BwCookieVisitor>*)iterator->impl.visitor_ptr;
 
-	size_t& index = iterator->impl.index;
+	std::unique_lock<std::mutex> lock(visitor->mutex);
 
-	if (index >= visitor->cookies.size()) {
+	if (visitor->cookies.empty()) {
 		
 		// If finished, return false
 		if (visitor->finished)
 			return FALSE;
 		// If not yet finished, wait on the next cookie
 		else {
-			// If next_cb already set, we can't do anything.
-			BW_ASSERT(visitor->next_cb == 0, "cookie iterator is already waiting on next item");
+			// If a callback is already set, we can't do anything.
+			BW_ASSERT(visitor->next_cb == 0 && visitor->next_borrowed_cb == 0, "cookie iterator is already waiting on next item");
 			
 			visitor->next_cb = on_next;
+			visitor->next_borrowed_cb = on_next_borrowed;
 			visitor->cb_data = cb_data;
 		}
 	}
 	// If cookie already available, return it immediately
 	else {
-		bw_Cookie* cookie = bw_Cookie_fromCef(visitor->cookies[index]);
-		on_next(iterator, cb_data, cookie);
+		// The cookie is taken out of the buffer, so that it is freed as soon as it has been handed out
+		CefCookie cookie = std::move(visitor->cookies.front());
+		visitor->cookies.pop_front();
+		lock.unlock();
+
+		visitor->handOut(cookie, on_next, on_next_borrowed, cb_data);
 	}
 
-	index += 1;
+	return TRUE;
+}
 
-	return true;
-}
\ No newline at end of file
+BOOL bw_CookieIterator_nextBorrowed(bw_CookieIterator* iterator, bw_CookieIteratorNextBorrowedCallbackFn on_next, void* cb_data) {
+	return bw_CookieIterator_nextAny(iterator, 0, on_next, cb_data);
+}
@@ -14,7 +14,6 @@ struct bw_CookieJarImpl {
 };
 
 struct bw_CookieIteratorImpl {
-	size_t index;
 	void* visitor_ptr;
 };
 
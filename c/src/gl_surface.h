@@ -1,23 +1,83 @@
 #ifndef BW_GL_SURFACE_H
 #define BW_GL_SURFACE_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bool.h"
+#include "browser_window.h"
 #include "window.h"
 
+#ifndef BW_BINDGEN
+
+#if defined(BW_GTK)
+#include "gl_surface/glx.h"
+#else
+#error No GL surface implementation available for this windowing API
+#endif
+
+// The definition of bw_GlSurfaceImpl is not required within Rust code.
+#else
+typedef struct {} bw_GlSurfaceImpl;
+#endif
+
+#include <stddef.h>
+
+
 
+/// The number of pixel buffers that the frames are uploaded through.
+/// While the driver still transfers one to the texture, the next frame is written into the other.
+#define BW_GL_SURFACE_PBO_COUNT 2
 
+/// A GL context that renders into a window, and that keeps the frames of a windowless browser window in a texture.
+/// Native overlays can composite with the web content by drawing this texture together with everything else, at the display's refresh rate.
 typedef struct {
+	bw_Window* window;
+	/// The name of the GL texture with the latest frame of the browser window, or 0 before the first frame.
+	unsigned int texture;
+	int width;
+	int height;
+	unsigned int pbos[ BW_GL_SURFACE_PBO_COUNT ];
+	unsigned int next_pbo;
 	/// Implementation related data
 	bw_GlSurfaceImpl impl;
 } bw_GlSurface;
 
 
 
+/// Lets the surface receive the frames of the given windowless browser window, by setting its paint handler.
+/// Only the areas that have changed are uploaded.
+/// The paint handler needs to be removed before the surface is destroyed.
+void bw_GlSurface_attach( bw_GlSurface* surface, bw_BrowserWindow* bw );
+
 /// Removes and cleans up the GL surface, freeing it from memory as well.
 void bw_GlSurface_destroy( bw_GlSurface* surface );
 
-/// Creates a new GL surface inside the given window.
+/// Makes the surface's GL context current on the calling thread.
+/// Returns false if that failed.
+BOOL bw_GlSurface_makeCurrent( bw_GlSurface* surface );
+
+/// Creates a new GL surface inside the given window, which covers the window's content area.
+/// Returns null if no GL context could be created.
 bw_GlSurface* bw_GlSurface_new( bw_Window* window );
 
+/// Changes the size of the area that the surface renders into.
+void bw_GlSurface_resize( bw_GlSurface* surface, int width, int height );
+
+/// Presents what has been rendered into the surface.
+void bw_GlSurface_swapBuffers( bw_GlSurface* surface );
+
+/// Uploads the areas of the frame that have changed into the surface's texture, through a pixel buffer.
+/// The surface's context needs to be current.
+/// A frame of another size than the previous one replaces the whole texture.
+/// Frames of popup widgets are ignored.
+void bw_GlSurface_uploadFrame( bw_GlSurface* surface, const bw_BrowserWindowFrame* frame );
+
+
 
+#ifdef __cplusplus
+} // extern "C"
+#endif
 
-#endif//BW_GL_SURFACE_H
\ No newline at end of file
+#endif//BW_GL_SURFACE_H
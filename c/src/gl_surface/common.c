@@ -1,16 +1,171 @@
 #include "../gl_surface.h"
 #include "impl.h"
 
+#include <stdlib.h>
+#include <string.h>
 
 
+
+BOOL bw_GlSurface_clampRect( bw_BrowserWindowRect* rect, const bw_BrowserWindowFrame* frame );
+void bw_GlSurface_paintHandler( bw_BrowserWindow* bw, void* user_data, const bw_BrowserWindowFrame* frame );
+void bw_GlSurface_uploadRects( const bw_BrowserWindowFrame* frame, const bw_BrowserWindowRect* rects, size_t rect_count, const void* pixels );
+
+
+
+void bw_GlSurface_attach( bw_GlSurface* surface, bw_BrowserWindow* bw ) {
+	bw_BrowserWindow_setPaintHandler( bw, bw_GlSurface_paintHandler, surface, 0 );
+}
+
+// Limits the rect to the frame, and returns whether anything is left of it
+BOOL bw_GlSurface_clampRect( bw_BrowserWindowRect* rect, const bw_BrowserWindowFrame* frame ) {
+	int left = rect->x > 0 ? rect->x : 0;
+	int top = rect->y > 0 ? rect->y : 0;
+	int right = rect->x + rect->width < frame->width ? rect->x + rect->width : frame->width;
+	int bottom = rect->y + rect->height < frame->height ? rect->y + rect->height : frame->height;
+	if ( right <= left || bottom <= top )
+		return FALSE;
+
+	rect->x = left;
+	rect->y = top;
+	rect->width = right - left;
+	rect->height = bottom - top;
+	return TRUE;
+}
+
 void bw_GlSurface_destroy( bw_GlSurface* surface ) {
+
+	// The GL objects can only be deleted while their context is current
+	if ( bw_GlSurfaceImpl_makeCurrent( &surface->impl ) ) {
+		if ( surface->texture != 0 )
+			glDeleteTextures( 1, &surface->texture );
+		if ( surface->pbos[0] != 0 )
+			glDeleteBuffers( BW_GL_SURFACE_PBO_COUNT, surface->pbos );
+	}
+
 	bw_GlSurfaceImpl_destroy( &surface->impl );
+	free( surface );
+}
+
+BOOL bw_GlSurface_makeCurrent( bw_GlSurface* surface ) {
+	return bw_GlSurfaceImpl_makeCurrent( &surface->impl );
 }
 
 bw_GlSurface* bw_GlSurface_new( bw_Window* window ) {
 	bw_GlSurface* surface = (bw_GlSurface*)malloc( sizeof( bw_GlSurface ) );
+	memset( surface, 0, sizeof( bw_GlSurface ) );
+	surface->window = window;
 
-	surface->impl = bw_GlSurfaceImpl_new( window );
+	bw_Dims2D size = bw_Window_getContentDimensions( window );
+	if ( !bw_GlSurfaceImpl_new( &surface->impl, window, size.width, size.height ) ) {
+		free( surface );
+		return 0;
+	}
 
 	return surface;
-}
\ No newline at end of file
+}
+
+void bw_GlSurface_paintHandler( bw_BrowserWindow* bw, void* user_data, const bw_BrowserWindowFrame* frame ) {
+	(void)(bw);
+	bw_GlSurface* surface = (bw_GlSurface*)user_data;
+
+	if ( bw_GlSurfaceImpl_makeCurrent( &surface->impl ) )
+		bw_GlSurface_uploadFrame( surface, frame );
+}
+
+void bw_GlSurface_resize( bw_GlSurface* surface, int width, int height ) {
+	bw_GlSurfaceImpl_resize( &surface->impl, width > 0 ? width : 1, height > 0 ? height : 1 );
+}
+
+void bw_GlSurface_swapBuffers( bw_GlSurface* surface ) {
+	bw_GlSurfaceImpl_swapBuffers( &surface->impl );
+}
+
+void bw_GlSurface_uploadFrame( bw_GlSurface* surface, const bw_BrowserWindowFrame* frame ) {
+	if ( frame->is_popup || frame->width <= 0 || frame->height <= 0 )
+		return;
+
+	size_t stride = (size_t)frame->width * 4;
+	size_t size = stride * (size_t)frame->height;
+
+	// A frame of another size replaces the whole texture, so its dirty rects don't matter
+	BOOL resized = FALSE;
+	if ( surface->texture == 0 ) {
+		glGenTextures( 1, &surface->texture );
+		glBindTexture( GL_TEXTURE_2D, surface->texture );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+		glGenBuffers( BW_GL_SURFACE_PBO_COUNT, surface->pbos );
+		resized = TRUE;
+	}
+	else {
+		glBindTexture( GL_TEXTURE_2D, surface->texture );
+		resized = frame->width != surface->width || frame->height != surface->height;
+	}
+	if ( resized ) {
+		glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, frame->width, frame->height, 0, GL_BGRA, GL_UNSIGNED_BYTE, 0 );
+		surface->width = frame->width;
+		surface->height = frame->height;
+	}
+
+	bw_BrowserWindowRect whole = { 0, 0, frame->width, frame->height };
+	const bw_BrowserWindowRect* rects = frame->dirty_rects;
+	size_t rect_count = frame->dirty_rect_count;
+	if ( resized || rect_count == 0 ) {
+		rects = &whole;
+		rect_count = 1;
+	}
+
+	GLuint pbo = surface->pbos[ surface->next_pbo ];
+	surface->next_pbo = (surface->next_pbo + 1) % BW_GL_SURFACE_PBO_COUNT;
+	glBindBuffer( GL_PIXEL_UNPACK_BUFFER, pbo );
+	// Orphaning the old storage keeps the driver from waiting on a transfer that may still read from it
+	glBufferData( GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)size, 0, GL_STREAM_DRAW );
+
+	unsigned char* mapped = (unsigned char*)glMapBuffer( GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY );
+	if ( mapped == 0 ) {
+		// Without a pixel buffer, the rects can still be uploaded straight from the frame
+		glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+		bw_GlSurface_uploadRects( frame, rects, rect_count, frame->buffer );
+		return;
+	}
+
+	// Only the dirty rows are copied, at the same place as in the frame, so that the rects can be uploaded from the buffer with the frame's layout
+	const unsigned char* pixels = (const unsigned char*)frame->buffer;
+	for ( size_t i = 0; i < rect_count; i++ ) {
+		bw_BrowserWindowRect rect = rects[i];
+		if ( !bw_GlSurface_clampRect( &rect, frame ) )
+			continue;
+
+		size_t offset = (size_t)rect.y * stride + (size_t)rect.x * 4;
+		for ( int y = 0; y < rect.height; y++ ) {
+			memcpy( mapped + offset, pixels + offset, (size_t)rect.width * 4 );
+			offset += stride;
+		}
+	}
+	glUnmapBuffer( GL_PIXEL_UNPACK_BUFFER );
+
+	// With a pixel buffer bound, the data pointer is an offset into the buffer
+	bw_GlSurface_uploadRects( frame, rects, rect_count, 0 );
+	glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+}
+
+void bw_GlSurface_uploadRects( const bw_BrowserWindowFrame* frame, const bw_BrowserWindowRect* rects, size_t rect_count, const void* pixels ) {
+
+	glPixelStorei( GL_UNPACK_ROW_LENGTH, frame->width );
+	for ( size_t i = 0; i < rect_count; i++ ) {
+		bw_BrowserWindowRect rect = rects[i];
+		if ( !bw_GlSurface_clampRect( &rect, frame ) )
+			continue;
+
+		glPixelStorei( GL_UNPACK_SKIP_PIXELS, rect.x );
+		glPixelStorei( GL_UNPACK_SKIP_ROWS, rect.y );
+		glTexSubImage2D( GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width, rect.height, GL_BGRA, GL_UNSIGNED_BYTE, pixels );
+	}
+
+	// Leave the unpack state as it was, for the renderer that draws with the same context
+	glPixelStorei( GL_UNPACK_ROW_LENGTH, 0 );
+	glPixelStorei( GL_UNPACK_SKIP_PIXELS, 0 );
+	glPixelStorei( GL_UNPACK_SKIP_ROWS, 0 );
+}
@@ -1,8 +1,94 @@
 #include "../gl_surface.h"
+#include "impl.h"
 
+#include <gdk/gdkx.h>
 
 
-bw_GlSurfaceImpl bw_GlSurfaceImpl_new( bw_Window* window ) {
 
-	glxCreateWindow( display, config, bw_Window_getXWindowHandle( window ) )
-}
\ No newline at end of file
+static const int bw_GlSurfaceImpl_attributes[] = {
+	GLX_X_RENDERABLE, True,
+	GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT,
+	GLX_RENDER_TYPE, GLX_RGBA_BIT,
+	GLX_RED_SIZE, 8,
+	GLX_GREEN_SIZE, 8,
+	GLX_BLUE_SIZE, 8,
+	GLX_ALPHA_SIZE, 8,
+	GLX_DEPTH_SIZE, 24,
+	GLX_DOUBLEBUFFER, True,
+	None
+};
+
+
+
+BOOL bw_GlSurfaceImpl_new( bw_GlSurfaceImpl* impl, bw_Window* window, int width, int height ) {
+
+	// The X window only exists once GTK has realized the widget
+	gtk_widget_realize( window->impl.handle );
+	GdkWindow* gdk_window = gtk_widget_get_window( window->impl.handle );
+	impl->display = GDK_WINDOW_XDISPLAY( gdk_window );
+	Window parent = GDK_WINDOW_XID( gdk_window );
+
+	int config_count = 0;
+	GLXFBConfig* configs = glXChooseFBConfig( impl->display, DefaultScreen( impl->display ), bw_GlSurfaceImpl_attributes, &config_count );
+	if ( configs == 0 )
+		return FALSE;
+	if ( config_count == 0 ) {
+		XFree( configs );
+		return FALSE;
+	}
+	GLXFBConfig config = configs[0];
+	XFree( configs );
+
+	XVisualInfo* visual = glXGetVisualFromFBConfig( impl->display, config );
+	if ( visual == 0 )
+		return FALSE;
+
+	// Input events are not selected, so they propagate to GTK's window
+	XSetWindowAttributes attributes;
+	impl->colormap = XCreateColormap( impl->display, parent, visual->visual, AllocNone );
+	attributes.colormap = impl->colormap;
+	attributes.border_pixel = 0;
+	attributes.event_mask = 0;
+	impl->x_window = XCreateWindow(
+		impl->display, parent,
+		0, 0, width > 0 ? width : 1, height > 0 ? height : 1,
+		0, visual->depth, InputOutput, visual->visual,
+		CWColormap | CWBorderPixel | CWEventMask, &attributes
+	);
+	XFree( visual );
+
+	impl->context = glXCreateNewContext( impl->display, config, GLX_RGBA_TYPE, 0, True );
+	if ( impl->context == 0 ) {
+		XDestroyWindow( impl->display, impl->x_window );
+		XFreeColormap( impl->display, impl->colormap );
+		return FALSE;
+	}
+
+	XMapWindow( impl->display, impl->x_window );
+	return TRUE;
+}
+
+void bw_GlSurfaceImpl_destroy( bw_GlSurfaceImpl* impl ) {
+	if ( glXGetCurrentContext() == impl->context )
+		glXMakeCurrent( impl->display, None, 0 );
+
+	glXDestroyContext( impl->display, impl->context );
+	XDestroyWindow( impl->display, impl->x_window );
+	XFreeColormap( impl->display, impl->colormap );
+}
+
+BOOL bw_GlSurfaceImpl_makeCurrent( bw_GlSurfaceImpl* impl ) {
+	// Making the same context current again is cheap, but not free
+	if ( glXGetCurrentContext() == impl->context && glXGetCurrentDrawable() == impl->x_window )
+		return TRUE;
+
+	return glXMakeCurrent( impl->display, impl->x_window, impl->context ) ? TRUE : FALSE;
+}
+
+void bw_GlSurfaceImpl_resize( bw_GlSurfaceImpl* impl, int width, int height ) {
+	XResizeWindow( impl->display, impl->x_window, (unsigned int)width, (unsigned int)height );
+}
+
+void bw_GlSurfaceImpl_swapBuffers( bw_GlSurfaceImpl* impl ) {
+	glXSwapBuffers( impl->display, impl->x_window );
+}
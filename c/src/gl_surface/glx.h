@@ -0,0 +1,23 @@
+#ifndef BW_GL_SURFACE_GLX_H
+#define BW_GL_SURFACE_GLX_H
+
+// The pixel buffer functions are part of GL 2.1, which libGL exports on Linux
+#define GL_GLEXT_PROTOTYPES
+
+#include <GL/gl.h>
+#include <GL/glext.h>
+#include <GL/glx.h>
+
+
+
+typedef struct {
+	Display* display;
+	// The child window that GL renders into, because GTK's window doesn't necessarily have a visual that GL can render with
+	Window x_window;
+	Colormap colormap;
+	GLXContext context;
+} bw_GlSurfaceImpl;
+
+
+
+#endif//BW_GL_SURFACE_GLX_H
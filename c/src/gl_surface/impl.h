@@ -1,15 +1,31 @@
 #ifndef BW_GL_SURFACE_IMPL_H
 #define BW_GL_SURFACE_IMPL_H
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #include "../gl_surface.h"
 #include "../window.h"
 
 
 
-void bw_GlSurfaceImpl_destroy( bw_Window* window );
+// Should be implemented by the platform's GL API to create a context that renders into the content area of the window.
+// Returns false if no context could be created, in which case nothing needs to be cleaned up.
+BOOL bw_GlSurfaceImpl_new( bw_GlSurfaceImpl* impl, bw_Window* window, int width, int height );
+
+void bw_GlSurfaceImpl_destroy( bw_GlSurfaceImpl* impl );
+
+BOOL bw_GlSurfaceImpl_makeCurrent( bw_GlSurfaceImpl* impl );
+
+void bw_GlSurfaceImpl_resize( bw_GlSurfaceImpl* impl, int width, int height );
+
+void bw_GlSurfaceImpl_swapBuffers( bw_GlSurfaceImpl* impl );
 
-bw_GlSurfaceImpl bw_GlSurfaceImpl_new( bw_Window* window );
 
 
+#ifdef __cplusplus
+} // extern "C"
+#endif
 
-#endif//BW_GL_SURFACE_IMPL_H
\ No newline at end of file
+#endif//BW_GL_SURFACE_IMPL_H
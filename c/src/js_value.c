@@ -0,0 +1,29 @@
+#include "js_value.h"
+
+#include <stdlib.h>
+
+
+
+void bw_JsValue_free( bw_JsValue* value ) {
+
+	switch ( value->type ) {
+	case BW_JS_VALUE_STRING:
+	case BW_JS_VALUE_BINARY:
+		free( (void*)value->string.data );
+		break;
+	case BW_JS_VALUE_OBJECT:
+		for ( size_t i = 0; i < value->item_count; i++ ) {
+			free( (void*)value->keys[i].data );
+		}
+		free( value->keys );
+		// Fall through so that the values get freed as well
+	case BW_JS_VALUE_ARRAY:
+		for ( size_t i = 0; i < value->item_count; i++ ) {
+			bw_JsValue_free( &value->items[i] );
+		}
+		free( value->items );
+		break;
+	default:
+		break;
+	}
+}
@@ -0,0 +1,56 @@
+#ifndef BW_JS_VALUE_H
+#define BW_JS_VALUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bool.h"
+#include "string.h"
+
+#include <stddef.h>
+
+
+
+typedef unsigned char bw_JsValueType;
+
+#define BW_JS_VALUE_UNDEFINED 0
+#define BW_JS_VALUE_NULL 1
+#define BW_JS_VALUE_BOOLEAN 2
+#define BW_JS_VALUE_NUMBER 3
+#define BW_JS_VALUE_STRING 4
+#define BW_JS_VALUE_ARRAY 5
+#define BW_JS_VALUE_OBJECT 6
+#define BW_JS_VALUE_BINARY 7
+
+
+
+/// A JavaScript value that has been transferred out of the renderer as-is, instead of being stringified.
+/// Only the fields that belong to `type` have meaning.
+/// Arrays store their elements in `items`. Objects store their values in `items` and the corresponding property names in `keys`.
+/// Binary data, from an `ArrayBuffer` or a typed array, stores its bytes in `string`.
+/// Like JSON, `undefined` and functions become `null` inside arrays and are left out of objects.
+typedef struct bw_JsValue bw_JsValue;
+struct bw_JsValue {
+	bw_JsValueType type;
+	BOOL boolean;
+	double number;
+	bw_CStrSlice string;
+	bw_JsValue* items;
+	bw_CStrSlice* keys;
+	size_t item_count;
+};
+
+
+
+/// Frees all memory owned by the value, including that of its children.
+/// The `bw_JsValue` struct itself is not freed.
+void bw_JsValue_free( bw_JsValue* value );
+
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif//BW_JS_VALUE_H
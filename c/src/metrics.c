@@ -0,0 +1,96 @@
+#include "metrics.h"
+#include "atomic.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+
+// The number of bits that pick the sub-bucket within a power of two
+#define BW_LATENCY_HISTOGRAM_SUB_BITS 3
+
+
+
+static size_t bw_LatencyHistogram_bucketIndex( uint64_t value ) {
+	// Small values have a bucket of their own
+	if ( value < BW_LATENCY_HISTOGRAM_SUB_BUCKETS )
+		return (size_t)value;
+
+#ifdef _MSC_VER
+	unsigned long msb;
+	_BitScanReverse64( &msb, value );
+#else
+	unsigned int msb = 63 - (unsigned int)__builtin_clzll( value );
+#endif
+
+	// The top bits below the most significant one pick the sub-bucket
+	size_t sub = (size_t)( value >> ( msb - BW_LATENCY_HISTOGRAM_SUB_BITS ) ) & ( BW_LATENCY_HISTOGRAM_SUB_BUCKETS - 1 );
+	size_t index = ( (size_t)msb - BW_LATENCY_HISTOGRAM_SUB_BITS + 1 ) * BW_LATENCY_HISTOGRAM_SUB_BUCKETS + sub;
+	return index < BW_LATENCY_HISTOGRAM_BUCKETS ? index : BW_LATENCY_HISTOGRAM_BUCKETS - 1;
+}
+
+uint64_t bw_LatencyHistogram_bucketUpperBound( size_t index ) {
+	if ( index < BW_LATENCY_HISTOGRAM_SUB_BUCKETS )
+		return (uint64_t)index;
+	if ( index >= BW_LATENCY_HISTOGRAM_BUCKETS - 1 )
+		return UINT64_MAX;
+
+	unsigned int shift = (unsigned int)( index / BW_LATENCY_HISTOGRAM_SUB_BUCKETS ) - 1;
+	uint64_t sub = (uint64_t)( index % BW_LATENCY_HISTOGRAM_SUB_BUCKETS );
+	return ( ( BW_LATENCY_HISTOGRAM_SUB_BUCKETS + sub + 1 ) << shift ) - 1;
+}
+
+uint64_t bw_LatencyHistogram_percentile( const bw_LatencyHistogram* histogram, double fraction ) {
+	if ( histogram->count == 0 )
+		return 0;
+
+	// The rank of the value to find, counting from 1
+	uint64_t rank = (uint64_t)( fraction * (double)histogram->count + 0.5 );
+	if ( rank < 1 ) rank = 1;
+	if ( rank > histogram->count ) rank = histogram->count;
+
+	uint64_t seen = 0;
+	for ( size_t i = 0; i < BW_LATENCY_HISTOGRAM_BUCKETS; i++ ) {
+		seen += histogram->buckets[i];
+		if ( seen >= rank ) {
+			uint64_t bound = bw_LatencyHistogram_bucketUpperBound( i );
+			return bound < histogram->max ? bound : histogram->max;
+		}
+	}
+	return histogram->max;
+}
+
+void bw_LatencyHistogram_record( bw_LatencyHistogram* histogram, uint64_t value ) {
+	bw_atomic_addU64( &histogram->count, 1 );
+	bw_atomic_addU64( &histogram->sum, value );
+	bw_atomic_addU64( &histogram->buckets[ bw_LatencyHistogram_bucketIndex( value ) ], 1 );
+
+	// Another thread may have recorded a larger value in the meantime
+	uint64_t max = histogram->max;
+	while ( value > max ) {
+		uint64_t previous = bw_atomic_compareExchangeU64( &histogram->max, max, value );
+		if ( previous == max )
+			break;
+		max = previous;
+	}
+}
+
+void bw_LatencyHistogram_snapshot( const bw_LatencyHistogram* histogram, bw_LatencyHistogram* snapshot ) {
+	// Values are counted before they are put in a bucket, and the buckets are read before the count.
+	// So the count is never less than what the buckets add up to.
+	for ( size_t i = 0; i < BW_LATENCY_HISTOGRAM_BUCKETS; i++ ) {
+		snapshot->buckets[i] = _bw_Metrics_read( &histogram->buckets[i] );
+	}
+	snapshot->max = _bw_Metrics_read( &histogram->max );
+	snapshot->sum = _bw_Metrics_read( &histogram->sum );
+	snapshot->count = _bw_Metrics_read( &histogram->count );
+}
+
+void _bw_Metrics_count( uint64_t* counter, uint64_t value ) {
+	bw_atomic_addU64( counter, value );
+}
+
+uint64_t _bw_Metrics_read( const uint64_t* counter ) {
+	return bw_atomic_compareExchangeU64( (uint64_t*)counter, 0, 0 );
+}
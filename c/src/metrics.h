@@ -0,0 +1,59 @@
+#ifndef BW_METRICS_H
+#define BW_METRICS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+// The number of sub-buckets in every power of two, which keeps the error of every recorded value below 12.5%
+#define BW_LATENCY_HISTOGRAM_SUB_BUCKETS 8
+// Enough buckets for values up to 2^36 microseconds, which is about 19 hours.
+// Larger values are counted in the last bucket.
+#define BW_LATENCY_HISTOGRAM_BUCKETS 272
+
+/// A histogram of latencies in microseconds, with logarithmic buckets that are linearly subdivided, like an HDR histogram.
+/// Values can be recorded from any thread without taking a lock.
+typedef struct {
+	uint64_t count;	// The number of recorded values
+	uint64_t sum;	// The sum of all recorded values
+	uint64_t max;	// The largest recorded value
+	uint64_t buckets[BW_LATENCY_HISTOGRAM_BUCKETS];	// The number of recorded values in every bucket
+} bw_LatencyHistogram;
+
+
+
+/// Returns the largest value that is counted in the bucket at `index`.
+/// Every bucket counts the values that are larger than the upper bound of the bucket before it.
+uint64_t bw_LatencyHistogram_bucketUpperBound( size_t index );
+
+/// Returns the value below which the given fraction of all recorded values lie, like 0.99 for the 99th percentile.
+/// The value is the upper bound of the bucket it has been counted in, but never more than the largest recorded value.
+uint64_t bw_LatencyHistogram_percentile( const bw_LatencyHistogram* histogram, double fraction );
+
+/// Counts the given value in the histogram.
+/// This function is thread safe.
+void bw_LatencyHistogram_record( bw_LatencyHistogram* histogram, uint64_t value );
+
+/// Copies the histogram into `snapshot`, while values may be recorded into it at the same time.
+/// Each field is read atomically, but a value that is recorded in the meantime may only be included in some of them.
+void bw_LatencyHistogram_snapshot( const bw_LatencyHistogram* histogram, bw_LatencyHistogram* snapshot );
+
+/// Adds `value` to one of the counters of a metrics struct.
+/// This function is thread safe.
+void _bw_Metrics_count( uint64_t* counter, uint64_t value );
+/// Reads one of the counters of a metrics struct.
+/// This function is thread safe.
+uint64_t _bw_Metrics_read( const uint64_t* counter );
+
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif//BW_METRICS_H
@@ -0,0 +1,49 @@
+#ifndef BW_REQUEST_CONTEXT_H
+#define BW_REQUEST_CONTEXT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cookie.h"
+#include "string.h"
+
+#if defined(BW_CEF)
+#include "request_context/cef.h"
+#endif
+
+
+
+/// An isolated browsing session, with its own cookies, cache and local storage.
+/// Browser windows that are created with the same request context share their state, but never with windows of another request context.
+typedef struct {
+	struct bw_RequestContextImpl impl;
+} bw_RequestContext;
+
+typedef struct {
+	/// The directory in which the cache and cookies are stored.
+	/// If empty, nothing is written to disk at all, and everything is gone as soon as the request context and all browser windows using it are freed.
+	bw_CStrSlice cache_path;
+} bw_RequestContextOptions;
+
+
+
+/// Creates a new request context.
+/// It can be passed to any number of browser windows through `bw_BrowserWindowOptions`.
+bw_RequestContext* bw_RequestContext_new(const bw_RequestContextOptions* options);
+/// Creates another handle to the same request context, which needs to be freed separately.
+bw_RequestContext* bw_RequestContext_copy(const bw_RequestContext* context);
+/// Frees the handle.
+/// The state of the request context is only released once all the browser windows that use it have been closed as well.
+void bw_RequestContext_free(bw_RequestContext* context);
+/// Creates a handle to the cookie jar that only contains the cookies of this request context.
+/// The cookie jar needs to be freed with `bw_CookieJar_free`.
+bw_CookieJar* bw_RequestContext_getCookieJar(const bw_RequestContext* context);
+
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif//BW_REQUEST_CONTEXT_H
@@ -0,0 +1,47 @@
+#include "../request_context.h"
+#include "../application/impl.h"
+#include "../cef/util.hpp"
+
+#include <cstdlib>
+#include <include/cef_cookie.h>
+#include <include/cef_request_context.h>
+
+#define CEF_REQUEST_CONTEXT(CONTEXT) \
+	(*(CefRefPtr<CefRequestContext>*)(CONTEXT)->impl.handle_ptr)
+
+
+
+static bw_RequestContext* bw_RequestContext_fromCef(CefRefPtr<CefRequestContext> cef_context) {
+	bw_RequestContext* context = (bw_RequestContext*)malloc(sizeof(bw_RequestContext));
+	context->impl.handle_ptr = new CefRefPtr<CefRequestContext>(cef_context);
+	return context;
+}
+
+bw_RequestContext* bw_RequestContext_new(const bw_RequestContextOptions* options) {
+	bw_ApplicationEngineImpl_startPending();
+
+	CefRequestContextSettings settings;
+	// An empty cache path keeps everything in memory
+	if (options->cache_path.len > 0)
+		CefString(&settings.cache_path) = bw_cef_copyFromStrSlice(options->cache_path);
+
+	return bw_RequestContext_fromCef(CefRequestContext::CreateContext(settings, nullptr));
+}
+
+bw_RequestContext* bw_RequestContext_copy(const bw_RequestContext* context) {
+	return bw_RequestContext_fromCef(CEF_REQUEST_CONTEXT(context));
+}
+
+void bw_RequestContext_free(bw_RequestContext* context) {
+	delete (CefRefPtr<CefRequestContext>*)context->impl.handle_ptr;
+	free(context);
+}
+
+bw_CookieJar* bw_RequestContext_getCookieJar(const bw_RequestContext* context) {
+	CefRefPtr<CefCookieManager>* mgr = new CefRefPtr<CefCookieManager>(CEF_REQUEST_CONTEXT(context)->GetCookieManager(nullptr));
+
+	bw_CookieJar* cj = (bw_CookieJar*)malloc(sizeof(bw_CookieJar));
+	cj->impl.handle_ptr = mgr;
+
+	return cj;
+}
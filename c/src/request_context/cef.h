@@ -0,0 +1,12 @@
+#ifndef BW_REQUEST_CONTEXT_CEF_H
+#define BW_REQUEST_CONTEXT_CEF_H
+
+
+
+struct bw_RequestContextImpl {
+	void* handle_ptr;
+};
+
+
+
+#endif//BW_REQUEST_CONTEXT_CEF_H
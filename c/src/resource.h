@@ -0,0 +1,57 @@
+#ifndef BW_RESOURCE_H
+#define BW_RESOURCE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bool.h"
+#include "err.h"
+#include "string.h"
+
+#include <stddef.h>
+
+
+
+/// The scheme at which the resources are served, like `app://bundle/index.html`.
+/// It is treated as a secure origin, and can be used with `fetch` and XMLHttpRequest.
+#define BW_RESOURCE_SCHEME "app"
+
+
+
+typedef void (*bw_ResourceFreeFn)( void* user_data );
+
+
+
+/// Serves the given data at the given path, which includes the host, e.g. `bundle/index.html` for `app://bundle/index.html`.
+/// The data is not copied, so it needs to stay valid until `free_fn` is invoked with `user_data`.
+/// That happens once the resource has been replaced or unregistered, and no response is being read from it anymore, possibly on another thread.
+/// If `free_fn` is null, the data needs to stay valid for as long as the application runs.
+/// If `mime_type` is empty, it is derived from the extension of the path.
+/// This function is thread safe.
+void bw_Resource_register( bw_CStrSlice path, const void* data, size_t size, bw_CStrSlice mime_type, bw_ResourceFreeFn free_fn, void* user_data );
+
+/// Maps a resource pack file into memory, and serves all resources inside of it.
+/// Resources registered with `bw_Resource_register` take precedence, and so do packs that have been loaded before.
+/// Fails if the file doesn't exist or isn't a valid pack.
+/// This function is thread safe.
+bw_Err bw_Resource_loadPack( bw_CStrSlice path );
+
+/// Stops serving the resource that has been registered at the given path.
+/// Returns false if there was none.
+/// This function is thread safe.
+BOOL bw_Resource_unregister( bw_CStrSlice path );
+
+/// Serves the files inside the given directory at the given host, e.g. `app://bundle/js/main.js` for `<directory>/js/main.js` with host `bundle`.
+/// The files are memory mapped instead of read, and are never served from outside of the directory.
+/// Resources registered with `bw_Resource_register` take precedence.
+/// This function is thread safe.
+void bw_Resource_mountDirectory( bw_CStrSlice host, bw_CStrSlice directory );
+
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif//BW_RESOURCE_H
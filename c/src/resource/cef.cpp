@@ -0,0 +1,41 @@
+#include "../resource.h"
+#include "../cef/resource_registry.hpp"
+
+#include <string>
+
+
+
+void bw_Resource_register( bw_CStrSlice path, const void* data, size_t size, bw_CStrSlice mime_type, bw_ResourceFreeFn free_fn, void* user_data ) {
+	std::string path_string( path.data, path.len );
+
+	bw::Resource resource;
+	resource.data = (const char*)data;
+	resource.size = size;
+	resource.mime_type = mime_type.len > 0 ? std::string( mime_type.data, mime_type.len ) : bw::mimeTypeFor( path_string );
+	resource.etag = bw::entityTag( resource.data, size );
+	// The last copy of the resource to go, releases the data
+	resource.owner = std::shared_ptr<const void>( data, [free_fn, user_data]( const void* ) {
+		if ( free_fn != 0 )
+			free_fn( user_data );
+	} );
+
+	bw::resource_registry.store( path_string, std::move( resource ) );
+}
+
+bw_Err bw_Resource_loadPack( bw_CStrSlice path ) {
+	std::string error;
+	std::shared_ptr<const bw::ResourcePack> pack = bw::ResourcePack::open( std::string( path.data, path.len ), error );
+	if ( pack == nullptr )
+		return bw_Err_new_with_msg( 1, error.c_str() );
+
+	bw::resource_registry.addPack( std::move( pack ) );
+	BW_ERR_RETURN_SUCCESS;
+}
+
+BOOL bw_Resource_unregister( bw_CStrSlice path ) {
+	return bw::resource_registry.drop( std::string( path.data, path.len ) );
+}
+
+void bw_Resource_mountDirectory( bw_CStrSlice host, bw_CStrSlice directory ) {
+	bw::resource_registry.mount( std::string( host.data, host.len ), std::string( directory.data, directory.len ) );
+}
@@ -0,0 +1,111 @@
+#include "slab.h"
+
+#include "atomic.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+// Every object is preceded by the header of its slot, which is kept at the alignment of any object
+typedef struct {
+	uint64_t handle;	// The current handle of the slot, which is only valid while the slot is used
+	uint32_t next_free_slot;	// Like `bw_Slab::free_slot`, while the slot is free
+	uint32_t _padding;
+} bw_SlabSlot;
+
+#define BW_SLAB_ALIGNMENT 16
+#define BW_SLAB_HEADER_SIZE ( (sizeof( bw_SlabSlot ) + BW_SLAB_ALIGNMENT - 1) & ~(size_t)(BW_SLAB_ALIGNMENT - 1) )
+
+
+
+static bw_SlabSlot* bw_Slab_slot( const bw_Slab* slab, uint32_t index );
+
+
+
+void* bw_Slab_alloc( bw_Slab* slab ) {
+	bw_SlabSlot* slot;
+
+	if ( slab->free_slot != 0 ) {
+		slot = bw_Slab_slot( slab, slab->free_slot - 1 );
+		slab->free_slot = slot->next_free_slot;
+	}
+	else {
+		uint32_t index = slab->slot_count;
+		if ( index == BW_SLAB_CHUNK_SIZE * BW_SLAB_MAX_CHUNKS )
+			return 0;
+
+		// The chunk is published only after it has been initialized, because other threads may look up handles in it
+		if ( index % BW_SLAB_CHUNK_SIZE == 0 ) {
+			void* chunk = calloc( BW_SLAB_CHUNK_SIZE, slab->slot_size );
+			if ( chunk == 0 )
+				return 0;
+			bw_atomic_storePtr( &slab->chunks[ index / BW_SLAB_CHUNK_SIZE ], chunk );
+		}
+
+		slot = bw_Slab_slot( slab, index );
+		bw_atomic_storeU64( &slot->handle, ((uint64_t)1 << 32) | index );
+		slab->slot_count += 1;
+	}
+
+	slot->next_free_slot = 0;
+	return (char*)slot + BW_SLAB_HEADER_SIZE;
+}
+
+void bw_Slab_destroy( bw_Slab* slab ) {
+	for ( uint32_t i = 0; i < BW_SLAB_MAX_CHUNKS && slab->chunks[i] != 0; i++ ) {
+		free( slab->chunks[i] );
+	}
+	free( slab->chunks );
+	slab->chunks = 0;
+}
+
+void bw_Slab_free( bw_Slab* slab, void* object ) {
+	bw_SlabSlot* slot = (bw_SlabSlot*)( (char*)object - BW_SLAB_HEADER_SIZE );
+	uint32_t index = (uint32_t)slot->handle;
+
+	// Skip generation 0, so that no handle is ever 0
+	uint32_t generation = (uint32_t)(slot->handle >> 32) + 1;
+	if ( generation == 0 )
+		generation = 1;
+	bw_atomic_storeU64( &slot->handle, ((uint64_t)generation << 32) | index );
+
+	slot->next_free_slot = slab->free_slot;
+	slab->free_slot = index + 1;
+}
+
+void* bw_Slab_get( const bw_Slab* slab, bw_SlabHandle handle ) {
+	uint32_t index = (uint32_t)handle;
+	if ( handle == 0 || index >= BW_SLAB_CHUNK_SIZE * BW_SLAB_MAX_CHUNKS )
+		return 0;
+
+	char* chunk = (char*)bw_atomic_loadPtr( &slab->chunks[ index / BW_SLAB_CHUNK_SIZE ] );
+	if ( chunk == 0 )
+		return 0;
+
+	// The generation doesn't match once the object has been freed, even if the slot is in use again
+	bw_SlabSlot* slot = (bw_SlabSlot*)( chunk + (index % BW_SLAB_CHUNK_SIZE) * slab->slot_size );
+	if ( bw_atomic_loadU64( &slot->handle ) != handle )
+		return 0;
+
+	return (char*)slot + BW_SLAB_HEADER_SIZE;
+}
+
+bw_SlabHandle bw_Slab_handle( const void* object ) {
+	const bw_SlabSlot* slot = (const bw_SlabSlot*)( (const char*)object - BW_SLAB_HEADER_SIZE );
+	return slot->handle;
+}
+
+void bw_Slab_init( bw_Slab* slab, size_t object_size ) {
+	size_t aligned_size = (object_size + BW_SLAB_ALIGNMENT - 1) & ~(size_t)(BW_SLAB_ALIGNMENT - 1);
+
+	slab->slot_size = BW_SLAB_HEADER_SIZE + aligned_size;
+	slab->chunks = (void**)calloc( BW_SLAB_MAX_CHUNKS, sizeof( void* ) );
+	slab->slot_count = 0;
+	slab->free_slot = 0;
+}
+
+static bw_SlabSlot* bw_Slab_slot( const bw_Slab* slab, uint32_t index ) {
+	char* chunk = (char*)slab->chunks[ index / BW_SLAB_CHUNK_SIZE ];
+	return (bw_SlabSlot*)( chunk + (index % BW_SLAB_CHUNK_SIZE) * slab->slot_size );
+}
@@ -0,0 +1,59 @@
+#ifndef BW_SLAB_H
+#define BW_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+// The number of objects in every chunk of a slab
+#define BW_SLAB_CHUNK_SIZE 32
+// The maximum number of chunks of a slab, which allows for 65536 objects at the same time
+#define BW_SLAB_MAX_CHUNKS 2048
+
+/// Identifies an object in a slab, with the index of its slot in the lower 32 bits, and the generation of the slot in the upper 32 bits.
+/// The generation is increased whenever the object is freed, so a handle of an object that is gone never matches the slot again.
+/// 0 is never a valid handle.
+typedef uint64_t bw_SlabHandle;
+
+/// An allocator for objects of the same size, that are kept in chunks which are never moved or freed until the slab is destroyed.
+/// Freed slots are reused first, so that creating and destroying objects over and over doesn't fragment the heap.
+/// Objects are allocated and freed on one thread, but looking one up by its handle is thread safe.
+typedef struct {
+	size_t slot_size;
+	void** chunks;	// BW_SLAB_MAX_CHUNKS of them, of which the ones that haven't been allocated yet are null
+	uint32_t slot_count;	// The number of slots that have been used at some point
+	uint32_t free_slot;	// The index of the last freed slot plus one, or 0 if there is none
+} bw_Slab;
+
+
+
+/// Returns memory for a new object, or null if the slab is full.
+void* bw_Slab_alloc( bw_Slab* slab );
+
+/// Frees all chunks of the slab, including the objects that are still in it.
+void bw_Slab_destroy( bw_Slab* slab );
+
+/// Gives the slot of the object back to the slab, after which its handle won't be found anymore.
+void bw_Slab_free( bw_Slab* slab, void* object );
+
+/// Returns the object that the handle belongs to, or null if it has been freed in the meantime.
+/// This function is thread safe, but the object may of course still get freed by the thread that allocates them.
+void* bw_Slab_get( const bw_Slab* slab, bw_SlabHandle handle );
+
+/// Returns the handle of an object that has been allocated with `bw_Slab_alloc`.
+bw_SlabHandle bw_Slab_handle( const void* object );
+
+void bw_Slab_init( bw_Slab* slab, size_t object_size );
+
+
+
+#ifdef __cplusplus
+}	// extern "C"
+#endif
+
+#endif//BW_SLAB_H
@@ -3,6 +3,27 @@
 #include <stdlib.h>
 #include <string.h>
 
+// The conversions copy runs of ASCII a whole block at a time, which is what most strings consist of.
+// Only the characters outside of ASCII are converted one code point at a time.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BW_STRING_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define BW_STRING_NEON
+#endif
+
+#define BW_STRING_REPLACEMENT_CHARACTER 0xFFFD
+
+
+
+static uint32_t bw_string_nextUtf8CodePoint( const unsigned char* str, size_t len, size_t* i );
+static uint32_t bw_string_nextUtf16CodePoint( const uint16_t* str, size_t len, size_t* i );
+static size_t bw_string_utf8AsciiRun( const unsigned char* str, size_t len );
+static size_t bw_string_utf16AsciiRun( const uint16_t* str, size_t len );
+static size_t bw_string_widenAscii( const unsigned char* str, size_t len, uint16_t* out );
+static size_t bw_string_narrowAscii( const uint16_t* str, size_t len, unsigned char* out );
+
 
 
 char* bw_string_copyAsNewCstr( bw_CStrSlice str ) {
@@ -19,3 +40,268 @@ void bw_string_free(bw_StrSlice slice) {
 void bw_string_freeCstr( char* str ) {
 	free( str );
 }
+
+size_t bw_string_utf16Length( bw_CStrSlice str ) {
+	const unsigned char* data = (const unsigned char*)str.data;
+	size_t length = 0;
+
+	for ( size_t i = 0; i < str.len; ) {
+		size_t run = bw_string_utf8AsciiRun( data + i, str.len - i );
+		i += run;
+		length += run;
+		if ( i == str.len )
+			break;
+
+		uint32_t c = bw_string_nextUtf8CodePoint( data, str.len, &i );
+		length += c >= 0x10000 ? 2 : 1;
+	}
+
+	return length;
+}
+
+size_t bw_string_toUtf16( bw_CStrSlice str, uint16_t* buffer ) {
+	const unsigned char* data = (const unsigned char*)str.data;
+	uint16_t* out = buffer;
+
+	for ( size_t i = 0; i < str.len; ) {
+		size_t run = bw_string_widenAscii( data + i, str.len - i, out );
+		i += run;
+		out += run;
+		if ( i == str.len )
+			break;
+
+		uint32_t c = bw_string_nextUtf8CodePoint( data, str.len, &i );
+		if ( c >= 0x10000 ) {
+			c -= 0x10000;
+			*out++ = (uint16_t)(0xD800 + (c >> 10));
+			*out++ = (uint16_t)(0xDC00 + (c & 0x3FF));
+		}
+		else
+			*out++ = (uint16_t)c;
+	}
+
+	return (size_t)(out - buffer);
+}
+
+size_t bw_string_utf8Length( const uint16_t* str, size_t len ) {
+	size_t length = 0;
+
+	for ( size_t i = 0; i < len; ) {
+		size_t run = bw_string_utf16AsciiRun( str + i, len - i );
+		i += run;
+		length += run;
+		if ( i == len )
+			break;
+
+		uint32_t c = bw_string_nextUtf16CodePoint( str, len, &i );
+		if ( c < 0x80 )	length += 1;
+		else if ( c < 0x800 )	length += 2;
+		else if ( c < 0x10000 )	length += 3;
+		else	length += 4;
+	}
+
+	return length;
+}
+
+size_t bw_string_toUtf8( const uint16_t* str, size_t len, char* buffer ) {
+	unsigned char* out = (unsigned char*)buffer;
+
+	for ( size_t i = 0; i < len; ) {
+		size_t run = bw_string_narrowAscii( str + i, len - i, out );
+		i += run;
+		out += run;
+		if ( i == len )
+			break;
+
+		uint32_t c = bw_string_nextUtf16CodePoint( str, len, &i );
+		if ( c < 0x80 )
+			*out++ = (unsigned char)c;
+		else if ( c < 0x800 ) {
+			*out++ = (unsigned char)(0xC0 | (c >> 6));
+			*out++ = (unsigned char)(0x80 | (c & 0x3F));
+		}
+		else if ( c < 0x10000 ) {
+			*out++ = (unsigned char)(0xE0 | (c >> 12));
+			*out++ = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+			*out++ = (unsigned char)(0x80 | (c & 0x3F));
+		}
+		else {
+			*out++ = (unsigned char)(0xF0 | (c >> 18));
+			*out++ = (unsigned char)(0x80 | ((c >> 12) & 0x3F));
+			*out++ = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+			*out++ = (unsigned char)(0x80 | (c & 0x3F));
+		}
+	}
+
+	return (size_t)(out - (unsigned char*)buffer);
+}
+
+
+
+// Decodes the code point at `*i`, and moves `*i` past it.
+// An invalid sequence only skips its first byte, so that the length and the conversion always agree on what it becomes.
+static uint32_t bw_string_nextUtf8CodePoint( const unsigned char* str, size_t len, size_t* i ) {
+	unsigned char lead = str[*i];
+	size_t count;
+	uint32_t c, min;
+
+	if ( lead < 0x80 ) {
+		*i += 1;
+		return lead;
+	}
+	else if ( (lead & 0xE0) == 0xC0 ) {	count = 1;	c = lead & 0x1F;	min = 0x80;	}
+	else if ( (lead & 0xF0) == 0xE0 ) {	count = 2;	c = lead & 0x0F;	min = 0x800;	}
+	else if ( (lead & 0xF8) == 0xF0 ) {	count = 3;	c = lead & 0x07;	min = 0x10000;	}
+	else {
+		*i += 1;
+		return BW_STRING_REPLACEMENT_CHARACTER;
+	}
+
+	if ( len - *i <= count ) {
+		*i += 1;
+		return BW_STRING_REPLACEMENT_CHARACTER;
+	}
+	for ( size_t j = 1; j <= count; j++ ) {
+		unsigned char byte = str[*i + j];
+		if ( (byte & 0xC0) != 0x80 ) {
+			*i += 1;
+			return BW_STRING_REPLACEMENT_CHARACTER;
+		}
+		c = (c << 6) | (byte & 0x3F);
+	}
+
+	// Overlong encodings, surrogates and anything beyond the last code point are not valid UTF-8
+	if ( c < min || c > 0x10FFFF || (c >= 0xD800 && c < 0xE000) ) {
+		*i += 1;
+		return BW_STRING_REPLACEMENT_CHARACTER;
+	}
+
+	*i += count + 1;
+	return c;
+}
+
+// Decodes the code point at `*i`, and moves `*i` past it
+static uint32_t bw_string_nextUtf16CodePoint( const uint16_t* str, size_t len, size_t* i ) {
+	uint32_t unit = str[(*i)++];
+
+	if ( unit >= 0xD800 && unit < 0xDC00 ) {
+		if ( *i < len && str[*i] >= 0xDC00 && str[*i] < 0xE000 ) {
+			uint32_t low = str[(*i)++];
+			return 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+		}
+		return BW_STRING_REPLACEMENT_CHARACTER;
+	}
+	else if ( unit >= 0xDC00 && unit < 0xE000 )
+		return BW_STRING_REPLACEMENT_CHARACTER;
+
+	return unit;
+}
+
+// Returns the length of the run of ASCII at the start of the string, in whole words of eight bytes.
+static size_t bw_string_utf8AsciiRun( const unsigned char* str, size_t len ) {
+	size_t i = 0;
+
+	for ( ; i + 8 <= len; i += 8 ) {
+		uint64_t word;
+		memcpy( &word, str + i, 8 );
+		if ( (word & 0x8080808080808080ULL) != 0 )
+			break;
+	}
+
+	return i;
+}
+
+// Returns the length of the run of ASCII at the start of the string, in whole words of four code units.
+static size_t bw_string_utf16AsciiRun( const uint16_t* str, size_t len ) {
+	size_t i = 0;
+
+	for ( ; i + 4 <= len; i += 4 ) {
+		uint64_t word;
+		memcpy( &word, str + i, 8 );
+		if ( (word & 0xFF80FF80FF80FF80ULL) != 0 )
+			break;
+	}
+
+	return i;
+}
+
+// Copies the run of ASCII at the start of the string into `out` as UTF-16, and returns its length.
+// Like with `bw_string_utf8AsciiRun`, the rest of the string is left to be converted one code point at a time.
+static size_t bw_string_widenAscii( const unsigned char* str, size_t len, uint16_t* out ) {
+	size_t i = 0;
+
+#if defined(BW_STRING_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for ( ; i + 16 <= len; i += 16 ) {
+		__m128i bytes = _mm_loadu_si128( (const __m128i*)(str + i) );
+		if ( _mm_movemask_epi8( bytes ) != 0 )
+			break;
+
+		_mm_storeu_si128( (__m128i*)(out + i), _mm_unpacklo_epi8( bytes, zero ) );
+		_mm_storeu_si128( (__m128i*)(out + i + 8), _mm_unpackhi_epi8( bytes, zero ) );
+	}
+#elif defined(BW_STRING_NEON)
+	for ( ; i + 16 <= len; i += 16 ) {
+		uint8x16_t bytes = vld1q_u8( str + i );
+		if ( vmaxvq_u8( bytes ) >= 0x80 )
+			break;
+
+		vst1q_u16( out + i, vmovl_u8( vget_low_u8( bytes ) ) );
+		vst1q_u16( out + i + 8, vmovl_u8( vget_high_u8( bytes ) ) );
+	}
+#endif
+
+	for ( ; i + 8 <= len; i += 8 ) {
+		uint64_t word;
+		memcpy( &word, str + i, 8 );
+		if ( (word & 0x8080808080808080ULL) != 0 )
+			break;
+
+		for ( size_t j = 0; j < 8; j++ ) {
+			out[i + j] = str[i + j];
+		}
+	}
+
+	return i;
+}
+
+// Copies the run of ASCII at the start of the string into `out` as UTF-8, and returns its length.
+static size_t bw_string_narrowAscii( const uint16_t* str, size_t len, unsigned char* out ) {
+	size_t i = 0;
+
+#if defined(BW_STRING_SSE2)
+	const __m128i mask = _mm_set1_epi16( (short)0xFF80 );
+	const __m128i zero = _mm_setzero_si128();
+	for ( ; i + 16 <= len; i += 16 ) {
+		__m128i low = _mm_loadu_si128( (const __m128i*)(str + i) );
+		__m128i high = _mm_loadu_si128( (const __m128i*)(str + i + 8) );
+		__m128i non_ascii = _mm_and_si128( _mm_or_si128( low, high ), mask );
+		if ( _mm_movemask_epi8( _mm_cmpeq_epi16( non_ascii, zero ) ) != 0xFFFF )
+			break;
+
+		_mm_storeu_si128( (__m128i*)(out + i), _mm_packus_epi16( low, high ) );
+	}
+#elif defined(BW_STRING_NEON)
+	for ( ; i + 16 <= len; i += 16 ) {
+		uint16x8_t low = vld1q_u16( str + i );
+		uint16x8_t high = vld1q_u16( str + i + 8 );
+		if ( vmaxvq_u16( vorrq_u16( low, high ) ) >= 0x80 )
+			break;
+
+		vst1q_u8( out + i, vcombine_u8( vmovn_u16( low ), vmovn_u16( high ) ) );
+	}
+#endif
+
+	for ( ; i + 4 <= len; i += 4 ) {
+		uint64_t word;
+		memcpy( &word, str + i, 8 );
+		if ( (word & 0xFF80FF80FF80FF80ULL) != 0 )
+			break;
+
+		for ( size_t j = 0; j < 4; j++ ) {
+			out[i + j] = (unsigned char)str[i + j];
+		}
+	}
+
+	return i;
+}
@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
 
 
 
@@ -30,6 +31,19 @@ typedef struct bw_CStrSlice {
 /// Copies the string from the given `bw_CStrSlice` to a C compatible, nul-terminated string.
 char* bw_string_copyAsNewCstr( bw_CStrSlice str );
 
+/// Returns the number of UTF-16 code units that the UTF-8 string takes up once it is converted.
+size_t bw_string_utf16Length( bw_CStrSlice str );
+/// Converts the UTF-8 string to UTF-16 straight into `buffer`, which needs to have room for `bw_string_utf16Length( str )` code units.
+/// Invalid sequences become U+FFFD.
+/// Returns the number of code units written.
+size_t bw_string_toUtf16( bw_CStrSlice str, uint16_t* buffer );
+/// Returns the number of bytes that the UTF-16 string takes up once it is converted to UTF-8.
+size_t bw_string_utf8Length( const uint16_t* str, size_t len );
+/// Converts the UTF-16 string to UTF-8 straight into `buffer`, which needs to have room for `bw_string_utf8Length( str, len )` bytes.
+/// Unpaired surrogates become U+FFFD.
+/// Returns the number of bytes written.
+size_t bw_string_toUtf8( const uint16_t* str, size_t len, char* buffer );
+
 /// Frees the string allocated with any of the functions of this module.
 void bw_string_freeCstr( char* str );
 void bw_string_free(bw_StrSlice str);
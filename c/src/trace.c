@@ -0,0 +1,272 @@
+// Needed for syscall and SYS_gettid
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "trace.h"
+#include "application/impl.h"
+#include "atomic.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+// The C sources are compiled as C++ when CEF is used
+#if defined(__cplusplus)
+#define BW_TRACE_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define BW_TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define BW_TRACE_THREAD_LOCAL _Thread_local
+#endif
+
+
+
+typedef struct {
+	const char* name;
+	uint64_t timestamp;
+	uint64_t duration;	// UINT64_MAX for instants
+} bw_TraceEvent;
+
+// The events recorded by one thread.
+// A buffer is only ever written by its own thread, and is never freed, so that its events can still be written after the thread has exited.
+typedef struct bw_TraceBuffer bw_TraceBuffer;
+struct bw_TraceBuffer {
+	bw_TraceBuffer* next;	// The buffer of the thread that started recording before this one
+	uint64_t thread_id;
+	uint64_t recording;	// The recording that the events belong to
+	uint64_t count;	// The number of events that have been recorded, of which only the last `capacity` are kept
+	size_t capacity;
+	bw_TraceEvent* events;
+};
+
+
+
+// The buffers of all threads that have ever recorded an event
+static bw_TraceBuffer* bw_Trace_buffers = 0;
+// The number of the current or last recording, which is odd while recording
+static uint64_t bw_Trace_recording = 0;
+static uint64_t bw_Trace_capacity = 0;
+static BW_TRACE_THREAD_LOCAL bw_TraceBuffer* bw_Trace_buffer = 0;
+
+
+
+static uint64_t bw_Trace_threadId() {
+#if defined(_WIN32)
+	return (uint64_t)GetCurrentThreadId();
+#elif defined(__linux__)
+	return (uint64_t)syscall( SYS_gettid );
+#elif defined(__APPLE__)
+	uint64_t id;
+	pthread_threadid_np( 0, &id );
+	return id;
+#else
+	return (uint64_t)(uintptr_t)pthread_self();
+#endif
+}
+
+static uint64_t bw_Trace_processId() {
+#ifdef _WIN32
+	return (uint64_t)GetCurrentProcessId();
+#else
+	return (uint64_t)getpid();
+#endif
+}
+
+static void bw_Trace_record( const char* name, uint64_t timestamp, uint64_t duration ) {
+	uint64_t recording = bw_atomic_loadU64( &bw_Trace_recording );
+	if ( ( recording & 1 ) == 0 )
+		return;
+
+	bw_TraceBuffer* buffer = bw_Trace_buffer;
+	if ( buffer == 0 ) {
+		buffer = (bw_TraceBuffer*)malloc( sizeof( bw_TraceBuffer ) );
+		buffer->thread_id = bw_Trace_threadId();
+		buffer->recording = recording;
+		buffer->count = 0;
+		buffer->capacity = (size_t)bw_atomic_loadU64( &bw_Trace_capacity );
+		buffer->events = (bw_TraceEvent*)malloc( buffer->capacity * sizeof( bw_TraceEvent ) );
+
+		// Buffers are only ever added to the front of the list
+		bw_TraceBuffer* head = (bw_TraceBuffer*)bw_atomic_loadPtr( &bw_Trace_buffers );
+		while ( 1 ) {
+			buffer->next = head;
+			bw_TraceBuffer* previous = (bw_TraceBuffer*)bw_atomic_compareExchangePtr( &bw_Trace_buffers, head, buffer );
+			if ( previous == head )
+				break;
+			head = previous;
+		}
+		bw_Trace_buffer = buffer;
+	}
+	// The events of an earlier recording are thrown away
+	else if ( buffer->recording != recording ) {
+		buffer->recording = recording;
+		bw_atomic_storeU64( &buffer->count, 0 );
+	}
+	if ( buffer->capacity == 0 )
+		return;
+
+	bw_TraceEvent* event = &buffer->events[ buffer->count % buffer->capacity ];
+	event->name = name;
+	event->timestamp = timestamp;
+	event->duration = duration;
+	bw_atomic_addU64( &buffer->count, 1 );
+}
+
+
+
+uint64_t bw_Trace_begin() {
+	if ( ( bw_atomic_loadU64( &bw_Trace_recording ) & 1 ) == 0 )
+		return 0;
+	return bw_Application_now();
+}
+
+void bw_Trace_end( const char* name, uint64_t begin ) {
+	bw_Trace_record( name, begin, bw_Application_now() - begin );
+}
+
+void bw_Trace_instant( const char* name ) {
+	bw_Trace_record( name, bw_Application_now(), UINT64_MAX );
+}
+
+void bw_Trace_start( size_t capacity ) {
+	bw_atomic_storeU64( &bw_Trace_capacity, capacity );
+
+	// Makes the recording number odd, unless a recording is already going on
+	uint64_t recording = bw_atomic_loadU64( &bw_Trace_recording );
+	while ( ( recording & 1 ) == 0 ) {
+		uint64_t previous = bw_atomic_compareExchangeU64( &bw_Trace_recording, recording, recording + 1 );
+		if ( previous == recording )
+			break;
+		recording = previous;
+	}
+}
+
+void bw_Trace_stop() {
+	uint64_t recording = bw_atomic_loadU64( &bw_Trace_recording );
+	while ( ( recording & 1 ) == 1 ) {
+		uint64_t previous = bw_atomic_compareExchangeU64( &bw_Trace_recording, recording, recording + 1 );
+		if ( previous == recording )
+			break;
+		recording = previous;
+	}
+}
+
+// Writes all events of the current or last recording, separated by commas.
+// Returns whether there were any.
+static BOOL bw_Trace_writeEvents( FILE* file ) {
+	uint64_t recording = bw_atomic_loadU64( &bw_Trace_recording );
+	if ( ( recording & 1 ) == 0 )
+		recording -= 1;
+	BOOL separate = FALSE;
+	uint64_t pid = bw_Trace_processId();
+
+	for ( bw_TraceBuffer* buffer = (bw_TraceBuffer*)bw_atomic_loadPtr( &bw_Trace_buffers ); buffer != 0; buffer = buffer->next ) {
+		if ( buffer->recording != recording || buffer->capacity == 0 )
+			continue;
+
+		uint64_t count = bw_atomic_loadU64( &buffer->count );
+		uint64_t first = count > buffer->capacity ? count - buffer->capacity : 0;
+		for ( uint64_t i = first; i < count; i++ ) {
+			const bw_TraceEvent* event = &buffer->events[ i % buffer->capacity ];
+
+			if ( separate )
+				fputs( ",\n", file );
+			separate = TRUE;
+
+			if ( event->duration == UINT64_MAX )
+				fprintf( file, "{\"name\":\"%s\",\"cat\":\"browser_window\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%llu,\"tid\":%llu,\"ts\":%llu}",
+					event->name, (unsigned long long)pid, (unsigned long long)buffer->thread_id, (unsigned long long)event->timestamp
+				);
+			else
+				fprintf( file, "{\"name\":\"%s\",\"cat\":\"browser_window\",\"ph\":\"X\",\"pid\":%llu,\"tid\":%llu,\"ts\":%llu,\"dur\":%llu}",
+					event->name, (unsigned long long)pid, (unsigned long long)buffer->thread_id, (unsigned long long)event->timestamp, (unsigned long long)event->duration
+				);
+		}
+	}
+	return separate;
+}
+
+// Reads the whole file into a null terminated string.
+static char* bw_Trace_readFile( const char* path ) {
+	FILE* file = fopen( path, "rb" );
+	if ( file == 0 )
+		return 0;
+
+	size_t len = 0, capacity = 65536;
+	char* data = (char*)malloc( capacity );
+	size_t read;
+	while ( ( read = fread( data + len, 1, capacity - len - 1, file ) ) > 0 ) {
+		len += read;
+		if ( capacity - len - 1 == 0 ) {
+			capacity *= 2;
+			data = (char*)realloc( data, capacity );
+		}
+	}
+	fclose( file );
+
+	data[len] = '\0';
+	return data;
+}
+
+bw_Err bw_Trace_write( bw_CStrSlice path, bw_CStrSlice engine_trace ) {
+
+	// The engine's trace is an object with its events in the traceEvents array, so our own events are put at the start of that array
+	char* engine_data = 0;
+	char* engine_events = 0;
+	if ( engine_trace.len > 0 ) {
+		char* engine_path = bw_string_copyAsNewCstr( engine_trace );
+		engine_data = bw_Trace_readFile( engine_path );
+		if ( engine_data != 0 ) {
+			remove( engine_path );
+
+			char* array = strstr( engine_data, "\"traceEvents\"" );
+			if ( array != 0 )
+				array = strchr( array, '[' );
+			if ( array != 0 )
+				engine_events = array + 1;
+		}
+		bw_string_freeCstr( engine_path );
+	}
+
+	char* cpath = bw_string_copyAsNewCstr( path );
+	FILE* file = fopen( cpath, "w" );
+	bw_string_freeCstr( cpath );
+	if ( file == 0 ) {
+		free( engine_data );
+		return bw_Err_new_with_msg( 1, "unable to open the trace file" );
+	}
+
+	if ( engine_events != 0 ) {
+		fwrite( engine_data, 1, (size_t)( engine_events - engine_data ), file );
+		BOOL written = bw_Trace_writeEvents( file );
+
+		// Only separate our events from the engine's if it has any
+		const char* rest = engine_events;
+		while ( *rest == ' ' || *rest == '\n' || *rest == '\r' || *rest == '\t' ) rest++;
+		if ( written && *rest != ']' )
+			fputc( ',', file );
+		fputs( engine_events, file );
+	}
+	else {
+		fprintf( file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+		bw_Trace_writeEvents( file );
+		fprintf( file, "\n]}\n" );
+	}
+	free( engine_data );
+
+	BOOL failed = ferror( file ) != 0;
+	if ( fclose( file ) != 0 || failed )
+		return bw_Err_new_with_msg( 1, "unable to write the trace file" );
+	BW_ERR_RETURN_SUCCESS;
+}
@@ -0,0 +1,61 @@
+#ifndef BW_TRACE_H
+#define BW_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bool.h"
+#include "err.h"
+#include "string.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+/// Starts a span that is ended by BW_TRACE_END with the same variable.
+/// Costs only a branch when tracing is disabled.
+#define BW_TRACE_BEGIN( VAR ) \
+	uint64_t VAR = bw_Trace_begin()
+/// Ends the span that has been started by BW_TRACE_BEGIN, and records it under `NAME`, which needs to be a string literal.
+#define BW_TRACE_END( VAR, NAME ) \
+	if ( VAR != 0 ) bw_Trace_end( NAME, VAR )
+
+
+
+/// Starts recording trace events into a ring buffer of `capacity` events for every thread that records them, throwing away the ones of an earlier recording.
+/// When a buffer is full, the oldest events in it are overwritten.
+/// The capacity of a thread's buffer is fixed the first time the thread records an event.
+/// This function is thread safe.
+void bw_Trace_start( size_t capacity );
+
+/// Stops recording trace events.
+/// The recorded events are kept, so that they can be written with bw_Trace_write.
+/// This function is thread safe.
+void bw_Trace_stop();
+
+/// Returns the time at which a span starts, or 0 if tracing is disabled.
+uint64_t bw_Trace_begin();
+
+/// Records a span that started at `begin`, and ends now.
+/// `name` is kept as it is, so it needs to be a static string.
+void bw_Trace_end( const char* name, uint64_t begin );
+
+/// Records an event without a duration, if tracing is enabled.
+/// `name` is kept as it is, so it needs to be a static string.
+void bw_Trace_instant( const char* name );
+
+/// Writes the recorded events to a file at `path`, as a trace in Chrome's JSON trace event format.
+/// If `engine_trace` is not empty, it is the path of a trace that the browser engine has written, with which the events are merged.
+/// In that case, the events appear next to those of the engine's browser process, and the file at `engine_trace` is removed.
+/// Should only be called after tracing has stopped.
+bw_Err bw_Trace_write( bw_CStrSlice path, bw_CStrSlice engine_trace );
+
+
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif//BW_TRACE_H
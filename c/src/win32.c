@@ -57,14 +57,14 @@ void bw_win32_print_hresult_error( HRESULT hresult ) {
 
 WCHAR* bw_win32_copyAsNewWstr( bw_CStrSlice slice ) {
 
-	DWORD size = MultiByteToWideChar( CP_UTF8, 0, slice.data, (int)slice.len, 0, 0 );
+	size_t size = bw_string_utf16Length( slice );
 
-	WCHAR* str = calloc( size + 1, sizeof(WCHAR) );
+	WCHAR* str = (WCHAR*)malloc( (size + 1) * sizeof(WCHAR) );
 	if (str == 0) {
 		return 0;
 	}
 
-	MultiByteToWideChar( CP_UTF8, 0, slice.data, (int)slice.len, str, size );
+	bw_string_toUtf16( slice, (uint16_t*)str );
 	str[size] = L'\0';
 
 	return str;
@@ -80,38 +80,22 @@ char* bw_win32_copyAsNewCstr( bw_CStrSlice str ) {
 }
 
 char* bw_win32_copyWstrAsNewCstr( const WCHAR* str ) {
+	char* cstr;
 
-	size_t len = wcslen( str );
-	DWORD size_needed = WideCharToMultiByte( CP_UTF8, WC_COMPOSITECHECK | WC_DEFAULTCHAR | WC_NO_BEST_FIT_CHARS, str, (int)len, 0, 0, 0, 0 );
-
-	char* cstr = calloc( size_needed + 1, sizeof( char ) );
-	WideCharToMultiByte( CP_UTF8, WC_COMPOSITECHECK | WC_DEFAULTCHAR | WC_NO_BEST_FIT_CHARS, str, (int)len, cstr, size_needed, 0, 0 );
-	cstr[ size_needed ] = '\0';
-
+	bw_win32_copyAsNewUtf8Str( str, &cstr );
 	return cstr;
 }
 
 size_t bw_win32_copyAsNewUtf8Str( const WCHAR* string, char** output ) {
 
-    size_t len = WideCharToMultiByte( CP_UTF8, 0, string, -1, 0, 0, 0, 0  );
-    if ( len == 0 ) BW_WIN32_PANIC_LAST_ERROR;
-
-    *output = (char*)malloc( len );
-
-    if ( !WideCharToMultiByte(
-        CP_UTF8,
-        WC_ERR_INVALID_CHARS,
-        (LPCWCH)string,
-        -1,
-        *output,
-        (int)len,
-        0,
-        0
-    ) ) {
-        BW_WIN32_PANIC_LAST_ERROR;
-    }
-
-    return len;
+	size_t len = wcslen( string );
+	size_t size = bw_string_utf8Length( (const uint16_t*)string, len );
+
+	*output = (char*)malloc( size + 1 );
+	bw_string_toUtf8( (const uint16_t*)string, len, *output );
+	(*output)[ size ] = '\0';
+
+	return size;
 }
 
 bw_Err bw_win32_unhandledHresult( HRESULT hResult ) {
@@ -26,6 +26,8 @@ extern "C" {
 char* bw_win32_copyWstrAsNewCstr( const WCHAR* str );
 char* bw_win32_copyAsNewCstr( bw_CStrSlice str );
 
+/// Copies the given string into a newly allocated, nul-terminated UTF-8 string.
+/// Returns its length in bytes, without the nul character.
 size_t bw_win32_copyAsNewUtf8Str( const WCHAR* string, char** output );
 
 /// Copies the given string into a newly allocated BSTR (widestring).
@@ -33,6 +33,21 @@ typedef struct {} bw_WindowImpl;
 
 typedef struct bw_Window bw_Window;
 
+
+
+/// The throttling policies of a window, which decide when its content is paused because the user can't see it.
+/// The content always keeps running at full rate.
+#define BW_WINDOW_THROTTLE_NEVER 0
+/// Rendering stops and timers are throttled while the window is hidden or minimized.
+#define BW_WINDOW_THROTTLE_HIDDEN 1
+/// Like `BW_WINDOW_THROTTLE_HIDDEN`, but also while the window is completely covered by other windows, on the platforms that report this.
+#define BW_WINDOW_THROTTLE_OCCLUDED 2
+
+/// The visibility that a window reports through its `on_visibility_change` callback, as far as its throttling policy is concerned.
+#define BW_WINDOW_VISIBILITY_VISIBLE 0
+#define BW_WINDOW_VISIBILITY_OCCLUDED 1
+#define BW_WINDOW_VISIBILITY_HIDDEN 2
+
 typedef struct bw_WindowCallbacks {
 	/// Fired just before the window gets destroyed and freed from memory.
 	/// Should be implemented to free the user data provided to the window.
@@ -43,12 +58,16 @@ typedef struct bw_WindowCallbacks {
 	void (*on_loaded)( const bw_Window* );
 	/// Fired when a window is resizing
 	void (*on_resize)( const bw_Window*, unsigned int width, unsigned int height );
+	/// Fired when the window becomes visible, occluded or hidden, but only for the changes that its throttling policy cares about.
+	void (*on_visibility_change)( const bw_Window*, uint8_t visibility );
 } bw_WindowCallbacks;
 
 typedef struct bw_WindowOptions {
 	bool borders;
 	bool minimizable;
 	bool resizable;
+	/// One of the `BW_WINDOW_THROTTLE_*` policies.
+	uint8_t throttling;
 } bw_WindowOptions;
 
 typedef void (*bw_WindowDispatchFn)( bw_Window* window, void* data );
@@ -61,6 +80,10 @@ struct bw_Window {
 	const bw_Window* parent;	// An optional window that acts as the parent to this window. If the parent gets destroyed, children will get destroyed too.
 	bool closed;	// Whether or not the window has been closed already
 	bool dropped;	// Whether or not the window may be destroyed when it is actually closed
+	bool minimized;	// Whether the platform reported the window to be minimized
+	bool occluded;	// Whether the platform reported the window to be completely covered
+	uint8_t throttling;	// The throttling policy
+	uint8_t visibility;	// The visibility that has been reported to the on_visibility_change callback last
 	bw_WindowCallbacks callbacks;
 	void* user_data;
 	bw_WindowImpl impl;	// Data for the implementation of the window
@@ -132,6 +155,10 @@ void bw_Window_triggerClose( bw_Window* window );
 
 
 void _bw_Window_onResize( const bw_Window* window, unsigned int width, unsigned int height );
+/// Should be called by the window implementations when the window gets minimized or restored.
+void _bw_Window_setMinimized( bw_Window* window, bool minimized );
+/// Should be called by the window implementations when the window gets completely covered or uncovered by other windows.
+void _bw_Window_setOccluded( bw_Window* window, bool occluded );
 
 
 
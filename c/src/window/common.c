@@ -1,4 +1,5 @@
 #include "../common.h"
+#include "../trace.h"
 #include "../window.h"
 
 #include "impl.h"
@@ -8,7 +9,13 @@
 
 
 
+uint8_t bw_Window_throttledVisibility( const bw_Window* window );
+void bw_Window_updateVisibility( bw_Window* window );
+
+
+
 void bw_Window_destroy( bw_Window* window ) {
+	BW_TRACE_BEGIN( span );
 
 	// Call cleanup handler
 	if ( window->callbacks.do_cleanup != 0 )
@@ -17,12 +24,13 @@ void bw_Window_destroy( bw_Window* window ) {
 	// Actually destroy our window
 	bw_WindowImpl_destroy( &window->impl );
 
-	// Free the memory
+	// Give the memory back to the application, which reuses it for the next window
 	bw_Application* app = window->app;
-	free( window );
+	bw_Slab_free( &app->window_slab, window );
 
 	// Decrease the window counter
 	app->windows_alive -= 1;
+	BW_TRACE_END( span, "window_destroy" );
 
 	// Exit application if this was our last window
 	if ( app->windows_alive == 0 )
@@ -40,6 +48,7 @@ void bw_Window_hide( bw_Window* window ) {
 	window->closed = true;
 
 	bw_WindowImpl_hide( &window->impl );
+	bw_Window_updateVisibility( window );
 }
 
 bool bw_Window_isVisible( const bw_Window* window ) {
@@ -66,18 +75,24 @@ bw_Window* bw_Window_new(
 ) {
 	bw_Application_assertCorrectThread( app );
 
-	bw_Window* window = (bw_Window*)malloc( sizeof(bw_Window) );
+	bw_Window* window = (bw_Window*)bw_Slab_alloc( &app->window_slab );
+	BW_ASSERT( window != 0, "Too many windows" );
 
 	window->app = app;
 	window->parent = parent;
 	window->closed = true;  // Windows start out hidden to the user
 	window->dropped = false;
+	window->minimized = false;
+	window->occluded = false;
+	window->throttling = options->throttling;
 	window->user_data = user_data;
 	memset( &window->callbacks, 0, sizeof( window->callbacks ) );
+	window->visibility = bw_Window_throttledVisibility( window );
 
 	window->impl = bw_WindowImpl_new( window, title, width, height, options );
 
 	app->windows_alive += 1;
+	_bw_Application_markStartupPhase( app, &app->startup_metrics.first_window );
 
 	return window;
 }
@@ -86,6 +101,39 @@ void bw_Window_show( bw_Window* window ) {
 	window->closed = false;
 
 	bw_WindowImpl_show( &window->impl );
+	bw_Window_updateVisibility( window );
+}
+
+// The visibility of the window, reduced to the states that its throttling policy distinguishes between.
+uint8_t bw_Window_throttledVisibility( const bw_Window* window ) {
+	if ( window->throttling == BW_WINDOW_THROTTLE_NEVER )
+		return BW_WINDOW_VISIBILITY_VISIBLE;
+
+	if ( window->closed || window->minimized )
+		return BW_WINDOW_VISIBILITY_HIDDEN;
+	if ( window->occluded && window->throttling == BW_WINDOW_THROTTLE_OCCLUDED )
+		return BW_WINDOW_VISIBILITY_OCCLUDED;
+	return BW_WINDOW_VISIBILITY_VISIBLE;
+}
+
+void bw_Window_updateVisibility( bw_Window* window ) {
+	uint8_t visibility = bw_Window_throttledVisibility( window );
+	if ( visibility == window->visibility )
+		return;
+
+	window->visibility = visibility;
+	if ( window->callbacks.on_visibility_change != 0 )
+		window->callbacks.on_visibility_change( window, visibility );
+}
+
+void _bw_Window_setMinimized( bw_Window* window, bool minimized ) {
+	window->minimized = minimized;
+	bw_Window_updateVisibility( window );
+}
+
+void _bw_Window_setOccluded( bw_Window* window, bool occluded ) {
+	window->occluded = occluded;
+	bw_Window_updateVisibility( window );
 }
 
 // Closing a window hides the window,
@@ -99,6 +147,7 @@ void bw_Window_triggerClose( bw_Window* window ) {
 	}
 	else {
 		bw_WindowImpl_hide( &window->impl );
+		bw_Window_updateVisibility( window );
 	}
 
 	// TODO: Fire on_closed event
@@ -7,6 +7,7 @@
 gboolean _bw_WindowGtk_closeHandler( GtkWidget* handle, gpointer data );
 gboolean _bw_WindowGtk_stateHandler( GtkWidget *widget, GdkEventWindowState *event, gpointer user_data );
 void _bw_WindowGtk_onSizeAllocate( GtkWidget* handle, GdkRectangle* alloc, gpointer data );
+gboolean _bw_WindowGtk_visibilityHandler( GtkWidget* handle, GdkEventVisibility* event, gpointer data );
 
 
 
@@ -60,6 +61,11 @@ bw_WindowImpl bw_WindowImpl_new(
 	g_signal_connect( gtk_handle, "window-state-event", G_CALLBACK( _bw_WindowGtk_stateHandler ), (gpointer)window );
 	//g_signal_connect( gtk_handle, "destroy-event", G_CALLBACK( _bw_WindowGtk_closeHandler ), (gpointer)window );
 	g_signal_connect( gtk_handle, "size-allocate", G_CALLBACK( _bw_WindowGtk_onSizeAllocate ), (gpointer)window );
+	// Occlusion is only reported for windows that ask for visibility events
+	if ( options->throttling == BW_WINDOW_THROTTLE_OCCLUDED ) {
+		gtk_widget_add_events( gtk_handle, GDK_VISIBILITY_NOTIFY_MASK );
+		g_signal_connect( gtk_handle, "visibility-notify-event", G_CALLBACK( _bw_WindowGtk_visibilityHandler ), (gpointer)window );
+	}
 
 	// FIXME: Is this really necessary or not?:
 	gtk_application_add_window( window->app->impl.handle, GTK_WINDOW(gtk_handle) );
@@ -95,6 +101,9 @@ void _bw_WindowGtk_onSizeAllocate( GtkWidget* handle, GdkRectangle* alloc, gpoin
 gboolean _bw_WindowGtk_stateHandler( GtkWidget *widget, GdkEventWindowState *event, gpointer user_data ) {
 	bw_Window* window = (bw_Window*)user_data;
 
+	if ( event->changed_mask & GDK_WINDOW_STATE_ICONIFIED )
+		_bw_Window_setMinimized( window, (event->new_window_state & GDK_WINDOW_STATE_ICONIFIED) != 0 );
+
 	// If iconified
 	if ( event->new_window_state & GDK_WINDOW_STATE_ICONIFIED ) {
 
@@ -108,6 +117,15 @@ gboolean _bw_WindowGtk_stateHandler( GtkWidget *widget, GdkEventWindowState *eve
 	return TRUE;
 }
 
+gboolean _bw_WindowGtk_visibilityHandler( GtkWidget* handle, GdkEventVisibility* event, gpointer data ) {
+	UNUSED(handle);
+
+	bw_Window* window = (bw_Window*)data;
+
+	_bw_Window_setOccluded( window, event->state == GDK_VISIBILITY_FULLY_OBSCURED );
+	return FALSE;
+}
+
 gboolean _bw_WindowGtk_closeHandler( GtkWidget* handle, gpointer data ) {
 	UNUSED(handle);
 
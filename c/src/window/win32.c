@@ -71,11 +71,13 @@ size_t bw_Window_getTitle( bw_Window* window, char** title ) {
 			BW_WIN32_PANIC_LAST_ERROR;
 		}
 
-		size_t l = bw_win32_copyAsNewUtf8Str( buffer, title );
-		BW_ASSERT(length == l, "UTF-8 string length is invalid")
+		// The UTF-8 string can be longer than the number of UTF-16 code units
+		size_t size = bw_win32_copyAsNewUtf8Str( buffer, title );
+		free( buffer );
+		return size;
 	}
 
-	return length;
+	return 0;
 }
 
 bw_Dims2D bw_Window_getWindowDimensions( bw_Window* window ) {
@@ -209,6 +211,11 @@ LRESULT CALLBACK bw_Window_proc(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
 	case WM_SIZE:
 		BW_ASSERT( window != 0, "Invalid window pointer during WM_SIZE" );
 
+		_bw_Window_setMinimized( window, wp == SIZE_MINIMIZED );
+		// A minimized window has a client area of zero pixels, which is not worth resizing the content to
+		if ( wp == SIZE_MINIMIZED )
+			break;
+
 		RECT rect;
 		GetClientRect( window->impl.handle, &rect );
 
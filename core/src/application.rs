@@ -3,10 +3,14 @@ pub mod c;
 
 pub use c::ApplicationImpl;
 
-use crate::error::CbwResult;
+use crate::{
+	error::CbwResult,
+	metrics::{ApplicationMemoryStats, LatencyHistogram}
+};
 
 use std::{
-	path::PathBuf,
+	borrow::Cow,
+	path::{Path, PathBuf},
 	os::raw::{c_char, c_int},
 	time::Duration
 };
@@ -18,6 +22,11 @@ pub trait ApplicationExt: Copy {
 	fn assert_correct_thread( &self );
 	/// Dispatches work to be executed on the GUI thread.
 	fn dispatch( &self, work: unsafe fn(ApplicationImpl, *mut ()), data: *mut () ) -> bool;
+	/// Returns how long work that has been dispatched with the given priority waited before it got executed.
+	/// Delayed work is not included.
+	fn dispatch_latencies( &self, priority: DispatchPriority ) -> LatencyHistogram;
+	/// Same as `dispatch`, but executes the work before or after other work, depending on the given priority.
+	fn dispatch_with_priority( &self, work: unsafe fn(ApplicationImpl, *mut ()), data: *mut (), priority: DispatchPriority ) -> bool;
 	/// Dispatches work to be executed on the GUI thread, but delayed by the specified number of milliseconds.
 	fn dispatch_delayed(&self, work: unsafe fn(ApplicationImpl, *mut ()), data: *mut (), delay: Duration ) -> bool;
 	/// Causes the main loop to exit and lets it return the given code.
@@ -26,17 +35,124 @@ pub trait ApplicationExt: Copy {
 	fn exit_threadsafe( self: &Self, exit_code: i32 );
 	/// Shuts down all application processes and performs necessary clean-up code.
 	fn finish( &self ) {}
+	/// Same as `finish`, but for when the process is about to exit anyway.
+	/// Browsers are closed all at once, only the cookies are written to disk, and the browser engine gets no more than `timeout` to shut down.
+	fn finish_fast( &self, _timeout: Duration ) {}
 	fn initialize( argc: c_int, argv: *mut *mut c_char, settings: &ApplicationSettings ) -> CbwResult<ApplicationImpl>;
 	/// When this is called, the runtime will exit as soon as there are no more windows left.
 	fn mark_as_done(&self);
+	/// Returns the memory that the application uses in this process.
+	fn memory_stats( &self ) -> ApplicationMemoryStats;
+	/// Serves the files inside `directory` at `app://<host>/`.
+	fn mount_resource_dir( &self, host: &str, directory: &Path );
+	/// Serves `data` at `app://<path>`, where `path` starts with the host.
+	/// Borrowed data is served without ever being copied.
+	/// If `mime_type` is empty, it is derived from the extension of the path.
+	fn register_resource( &self, path: &str, data: Cow<'static, [u8]>, mime_type: &str );
 	/// Runs the main loop.
 	/// This blocks until the application is exitting.
 	fn run( &self, on_ready: unsafe fn(ApplicationImpl, *mut ()), data: *mut () ) -> i32;
+	/// Starts the browser engine, if it has been postponed by `ApplicationSettings::lazy_engine`.
+	fn start_engine( &self ) {}
+	/// Starts recording trace events of browser window's internals, keeping the last `capacity` events of every thread.
+	/// If `engine_categories` is not empty, the browser engine records the given categories as well.
+	fn start_tracing( &self, capacity: usize, engine_categories: &str );
+	/// Returns the moments at which the phases of the startup have been reached.
+	fn startup_metrics( &self ) -> StartupMetrics;
+	/// Stops recording trace events and writes them to a file in Chrome's trace event format.
+	/// `on_written` is invoked on the GUI thread once the file has been written.
+	fn stop_tracing( &self, path: &Path, on_written: unsafe fn( ApplicationImpl, *mut (), CbwResult<()> ), data: *mut () );
+	/// Releases the memory that can be done without, in all browser windows and their renderer processes.
+	fn trim_memory( &self, level: MemoryPressure );
+	/// Stops serving the resource at the given path, and returns whether there was one.
+	fn unregister_resource( &self, path: &str ) -> bool;
+	/// Writes the startup phases that have been reached to a file, in Chromium's trace event format.
+	fn write_startup_trace( &self, path: &Path ) -> CbwResult<()>;
+}
+
+/// The order in which dispatched work is executed on the GUI thread.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum DispatchPriority {
+	/// Executed before any other dispatched work.
+	High,
+	/// The priority of normal dispatches.
+	Normal,
+	/// Only executed when there are no other events to process, like user input or redraws.
+	/// Use this for background work like synchronising data or forwarding logs.
+	Idle
+}
+
+/// How urgently memory needs to be released.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum MemoryPressure {
+	/// Caches that can be rebuilt are purged, and the renderer processes are asked to release memory.
+	Moderate,
+	/// The browser windows that are waiting in the prewarm pool are destroyed as well.
+	Critical
+}
+
+/// The time it took to reach each phase of the startup, counted from the moment the application started initializing.
+/// A phase that hasn't been reached (yet) is `None`.
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct StartupMetrics {
+	/// When the browser engine was done with its sub-process check.
+	/// Sub-processes branch off at this point, so everything before it is also startup time of every renderer process.
+	pub engine_processes: Option<Duration>,
+	/// When the browser engine got initialized.
+	pub engine_initialized: Option<Duration>,
+	/// When `Application::initialize` returned.
+	pub initialized: Option<Duration>,
+	/// When the runtime started running, right before the `on_ready` closure got invoked.
+	pub ready: Option<Duration>,
+	/// When the first window had been created.
+	pub first_window: Option<Duration>,
+	/// When the browser engine was asked to create the first browser.
+	pub first_browser_requested: Option<Duration>,
+	/// When the first browser had been created, right before it got handed out.
+	pub first_browser_created: Option<Duration>,
+	/// When the first page had finished loading.
+	pub first_load: Option<Duration>,
+	/// When the first frame got painted.
+	/// This is only known for windowless browser windows.
+	pub first_paint: Option<Duration>
 }
 
 pub struct ApplicationSettings {
 	pub engine_seperate_executable_path: Option<PathBuf>,
-	pub resource_dir: Option<String>
+	pub resource_dir: Option<String>,
+	/// The maximum amount of time spent on dispatched work per turn of the event loop.
+	/// Work that is left over is continued in the next turn, after input and redraws had a chance.
+	/// `None` means no limit.
+	pub dispatch_budget: Option<Duration>,
+	/// A resource pack, written by `ResourcePackBuilder`, of which the resources are served at the `app://` scheme.
+	/// It is mapped into memory once at startup.
+	pub resource_pack: Option<PathBuf>,
+	/// Whether windowless browser windows can be created.
+	/// Keep this disabled when they are not used, because it may slow down the rendering of other browser windows on some systems.
+	pub windowless_rendering: bool,
+	/// Lets all browser windows that show the same site share one renderer process, instead of giving each one a process of its own.
+	/// This saves a lot of memory when many browser windows show the same site, but a page that hangs or crashes then takes the others with it.
+	pub process_per_site: bool,
+	/// The maximum number of renderer processes.
+	/// Once it has been reached, new browser windows share the existing processes, even if they show different sites.
+	/// `None` lets the browser engine decide, which it bases on the amount of memory.
+	pub renderer_process_limit: Option<u32>,
+	/// Gives popups a renderer process of their own, instead of sharing the one of the page that opened them.
+	/// The page that opened a popup can't script it anymore then, and `window.opener` isn't available to the popup.
+	pub isolate_popups: bool,
+	/// The directory in which the cache, cookies and local storage are kept between launches.
+	/// Pages that have been loaded before start a lot faster when their resources can be taken from here.
+	/// `None` keeps everything in memory, so that nothing is left behind when the application exits.
+	pub cache_dir: Option<PathBuf>,
+	/// The maximum number of bytes the disk cache may take up.
+	/// `None` lets the browser engine decide.
+	pub cache_size_limit: Option<u64>,
+	/// Whether cookies without an expiry date are kept in the cache directory as well, so that the user stays logged in after a restart.
+	/// This has no effect without a `cache_dir`.
+	pub persist_session_cookies: bool,
+	/// Postpones the startup of the browser engine until the first browser window, request context or cookie jar is created, or until `start_engine` is called.
+	/// Applications that show their own windows first, or that don't always open a browser window, then don't have to wait for it.
+	pub lazy_engine: bool
 }
 
 
@@ -45,7 +161,17 @@ impl Default for ApplicationSettings {
 	fn default() -> Self {
 		Self {
 			engine_seperate_executable_path: None,
-			resource_dir: None
+			resource_dir: None,
+			dispatch_budget: Some( Duration::from_millis(4) ),
+			resource_pack: None,
+			windowless_rendering: false,
+			process_per_site: false,
+			renderer_process_limit: None,
+			isolate_popups: false,
+			cache_dir: None,
+			cache_size_limit: None,
+			persist_session_cookies: false,
+			lazy_engine: false
 		}
 	}
 }
\ No newline at end of file
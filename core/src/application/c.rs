@@ -1,15 +1,19 @@
 //! This module implements the `Application` trait with the corresponding function definitions found in the C code base of `browser-window-c`.
 //! All functions are basically wrapping the FFI provided by crate `browser-window-c`.
 
-use super::{ApplicationExt, ApplicationSettings};
+use super::{ApplicationExt, ApplicationSettings, DispatchPriority, MemoryPressure, StartupMetrics};
 
 use crate::{
 	error::*,
+	metrics::{ApplicationMemoryStats, LatencyHistogram},
 	prelude::*
 };
 
 use std::{
-	os::raw::{c_char, c_int, c_void},
+	borrow::Cow,
+	mem::{self, MaybeUninit},
+	os::raw::{c_char, c_int, c_uint, c_void},
+	path::Path,
 	ptr,
 	time::Duration
 };
@@ -21,6 +25,29 @@ pub struct ApplicationImpl {
 	pub(in crate) inner: *mut cbw_Application
 }
 
+impl DispatchPriority {
+
+	/// The value of a `bw_ApplicationDispatchPriority`.
+	fn to_c( self ) -> cbw_ApplicationDispatchPriority {
+		( match self {
+			DispatchPriority::High => cBW_APPLICATION_DISPATCH_PRIORITY_HIGH,
+			DispatchPriority::Normal => cBW_APPLICATION_DISPATCH_PRIORITY_NORMAL,
+			DispatchPriority::Idle => cBW_APPLICATION_DISPATCH_PRIORITY_IDLE
+		} ) as _
+	}
+}
+
+impl MemoryPressure {
+
+	/// The value of a `bw_ApplicationMemoryPressure`.
+	pub(crate) fn to_c( self ) -> cbw_ApplicationMemoryPressure {
+		( match self {
+			MemoryPressure::Moderate => cBW_APPLICATION_MEMORY_PRESSURE_MODERATE,
+			MemoryPressure::Critical => cBW_APPLICATION_MEMORY_PRESSURE_CRITICAL
+		} ) as _
+	}
+}
+
 impl ApplicationExt for ApplicationImpl {
 
 	fn assert_correct_thread( &self ) {
@@ -38,6 +65,26 @@ impl ApplicationExt for ApplicationImpl {
 		unsafe { cbw_Application_dispatch( self.inner, Some( invocation_handler ), data_ptr as _ ) != 0 }
 	}
 
+	fn dispatch_with_priority( &self, work: unsafe fn(ApplicationImpl, *mut ()), _data: *mut (), priority: DispatchPriority ) -> bool {
+		let data = Box::new( DispatchData {
+			func: work,
+			data: _data
+		} );
+
+		let data_ptr = Box::into_raw( data );
+
+		unsafe { cbw_Application_dispatchWithPriority( self.inner, Some( invocation_handler ), data_ptr as _, priority.to_c() ) != 0 }
+	}
+
+	fn dispatch_latencies( &self, priority: DispatchPriority ) -> LatencyHistogram {
+		let histogram = unsafe {
+			let mut histogram = MaybeUninit::<cbw_LatencyHistogram>::uninit();
+			cbw_Application_getDispatchLatencies( self.inner, priority.to_c(), histogram.as_mut_ptr() );
+			histogram.assume_init()
+		};
+		LatencyHistogram::from_c( &histogram )
+	}
+
 	fn dispatch_delayed( &self, work: unsafe fn(ApplicationImpl, *mut ()), _data: *mut (), delay: Duration ) -> bool {
 		let data = Box::new( DispatchData {
 			func: work,
@@ -61,6 +108,10 @@ impl ApplicationExt for ApplicationImpl {
 		unsafe { cbw_Application_finish( self.inner ) }
 	}
 
+	fn finish_fast( &self, timeout: Duration ) {
+		unsafe { cbw_Application_finishFast( self.inner, timeout.as_millis().min( c_uint::MAX as u128 ) as c_uint ) }
+	}
+
 	fn initialize( argc: c_int, argv: *mut *mut c_char, _settings: &ApplicationSettings ) -> CbwResult<Self> {
 
 		let exec_path: &str = match _settings.engine_seperate_executable_path.as_ref() {
@@ -68,9 +119,23 @@ impl ApplicationExt for ApplicationImpl {
 			Some(path) => path.to_str().unwrap()
 		};
 
+		let resource_pack = _settings.resource_pack.as_ref().map( |path| path.to_string_lossy() ).unwrap_or_default();
+		let cache_dir = _settings.cache_dir.as_ref().map( |path| path.to_string_lossy() ).unwrap_or_default();
+
 		let c_settings = cbw_ApplicationSettings {
 			engine_seperate_executable_path: exec_path.into(),
-			resource_dir: _settings.resource_dir.as_ref().unwrap_or(&"".to_owned()).as_str().into()
+			resource_dir: _settings.resource_dir.as_ref().unwrap_or(&"".to_owned()).as_str().into(),
+			// At least one microsecond, because zero means no limit
+			dispatch_budget: _settings.dispatch_budget.map( |budget| budget.as_micros().clamp( 1, c_uint::MAX as u128 ) as c_uint ).unwrap_or( 0 ),
+			resource_pack: resource_pack.as_ref().into(),
+			windowless_rendering: _settings.windowless_rendering as _,
+			process_per_site: _settings.process_per_site as _,
+			renderer_process_limit: _settings.renderer_process_limit.unwrap_or( 0 ),
+			isolate_popups: _settings.isolate_popups as _,
+			cache_dir: cache_dir.as_ref().into(),
+			cache_size_limit: _settings.cache_size_limit.unwrap_or( 0 ),
+			persist_session_cookies: _settings.persist_session_cookies as _,
+			lazy_engine: _settings.lazy_engine as _
 		};
 
 		let mut c_handle: *mut cbw_Application = ptr::null_mut();
@@ -88,6 +153,39 @@ impl ApplicationExt for ApplicationImpl {
 		unsafe { cbw_Application_markAsDone(self.inner) };
 	}
 
+	fn memory_stats( &self ) -> ApplicationMemoryStats {
+		let mut m: cbw_ApplicationMemoryStats = unsafe { mem::zeroed() };
+		unsafe { cbw_Application_getMemoryStats( self.inner, &mut m ) };
+
+		ApplicationMemoryStats {
+			browser_windows: m.browser_windows as _,
+			pending_calls: m.pending_calls as _,
+			queued_bytes: m.queued_bytes as _,
+			cached_response_bytes: m.cached_response_bytes as _,
+			queued_dispatches: m.queued_dispatches as _,
+			process_private_bytes: m.process_private_bytes
+		}
+	}
+
+	fn mount_resource_dir( &self, host: &str, directory: &Path ) {
+		let directory = directory.to_string_lossy();
+		unsafe { cbw_Resource_mountDirectory( host.into(), directory.as_ref().into() ) };
+	}
+
+	fn register_resource( &self, path: &str, data: Cow<'static, [u8]>, mime_type: &str ) {
+		match data {
+			Cow::Borrowed( bytes ) => unsafe {
+				cbw_Resource_register( path.into(), bytes.as_ptr() as _, bytes.len() as _, mime_type.into(), None, ptr::null_mut() )
+			},
+			// Owned data is moved into a box, which is dropped once the resource isn't used anymore
+			Cow::Owned( bytes ) => {
+				let bytes = Box::new( bytes );
+				let (data, size) = (bytes.as_ptr(), bytes.len());
+				unsafe { cbw_Resource_register( path.into(), data as _, size as _, mime_type.into(), Some( ffi_free_resource ), Box::into_raw( bytes ) as _ ) }
+			}
+		}
+	}
+
 	fn run( &self, on_ready: unsafe fn( ApplicationImpl, *mut () ), _data: *mut () ) -> i32 {
 		let data = Box::new( DispatchData {
 			func: on_ready,
@@ -99,6 +197,60 @@ impl ApplicationExt for ApplicationImpl {
 		// The dispatch handler does exactly the same thing 
 		unsafe { cbw_Application_run( self.inner, Some( invocation_handler ), data_ptr as _ ) }
 	}
+
+	fn start_tracing( &self, capacity: usize, engine_categories: &str ) {
+		unsafe { cbw_Application_startTracing( self.inner, capacity as _, engine_categories.into() ) }
+	}
+
+	fn startup_metrics( &self ) -> StartupMetrics {
+		let mut m: cbw_ApplicationStartupMetrics = unsafe { mem::zeroed() };
+		unsafe { cbw_Application_getStartupMetrics( self.inner, &mut m ) };
+
+		// Phases are relative to the start of the initialization, and a timestamp of 0 hasn't been reached
+		let since = |t: u64| if t == 0 { None } else { Some( Duration::from_micros( t.saturating_sub( m.initialize ) ) ) };
+		StartupMetrics {
+			engine_processes: since( m.engine_processes ),
+			engine_initialized: since( m.engine_initialized ),
+			initialized: since( m.initialized ),
+			ready: since( m.ready ),
+			first_window: since( m.first_window ),
+			first_browser_requested: since( m.first_browser_requested ),
+			first_browser_created: since( m.first_browser_created ),
+			first_load: since( m.first_load ),
+			first_paint: since( m.first_paint )
+		}
+	}
+
+	fn stop_tracing( &self, path: &Path, on_written: unsafe fn( ApplicationImpl, *mut (), CbwResult<()> ), data: *mut () ) {
+		let data_ptr = Box::into_raw( Box::new( TraceWrittenData {
+			func: on_written,
+			data
+		} ) );
+
+		let path = path.to_string_lossy();
+		unsafe { cbw_Application_stopTracing( self.inner, path.as_ref().into(), Some( ffi_trace_written_handler ), data_ptr as _ ) }
+	}
+
+	fn start_engine( &self ) {
+		unsafe { cbw_Application_startEngine( self.inner ) }
+	}
+
+	fn trim_memory( &self, level: MemoryPressure ) {
+		unsafe { cbw_Application_trimMemory( self.inner, level.to_c() ) }
+	}
+
+	fn unregister_resource( &self, path: &str ) -> bool {
+		unsafe { cbw_Resource_unregister( path.into() ) > 0 }
+	}
+
+	fn write_startup_trace( &self, path: &Path ) -> CbwResult<()> {
+		let path = path.to_string_lossy();
+		let c_err = unsafe { cbw_Application_writeStartupTrace( self.inner, path.as_ref().into() ) };
+		if c_err.code != 0 {
+			return Err( c_err.into() )
+		}
+		Ok(())
+	}
 }
 
 
@@ -108,6 +260,15 @@ struct DispatchData {
 	data: *mut ()
 }
 
+struct TraceWrittenData {
+	func: unsafe fn( ApplicationImpl, *mut (), CbwResult<()> ),
+	data: *mut ()
+}
+
+unsafe extern "C" fn ffi_free_resource( user_data: *mut c_void ) {
+	drop( Box::from_raw( user_data as *mut Vec<u8> ) );
+}
+
 unsafe extern "C" fn invocation_handler( _handle: *mut cbw_Application, _data: *mut c_void ) {
 
 	let data_ptr = _data as *mut DispatchData;
@@ -115,4 +276,13 @@ unsafe extern "C" fn invocation_handler( _handle: *mut cbw_Application, _data: *
 	let handle = ApplicationImpl { inner: _handle };
 
 	(data.func)( handle, data.data );
-}
\ No newline at end of file
+}
+
+unsafe extern "C" fn ffi_trace_written_handler( _handle: *mut cbw_Application, _data: *mut c_void, error: cbw_Err ) {
+
+	let data = Box::from_raw( _data as *mut TraceWrittenData );
+	let handle = ApplicationImpl { inner: _handle };
+	let result = if error.code != 0 { Err( error.into() ) } else { Ok(()) };
+
+	(data.func)( handle, data.data, result );
+}
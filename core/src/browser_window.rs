@@ -1,13 +1,19 @@
 pub mod c;
 
-use std::borrow::Cow;
+use std::{
+	borrow::Cow,
+	os::raw::c_void
+};
 
 pub use c::BrowserWindowImpl;
 pub use c::JsEvaluationError;
 
 use super::{
-	application::ApplicationImpl,
+	application::{ApplicationImpl, MemoryPressure},
 	cookie::CookieJarImpl,
+	js_value::JsValue,
+	metrics::{BrowserWindowMemoryStats, BrowserWindowMetrics},
+	request_context::RequestContextImpl,
 	window::{WindowImpl, WindowOptions}
 };
 
@@ -16,11 +22,136 @@ use browser_window_c::*;
 
 
 pub type BrowserWindowOptions = cbw_BrowserWindowOptions;
+/// Identifies a browser window, and is never given to another browser window of the same application, even after it has been closed.
+pub type BrowserWindowId = cbw_BrowserWindowId;
 pub type Source = cbw_BrowserWindowSource;
 
 pub type CreationCallbackFn = unsafe fn( bw: BrowserWindowImpl, data: *mut () );
+/// Receives the browser windows created by `BrowserWindowExt::new_many`, in the order of their specs.
+pub type ManyCreationCallbackFn = unsafe fn( windows: &[BrowserWindowImpl], data: *mut () );
 pub type EvalJsCallbackFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), result: Result<String, JsEvaluationError> ); 
+pub type EvalJsStructuredCallbackFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), result: Result<JsValue, JsEvaluationError> );
+pub type MemoryStatsCallbackFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), stats: BrowserWindowMemoryStats );
 pub type ExternalInvocationHandlerFn = unsafe fn( bw: BrowserWindowImpl, cmd: &str, args: Vec<String> );
+pub type ExternalStructuredInvocationHandlerFn = unsafe fn( bw: BrowserWindowImpl, cmd: &str, args: Vec<JsValue> );
+pub type ExternalBinaryInvocationHandlerFn = unsafe fn( bw: BrowserWindowImpl, cmd: &str, data: &[u8] );
+/// Receives the calls of `invoke_extern` that the page has made during one task.
+pub type ExternalBatchInvocationHandlerFn = unsafe fn( bw: BrowserWindowImpl, calls: Vec<Invocation> );
+/// Receives the calls of `invoke_native`, which are answered with `BrowserWindowExt::reply_to_invocation` under the given `request_id`.
+pub type ExternalNativeInvocationHandlerFn = unsafe fn( bw: BrowserWindowImpl, cmd: &str, args: Vec<String>, request_id: u32 );
+/// Receives the calls of `invoke_extern` on a thread of the worker pool, which can be any thread but the GUI thread.
+pub type ExternalThreadedInvocationHandlerFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), cmd: &str, args: Vec<String> );
+/// Receives the calls of `invoke_extern` of a command registered with `BrowserWindowExt::register_command`.
+pub type CommandHandlerFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), command_id: u32, args: Vec<String> );
+/// Decides whether a browser window receives a broadcast, see `BrowserWindowExt::broadcast`.
+pub type BroadcastFilterFn = unsafe fn( bw: BrowserWindowImpl, data: *mut () ) -> bool;
+/// Receives the events of the page of a browser window, on the GUI thread.
+pub type EventHandlerFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), event: &PageEvent );
+pub type RequestHandlerFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), request: &InterceptedRequest ) -> Option<InterceptedResponse>;
+pub type PaintHandlerFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), frame: &PaintedFrame );
+pub type SharedPaintHandlerFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), frame: &SharedTextureFrame );
+/// Receives the bytes that the page has written with `write_extern_stream`, on the GUI thread.
+pub type StreamHandlerFn = unsafe fn( bw: BrowserWindowImpl, data: *mut (), bytes: &[u8] );
+/// Frees the data of a handler, once the handler is not used anymore.
+pub type HandlerDataFreeFn = unsafe fn( data: *mut () );
+/// An area of the view of a windowless browser window, in pixels.
+pub type DirtyRect = cbw_BrowserWindowRect;
+
+/// One call of `invoke_extern`, as it is given to an `ExternalBatchInvocationHandlerFn`.
+#[derive(Clone, Debug, PartialEq)]
+pub struct Invocation {
+	pub cmd: String,
+	pub args: Vec<String>
+}
+
+/// What happens to a call of `invoke_extern` when the invocation queue of its browser window is full.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum InvokeOverflow {
+	/// `invoke_extern` throws an exception in the page, until the GUI thread has caught up.
+	Block,
+	/// The oldest waiting call is dropped to make room.
+	DropOldest,
+	/// A call replaces the arguments of the waiting call with the same command, even if the queue isn't full.
+	/// If there is no such call and the queue is full, the oldest waiting call is dropped.
+	Coalesce
+}
+
+/// Something that has happened to the page of a browser window, as it is given to an `EventHandlerFn`.
+#[derive(Clone, Debug, PartialEq)]
+pub enum PageEvent {
+	/// The main frame has started loading a page.
+	LoadStart,
+	/// The main frame has finished loading a page, with the given HTTP status code.
+	LoadEnd( i32 ),
+	/// The url of the main frame has changed, which also happens for navigation within the page.
+	UrlChange( String ),
+	/// The title of the page has changed.
+	TitleChange( String ),
+	/// The loading progress of the page has changed, which goes from 0 to 1.
+	Progress( f64 )
+}
+
+/// A request made by the page, as it is given to a `RequestHandlerFn`.
+pub struct InterceptedRequest<'a> {
+	pub method: &'a str,
+	pub url: &'a str,
+	/// All request headers, as lines of the form `Name: value`, separated by newlines.
+	pub headers: &'a str
+}
+
+/// A frame that a windowless browser window has painted into memory.
+pub struct PaintedFrame<'a> {
+	/// The pixels of the whole view, in BGRA order, with rows of `width * 4` bytes.
+	pub buffer: &'a [u8],
+	pub width: u32,
+	pub height: u32,
+	/// The areas that have changed since the previous frame.
+	pub dirty_rects: &'a [DirtyRect],
+	/// Whether this is a frame of a popup widget, instead of a frame of the view.
+	pub is_popup: bool
+}
+
+/// A frame that a windowless browser window has painted into a texture on the GPU.
+pub struct SharedTextureFrame<'a> {
+	/// On Windows, the shared handle of a D3D11 texture. On macOS, an `IOSurfaceRef`.
+	pub shared_handle: *mut c_void,
+	pub dirty_rects: &'a [DirtyRect],
+	pub is_popup: bool
+}
+
+/// The response that a `RequestHandlerFn` answers a request with.
+pub struct InterceptedResponse {
+	pub status: u16,
+	/// If empty, it is derived from the extension of the url.
+	pub mime_type: String,
+	pub body: Vec<u8>,
+	/// Whether the response can be reused for later requests with the same url and cache key headers.
+	pub cacheable: bool
+}
+
+/// The arguments of `BrowserWindowExt::new` for one of the browser windows created by `BrowserWindowExt::new_many`.
+pub struct BrowserWindowSpec<'a> {
+	pub parent: WindowImpl,
+	pub source: Source,
+	pub title: &'a str,
+	pub width: Option<u32>,
+	pub height: Option<u32>,
+	pub window_options: &'a WindowOptions,
+	pub browser_window_options: &'a BrowserWindowOptions,
+	pub handler: ExternalInvocationHandlerFn,
+	pub structured_handler: Option<ExternalStructuredInvocationHandlerFn>,
+	pub binary_handler: Option<ExternalBinaryInvocationHandlerFn>,
+	pub native_handler: Option<ExternalNativeInvocationHandlerFn>,
+	pub batch_handler: Option<ExternalBatchInvocationHandlerFn>,
+	pub threaded_handler: Option<(ExternalThreadedInvocationHandlerFn, HandlerDataFreeFn, *mut ())>,
+	pub request_context: Option<&'a RequestContextImpl>,
+	pub user_data: *mut (),
+	/// Is invoked as soon as this browser window has been created, before the callback for all of them.
+	pub creation_callback: CreationCallbackFn,
+	pub callback_data: *mut ()
+}
+
+
 
 pub trait BrowserWindowExt: Copy {
 
@@ -29,13 +160,65 @@ pub trait BrowserWindowExt: Copy {
 	/// Executes the given JavaScript string.
 	/// The result will be provided by invoking the callback function.
 	fn eval_js( &self, js: &str, callback: EvalJsCallbackFn, callback_data: *mut () );
+
+	/// Like `eval_js`, except that the callback receives an error if the result takes longer than `timeout` milliseconds.
+	/// A `timeout` of 0 means no timeout.
+	/// Returns an id that can be passed to `cancel_js`.
+	fn eval_js_with_timeout( &self, js: &str, timeout: u32, callback: EvalJsCallbackFn, callback_data: *mut () ) -> u64;
+
+	/// Invokes the callback of the evaluation with the given id with an error right away, and drops the result when it arrives.
+	/// Returns false if the evaluation has already completed.
+	fn cancel_js( &self, id: u64 ) -> bool;
 	
-	/// Like `eval_js`, except it can be called from any thread.
-	fn eval_js_threadsafe( &self, js: &str, callback: EvalJsCallbackFn, callback_data: *mut () );
+	/// Executes all given JavaScript strings in one go.
+	/// For every script, the callback of the pair with the same index will be invoked with its data.
+	fn eval_js_batch( &self, scripts: &[&str], callbacks: &[(EvalJsCallbackFn, *mut ())] );
+
+	/// Executes the given JavaScript string without providing its result.
+	/// When coalescing is enabled, the script will be buffered and executed later on.
+	fn exec_js( &self, js: &str );
+
+	/// Executes all scripts that are buffered because coalescing is enabled.
+	fn flush_js( &self );
+
+	/// Sends the data written with `write_stream` that is still buffered.
+	fn flush_stream( &self );
+
+	/// Like `eval_js`, except that the result is provided as a `JsValue` instead of a string.
+	fn eval_js_structured( &self, js: &str, callback: EvalJsStructuredCallbackFn, callback_data: *mut () );
+
+	/// Sends the given data to the page, where it is received as an `ArrayBuffer` by the `on_extern_binary` function.
+	fn post_binary( &self, data: &[u8] );
+
+	/// Calls the function of a script registered with `register_script`, with the given arguments.
+	/// If a callback is given, it will be invoked with the function's return value.
+	fn invoke_script( &self, script_id: u32, args: &[&str], callback: Option<(EvalJsCallbackFn, *mut ())> );
+
+	/// Resolves the promise that `invoke_native` has returned for the request with `request_id` with the `Ok` value, or rejects it with an error with the `Err` message.
+	fn reply_to_invocation( &self, request_id: u32, reply: Result<&str, &str> );
+
+	/// Answers the requests of which the url starts with `url_prefix` with `handler`, which is invoked on the browser engine's IO thread.
+	/// Cacheable responses to GET requests are kept in a response cache of at most `cache_budget` bytes, keyed by the url and the values of `cache_key_headers`.
+	/// Passing `None` as the handler stops the interception, after which the free function of the previous handler is invoked with its data.
+	fn intercept_requests( &self, url_prefix: &str, cache_budget: usize, cache_key_headers: &[&str], handler: Option<(RequestHandlerFn, HandlerDataFreeFn, *mut ())> );
+
+	/// Returns the latencies and counters of the messages exchanged with the renderer process.
+	fn metrics( &self ) -> BrowserWindowMetrics;
+
+	/// Measures the memory used for this browser window, including that of its renderer process.
+	/// The callback is invoked on the GUI thread, once the renderer process has answered.
+	/// If the browser window is closed before that, it is invoked without the renderer's memory.
+	fn memory_stats( &self, callback: MemoryStatsCallbackFn, callback_data: *mut () );
+
+	/// Returns the memory used for this browser window in the current process, without asking the renderer process.
+	fn native_memory_stats( &self ) -> BrowserWindowMemoryStats;
 
 	/// Causes the browser to navigate to the given URI.
 	fn navigate( &self, uri: &str );
 
+	/// Releases the memory that the browser window can do without, and lets its page do the same.
+	fn trim_memory( &self, level: MemoryPressure );
+
 	/// Creates a new browser window asynchronously.
 	/// The `BrowserWindowImpl` handle to the new browser window will be passed via a callback.
 	///
@@ -49,6 +232,12 @@ pub trait BrowserWindowExt: Copy {
 	/// `window_options` - Options for the window.
 	/// `browser_window_options` - Some extra browser related options.
 	/// `handler` - A handler function that can be invoked from within JavaScript code.
+	/// `structured_handler` - If set, this handler function is invoked from within JavaScript code instead of `handler`, with its arguments as `JsValue`s.
+	/// `binary_handler` - A handler function that can be invoked from within JavaScript code with binary data.
+	/// `native_handler` - A handler function that receives the calls of `invoke_native` from within JavaScript code.
+	/// `batch_handler` - If set, the calls of `invoke_extern` are batched per task, and this handler function is invoked instead of `handler`.
+	/// `threaded_handler` - If set, this handler function is invoked with its data on the worker pool instead of `handler`, and the data is freed once the browser window and all its calls are gone.
+	/// `request_context` - The request context to browse in, or `None` for the global one.
 	/// `user_data` - Could be set to point to some extra data that this browser window will store.
 	/// `creation_callback` - Will be invoked when the browser window is created. It provided the `BrowserWindowImpl` handle.
 	/// `callback_data` - The data that will be provided to the `creation_callback`.
@@ -62,15 +251,93 @@ pub trait BrowserWindowExt: Copy {
 		window_options: &WindowOptions,
 		browser_window_options: &BrowserWindowOptions,
 		handler: ExternalInvocationHandlerFn,
+		structured_handler: Option<ExternalStructuredInvocationHandlerFn>,
+		binary_handler: Option<ExternalBinaryInvocationHandlerFn>,
+		native_handler: Option<ExternalNativeInvocationHandlerFn>,
+		batch_handler: Option<ExternalBatchInvocationHandlerFn>,
+		threaded_handler: Option<(ExternalThreadedInvocationHandlerFn, HandlerDataFreeFn, *mut ())>,
+		request_context: Option<&RequestContextImpl>,
 		user_data: *mut (),
 		creation_callback: CreationCallbackFn,
 		callback_data: *mut ()
 	);
 
+	/// Creates a browser window for each of the specs, all at once, so that their renderers start up at the same time.
+	/// `callback` is invoked with all of them once the last one has been created.
+	fn new_many( app: ApplicationImpl, specs: &[BrowserWindowSpec], callback: ManyCreationCallbackFn, callback_data: *mut () );
+
+	/// Keeps `count` hidden browser windows ready, which are taken by `new` when it is called with compatible options and without a parent.
+	/// `structured_handler` tells whether the browser windows will be created with a structured handler.
+	/// If `refill` is set, a replacement is created in the background whenever a browser window has been taken.
+	/// A `count` of 0 destroys the browser windows that are ready.
+	fn prewarm( app: ApplicationImpl, count: u32, window_options: &WindowOptions, browser_window_options: &BrowserWindowOptions, structured_handler: bool, refill: bool );
+
+	/// Looks up the browser window with the given id, or returns `None` if it has been closed.
+	/// This can be called from any thread, but the browser window that it returns may only be used on the GUI thread.
+	fn find( app: ApplicationImpl, id: BrowserWindowId ) -> Option<Self>;
+
+	/// The id by which the browser window can be looked up again with `find`.
+	fn id( &self ) -> BrowserWindowId;
+
+	/// Like `eval_js`, except that it can be called from any thread, for the browser window with the given id.
+	/// The callback is invoked on another thread than the GUI thread, with a null browser window.
+	/// If the browser window has been closed, or its browser hasn't been created yet, the callback is invoked right away with a cancellation error.
+	fn eval_js_threaded( app: ApplicationImpl, id: BrowserWindowId, js: &str, callback: EvalJsCallbackFn, callback_data: *mut () );
+
+	/// Like `metrics`, except that it can be called from any thread, for the browser window with the given id.
+	/// Returns `None` if the browser window has been closed.
+	fn metrics_threaded( app: ApplicationImpl, id: BrowserWindowId ) -> Option<BrowserWindowMetrics>;
+
+	/// Executes `js` and posts `data` in all browser windows of the application that `filter` accepts, or in all of them if there is no filter.
+	/// Either may be empty, in which case it isn't sent.
+	/// The filter is invoked during this call only.
+	/// Returns the number of browser windows that have received it.
+	fn broadcast( app: ApplicationImpl, js: &str, data: &[u8], filter: Option<(BroadcastFilterFn, *mut ())> ) -> usize;
+
+	/// Registers a script that evaluates to a function, which will be compiled for every page that gets loaded.
+	/// Returns the id to be used with `invoke_script`.
+	fn register_script( &self, name: &str, source: &str ) -> u32;
+
+	/// Registers a command of `invoke_extern`, of which the calls are passed to `handler` with its data instead of to the regular handler.
+	/// The data is freed when the browser window is destroyed.
+	/// Returns the id of the command, which the page can also pass to `invoke_extern` instead of the name.
+	fn register_command( &self, name: &str, handler: (CommandHandlerFn, HandlerDataFreeFn, *mut ()) ) -> u32;
+
+	/// Limits the number of calls of `invoke_extern` that may be waiting for the GUI thread to `limit`, or removes the limit if `None`.
+	/// `policy` decides what happens to the calls that don't fit.
+	fn set_invoke_queue_limit( &self, limit: Option<usize>, policy: InvokeOverflow );
+
+	/// Enables coalescing of the scripts given to `exec_js` if `flush_threshold` is set, and disables it otherwise.
+	/// The buffered scripts are flushed on the next iteration of the event loop, or as soon as they reach `flush_threshold` bytes.
+	fn set_js_coalescing( &self, flush_threshold: Option<usize> );
+
+	/// Sets the handler that receives the events of the page, or removes it if `None`.
+	fn set_event_handler( &self, handler: Option<(EventHandlerFn, HandlerDataFreeFn, *mut ())> );
+
+	/// Sets the handler that receives the frames of a windowless browser window, or removes it if `None`.
+	/// The handler is invoked on the browser engine's UI thread, which is not the GUI thread on Windows.
+	fn set_paint_handler( &self, handler: Option<(PaintHandlerFn, HandlerDataFreeFn, *mut ())> );
+
+	/// Like `set_paint_handler`, but for the frames that are painted into shared textures.
+	fn set_shared_paint_handler( &self, handler: Option<(SharedPaintHandlerFn, HandlerDataFreeFn, *mut ())> );
+
+	/// Sets the handler that receives the bytes that the page writes with `write_extern_stream`, or removes it if `None`.
+	fn set_stream_handler( &self, handler: Option<(StreamHandlerFn, HandlerDataFreeFn, *mut ())> );
+
+	/// Changes the size of the view of a windowless browser window.
+	/// A `scale_factor` of 0 keeps the current scale factor.
+	fn set_view_size( &self, width: u32, height: u32, scale_factor: f32 );
+
 	fn user_data( &self ) -> *mut ();
 
 	fn url<'a>(&'a self) -> Cow<'a, str>;
 
+	/// The title of the page, as it has been reported last.
+	fn page_title( &self ) -> String;
+
 	/// Gives a handle to the underlying window.
 	fn window( &self ) -> WindowImpl;
+
+	/// Appends the given data to the page's binary stream, which is flushed on the next iteration of the event loop.
+	fn write_stream( &self, data: &[u8] );
 }
\ No newline at end of file
@@ -5,7 +5,9 @@ use std::{
 	ffi::CStr,
 	fmt,
 	mem::MaybeUninit,
-	os::raw::*
+	os::raw::*,
+	ptr,
+	slice
 };
 
 use browser_window_c::*;
@@ -24,20 +26,47 @@ struct CreationCallbackData {
 	data: *mut ()
 }
 
+struct ManyCreationCallbackData {
+	func: ManyCreationCallbackFn,
+	data: *mut ()
+}
+
+/// The function and data of a handler that can be replaced, together with the function that frees the data.
+struct HandlerData<F> {
+	func: F,
+	free: HandlerDataFreeFn,
+	data: *mut ()
+}
+
 struct EvalJsCallbackData {
 	callback: EvalJsCallbackFn,
 	data: *mut ()
 }
 
+struct MemoryStatsCallbackData {
+	callback: MemoryStatsCallbackFn,
+	data: *mut ()
+}
+
+struct EvalJsStructuredCallbackData {
+	callback: EvalJsStructuredCallbackFn,
+	data: *mut ()
+}
+
 /// An error that may occur when evaluating or executing JavaScript code.
 #[derive(Debug)]
 pub struct JsEvaluationError {
+	code: cbw_ErrCode,
 	message: String
 	// TODO: Add line and column number files, and perhaps even more info about the JS error
 }
 
 struct UserData {
 	func: ExternalInvocationHandlerFn,
+	structured_func: Option<ExternalStructuredInvocationHandlerFn>,
+	binary_func: Option<ExternalBinaryInvocationHandlerFn>,
+	native_func: Option<ExternalNativeInvocationHandlerFn>,
+	batch_func: Option<ExternalBatchInvocationHandlerFn>,
 	data: *mut ()
 }
 
@@ -77,7 +106,7 @@ impl BrowserWindowExt for BrowserWindowImpl {
 		unsafe { cbw_BrowserWindow_evalJs( self.inner, js.into(), Some( ffi_eval_js_callback_handler ), data_ptr as _ ) }
 	}
 
-	fn eval_js_threadsafe( &self, js: &str, callback: EvalJsCallbackFn, callback_data: *mut () ) {
+	fn eval_js_with_timeout( &self, js: &str, timeout: u32, callback: EvalJsCallbackFn, callback_data: *mut () ) -> u64 {
 		let data = Box::new( EvalJsCallbackData {
 			callback,
 			data: callback_data
@@ -85,13 +114,137 @@ impl BrowserWindowExt for BrowserWindowImpl {
 
 		let data_ptr = Box::into_raw( data );
 
-		unsafe { cbw_BrowserWindow_evalJsThreaded( self.inner, js.into(), Some( ffi_eval_js_callback_handler ), data_ptr as _ ) }
+		unsafe { cbw_BrowserWindow_evalJsWithTimeout( self.inner, js.into(), timeout, Some( ffi_eval_js_callback_handler ), data_ptr as _ ) }
+	}
+
+	fn cancel_js( &self, id: u64 ) -> bool {
+		unsafe { cbw_BrowserWindow_cancelJs( self.inner, id ) > 0 }
+	}
+
+	fn eval_js_batch( &self, scripts: &[&str], callbacks: &[(EvalJsCallbackFn, *mut ())] ) {
+		debug_assert!( scripts.len() == callbacks.len() );
+		if scripts.len() == 0 {
+			return;
+		}
+
+		let c_scripts: Vec<cbw_CStrSlice> = scripts.iter().map(|s| (*s).into() ).collect();
+		let c_callbacks: Vec<cbw_BrowserWindowJsCallbackFn> = vec![Some( ffi_eval_js_callback_handler ); callbacks.len()];
+		let c_data: Vec<*mut c_void> = callbacks.iter().map(|(callback, data)| {
+			Box::into_raw( Box::new( EvalJsCallbackData {
+				callback: *callback,
+				data: *data
+			} ) ) as *mut c_void
+		}).collect();
+
+		unsafe { cbw_BrowserWindow_evalJsBatch( self.inner, c_scripts.as_ptr(), c_scripts.len() as _, c_callbacks.as_ptr(), c_data.as_ptr() ) }
+	}
+
+	fn eval_js_structured( &self, js: &str, callback: EvalJsStructuredCallbackFn, callback_data: *mut () ) {
+		let data = Box::new( EvalJsStructuredCallbackData {
+			callback,
+			data: callback_data
+		} );
+
+		let data_ptr = Box::into_raw( data );
+
+		unsafe { cbw_BrowserWindow_evalJsStructured( self.inner, js.into(), Some( ffi_eval_js_structured_callback_handler ), data_ptr as _ ) }
+	}
+
+	fn exec_js( &self, js: &str ) {
+		unsafe { cbw_BrowserWindow_execJs( self.inner, js.into() ) }
+	}
+
+	fn flush_js( &self ) {
+		unsafe { cbw_BrowserWindow_flushJs( self.inner ) }
+	}
+
+	fn post_binary( &self, data: &[u8] ) {
+		unsafe { cbw_BrowserWindow_postBinary( self.inner, data.as_ptr(), data.len() as _ ) }
+	}
+
+	fn intercept_requests( &self, url_prefix: &str, cache_budget: usize, cache_key_headers: &[&str], handler: Option<(RequestHandlerFn, HandlerDataFreeFn, *mut ())> ) {
+		let key_headers = cache_key_headers.join( "," );
+		let options = cbw_BrowserWindowInterceptOptions {
+			url_prefix: url_prefix.into(),
+			cache_budget: cache_budget as _,
+			cache_key_headers: key_headers.as_str().into()
+		};
+
+		match handler {
+			None => unsafe { cbw_BrowserWindow_interceptRequests( self.inner, &options, None, ptr::null_mut(), None ) },
+			Some( (func, free, data) ) => {
+				let data_ptr = Box::into_raw( Box::new( HandlerData { func, free, data } ) );
+
+				unsafe { cbw_BrowserWindow_interceptRequests( self.inner, &options, Some( ffi_request_handler ), data_ptr as _, Some( ffi_free_handler_data::<RequestHandlerFn> ) ) }
+			}
+		}
+	}
+
+	fn invoke_script( &self, script_id: u32, args: &[&str], callback: Option<(EvalJsCallbackFn, *mut ())> ) {
+		let c_args: Vec<cbw_CStrSlice> = args.iter().map(|s| (*s).into() ).collect();
+
+		match callback {
+			None => unsafe { cbw_BrowserWindow_invokeScript( self.inner, script_id, c_args.as_ptr(), c_args.len() as _, None, ptr::null_mut() ) },
+			Some( (callback, callback_data) ) => {
+				let data_ptr = Box::into_raw( Box::new( EvalJsCallbackData {
+					callback,
+					data: callback_data
+				} ) );
+
+				unsafe { cbw_BrowserWindow_invokeScript( self.inner, script_id, c_args.as_ptr(), c_args.len() as _, Some( ffi_eval_js_callback_handler ), data_ptr as _ ) }
+			}
+		}
+	}
+
+	fn reply_to_invocation( &self, request_id: u32, reply: Result<&str, &str> ) {
+		let (success, value) = match reply {
+			Ok( value ) => (1, value),
+			Err( message ) => (0, message)
+		};
+		unsafe { cbw_BrowserWindow_replyToInvocation( self.inner, request_id as _, success, value.into() ) }
+	}
+
+	fn flush_stream( &self ) {
+		unsafe { cbw_BrowserWindow_flushStream( self.inner ) }
+	}
+
+	fn metrics( &self ) -> BrowserWindowMetrics {
+		let metrics = unsafe {
+			let mut metrics = MaybeUninit::<cbw_BrowserWindowMetrics>::uninit();
+			cbw_BrowserWindow_getMetrics( self.inner, metrics.as_mut_ptr() );
+			metrics.assume_init()
+		};
+
+		BrowserWindowMetrics::from_c( &metrics )
+	}
+
+	fn memory_stats( &self, callback: MemoryStatsCallbackFn, callback_data: *mut () ) {
+		let data_ptr = Box::into_raw( Box::new( MemoryStatsCallbackData {
+			callback,
+			data: callback_data
+		} ) );
+
+		unsafe { cbw_BrowserWindow_getMemoryStats( self.inner, Some( ffi_memory_stats_callback_handler ), data_ptr as _ ) }
+	}
+
+	fn native_memory_stats( &self ) -> BrowserWindowMemoryStats {
+		let stats = unsafe {
+			let mut stats = MaybeUninit::<cbw_BrowserWindowMemoryStats>::uninit();
+			cbw_BrowserWindow_getNativeMemoryStats( self.inner, stats.as_mut_ptr() );
+			stats.assume_init()
+		};
+
+		BrowserWindowMemoryStats::from_c( &stats )
 	}
 
 	fn navigate( &self, uri: &str ) {
 		unsafe { cbw_BrowserWindow_navigate( self.inner, uri.into() ) };
 	}
 
+	fn trim_memory( &self, level: MemoryPressure ) {
+		unsafe { cbw_BrowserWindow_trimMemory( self.inner, level.to_c() ) }
+	}
+
 	fn new(
 		app: ApplicationImpl,
 		parent: WindowImpl,
@@ -102,46 +255,184 @@ impl BrowserWindowExt for BrowserWindowImpl {
 		window_options: &WindowOptions,
 		browser_window_options: &BrowserWindowOptions,
 		handler: ExternalInvocationHandlerFn,
-		_user_data: *mut (),
+		structured_handler: Option<ExternalStructuredInvocationHandlerFn>,
+		binary_handler: Option<ExternalBinaryInvocationHandlerFn>,
+		native_handler: Option<ExternalNativeInvocationHandlerFn>,
+		batch_handler: Option<ExternalBatchInvocationHandlerFn>,
+		threaded_handler: Option<(ExternalThreadedInvocationHandlerFn, HandlerDataFreeFn, *mut ())>,
+		request_context: Option<&RequestContextImpl>,
+		user_data: *mut (),
 		creation_callback: CreationCallbackFn,
-		_callback_data: *mut ()
+		callback_data: *mut ()
 	) {
-		// Convert width and height to -1 if unspecified.
-		// Also convert to c_int as required by the C interface.
-		let w: c_int = match width {
-			None => -1,
-			Some(x) => x as _
-		};
-		let h: c_int = match height {
-			None => -1,
-			Some(x) => x as _
+		let spec = BrowserWindowSpec {
+			parent, source, title, width, height, window_options, browser_window_options,
+			handler, structured_handler, binary_handler, native_handler, batch_handler, threaded_handler,
+			request_context, user_data, creation_callback, callback_data
 		};
+		let ( options, c_spec ) = ffi_spec( &spec );
 
-		// Wrap the callback functions so that they invoke our Rust functions from C
-		let user_data = Box::new( UserData {
-			func: handler,
-			data: _user_data
-		} );
-		let callback_data = Box::new( CreationCallbackData {
-			func: creation_callback,
-			data: _callback_data
+		unsafe { cbw_BrowserWindow_new(
+			app.inner,
+			c_spec.parent,
+			c_spec.source,
+			c_spec.title,
+			c_spec.width, c_spec.height,
+			c_spec.window_options,
+			&*options as _,
+			c_spec.handler,
+			c_spec.user_data,
+			c_spec.callback,
+			c_spec.callback_data
+		) };
+	}
+
+	fn new_many( app: ApplicationImpl, specs: &[BrowserWindowSpec], callback: ManyCreationCallbackFn, callback_data: *mut () ) {
+		// The options need to stay around during the call, because the C specs point to them
+		let prepared: Vec<_> = specs.iter().map(|spec| ffi_spec( spec ) ).collect();
+		let c_specs: Vec<cbw_BrowserWindowSpec> = prepared.iter().map(|(options, c_spec)| {
+			let mut c_spec = *c_spec;
+			c_spec.browser_window_options = &**options as _;
+			c_spec
+		} ).collect();
+
+		let data = Box::new( ManyCreationCallbackData {
+			func: callback,
+			data: callback_data
 		} );
 
-		unsafe { cbw_BrowserWindow_new(
+		unsafe { cbw_BrowserWindow_newMany(
 			app.inner,
-			parent.inner,
-			source,
-			title.into(),
-			w, h,
-			window_options as _,
-			browser_window_options as _,
-			Some( ffi_handler ),
-			Box::into_raw( user_data ) as _,
-			Some( ffi_creation_callback_handler ),
-			Box::into_raw( callback_data ) as _
+			c_specs.as_ptr(),
+			c_specs.len() as _,
+			Some( ffi_many_creation_callback_handler ),
+			Box::into_raw( data ) as _
 		) };
 	}
 
+	fn prewarm( app: ApplicationImpl, count: u32, window_options: &WindowOptions, browser_window_options: &BrowserWindowOptions, structured_handler: bool, refill: bool ) {
+		let mut browser_window_options = *browser_window_options;
+		browser_window_options.structured_handler = if structured_handler { Some( ffi_structured_handler ) } else { None };
+
+		unsafe { cbw_Application_prewarmBrowserWindows( app.inner, count as _, window_options as _, &browser_window_options as _, refill as _ ) }
+	}
+
+	fn broadcast( app: ApplicationImpl, js: &str, data: &[u8], filter: Option<(BroadcastFilterFn, *mut ())> ) -> usize {
+		let payload = cbw_ApplicationBroadcastPayload {
+			js: js.into(),
+			data: data.as_ptr(),
+			size: data.len() as _
+		};
+
+		// The filter is only used during the call, so it can be passed by reference
+		match filter {
+			None => unsafe { cbw_Application_broadcast( app.inner, &payload, None, ptr::null_mut() ) as _ },
+			Some( mut filter ) => unsafe {
+				cbw_Application_broadcast( app.inner, &payload, Some( ffi_broadcast_filter ), &mut filter as *mut (BroadcastFilterFn, *mut ()) as _ ) as _
+			}
+		}
+	}
+
+	fn find( app: ApplicationImpl, id: BrowserWindowId ) -> Option<Self> {
+		let inner = unsafe { cbw_Application_findBrowserWindow( app.inner, id ) };
+
+		if inner.is_null() { None } else { Some( Self { inner } ) }
+	}
+
+	fn id( &self ) -> BrowserWindowId {
+		unsafe { cbw_BrowserWindow_getId( self.inner ) }
+	}
+
+	fn eval_js_threaded( app: ApplicationImpl, id: BrowserWindowId, js: &str, callback: EvalJsCallbackFn, callback_data: *mut () ) {
+		let data = Box::new( EvalJsCallbackData {
+			callback,
+			data: callback_data
+		} );
+
+		let data_ptr = Box::into_raw( data );
+
+		unsafe { cbw_BrowserWindow_evalJsThreaded( app.inner, id, js.into(), Some( ffi_eval_js_callback_handler ), data_ptr as _ ) }
+	}
+
+	fn metrics_threaded( app: ApplicationImpl, id: BrowserWindowId ) -> Option<BrowserWindowMetrics> {
+		let mut metrics = MaybeUninit::<cbw_BrowserWindowMetrics>::uninit();
+
+		if unsafe { cbw_BrowserWindow_getMetricsThreaded( app.inner, id, metrics.as_mut_ptr() ) } == 0 {
+			return None;
+		}
+		Some( BrowserWindowMetrics::from_c( unsafe { &metrics.assume_init() } ) )
+	}
+
+	fn register_script( &self, name: &str, source: &str ) -> u32 {
+		unsafe { cbw_BrowserWindow_registerScript( self.inner, name.into(), source.into() ) }
+	}
+
+	fn register_command( &self, name: &str, handler: (CommandHandlerFn, HandlerDataFreeFn, *mut ()) ) -> u32 {
+		let (func, free, data) = handler;
+		let data_ptr = Box::into_raw( Box::new( HandlerData { func, free, data } ) );
+
+		unsafe { cbw_BrowserWindow_registerCommand( self.inner, name.into(), Some( ffi_command_handler ), data_ptr as _, Some( ffi_free_handler_data::<CommandHandlerFn> ) ) }
+	}
+
+	fn set_invoke_queue_limit( &self, limit: Option<usize>, policy: InvokeOverflow ) {
+		unsafe { cbw_BrowserWindow_setInvokeQueueLimit( self.inner, limit.unwrap_or( 0 ) as _, policy.to_c() ) }
+	}
+
+	fn set_js_coalescing( &self, flush_threshold: Option<usize> ) {
+		match flush_threshold {
+			None => unsafe { cbw_BrowserWindow_setJsCoalescing( self.inner, 0, 0 ) },
+			Some( threshold ) => unsafe { cbw_BrowserWindow_setJsCoalescing( self.inner, 1, threshold as _ ) }
+		}
+	}
+
+	fn set_event_handler( &self, handler: Option<(EventHandlerFn, HandlerDataFreeFn, *mut ())> ) {
+		match handler {
+			None => unsafe { cbw_BrowserWindow_setEventHandler( self.inner, None, ptr::null_mut(), None ) },
+			Some( (func, free, data) ) => {
+				let data_ptr = Box::into_raw( Box::new( HandlerData { func, free, data } ) );
+
+				unsafe { cbw_BrowserWindow_setEventHandler( self.inner, Some( ffi_event_handler ), data_ptr as _, Some( ffi_free_handler_data::<EventHandlerFn> ) ) }
+			}
+		}
+	}
+
+	fn set_paint_handler( &self, handler: Option<(PaintHandlerFn, HandlerDataFreeFn, *mut ())> ) {
+		match handler {
+			None => unsafe { cbw_BrowserWindow_setPaintHandler( self.inner, None, ptr::null_mut(), None ) },
+			Some( (func, free, data) ) => {
+				let data_ptr = Box::into_raw( Box::new( HandlerData { func, free, data } ) );
+
+				unsafe { cbw_BrowserWindow_setPaintHandler( self.inner, Some( ffi_paint_handler ), data_ptr as _, Some( ffi_free_handler_data::<PaintHandlerFn> ) ) }
+			}
+		}
+	}
+
+	fn set_shared_paint_handler( &self, handler: Option<(SharedPaintHandlerFn, HandlerDataFreeFn, *mut ())> ) {
+		match handler {
+			None => unsafe { cbw_BrowserWindow_setSharedPaintHandler( self.inner, None, ptr::null_mut(), None ) },
+			Some( (func, free, data) ) => {
+				let data_ptr = Box::into_raw( Box::new( HandlerData { func, free, data } ) );
+
+				unsafe { cbw_BrowserWindow_setSharedPaintHandler( self.inner, Some( ffi_shared_paint_handler ), data_ptr as _, Some( ffi_free_handler_data::<SharedPaintHandlerFn> ) ) }
+			}
+		}
+	}
+
+	fn set_stream_handler( &self, handler: Option<(StreamHandlerFn, HandlerDataFreeFn, *mut ())> ) {
+		match handler {
+			None => unsafe { cbw_BrowserWindow_setStreamHandler( self.inner, None, ptr::null_mut(), None ) },
+			Some( (func, free, data) ) => {
+				let data_ptr = Box::into_raw( Box::new( HandlerData { func, free, data } ) );
+
+				unsafe { cbw_BrowserWindow_setStreamHandler( self.inner, Some( ffi_stream_handler ), data_ptr as _, Some( ffi_free_handler_data::<StreamHandlerFn> ) ) }
+			}
+		}
+	}
+
+	fn set_view_size( &self, width: u32, height: u32, scale_factor: f32 ) {
+		unsafe { cbw_BrowserWindow_setViewSize( self.inner, width as _, height as _, scale_factor ) }
+	}
+
 	fn user_data( &self ) -> *mut () {
 		let c_user_data_ptr: *mut UserData = unsafe { (*self.inner).user_data as _ };
 
@@ -158,12 +449,24 @@ impl BrowserWindowExt for BrowserWindowImpl {
 			unsafe { cbw_string_free(slice) };
 			url.into()
 		}
+		// The url that has been reported last is replaced by the next event, which may be handled before the borrow ends
 		else {
-			let url: &'a str = slice.into();
-			url.into()
+			let url: &str = slice.into();
+			url.to_owned().into()
 		}
 	}
 
+	fn page_title( &self ) -> String {
+		let mut slice = cbw_CStrSlice::empty();
+		unsafe { cbw_BrowserWindow_getPageTitle( self.inner, &mut slice ) };
+
+		slice.into()
+	}
+
+	fn write_stream( &self, data: &[u8] ) {
+		unsafe { cbw_BrowserWindow_writeStream( self.inner, data.as_ptr(), data.len() as _ ) }
+	}
+
 	fn window( &self ) -> WindowImpl {
 		WindowImpl {
 			inner: unsafe { cbw_BrowserWindow_getWindow( self.inner ) }
@@ -171,6 +474,18 @@ impl BrowserWindowExt for BrowserWindowImpl {
 	}
 }
 
+impl InvokeOverflow {
+
+	/// The value of a `bw_BrowserWindowInvokeOverflow`.
+	pub(crate) fn to_c( self ) -> cbw_BrowserWindowInvokeOverflow {
+		( match self {
+			InvokeOverflow::Block => cBW_BROWSER_WINDOW_INVOKE_OVERFLOW_BLOCK,
+			InvokeOverflow::DropOldest => cBW_BROWSER_WINDOW_INVOKE_OVERFLOW_DROP_OLDEST,
+			InvokeOverflow::Coalesce => cBW_BROWSER_WINDOW_INVOKE_OVERFLOW_COALESCE
+		} ) as _
+	}
+}
+
 
 
 impl JsEvaluationError {
@@ -181,9 +496,20 @@ impl JsEvaluationError {
 		let message: String = cstr.to_string_lossy().into();
 
 		Self {
+			code: (*err).code,
 			message: message
 		}
 	}
+
+	/// Whether the evaluation has been cancelled, explicitly or because the browser window has been closed.
+	pub fn is_cancelled( &self ) -> bool {
+		self.code == cBW_BROWSER_WINDOW_JS_ERROR_CANCELLED
+	}
+
+	/// Whether the result didn't arrive in time.
+	pub fn is_timed_out( &self ) -> bool {
+		self.code == cBW_BROWSER_WINDOW_JS_ERROR_TIMED_OUT
+	}
 }
 
 impl Error for JsEvaluationError {
@@ -204,6 +530,70 @@ impl fmt::Display for JsEvaluationError {
  * The C handler functions that are invoked by external C code, and that in turn invoke relevant Rust handlers. *
  ****************************************************************************************************************/
 
+/// Converts a spec into its C counterpart, with the handlers and the creation callback wrapped so that they invoke our Rust functions from C.
+/// The C spec points to the returned options, which therefore need to stay around for as long as it is used.
+fn ffi_spec( spec: &BrowserWindowSpec ) -> ( Box<cbw_BrowserWindowOptions>, cbw_BrowserWindowSpec ) {
+
+	let user_data = Box::new( UserData {
+		func: spec.handler,
+		structured_func: spec.structured_handler,
+		binary_func: spec.binary_handler,
+		native_func: spec.native_handler,
+		batch_func: spec.batch_handler,
+		data: spec.user_data
+	} );
+
+	// The structured handler is only passed on to C when there is one, so that the arguments are only converted into structured values when needed
+	let mut options = Box::new( *spec.browser_window_options );
+	options.structured_handler = spec.structured_handler.map(|_| ffi_structured_handler as _ );
+	options.binary_handler = spec.binary_handler.map(|_| ffi_binary_handler as _ );
+	options.native_handler = spec.native_handler.map(|_| ffi_native_handler as _ );
+	options.batch_handler = spec.batch_handler.map(|_| ffi_batch_handler as _ );
+	if let Some( (func, free, data) ) = spec.threaded_handler {
+		let data_ptr = Box::into_raw( Box::new( HandlerData { func, free, data } ) );
+
+		options.threaded_handler = Some( ffi_threaded_handler );
+		options.threaded_handler_data = data_ptr as _;
+		options.free_threaded_handler_data = Some( ffi_free_handler_data::<ExternalThreadedInvocationHandlerFn> );
+	}
+	options.request_context = match spec.request_context {
+		None => ptr::null(),
+		Some( context ) => context.inner
+	};
+	let callback_data = Box::new( CreationCallbackData {
+		func: spec.creation_callback,
+		data: spec.callback_data
+	} );
+
+	let c_spec = cbw_BrowserWindowSpec {
+		parent: spec.parent.inner,
+		source: spec.source,
+		title: spec.title.into(),
+		// Unspecified dimensions are -1 for the C interface
+		width: spec.width.map(|w| w as c_int ).unwrap_or( -1 ),
+		height: spec.height.map(|h| h as c_int ).unwrap_or( -1 ),
+		window_options: spec.window_options as _,
+		browser_window_options: &*options as _,
+		handler: Some( ffi_handler ),
+		user_data: Box::into_raw( user_data ) as _,
+		callback: Some( ffi_creation_callback_handler ),
+		callback_data: Box::into_raw( callback_data ) as _
+	};
+	( options, c_spec )
+}
+
+unsafe extern "C" fn ffi_many_creation_callback_handler( windows: *mut *mut cbw_BrowserWindow, count: UsizeFix, _data: *mut c_void ) {
+
+	let data = Box::from_raw( _data as *mut ManyCreationCallbackData );
+
+	let handles: Vec<BrowserWindowImpl> = if count > 0 {
+		slice::from_raw_parts( windows, count as _ ).iter().map(|inner| BrowserWindowImpl { inner: *inner } ).collect()
+	}
+	else { Vec::new() };
+
+	(data.func)( &handles, data.data );
+}
+
 unsafe extern "C" fn ffi_creation_callback_handler( bw: *mut cbw_BrowserWindow, _data: *mut c_void ) {
 
 	let data_ptr = _data as *mut CreationCallbackData;
@@ -224,6 +614,28 @@ unsafe extern "C" fn ffi_eval_js_callback_handler( bw: *mut cbw_BrowserWindow, _
 	(data.callback)( handle, data.data, result );
 }
 
+unsafe extern "C" fn ffi_eval_js_structured_callback_handler( bw: *mut cbw_BrowserWindow, _data: *mut c_void, _result: *const cbw_JsValue, error: *const cbw_Err ) {
+
+	let data_ptr = _data as *mut EvalJsStructuredCallbackData;
+	let data = Box::from_raw( data_ptr );
+
+	let result = if error.is_null() {
+		Ok( JsValue::from_c( _result ) )
+	}
+	else {
+		Err( JsEvaluationError::new( error ) )
+	};
+
+	(data.callback)( BrowserWindowImpl { inner: bw }, data.data, result );
+}
+
+unsafe extern "C" fn ffi_memory_stats_callback_handler( bw: *mut cbw_BrowserWindow, _data: *mut c_void, stats: *const cbw_BrowserWindowMemoryStats ) {
+
+	let data = Box::from_raw( _data as *mut MemoryStatsCallbackData );
+
+	(data.callback)( BrowserWindowImpl { inner: bw }, data.data, BrowserWindowMemoryStats::from_c( &*stats ) );
+}
+
 unsafe extern "C" fn ffi_handler( bw: *mut cbw_BrowserWindow, cmd: cbw_CStrSlice, args: *mut cbw_CStrSlice, arg_count: UsizeFix ) {
 
 	let handle = BrowserWindowImpl { inner: bw };
@@ -241,6 +653,228 @@ unsafe extern "C" fn ffi_handler( bw: *mut cbw_BrowserWindow, cmd: cbw_CStrSlice
 	(data.func)( handle, cmd_string, args_vec );
 }
 
+unsafe extern "C" fn ffi_binary_handler( bw: *mut cbw_BrowserWindow, cmd: cbw_CStrSlice, data: *const u8, size: UsizeFix ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+
+	let user_data_ptr = (*bw).user_data as *mut UserData;
+	let user_data = &mut *user_data_ptr;
+
+	let cmd_string: &str = cmd.into();
+	let data_slice: &[u8] = if size > 0 {
+		slice::from_raw_parts( data, size as _ )
+	} else { &[] };
+
+	if let Some( func ) = user_data.binary_func {
+		func( handle, cmd_string, data_slice );
+	}
+}
+
+unsafe extern "C" fn ffi_batch_handler( bw: *mut cbw_BrowserWindow, calls: *const cbw_BrowserWindowInvocation, call_count: UsizeFix ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+
+	let data_ptr = (*bw).user_data as *mut UserData;
+	let data = &mut *data_ptr;
+
+	let mut calls_vec: Vec<Invocation> = Vec::with_capacity( call_count as usize );
+	for i in 0..call_count {
+		let call = &*calls.add( i as usize );
+
+		let mut args: Vec<String> = Vec::with_capacity( call.arg_count as usize );
+		for j in 0..call.arg_count {
+			args.push( (*call.args.add( j as usize )).into() );
+		}
+		calls_vec.push( Invocation {
+			cmd: call.cmd.into(),
+			args
+		} );
+	}
+
+	if let Some( func ) = data.batch_func {
+		func( handle, calls_vec );
+	}
+}
+
+unsafe extern "C" fn ffi_native_handler( bw: *mut cbw_BrowserWindow, cmd: cbw_CStrSlice, args: *mut cbw_CStrSlice, arg_count: UsizeFix, request_id: c_uint ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+
+	let data_ptr = (*bw).user_data as *mut UserData;
+	let data = &mut *data_ptr;
+
+	let cmd_string: &str = cmd.into();
+	let mut args_vec: Vec<String> = Vec::with_capacity( arg_count as usize );
+	for i in 0..arg_count {
+		args_vec.push( (*args.add( i as usize )).into() );
+	}
+
+	if let Some( func ) = data.native_func {
+		func( handle, cmd_string, args_vec, request_id as _ );
+	}
+}
+
+unsafe extern "C" fn ffi_request_handler( bw: *mut cbw_BrowserWindow, user_data: *mut c_void, request: *const cbw_BrowserWindowRequest, response: *mut cbw_BrowserWindowResponse ) -> cBOOL {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let data = &*(user_data as *const HandlerData<RequestHandlerFn>);
+
+	let c_request = &*request;
+	let request = InterceptedRequest {
+		method: c_request.method.into(),
+		url: c_request.url.into(),
+		headers: c_request.headers.into()
+	};
+
+	match (data.func)( handle, data.data, &request ) {
+		None => 0,
+		Some( result ) => {
+			// The mime type is copied right after we return, but the body is not, so the response is kept alive until the C side frees it
+			let result = Box::new( result );
+			let response = &mut *response;
+			response.status = result.status as _;
+			response.mime_type = result.mime_type.as_str().into();
+			response.data = result.body.as_ptr() as _;
+			response.size = result.body.len() as _;
+			response.cacheable = result.cacheable as _;
+			response.free_fn = Some( ffi_free_response );
+			response.free_data = Box::into_raw( result ) as _;
+			1
+		}
+	}
+}
+
+unsafe extern "C" fn ffi_broadcast_filter( bw: *mut cbw_BrowserWindow, user_data: *mut c_void ) -> cBOOL {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let (func, data) = *(user_data as *const (BroadcastFilterFn, *mut ()));
+
+	func( handle, data ) as _
+}
+
+unsafe extern "C" fn ffi_command_handler( bw: *mut cbw_BrowserWindow, user_data: *mut c_void, command_id: c_uint, args: *const cbw_CStrSlice, arg_count: UsizeFix ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let data = &*(user_data as *const HandlerData<CommandHandlerFn>);
+
+	let mut args_vec: Vec<String> = Vec::with_capacity( arg_count as usize );
+	for i in 0..arg_count {
+		args_vec.push( (*args.add( i as usize )).into() );
+	}
+
+	(data.func)( handle, data.data, command_id as _, args_vec );
+}
+
+unsafe extern "C" fn ffi_threaded_handler( bw: *mut cbw_BrowserWindow, user_data: *mut c_void, cmd: cbw_CStrSlice, args: *const cbw_CStrSlice, arg_count: UsizeFix ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let data = &*(user_data as *const HandlerData<ExternalThreadedInvocationHandlerFn>);
+
+	let cmd_string: &str = cmd.into();
+	let mut args_vec: Vec<String> = Vec::with_capacity( arg_count as usize );
+	for i in 0..arg_count {
+		args_vec.push( (*args.add( i as usize )).into() );
+	}
+
+	(data.func)( handle, data.data, cmd_string, args_vec );
+}
+
+unsafe extern "C" fn ffi_free_handler_data<F>( user_data: *mut c_void ) {
+	let data = Box::from_raw( user_data as *mut HandlerData<F> );
+	(data.free)( data.data );
+}
+
+/// Gives the dirty rects of a frame as a slice, without copying them.
+unsafe fn dirty_rects<'a>( rects: *const cbw_BrowserWindowRect, count: UsizeFix ) -> &'a [DirtyRect] {
+	if count > 0 {
+		slice::from_raw_parts( rects, count as _ )
+	} else { &[] }
+}
+
+#[allow(non_upper_case_globals)]
+unsafe extern "C" fn ffi_event_handler( bw: *mut cbw_BrowserWindow, user_data: *mut c_void, event: *const cbw_BrowserWindowEvent ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let data = &*(user_data as *const HandlerData<EventHandlerFn>);
+
+	let c_event = &*event;
+	let event = match c_event.kind as u32 {
+		cBW_BROWSER_WINDOW_EVENT_LOAD_START => PageEvent::LoadStart,
+		cBW_BROWSER_WINDOW_EVENT_LOAD_END => PageEvent::LoadEnd( c_event.http_status as _ ),
+		cBW_BROWSER_WINDOW_EVENT_URL_CHANGE => PageEvent::UrlChange( c_event.text.into() ),
+		cBW_BROWSER_WINDOW_EVENT_TITLE_CHANGE => PageEvent::TitleChange( c_event.text.into() ),
+		cBW_BROWSER_WINDOW_EVENT_PROGRESS => PageEvent::Progress( c_event.progress ),
+		_ => return
+	};
+
+	(data.func)( handle, data.data, &event );
+}
+
+unsafe extern "C" fn ffi_paint_handler( bw: *mut cbw_BrowserWindow, user_data: *mut c_void, frame: *const cbw_BrowserWindowFrame ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let data = &*(user_data as *const HandlerData<PaintHandlerFn>);
+
+	let c_frame = &*frame;
+	let size = c_frame.width.max( 0 ) as usize * c_frame.height.max( 0 ) as usize * 4;
+	let frame = PaintedFrame {
+		buffer: if size > 0 { slice::from_raw_parts( c_frame.buffer as *const u8, size ) } else { &[] },
+		width: c_frame.width.max( 0 ) as _,
+		height: c_frame.height.max( 0 ) as _,
+		dirty_rects: dirty_rects( c_frame.dirty_rects, c_frame.dirty_rect_count ),
+		is_popup: c_frame.is_popup != 0
+	};
+
+	(data.func)( handle, data.data, &frame );
+}
+
+unsafe extern "C" fn ffi_stream_handler( bw: *mut cbw_BrowserWindow, user_data: *mut c_void, bytes: *const u8, size: UsizeFix ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let data = &*(user_data as *const HandlerData<StreamHandlerFn>);
+
+	let bytes = if size > 0 { slice::from_raw_parts( bytes, size as _ ) } else { &[] };
+
+	(data.func)( handle, data.data, bytes );
+}
+
+unsafe extern "C" fn ffi_shared_paint_handler( bw: *mut cbw_BrowserWindow, user_data: *mut c_void, frame: *const cbw_BrowserWindowSharedFrame ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+	let data = &*(user_data as *const HandlerData<SharedPaintHandlerFn>);
+
+	let c_frame = &*frame;
+	let frame = SharedTextureFrame {
+		shared_handle: c_frame.shared_handle,
+		dirty_rects: dirty_rects( c_frame.dirty_rects, c_frame.dirty_rect_count ),
+		is_popup: c_frame.is_popup != 0
+	};
+
+	(data.func)( handle, data.data, &frame );
+}
+
+unsafe extern "C" fn ffi_free_response( data: *mut c_void ) {
+	drop( Box::from_raw( data as *mut InterceptedResponse ) );
+}
+
+unsafe extern "C" fn ffi_structured_handler( bw: *mut cbw_BrowserWindow, cmd: cbw_CStrSlice, args: *const cbw_JsValue, arg_count: UsizeFix ) {
+
+	let handle = BrowserWindowImpl { inner: bw };
+
+	let data_ptr = (*bw).user_data as *mut UserData;
+	let data = &mut *data_ptr;
+
+	let cmd_string: &str = cmd.into();
+	let mut args_vec: Vec<JsValue> = Vec::with_capacity( arg_count as usize );
+	for i in 0..arg_count {
+		args_vec.push( JsValue::from_c( args.add( i as usize ) ) );
+	}
+
+	if let Some( func ) = data.structured_func {
+		func( handle, cmd_string, args_vec );
+	}
+}
+
 /// Processes the result received from the C function, and returns it in a Rust Result.
 unsafe fn ffi_eval_js_callback_result(
 	bw: *mut cbw_BrowserWindow,
@@ -5,6 +5,7 @@ use std::{
 	borrow::Cow,
 	error::Error,
 	fmt,
+	ops::{BitOr, Range},
 	time::SystemTime
 };
 
@@ -14,11 +15,51 @@ pub use c::*;
 
 pub type CookieStorageCallbackFn = unsafe fn( cj: CookieJarImpl, data: *mut (), Result<(), CookieStorageError> );
 pub type CookieDeleteCallbackFn = unsafe fn(cj: CookieJarImpl, data: *mut (), deleted: usize);
+pub type CookieStoreManyCallbackFn = unsafe fn(cj: CookieJarImpl, data: *mut (), stored: usize);
 pub type CookieIteratorNextCallbackFn = unsafe fn(cj: CookieIteratorImpl, data: *mut (), Option<CookieImpl>);
+pub type CookieIteratorNextBorrowedCallbackFn = unsafe fn(cj: CookieIteratorImpl, data: *mut (), cookie: Option<&CookieImpl>);
+pub type CookieCountCallbackFn = unsafe fn(cj: CookieJarImpl, data: *mut (), count: usize);
+
+/// Where the string fields of a cookie are located inside the buffer given to `CookieExt::append_fields`.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct CookieFieldRanges {
+	pub name: Range<usize>,
+	pub value: Range<usize>,
+	pub domain: Range<usize>,
+	pub path: Range<usize>
+}
+
+/// A set of cookie fields, which can be combined with `|`.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct CookieFields (pub(in crate) u8);
+
+/// Selects which cookies are visited, and which of their fields are copied.
+/// The predicates are checked before anything is copied, so cookies that don't match are cheap to skip.
+/// Empty strings and `None` match everything.
+#[derive(Clone, Debug)]
+pub struct CookieFilter<'a> {
+	/// Only cookies of which the domain ends with this, such that `example.com` also matches `.www.example.com`.
+	pub domain: &'a str,
+	/// Only cookies of which the path starts with this.
+	pub path: &'a str,
+	/// Only cookies with exactly this name.
+	pub name: &'a str,
+	/// Only cookies that expire at or after this time.
+	/// Session cookies never match when this is set.
+	pub expires_after: Option<SystemTime>,
+	/// Only cookies that expire before this time.
+	/// Session cookies never match when this is set.
+	pub expires_before: Option<SystemTime>,
+	/// The fields that are copied, the others are left empty.
+	pub fields: CookieFields
+}
 
 pub trait CookieExt {
 	fn new(name: &str, value: &str) -> CookieImpl;
 
+	/// Appends the name, value, domain and path to `buffer` in one go, without allocating a string per field.
+	fn append_fields(&self, buffer: &mut String) -> CookieFieldRanges;
+
 	fn creation_time(&self) -> SystemTime;
 	fn expires(&self) -> Option<SystemTime>;
 	fn domain<'a>(&'a self) -> Cow<'a, str>;
@@ -41,16 +82,28 @@ pub trait CookieExt {
 
 pub trait CookieJarExt {
 	fn delete(&mut self, url: &str, name: &str, complete_cb: CookieDeleteCallbackFn, cb_data: *mut ());
+	/// Deletes the cookies with any of the given names, and invokes the callback once with the total number of deleted cookies.
+	fn delete_many(&mut self, url: &str, names: &[&str], complete_cb: CookieDeleteCallbackFn, cb_data: *mut ());
 	fn free(&mut self);
 	fn global() -> CookieJarImpl;
 	fn iterator<'a>(&'a self, url: &str, include_http_only: bool) -> CookieIteratorImpl;
 	fn iterator_all<'a>(&'a self) -> CookieIteratorImpl;
+	/// Like `iterator`, but only visits the cookies that match `filter`.
+	/// If `url` is empty, the cookies of all urls are visited.
+	fn iterator_filtered<'a>(&'a self, url: &str, include_http_only: bool, filter: &CookieFilter) -> CookieIteratorImpl;
+	/// Counts the cookies that match `filter`, without copying any of them.
+	/// If `url` is empty, the cookies of all urls are counted.
+	fn count(&self, url: &str, include_http_only: bool, filter: &CookieFilter, complete_cb: CookieCountCallbackFn, cb_data: *mut ());
 	fn store(&mut self, url: &str, cookie: &CookieImpl, success_cb: Option<CookieStorageCallbackFn>, cb_data: *mut ());
+	/// Stores all given cookies, and invokes the callback once with the number of cookies that have been stored.
+	fn store_many(&mut self, url: &str, cookies: &[&CookieImpl], complete_cb: CookieStoreManyCallbackFn, cb_data: *mut ());
 }
 
 pub trait CookieIteratorExt {
 	fn free(&mut self);
 	fn next(&mut self, on_next: CookieIteratorNextCallbackFn, cb_data: *mut ()) -> bool;
+	/// Like `next`, but only lends the cookie to the callback, which saves copying it.
+	fn next_borrowed(&mut self, on_next: CookieIteratorNextBorrowedCallbackFn, cb_data: *mut ()) -> bool;
 }
 
 #[derive(Debug)]
@@ -60,6 +113,43 @@ pub enum CookieStorageError {
 
 
 
+impl CookieFields {
+	pub const NAME: Self = Self(0x01);
+	pub const VALUE: Self = Self(0x02);
+	pub const DOMAIN: Self = Self(0x04);
+	pub const PATH: Self = Self(0x08);
+	/// The creation and expiration times.
+	pub const TIMES: Self = Self(0x10);
+	/// Whether the cookie is secure and/or http-only.
+	pub const FLAGS: Self = Self(0x20);
+	pub const ALL: Self = Self(0xFF);
+}
+
+impl BitOr for CookieFields {
+	type Output = Self;
+
+	fn bitor(self, other: Self) -> Self {
+		Self(self.0 | other.0)
+	}
+}
+
+impl Default for CookieFields {
+	fn default() -> Self { Self::ALL }
+}
+
+impl<'a> Default for CookieFilter<'a> {
+	fn default() -> Self {
+		Self {
+			domain: "",
+			path: "",
+			name: "",
+			expires_after: None,
+			expires_before: None,
+			fields: CookieFields::ALL
+		}
+	}
+}
+
 impl fmt::Display for CookieStorageError {
 	fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
 		write!(f, "unable to set cookie (url invalid?)")
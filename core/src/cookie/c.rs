@@ -38,15 +38,57 @@ struct CookieDeleteCallbackData {
 	data: *mut ()
 }
 
+struct CookieStoreManyCallbackData {
+	callback: CookieStoreManyCallbackFn,
+	data: *mut ()
+}
+
+struct CookieCountCallbackData {
+	callback: CookieCountCallbackFn,
+	data: *mut ()
+}
+
 struct CookieIteratorNextCallbackData {
 	callback: CookieIteratorNextCallbackFn,
 	data: *mut ()
 }
 
+struct CookieIteratorNextBorrowedCallbackData {
+	callback: CookieIteratorNextBorrowedCallbackFn,
+	data: *mut ()
+}
+
 
 
 impl CookieExt for CookieImpl {
 
+	fn append_fields(&self, buffer: &mut String) -> CookieFieldRanges {
+		let mut strings: cbw_CookieStrings = unsafe { MaybeUninit::zeroed().assume_init() };
+		// The C side only writes valid UTF-8 into the spare capacity, and nothing at all if it doesn't fit.
+		let bytes = unsafe { buffer.as_mut_vec() };
+		let start = bytes.len();
+
+		let mut needed = unsafe { cbw_Cookie_getFieldsInto(self.inner, bytes.as_mut_ptr().add(start) as _, (bytes.capacity() - start) as _, &mut strings) } as usize;
+		if needed > bytes.capacity() - start {
+			bytes.reserve(needed);
+			needed = unsafe { cbw_Cookie_getFieldsInto(self.inner, bytes.as_mut_ptr().add(start) as _, (bytes.capacity() - start) as _, &mut strings) } as usize;
+		}
+		unsafe { bytes.set_len(start + needed) };
+
+		let base = bytes.as_ptr() as usize;
+		let range = |slice: cbw_CStrSlice| {
+			let offset = slice.data as usize - base;
+			offset .. offset + slice.len as usize
+		};
+
+		CookieFieldRanges {
+			name: range(strings.name),
+			value: range(strings.value),
+			domain: range(strings.domain),
+			path: range(strings.path)
+		}
+	}
+
 	fn creation_time(&self) -> SystemTime {
 		let timestamp = unsafe { cbw_Cookie_getCreationTime(self.inner) };
 
@@ -188,6 +230,17 @@ impl CookieJarExt for CookieJarImpl {
 		unsafe { cbw_CookieJar_delete(self.inner, url.into(), name.into(), Some(ffi_cookie_delete_callback_handler), data as _ ) };
 	}
 
+	fn delete_many(&mut self, url: &str, names: &[&str], complete_cb: CookieDeleteCallbackFn, cb_data: *mut ()) {
+		let data = Box::into_raw(Box::new(CookieDeleteCallbackData {
+			callback: complete_cb,
+			data: cb_data
+		}));
+
+		let c_names: Vec<cbw_CStrSlice> = names.iter().map(|n| (*n).into()).collect();
+
+		unsafe { cbw_CookieJar_deleteMany(self.inner, url.into(), c_names.as_ptr(), c_names.len() as _, Some(ffi_cookie_delete_callback_handler), data as _) };
+	}
+
 	fn free(&mut self) {
 		unsafe { cbw_CookieJar_free(self.inner) };
 	}
@@ -207,6 +260,26 @@ impl CookieJarExt for CookieJarImpl {
 		return iterator;
 	}
 
+	fn iterator_filtered<'a>(&'a self, url: &str, include_http_only: bool, filter: &CookieFilter) -> CookieIteratorImpl {
+		let c_filter = filter.to_c();
+
+		let mut iterator: CookieIteratorImpl = unsafe { MaybeUninit::uninit().assume_init() };
+		unsafe { cbw_CookieJar_iteratorFiltered(self.inner, &mut iterator.inner, if include_http_only {1} else {0}, url.into(), &c_filter) };
+
+		return iterator;
+	}
+
+	fn count(&self, url: &str, include_http_only: bool, filter: &CookieFilter, complete_cb: CookieCountCallbackFn, cb_data: *mut ()) {
+		let data = Box::into_raw(Box::new(CookieCountCallbackData {
+			callback: complete_cb,
+			data: cb_data
+		}));
+
+		let c_filter = filter.to_c();
+
+		unsafe { cbw_CookieJar_count(self.inner, if include_http_only {1} else {0}, url.into(), &c_filter, Some(ffi_cookie_count_callback_handler), data as _) };
+	}
+
 	fn iterator_all<'a>(&'a self) -> CookieIteratorImpl {
 		let mut iterator: CookieIteratorImpl = unsafe { MaybeUninit::uninit().assume_init() };
 		unsafe { cbw_CookieJar_iteratorAll(self.inner, &mut iterator.inner) };
@@ -241,6 +314,32 @@ impl CookieJarExt for CookieJarImpl {
 			cbw_Err_free(&mut error);
 		}
 	}
+
+	fn store_many(&mut self, url: &str, cookies: &[&CookieImpl], complete_cb: CookieStoreManyCallbackFn, cb_data: *mut ()) {
+		let data = Box::into_raw(Box::new(CookieStoreManyCallbackData {
+			callback: complete_cb,
+			data: cb_data
+		}));
+
+		let c_cookies: Vec<*const cbw_Cookie> = cookies.iter().map(|c| c.inner as *const _).collect();
+
+		unsafe { cbw_CookieJar_storeMany(self.inner, url.into(), c_cookies.as_ptr(), c_cookies.len() as _, Some(ffi_cookie_store_many_callback_handler), data as _) };
+	}
+}
+
+impl<'a> CookieFilter<'a> {
+	fn to_c(&self) -> cbw_CookieFilter {
+		let millis = |time: &Option<SystemTime>| time.map(|t| t.duration_since(SystemTime::UNIX_EPOCH).unwrap().as_millis() as u64).unwrap_or(0);
+
+		cbw_CookieFilter {
+			domain: self.domain.into(),
+			path: self.path.into(),
+			name: self.name.into(),
+			expires_after: millis(&self.expires_after),
+			expires_before: millis(&self.expires_before),
+			fields: self.fields.0
+		}
+	}
 }
 
 impl CookieIteratorExt for CookieIteratorImpl {
@@ -255,7 +354,28 @@ impl CookieIteratorExt for CookieIteratorImpl {
 		}));
 
 		let success = unsafe { cbw_CookieIterator_next(self.inner, Some(ffi_cookie_iterator_next_handler), data as _) };
-		
+
+		// The callback won't be invoked when there are no more cookies
+		if success == 0 {
+			drop(unsafe { Box::from_raw(data) });
+		}
+
+		return success > 0;
+	}
+
+	fn next_borrowed(&mut self, on_next: CookieIteratorNextBorrowedCallbackFn, cb_data: *mut ()) -> bool {
+		let data = Box::into_raw(Box::new(CookieIteratorNextBorrowedCallbackData {
+			callback: on_next,
+			data: cb_data
+		}));
+
+		let success = unsafe { cbw_CookieIterator_nextBorrowed(self.inner, Some(ffi_cookie_iterator_next_borrowed_handler), data as _) };
+
+		// The callback won't be invoked when there are no more cookies
+		if success == 0 {
+			drop(unsafe { Box::from_raw(data) });
+		}
+
 		return success > 0;
 	}
 }
@@ -289,6 +409,26 @@ unsafe extern "C" fn ffi_cookie_delete_callback_handler(cookie_jar: *mut cbw_Coo
 	(data.callback)( handle, data.data, deleted as _ );
 }
 
+unsafe extern "C" fn ffi_cookie_store_many_callback_handler(cookie_jar: *mut cbw_CookieJar, _data: *mut c_void, stored: csize_t) {
+
+	let data_ptr = _data as *mut CookieStoreManyCallbackData;
+	let data: Box<CookieStoreManyCallbackData> = Box::from_raw( data_ptr );
+
+	let handle = CookieJarImpl {inner: cookie_jar};
+
+	(data.callback)( handle, data.data, stored as _ );
+}
+
+unsafe extern "C" fn ffi_cookie_count_callback_handler(cookie_jar: *mut cbw_CookieJar, _data: *mut c_void, count: csize_t) {
+
+	let data_ptr = _data as *mut CookieCountCallbackData;
+	let data: Box<CookieCountCallbackData> = Box::from_raw( data_ptr );
+
+	let handle = CookieJarImpl {inner: cookie_jar};
+
+	(data.callback)( handle, data.data, count as _ );
+}
+
 unsafe extern "C" fn ffi_cookie_iterator_next_handler(cookie_iterator: *mut cbw_CookieIterator, _data: *mut c_void, _cookie: *mut cbw_Cookie) {
 	let data_ptr = _data as *mut CookieIteratorNextCallbackData;
 	let data: Box<CookieIteratorNextCallbackData> = Box::from_raw(data_ptr);
@@ -302,4 +442,15 @@ unsafe extern "C" fn ffi_cookie_iterator_next_handler(cookie_iterator: *mut cbw_
 	};
 
 	(data.callback)(handle, data.data, cookie);
+}
+
+unsafe extern "C" fn ffi_cookie_iterator_next_borrowed_handler(cookie_iterator: *mut cbw_CookieIterator, _data: *mut c_void, _cookie: *const cbw_Cookie) {
+	let data_ptr = _data as *mut CookieIteratorNextBorrowedCallbackData;
+	let data: Box<CookieIteratorNextBorrowedCallbackData> = Box::from_raw(data_ptr);
+
+	let handle = CookieIteratorImpl {inner: cookie_iterator};
+	// The cookie is not owned, so it must never be freed
+	let cookie = CookieImpl {inner: _cookie as *mut _};
+
+	(data.callback)(handle, data.data, if _cookie.is_null() { None } else { Some(&cookie) });
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+use browser_window_c::*;
+
+use std::slice;
+
+
+
+/// A JavaScript value, as it has been transferred from the browser without being converted into a string first.
+///
+/// Just like with JSON, `undefined` and functions turn into `Null` inside arrays, and are left out of objects.
+/// Only the value itself can be `Undefined`.
+#[derive(Clone, Debug, PartialEq)]
+pub enum JsValue {
+	Undefined,
+	Null,
+	Boolean( bool ),
+	Number( f64 ),
+	String( String ),
+	Array( Vec<JsValue> ),
+	/// The properties of the object, in the order that they were enumerated in.
+	Object( Vec<(String, JsValue)> ),
+	/// The contents of an `ArrayBuffer` or a typed array.
+	Binary( Vec<u8> )
+}
+
+
+
+impl JsValue {
+
+	/// Copies the contents of a `cbw_JsValue` into an owned `JsValue`.
+	#[allow(non_upper_case_globals)]
+	pub unsafe fn from_c( value: *const cbw_JsValue ) -> Self {
+		let value = &*value;
+
+		match value.type_ as u32 {
+			cBW_JS_VALUE_NULL => Self::Null,
+			cBW_JS_VALUE_BOOLEAN => Self::Boolean( value.boolean > 0 ),
+			cBW_JS_VALUE_NUMBER => Self::Number( value.number ),
+			cBW_JS_VALUE_STRING => Self::String( value.string.into() ),
+			cBW_JS_VALUE_ARRAY => Self::Array(
+				Self::items( value ).iter().map(|item| Self::from_c( item ) ).collect()
+			),
+			cBW_JS_VALUE_OBJECT => {
+				let keys: &[cbw_CStrSlice] = if value.item_count > 0 {
+					slice::from_raw_parts( value.keys, value.item_count as _ )
+				} else { &[] };
+
+				Self::Object(
+					keys.iter().zip( Self::items( value ).iter() )
+						.map(|(key, item)| ( (*key).into(), Self::from_c( item ) ) )
+						.collect()
+				)
+			},
+			cBW_JS_VALUE_BINARY => Self::Binary(
+				if value.string.len > 0 {
+					slice::from_raw_parts( value.string.data as *const u8, value.string.len as _ ).to_vec()
+				} else { Vec::new() }
+			),
+			_ => Self::Undefined
+		}
+	}
+
+	unsafe fn items<'a>( value: &'a cbw_JsValue ) -> &'a [cbw_JsValue] {
+		if value.item_count > 0 {
+			slice::from_raw_parts( value.items, value.item_count as _ )
+		}
+		else {
+			&[]
+		}
+	}
+}
@@ -2,5 +2,8 @@ pub mod application;
 pub mod browser_window;
 pub mod cookie;
 pub mod error;
+pub mod js_value;
+pub mod metrics;
 pub mod prelude;
+pub mod request_context;
 pub mod window;
\ No newline at end of file
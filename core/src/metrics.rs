@@ -0,0 +1,178 @@
+use browser_window_c::*;
+
+use std::time::Duration;
+
+
+
+/// A histogram of latencies, with buckets that are at most 12.5% apart, like an HDR histogram.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct LatencyHistogram {
+	/// The number of recorded latencies.
+	pub count: u64,
+	/// The sum of all recorded latencies.
+	pub sum: Duration,
+	/// The largest recorded latency.
+	pub max: Duration,
+	buckets: Vec<(Duration, u64)>
+}
+
+/// The latencies and message counters of the communication between a browser window and its renderer process.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct BrowserWindowMetrics {
+	/// From sending a script to the renderer process, until its result came back.
+	pub eval_js: LatencyHistogram,
+	/// The part of `eval_js` that the renderer process spent on evaluating the script and converting its result.
+	pub eval_js_execution: LatencyHistogram,
+	/// From receiving the message of an `invoke_extern` call, until its handler got invoked.
+	pub invoke: LatencyHistogram,
+	pub messages_sent: u64,
+	pub messages_received: u64,
+	/// The size of the scripts, strings and binary data carried by the sent messages.
+	pub bytes_sent: u64,
+	/// The size of the strings and binary data carried by the received messages.
+	/// Structured values are not counted.
+	pub bytes_received: u64,
+	/// The calls of `invoke_extern` that have been dropped or coalesced by the overflow policy of the invocation queue.
+	pub invocations_dropped: u64,
+	/// The number of calls of `invoke_extern` that are waiting for the GUI thread.
+	pub invoke_queue_depth: usize,
+	/// The largest `invoke_queue_depth` so far.
+	pub invoke_queue_peak: usize
+}
+
+/// The memory that a browser window is using, in bytes.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct BrowserWindowMemoryStats {
+	/// The number of evaluations and other calls into the renderer process of which the result hasn't come back yet.
+	pub pending_calls: usize,
+	/// The buffers of the coalesced scripts and the binary stream that are waiting to be sent.
+	pub queued_bytes: usize,
+	/// The responses cached by the request interceptor.
+	pub cached_response_bytes: usize,
+	/// The memory of the renderer process, if it has been measured.
+	pub renderer: Option<RendererMemoryStats>
+}
+
+/// The memory used by the renderer process of a browser window, in bytes.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct RendererMemoryStats {
+	/// The JavaScript heap as reported by `performance.memory`, which is rounded unless the engine runs with `--enable-precise-memory-info`.
+	/// These are 0 when the page doesn't have a JavaScript context.
+	pub js_heap_used: u64,
+	pub js_heap_total: u64,
+	pub js_heap_limit: u64,
+	/// The memory that only the renderer process uses.
+	/// Browser windows that share a renderer process report the same amount.
+	pub private_bytes: u64
+}
+
+/// The memory that the application is using in its own process, in bytes.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct ApplicationMemoryStats {
+	/// The number of browser windows, including the prewarmed ones.
+	pub browser_windows: usize,
+	/// The sums of those of all browser windows.
+	pub pending_calls: usize,
+	pub queued_bytes: usize,
+	pub cached_response_bytes: usize,
+	/// The number of dispatched functions that are waiting to be executed, without the delayed ones.
+	pub queued_dispatches: usize,
+	/// The memory that only this process uses.
+	pub process_private_bytes: u64
+}
+
+
+
+impl LatencyHistogram {
+
+	/// Copies the contents of a `cbw_LatencyHistogram`.
+	pub fn from_c( histogram: &cbw_LatencyHistogram ) -> Self {
+		let buckets = histogram.buckets.iter().enumerate()
+			.filter( |(_, count)| **count > 0 )
+			.map( |(index, count)| ( Duration::from_micros( unsafe { cbw_LatencyHistogram_bucketUpperBound( index as _ ) } ), *count ) )
+			.collect();
+
+		Self {
+			count: histogram.count,
+			sum: Duration::from_micros( histogram.sum ),
+			max: Duration::from_micros( histogram.max ),
+			buckets
+		}
+	}
+
+	/// The buckets that have latencies counted in them, as pairs of the largest latency that each bucket counts, and the number of latencies it counted.
+	/// They are ordered by their upper bound, so that they can be accumulated into the `le` buckets of a Prometheus histogram.
+	pub fn buckets( &self ) -> &[(Duration, u64)] {
+		&self.buckets
+	}
+
+	/// The average of all recorded latencies.
+	pub fn mean( &self ) -> Duration {
+		if self.count == 0 {
+			return Duration::ZERO
+		}
+		Duration::from_nanos( ( self.sum.as_nanos() / self.count as u128 ) as u64 )
+	}
+
+	/// The latency below which the given fraction of all recorded latencies lie, like 0.99 for the 99th percentile.
+	/// This is the upper bound of the bucket in which that latency has been counted, but never more than `max`.
+	pub fn percentile( &self, fraction: f64 ) -> Duration {
+		if self.count == 0 {
+			return Duration::ZERO
+		}
+
+		let rank = ( ( fraction * self.count as f64 ).round() as u64 ).clamp( 1, self.count );
+		let mut seen = 0;
+		for (bound, count) in &self.buckets {
+			seen += count;
+			if seen >= rank {
+				return (*bound).min( self.max )
+			}
+		}
+		self.max
+	}
+}
+
+impl BrowserWindowMetrics {
+
+	/// Copies the contents of a `cbw_BrowserWindowMetrics`.
+	pub fn from_c( metrics: &cbw_BrowserWindowMetrics ) -> Self {
+		Self {
+			eval_js: LatencyHistogram::from_c( &metrics.eval_js ),
+			eval_js_execution: LatencyHistogram::from_c( &metrics.eval_js_execution ),
+			invoke: LatencyHistogram::from_c( &metrics.invoke ),
+			messages_sent: metrics.messages_sent,
+			messages_received: metrics.messages_received,
+			bytes_sent: metrics.bytes_sent,
+			bytes_received: metrics.bytes_received,
+			invocations_dropped: metrics.invocations_dropped,
+			invoke_queue_depth: metrics.invoke_queue_depth as _,
+			invoke_queue_peak: metrics.invoke_queue_peak as _
+		}
+	}
+}
+
+impl BrowserWindowMemoryStats {
+
+	/// Copies the contents of a `cbw_BrowserWindowMemoryStats`.
+	pub fn from_c( stats: &cbw_BrowserWindowMemoryStats ) -> Self {
+		let renderer = if stats.renderer_measured != 0 {
+			Some( RendererMemoryStats {
+				js_heap_used: stats.js_heap_used,
+				js_heap_total: stats.js_heap_total,
+				js_heap_limit: stats.js_heap_limit,
+				private_bytes: stats.renderer_private_bytes
+			} )
+		}
+		else {
+			None
+		};
+
+		Self {
+			pending_calls: stats.pending_calls as _,
+			queued_bytes: stats.queued_bytes as _,
+			cached_response_bytes: stats.cached_response_bytes as _,
+			renderer
+		}
+	}
+}
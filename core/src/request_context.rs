@@ -0,0 +1,19 @@
+pub mod c;
+
+use crate::cookie::CookieJarImpl;
+
+pub use c::*;
+
+
+
+pub trait RequestContextExt {
+	/// Creates a new request context.
+	/// If `cache_path` is empty, nothing is stored on disk.
+	fn new(cache_path: &str) -> RequestContextImpl;
+
+	/// The cookie jar that only holds the cookies of this request context.
+	fn cookie_jar(&self) -> CookieJarImpl;
+	/// Creates another handle to the same request context.
+	fn copy(&self) -> RequestContextImpl;
+	fn free(&mut self);
+}
@@ -0,0 +1,45 @@
+use super::*;
+
+use browser_window_c::*;
+
+
+
+pub struct RequestContextImpl {
+	pub(in crate) inner: *mut cbw_RequestContext
+}
+
+
+
+impl RequestContextExt for RequestContextImpl {
+
+	fn new(cache_path: &str) -> RequestContextImpl {
+		let options = cbw_RequestContextOptions {
+			cache_path: cache_path.into()
+		};
+		let inner = unsafe { cbw_RequestContext_new(&options) };
+
+		RequestContextImpl {
+			inner
+		}
+	}
+
+	fn cookie_jar(&self) -> CookieJarImpl {
+		let inner = unsafe { cbw_RequestContext_getCookieJar(self.inner) };
+
+		CookieJarImpl {
+			inner
+		}
+	}
+
+	fn copy(&self) -> RequestContextImpl {
+		let inner = unsafe { cbw_RequestContext_copy(self.inner) };
+
+		RequestContextImpl {
+			inner
+		}
+	}
+
+	fn free(&mut self) {
+		unsafe { cbw_RequestContext_free(self.inner) };
+	}
+}
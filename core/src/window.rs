@@ -29,4 +29,18 @@ pub trait WindowExt: Copy + Default {
 	fn show( &self );
 }
 
+/// Decides when the content of a window is throttled because the user can't see it.
+/// Throttled browsers stop rendering and run their timers at a reduced rate, which saves CPU and GPU time.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum WindowThrottling {
+	/// The content keeps running at full rate, even when no one is looking at it.
+	/// Use this for content that needs to keep animating or playing in the background.
+	Never,
+	/// The content is throttled while the window is hidden or minimized.
+	Hidden,
+	/// Like `Hidden`, but the content is also throttled while the window is completely covered by other windows.
+	/// Only some platforms report this, the others behave like `Hidden`.
+	Occluded
+}
+
 pub type WindowOptions = cbw_WindowOptions;
\ No newline at end of file
@@ -3,7 +3,8 @@
 
 use super::{
 	WindowExt,
-	WindowOptions
+	WindowOptions,
+	WindowThrottling
 };
 
 use crate::{
@@ -25,6 +26,18 @@ pub struct WindowImpl {
 
 
 
+impl WindowThrottling {
+
+	/// The value of the `throttling` field of `WindowOptions`.
+	pub fn to_c( self ) -> u8 {
+		(match self {
+			Self::Never => cBW_WINDOW_THROTTLE_NEVER,
+			Self::Hidden => cBW_WINDOW_THROTTLE_HIDDEN,
+			Self::Occluded => cBW_WINDOW_THROTTLE_OCCLUDED
+		}) as _
+	}
+}
+
 impl WindowImpl {
 
 	pub fn new(
@@ -112,6 +112,9 @@ fn main() {
 		bw.opacity().set(224);
 		bw.show();
 
+		// Command output is sent to the page in a lot of small pieces, so let them be executed in bulk.
+		bw.set_js_coalescing( Some(0) );
+
 		// Initialize the script with our working directory.
 		// Make sure that it is initializes whether document has been loaded already or not.
 		let working_dir_js = serde_json::to_string( working_dir.to_str().unwrap() ).expect("Invalid working directory characters!");
@@ -70,27 +70,39 @@ fn main() {
 
 
 
+use std::borrow::Cow;
 use std::env;
 use std::ffi::{CString};
 use std::future::Future;
 #[cfg(feature = "threadsafe")]
 use std::ops::Deref;
 use std::os::raw::{c_int};
+use std::cell::{Cell, RefCell};
+use std::collections::{HashMap, VecDeque};
+use std::mem;
 use std::pin::Pin;
 use std::ptr;
+use std::sync::{Arc, Mutex};
+use std::sync::atomic::{AtomicBool, Ordering};
 use std::task::{Context, Poll, Waker, RawWaker, RawWakerVTable};
+use std::path::Path;
 use std::time::Duration;
 
 use browser_window_core::application::*;
 use futures_channel::oneshot;
 use lazy_static::lazy_static;
 
-pub use browser_window_core::application::ApplicationSettings;
+pub use browser_window_core::application::{ApplicationSettings, DispatchPriority, MemoryPressure, StartupMetrics};
+pub use browser_window_core::metrics::{ApplicationMemoryStats, LatencyHistogram};
 
+use browser_window_core::browser_window::{BrowserWindowExt, BrowserWindowImpl};
+
+use crate::browser::BrowserWindowHandle;
 use crate::cookie::CookieJar;
+use crate::request_context::RequestContext;
 #[cfg(feature = "threadsafe")]
 use crate::delegate::*;
-use crate::error;
+use crate::error::{self, CbwResult};
 
 
 /// Use this to initialize and start your application with.
@@ -145,10 +157,29 @@ pub struct Runtime {
 	pub(in super) handle: ApplicationHandle
 }
 
-/// The data that is available to a waker, allowing it to poll a future.
-struct WakerData<'a> {
-	handle: ApplicationHandle,
-	future: Pin<Box<dyn Future<Output=()> + 'a>>
+/// A future that has been spawned on the runtime.
+/// Tasks never leave the GUI thread, their wakers only post the task's id back to it.
+struct Task {
+	future: Pin<Box<dyn Future<Output=()>>>,
+	waker: Arc<TaskWaker>
+}
+
+/// The part of a task that is shared by all of its wakers.
+struct TaskWaker {
+	app: ApplicationImpl,
+	id: u64,
+	/// Whether the task is in the run queue already, so that multiple wakes only cause one poll.
+	scheduled: AtomicBool
+}
+// The application is only used to dispatch to the GUI thread, which is thread-safe.
+unsafe impl Send for TaskWaker {}
+unsafe impl Sync for TaskWaker {}
+
+/// The ids of the tasks that have been woken up and are waiting to be polled on the GUI thread.
+struct RunQueue {
+	tasks: VecDeque<u64>,
+	/// Whether a dispatch is underway that will drain the queue.
+	dispatched: bool
 }
 
 
@@ -160,6 +191,11 @@ pub type ApplicationDelegateFuture<'a,R> = DelegateFuture<'a, ApplicationHandle,
 
 
 lazy_static! {
+	static ref RUN_QUEUE: Mutex<RunQueue> = Mutex::new( RunQueue {
+		tasks: VecDeque::new(),
+		dispatched: false
+	} );
+
 	static ref WAKER_VTABLE: RawWakerVTable = {
 		RawWakerVTable::new(
 			waker_clone,
@@ -170,6 +206,13 @@ lazy_static! {
 	};
 }
 
+thread_local! {
+	/// The tasks that have not completed yet, by their id.
+	/// Only the GUI thread ever has any.
+	static TASKS: RefCell<HashMap<u64, Task>> = RefCell::new( HashMap::new() );
+	static NEXT_TASK_ID: Cell<u64> = Cell::new( 0 );
+}
+
 
 
 impl Application {
@@ -200,6 +243,15 @@ impl Application {
 	/// Call this if you are using `exit` or doing something else to kill the process.
 	pub fn finish( self ) {}
 
+	/// Same as `finish`, but for when the process is about to exit anyway, like when a service restarts.
+	/// All browser windows are closed at once, without waiting for their pages and without cleaning up after them.
+	/// Only the cookies are written to disk, and the browser engine gets no more than `timeout` to shut down, after which its shutdown is skipped.
+	pub fn finish_fast( self, timeout: Duration ) {
+		self.handle.inner.finish_fast( timeout );
+		// Dropping the application would finish it again
+		mem::forget( self );
+	}
+
 	/// In order to use the Browser Window API, you need to initialize Browser Window at the very start of your application.
 	/// Preferably on the first line of your `main` function.
 	///
@@ -239,33 +291,77 @@ impl Drop for Application {
 
 impl Runtime {
 
-	/// Polls a future given a pointer to the waker data.
-	unsafe fn poll_future( data: *mut WakerData ) {
-		debug_assert!( data != ptr::null_mut(), "WakerData pointer can't be zero!" );
+	/// Polls the task with the given id, unless it has already completed.
+	/// This must be called on the GUI thread.
+	fn poll_task( id: u64 ) {
+
+		// The task is taken out while it is being polled, so that its future can spawn other tasks
+		let mut task = match TASKS.with(|tasks| tasks.borrow_mut().remove( &id ) ) {
+			None => return,
+			Some( task ) => task
+		};
 
-		// TODO: Test if polling from the right thread
+		// Wakes that happen from now on need to schedule the task again
+		task.waker.scheduled.store( false, Ordering::Release );
 
-		let waker = Self::new_waker( data );
+		let waker = Self::new_waker( &task.waker );
 		let mut ctx = Context::from_waker( &waker );
 
-		let result = (*data).future.as_mut().poll( &mut ctx );
+		// When the future is ready, it is dropped, even though wakers may still exist
+		if let Poll::Pending = task.future.as_mut().poll( &mut ctx ) {
+			TASKS.with(|tasks| tasks.borrow_mut().insert( id, task ) );
+		}
+	}
 
-		// When the future is ready, free the memory allocated for the waker data
-		match result {
-			Poll::Ready(_) => {
-				Box::from_raw( data );
-			},
-			Poll::Pending => {}
+	/// Polls all tasks that are in the run queue, including those that get woken up in the meantime.
+	/// This must be called on the GUI thread.
+	fn run_tasks() {
+		loop {
+			let id = {
+				let mut queue = RUN_QUEUE.lock().unwrap();
+				match queue.tasks.pop_front() {
+					Some( id ) => id,
+					None => {
+						queue.dispatched = false;
+						return
+					}
+				}
+			};
+
+			Self::poll_task( id );
 		}
 	}
 
-	/// Constructs a `Waker` for our runtime
-	unsafe fn new_waker( data: *mut WakerData ) -> Waker {
-		debug_assert!( data != ptr::null_mut(), "WakerData pointer can't be zero!" );
+	/// Constructs a `Waker` for our runtime, which holds a reference to the task's shared part
+	fn new_waker( task_waker: &Arc<TaskWaker> ) -> Waker {
+		unsafe { Waker::from_raw(
+			RawWaker::new( Arc::into_raw( task_waker.clone() ) as _, &WAKER_VTABLE )
+		) }
+	}
 
-		Waker::from_raw(
-			RawWaker::new( data as _, &WAKER_VTABLE )
-		)
+	/// Creates a task for the future, and polls it for the first time.
+	/// This must be called on the GUI thread.
+	fn spawn_task<F>( handle: ApplicationHandle, future: F ) where
+		F: Future<Output=()> + 'static
+	{
+		let id = NEXT_TASK_ID.with(|next_id| {
+			let id = next_id.get();
+			next_id.set( id + 1 );
+			id
+		});
+
+		let task = Task {
+			future: Box::pin( future ),
+			waker: Arc::new( TaskWaker {
+				app: handle.inner,
+				id,
+				scheduled: AtomicBool::new( false )
+			} )
+		};
+		TASKS.with(|tasks| tasks.borrow_mut().insert( id, task ) );
+
+		// First poll
+		Runtime::poll_task( id );
 	}
 
 	/// Run the main loop and executes the given closure on it.
@@ -294,13 +390,13 @@ impl Runtime {
 	///
 	/// # Reserved Codes
 	/// The same reserved codes apply as `run`.
-	pub fn run_async<'a,C,F>( &'a self, func: C ) -> i32 where
-		C: FnOnce( ApplicationHandle ) -> F + 'a,
-		F: Future<Output=()> + 'a
+	pub fn run_async<C,F>( &self, func: C ) -> i32 where
+		C: FnOnce( ApplicationHandle ) -> F + 'static,
+		F: Future<Output=()> + 'static
 	{
 		self._run(|handle| {
 
-			self.spawn( async move {
+			handle.spawn( async move {
 				func( handle.clone() ).await;
 				handle.inner.mark_as_done();
 			} );
@@ -308,19 +404,10 @@ impl Runtime {
 	}
 
 	/// Use `run_async` instead.
-	pub fn spawn<'a,F>( &'a self, future: F ) where
-		F: Future<Output=()> + 'a
+	pub fn spawn<F>( &self, future: F ) where
+		F: Future<Output=()> + 'static
 	{
-		// Data for the waker.
-		let waker_data = Box::into_raw( Box::new(
-			WakerData {
-				handle: self.handle.clone(),
-				future: Box::pin( future )
-			}
-		) );
-
-		// First poll
-		unsafe { Runtime::poll_future( waker_data ) };
+		Runtime::spawn_task( self.handle.clone(), future );
 	}
 
 	fn _run<'a,H>( &self, on_ready: H ) -> i32 where
@@ -356,10 +443,110 @@ impl From<ApplicationHandle> for Application {
 
 impl ApplicationHandle {
 
+	/// Executes `js` and posts `data` in every browser window of the application for which `filter` returns `true`.
+	/// The page receives `data` like it receives the data of `BrowserWindowHandle::post_binary`, and either of them is left out if it is empty.
+	///
+	/// This converts the script and copies the data only once, instead of doing it for every browser window like `exec_js` and `post_binary` would.
+	/// Returns the number of browser windows that it has been sent to.
+	pub fn broadcast<F>( &self, js: &str, data: &[u8], mut filter: F ) -> usize where
+		F: FnMut(&BrowserWindowHandle) -> bool
+	{
+		let filter_ptr = &mut filter as *mut F;
+		BrowserWindowImpl::broadcast( self.inner, js, data, Some( (broadcast_filter::<F>, filter_ptr as _) ) )
+	}
+
 	pub fn cookie_jar(&self) -> CookieJar {
 		CookieJar::global()
 	}
 
+	/// Returns the memory that the application uses in this process, summed over all browser windows.
+	/// The memory of the renderer processes is measured per browser window, with `BrowserWindowHandle::memory_stats`.
+	pub fn memory_stats( &self ) -> ApplicationMemoryStats {
+		self.inner.memory_stats()
+	}
+
+	/// Creates a new isolated browsing session, that can be given to [`BrowserWindowBuilder::request_context`](../browser/struct.BrowserWindowBuilder.html#method.request_context).
+	/// If `cache_path` is `None`, nothing is stored on disk, and the session is gone once the request context and all browser windows using it are dropped.
+	pub fn new_request_context(&self, cache_path: Option<&Path>) -> RequestContext {
+		let path = cache_path.map(|p| p.to_string_lossy().into_owned()).unwrap_or_default();
+		RequestContext::new(&path)
+	}
+
+	/// Serves the files inside `directory` at `app://<host>/`, e.g. `app://bundle/index.html` for `<directory>/index.html` with host `bundle`.
+	/// The files are memory mapped instead of being read on every request.
+	pub fn mount_resource_dir( &self, host: &str, directory: &Path ) {
+		self.inner.mount_resource_dir( host, directory );
+	}
+
+	/// Serves `data` at `app://<path>`, where `path` starts with the host, like `bundle/index.html`.
+	/// Static data, like that of `include_bytes!`, is served without ever being copied.
+	/// If `mime_type` is empty, it is derived from the extension of the path.
+	pub fn register_resource<D>( &self, path: &str, data: D, mime_type: &str ) where
+		D: Into<Cow<'static, [u8]>>
+	{
+		self.inner.register_resource( path, data.into(), mime_type );
+	}
+
+	/// Starts recording a trace of what browser window does internally, like executing dispatched work, creating browsers and evaluating javascript.
+	/// Every thread keeps its last `capacity` events, so that a long recording doesn't need an ever growing amount of memory.
+	///
+	/// If `engine_categories` is not empty, the browser engine records a trace of the given comma separated categories as well, like `"toplevel,ipc,v8"`.
+	/// Both traces are merged into one when tracing is stopped with `stop_tracing`.
+	pub fn start_tracing( &self, capacity: usize, engine_categories: &str ) {
+		self.inner.start_tracing( capacity, engine_categories );
+	}
+
+	/// Returns how long it took to reach each phase of the startup of the application.
+	/// Phases that haven't been reached yet are `None`, so the later ones only fill in once a browser window has been created and loaded.
+	pub fn startup_metrics( &self ) -> StartupMetrics {
+		self.inner.startup_metrics()
+	}
+
+	/// Stops the trace that has been started with `start_tracing`, and writes it to a file at `path` in Chrome's trace event format.
+	/// The file can be opened in `chrome://tracing` or Perfetto.
+	/// Completes once the file has been written, which may take a moment when the browser engine has been tracing as well.
+	pub async fn stop_tracing( &self, path: &Path ) -> error::Result<()> {
+		let (tx, rx) = oneshot::channel::<CbwResult<()>>();
+
+		let data_ptr = Box::into_raw( Box::new( tx ) );
+		self.inner.stop_tracing( path, stop_tracing_callback, data_ptr as _ );
+
+		Ok( rx.await.unwrap()? )
+	}
+
+	/// Starts the browser engine, if its startup has been postponed with `ApplicationSettings::lazy_engine`.
+	/// The first browser window, request context or cookie jar starts it anyway, but a window can be shown faster by warming the engine up once it is on screen, with a dispatch of `DispatchPriority::Idle`.
+	/// Does nothing if the engine has been started already.
+	pub fn start_engine( &self ) {
+		self.inner.start_engine();
+	}
+
+	/// Releases the memory that can be done without: the response caches and script buffers of all browser windows are emptied, and their pages are asked to release memory through their `on_memory_pressure` function.
+	/// At `MemoryPressure::Critical`, the prewarmed browser windows are destroyed as well.
+	///
+	/// This already happens by itself when the operating system signals that memory is running low.
+	pub fn trim_memory( &self, level: MemoryPressure ) {
+		self.inner.trim_memory( level );
+	}
+
+	/// Stops serving the resource that has been registered at the given path.
+	/// Returns `false` if there was none.
+	pub fn unregister_resource( &self, path: &str ) -> bool {
+		self.inner.unregister_resource( path )
+	}
+
+	/// Writes the startup phases that have been reached so far to a file at `path`, in Chromium's trace event format.
+	/// The file can be opened in `chrome://tracing` or Perfetto, to see where the startup time is spent.
+	pub fn write_startup_trace( &self, path: &Path ) -> error::Result<()> {
+		Ok( self.inner.write_startup_trace( path )? )
+	}
+
+	/// Returns how long work that has been dispatched to the GUI thread with the given priority, had to wait before it got executed.
+	/// Work that is dispatched with a delay is not included.
+	pub fn dispatch_latencies( &self, priority: DispatchPriority ) -> LatencyHistogram {
+		self.inner.dispatch_latencies( priority )
+	}
+
 	/// Causes the `Runtime` to terminate.
 	/// The `Runtime`'s [`Runtime::run`] or spawn command will return the exit code provided.
 	/// This will mean that not all tasks might complete.
@@ -386,16 +573,7 @@ impl ApplicationHandle {
 	pub fn spawn<F>( &self, future: F ) where
 		F: Future<Output=()> + 'static
 	{
-		// Data for the waker.
-		let waker_data = Box::into_raw( Box::new(
-			WakerData {
-				handle: self.clone(),
-				future: Box::pin( future )
-			}
-		) );
-
-		// First poll
-		unsafe { Runtime::poll_future( waker_data ) };
+		Runtime::spawn_task( self.clone(), future );
 	}
 
 	/// Queues the given closure `func` to be executed on the GUI thread somewhere in the future, at least after the given delay.
@@ -536,6 +714,19 @@ impl ApplicationHandleThreaded {
 		self.handle.inner.dispatch( dispatch_handler_send, data_ptr as _ )
 	}
 
+	/// Same as `dispatch`, but the closure is executed before or after other dispatched work, depending on `priority`.
+	/// Closures with `DispatchPriority::Idle` only execute when the GUI thread has no other events to process.
+	pub fn dispatch_with_priority<'a,F>( &self, func: F, priority: DispatchPriority ) -> bool where
+		F:  FnOnce( ApplicationHandle ) + Send + 'a
+	{
+		let data_ptr = Box::into_raw( Box::new( ApplicationDispatchSendData {
+			handle: self.handle,
+			func: Box::new( func )
+		} ) );
+
+		self.handle.inner.dispatch_with_priority( dispatch_handler_send, data_ptr as _, priority )
+	}
+
 	/// Queues the given closure `func` to be executed on the GUI thread somewhere in the future, at least after the given delay.
 	/// The closure will only execute when and if the runtime is still running.
 	/// Returns whether or not the closure will be able to execute.
@@ -633,6 +824,22 @@ unsafe fn dispatch_handler_send( _app: ApplicationImpl, _data: *mut () ) {
 	(data.func)( data.handle.into() );
 }
 
+/// Sends the result of writing a trace through the oneshot channel given as the callback data.
+unsafe fn stop_tracing_callback( _app: ApplicationImpl, data: *mut (), result: CbwResult<()> ) {
+	let tx = Box::from_raw( data as *mut oneshot::Sender<CbwResult<()>> );
+
+	// The future may have been dropped already
+	let _ = tx.send( result );
+}
+
+/// Invokes the filter of `broadcast`, which is borrowed for the duration of the call.
+unsafe fn broadcast_filter<F>( handle: BrowserWindowImpl, data: *mut () ) -> bool where
+	F: FnMut(&BrowserWindowHandle) -> bool
+{
+	let filter = &mut *(data as *mut F);
+	filter( &BrowserWindowHandle::new( handle ) )
+}
+
 /// The handler that is invoked when the runtime is deemed 'ready'.
 unsafe fn ready_handler<H>( handle: ApplicationImpl, user_data: *mut () ) where
 	H: FnOnce( ApplicationHandle )
@@ -643,26 +850,45 @@ unsafe fn ready_handler<H>( handle: ApplicationImpl, user_data: *mut () ) where
 	closure( app );
 }
 
-/// A handler that is invoked by wakers.
-unsafe fn wakeup_handler( _app: ApplicationImpl, user_data: *mut () ) {
-
-	let	data = user_data as *mut WakerData;
-
-	Runtime::poll_future( data );
+/// A handler that is dispatched by wakers, which polls all woken up tasks at once.
+unsafe fn wakeup_handler( _app: ApplicationImpl, _user_data: *mut () ) {
+	Runtime::run_tasks();
 }
 
 unsafe fn waker_clone( data: *const () ) -> RawWaker {
-	RawWaker::new( data, &WAKER_VTABLE )
+	let task_waker = mem::ManuallyDrop::new( Arc::from_raw( data as *const TaskWaker ) );
+
+	RawWaker::new( Arc::into_raw( (*task_waker).clone() ) as _, &WAKER_VTABLE )
 }
 
 unsafe fn waker_wake( data: *const () ) {
-	let data_ptr = data as *const WakerData;
-
-	(*data_ptr).handle.inner.dispatch( wakeup_handler, data_ptr as _ );
+	waker_wake_by_ref( data );
+	waker_drop( data );
 }
 
 unsafe fn waker_wake_by_ref( data: *const () ) {
-	waker_wake( data );
+	let task_waker = &*(data as *const TaskWaker);
+
+	// A task that is already scheduled will be polled anyway
+	if task_waker.scheduled.swap( true, Ordering::AcqRel ) {
+		return
+	}
+
+	// Only the first task that goes into the queue needs to dispatch the handler that drains it
+	let needs_dispatch = {
+		let mut queue = RUN_QUEUE.lock().unwrap();
+		queue.tasks.push_back( task_waker.id );
+		!mem::replace( &mut queue.dispatched, true )
+	};
+
+	if needs_dispatch {
+		// If the runtime isn't running anymore, the tasks are never polled anyway, but let the next wake try again
+		if !task_waker.app.dispatch( wakeup_handler, ptr::null_mut() ) {
+			RUN_QUEUE.lock().unwrap().dispatched = false;
+		}
+	}
 }
 
-fn waker_drop( _data: *const () ) {}
+unsafe fn waker_drop( data: *const () ) {
+	drop( Arc::from_raw( data as *const TaskWaker ) );
+}
@@ -10,20 +10,25 @@ use std::{
 	future::Future,
 	marker::PhantomData,
 	ops::Deref,
-	rc::Rc
+	pin::Pin,
+	rc::Rc,
+	task::{Context, Poll},
+	time::Duration
 };
 
 use crate::application::*;
 #[cfg(feature = "threadsafe")]
 use crate::delegate::*;
+use crate::event::Event;
 use crate::window::*;
 
-use browser_window_core::browser_window::{BrowserWindowExt, BrowserWindowImpl, JsEvaluationError};
+use browser_window_core::application::ApplicationImpl;
+use browser_window_core::browser_window::{BrowserWindowExt, BrowserWindowId, BrowserWindowImpl, EvalJsCallbackFn};
+pub use browser_window_core::browser_window::{DirtyRect, InterceptedRequest, Invocation, InterceptedResponse, InvokeOverflow, JsEvaluationError, PaintedFrame, SharedTextureFrame};
+pub use browser_window_core::js_value::JsValue;
+pub use browser_window_core::metrics::{BrowserWindowMemoryStats, BrowserWindowMetrics, RendererMemoryStats};
 use browser_window_core::window::WindowExt;
 
-#[cfg(feature = "threadsafe")]
-use unsafe_send_sync::UnsafeSend;
-
 
 
 mod builder;
@@ -32,9 +37,12 @@ pub use builder::{BrowserWindowBuilder, Source};
 
 
 
-/// The future that dispatches a closure on the GUI thread.
+/// The future that executes a closure with a browser window on the GUI thread, see `BrowserWindowThreaded::delegate`.
+/// It fails with `DelegateError::BrowserWindowClosed` if the browser window has been closed before the closure could be executed.
 #[cfg(feature = "threadsafe")]
-pub type BrowserDelegateFuture<'a,R> = DelegateFuture<'a, BrowserWindowHandle, R>;
+pub struct BrowserDelegateFuture<'a,R> {
+	inner: Pin<Box<dyn Future<Output=Result<Option<R>, DelegateError>> + Send + 'a>>
+}
 
 
 
@@ -68,22 +76,46 @@ pub struct BrowserWindow {
 ///
 ///     let bw: BrowserWindowThreaded = builder.build_threaded( app ).await.unwrap();
 /// 
-///     // Waits for `eval_js` to give back its result from the GUI thread
-///     let result = bw.delegate_async( |handle| async move {
-///         // Execute `eval_js` on the GUI thread
-///         handle.eval_js("document.cookies").await
-///     } ).await.unwrap();
-///
-///     result.unwrap()
+///     // Executes `eval_js` straight from this thread, without delegating it to the GUI thread
+///     bw.eval_js("document.cookies").await.unwrap()
 /// }
 /// ```
+///
+/// The browser window is referred to by its id, and looked up on the GUI thread whenever it is needed.
+/// So once the browser window has been closed, delegating to it fails with `DelegateError::BrowserWindowClosed`.
 #[cfg(feature = "threadsafe")]
 pub struct BrowserWindowThreaded {
-	pub(in super) handle: BrowserWindowHandle
+	app: ApplicationImpl,
+	id: BrowserWindowId
 }
 #[cfg(feature = "threadsafe")]
+unsafe impl Send for BrowserWindowThreaded {}
+#[cfg(feature = "threadsafe")]
 unsafe impl Sync for BrowserWindowThreaded {}
 
+/// The future returned by `BrowserWindowHandle::eval_js_with_timeout`.
+///
+/// Dropping it before it has completed cancels the evaluation, so that nothing is left waiting on a script that never finishes.
+pub struct EvalJsFuture {
+	handle: BrowserWindowHandle,
+	id: u64,
+	completed: bool,
+	rx: oneshot::Receiver<Result<String, JsEvaluationError>>
+}
+
+/// Settles the promise that a call of `invoke_native` has returned in JavaScript.
+/// It is given to the handler set with `BrowserWindowBuilder::async_native_handler`.
+///
+/// Dropping it without replying rejects the promise, so that the page is never left waiting.
+/// Replying does nothing once the browser window has been closed.
+pub struct InvocationReply {
+	// The browser window is looked up when replying, because it may have been closed by then
+	app: ApplicationImpl,
+	bw_id: BrowserWindowId,
+	request_id: u32,
+	replied: bool
+}
+
 /// This is a handle to an existing browser window.
 #[derive(Clone, Copy)]
 pub struct BrowserWindowHandle {
@@ -95,6 +127,47 @@ pub trait OwnedBrowserWindow: OwnedWindow {
 	fn browser_handle( &self ) -> BrowserWindowHandle;
 }
 
+pub type StandardBrowserWindowEvent = Event<'static, BrowserWindowHandle>;
+
+/// The events of the page of a browser window, which are registered with the builder.
+#[derive(Default)]
+pub(in crate) struct BrowserWindowEvents {
+	pub on_load_start: StandardBrowserWindowEvent,
+	pub on_load_end: Event<'static, LoadEndEventArgs>,
+	pub on_url_change: Event<'static, UrlChangeEventArgs>,
+	pub on_title_change: Event<'static, TitleChangeEventArgs>,
+	pub on_progress: Event<'static, ProgressEventArgs>
+}
+
+impl BrowserWindowEvents {
+
+	fn is_empty( &self ) -> bool {
+		self.on_load_start.is_empty() && self.on_load_end.is_empty() && self.on_url_change.is_empty() && self.on_title_change.is_empty() && self.on_progress.is_empty()
+	}
+}
+
+pub struct LoadEndEventArgs {
+	pub handle: BrowserWindowHandle,
+	/// The HTTP status code of the page, which is 0 for pages that don't come from HTTP.
+	pub http_status: i32
+}
+
+pub struct UrlChangeEventArgs {
+	pub handle: BrowserWindowHandle,
+	pub url: String
+}
+
+pub struct TitleChangeEventArgs {
+	pub handle: BrowserWindowHandle,
+	pub title: String
+}
+
+pub struct ProgressEventArgs {
+	pub handle: BrowserWindowHandle,
+	/// Goes from 0 to 1.
+	pub progress: f64
+}
+
 
 
 impl BrowserWindow {
@@ -157,17 +230,74 @@ impl BrowserWindowHandle {
 
 		self._eval_js( js, |_, result| {
 
-			// The callback of `_eval_js` is not necessarily called from our GUI thread, so this is a quickfix to make that safe.
-			// Otherwise, the `panic` may not be propegated correctly!
-			// FIXME: Call this result callback closure form the GUI thread from within the CEF implementation.
-			if let Err(_) = tx.send( result ) {
-				panic!("Unable to send JavaScript result back")
-			}
+			// The future may have been dropped already
+			let _ = tx.send( result );
 		} );
 
 		rx.await.unwrap()
 	}
 
+	/// Like `eval_js`, but gives up when the result takes longer than `timeout`.
+	/// In that case, the error's `is_timed_out` returns true.
+	///
+	/// The evaluation can also be cancelled with `EvalJsFuture::cancel`, or by dropping the future.
+	/// A result that still arrives afterwards is dropped without being converted.
+	pub fn eval_js_with_timeout( &self, js: &str, timeout: Option<Duration> ) -> EvalJsFuture {
+		let (tx, rx) = oneshot::channel::<Result<String, JsEvaluationError>>();
+
+		// A timeout of 0 milliseconds would mean no timeout at all
+		let timeout_ms = match timeout {
+			None => 0,
+			Some( t ) => t.as_millis().max( 1 ).min( u32::MAX as u128 ) as u32
+		};
+
+		let data_ptr = Box::into_raw( Box::new( tx ) );
+		let id = self.inner.eval_js_with_timeout( js, timeout_ms, eval_js_channel_callback, data_ptr as _ );
+
+		EvalJsFuture {
+			handle: self.clone(),
+			id,
+			completed: false,
+			rx
+		}
+	}
+
+	/// Executes all given pieces of javascript code at once, and returns their outputs in the same order.
+	/// This only takes one round trip to the browser engine, instead of one per script.
+	pub async fn eval_js_batch( &self, scripts: &[&str] ) -> Vec<Result<String, JsEvaluationError>> {
+		if scripts.len() == 0 {
+			return Vec::new();
+		}
+
+		let mut receivers = Vec::with_capacity( scripts.len() );
+		let mut callbacks = Vec::with_capacity( scripts.len() );
+		for _ in 0..scripts.len() {
+			let (tx, rx) = oneshot::channel::<Result<String, JsEvaluationError>>();
+			receivers.push( rx );
+			callbacks.push( ( eval_js_channel_callback as EvalJsCallbackFn, Box::into_raw( Box::new( tx ) ) as *mut () ) );
+		}
+
+		self.inner.eval_js_batch( scripts, &callbacks );
+
+		let mut results = Vec::with_capacity( receivers.len() );
+		for rx in receivers {
+			results.push( rx.await.unwrap() );
+		}
+		results
+	}
+
+	/// Executes the given javascript code and returns the output as a `JsValue`.
+	/// Arrays and objects are transferred as they are, so there is no need to `JSON.stringify` them and parse the result.
+	/// Like with `JSON.stringify`, a result that contains a cyclic structure is an error.
+	pub async fn eval_js_value( &self, js: &str ) -> Result<JsValue, JsEvaluationError> {
+		let (tx, rx) = oneshot::channel::<Result<JsValue, JsEvaluationError>>();
+
+		let data_ptr = Box::into_raw( Box::new( tx ) );
+		self.inner.eval_js_structured( js, eval_js_structured_callback, data_ptr as _ );
+
+		rx.await.unwrap()
+	}
+
 	/// Executes the given JavaScript code, and provides the output via a callback.
 	///
 	/// # Arguments
@@ -183,8 +313,200 @@ impl BrowserWindowHandle {
 	}
 
 	/// Executes the given javascript code without waiting on it to finish.
+	/// If coalescing is enabled with `set_js_coalescing`, the code might be executed at a later moment.
 	pub fn exec_js( &self, js: &str ) {
-		self._eval_js( js, |_,_|{} );
+		self.inner.exec_js( js );
+	}
+
+	/// Executes all javascript code given to `exec_js` that is still buffered, right away.
+	pub fn flush_js( &self ) {
+		self.inner.flush_js();
+	}
+
+	/// Registers a script that is compiled once for every page that gets loaded, instead of sending its source over on every call.
+	/// The source should evaluate to a function, like `(a, b) => a + b`.
+	/// The returned id can be used with `invoke_script` and `exec_script`.
+	///
+	/// # Arguments
+	/// * `name` - The name that is used for the script in error messages and stack traces.
+	/// * `source` - The javascript code that evaluates to the function.
+	pub fn register_script( &self, name: &str, source: &str ) -> u32 {
+		self.inner.register_script( name, source )
+	}
+
+	/// Registers a command of `invoke_extern`, of which the calls are routed to `handler` instead of to the handler set with `BrowserWindowBuilder::async_handler`.
+	/// The page keeps calling `invoke_extern(name, ...args)`, but only the id of the command is sent to the browser process, which hands the call to its handler without comparing or copying the name.
+	/// The page may also pass the returned id to `invoke_extern` directly, instead of the name.
+	/// Calls with structured values and batched calls are not routed to registered commands.
+	///
+	/// # Arguments
+	/// * `name` - The command, as it is given as the first argument of `invoke_extern`.
+	/// * `handler` - The closure that receives the other arguments of the calls.
+	pub fn register_command<H,F>( &self, name: &str, handler: H ) -> u32 where
+		H: FnMut( BrowserWindowHandle, Vec<String> ) -> F + 'static,
+		F: Future<Output=()> + 'static
+	{
+		let data_ptr = Box::into_raw( Box::new( handler ) );
+
+		self.inner.register_command( name, (command_handler::<H,F>, free_handler_data::<H>, data_ptr as _) )
+	}
+
+	/// Limits the number of calls of `invoke_extern` that can be waiting for the GUI thread, so that a page that calls it faster than its handler keeps up can't grow the queue without bounds.
+	///
+	/// Only calls with string arguments are limited; calls to the structured or batched handlers are not.
+	/// The number of dropped calls and the depth of the queue can be found in `metrics`.
+	///
+	/// # Arguments
+	/// * `limit` - The maximum number of waiting calls, or `None` to remove the limit.
+	/// * `policy` - What happens to a call that doesn't fit.
+	pub fn set_invoke_queue_limit( &self, limit: Option<usize>, policy: InvokeOverflow ) {
+		self.inner.set_invoke_queue_limit( limit, policy );
+	}
+
+	/// Enables or disables coalescing of the code given to `exec_js`.
+	///
+	/// When enabled, the code is buffered and executed all at once on the next iteration of the event loop,
+	///  or as soon as `flush_threshold` bytes are buffered.
+	/// This prevents a lot of overhead when `exec_js` is called very often, like when streaming output to the page.
+	/// Every piece of code is executed as a statement of its own, so an exception thrown in one doesn't stop the others.
+	///
+	/// # Arguments
+	/// * `flush_threshold` - `Some` to enable coalescing with the given threshold, or `None` to disable it. A threshold of 0 selects a default of 64 KiB.
+	pub fn set_js_coalescing( &self, flush_threshold: Option<usize> ) {
+		self.inner.set_js_coalescing( flush_threshold );
+	}
+
+	/// Answers the requests of which the url starts with `url_prefix` natively, with `handler`.
+	/// If the handler returns `None`, the request goes to the network like usual.
+	///
+	/// The handler is invoked on the browser engine's IO thread, which is why it needs to be `Send` and `Sync`.
+	/// Responses to GET requests that are marked as cacheable are kept in a response cache of at most `cache_budget` bytes, which evicts the least recently used responses first.
+	/// The cache key consists of the url and the values of the request headers named in `cache_key_headers`.
+	///
+	/// Calling this again replaces the previous handler, and clears the cache.
+	pub fn intercept_requests<H>( &self, url_prefix: &str, cache_budget: usize, cache_key_headers: &[&str], handler: H ) where
+		H: Fn( &InterceptedRequest ) -> Option<InterceptedResponse> + Send + Sync + 'static
+	{
+		let data_ptr = Box::into_raw( Box::new( handler ) );
+
+		self.inner.intercept_requests( url_prefix, cache_budget, cache_key_headers, Some( (request_handler::<H>, free_handler_data::<H>, data_ptr as _) ) );
+	}
+
+	/// Stops the interception started with `intercept_requests`.
+	pub fn stop_intercepting_requests( &self ) {
+		self.inner.intercept_requests( "", 0, &[], None );
+	}
+
+	/// Lets `handler` receive the frames of a windowless browser window, replacing the previous one.
+	/// Right after this, a frame of the whole view is painted.
+	///
+	/// The handler is invoked on the browser engine's UI thread, which is not the GUI thread on Windows, which is why it needs to be `Send`.
+	/// Only the areas in `dirty_rects` have changed since the previous frame, so only those need to be uploaded to the GPU.
+	/// Doesn't do anything if the browser window hasn't been built to be windowless.
+	pub fn on_paint<H>( &self, handler: H ) where
+		H: FnMut( &PaintedFrame ) + Send + 'static
+	{
+		let data_ptr = Box::into_raw( Box::new( handler ) );
+
+		self.inner.set_paint_handler( Some( (paint_handler::<H>, free_handler_data::<H>, data_ptr as _) ) );
+	}
+
+	/// Like `on_paint`, but receives the frames that are painted into shared textures, when enabled with `BrowserWindowBuilder::shared_textures`.
+	/// The texture can be opened by another graphics device, so that the frame never needs to be read back into memory.
+	pub fn on_shared_paint<H>( &self, handler: H ) where
+		H: FnMut( &SharedTextureFrame ) + Send + 'static
+	{
+		let data_ptr = Box::into_raw( Box::new( handler ) );
+
+		self.inner.set_shared_paint_handler( Some( (shared_paint_handler::<H>, free_handler_data::<H>, data_ptr as _) ) );
+	}
+
+	/// Removes the handlers set with `on_paint` and `on_shared_paint`.
+	pub fn remove_paint_handlers( &self ) {
+		self.inner.set_paint_handler( None );
+		self.inner.set_shared_paint_handler( None );
+	}
+
+	/// Changes the size in pixels of the view of a windowless browser window, independently of its window.
+	/// `scale_factor` is the number of pixels per device independent pixel, or 0 to keep the current one.
+	pub fn set_view_size( &self, width: u32, height: u32, scale_factor: f32 ) {
+		self.inner.set_view_size( width, height, scale_factor );
+	}
+
+	/// Sends the given bytes to the page, without any text encoding.
+	/// They are received as an `ArrayBuffer` by the global javascript function `on_extern_binary`, if the page has defined it.
+	pub fn post_binary( &self, data: &[u8] ) {
+		self.inner.post_binary( data );
+	}
+
+	/// Appends the given bytes to the page's binary stream.
+	///
+	/// Everything that is written during one iteration of the event loop is sent to the page at once, or as soon as 1 MiB is buffered.
+	/// This makes it a lot cheaper than `post_binary` for many small pieces of data, like telemetry.
+	/// The page receives every flushed part as an `ArrayBuffer` with the global javascript function `on_extern_stream`, if it has defined it.
+	/// That `ArrayBuffer` is the page's own copy, so the page's writes into it don't come back; the page writes to the application with `write_extern_stream` instead, see `on_stream`.
+	pub fn write_stream( &self, data: &[u8] ) {
+		self.inner.write_stream( data );
+	}
+
+	/// Sends everything written by `write_stream` right away.
+	pub fn flush_stream( &self ) {
+		self.inner.flush_stream();
+	}
+
+	/// Lets `handler` receive the bytes that the page writes to the application, replacing the previous one.
+	///
+	/// The page writes with its global javascript function `write_extern_stream`, which takes an `ArrayBuffer` or typed array.
+	/// Its writes are coalesced just like those of `write_stream`, and the handler is invoked on the GUI thread.
+	/// As long as no handler is set, `write_extern_stream` throws an exception in the page.
+	pub fn on_stream<H>( &self, handler: H ) where
+		H: FnMut( BrowserWindowHandle, &[u8] ) + 'static
+	{
+		let data_ptr = Box::into_raw( Box::new( handler ) );
+
+		self.inner.set_stream_handler( Some( (stream_handler::<H>, free_handler_data::<H>, data_ptr as _) ) );
+	}
+
+	/// Removes the handler set with `on_stream`, after which the page can't write to the application anymore.
+	pub fn remove_stream_handler( &self ) {
+		self.inner.set_stream_handler( None );
+	}
+
+	/// Calls the function of a script registered with `register_script`, with the given strings as its arguments, and returns its output.
+	pub async fn invoke_script( &self, script_id: u32, args: &[&str] ) -> Result<String, JsEvaluationError> {
+		let (tx, rx) = oneshot::channel::<Result<String, JsEvaluationError>>();
+
+		let data_ptr = Box::into_raw( Box::new( tx ) );
+		self.inner.invoke_script( script_id, args, Some( ( eval_js_channel_callback, data_ptr as _ ) ) );
+
+		rx.await.unwrap()
+	}
+
+	/// Like `invoke_script`, but doesn't provide the output.
+	pub fn exec_script( &self, script_id: u32, args: &[&str] ) {
+		self.inner.invoke_script( script_id, args, None );
+	}
+
+	/// Measures the memory used for this browser window, including the JavaScript heap and private memory of its renderer process.
+	/// If the browser window is closed before the renderer process has answered, `renderer` is `None`.
+	pub async fn memory_stats( &self ) -> BrowserWindowMemoryStats {
+		let (tx, rx) = oneshot::channel::<BrowserWindowMemoryStats>();
+
+		let data_ptr = Box::into_raw( Box::new( tx ) );
+		self.inner.memory_stats( memory_stats_callback, data_ptr as _ );
+
+		rx.await.unwrap()
+	}
+
+	/// Returns the latencies of script evaluations and `invoke_extern` calls, and the number of messages and bytes exchanged with the renderer process.
+	/// The counters are never reset, so they can be exported as they are to a monitoring system like Prometheus.
+	pub fn metrics( &self ) -> BrowserWindowMetrics {
+		self.inner.metrics()
+	}
+
+	/// Like `memory_stats`, but only returns the memory used in the current process, without waiting for the renderer process.
+	pub fn native_memory_stats( &self ) -> BrowserWindowMemoryStats {
+		self.inner.native_memory_stats()
 	}
 
 	/// Causes the browser to navigate to the given url.
@@ -192,6 +514,20 @@ impl BrowserWindowHandle {
 		self.inner.navigate( url )
 	}
 
+	/// Returns the title of the page, as it has been reported last.
+	/// Unlike the title of the window, this is the title that the page has given itself.
+	pub fn page_title( &self ) -> String {
+		self.inner.page_title()
+	}
+
+	/// Releases the memory that this browser window can do without, like the responses cached by `intercept_requests`.
+	/// The page is asked to do the same, by calling its `on_memory_pressure` function with `"moderate"` or `"critical"` if it has one.
+	pub fn trim_memory( &self, level: MemoryPressure ) {
+		self.inner.trim_memory( level )
+	}
+
+	/// Returns the url of the page.
+	/// Once the page has reported its url, it is kept up to date by its events, so this doesn't need to ask the browser engine.
 	pub fn url<'a>(&'a self) -> Cow<'a, str> {
 		self.inner.url()
 	}
@@ -205,12 +541,85 @@ impl BrowserWindowHandle {
 
 
 
+impl EvalJsFuture {
+
+	/// Cancels the evaluation, unless it has already completed.
+	/// Awaiting the future afterwards gives an error for which `is_cancelled` returns true.
+	pub fn cancel( &mut self ) {
+		if !self.completed {
+			self.completed = true;
+			self.handle.inner.cancel_js( self.id );
+		}
+	}
+}
+
+impl Future for EvalJsFuture {
+	type Output = Result<String, JsEvaluationError>;
+
+	fn poll( mut self: Pin<&mut Self>, cx: &mut Context<'_> ) -> Poll<Self::Output> {
+		match Pin::new( &mut self.rx ).poll( cx ) {
+			Poll::Pending => Poll::Pending,
+			Poll::Ready( result ) => {
+				self.completed = true;
+				Poll::Ready( result.unwrap() )
+			}
+		}
+	}
+}
+
+impl Drop for EvalJsFuture {
+	fn drop( &mut self ) {
+		self.cancel();
+	}
+}
+
+
+
+impl InvocationReply {
+
+	pub(in super) fn new( handle: BrowserWindowHandle, request_id: u32 ) -> Self {
+		Self {
+			app: handle.app_handle().inner,
+			bw_id: handle.inner.id(),
+			request_id,
+			replied: false
+		}
+	}
+
+	/// Resolves the promise with the given string.
+	pub fn resolve( mut self, value: &str ) {
+		self.send( Ok( value ) );
+	}
+
+	/// Rejects the promise with an `Error` that has the given message.
+	pub fn reject( mut self, message: &str ) {
+		self.send( Err( message ) );
+	}
+
+	fn send( &mut self, reply: Result<&str, &str> ) {
+		self.replied = true;
+		if let Some( inner ) = BrowserWindowImpl::find( self.app, self.bw_id ) {
+			inner.reply_to_invocation( self.request_id, reply );
+		}
+	}
+}
+
+impl Drop for InvocationReply {
+	fn drop( &mut self ) {
+		if !self.replied {
+			self.send( Err( "the native handler has not replied" ) );
+		}
+	}
+}
+
+
+
 #[cfg(feature = "threadsafe")]
 impl BrowserWindowThreaded {
 
 	/// The thread-safe application handle associated with this browser window.
 	pub fn app( &self ) -> ApplicationHandleThreaded {
-		ApplicationHandleThreaded::from_core_handle( self.handle.inner.window().app() )
+		ApplicationHandleThreaded::from_core_handle( self.app )
 	}
 
 	/// Closes the browser.
@@ -220,6 +629,25 @@ impl BrowserWindowThreaded {
 		})
 	}
 
+	/// Same as `BrowserWindowHandle::metrics`, which can be read from any thread without delegating to the GUI thread.
+	/// Returns `None` once the browser window has been closed.
+	pub fn metrics( &self ) -> Option<BrowserWindowMetrics> {
+		BrowserWindowImpl::metrics_threaded( self.app, self.id )
+	}
+
+	/// Executes the given javascript code and returns the output as a string.
+	/// Unlike `BrowserWindowHandle::eval_js`, this doesn't need to be delegated to the GUI thread.
+	/// The code is sent to the browser engine from the calling thread, and the result is passed straight back to the awaiting task.
+	/// If the browser window has been closed, or its browser hasn't been created yet, the evaluation is cancelled right away.
+	pub async fn eval_js( &self, js: &str ) -> Result<String, JsEvaluationError> {
+		let (tx, rx) = oneshot::channel::<Result<String, JsEvaluationError>>();
+
+		// The browser window is looked up by the browser engine, so nothing that refers to it is held across the await
+		BrowserWindowImpl::eval_js_threaded( self.app, self.id, js, eval_js_channel_callback, Box::into_raw( Box::new( tx ) ) as _ );
+
+		rx.await.unwrap()
+	}
+
 	/// Executes the given closure within the GUI thread, and return the value that the closure returned.
 	/// Also see `ApplicationThreaded::delegate`.
 	///
@@ -231,22 +659,28 @@ impl BrowserWindowThreaded {
 	/// ```
 	pub fn delegate<'a,F,R>( &self, func: F ) -> BrowserDelegateFuture<'a,R> where
 		F: FnOnce( BrowserWindowHandle ) -> R + Send + 'a,
-		R: Send
+		R: Send + 'static
 	{
-		BrowserDelegateFuture::new( self.handle.clone(), func )
+		let id = self.id;
+		BrowserDelegateFuture::new( DelegateFuture::new( ApplicationHandle::new( self.app ), move |app: ApplicationHandle| {
+			BrowserWindowImpl::find( app.inner, id ).map(|inner| func( BrowserWindowHandle::new( inner ) ) )
+		}) )
 	}
 
 	/// Executes the given async closure `func` on the GUI thread, and gives back the result when done.
 	/// Also see `ApplicationThreaded::delegate_async`.
-	pub fn delegate_async<'a,C,F,R>( &self, func: C ) -> DelegateFutureFuture<'a,R> where
+	pub fn delegate_async<'a,C,F,R>( &self, func: C ) -> BrowserDelegateFuture<'a,R> where
 		C: FnOnce( BrowserWindowHandle ) -> F + Send + 'a,
 		F: Future<Output=R>,
 		R: Send + 'static
 	{
-		let handle = self.handle.clone();
-		DelegateFutureFuture::new( self.app().handle.clone(), async move {
-			func( handle.into() ).await
-		})
+		let (app, id) = (self.app, self.id);
+		BrowserDelegateFuture::new( DelegateFutureFuture::new( ApplicationHandle::new( app ), async move {
+			match BrowserWindowImpl::find( app, id ) {
+				Some( inner ) => Some( func( BrowserWindowHandle::new( inner ) ).await ),
+				None => None
+			}
+		}) )
 	}
 
 	/// Executes the given future on the GUI thread, and gives back the result when done.
@@ -255,39 +689,46 @@ impl BrowserWindowThreaded {
 		F: Future<Output=R> + Send + 'a,
 		R: Send + 'static
 	{
-		let handle = self.handle.clone();
-		DelegateFutureFuture::new( self.app().handle.clone(), fut )
+		DelegateFutureFuture::new( ApplicationHandle::new( self.app ), fut )
 	}
 
 	/// Executes the given close on the GUI thread.
+	/// The closure is not executed if the browser window has been closed by then.
 	/// See also `Application::dispatch`.
 	pub fn dispatch<'a,F>( &self, func: F ) -> bool where
 		F:  FnOnce( BrowserWindowHandle ) + Send + 'a
 	{
-		let handle = UnsafeSend::new( self.handle );
+		let id = self.id;
 
 		// FIXME: It is more efficient to reimplement this for the browser window
-		self.app().dispatch(move |_| {
-			func( handle.i );
+		self.app().dispatch(move |app| {
+			if let Some( inner ) = BrowserWindowImpl::find( app.inner, id ) {
+				func( BrowserWindowHandle::new( inner ) );
+			}
 		})
 	}
 
 	/// Executes the given closure on the GUI thread.
+	/// The closure is not executed if the browser window has been closed by then.
 	/// See also `Application::dispatch`.
 	pub fn dispatch_async<'a,C,F>( &self, func: C ) -> bool where
 		C:  FnOnce( BrowserWindowHandle ) -> F + Send + 'a,
 		F: Future<Output=()> + 'static
 	{
-		let handle = UnsafeSend::new( self.handle );
+		let id = self.id;
 
 		self.app().dispatch(move |a| {
-			a.spawn( func( handle.i ) );
+			if let Some( inner ) = BrowserWindowImpl::find( a.inner, id ) {
+				a.spawn( func( BrowserWindowHandle::new( inner ) ) );
+			}
 		})
 	}
 
-	fn new( handle: BrowserWindowHandle ) -> Self {
+	/// Takes the id of the browser window, so this needs to be called on the GUI thread, or on a worker thread right after the browser window has been looked up.
+	pub(in super) fn new( handle: BrowserWindowHandle ) -> Self {
 		Self {
-			handle
+			app: handle.inner.window().app(),
+			id: handle.inner.id()
 		}
 	}
 }
@@ -296,28 +737,36 @@ impl BrowserWindowThreaded {
 impl HasAppHandle for BrowserWindowThreaded {
 
 	fn app_handle( &self ) -> ApplicationHandle {
-		self.handle.app_handle()
+		ApplicationHandle::new( self.app )
 	}
 }
 
 #[cfg(feature = "threadsafe")]
-impl OwnedWindow for BrowserWindowThreaded {
-	fn window_handle( &self ) -> WindowHandle {
-		self.handle.window()
+impl<'a,R> BrowserDelegateFuture<'a,R> {
+
+	fn new( inner: impl Future<Output=Result<Option<R>, DelegateError>> + Send + 'a ) -> Self {
+		Self { inner: Box::pin( inner ) }
 	}
 }
 
 #[cfg(feature = "threadsafe")]
-impl OwnedBrowserWindow for BrowserWindowThreaded {
-	fn browser_handle( &self ) -> BrowserWindowHandle {
-		self.handle.clone()
+impl<'a,R> Future for BrowserDelegateFuture<'a,R> {
+	type Output = Result<R, DelegateError>;
+
+	fn poll( mut self: Pin<&mut Self>, cx: &mut Context ) -> Poll<Self::Output> {
+		match self.inner.as_mut().poll( cx ) {
+			Poll::Pending => Poll::Pending,
+			Poll::Ready( Ok( Some( result ) ) ) => Poll::Ready( Ok( result ) ),
+			Poll::Ready( Ok( None ) ) => Poll::Ready( Err( DelegateError::BrowserWindowClosed ) ),
+			Poll::Ready( Err( error ) ) => Poll::Ready( Err( error ) )
+		}
 	}
 }
 
 
 
 impl BrowserWindowHandle {
-	fn new( inner_handle: BrowserWindowImpl ) -> Self {
+	pub(crate) fn new( inner_handle: BrowserWindowImpl ) -> Self {
 		Self {
 			inner: inner_handle,
 			window: WindowHandle::new( inner_handle.window() )
@@ -353,4 +802,75 @@ unsafe fn eval_js_callback<H>( _handle: BrowserWindowImpl, cb_data: *mut (), res
 	let handle = BrowserWindowHandle::new( _handle );
 
 	(*data)( handle, result );
+}
+
+unsafe fn command_handler<H,F>( handle: BrowserWindowImpl, data: *mut (), _command_id: u32, args: Vec<String> ) where
+	H: FnMut( BrowserWindowHandle, Vec<String> ) -> F,
+	F: Future<Output=()> + 'static
+{
+	let handler = &mut *(data as *mut H);
+	let outer_handle = BrowserWindowHandle::new( handle );
+
+	let future = handler( outer_handle, args );
+	outer_handle.app().spawn( future );
+}
+
+unsafe fn request_handler<H>( _handle: BrowserWindowImpl, data: *mut (), request: &InterceptedRequest ) -> Option<InterceptedResponse> where
+	H: Fn( &InterceptedRequest ) -> Option<InterceptedResponse>
+{
+	let handler = &*(data as *const H);
+
+	handler( request )
+}
+
+unsafe fn paint_handler<H>( _handle: BrowserWindowImpl, data: *mut (), frame: &PaintedFrame ) where
+	H: FnMut( &PaintedFrame )
+{
+	let handler = &mut *(data as *mut H);
+
+	handler( frame );
+}
+
+unsafe fn shared_paint_handler<H>( _handle: BrowserWindowImpl, data: *mut (), frame: &SharedTextureFrame ) where
+	H: FnMut( &SharedTextureFrame )
+{
+	let handler = &mut *(data as *mut H);
+
+	handler( frame );
+}
+
+unsafe fn stream_handler<H>( handle: BrowserWindowImpl, data: *mut (), bytes: &[u8] ) where
+	H: FnMut( BrowserWindowHandle, &[u8] )
+{
+	let handler = &mut *(data as *mut H);
+
+	handler( BrowserWindowHandle::new( handle ), bytes );
+}
+
+unsafe fn free_handler_data<H>( data: *mut () ) {
+	drop( Box::from_raw( data as *mut H ) );
+}
+
+/// Sends the result through the oneshot channel given as the callback data, which works from any thread.
+unsafe fn eval_js_channel_callback( _handle: BrowserWindowImpl, cb_data: *mut (), result: Result<String, JsEvaluationError> ) {
+	let data_ptr = cb_data as *mut oneshot::Sender<Result<String, JsEvaluationError>>;
+	let tx = Box::from_raw( data_ptr );
+
+	// The receiving future may have been dropped already, in which case nobody is interested in the result anymore
+	let _ = tx.send( result );
+}
+
+unsafe fn memory_stats_callback( _handle: BrowserWindowImpl, cb_data: *mut (), stats: BrowserWindowMemoryStats ) {
+	let tx = Box::from_raw( cb_data as *mut oneshot::Sender<BrowserWindowMemoryStats> );
+
+	// The future may have been dropped already
+	let _ = tx.send( stats );
+}
+
+unsafe fn eval_js_structured_callback( _handle: BrowserWindowImpl, cb_data: *mut (), result: Result<JsValue, JsEvaluationError> ) {
+	let data_ptr = cb_data as *mut oneshot::Sender<Result<JsValue, JsEvaluationError>>;
+	let tx = Box::from_raw( data_ptr );
+
+	// The receiving future may have been dropped already, in which case nobody is interested in the result anymore
+	let _ = tx.send( result );
 }
\ No newline at end of file
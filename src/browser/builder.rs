@@ -4,17 +4,23 @@ use browser_window_core::window::*;
 
 use crate::application::{ApplicationHandle};
 use crate::browser::*;
+use crate::request_context::RequestContext;
 use crate::window::WindowBuilder;
 
 use std::{
 	ops::DerefMut,
 	path::PathBuf,
 	pin::Pin,
+	ptr,
 	vec::Vec
 };
 
 #[cfg(feature = "threadsafe")]
-use unsafe_send_sync::UnsafeSend;
+use std::{
+	sync::Arc,
+	task::{Context, Poll, Wake, Waker},
+	thread
+};
 
 
 
@@ -32,10 +38,32 @@ pub enum Source {
 type BrowserJsInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<String>) -> Pin<Box<dyn Future<Output=()>>>>;
 #[cfg(feature = "threadsafe")]
 type BrowserJsInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<String>) -> Pin<Box<dyn Future<Output=()>>> + Send>;
+#[cfg(not(feature = "threadsafe"))]
+type BrowserJsValueInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<JsValue>) -> Pin<Box<dyn Future<Output=()>>>>;
+#[cfg(feature = "threadsafe")]
+type BrowserJsValueInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<JsValue>) -> Pin<Box<dyn Future<Output=()>>> + Send>;
+#[cfg(not(feature = "threadsafe"))]
+type BrowserJsBinaryInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<u8>) -> Pin<Box<dyn Future<Output=()>>>>;
+#[cfg(feature = "threadsafe")]
+type BrowserJsBinaryInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<u8>) -> Pin<Box<dyn Future<Output=()>>> + Send>;
+#[cfg(not(feature = "threadsafe"))]
+type BrowserJsBatchInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, Vec<Invocation>) -> Pin<Box<dyn Future<Output=()>>>>;
+#[cfg(feature = "threadsafe")]
+type BrowserJsBatchInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, Vec<Invocation>) -> Pin<Box<dyn Future<Output=()>>> + Send>;
+#[cfg(not(feature = "threadsafe"))]
+type BrowserJsNativeInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<String>, InvocationReply) -> Pin<Box<dyn Future<Output=()>>>>;
+#[cfg(feature = "threadsafe")]
+type BrowserJsNativeInvocationHandler = Box<dyn FnMut(BrowserWindowHandle, String, Vec<String>, InvocationReply) -> Pin<Box<dyn Future<Output=()>>> + Send>;
+#[cfg(feature = "threadsafe")]
+type BrowserJsThreadedInvocationHandler = Box<dyn Fn(BrowserWindowThreaded, String, Vec<String>) -> Pin<Box<dyn Future<Output=()>>> + Send + Sync>;
 
 /// The data that is passed to the C FFI handler function
 struct BrowserUserData {
-	handler: BrowserJsInvocationHandler
+	handler: BrowserJsInvocationHandler,
+	value_handler: Option<BrowserJsValueInvocationHandler>,
+	binary_handler: Option<BrowserJsBinaryInvocationHandler>,
+	native_handler: Option<BrowserJsNativeInvocationHandler>,
+	batch_handler: Option<BrowserJsBatchInvocationHandler>
 }
 
 /// Used to create a [`BrowserWindow`] or [`BrowserWindowThreaded`] instance, depending on whether or not you have feature `threadsafe` enabled.
@@ -72,9 +100,20 @@ struct BrowserUserData {
 pub struct BrowserWindowBuilder {
 
 	dev_tools: bool,
+	events: Box<BrowserWindowEvents>,
 	handler: Option<BrowserJsInvocationHandler>,
+	headless: bool,
+	value_handler: Option<BrowserJsValueInvocationHandler>,
+	binary_handler: Option<BrowserJsBinaryInvocationHandler>,
+	native_handler: Option<BrowserJsNativeInvocationHandler>,
+	batch_handler: Option<BrowserJsBatchInvocationHandler>,
+	#[cfg(feature = "threadsafe")]
+	threaded_handler: Option<BrowserJsThreadedInvocationHandler>,
+	request_context: Option<RequestContext>,
+	shared_textures: bool,
 	source: Source,
-	window: WindowBuilder
+	window: WindowBuilder,
+	windowless_frame_rate: Option<u32>
 }
 
 
@@ -109,6 +148,141 @@ impl BrowserWindowBuilder {
 		self
 	}
 
+	/// Configure a closure that can be invoked from within JavaScript, which receives its arguments as they are.
+	/// Arrays and objects don't need to be stringified, and `ArrayBuffer`s and typed arrays are received as `JsValue::Binary`.
+	/// Like `JSON.stringify`, `invoke_extern` throws when one of its arguments contains a cyclic structure.
+	/// When set, this closure is invoked instead of the one set with `async_handler`.
+	#[cfg(not(feature = "threadsafe"))]
+	pub fn async_value_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, String, Vec<JsValue>) -> F + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.value_handler = Some( Box::new(
+			move |handle, cmd, args| Box::pin(handler( handle, cmd, args ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that can be invoked from within JavaScript, which receives its arguments as they are.
+	/// Arrays and objects don't need to be stringified, and `ArrayBuffer`s and typed arrays are received as `JsValue::Binary`.
+	/// Like `JSON.stringify`, `invoke_extern` throws when one of its arguments contains a cyclic structure.
+	/// When set, this closure is invoked instead of the one set with `async_handler`.
+	#[cfg(feature = "threadsafe")]
+	pub fn async_value_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, String, Vec<JsValue>) -> F + Send + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.value_handler = Some( Box::new(
+			move |handle, cmd, args| Box::pin(handler( handle, cmd, args ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that receives the binary data given to `invoke_extern_binary(cmd, data)` in JavaScript.
+	/// `data` can be an `ArrayBuffer` or a typed array, and is received without any text encoding.
+	#[cfg(not(feature = "threadsafe"))]
+	pub fn async_binary_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, String, Vec<u8>) -> F + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.binary_handler = Some( Box::new(
+			move |handle, cmd, data| Box::pin(handler( handle, cmd, data ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that receives the binary data given to `invoke_extern_binary(cmd, data)` in JavaScript.
+	/// `data` can be an `ArrayBuffer` or a typed array, and is received without any text encoding.
+	#[cfg(feature = "threadsafe")]
+	pub fn async_binary_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, String, Vec<u8>) -> F + Send + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.binary_handler = Some( Box::new(
+			move |handle, cmd, data| Box::pin(handler( handle, cmd, data ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that receives the calls of `invoke_extern` in batches.
+	/// All calls that the page makes during one task are sent at once when the task has finished, and are received in the order in which they were made.
+	/// This saves a message and a dispatch to the GUI thread for every call, when pages call `invoke_extern` in tight loops.
+	/// When set, this closure is invoked instead of the one set with `async_handler`, unless a value handler is set as well.
+	/// Browser windows with a batch handler are never taken from the browser windows created by `prewarm`.
+	#[cfg(not(feature = "threadsafe"))]
+	pub fn async_batch_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, Vec<Invocation>) -> F + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.batch_handler = Some( Box::new(
+			move |handle, calls| Box::pin(handler( handle, calls ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that receives the calls of `invoke_extern` in batches.
+	/// All calls that the page makes during one task are sent at once when the task has finished, and are received in the order in which they were made.
+	/// This saves a message and a dispatch to the GUI thread for every call, when pages call `invoke_extern` in tight loops.
+	/// When set, this closure is invoked instead of the one set with `async_handler`, unless a value handler is set as well.
+	/// Browser windows with a batch handler are never taken from the browser windows created by `prewarm`.
+	#[cfg(feature = "threadsafe")]
+	pub fn async_batch_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, Vec<Invocation>) -> F + Send + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.batch_handler = Some( Box::new(
+			move |handle, calls| Box::pin(handler( handle, calls ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that handles the calls of `invoke_extern` on a pool of worker threads in the browser process, instead of on the GUI thread.
+	/// This suits handlers that do CPU-heavy or blocking work without touching the UI, which then scale across cores without holding up painting and input.
+	/// The future that the closure returns is run to completion on the worker thread, and occupies it until then.
+	/// Calls may be handled at the same time on different threads, so they can finish in another order than the one in which they were made.
+	/// When set, this closure is invoked instead of the one set with `async_handler`, unless a value or batch handler is set as well.
+	/// Browser windows with a threaded handler are never taken from the browser windows created by `prewarm`.
+	///
+	/// **Note:** Only available with feature `threadsafe` enabled.
+	#[cfg(feature = "threadsafe")]
+	pub fn async_handler_threaded<H,F>( &mut self, handler: H ) -> &mut Self where
+		H: Fn(BrowserWindowThreaded, String, Vec<String>) -> F + Send + Sync + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.threaded_handler = Some( Box::new(
+			move |handle, cmd, args| Box::pin(handler( handle, cmd, args ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that answers the calls of `invoke_native(cmd, ...args)` in JavaScript, which returns a promise.
+	/// The arguments are received as strings, and the promise is settled by the `InvocationReply` that the closure receives as its fourth parameter.
+	/// The reply is handed to the promise directly, so unlike answering with `eval_js`, no script needs to be evaluated for it.
+	#[cfg(not(feature = "threadsafe"))]
+	pub fn async_native_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, String, Vec<String>, InvocationReply) -> F + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.native_handler = Some( Box::new(
+			move |handle, cmd, args, reply| Box::pin(handler( handle, cmd, args, reply ) )
+		) );
+		self
+	}
+
+	/// Configure a closure that answers the calls of `invoke_native(cmd, ...args)` in JavaScript, which returns a promise.
+	/// The arguments are received as strings, and the promise is settled by the `InvocationReply` that the closure receives as its fourth parameter.
+	/// The reply is handed to the promise directly, so unlike answering with `eval_js`, no script needs to be evaluated for it.
+	#[cfg(feature = "threadsafe")]
+	pub fn async_native_handler<H,F>( &mut self, mut handler: H ) -> &mut Self where
+		H: FnMut(BrowserWindowHandle, String, Vec<String>, InvocationReply) -> F + Send + 'static,
+		F: Future<Output=()> + 'static
+	{
+		self.native_handler = Some( Box::new(
+			move |handle, cmd, args, reply| Box::pin(handler( handle, cmd, args, reply ) )
+		) );
+		self
+	}
+
 	/// Sets whether or not an extra window with developer tools will be opened together with this browser.
 	/// When in debug mode the default is `true`.
 	/// When in release mode the default is `false`.
@@ -125,6 +299,67 @@ impl BrowserWindowBuilder {
 		self
 	}*/
 
+	def_event!{ /// Invoked when the main frame starts loading a page.
+		BrowserWindowHandle, on_load_start, on_load_start_async
+	}
+
+	def_event!{ /// Invoked when the main frame has finished loading a page.
+		LoadEndEventArgs, on_load_end, on_load_end_async
+	}
+
+	def_event!{ /// Invoked when the loading progress of the page changes.
+		ProgressEventArgs, on_progress, on_progress_async
+	}
+
+	def_event!{ /// Invoked when the page changes its title.
+		TitleChangeEventArgs, on_title_change, on_title_change_async
+	}
+
+	def_event!{ /// Invoked when the url of the main frame changes, which also happens for navigation within the page.
+		UrlChangeEventArgs, on_url_change, on_url_change_async
+	}
+
+	/// Creates `count` hidden browser windows in advance, with the options of this builder.
+	/// Browser windows that are built later on with the same window options, and with or without a value handler like this builder, take one of them and only need to load their source.
+	/// This saves the time it takes to start up a renderer, which is noticeable when opening a window.
+	/// If `refill` is set, a replacement is created in the background whenever one has been taken.
+	///
+	/// Browser windows with dev tools, a request context or without a window, or that have a parent, are never taken from the pool.
+	/// Calling this again replaces the pool, and a `count` of 0 destroys it.
+	pub fn prewarm( &self, app: ApplicationHandle, count: u32, refill: bool ) {
+		let (window_options, browser_window_options) = Self::ffi_options( &self.window, self.dev_tools, self.windowless_frame_rate, self.shared_textures, self.headless );
+
+		// Browser windows with a request context, or a batch or threaded handler, are never pooled, so there is no use in keeping any ready for them
+		let count = if self.request_context.is_some() || self.batch_handler.is_some() { 0 } else { count };
+		#[cfg(feature = "threadsafe")]
+		let count = if self.threaded_handler.is_some() { 0 } else { count };
+		BrowserWindowImpl::prewarm( app.inner, count, &window_options, &browser_window_options, self.value_handler.is_some(), refill );
+	}
+
+	/// Keeps a windowless browser window painting while its window is hidden, so that its view can be captured without ever showing it.
+	/// This has no effect on browser windows that aren't windowless.
+	pub fn headless( &mut self, enabled: bool ) -> &mut Self {
+		self.headless = enabled;	self
+	}
+
+	/// Lets the browser window use an isolated request context, instead of the cookies and cache that are shared with all other browser windows.
+	pub fn request_context( &mut self, context: &RequestContext ) -> &mut Self {
+		self.request_context = Some( context.clone() );	self
+	}
+
+	/// Lets a windowless browser window paint into textures that are shared with other graphics devices.
+	/// Its frames are then given to `BrowserWindowHandle::on_shared_paint`, instead of `BrowserWindowHandle::on_paint`.
+	pub fn shared_textures( &mut self, enabled: bool ) -> &mut Self {
+		self.shared_textures = enabled;	self
+	}
+
+	/// Makes the browser window windowless: it renders into the paint handlers at most `frame_rate` times per second, instead of into its window.
+	/// Register the paint handlers with `BrowserWindowHandle::on_paint` or `BrowserWindowHandle::on_shared_paint`.
+	/// This requires `ApplicationSettings::windowless_rendering` to be enabled.
+	pub fn windowless( &mut self, frame_rate: u32 ) -> &mut Self {
+		self.windowless_frame_rate = Some( frame_rate );	self
+	}
+
 	/// Creates an instance of a browser window builder.
 	///
 	/// # Arguments
@@ -132,9 +367,20 @@ impl BrowserWindowBuilder {
 	pub fn new( source: Source ) -> Self {
 		Self {
 			dev_tools: false,
+			events: Box::new( BrowserWindowEvents::default() ),
 			source,
 			handler: None,
-			window: WindowBuilder::new()
+			headless: false,
+			value_handler: None,
+			binary_handler: None,
+			native_handler: None,
+			batch_handler: None,
+			#[cfg(feature = "threadsafe")]
+			threaded_handler: None,
+			request_context: None,
+			shared_textures: false,
+			window: WindowBuilder::new(),
+			windowless_frame_rate: None
 		}
 	}
 
@@ -155,6 +401,28 @@ impl BrowserWindowBuilder {
 		BrowserWindow::new( rx.await.unwrap() )
 	}
 
+	/// Creates all browser windows at once, and resolves when the last of them has been created.
+	/// Their renderers start up at the same time, instead of one after the other, so that all of them can be laid out together.
+	/// The browser windows are returned in the order of their builders.
+	///
+	/// # Arguments
+	/// * `app` - An application handle that these browser windows can spawn into
+	pub async fn build_many( builders: Vec<Self>, app: ApplicationHandle ) -> Vec<BrowserWindow> {
+
+		let (tx, rx) = oneshot::channel::<Vec<BrowserWindowHandle>>();
+
+		// All browser windows are requested with one call, and the parts need to stay around during it because the specs refer to them
+		{
+			let parts: Vec<_> = builders.into_iter().map(|builder| builder._parts(|_| {}) ).collect();
+			let specs: Vec<_> = parts.iter().map(|p| p.spec() ).collect();
+			let callback_data = Box::into_raw( Box::new( tx ) );
+
+			BrowserWindowImpl::new_many( app.inner, &specs, browser_windows_created_callback, callback_data as _ );
+		}
+
+		rx.await.unwrap().into_iter().map(|handle| BrowserWindow::new( handle ) ).collect()
+	}
+
 	/// Creates the browser window.
 	///
 	/// Keep in mind that the description of this function is for when feature `threadsafe` is enabled.
@@ -168,107 +436,246 @@ impl BrowserWindowBuilder {
 	#[cfg(feature = "threadsafe")]
 	pub async fn build_threaded( self, app: ApplicationHandleThreaded ) -> Result<BrowserWindowThreaded, DelegateError> {
 
-		let (tx, rx) = oneshot::channel::<UnsafeSend<BrowserWindowHandle>>();
+		let (tx, rx) = oneshot::channel::<BrowserWindowThreaded>();
 
 		// We need to dispatch the spawning of the browser to the GUI thread
 		app.delegate(|app_handle| {
 
+			// The id of the browser window is taken on the GUI thread, where it can't be closed in the meantime
 			self._build(app_handle, |inner_handle| {
 
-				if let Err(_) = tx.send( UnsafeSend::new( inner_handle ) ) {
+				if let Err(_) = tx.send( BrowserWindowThreaded::new( inner_handle ) ) {
 					panic!("Unable to send browser handle back")
 				}
 			} );
 		}).await?;
 
-		Ok( BrowserWindowThreaded::new( rx.await.unwrap().i ) )
+		Ok( rx.await.unwrap() )
+	}
+
+	fn ffi_options( window: &WindowBuilder, dev_tools: bool, windowless_frame_rate: Option<u32>, shared_textures: bool, headless: bool ) -> (WindowOptions, BrowserWindowOptions) {
+		let window_options = WindowOptions {
+			borders: window.borders,
+			minimizable: window.minimizable,
+			resizable: window.resizable,
+			throttling: window.throttling.to_c()
+		};
+		let other_options = BrowserWindowOptions {
+			dev_tools: if dev_tools {1} else {0},
+			resource_path: "".into(),
+			structured_handler: None,
+			binary_handler: None,
+			native_handler: None,
+			batch_handler: None,
+			threaded_handler: None,
+			threaded_handler_data: ptr::null_mut(),
+			free_threaded_handler_data: None,
+			request_context: ptr::null(),
+			windowless: windowless_frame_rate.is_some() as _,
+			windowless_frame_rate: windowless_frame_rate.unwrap_or( 0 ),
+			shared_textures: shared_textures as _,
+			headless: headless as _
+		};
+		(window_options, other_options)
 	}
 
 	fn _build<H>( self, app: ApplicationHandle, on_created: H ) where
 		H: FnOnce( BrowserWindowHandle )
+	{
+		let parts = self._parts( on_created );
+		let spec = parts.spec();
+
+		BrowserWindowImpl::new(
+			app.inner,
+			spec.parent,
+			spec.source,
+			spec.title,
+			spec.width,
+			spec.height,
+			spec.window_options,
+			spec.browser_window_options,
+			spec.handler,
+			spec.structured_handler,
+			spec.binary_handler,
+			spec.native_handler,
+			spec.batch_handler,
+			spec.threaded_handler,
+			spec.request_context,
+			spec.user_data,
+			spec.creation_callback,
+			spec.callback_data
+		);
+	}
+
+	/// Takes everything out of the builder that the browser window is created with.
+	/// `on_created` is invoked with the browser window once it has been created.
+	fn _parts<H>( self, on_created: H ) -> BrowserWindowParts where
+		H: FnOnce( BrowserWindowHandle )
 	{
 		match self {
 			Self {
 				source,
+				events,
 				handler,
+				headless,
+				value_handler,
+				binary_handler,
+				native_handler,
+				batch_handler,
+				#[cfg(feature = "threadsafe")]
+				threaded_handler,
+				request_context,
+				shared_textures,
 				dev_tools,
-				window
+				window,
+				windowless_frame_rate
 			} => {
 
+				// Convert options to FFI structs
+				let (window_options, other_options) = Self::ffi_options( &window, dev_tools, windowless_frame_rate, shared_textures, headless );
+
 				// Parent
-				let parent_handle = match window.parent {
+				let parent = match window.parent {
 					None => WindowImpl::default(),
 					Some( p ) => p.i.inner
 				};
 
 				// Source
-				let mut _url: String = "file:///".into();	// Stays here so that the reference to it that gets passed to C stays valid for the function call to `bw_BrowserWindow_new`.
-				let source = match &source {	// Use a reference, we want source to live until the end of the function because bw_BrowserWindowSource holds a reference to its internal string.
-					Source::File( path ) => {
-						_url += path.to_str().unwrap();
-
-						browser_window::Source {
-							data: _url.as_str().into(),
-							is_html: 0
-						}
-					},
-					Source::Html( html ) => { browser_window::Source {
-						data: html.as_str().into(),
-						is_html: 1
-					} },
-					Source::Url( url ) => { browser_window::Source {
-						data: url.as_str().into(),
-						is_html: 0
-					} }
+				let (source, is_html) = match source {
+					Source::File( path ) => ( format!( "file:///{}", path.to_str().unwrap() ), false ),
+					Source::Html( html ) => ( html, true ),
+					Source::Url( url ) => ( url, false )
 				};
 
 				// Title
-				let title = match window.title.as_ref() {
+				let title = match window.title {
 					None => "Browser Window".into(),
-					Some( t ) => t.as_str().into()
+					Some( t ) => t
 				};
 
 				// Handler callback data
+				let structured_handler = match value_handler {
+					None => None,
+					Some(_) => Some( browser_window_invoke_value_handler as ExternalStructuredInvocationHandlerFn )
+				};
+				let c_binary_handler = match binary_handler {
+					None => None,
+					Some(_) => Some( browser_window_invoke_binary_handler as ExternalBinaryInvocationHandlerFn )
+				};
+				let c_native_handler = match native_handler {
+					None => None,
+					Some(_) => Some( browser_window_invoke_native_handler as ExternalNativeInvocationHandlerFn )
+				};
+				let c_batch_handler = match batch_handler {
+					None => None,
+					Some(_) => Some( browser_window_invoke_batch_handler as ExternalBatchInvocationHandlerFn )
+				};
+				// The threaded handler has data of its own, because the worker pool may still be using it after the browser window is gone
+				#[cfg(feature = "threadsafe")]
+				let c_threaded_handler = threaded_handler.map(|handler| (
+					browser_window_invoke_threaded_handler as ExternalThreadedInvocationHandlerFn,
+					free_threaded_handler as HandlerDataFreeFn,
+					Box::into_raw( Box::new( handler ) ) as *mut ()
+				) );
+				#[cfg(not(feature = "threadsafe"))]
+				let c_threaded_handler = None;
 				let user_data = Box::into_raw( Box::new(
 					BrowserUserData {
 						handler: match handler {
 							Some(f) => f,
 							None => Box::new(|_,_,_| Box::pin(async {}))
-						}
+						},
+						value_handler,
+						binary_handler,
+						native_handler,
+						batch_handler
 					}
 				) );
-				let callback_data: *mut Box<dyn FnOnce( BrowserWindowHandle )> = Box::into_raw( Box::new( Box::new(on_created ) ) );
-
-				// Convert options to FFI structs
-				let window_options = WindowOptions {
-					borders: window.borders,
-					minimizable: window.minimizable,
-					resizable: window.resizable
-				};
-				let other_options = BrowserWindowOptions {
-					dev_tools: if dev_tools {1} else {0},
-					resource_path: "".into()
+				// The events can only be handed over once the browser window exists, and are freed together with it
+				let on_created = move |handle: BrowserWindowHandle| {
+					if !events.is_empty() {
+						handle.inner.set_event_handler( Some( (
+							browser_window_event_handler as EventHandlerFn,
+							free_handler_data::<BrowserWindowEvents> as HandlerDataFreeFn,
+							Box::into_raw( events ) as *mut ()
+						) ) );
+					}
+					on_created( handle );
 				};
+				let callback_data: *mut Box<dyn FnOnce( BrowserWindowHandle )> = Box::into_raw( Box::new( Box::new(on_created ) ) );
 
-				BrowserWindowImpl::new(
-					app.inner,
-					parent_handle,
+				BrowserWindowParts {
+					parent,
 					source,
+					is_html,
 					title,
-					window.width,
-					window.height,
-					&window_options,
-					&other_options,
-					browser_window_invoke_handler,
-					user_data as _,
-					browser_window_created_callback,
-					callback_data as _
-				);
+					width: window.width,
+					height: window.height,
+					window_options,
+					other_options,
+					structured_handler,
+					binary_handler: c_binary_handler,
+					native_handler: c_native_handler,
+					batch_handler: c_batch_handler,
+					threaded_handler: c_threaded_handler,
+					request_context,
+					user_data: user_data as _,
+					callback_data: callback_data as _
+				}
 			}
 		}
 	}
 }
 
+/// What a browser window is created with, taken out of its builder.
+/// The spec of the browser window refers to it, so it needs to stay around until the browser window has been requested.
+struct BrowserWindowParts {
+	parent: WindowImpl,
+	source: String,
+	is_html: bool,
+	title: String,
+	width: Option<u32>,
+	height: Option<u32>,
+	window_options: WindowOptions,
+	other_options: BrowserWindowOptions,
+	structured_handler: Option<ExternalStructuredInvocationHandlerFn>,
+	binary_handler: Option<ExternalBinaryInvocationHandlerFn>,
+	native_handler: Option<ExternalNativeInvocationHandlerFn>,
+	batch_handler: Option<ExternalBatchInvocationHandlerFn>,
+	threaded_handler: Option<(ExternalThreadedInvocationHandlerFn, HandlerDataFreeFn, *mut ())>,
+	request_context: Option<RequestContext>,
+	user_data: *mut (),
+	callback_data: *mut ()
+}
+
+impl BrowserWindowParts {
+
+	fn spec( &self ) -> BrowserWindowSpec<'_> {
+		BrowserWindowSpec {
+			parent: self.parent,
+			source: browser_window::Source {
+				data: self.source.as_str().into(),
+				is_html: self.is_html as _
+			},
+			title: &self.title,
+			width: self.width,
+			height: self.height,
+			window_options: &self.window_options,
+			browser_window_options: &self.other_options,
+			handler: browser_window_invoke_handler,
+			structured_handler: self.structured_handler,
+			binary_handler: self.binary_handler,
+			native_handler: self.native_handler,
+			batch_handler: self.batch_handler,
+			threaded_handler: self.threaded_handler,
+			request_context: self.request_context.as_ref().map(|context| &context.inner ),
+			user_data: self.user_data,
+			creation_callback: browser_window_created_callback,
+			callback_data: self.callback_data
+		}
+	}
+}
+
 impl Deref for BrowserWindowBuilder {
 	type Target = WindowBuilder;
 
@@ -327,7 +734,7 @@ unsafe fn browser_window_invoke_handler( inner_handle: BrowserWindowImpl, cmd: &
 	let data = &mut *data_ptr;
 
 	match data {
-		BrowserUserData{ handler } => {
+		BrowserUserData{ handler, .. } => {
 			let outer_handle = BrowserWindowHandle::new( inner_handle );
 
 			let future = handler( outer_handle, cmd.into(), args );
@@ -336,6 +743,96 @@ unsafe fn browser_window_invoke_handler( inner_handle: BrowserWindowImpl, cmd: &
 	}
 }
 
+unsafe fn browser_window_invoke_value_handler( inner_handle: BrowserWindowImpl, cmd: &str, args: Vec<JsValue> ) {
+
+	let data_ptr: *mut BrowserUserData = inner_handle.user_data() as _;
+	let data = &mut *data_ptr;
+
+	if let Some( handler ) = data.value_handler.as_mut() {
+		let outer_handle = BrowserWindowHandle::new( inner_handle );
+
+		let future = handler( outer_handle, cmd.into(), args );
+		outer_handle.app().spawn( future );
+	}
+}
+
+unsafe fn browser_window_invoke_binary_handler( inner_handle: BrowserWindowImpl, cmd: &str, data: &[u8] ) {
+
+	let data_ptr: *mut BrowserUserData = inner_handle.user_data() as _;
+	let user_data = &mut *data_ptr;
+
+	if let Some( handler ) = user_data.binary_handler.as_mut() {
+		let outer_handle = BrowserWindowHandle::new( inner_handle );
+
+		let future = handler( outer_handle, cmd.into(), data.to_vec() );
+		outer_handle.app().spawn( future );
+	}
+}
+
+unsafe fn browser_window_invoke_batch_handler( inner_handle: BrowserWindowImpl, calls: Vec<Invocation> ) {
+
+	let data_ptr: *mut BrowserUserData = inner_handle.user_data() as _;
+	let data = &mut *data_ptr;
+
+	if let Some( handler ) = data.batch_handler.as_mut() {
+		let outer_handle = BrowserWindowHandle::new( inner_handle );
+
+		let future = handler( outer_handle, calls );
+		outer_handle.app().spawn( future );
+	}
+}
+
+unsafe fn browser_window_invoke_native_handler( inner_handle: BrowserWindowImpl, cmd: &str, args: Vec<String>, request_id: u32 ) {
+
+	let data_ptr: *mut BrowserUserData = inner_handle.user_data() as _;
+	let data = &mut *data_ptr;
+
+	if let Some( handler ) = data.native_handler.as_mut() {
+		let outer_handle = BrowserWindowHandle::new( inner_handle );
+
+		let future = handler( outer_handle, cmd.into(), args, InvocationReply::new( outer_handle, request_id ) );
+		outer_handle.app().spawn( future );
+	}
+}
+
+#[cfg(feature = "threadsafe")]
+unsafe fn browser_window_invoke_threaded_handler( inner_handle: BrowserWindowImpl, data: *mut (), cmd: &str, args: Vec<String> ) {
+
+	let handler = &*(data as *const BrowserJsThreadedInvocationHandler);
+	let outer_handle = BrowserWindowThreaded::new( BrowserWindowHandle::new( inner_handle ) );
+
+	// There is no runtime on the worker threads, so the future is driven on the spot
+	block_on( handler( outer_handle, cmd.into(), args ) );
+}
+
+#[cfg(feature = "threadsafe")]
+unsafe fn free_threaded_handler( data: *mut () ) {
+	drop( Box::from_raw( data as *mut BrowserJsThreadedInvocationHandler ) );
+}
+
+/// Runs the future on the current thread until it has completed, parking the thread whenever it is pending.
+#[cfg(feature = "threadsafe")]
+fn block_on<F: Future>( future: F ) -> F::Output {
+
+	struct ThreadWaker( thread::Thread );
+
+	impl Wake for ThreadWaker {
+		fn wake( self: Arc<Self> ) {
+			self.0.unpark();
+		}
+	}
+
+	let mut future = Box::pin( future );
+	let waker = Waker::from( Arc::new( ThreadWaker( thread::current() ) ) );
+	let mut context = Context::from_waker( &waker );
+	loop {
+		if let Poll::Ready( output ) = future.as_mut().poll( &mut context ) {
+			return output;
+		}
+		thread::park();
+	}
+}
+
 // This external C function will be given as the callback to the bw_BrowserWindow_new function, to be invoked when the browser window has been created
 /*unsafe extern "C" fn ffi_browser_window_created_callback( inner_handle: *mut bw_BrowserWindow, data: *mut c_void ) {
 
@@ -347,6 +844,21 @@ unsafe fn browser_window_invoke_handler( inner_handle: BrowserWindowImpl, cmd: &
 	data( outer_handle )
 }*/
 
+/// Passes an event of the page on to the handlers that have been registered for it with the builder.
+unsafe fn browser_window_event_handler( inner_handle: BrowserWindowImpl, data: *mut (), event: &PageEvent ) {
+	let events = &mut *(data as *mut BrowserWindowEvents);
+	let handle = BrowserWindowHandle::new( inner_handle );
+	let app = handle.app();
+
+	match event {
+		PageEvent::LoadStart => events.on_load_start.invoke( &app, &handle ),
+		PageEvent::LoadEnd( http_status ) => events.on_load_end.invoke( &app, &LoadEndEventArgs { handle, http_status: *http_status } ),
+		PageEvent::UrlChange( url ) => events.on_url_change.invoke( &app, &UrlChangeEventArgs { handle, url: url.clone() } ),
+		PageEvent::TitleChange( title ) => events.on_title_change.invoke( &app, &TitleChangeEventArgs { handle, title: title.clone() } ),
+		PageEvent::Progress( progress ) => events.on_progress.invoke( &app, &ProgressEventArgs { handle, progress: *progress } )
+	}
+}
+
 unsafe fn browser_window_created_callback( inner_handle: BrowserWindowImpl, data: *mut () ) {
 
 	let data_ptr = data as *mut Box<dyn FnOnce( BrowserWindowHandle )>;
@@ -355,4 +867,14 @@ unsafe fn browser_window_created_callback( inner_handle: BrowserWindowImpl, data
 	let outer_handle = BrowserWindowHandle::new( inner_handle );
 
 	func( outer_handle )
-}
\ No newline at end of file
+}
+
+unsafe fn browser_windows_created_callback( handles: &[BrowserWindowImpl], data: *mut () ) {
+
+	let tx = Box::from_raw( data as *mut oneshot::Sender<Vec<BrowserWindowHandle>> );
+
+	let outer_handles = handles.iter().map(|inner_handle| BrowserWindowHandle::new( *inner_handle ) ).collect();
+	if let Err(_) = tx.send( outer_handles ) {
+		panic!("Unable to send browser handles back")
+	}
+}
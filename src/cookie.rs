@@ -1,11 +1,14 @@
 //! Module for dealing with cookies.
 
 use browser_window_core::cookie::*;
+pub use browser_window_core::cookie::{CookieFieldRanges, CookieFields, CookieFilter};
 use futures_channel::oneshot;
 
 use std::{
 	marker::PhantomData,
-	ops::*
+	mem::ManuallyDrop,
+	ops::*,
+	ptr
 };
 
 
@@ -71,6 +74,45 @@ impl<'a> CookieIterator<'a> {
 		rx.await.unwrap()
 	}
 
+	/// Like `next`, but only lends the cookie to `map`, and returns whatever `map` returns.
+	/// This saves a copy of every cookie, which helps when scanning through a lot of them.
+	pub async fn next_with<F,R>(&mut self, map: F) -> Option<R> where
+		F: FnOnce(&Cookie) -> R
+	{
+		let (tx, rx) = oneshot::channel::<R>();
+
+		// Without a cookie, the sender is dropped, which ends the iteration
+		let more = self._next_borrowed(|cookie| {
+			if let Some(cookie) = cookie {
+				if let Err(_) = tx.send(map(cookie)) {
+					panic!("unable to send cookie iterator next result back");
+				}
+			}
+		});
+
+		if !more {
+			return None;
+		}
+
+		rx.await.ok()
+	}
+
+	fn _next_borrowed<H>(&mut self, on_next: H) -> bool where
+		H: FnOnce(Option<&Cookie>)
+	{
+		let data = Box::into_raw(Box::new(
+			on_next
+		));
+
+		let called_closure = self.inner.next_borrowed(cookie_iterator_next_borrowed_handler::<H>, data as _);
+
+		if !called_closure {
+			drop(unsafe { Box::from_raw(data) });
+		}
+
+		called_closure
+	}
+
 	fn _next<H>(&mut self, on_next: H) -> bool where
 		H: FnOnce(Option<Cookie>)
 	{
@@ -129,6 +171,17 @@ impl CookieJar {
 		rx.await.unwrap()
 	}
 
+	/// Like `delete`, but deletes the cookies of all given `names` at once, and returns the total number of deleted cookies.
+	/// This takes only one completion for all names, instead of one per name.
+	pub async fn delete_many(&mut self, url: &str, names: &[&str]) -> usize {
+		let (tx, rx) = oneshot::channel::<usize>();
+
+		let data = Box::into_raw(Box::new(tx));
+		self.inner.delete_many(url, names, cookie_count_callback, data as _);
+
+		rx.await.unwrap()
+	}
+
 	/// Like `delete`, but with `url` set empty.
 	pub async fn delete_all(&mut self, name: &str) -> usize {
 		self.delete("", name).await
@@ -162,8 +215,12 @@ impl CookieJar {
 	}
 
 	pub(in crate) fn global() -> Self {
+		Self::new(CookieJarImpl::global())
+	}
+
+	pub(in crate) fn new(inner: CookieJarImpl) -> Self {
 		Self {
-			inner: CookieJarImpl::global()
+			inner
 		}
 	}
 
@@ -188,6 +245,35 @@ impl CookieJar {
 		}
 	}
 
+	/// Counts the cookies that match `filter`, without copying any of them.
+	/// If `url` is empty, the cookies of all urls are counted.
+	pub async fn count(&self, url: &str, include_http_only: bool, filter: &CookieFilter<'_>) -> usize {
+		let (tx, rx) = oneshot::channel::<usize>();
+
+		let data = Box::into_raw(Box::new(tx));
+		self.inner.count(url, include_http_only, filter, cookie_count_callback, data as _);
+
+		rx.await.unwrap()
+	}
+
+	/// Returns a `CookieIterator` that only visits the cookies that match `filter`.
+	/// Only the fields selected by `filter.fields` are copied, the others are empty.
+	/// If `url` is empty, the cookies of all urls are visited.
+	///
+	/// # Example
+	/// ```ignore
+	/// let filter = CookieFilter { domain: "example.com", fields: CookieFields::NAME | CookieFields::VALUE, ..Default::default() };
+	/// let mut iterator = cookie_jar.iter_filtered("", true, &filter);
+	/// ```
+	pub fn iter_filtered<'a>(&'a self, url: &str, include_http_only: bool, filter: &CookieFilter<'_>) -> CookieIterator<'a> {
+		let inner = self.inner.iterator_filtered(url, include_http_only, filter);
+
+		CookieIterator {
+			inner,
+			_phantom: PhantomData
+		}
+	}
+
 	/// Returns a `CookieIterator` that iterators over cookies asynchronously.
 	/// Like `iter`, but iterates over all cookies from any url.
 	pub fn iter_all<'a>(&'a self) -> CookieIterator<'a> {
@@ -207,6 +293,18 @@ impl CookieJar {
 		self.inner.store(url.into(), &cookie.inner, Some(cookie_store_callback::<'a,H>), data as _);
 	}
 
+	/// Stores all given `cookies` for the given `url`, and returns how many of them have been stored.
+	/// This takes only one completion for all cookies, which is a lot faster than calling `store` for every one of them, like when restoring a session.
+	pub async fn store_many(&mut self, url: &str, cookies: &[Cookie]) -> usize {
+		let (tx, rx) = oneshot::channel::<usize>();
+
+		let inner_cookies: Vec<&CookieImpl> = cookies.iter().map(|c| &c.inner).collect();
+		let data = Box::into_raw(Box::new(tx));
+		self.inner.store_many(url, &inner_cookies, cookie_count_callback, data as _);
+
+		rx.await.unwrap()
+	}
+
 	/// Stores the given `cookie` for the given `url`.
 	pub async fn store(&mut self, url: &str, cookie: &Cookie) -> Result<(), CookieStorageError> {
 		let (tx, rx) = oneshot::channel::<Result<(), CookieStorageError>>();
@@ -227,6 +325,13 @@ impl Drop for CookieJar {
 
 
 
+/// Sends the number of stored or deleted cookies through the oneshot channel given as the callback data.
+unsafe fn cookie_count_callback(_handle: CookieJarImpl, cb_data: *mut (), count: usize) {
+	let tx = Box::from_raw(cb_data as *mut oneshot::Sender<usize>);
+
+	tx.send(count).expect("unable to send back cookie count");
+}
+
 unsafe fn cookie_delete_callback<'a, H>(_handle: CookieJarImpl, cb_data: *mut (), deleted: usize) where
 	H: FnOnce(usize) + 'a
 {
@@ -252,4 +357,20 @@ unsafe fn cookie_iterator_next_handler<H>(_handle: CookieIteratorImpl, cb_data:
 	let data: Box<H> = Box::from_raw(data_ptr);
 
 	(*data)(cookie.map(|c| Cookie {inner: c}));
+}
+
+unsafe fn cookie_iterator_next_borrowed_handler<H>(_handle: CookieIteratorImpl, cb_data: *mut (), cookie: Option<&CookieImpl>) where
+	H: FnOnce(Option<&Cookie>)
+{
+	let data_ptr = cb_data as *mut H;
+	let data: Box<H> = Box::from_raw(data_ptr);
+
+	// The cookie is only borrowed, so the `Cookie` wrapper must not free it when it is dropped
+	match cookie {
+		None => (*data)(None),
+		Some(cookie) => {
+			let borrowed = ManuallyDrop::new(Cookie {inner: ptr::read(cookie)});
+			(*data)(Some(&borrowed));
+		}
+	}
 }
\ No newline at end of file
@@ -39,7 +39,9 @@ pub enum DelegateError {
 	/// This happens when the application has already exited for example.
 	RuntimeNotAvailable,
 	/// The delegated closure has panicked.
-	ClosurePanicked
+	ClosurePanicked,
+	/// The browser window that the closure was delegated to has been closed before the closure could be executed.
+	BrowserWindowClosed
 }
 
 /// This future executes a closure on the GUI thread and returns the result.
@@ -8,12 +8,79 @@ use std::{
 	pin::Pin
 };
 
+use crate::application::ApplicationHandle;
 
 
+
+// Defines the builder methods that register a handler to the event `$name` of `self.events`, a plain and an async one.
+macro_rules! _def_event {
+	( $(#[$metas:meta])*, $args_type:ty, $name:ident, $name_async:ident ) => {
+		$(#[$metas])*
+		#[cfg(not(feature = "threadsafe"))]
+		pub fn $name<H>( &mut self, handler: H ) -> &mut Self where
+			H: FnMut( &$args_type ) + 'static
+		{
+			self.events.$name.register( handler );
+			self
+		}
+
+		$(#[$metas])*
+		#[cfg(feature = "threadsafe")]
+		pub fn $name<H>( &mut self, handler: H ) -> &mut Self where
+			H: FnMut( &$args_type ) + Send + 'static
+		{
+			self.events.$name.register( handler );
+			self
+		}
+
+		$(#[$metas])*
+		#[cfg(not(feature = "threadsafe"))]
+		pub fn $name_async<H,F>( &mut self, handler: H ) -> &mut Self where
+			H: FnMut( &$args_type ) -> F + 'static,
+			F: std::future::Future<Output=()> + 'static
+		{
+			self.events.$name.register_async( handler );
+			self
+		}
+
+		$(#[$metas])*
+		#[cfg(feature = "threadsafe")]
+		pub fn $name_async<H,F>( &mut self, handler: H ) -> &mut Self where
+			H: FnMut( &$args_type ) -> F + Send + 'static,
+			F: std::future::Future<Output=()> + 'static
+		{
+			self.events.$name.register_async( handler );
+			self
+		}
+	};
+}
+
+macro_rules! def_event {
+	( $(#[$metas:meta])* $args_type:ty, $name:ident, $name_async:ident ) => {
+		_def_event!( $(#[$metas])*, $args_type, $name, $name_async );
+	};
+	
+	( $(#[$metas:meta])* $name:ident, $name_async:ident ) => {
+		_def_event!( $(#[$metas])*, WindowHandle, $name, $name_async );
+	};
+}
+
+
+
+#[cfg(not(feature = "threadsafe"))]
+type SyncEventHandler<'a,A> = Box<dyn FnMut( &A ) + 'a>;
+#[cfg(feature = "threadsafe")]
+type SyncEventHandler<'a,A> = Box<dyn FnMut( &A ) + Send + 'a>;
 #[cfg(not(feature = "threadsafe"))]
-type EventHandler<'a,A> = Box<dyn FnMut( &A ) -> Pin<Box<dyn Future<Output=()> + 'a>> + 'a>;
+type AsyncEventHandler<'a,A> = Box<dyn FnMut( &A ) -> Pin<Box<dyn Future<Output=()> + 'a>> + 'a>;
 #[cfg(feature = "threadsafe")]
-type EventHandler<'a,A> = Box<dyn FnMut( &A ) -> Pin<Box<dyn Future<Output=()> + 'a>> + Send + 'a>;
+type AsyncEventHandler<'a,A> = Box<dyn FnMut( &A ) -> Pin<Box<dyn Future<Output=()> + 'a>> + Send + 'a>;
+
+// Plain handlers are kept apart from async ones, so that invoking them doesn't need to box a future that does nothing.
+enum EventHandler<'a,A> {
+	Sync( SyncEventHandler<'a,A> ),
+	Async( AsyncEventHandler<'a,A> )
+}
 
 pub struct Event<'a,A> {
 	handlers: Vec<EventHandler<'a,A>>
@@ -21,36 +88,42 @@ pub struct Event<'a,A> {
 
 
 
-impl<'a,A> Event<'a,A> {
+impl<A> Event<'static,A> {
 
 	/// Invokes the event, which calls all handlers that have been registered to this event.
-	pub(in crate) fn invoke( &mut self, args: &A  ) {
+	/// The futures of the async handlers are spawned on the runtime of `app`.
+	pub(in crate) fn invoke( &mut self, app: &ApplicationHandle, args: &A ) {
 
 		for h in self.handlers.iter_mut() {
-			h( args );
+			match h {
+				EventHandler::Sync( handler ) => handler( args ),
+				EventHandler::Async( handler ) => app.spawn( handler( args ) )
+			}
 		}
 	}
+}
+
+impl<'a,A> Event<'a,A> {
+
+	/// Whether no handlers have been registered to this event.
+	pub(in crate) fn is_empty( &self ) -> bool {
+		self.handlers.is_empty()
+	}
 
 	/// Register a closure to be invoked for this event.
 	#[cfg(not(feature = "threadsafe"))]
-	pub fn register<H>( &mut self, mut handler: H ) where
+	pub fn register<H>( &mut self, handler: H ) where
 		H: FnMut( &A ) + 'a
 	{
-		self.handlers.push(Box::new(move |args| {
-			handler( args );
-			Box::pin(async {})
-		}));
+		self.handlers.push( EventHandler::Sync( Box::new( handler ) ) );
 	}
 
 	/// Register a closure to be invoked for this event.
 	#[cfg(feature = "threadsafe")]
-	pub fn register<H>( &mut self, mut handler: H ) where
+	pub fn register<H>( &mut self, handler: H ) where
 		H: FnMut( &A ) + Send + 'a
 	{
-		self.handlers.push(Box::new(move |args| {
-			handler( args );
-			Box::pin(async {})
-		}));
+		self.handlers.push( EventHandler::Sync( Box::new( handler ) ) );
 	}
 
 	/// Register an 'async closure' to be invoked for this event.
@@ -66,7 +139,7 @@ impl<'a,A> Event<'a,A> {
 		H: FnMut( &A ) -> F + 'a,
 		F: Future<Output=()> + 'a
 	{
-		self.handlers.push(Box::new(move |args| Box::pin( handler( args ) ) ) );
+		self.handlers.push( EventHandler::Async( Box::new(move |args| Box::pin( handler( args ) ) ) ) );
 	}
 
 	/// Register an 'async closure' to be invoked for this event.
@@ -82,7 +155,7 @@ impl<'a,A> Event<'a,A> {
 		H: FnMut( &A ) -> F + Send + 'a,
 		F: Future<Output=()> + 'a
 	{
-		self.handlers.push(Box::new(move |args| Box::pin( handler( args ) ) ) );
+		self.handlers.push( EventHandler::Async( Box::new(move |args| Box::pin( handler( args ) ) ) ) );
 	}
 }
 
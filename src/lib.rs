@@ -19,6 +19,8 @@
 
 #[macro_use]
 mod prop;
+#[macro_use]
+pub mod event;
 #[cfg(test)]
 mod tests;
 
@@ -26,8 +28,9 @@ pub mod application;
 pub mod browser;
 pub mod cookie;
 pub mod error;
-pub mod event;
 pub mod prelude;
+pub mod request_context;
+pub mod resource_pack;
 pub mod window;
 
 
@@ -0,0 +1,52 @@
+//! Module for isolated browsing sessions.
+//!
+//! By default, all browser windows share the same cookies and cache.
+//! Browser windows that are given a [`RequestContext`] only share them with the other browser windows of that same request context.
+//! Dropping all of them discards the whole session at once, which is a lot cheaper than clearing its cookies one by one.
+
+use browser_window_core::request_context::*;
+
+use crate::cookie::CookieJar;
+
+
+
+/// A handle to an isolated browsing session, with its own cookies and cache.
+///
+/// Cloning it gives another handle to the same session.
+pub struct RequestContext {
+	pub(in crate) inner: RequestContextImpl
+}
+
+// CEF is able to use request contexts from any thread.
+unsafe impl Send for RequestContext {}
+unsafe impl Sync for RequestContext {}
+
+
+
+impl RequestContext {
+
+	/// The cookie jar that only contains the cookies of this request context.
+	pub fn cookie_jar(&self) -> CookieJar {
+		CookieJar::new(self.inner.cookie_jar())
+	}
+
+	pub(in crate) fn new(cache_path: &str) -> Self {
+		Self {
+			inner: RequestContextImpl::new(cache_path)
+		}
+	}
+}
+
+impl Clone for RequestContext {
+	fn clone(&self) -> Self {
+		Self {
+			inner: self.inner.copy()
+		}
+	}
+}
+
+impl Drop for RequestContext {
+	fn drop(&mut self) {
+		self.inner.free();
+	}
+}
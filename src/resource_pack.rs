@@ -0,0 +1,167 @@
+//! Module for bundling resources into a single file at build time.
+//!
+//! A resource pack holds all the files of an app, with an index that is sorted by path.
+//! Given to [`ApplicationSettings::resource_pack`](../application/struct.ApplicationSettings.html#structfield.resource_pack), it is mapped into memory once at startup, and every request to the `app://` scheme is served straight from that mapping.
+//! There are no files to open or read for any of the requests.
+//!
+//! # Example
+//! In a build script:
+//! ```ignore
+//! use browser_window::resource_pack::ResourcePackBuilder;
+//!
+//! let mut pack = ResourcePackBuilder::new();
+//! pack.add_dir( "bundle", "resources".as_ref() ).unwrap();
+//! pack.write_to_file( std::path::Path::new( &std::env::var("OUT_DIR").unwrap() ).join( "resources.pack" ) ).unwrap();
+//! ```
+//! After which `app://bundle/index.html` serves `resources/index.html`.
+
+use std::{
+	collections::BTreeMap,
+	convert::TryFrom,
+	fs,
+	io::{self, Write},
+	path::Path
+};
+
+
+
+const MAGIC: &[u8; 4] = b"BWPK";
+const VERSION: u32 = 1;
+const HEADER_SIZE: usize = 16;
+const ENTRY_SIZE: usize = 32;
+
+/// How the data of a resource has been compressed.
+/// It is sent as the `Content-Encoding` of the response.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum ContentEncoding {
+	Identity = 0,
+	Gzip = 1,
+	Brotli = 2
+}
+
+/// Collects resources, and writes them into a resource pack.
+pub struct ResourcePackBuilder {
+	// Sorted by path, which is the order in which the index needs to be written
+	entries: BTreeMap<String, PackEntry>
+}
+
+struct PackEntry {
+	data: Vec<u8>,
+	mime_type: String,
+	encoding: ContentEncoding
+}
+
+
+
+impl ResourcePackBuilder {
+
+	pub fn new() -> Self {
+		Self {
+			entries: BTreeMap::new()
+		}
+	}
+
+	/// Adds a resource at `path`, which starts with its host, like `bundle/index.html`.
+	/// If `mime_type` is empty, it is derived from the extension of the path when the resource is served.
+	/// A resource that has been added at the same path before, is replaced.
+	pub fn add( &mut self, path: &str, data: Vec<u8>, mime_type: &str, encoding: ContentEncoding ) -> &mut Self {
+		self.entries.insert( path.to_owned(), PackEntry {
+			data,
+			mime_type: mime_type.to_owned(),
+			encoding
+		} );
+		self
+	}
+
+	/// Adds all files inside `directory` and its subdirectories, at the given host.
+	///
+	/// Files that have been compressed beforehand, like `main.js.gz` or `main.js.br`, are served at the path without the extension.
+	/// They take the place of the uncompressed file, if it exists.
+	pub fn add_dir( &mut self, host: &str, directory: &Path ) -> io::Result<&mut Self> {
+		self.add_dir_recursive( host, directory )?;
+		Ok( self )
+	}
+
+	fn add_dir_recursive( &mut self, prefix: &str, directory: &Path ) -> io::Result<()> {
+		for entry in fs::read_dir( directory )? {
+			let entry = entry?;
+			let name = entry.file_name().to_string_lossy().into_owned();
+			let path = format!( "{}/{}", prefix, name );
+
+			if entry.file_type()?.is_dir() {
+				self.add_dir_recursive( &path, &entry.path() )?;
+				continue
+			}
+
+			let data = fs::read( entry.path() )?;
+			if let Some( original ) = path.strip_suffix( ".gz" ) {
+				self.add( original, data, "", ContentEncoding::Gzip );
+			}
+			else if let Some( original ) = path.strip_suffix( ".br" ) {
+				self.add( original, data, "", ContentEncoding::Brotli );
+			}
+			// Compressed files have precedence, regardless of which one is read first
+			else if self.entries.get( &path ).map( |e| e.encoding == ContentEncoding::Identity ).unwrap_or( true ) {
+				self.add( &path, data, "", ContentEncoding::Identity );
+			}
+		}
+		Ok(())
+	}
+
+	/// Writes the resource pack.
+	pub fn write<W: Write>( &self, writer: &mut W ) -> io::Result<()> {
+		let too_large = || io::Error::new( io::ErrorKind::InvalidInput, "resource pack is too large" );
+
+		// The index comes first, followed by all strings, followed by all data
+		let strings_start = HEADER_SIZE + self.entries.len() * ENTRY_SIZE;
+		let strings_size: usize = self.entries.iter().map( |(path, e)| path.len() + e.mime_type.len() ).sum();
+		let data_start = strings_start + strings_size;
+
+		let mut header = Vec::with_capacity( strings_start );
+		header.extend_from_slice( MAGIC );
+		header.extend_from_slice( &VERSION.to_le_bytes() );
+		header.extend_from_slice( &u32::try_from( self.entries.len() ).map_err( |_| too_large() )?.to_le_bytes() );
+		header.extend_from_slice( &0u32.to_le_bytes() );
+
+		let mut string_offset = strings_start;
+		let mut data_offset = data_start as u64;
+		for (path, entry) in &self.entries {
+			let path_offset = u32::try_from( string_offset ).map_err( |_| too_large() )?;
+			let mime_offset = u32::try_from( string_offset + path.len() ).map_err( |_| too_large() )?;
+			let mime_len = u16::try_from( entry.mime_type.len() ).map_err( |_| too_large() )?;
+			string_offset += path.len() + entry.mime_type.len();
+
+			header.extend_from_slice( &path_offset.to_le_bytes() );
+			header.extend_from_slice( &(path.len() as u32).to_le_bytes() );
+			header.extend_from_slice( &data_offset.to_le_bytes() );
+			header.extend_from_slice( &(entry.data.len() as u64).to_le_bytes() );
+			header.extend_from_slice( &mime_offset.to_le_bytes() );
+			header.extend_from_slice( &mime_len.to_le_bytes() );
+			header.push( entry.encoding as u8 );
+			header.push( 0 );
+			data_offset += entry.data.len() as u64;
+		}
+
+		for (path, entry) in &self.entries {
+			header.extend_from_slice( path.as_bytes() );
+			header.extend_from_slice( entry.mime_type.as_bytes() );
+		}
+		writer.write_all( &header )?;
+
+		for entry in self.entries.values() {
+			writer.write_all( &entry.data )?;
+		}
+		Ok(())
+	}
+
+	/// Writes the resource pack to the file at the given path.
+	pub fn write_to_file<P: AsRef<Path>>( &self, path: P ) -> io::Result<()> {
+		let mut file = io::BufWriter::new( fs::File::create( path )? );
+		self.write( &mut file )?;
+		file.flush()
+	}
+}
+
+impl Default for ResourcePackBuilder {
+	fn default() -> Self { Self::new() }
+}
@@ -2,6 +2,7 @@ use crate::application::*;
 use crate::browser::*;
 use crate::cookie::*;
 use crate::prelude::*;
+use crate::resource_pack::*;
 
 use std::{
 	env,
@@ -19,7 +20,9 @@ fn tests() {
 
 	let settings = ApplicationSettings {
 		engine_seperate_executable_path: Some(exec_path),
-		resource_dir: None
+		resource_dir: None,
+		windowless_rendering: true,
+		..Default::default()
 	};
 
 	let app = Application::initialize(&settings).expect("unable to initialize application");
@@ -41,24 +44,87 @@ fn threaded_tests(application: &Application) {
 	// First run our own runtime on the main thread
 	bw_runtime.run(|_app| {
 		let app = _app.into_threaded();
+		let gui_thread = std::thread::current().id();
 
 		// Spawn the main logic into the tokio runtime
 		tokio_runtime.spawn(async move{
 
 			// TODO: run tests here...
+			threaded_dispatch_priority(&app).await;
+			threaded_eval_js(app).await;
+			threaded_handler(app, gui_thread).await;
 
 			app.exit(0);
 		});
 	});
 }
 
+#[cfg(feature = "threadsafe")]
+async fn threaded_dispatch_priority(app: &ApplicationHandleThreaded) {
+	// Work of every priority eventually gets executed
+	for priority in [DispatchPriority::High, DispatchPriority::Normal, DispatchPriority::Idle] {
+		let (tx, rx) = futures_channel::oneshot::channel();
+		assert!(app.dispatch_with_priority(move |_| { tx.send(()).unwrap(); }, priority));
+		rx.await.unwrap();
+	}
+}
+
+#[cfg(feature = "threadsafe")]
+async fn threaded_eval_js(app: ApplicationHandleThreaded) {
+	let mut bwb = BrowserWindowBuilder::new( Source::Url("https://www.duckduckgo.com/".into()) );
+	bwb.title("Threaded Eval Test");
+	let bw = bwb.build_threaded( app ).await.unwrap();
+
+	// Evaluated straight from the tokio thread, without delegating to the GUI thread
+	assert!(bw.eval_js("1 + 1").await.unwrap() == "2");
+	assert!(bw.metrics().unwrap().messages_sent > 0);
+
+	bw.close();
+}
+
+#[cfg(feature = "threadsafe")]
+async fn threaded_handler(app: ApplicationHandleThreaded, gui_thread: std::thread::ThreadId) {
+	let (tx, rx) = futures_channel::oneshot::channel();
+	let tx = std::sync::Mutex::new(Some(tx));
+
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Threaded Handler Test");
+	bwb.async_handler_threaded(move |_, cmd, args| {
+		if let Some(tx) = tx.lock().unwrap().take() {
+			let _ = tx.send((cmd, args, std::thread::current().id()));
+		}
+		async {}
+	});
+	let bw = bwb.build_threaded( app ).await.unwrap();
+
+	// The call is handled on the worker pool, and not on the GUI thread
+	bw.eval_js("invoke_extern('parse', 1)").await.unwrap();
+	let (cmd, args, thread) = rx.await.unwrap();
+	assert!(cmd == "parse" && args == vec!["1".to_string()]);
+	assert!(thread != gui_thread);
+
+	bw.close();
+}
 
 fn async_tests(application: &Application) {
 	let runtime = application.start();
 	
 	let exit_code = runtime.run_async(|app| async move {
 		let bw = async_basic(app).await;
+		startup_metrics(app);
+		async_eval_js(&bw).await;
+		async_tracing(app, &bw).await;
 		async_cookies(app).await;
+		async_windowless(app).await;
+		async_prewarm(app).await;
+		async_native_handler(app).await;
+		async_batch_handler(app).await;
+		async_invoke_queue(app).await;
+		async_register_command(app).await;
+		async_page_stream(app).await;
+		async_build_many(app).await;
+		async_broadcast(app).await;
+		async_page_events(app).await;
 		//async_correct_parent_cleanup(app).await;
 
 		bw.close();
@@ -73,6 +139,282 @@ async fn async_basic(app: ApplicationHandle) -> BrowserWindow {
 	return bwb.build( app ).await;
 }
 
+fn startup_metrics(app: ApplicationHandle) {
+	let metrics = app.startup_metrics();
+	assert!(metrics.initialized.is_some() && metrics.ready.is_some());
+	assert!(metrics.first_browser_created >= metrics.first_browser_requested);
+	assert!(metrics.first_browser_requested >= metrics.first_window);
+}
+
+async fn async_eval_js(bw: &BrowserWindow) {
+	assert!(bw.eval_js("1 + 1").await.unwrap() == "2");
+	assert!(bw.eval_js_with_timeout("1 + 1", Some(Duration::from_secs(10))).await.unwrap() == "2");
+	let mut pending = bw.eval_js_with_timeout("1 + 1", None);
+	pending.cancel();
+	assert!(pending.await.unwrap_err().is_cancelled());
+
+	let value = bw.eval_js_value("[1, 'a', { b: true, c: undefined }]").await.unwrap();
+	assert!(value == JsValue::Array(vec![
+		JsValue::Number(1.0),
+		JsValue::String("a".into()),
+		JsValue::Object(vec![("b".into(), JsValue::Boolean(true))])
+	]));
+	assert!(bw.eval_js_value("undefined").await.unwrap() == JsValue::Undefined);
+
+	// Cyclic structures fail like with JSON.stringify, but objects that are referred to more than once don't
+	assert!(bw.eval_js_value("(() => { var o = {}; o.a = o; o.b = o; return o })()").await.is_err());
+	assert!(bw.eval_js_value("window").await.is_err());
+	let value = bw.eval_js_value("(() => { var a = [1]; return [a, a] })()").await.unwrap();
+	assert!(value == JsValue::Array(vec![JsValue::Array(vec![JsValue::Number(1.0)]); 2]));
+	// A getter that throws is left out
+	let value = bw.eval_js_value("({ a: 1, get b() { throw new Error() } })").await.unwrap();
+	assert!(value == JsValue::Object(vec![("a".into(), JsValue::Number(1.0))]));
+
+	// The cancelled evaluation isn't measured
+	let metrics = bw.metrics();
+	assert!(metrics.eval_js.count >= 4 && metrics.eval_js_execution.count >= 4);
+	assert!(metrics.eval_js.percentile(0.5) <= metrics.eval_js.max);
+	assert!(metrics.messages_received >= 4 && metrics.messages_sent >= 5);
+
+	let results = bw.eval_js_batch(&["1", "'two'", "undefined_variable"]).await;
+	assert!(results.len() == 3);
+	assert!(results[0].as_ref().unwrap() == "1");
+	assert!(results[1].as_ref().unwrap() == "two");
+	assert!(results[2].is_err());
+	assert!(bw.eval_js_batch(&[]).await.is_empty());
+
+	let concat = bw.register_script("concat.js", "(a, b) => a + b");
+	assert!(bw.invoke_script(concat, &["1", "2"]).await.unwrap() == "12");
+	assert!(bw.invoke_script(concat + 1, &[]).await.is_err());
+
+	let stats = bw.memory_stats().await;
+	let renderer = stats.renderer.expect("renderer memory has not been measured");
+	assert!(renderer.private_bytes > 0 && renderer.js_heap_used <= renderer.js_heap_total);
+	assert!(bw.app().memory_stats().browser_windows >= 1);
+	bw.app().trim_memory(MemoryPressure::Moderate);
+	assert!(bw.eval_js("1 + 1").await.unwrap() == "2");
+
+	// Intercepted requests are answered natively, without touching the network
+	bw.intercept_requests("https://www.duckduckgo.com/__bw_intercept/", 1024, &[], |request| Some(InterceptedResponse {
+		status: 200,
+		mime_type: "text/plain".into(),
+		body: request.method.as_bytes().to_vec(),
+		cacheable: true
+	}));
+	let xhr = "var x = new XMLHttpRequest(); x.open('GET', '/__bw_intercept/a', false); x.send(); x.responseText";
+	assert!(bw.eval_js(xhr).await.unwrap() == "GET");
+	bw.stop_intercepting_requests();
+}
+
+async fn async_tracing(app: ApplicationHandle, bw: &BrowserWindow) {
+	let path = env::temp_dir().join("browser-window-test-trace.json");
+	app.start_tracing(1024, "");
+	assert!(bw.eval_js("1 + 1").await.unwrap() == "2");
+	app.stop_tracing(&path).await.unwrap();
+
+	let trace = std::fs::read_to_string(&path).unwrap();
+	assert!(trace.contains("\"traceEvents\"") && trace.contains("\"eval_js_result\""));
+	let _ = std::fs::remove_file(&path);
+}
+
+async fn async_windowless(app: ApplicationHandle) {
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body style='background: red'></body>".into()) );
+	bwb.windowless(30).title("Windowless Test");
+	let bw = bwb.build( app ).await;
+
+	// A full frame is painted as soon as a paint handler is set
+	let (tx, rx) = futures_channel::oneshot::channel();
+	let mut tx = Some(tx);
+	bw.set_view_size(320, 240, 1.0);
+	bw.on_paint(move |frame| {
+		if !frame.is_popup {
+			if let Some(tx) = tx.take() {
+				let _ = tx.send((frame.width, frame.height, frame.buffer.len()));
+			}
+		}
+	});
+	assert!(rx.await.unwrap() == (320, 240, 320 * 240 * 4));
+
+	bw.remove_paint_handlers();
+	bw.close();
+}
+
+async fn async_prewarm(app: ApplicationHandle) {
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<p>pooled</p>".into()) );
+	bwb.title("Prewarm Test");
+	bwb.prewarm( app, 1, false );
+
+	// Whether or not the pooled browser window is ready already, the source should be loaded
+	let bw = bwb.build( app ).await;
+	assert!(bw.eval_js("1 + 1").await.unwrap() == "2");
+	bw.close();
+
+	BrowserWindowBuilder::new( Source::Html(String::new()) ).prewarm( app, 0, false );
+}
+
+async fn async_native_handler(app: ApplicationHandle) {
+	let (tx, rx) = futures_channel::oneshot::channel();
+	let tx = std::sync::Arc::new(std::sync::Mutex::new(Some(tx)));
+
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Native Handler Test");
+	bwb.async_native_handler(|_, cmd, args, reply| async move {
+		// Replies that are dropped reject the promise
+		if cmd == "echo" {
+			reply.resolve(&args.join(","));
+		}
+	});
+	bwb.async_handler(move |_, _, args| {
+		if let Some(tx) = tx.lock().unwrap().take() {
+			let _ = tx.send(args);
+		}
+		async {}
+	});
+	let bw = bwb.build( app ).await;
+
+	bw.exec_js("Promise.all([invoke_native('echo', 'a', 1), invoke_native('other').catch(e => e.message)]).then(r => invoke_extern('done', ...r))");
+	let results = rx.await.unwrap();
+	assert!(results[0] == "a,1" && results[1] == "the native handler has not replied");
+	bw.close();
+}
+
+async fn async_batch_handler(app: ApplicationHandle) {
+	let (tx, rx) = futures_channel::oneshot::channel();
+	let mut tx = Some(tx);
+
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Batch Handler Test");
+	bwb.async_batch_handler(move |_, calls| {
+		if let Some(tx) = tx.take() {
+			let _ = tx.send(calls);
+		}
+		async {}
+	});
+	let bw = bwb.build( app ).await;
+
+	// Calls made during the same task arrive together, including the ones made by its microtasks
+	bw.exec_js("for (let i = 0; i < 3; i++) invoke_extern('call', i); Promise.resolve().then(() => invoke_extern('later'))");
+	let calls = rx.await.unwrap();
+	assert!(calls.len() == 4);
+	assert!(calls[2] == Invocation { cmd: "call".into(), args: vec!["2".into()] } && calls[3].cmd == "later");
+	bw.close();
+}
+
+async fn async_invoke_queue(app: ApplicationHandle) {
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Invoke Queue Test");
+	bwb.async_handler(|_, _, _| async {});
+	let bw = bwb.build( app ).await;
+
+	// The page can't have more calls waiting than the limit, until the GUI thread has handled them
+	bw.set_invoke_queue_limit( Some(2), InvokeOverflow::Block );
+	let thrown = bw.eval_js("let n = 0; for (let i = 0; i < 5; i++) { try { invoke_extern('call', i) } catch (e) { n++ } } n").await.unwrap();
+	assert!(thrown == "3");
+	assert!(bw.metrics().invoke_queue_peak <= 2);
+	bw.close();
+}
+
+async fn async_broadcast(app: ApplicationHandle) {
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Broadcast Test");
+	let bw = bwb.build( app ).await;
+
+	assert!(app.broadcast("window.broadcasted = 1", &[], |_| false) == 0);
+	assert!(app.broadcast("window.broadcasted = 2", &[1, 2, 3], |_| true) >= 1);
+	assert!(bw.eval_js("window.broadcasted").await.unwrap() == "2");
+
+	bw.close();
+}
+
+async fn async_page_events(app: ApplicationHandle) {
+	let (tx, rx) = futures_channel::oneshot::channel();
+	let mut tx = Some(tx);
+
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Page Events Test");
+	bwb.on_title_change(move |args| {
+		if args.title == "Changed" {
+			if let Some(tx) = tx.take() {
+				let _ = tx.send(());
+			}
+		}
+	});
+	let bw = bwb.build( app ).await;
+
+	bw.exec_js("document.title = 'Changed'");
+	rx.await.unwrap();
+	assert!(bw.page_title() == "Changed");
+	assert!(!bw.url().is_empty());
+
+	bw.close();
+}
+
+async fn async_register_command(app: ApplicationHandle) {
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Register Command Test");
+	bwb.async_handler(|_, cmd, _| async move { panic!("{} should have been routed to its command", cmd) });
+	let bw = bwb.build( app ).await;
+
+	let (tx, rx) = futures_channel::oneshot::channel();
+	let mut tx = Some(tx);
+	let mut received = Vec::new();
+	let id = bw.register_command("ping", move |_, args| {
+		received.push(args);
+		if received.len() == 2 {
+			let _ = tx.take().unwrap().send(received.clone());
+		}
+		async {}
+	});
+	assert!(id != 0);
+
+	// The command can be called by its name and by its id
+	bw.exec_js(&format!("invoke_extern('ping', 'a'); invoke_extern({}, 'b')", id));
+	assert!(rx.await.unwrap() == vec![vec!["a".to_string()], vec!["b".to_string()]]);
+	bw.close();
+}
+
+async fn async_page_stream(app: ApplicationHandle) {
+	let mut bwb = BrowserWindowBuilder::new( Source::Html("<body></body>".into()) );
+	bwb.title("Page Stream Test");
+	let bw = bwb.build( app ).await;
+
+	// Without a handler, the page's writes are refused instead of dropped
+	assert!(bw.eval_js("write_extern_stream(new Uint8Array([1]))").await.is_err());
+
+	let (tx, rx) = futures_channel::oneshot::channel();
+	let mut tx = Some(tx);
+	bw.on_stream(move |_, bytes| {
+		if let Some(tx) = tx.take() {
+			let _ = tx.send(bytes.to_vec());
+		}
+	});
+
+	// The writes of one task arrive together
+	bw.exec_js("write_extern_stream(new Uint8Array([1, 2])); write_extern_stream(new Uint8Array([3]).buffer)");
+	assert!(rx.await.unwrap() == vec![1, 2, 3]);
+	bw.close();
+}
+
+async fn async_build_many(app: ApplicationHandle) {
+	let builders = ["a", "b", "c"].iter().map(|name| {
+		let mut bwb = BrowserWindowBuilder::new( Source::Html(format!("<title>{}</title>", name)) );
+		bwb.title(format!("Build Many Test {}", name));
+		bwb
+	}).collect();
+
+	// The browser windows come back in the order of their builders
+	let windows = BrowserWindowBuilder::build_many(builders, app).await;
+	assert!(windows.len() == 3);
+	for (bw, name) in windows.iter().zip(["a", "b", "c"].iter()) {
+		assert!(bw.eval_js("document.title").await.unwrap() == *name);
+	}
+	for bw in windows {
+		bw.close();
+	}
+
+	assert!(BrowserWindowBuilder::build_many(Vec::new(), app).await.is_empty());
+}
+
 async fn async_cookies(app: ApplicationHandle) {
 	let mut jar = app.cookie_jar();
 
@@ -91,6 +433,13 @@ async fn async_cookies(app: ApplicationHandle) {
 	jar.store("http://localhost/", &cookie).await.unwrap();
 	assert!(jar.clear_all().await == 1);
 
+	// Storing and deleting in batches
+	let cookies = vec![Cookie::new("a", "1"), Cookie::new("b", "2"), Cookie::new("c", "3")];
+	assert!(jar.store_many("http://localhost/", &cookies).await == 3);
+	assert!(jar.store_many("/", &cookies).await == 0);
+	assert!(jar.delete_many("http://localhost/", &["a", "b"]).await == 2);
+	assert!(jar.clear_all().await == 1);
+
 	// Using a wrong url
 	{
 		let mut iter = jar.iter("/", true);
@@ -107,10 +456,64 @@ async fn async_cookies(app: ApplicationHandle) {
 	let cookie = jar.find_from_all("name").await.unwrap();
 	assert!(cookie.name() == "name");
 	assert!(cookie.value() == "value");
+
+	// Borrowing the cookie instead of copying it
+	let mut iter = jar.iter("http://localhost/", true);
+	assert!(iter.next_with(|c| c.value().into_owned()).await.unwrap() == "value");
+	assert!(iter.next_with(|c| c.value().into_owned()).await.is_none());
+
+	// Filtering and projecting in the visitor
+	let filter = CookieFilter { name: "name", fields: CookieFields::NAME, ..Default::default() };
+	assert!(jar.count("", true, &filter).await == 1);
+	assert!(jar.count("", true, &CookieFilter { name: "other", ..Default::default() }).await == 0);
+	let mut iter = jar.iter_filtered("", true, &filter);
+	let cookie = iter.next().await.unwrap();
+	assert!(cookie.name() == "name");
+	assert!(cookie.value() == "");
+
+	// Serving resources from memory
+	app.register_resource("tests/static.txt", &b"static"[..], "");
+	app.register_resource("tests/owned.txt", b"owned".to_vec(), "text/plain");
+	assert!(app.unregister_resource("tests/owned.txt"));
+	assert!(!app.unregister_resource("tests/owned.txt"));
+
+	// Cookies of an isolated request context stay out of the global jar
+	let context = app.new_request_context(None);
+	let mut isolated_jar = context.cookie_jar();
+	isolated_jar.store("http://localhost/", &Cookie::new("isolated", "value")).await.unwrap();
+	assert!(isolated_jar.find_from_all("isolated").await.is_some());
+	assert!(jar.find_from_all("isolated").await.is_none());
 }
 
 
 
+#[test]
+/// Checking if resource packs are laid out like the C side expects them.
+fn resource_pack() {
+	let mut pack = ResourcePackBuilder::new();
+	pack.add("bundle/main.js", b"js".to_vec(), "", ContentEncoding::Gzip);
+	pack.add("bundle/index.html", b"html".to_vec(), "text/html", ContentEncoding::Identity);
+
+	let mut file = Vec::new();
+	pack.write(&mut file).unwrap();
+	assert!(&file[0..4] == b"BWPK");
+	assert!(file[8..12] == 2u32.to_le_bytes());
+
+	// The index is sorted by path, and every entry points at its own path and data
+	let entry = |i: usize, offset: usize, size: usize| {
+		let start = 16 + i * 32 + offset;
+		let mut bytes = [0u8; 8];
+		bytes[..size].copy_from_slice(&file[start..start + size]);
+		u64::from_le_bytes(bytes) as usize
+	};
+	let path = |i: usize| &file[entry(i, 0, 4)..entry(i, 0, 4) + entry(i, 4, 4)];
+	let data = |i: usize| &file[entry(i, 8, 8)..entry(i, 8, 8) + entry(i, 16, 8)];
+	assert!(path(0) == b"bundle/index.html" && data(0) == b"html");
+	assert!(path(1) == b"bundle/main.js" && data(1) == b"js");
+	assert!(&file[entry(0, 24, 4)..entry(0, 24, 4) + entry(0, 28, 2)] == b"text/html");
+	assert!(file[16 + 32 + 30] == ContentEncoding::Gzip as u8);
+}
+
 #[test]
 /// Checking if all cookie methods work correctly.
 fn cookie() {
@@ -135,6 +538,13 @@ fn cookie() {
 
 		assert!(cookie.domain() == "127.0.0.1");
 		assert!(cookie.path() == "/");
+
+		let mut buffer = String::from("prefix");
+		let ranges = cookie.append_fields(&mut buffer);
+		assert!(&buffer[ranges.name] == "name");
+		assert!(&buffer[ranges.value] == "value");
+		assert!(&buffer[ranges.domain] == "127.0.0.1");
+		assert!(&buffer[ranges.path] == "/");
 		assert!((now.duration_since(UNIX_EPOCH).unwrap() - cookie.expires().unwrap().duration_since(UNIX_EPOCH).unwrap()) < Duration::from_millis(1));
 		assert!((now.duration_since(UNIX_EPOCH).unwrap() - cookie.creation_time().duration_since(UNIX_EPOCH).unwrap()) < Duration::from_millis(1));
 }
@@ -8,6 +8,7 @@ use super::event::Event;
 
 
 pub use builder::WindowBuilder;
+pub use browser_window_core::window::WindowThrottling;
 
 
 
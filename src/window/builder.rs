@@ -2,67 +2,10 @@ use crate::application::*;
 use crate::window::*;
 
 use browser_window_core::prelude::*;
-use std::{
-	future::Future
-};
 use unsafe_send_sync::UnsafeSend;
 
 
 
-macro_rules! _def_event {
-	( $(#[$metas:meta])*, $args_type:ty, $name:ident, $name_async:ident ) => {
-		$(#[$metas])*
-		#[cfg(not(feature = "threadsafe"))]
-		pub fn $name<H>( &mut self, handler: H ) -> &mut Self where
-			H: FnMut( &$args_type ) + 'static
-		{
-			self.events.$name.register( handler );
-			self
-		}
-
-		$(#[$metas])*
-		#[cfg(feature = "threadsafe")]
-		pub fn $name<H>( &mut self, handler: H ) -> &mut Self where
-			H: FnMut( &$args_type ) + Send + 'static
-		{
-			self.events.$name.register( handler );
-			self
-		}
-
-		$(#[$metas])*
-		#[cfg(not(feature = "threadsafe"))]
-		pub fn $name_async<H,F>( &mut self, handler: H ) -> &mut Self where
-			H: FnMut( &$args_type ) -> F + 'static,
-			F: Future<Output=()> + 'static
-		{
-			self.events.$name.register_async( handler );
-			self
-		}
-
-		$(#[$metas])*
-		#[cfg(feature = "threadsafe")]
-		pub fn $name_async<H,F>( &mut self, handler: H ) -> &mut Self where
-			H: FnMut( &$args_type ) -> F + Send + 'static,
-			F: Future<Output=()> + 'static
-		{
-			self.events.$name.register_async( handler );
-			self
-		}
-	};
-}
-
-macro_rules! def_event {
-	( $(#[$metas:meta])* $args_type:ty, $name:ident, $name_async:ident ) => {
-		_def_event!( $(#[$metas])*, $args_type, $name, $name_async );
-	};
-	
-	( $(#[$metas:meta])* $name:ident, $name_async:ident ) => {
-		_def_event!( $(#[$metas])*, WindowHandle, $name, $name_async );
-	};
-}
-
-
-
 /// Exposes functionality related to constructing a window.
 pub struct WindowBuilder {
 	pub(in crate) borders: bool,
@@ -71,6 +14,7 @@ pub struct WindowBuilder {
 	pub(in crate) minimizable: bool,
 	pub(in crate) parent: Option<UnsafeSend<WindowHandle>>,
 	pub(in crate) resizable: bool,
+	pub(in crate) throttling: WindowThrottling,
 	pub(in crate) title: Option<String>,
 	pub(in crate) width: Option<u32>
 }
@@ -112,7 +56,8 @@ impl WindowBuilder {
 		let window_options = cbw_WindowOptions {
 			borders: self.borders,
 			minimizable: self.minimizable,
-			resizable: self.resizable
+			resizable: self.resizable,
+			throttling: self.throttling.to_c()
 		};
 
 		// Put event data into a user data pointer
@@ -151,7 +96,8 @@ impl WindowBuilder {
 
 	/// Configure a parent window.
 	/// When a parent window closes, this browser window will close as well.
-	/// This could be a reference to a `Browser` or `BrowserThreaded` handle.
+	/// This could be a reference to a `BrowserWindow` handle.
+	/// A `BrowserWindowThreaded` first needs to be delegated to the GUI thread, to get its `BrowserWindowHandle`.
 	pub fn parent<W>( &mut self, bw: &W ) -> &mut Self where
 		W: OwnedWindow
 	{
@@ -166,6 +112,7 @@ impl WindowBuilder {
 			minimizable: true,
 			parent: None,
 			resizable: true,
+			throttling: WindowThrottling::Hidden,
 			title: None,
 			width: None,
 			events: Box::new( WindowEvents::default() )
@@ -179,6 +126,12 @@ impl WindowBuilder {
 		self
 	}
 
+	/// Sets when the content of the window is throttled because it can't be seen.
+	/// Default is `WindowThrottling::Hidden`.
+	pub fn throttling( &mut self, throttling: WindowThrottling ) -> &mut Self {
+		self.throttling = throttling;	self
+	}
+
 	/// Sets the title of the window.
 	pub fn title<S: Into<String>>( &mut self, title: S ) -> &mut Self {
 		self.title = Some( title.into() );